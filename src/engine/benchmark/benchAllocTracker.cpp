@@ -0,0 +1,65 @@
+#include "benchAllocTracker.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+thread_local benchalloc::Counters tCounters;
+} // namespace
+
+namespace benchalloc
+{
+const Counters& threadCounters()
+{
+    return tCounters;
+}
+} // namespace benchalloc
+
+// Replaceable global allocation functions. The unaligned/aligned new-delete
+// pairs below are the only ones that need replacing: the array, nothrow and
+// sized overloads all forward to them by default ([new.delete] in the
+// standard), so every heap allocation of the benchmark binary is counted.
+
+void* operator new(std::size_t size)
+{
+    ++tCounters.allocs;
+    tCounters.bytes += size;
+    if (auto* ptr = std::malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    ++tCounters.allocs;
+    tCounters.bytes += size;
+    // aligned_alloc requires the size to be a multiple of the alignment
+    const auto alignment = static_cast<std::size_t>(align);
+    const auto rounded = (size + alignment - 1) & ~(alignment - 1);
+    if (auto* ptr = std::aligned_alloc(alignment, rounded))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+    {
+        ++tCounters.frees;
+        std::free(ptr);
+    }
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    if (ptr != nullptr)
+    {
+        ++tCounters.frees;
+        std::free(ptr);
+    }
+}
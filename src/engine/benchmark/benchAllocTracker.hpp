@@ -0,0 +1,74 @@
+#ifndef _BENCH_ALLOC_TRACKER_HPP
+#define _BENCH_ALLOC_TRACKER_HPP
+
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+/**
+ * Allocation accounting for the engine benchmarks.
+ *
+ * benchAllocTracker.cpp replaces the global operator new/delete of every
+ * binary linking `engine_bench_main` and keeps per-thread counters of each
+ * heap allocation. Wrapping the timed loop in a `benchalloc::Scope` publishes
+ * the per-iteration deltas as user counters (`allocs`, `frees`, `alloc_bytes`),
+ * so allocation creep shows up next to the timings instead of hiding inside
+ * them. User counters are part of `--benchmark_format=json` /
+ * `--benchmark_out` reports, which makes the numbers diffable across runs in
+ * CI with google-benchmark's `tools/compare.py`.
+ *
+ * Usage:
+ *     for (auto _ : state) { ... }          // preceded by
+ *     benchalloc::Scope allocs {state};     // just before the loop
+ *
+ * The counters are thread local: multi-threaded benchmarks only report the
+ * allocations of the thread owning the Scope.
+ */
+namespace benchalloc
+{
+
+struct Counters
+{
+    uint64_t allocs {0}; ///< Calls to operator new (all overloads)
+    uint64_t frees {0};  ///< Calls to operator delete (all overloads)
+    uint64_t bytes {0};  ///< Bytes requested from operator new
+};
+
+/// Running counters of the calling thread, updated by the operator replacements.
+const Counters& threadCounters();
+
+/**
+ * @brief Snapshots the thread counters on construction and publishes the
+ * per-iteration deltas as benchmark counters on destruction.
+ */
+class Scope
+{
+public:
+    explicit Scope(benchmark::State& state)
+        : m_state(state)
+        , m_start(threadCounters())
+    {
+    }
+
+    ~Scope()
+    {
+        const auto& end = threadCounters();
+        m_state.counters["allocs"] =
+            benchmark::Counter(static_cast<double>(end.allocs - m_start.allocs), benchmark::Counter::kAvgIterations);
+        m_state.counters["frees"] =
+            benchmark::Counter(static_cast<double>(end.frees - m_start.frees), benchmark::Counter::kAvgIterations);
+        m_state.counters["alloc_bytes"] =
+            benchmark::Counter(static_cast<double>(end.bytes - m_start.bytes), benchmark::Counter::kAvgIterations);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    benchmark::State& m_state;
+    Counters m_start;
+};
+
+} // namespace benchalloc
+
+#endif // _BENCH_ALLOC_TRACKER_HPP
@@ -0,0 +1,136 @@
+#include "benchPerfCounters.hpp"
+
+#ifdef __linux__
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+
+namespace
+{
+
+constexpr std::size_t N_EVENTS = 4;
+
+// Order matches the values[] block of the group read below
+constexpr std::array<std::pair<const char*, uint64_t>, N_EVENTS> EVENTS {{
+    {"cycles", PERF_COUNT_HW_CPU_CYCLES},
+    {"instrs", PERF_COUNT_HW_INSTRUCTIONS},
+    {"llc_miss", PERF_COUNT_HW_CACHE_MISSES},
+    {"br_miss", PERF_COUNT_HW_BRANCH_MISSES},
+}};
+
+int perfOpen(uint64_t config, int group)
+{
+    perf_event_attr attr {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    // The leader starts disabled and enables the whole group at once
+    attr.disabled = (group == -1) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    // Calling thread only, any CPU
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+}
+
+void warnOnce(int err)
+{
+    static bool warned = false;
+    if (!warned)
+    {
+        warned = true;
+        LOG_WARNING("Hardware counters unavailable ({}), benchmarks report wall time only. "
+                    "Lower /proc/sys/kernel/perf_event_paranoid or grant CAP_PERFMON to enable them.",
+                    std::strerror(err));
+    }
+}
+
+} // namespace
+
+namespace benchperf
+{
+
+Scope::Scope(benchmark::State& state)
+    : m_state(state)
+{
+    for (std::size_t i = 0; i < N_EVENTS; ++i)
+    {
+        const auto fd = perfOpen(EVENTS[i].second, m_fds[0]);
+        if (fd < 0)
+        {
+            warnOnce(errno);
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                close(m_fds[j]);
+                m_fds[j] = -1;
+            }
+            return;
+        }
+        m_fds[i] = fd;
+    }
+
+    ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+Scope::~Scope()
+{
+    if (m_fds[0] < 0)
+    {
+        return;
+    }
+
+    ioctl(m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // PERF_FORMAT_GROUP layout: { u64 nr; u64 values[nr]; }
+    struct
+    {
+        uint64_t nr;
+        uint64_t values[N_EVENTS];
+    } data {};
+
+    const auto bytes = read(m_fds[0], &data, sizeof(data));
+    for (auto& fd : m_fds)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    if (bytes != sizeof(data) || data.nr != N_EVENTS)
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < N_EVENTS; ++i)
+    {
+        m_state.counters[EVENTS[i].first] =
+            benchmark::Counter(static_cast<double>(data.values[i]), benchmark::Counter::kAvgIterations);
+    }
+}
+
+} // namespace benchperf
+
+#else // !__linux__
+
+namespace benchperf
+{
+
+Scope::Scope(benchmark::State& state)
+    : m_state(state)
+{
+}
+
+Scope::~Scope() = default;
+
+} // namespace benchperf
+
+#endif // __linux__
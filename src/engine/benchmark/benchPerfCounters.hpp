@@ -0,0 +1,47 @@
+#ifndef _BENCH_PERF_COUNTERS_HPP
+#define _BENCH_PERF_COUNTERS_HPP
+
+#include <array>
+
+#include <benchmark/benchmark.h>
+
+/**
+ * Hardware performance counters for the engine benchmarks.
+ *
+ * `benchperf::Scope` opens a perf_event group (cycles, instructions, LLC
+ * misses, branch misses) restricted to the calling thread, resets and enables
+ * it on construction and publishes the per-iteration averages as benchmark
+ * user counters (`cycles`, `instrs`, `llc_miss`, `br_miss`) on destruction.
+ * Wall time hides cache-behavior regressions on noisy hosts; the counter
+ * deltas do not. Like the allocation counters they flow into
+ * `--benchmark_format=json` reports for CI comparison.
+ *
+ * Usage (next to the allocation tracker, just before the timed loop):
+ *     benchperf::Scope perf {state};
+ *     for (auto _ : state) { ... }
+ *
+ * When perf_event_open is unavailable (non-Linux builds, restricted
+ * perf_event_paranoid, containers without CAP_PERFMON) the Scope degrades to
+ * a no-op and logs a single warning, so benchmarks still run everywhere.
+ */
+namespace benchperf
+{
+
+class Scope
+{
+public:
+    explicit Scope(benchmark::State& state);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    benchmark::State& m_state;
+    /// Event fds, [0] is the group leader; all -1 when the counters could not be opened
+    std::array<int, 4> m_fds {-1, -1, -1, -1};
+};
+
+} // namespace benchperf
+
+#endif // _BENCH_PERF_COUNTERS_HPP
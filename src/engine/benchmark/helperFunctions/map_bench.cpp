@@ -0,0 +1,237 @@
+/**
+ * Microbenchmarks for the most used map/transform helper builders of
+ * `opBuilderHelperMap.cpp`.
+ *
+ * Each benchmark builds the operation once with a real BuildCtx (empty schema, no field
+ * restrictions, traces disabled) and then measures only the per-event execution of the
+ * returned op, which is what runs on the decode hot path.
+ */
+#include <benchmark/benchmark.h>
+
+#include <benchAllocTracker.hpp>
+#include <benchPerfCounters.hpp>
+
+#include <base/baseTypes.hpp>
+#include <base/json.hpp>
+#include <builder/allowedFields.hpp>
+#include <schemf/schema.hpp>
+
+#include "builders/buildCtx.hpp"
+#include "builders/opmap/opBuilderHelperMap.hpp"
+
+using namespace builder::builders;
+
+namespace
+{
+
+// Base event shared by every benchmark. Mutating transforms clone it per iteration.
+constexpr auto BASE_EVENT = R"({
+    "str": "Hello World",
+    "num": 3.75,
+    "int": 42,
+    "arr": ["v", "a", "l", "u", "e"],
+    "hex": "48656C6C6F20776F726C6421",
+    "hexnum": "0x7B2D",
+    "obj": {"a": 1, "b": "two"},
+    "obj2": {"c": 3, "d": "four"},
+    "epoch": 1706172785,
+    "ip": "192.168.0.1",
+    "target": "--value--",
+    "tags": "a,b,c,d"
+})";
+
+std::shared_ptr<const IBuildCtx> benchCtx()
+{
+    auto runState = std::make_shared<RunState>();
+    runState->trace = false;
+    runState->sandbox = false;
+    runState->check = false;
+
+    const Context context {"decoder/bench/0", "policy/bench/0", "map", "bench"};
+    return std::make_shared<BuildCtx>(runState,
+                                      context,
+                                      nullptr,
+                                      nullptr,
+                                      std::make_shared<schemf::Schema>(),
+                                      std::make_shared<builder::AllowedFields>());
+}
+
+OpArg makeValue(const std::string& json)
+{
+    return std::make_shared<Value>(json::Json(json.c_str()));
+}
+
+OpArg makeRef(const std::string& dotPath)
+{
+    return std::make_shared<Reference>(dotPath);
+}
+
+base::Event makeEvent()
+{
+    return std::make_shared<json::Json>(BASE_EVENT);
+}
+
+// Map ops read the event, so the same event can be reused across iterations.
+void runMap(benchmark::State& state, const MapBuilder& builder, const std::vector<OpArg>& args)
+{
+    auto op = builder(args, benchCtx());
+    auto event = makeEvent();
+
+    benchalloc::Scope allocs {state};
+    benchperf::Scope perf {state};
+    for (auto _ : state)
+    {
+        auto result = op(event);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Transform ops mutate the event in place, so a fresh copy is needed per iteration.
+void runTransform(benchmark::State& state,
+                  const TransformBuilder& builder,
+                  const std::string& targetField,
+                  const std::vector<OpArg>& args)
+{
+    auto op = builder(Reference {targetField}, args, benchCtx());
+    const json::Json base {BASE_EVENT};
+
+    benchalloc::Scope allocs {state};
+    benchperf::Scope perf {state};
+    for (auto _ : state)
+    {
+        auto event = std::make_shared<json::Json>(base);
+        auto result = op(std::move(event));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void upcase(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperStringUP, {makeRef("str")});
+}
+
+void downcase(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperStringLO, {makeRef("str")});
+}
+
+void toInt(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperToInt, {makeRef("num"), makeValue(R"("truncate")")});
+}
+
+void numberToString(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperNumberToString, {makeRef("int")});
+}
+
+void join(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperStringFromArray, {makeRef("arr"), makeValue(R"(",")")});
+}
+
+void decodeBase16(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperStringFromHexa, {makeRef("hex")});
+}
+
+void hexToNumber(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperHexToNumber, {makeRef("hexnum")});
+}
+
+void regexExtract(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperRegexExtract, {makeRef("str"), makeValue(R"("(\\w+)")")});
+}
+
+void ipVersion(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperIPVersionFromIPStr, {makeRef("ip")});
+}
+
+void systemEpoch(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperEpochTimeFromSystem, {});
+}
+
+void dateFromEpoch(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperDateFromEpochTime, {makeRef("epoch")});
+}
+
+void getDate(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperGetDate, {});
+}
+
+void sha1(benchmark::State& state)
+{
+    runMap(state, opBuilderHelperHashSHA1, {makeRef("str")});
+}
+
+void trim(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperStringTrim, "target", {makeValue(R"("both")"), makeValue(R"("-")")});
+}
+
+void replace(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperStringReplace, "target", {makeValue(R"("-")"), makeValue(R"("+")")});
+}
+
+void split(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperAppendSplitString, "parts", {makeRef("tags"), makeValue(R"(",")")});
+}
+
+void merge(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperMerge, "obj", {makeRef("obj2")});
+}
+
+void mergeRecursive(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperMergeRecursively, "obj", {makeRef("obj2")});
+}
+
+void deleteField(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperDeleteField, "target", {});
+}
+
+void renameField(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperRenameField, "renamed", {makeRef("target")});
+}
+
+void eraseCustomFields(benchmark::State& state)
+{
+    runTransform(state, opBuilderHelperEraseCustomFields, ".", {});
+}
+
+} // namespace
+
+BENCHMARK(upcase);
+BENCHMARK(downcase);
+BENCHMARK(toInt);
+BENCHMARK(numberToString);
+BENCHMARK(join);
+BENCHMARK(decodeBase16);
+BENCHMARK(hexToNumber);
+BENCHMARK(regexExtract);
+BENCHMARK(ipVersion);
+BENCHMARK(systemEpoch);
+BENCHMARK(dateFromEpoch);
+BENCHMARK(getDate);
+BENCHMARK(sha1);
+BENCHMARK(trim);
+BENCHMARK(replace);
+BENCHMARK(split);
+BENCHMARK(merge);
+BENCHMARK(mergeRecursive);
+BENCHMARK(deleteField);
+BENCHMARK(renameField);
+BENCHMARK(eraseCustomFields);
@@ -0,0 +1,242 @@
+/**
+ * Corpus-driven benchmark for full logpar expressions.
+ *
+ * The micro benchmarks in this directory measure isolated parsers on synthetic
+ * inputs, which is optimistic: production decoders run whole logpar
+ * expressions over real traffic. This benchmark replays an NDJSON corpus of
+ * (sanitized) recorded lines through complete expressions and reports:
+ *
+ *  - parse throughput over the corpus (items/s, allocation counters), and
+ *  - per-step attribution: the syntax time of each constituent parser of the
+ *    extraction plan, as `s<N>_ns` counters (average ns per event).
+ *
+ * By default a small built-in corpus of representative syslog/sshd/apache
+ * lines is used so the benchmark runs everywhere. Point ENGINE_BENCH_CORPUS
+ * at an NDJSON file of `{"expr": "<logpar>", "event": "<raw line>"}` records
+ * to replay real recordings; records sharing an expression are grouped into
+ * one benchmark.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+
+#include <benchAllocTracker.hpp>
+
+#include <base/json.hpp>
+#include <logpar/logpar.hpp>
+#include <logpar/registerParsers.hpp>
+#include <schemf/schema.hpp>
+
+namespace
+{
+
+// Same shape as the schema/wazuh-logpar-overrides/0 store document
+constexpr auto LOGPAR_OVERRIDES = R"({"name":"schema/wazuh-logpar-overrides/0","fields":{}})";
+
+struct CorpusCase
+{
+    std::string expr;               ///< Full logpar expression of a decoder
+    std::vector<std::string> lines; ///< Recorded raw lines parsed by the expression
+};
+
+// Sanitized single-line recordings of common traffic, grouped by the
+// production-style expression that decodes them.
+std::vector<CorpusCase> builtinCorpus()
+{
+    std::vector<CorpusCase> corpus;
+
+    corpus.push_back(
+        {"<event.start/SYSLOG> <host.hostname> <process.name>[<process.pid>]: <message>",
+         {
+             "Jan 12 06:26:19 srv01 sshd[12345]: Failed password for invalid user admin from 203.0.113.45 port 4486 "
+             "ssh2",
+             "Feb  3 13:45:01 web02 cron[811]: (root) CMD (run-parts /etc/cron.hourly)",
+             "Mar 21 22:10:55 db03 systemd[1]: Started Session 4021 of user postgres.",
+             "Nov  9 04:12:33 fw01 kernel[0]: DROP IN=eth0 OUT= SRC=198.51.100.7 DST=203.0.113.10 PROTO=TCP",
+         }});
+
+    corpus.push_back(
+        {"Failed password for invalid user <user.name> from <source.ip> port <source.port> ssh2",
+         {
+             "Failed password for invalid user admin from 203.0.113.45 port 4486 ssh2",
+             "Failed password for invalid user oracle from 198.51.100.23 port 53144 ssh2",
+             "Failed password for invalid user test from 2001:db8::5c, port 40022 ssh2",
+             "Failed password for invalid user guest from 192.0.2.199 port 60150 ssh2",
+         }});
+
+    corpus.push_back(
+        {"<source.ip> - <user.name> [<~timestamp>] \"<http.request.method> <url.path> HTTP/<http.version>\" "
+         "<http.response.status_code> <http.response.body.bytes>",
+         {
+             R"(192.0.2.17 - - [26/Dec/2016:16:22:14 +0000] "GET /index.html HTTP/1.1" 200 4523)",
+             R"(198.51.100.4 - frank [10/Oct/2000:13:55:36 -0700] "POST /api/v1/login HTTP/1.1" 401 213)",
+             R"(203.0.113.88 - - [01/Jan/2024:00:00:01 +0000] "GET /static/app.js?v=3 HTTP/2.0" 304 0)",
+             R"(192.0.2.250 - alice [15/Aug/2023:09:12:44 +0200] "DELETE /files/report.pdf HTTP/1.1" 204 0)",
+         }});
+
+    return corpus;
+}
+
+// ENGINE_BENCH_CORPUS: NDJSON records {"expr": "...", "event": "..."}, grouped
+// by expression in first-seen order. Malformed lines are skipped.
+std::vector<CorpusCase> loadCorpus()
+{
+    const auto* path = std::getenv("ENGINE_BENCH_CORPUS");
+    if (path == nullptr)
+    {
+        return builtinCorpus();
+    }
+
+    std::vector<CorpusCase> corpus;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line))
+    {
+        try
+        {
+            const json::Json record(line.c_str());
+            const auto expr = record.getString("/expr");
+            const auto event = record.getString("/event");
+            if (!expr || !event)
+            {
+                continue;
+            }
+
+            auto it = std::find_if(
+                corpus.begin(), corpus.end(), [&](const CorpusCase& c) { return c.expr == expr.value(); });
+            if (it == corpus.end())
+            {
+                corpus.push_back({expr.value(), {}});
+                it = corpus.end() - 1;
+            }
+            it->lines.push_back(event.value());
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+    }
+
+    return corpus;
+}
+
+// Schema slice covering the ECS fields referenced by the built-in expressions.
+// Corpus expressions may also use custom (~) fields, which need no schema.
+std::shared_ptr<hlp::logpar::Logpar> makeLogpar()
+{
+    auto schema = std::make_shared<schemf::Schema>();
+    schema->addField("event.start", schemf::Field::Parameters {.type = schemf::Type::DATE});
+    schema->addField("host.hostname", schemf::Field::Parameters {.type = schemf::Type::KEYWORD});
+    schema->addField("process.name", schemf::Field::Parameters {.type = schemf::Type::KEYWORD});
+    schema->addField("process.pid", schemf::Field::Parameters {.type = schemf::Type::LONG});
+    schema->addField("message", schemf::Field::Parameters {.type = schemf::Type::TEXT});
+    schema->addField("user.name", schemf::Field::Parameters {.type = schemf::Type::KEYWORD});
+    schema->addField("source.ip", schemf::Field::Parameters {.type = schemf::Type::IP});
+    schema->addField("source.port", schemf::Field::Parameters {.type = schemf::Type::LONG});
+    schema->addField("url.path", schemf::Field::Parameters {.type = schemf::Type::KEYWORD});
+    schema->addField("http.request.method", schemf::Field::Parameters {.type = schemf::Type::KEYWORD});
+    schema->addField("http.version", schemf::Field::Parameters {.type = schemf::Type::KEYWORD});
+    schema->addField("http.response.status_code", schemf::Field::Parameters {.type = schemf::Type::LONG});
+    schema->addField("http.response.body.bytes", schemf::Field::Parameters {.type = schemf::Type::LONG});
+
+    auto logpar = std::make_shared<hlp::logpar::Logpar>(json::Json(LOGPAR_OVERRIDES), schema);
+    hlp::registerParsers(logpar);
+    return logpar;
+}
+
+void runCase(benchmark::State& state, const CorpusCase& corpusCase)
+{
+    hlp::parser::ExtractionPlan plan;
+    try
+    {
+        plan = makeLogpar()->buildPlan(corpusCase.expr);
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(fmt::format("Could not build '{}': {}", corpusCase.expr, e.what()).c_str());
+        return;
+    }
+
+    state.SetLabel(corpusCase.expr);
+
+    // Throughput over the corpus: the event is reused, the mapped fields are
+    // simply overwritten on every line.
+    std::size_t next = 0;
+    uint64_t failed = 0;
+    json::Json event;
+    {
+        benchalloc::Scope allocs {state};
+        for (auto _ : state)
+        {
+            auto error = plan.run(corpusCase.lines[next], event);
+            benchmark::DoNotOptimize(error);
+            if (error)
+            {
+                ++failed;
+            }
+            if (++next == corpusCase.lines.size())
+            {
+                next = 0;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["parse_fail"] = benchmark::Counter(static_cast<double>(failed), benchmark::Counter::kAvgIterations);
+
+    // Attribution pass, outside the timed loop: syntax time of each step of
+    // the plan over the whole corpus (semantic parsing and mapping excluded).
+    const auto& steps = plan.steps();
+    std::vector<double> stepNs(steps.size(), 0.0);
+    constexpr int ATTRIBUTION_ROUNDS = 64;
+    uint64_t replayed = 0;
+
+    for (int round = 0; round < ATTRIBUTION_ROUNDS; ++round)
+    {
+        for (const auto& line : corpusCase.lines)
+        {
+            ++replayed;
+            std::string_view remaining = line;
+            for (std::size_t i = 0; i < steps.size(); ++i)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                auto result = steps[i](remaining);
+                const auto end = std::chrono::steady_clock::now();
+                stepNs[i] += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+                if (result.failure())
+                {
+                    break;
+                }
+                remaining = result.remaining();
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < steps.size(); ++i)
+    {
+        state.counters[fmt::format("s{}_ns", i)] = benchmark::Counter(stepNs[i] / static_cast<double>(replayed));
+    }
+}
+
+// The corpus is only known at runtime, so the benchmarks are registered
+// dynamically before main() runs them.
+const bool registered = []()
+{
+    static const auto corpus = loadCorpus();
+    for (std::size_t i = 0; i < corpus.size(); ++i)
+    {
+        benchmark::RegisterBenchmark(fmt::format("logparCorpus/{}", i).c_str(),
+                                     [&corpusCase = corpus[i]](benchmark::State& state)
+                                     { runCase(state, corpusCase); });
+    }
+    return true;
+}();
+
+} // namespace
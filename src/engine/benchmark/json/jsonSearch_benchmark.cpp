@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <benchPerfCounters.hpp>
+
 #include <iostream>
 #include <map>
 #include <random>
@@ -69,6 +71,7 @@ static void BM_RapidJsonSearchArrHits(benchmark::State& state)
 
     auto key = input_test.getKeyToSearch(state.range(0));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         decltype(doc.Begin()) itr;
@@ -103,6 +106,7 @@ static void BM_RapidJsonSearchArrMiss(benchmark::State& state)
 
     auto key = std::string(std::string("0") + std::to_string(state.range()));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         decltype(doc.Begin()) itr;
@@ -138,6 +142,7 @@ static void BM_RapidJsonSearchObjHit(benchmark::State& state)
     auto key = input_test.getKeyToSearch(state.range(0)).c_str();
     auto jKey = rapidjson::Value(key, doc.GetAllocator());
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         if (!doc.HasMember(jKey))
@@ -163,6 +168,7 @@ static void BM_RapidJsonSearchObjMiss(benchmark::State& state)
 
     auto key = std::string(std::string("0") + std::to_string(state.range()));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         auto itr = doc.FindMember(key.c_str());
@@ -179,6 +185,7 @@ static void BM_ArrHit(benchmark::State& state)
     auto input = input_test.getInputArr(state.range(0));
     auto key = input_test.getKeyToSearch(state.range(0));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         auto it = std::find(input.begin(), input.end(), key);
@@ -195,6 +202,7 @@ static void BM_ArrMiss(benchmark::State& state)
     auto input = input_test.getInputArr(state.range(0));
     auto key = std::string(std::string("0") + std::to_string(state.range()));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         auto it = std::find(input.begin(), input.end(), key);
@@ -211,6 +219,7 @@ static void BM_MapHit(benchmark::State& state)
     auto input = input_test.getInputObj(state.range(0));
     auto key = input_test.getKeyToSearch(state.range(0));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         auto it = input.find(key);
@@ -227,6 +236,7 @@ static void BM_MapMiss(benchmark::State& state)
     auto input = input_test.getInputObj(state.range(0));
     auto key = std::string(std::string("0") + std::to_string(state.range()));
 
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         auto it = input.find(key);
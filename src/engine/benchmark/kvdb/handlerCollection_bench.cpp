@@ -0,0 +1,49 @@
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <kvdb/kvdbHandlerCollection.hpp>
+
+static constexpr auto kDbCount = 8;
+
+static std::string dbName(const int index)
+{
+    return "bench_db_" + std::to_string(index % kDbCount);
+}
+
+static kvdbManager::KVDBHandlerCollection collection;
+
+// An anchor scope keeps every DB registered across the run, so the handler set
+// is stable and the add/remove cycles exercise the lock-free read path. With
+// lock-free stable-case reads the per-op time should stay roughly flat as
+// threads are added; a rising curve means the collection serializes again.
+static void collectionSetup(const benchmark::State&)
+{
+    for (auto i = 0; i < kDbCount; ++i)
+    {
+        collection.addKVDBHandler(dbName(i), "anchor_scope");
+    }
+}
+
+static void collectionTeardown(const benchmark::State&)
+{
+    for (auto i = 0; i < kDbCount; ++i)
+    {
+        collection.removeKVDBHandler(dbName(i), "anchor_scope");
+    }
+}
+
+static void kvdbHandlerCollectionStableSet(benchmark::State& state)
+{
+    const auto scopeName = "scope_" + std::to_string(state.thread_index());
+
+    auto i = 0;
+    for (auto _ : state)
+    {
+        collection.addKVDBHandler(dbName(i), scopeName);
+        collection.removeKVDBHandler(dbName(i), scopeName);
+        ++i;
+    }
+}
+
+BENCHMARK(kvdbHandlerCollectionStableSet)->Setup(collectionSetup)->Teardown(collectionTeardown)->ThreadRange(1, 16);
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <benchPerfCounters.hpp>
+
 #include <logicexpr/logicexpr.hpp>
 
 static void BM_DijkstraEvaluator(benchmark::State& state)
@@ -61,6 +63,7 @@ static void BM_DijkstraEvaluator(benchmark::State& state)
         logicexpr::buildDijstraEvaluator<int, std::string>(expression, fakeTermBuilder, termP);
 
     // Benchamark
+    benchperf::Scope perf {state};
     for (auto _ : state)
     {
         bool result = true;
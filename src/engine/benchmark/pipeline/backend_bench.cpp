@@ -0,0 +1,80 @@
+/**
+ * Backend comparison benchmark: rxcpp vs taskflow controllers.
+ *
+ * Builds the same policy fixture (policyFixture.hpp) through `builder` into both
+ * `bk::rx` and `bk::taskf` controllers and measures the ingest path on each, so the
+ * backend choice per deployment can be made on data. The policy size is the first
+ * argument (decoders); the taskflow benchmark additionally sweeps its executor worker
+ * count as the second argument. Every benchmark thread owns its controller, as every
+ * production worker does, so ThreadRange on the rx benchmark reports the
+ * one-controller-per-worker scaling the orchestrator relies on.
+ *
+ * The iteration time is the per-event processing latency (ingestGet returns the
+ * processed event), items_per_second is the ingest throughput and the allocation
+ * counters of benchAllocTracker.hpp are reported for both backends.
+ */
+#include <cstddef>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <benchAllocTracker.hpp>
+
+#include <bk/icontroller.hpp>
+#include <bk/rx/controller.hpp>
+#include <bk/taskf/controller.hpp>
+
+#include "policyFixture.hpp"
+
+namespace
+{
+
+void runBackend(benchmark::State& state, bk::IControllerMaker& maker, std::size_t decoders)
+{
+    const benchpolicy::FixtureBuilder builder {decoders};
+    auto policy = builder.buildPolicy("policy/bench/0", false, false);
+
+    std::shared_ptr<bk::IController> controller;
+    try
+    {
+        controller = maker.create(policy->expression(), {});
+    }
+    catch (const std::exception& e)
+    {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    const auto corpus = benchpolicy::buildCorpus(decoders);
+    std::size_t next = 0;
+
+    benchalloc::Scope allocs {state};
+    for (auto _ : state)
+    {
+        auto event = std::make_shared<json::Json>(corpus[next]);
+        next = (next + 1) % corpus.size();
+        auto processed = controller->ingestGet(std::move(event));
+        benchmark::DoNotOptimize(processed);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+// args: {decoders}
+void rxBackend(benchmark::State& state)
+{
+    bk::rx::ControllerMaker maker;
+    runBackend(state, maker, static_cast<std::size_t>(state.range(0)));
+}
+
+// args: {decoders, executor workers}
+void taskfBackend(benchmark::State& state)
+{
+    bk::taskf::ControllerMaker maker {static_cast<std::size_t>(state.range(1))};
+    runBackend(state, maker, static_cast<std::size_t>(state.range(0)));
+}
+
+} // namespace
+
+BENCHMARK(rxBackend)->ArgsProduct({{8, 32}})->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(taskfBackend)->ArgsProduct({{8, 32}, {1, 2, 4}})->UseRealTime();
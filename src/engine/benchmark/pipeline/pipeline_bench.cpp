@@ -0,0 +1,66 @@
+/**
+ * End-to-end decode pipeline benchmark.
+ *
+ * Replays a corpus of recorded-style events through a real `router::Router` backed by
+ * the rxcpp controller, with a representative policy of decoders assembled from the
+ * production helper builders (see policyFixture.hpp). Every benchmark thread owns its
+ * Router and controller, mirroring how the orchestrator gives each worker its own
+ * instances, so `--benchmark_filter=pipeline` with ThreadRange reports the EPS scaling
+ * of the full decode path.
+ *
+ * Reported metrics: items_per_second is the EPS of the pipeline, the iteration time is
+ * the per-event latency, and the allocation counters of benchAllocTracker.hpp show
+ * what each event costs in heap traffic end to end.
+ */
+#include <cstddef>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <benchAllocTracker.hpp>
+
+#include <bk/rx/controller.hpp>
+
+#include "environmentBuilder.hpp"
+#include "policyFixture.hpp"
+#include "router.hpp"
+
+namespace
+{
+
+void pipeline(benchmark::State& state)
+{
+    // Each benchmark thread owns a Router and controller, as each production worker does.
+    auto fixtureBuilder = std::make_shared<benchpolicy::FixtureBuilder>();
+    auto envBuilder =
+        std::make_shared<router::EnvironmentBuilder>(fixtureBuilder, std::make_shared<bk::rx::ControllerMaker>());
+    router::Router router {envBuilder};
+
+    auto error = router.addEntry(router::prod::EntryPost {"bench", "policy/bench/0", "filter/allow-all/0", 100});
+    if (!error)
+    {
+        error = router.enableEntry("bench");
+    }
+    if (error)
+    {
+        state.SkipWithError(error->message.c_str());
+        return;
+    }
+
+    const auto corpus = benchpolicy::buildCorpus();
+    std::size_t next = 0;
+
+    benchalloc::Scope allocs {state};
+    for (auto _ : state)
+    {
+        auto event = std::make_shared<json::Json>(corpus[next]);
+        next = (next + 1) % corpus.size();
+        router.ingest(std::move(event));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(pipeline)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,192 @@
+#ifndef _BENCHMARK_PIPELINE_POLICYFIXTURE_HPP
+#define _BENCHMARK_PIPELINE_POLICYFIXTURE_HPP
+
+/**
+ * Shared policy fixture for the pipeline and backend benchmarks.
+ *
+ * Builds a representative policy of decoders from the production helper
+ * builders (check stage + normalize maps) and a matching event corpus, so
+ * every benchmark that needs a policy measures exactly the same workload.
+ */
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+#include <builder/allowedFields.hpp>
+#include <builder/ibuilder.hpp>
+#include <schemf/schema.hpp>
+
+#include "builders/baseHelper.hpp"
+#include "builders/buildCtx.hpp"
+#include "builders/opfilter/opBuilderHelperFilter.hpp"
+#include "builders/opmap/map.hpp"
+#include "builders/opmap/opBuilderHelperMap.hpp"
+
+namespace benchpolicy
+{
+
+constexpr std::size_t DEFAULT_DECODERS = 8; ///< Decoders of the fixture policy, one per corpus tag
+
+inline std::shared_ptr<const builder::builders::IBuildCtx> benchCtx(const std::string& assetName)
+{
+    using namespace builder::builders;
+
+    auto runState = std::make_shared<RunState>();
+    runState->trace = false;
+    runState->sandbox = false;
+    runState->check = false;
+
+    const Context context {assetName, "policy/bench/0", "normalize", assetName};
+    return std::make_shared<BuildCtx>(runState,
+                                      context,
+                                      nullptr,
+                                      nullptr,
+                                      std::make_shared<schemf::Schema>(),
+                                      std::make_shared<builder::AllowedFields>());
+}
+
+inline builder::builders::OpArg value(const std::string& json)
+{
+    return std::make_shared<builder::builders::Value>(json::Json(json.c_str()));
+}
+
+inline builder::builders::OpArg ref(const std::string& dotPath)
+{
+    return std::make_shared<builder::builders::Reference>(dotPath);
+}
+
+/**
+ * @brief Build a representative decoder: a check stage matching the event tag and a
+ * normalize stage of literal maps, string normalization, numeric conversion and string
+ * splitting, as a typical production decoder does.
+ */
+inline base::Expression buildDecoder(std::size_t index)
+{
+    using namespace builder::builders;
+
+    const auto name = fmt::format("decoder/app-{}/0", index);
+    auto ctx = benchCtx(name);
+
+    auto check = toExpression(
+        filterToTransform(opBuilderHelperStringEqual)(
+            Reference {"tag"}, {value(fmt::format(R"("app-{}")", index))}, ctx),
+        name + "/check");
+
+    std::vector<base::Expression> stages;
+    stages.emplace_back(toExpression(
+        mapToTransform(opmap::mapBuilder, Reference {"event.module"})(
+            Reference {}, {value(fmt::format(R"("app-{}")", index))}, ctx),
+        name + "/map.module"));
+    stages.emplace_back(toExpression(
+        mapToTransform(opBuilderHelperStringUP, Reference {"event.category"})(Reference {}, {ref("message")}, ctx),
+        name + "/upcase"));
+    stages.emplace_back(toExpression(
+        mapToTransform(opBuilderHelperToInt, Reference {"network.bytes"})(
+            Reference {}, {ref("bytes"), value(R"("truncate")")}, ctx),
+        name + "/to_int"));
+    stages.emplace_back(toExpression(
+        mapToTransform(opBuilderHelperIPVersionFromIPStr, Reference {"network.type"})(
+            Reference {}, {ref("srcip")}, ctx),
+        name + "/ip_version"));
+    stages.emplace_back(
+        toExpression(opBuilderHelperAppendSplitString(Reference {"event.type"}, {ref("tags"), value(R"(",")")}, ctx),
+                     name + "/split"));
+    stages.emplace_back(toExpression(
+        opBuilderHelperStringTrim(Reference {"padded"}, {value(R"("both")"), value(R"(" ")")}, ctx), name + "/trim"));
+
+    return base::Implication::create(name, check, base::And::create(name + "/stages", std::move(stages)));
+}
+
+/**
+ * @brief Policy fixture served by the in-benchmark builder.
+ */
+class FixturePolicy final : public builder::IPolicy
+{
+private:
+    base::Name m_name;
+    std::string m_hash;
+    std::unordered_set<base::Name> m_assets;
+    base::Expression m_expression;
+
+public:
+    explicit FixturePolicy(std::size_t decoders = DEFAULT_DECODERS)
+        : m_name {"policy/bench/0"}
+        , m_hash {"benchhash"}
+    {
+        std::vector<base::Expression> decoderExprs;
+        for (std::size_t i = 0; i < decoders; ++i)
+        {
+            decoderExprs.emplace_back(buildDecoder(i));
+            m_assets.emplace(fmt::format("decoder/app-{}/0", i));
+        }
+        m_expression = base::Or::create("policy/bench/0", std::move(decoderExprs));
+    }
+
+    const base::Name& name() const override { return m_name; }
+    const std::string& hash() const override { return m_hash; }
+    const std::unordered_set<base::Name>& assets() const override { return m_assets; }
+    const base::Expression& expression() const override { return m_expression; }
+    std::string getGraphivzStr() const override { return {}; }
+};
+
+/**
+ * @brief Builder fixture: serves the benchmark policy and an allow-all filter, so the
+ * Router and the controllers run exactly as in production without a store.
+ */
+class FixtureBuilder final : public builder::IBuilder
+{
+private:
+    std::size_t m_decoders;
+
+public:
+    explicit FixtureBuilder(std::size_t decoders = DEFAULT_DECODERS)
+        : m_decoders(decoders)
+    {
+    }
+
+    std::shared_ptr<builder::IPolicy> buildPolicy(const base::Name&, bool, bool) const override
+    {
+        return std::make_shared<FixturePolicy>(m_decoders);
+    }
+
+    base::Expression buildAsset(const base::Name& name) const override
+    {
+        return base::Term<base::EngineOp>::create(
+            name.toStr(), [](base::Event event) { return base::result::makeSuccess(std::move(event)); });
+    }
+};
+
+/**
+ * @brief One event per decoder of the fixture, round-robined by the benchmarks.
+ */
+inline std::vector<json::Json> buildCorpus(std::size_t decoders = DEFAULT_DECODERS)
+{
+    std::vector<json::Json> corpus;
+    for (std::size_t i = 0; i < decoders; ++i)
+    {
+        corpus.emplace_back(fmt::format(R"({{
+            "tag": "app-{}",
+            "message": "User login failed for admin from remote host",
+            "srcip": "10.0.{}.5",
+            "bytes": {}.5,
+            "tags": "auth,failure,admin,remote",
+            "padded": "  core sshd[{}]  "
+        }})",
+                                        i,
+                                        i % 256,
+                                        1024 + i,
+                                        7000 + i)
+                                .c_str());
+    }
+    return corpus;
+}
+
+} // namespace benchpolicy
+
+#endif // _BENCHMARK_PIPELINE_POLICYFIXTURE_HPP
@@ -13,6 +13,8 @@
 namespace api::adapter
 {
 using RouteHandler = std::function<void(const httplib::Request&, httplib::Response&)>;
+/// Handler for streamed request bodies, consumed through the httplib content reader
+using StreamRouteHandler = std::function<void(const httplib::Request&, httplib::Response&, const httplib::ContentReader&)>;
 namespace eEngine = ::com::wazuh::api::engine;
 
 struct Error
@@ -95,16 +97,15 @@ inline httplib::Response internalErrorResponse(const std::string& message)
     protoRes.set_status(eEngine::ReturnStatus::ERROR);
     protoRes.set_error(message);
 
-    const auto result = eMessage::eMessageToJson<Res>(protoRes);
-    if (std::holds_alternative<base::Error>(result))
-    {
-        const auto& error = std::get<base::Error>(result);
-        protoRes.set_error(error.message);
-    }
-
     httplib::Response response;
     response.status = httplib::StatusCode::InternalServerError_500;
-    response.set_content(std::get<std::string>(result), "plain/text");
+    // Serialize straight into the response body, there is no intermediate copy
+    const auto error = eMessage::eMessageToJson<Res>(protoRes, response.body);
+    if (error)
+    {
+        response.body = error->message;
+    }
+    response.set_header("Content-Type", "plain/text");
 
     return response;
 }
@@ -121,17 +122,17 @@ template<typename Res>
 httplib::Response userResponse(const Res& res)
 {
     static_assert(std::is_base_of_v<google::protobuf::Message, Res>, "Response must be a protobuf message");
-    const auto result = eMessage::eMessageToJson<Res>(res);
 
-    if (std::holds_alternative<base::Error>(result))
+    httplib::Response response;
+    response.status = httplib::StatusCode::OK_200;
+    // Serialize straight into the response body, there is no intermediate copy
+    const auto error = eMessage::eMessageToJson<Res>(res, response.body);
+    if (error)
     {
-        const auto& error = std::get<base::Error>(result);
-        return internalErrorResponse<Res>(error.message);
+        return internalErrorResponse<Res>(error->message);
     }
 
-    httplib::Response response;
-    response.status = httplib::StatusCode::OK_200;
-    response.set_content(std::get<std::string>(result), "plain/text");
+    response.set_header("Content-Type", "plain/text");
     return response;
 }
 
@@ -149,16 +150,16 @@ inline httplib::Response userErrorResponse(const std::string& message)
     protoRes.set_status(eEngine::ReturnStatus::ERROR);
     protoRes.set_error(message);
 
-    const auto result = eMessage::eMessageToJson<Res>(protoRes);
-    if (std::holds_alternative<base::Error>(result))
+    httplib::Response response;
+    response.status = httplib::StatusCode::BadRequest_400;
+    // Serialize straight into the response body, there is no intermediate copy
+    const auto error = eMessage::eMessageToJson<Res>(protoRes, response.body);
+    if (error)
     {
-        const auto& error = std::get<base::Error>(result);
-        return internalErrorResponse<Res>(error.message);
+        return internalErrorResponse<Res>(error->message);
     }
 
-    httplib::Response response;
-    response.status = httplib::StatusCode::BadRequest_400;
-    response.set_content(std::get<std::string>(result), "plain/text");
+    response.set_header("Content-Type", "plain/text");
 
     return response;
 }
@@ -82,6 +82,16 @@ TEST(ApiAdapterTest, UserResponse)
     ASSERT_EQ(protoRes.status(), gotProtoRes.status());
 }
 
+TEST(ApiAdapterTest, UserResponseBody)
+{
+    TestRes protoRes;
+    protoRes.set_status(eEngine::ReturnStatus::OK);
+    auto res = userResponse(protoRes);
+    // The body is serialized in place, the content must match the two-step serialization
+    ASSERT_EQ(res.body, std::get<std::string>(eMessage::eMessageToJson<TestRes>(protoRes)));
+    ASSERT_EQ(res.get_header_value("Content-Type"), "plain/text");
+}
+
 TEST(ApiAdapterTest, UserErrorResponse)
 {
     httplib::Response res;
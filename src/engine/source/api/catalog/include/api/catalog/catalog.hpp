@@ -2,9 +2,14 @@
 #define _CATALOG_HPP
 
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <unordered_map>
 
+#include <base/lruCache.hpp>
+
 #include <api/catalog/icatalog.hpp>
 #include <builder/ivalidator.hpp>
 
@@ -52,8 +57,52 @@ private:
     std::unordered_map<Resource::Format, std::function<base::RespOrError<std::string>(const json::Json&)>> m_outFormat;
     std::unordered_map<Resource::Format, std::function<base::RespOrError<json::Json>(const std::string&)>> m_inFormat;
 
+    /// Parsed DOMs keyed by content hash and format. A validate-then-post reload
+    /// parses each asset once instead of once per operation.
+    mutable LRUCache<std::string, json::Json> m_domCache {64};
+    /// Successful asset validations keyed by content hash and type. Asset validation
+    /// depends only on the content, so it can be reused across operations. Integration
+    /// validation depends on other store documents and is never cached.
+    mutable LRUCache<std::string, bool> m_validationCache {64};
+    mutable std::mutex m_cacheMutex; ///< Protects m_domCache and m_validationCache
+
+    /// Resource summaries per namespace, keyed by full name. Built lazily on the first
+    /// list call of each namespace and maintained on writes, so list calls never read
+    /// the documents.
+    mutable std::map<std::string, std::map<std::string, ResourceSummary>> m_summaryIndex;
+    mutable std::set<std::string> m_indexedNamespaces; ///< Namespaces with a built index
+    mutable std::mutex m_indexMutex;                   ///< Protects the summary index
+
+    /**
+     * @brief Build the summary index of the namespace if not built yet.
+     * Must be called with m_indexMutex held.
+     */
+    void ensureIndexed(const std::string& namespaceId) const;
+
+    /**
+     * @brief Insert or update the summary of a written resource. No-op if the namespace
+     * index is not built yet, the lazy build will pick the resource up.
+     */
+    void indexResource(const std::string& namespaceId, const base::Name& name, const json::Json& content);
+
+    /**
+     * @brief Drop a deleted resource (or every resource under a deleted collection)
+     * from the summary index.
+     */
+    void unindexResource(const std::string& namespaceId, const base::Name& name, bool collection);
+
     base::OptError validate(const Resource& item, const std::string& namespaceId, const json::Json& content) const;
 
+    /**
+     * @brief Parse a raw content string into a json::Json through the format handlers,
+     * reusing the cached DOM when the same content was already parsed.
+     *
+     * @param format Format of the content.
+     * @param content Raw content string.
+     * @return base::RespOrError<json::Json> Parsed DOM or error.
+     */
+    base::RespOrError<json::Json> parseContent(Resource::Format format, const std::string& content) const;
+
     /**
      * @brief Get the Document or error from the store.
      *
@@ -148,6 +197,15 @@ public:
      * @copydoc api::catalog::ICatalog::getNamespaces
      */
     inline std::vector<store::NamespaceId> getAllNamespaces() const override { return m_store->listNamespaces(); }
+
+    /**
+     * @copydoc api::catalog::ICatalog::listResources
+     */
+    base::RespOrError<ResourcePage> listResources(const std::string& namespaceId,
+                                                  const std::string& type,
+                                                  const std::string& filter,
+                                                  std::size_t page,
+                                                  std::size_t size) const override;
 };
 
 } // namespace api::catalog
@@ -15,6 +15,7 @@ adapter::RouteHandler resourceGet(const std::shared_ptr<ICatalog>& catalog);
 adapter::RouteHandler resourceDelete(const std::shared_ptr<ICatalog>& catalog);
 adapter::RouteHandler resourcePut(const std::shared_ptr<ICatalog>& catalog);
 adapter::RouteHandler resourceValidate(const std::shared_ptr<ICatalog>& catalog);
+adapter::RouteHandler resourceList(const std::shared_ptr<ICatalog>& catalog);
 adapter::RouteHandler getNamespaces(const std::shared_ptr<ICatalog>& catalog);
 
 inline void registerHandlers(const std::shared_ptr<ICatalog>& catalog, const std::shared_ptr<httpsrv::Server>& server)
@@ -24,6 +25,7 @@ inline void registerHandlers(const std::shared_ptr<ICatalog>& catalog, const std
     server->addRoute(httpsrv::Method::POST, "/catalog/resource/delete", resourceDelete(catalog));
     server->addRoute(httpsrv::Method::POST, "/catalog/resource/put", resourcePut(catalog));
     server->addRoute(httpsrv::Method::POST, "/catalog/resource/validate", resourceValidate(catalog));
+    server->addRoute(httpsrv::Method::POST, "/catalog/resource/list", resourceList(catalog));
     server->addRoute(httpsrv::Method::POST, "/catalog/namespaces/get", getNamespaces(catalog));
 }
 
@@ -8,6 +8,25 @@
 namespace api::catalog
 {
 
+/**
+ * @brief Metadata summary of a resource, kept in the in-memory catalog index.
+ */
+struct ResourceSummary
+{
+    std::string name;  ///< Full name of the resource
+    std::string type;  ///< Type of the resource (decoder, rule, etc)
+    std::string title; ///< Title from the resource metadata, empty if not present
+};
+
+/**
+ * @brief One page of resource summaries plus the total match count.
+ */
+struct ResourcePage
+{
+    std::vector<ResourceSummary> items; ///< Requested page of summaries
+    std::size_t total;                  ///< Resources matching the filters before pagination
+};
+
 class ICatalog
 {
 public:
@@ -83,6 +102,25 @@ public:
      * @return std::vector<store::NamespaceId> List of all namespaces
      */
     virtual std::vector<store::NamespaceId> getAllNamespaces() const = 0;
+
+    /**
+     * @brief List resource summaries from the in-memory index, paginated
+     *
+     * Answered from the index without reading any document, so UI polls stay cheap
+     * regardless of the catalog size.
+     *
+     * @param namespaceId Namespace to list
+     * @param type Only resources of this type, all types if empty
+     * @param filter Only names containing this substring, all names if empty
+     * @param page 1-based page number
+     * @param size Page size, cannot be 0
+     * @return base::RespOrError<ResourcePage> Page of summaries or error
+     */
+    virtual base::RespOrError<ResourcePage> listResources(const std::string& namespaceId,
+                                                          const std::string& type,
+                                                          const std::string& filter,
+                                                          std::size_t page,
+                                                          std::size_t size) const = 0;
 };
 } // namespace api::catalog
 
@@ -106,6 +106,34 @@ Catalog::Catalog(const Config& config)
     };
 }
 
+base::RespOrError<json::Json> Catalog::parseContent(Resource::Format format, const std::string& content) const
+{
+    const auto formatterIt = m_inFormat.find(format);
+    if (formatterIt == m_inFormat.end())
+    {
+        return base::Error {fmt::format("Formatter was not found for format '{}'", Resource::formatToStr(format))};
+    }
+
+    const auto key = fmt::format("{}:{}", Resource::formatToStr(format), std::hash<std::string> {}(content));
+    {
+        std::lock_guard lock {m_cacheMutex};
+        auto cached = m_domCache.getValue(key);
+        if (cached)
+        {
+            return std::move(cached).value();
+        }
+    }
+
+    auto result = formatterIt->second(content);
+    if (!base::isError(result))
+    {
+        std::lock_guard lock {m_cacheMutex};
+        m_domCache.insertKey(key, base::getResponse<json::Json>(result));
+    }
+
+    return result;
+}
+
 base::OptError
 Catalog::postResource(const Resource& collection, const std::string& namespaceStr, const std::string& content)
 {
@@ -146,7 +174,7 @@ Catalog::postResource(const Resource& collection, const std::string& namespaceSt
     // Build the resource Json, input content format must be the expected by the
     // collection and the name type of the content must be the same as the
     // collection
-    const auto formatResult = m_inFormat[collection.m_format](content);
+    const auto formatResult = parseContent(collection.m_format, content);
     if (std::holds_alternative<base::Error>(formatResult))
     {
         return base::Error {fmt::format("JSON object could not be created from '{} {}': {}",
@@ -220,6 +248,8 @@ Catalog::postResource(const Resource& collection, const std::string& namespaceSt
             "Content '{}' could not be added to store: {}", contentNameStr.value(), storeError.value().message)};
     }
 
+    indexResource(namespaceId.str(), contentResource.m_name, contentJson);
+
     return base::noError();
     ;
 }
@@ -287,7 +317,7 @@ base::OptError Catalog::putResource(const Resource& item, const std::string& con
     // content must correspond to the specified resource
     // Build the resource Json, input content format must be the expected by the
     // resource
-    const auto formatResult = m_inFormat[item.m_format](content);
+    const auto formatResult = parseContent(item.m_format, content);
     if (std::holds_alternative<base::Error>(formatResult))
     {
         return base::Error {fmt::format("JSON object could not be created from '{} {}': {}",
@@ -345,6 +375,8 @@ base::OptError Catalog::putResource(const Resource& item, const std::string& con
             "Content '{}' could not be updated in store: {}", contentNameStr.value(), storeError.value().message)};
     }
 
+    indexResource(namespaceId, item.m_name, contentJson);
+
     return base::noError();
     ;
 }
@@ -481,6 +513,9 @@ base::OptError Catalog::deleteResource(const Resource& resource, const std::stri
         {
             return error;
         }
+
+        unindexResource(namespaceId, resource.m_name, true);
+
         return base::noError();
     }
 
@@ -492,7 +527,13 @@ base::OptError Catalog::deleteResource(const Resource& resource, const std::stri
     }
 
     // Delete document
-    return delDoc(resource);
+    const auto delError = delDoc(resource);
+    if (!delError)
+    {
+        unindexResource(namespaceId, resource.m_name, false);
+    }
+
+    return delError;
 }
 
 base::OptError Catalog::validate(const Resource& item, const std::string& namespaceId, const json::Json& content) const
@@ -510,7 +551,24 @@ base::OptError Catalog::validate(const Resource& item, const std::string& namesp
     if (item.m_type == Resource::Type::decoder || item.m_type == Resource::Type::rule
         || item.m_type == Resource::Type::filter || item.m_type == Resource::Type::output)
     {
+        // Asset validation depends only on the content, reuse a previous successful
+        // validation of the same content instead of rebuilding the asset.
+        const auto key =
+            fmt::format("{}:{}", Resource::typeToStr(item.m_type), std::hash<std::string> {}(content.str()));
+        {
+            std::lock_guard lock {m_cacheMutex};
+            if (m_validationCache.getValue(key))
+            {
+                return base::noError();
+            }
+        }
+
         validationError = m_validator->validateAsset(content);
+        if (!validationError)
+        {
+            std::lock_guard lock {m_cacheMutex};
+            m_validationCache.insertKey(key, true);
+        }
     }
     else if (item.m_type == Resource::Type::integration)
     {
@@ -535,6 +593,147 @@ base::OptError Catalog::validate(const Resource& item, const std::string& namesp
     ;
 }
 
+void Catalog::ensureIndexed(const std::string& namespaceId) const
+{
+    if (m_indexedNamespaces.find(namespaceId) != m_indexedNamespaces.end())
+    {
+        return;
+    }
+
+    auto& summaries = m_summaryIndex[namespaceId];
+
+    // Walk every asset type of the namespace, descending nested collections until the
+    // documents. Paid once per namespace, afterwards the index is maintained on writes.
+    std::vector<base::Name> pending;
+    for (const auto type : {Resource::Type::decoder,
+                            Resource::Type::rule,
+                            Resource::Type::filter,
+                            Resource::Type::output,
+                            Resource::Type::integration})
+    {
+        pending.emplace_back(Resource::typeToStr(type));
+    }
+
+    while (!pending.empty())
+    {
+        auto name = std::move(pending.back());
+        pending.pop_back();
+
+        if (m_store->existsDoc(name))
+        {
+            ResourceSummary summary;
+            summary.name = name.fullName();
+            summary.type = name.parts().front();
+
+            const auto docResult = store::utils::get(m_store, name);
+            if (!base::isError(docResult))
+            {
+                summary.title = base::getResponse<store::Doc>(docResult).getString("/metadata/title").value_or("");
+            }
+
+            summaries.emplace(summary.name, std::move(summary));
+            continue;
+        }
+
+        auto colResult = m_store->readCol(name, store::NamespaceId {namespaceId});
+        if (base::isError(colResult))
+        {
+            // The type has no documents in the namespace
+            continue;
+        }
+
+        auto col = base::getResponse<store::Col>(std::move(colResult));
+        pending.insert(pending.end(), std::make_move_iterator(col.begin()), std::make_move_iterator(col.end()));
+    }
+
+    m_indexedNamespaces.insert(namespaceId);
+}
+
+void Catalog::indexResource(const std::string& namespaceId, const base::Name& name, const json::Json& content)
+{
+    std::lock_guard lock {m_indexMutex};
+    if (m_indexedNamespaces.find(namespaceId) == m_indexedNamespaces.end())
+    {
+        // The lazy build will pick the resource up
+        return;
+    }
+
+    ResourceSummary summary;
+    summary.name = name.fullName();
+    summary.type = name.parts().front();
+    summary.title = content.getString("/metadata/title").value_or("");
+
+    m_summaryIndex[namespaceId][summary.name] = std::move(summary);
+}
+
+void Catalog::unindexResource(const std::string& namespaceId, const base::Name& name, bool collection)
+{
+    std::lock_guard lock {m_indexMutex};
+    auto nsIt = m_summaryIndex.find(namespaceId);
+    if (nsIt == m_summaryIndex.end())
+    {
+        return;
+    }
+
+    if (!collection)
+    {
+        nsIt->second.erase(name.fullName());
+        return;
+    }
+
+    // Drop every resource under the collection
+    const auto prefix = name.fullName() + base::Name::SEPARATOR_S;
+    for (auto it = nsIt->second.lower_bound(prefix);
+         it != nsIt->second.end() && it->first.compare(0, prefix.size(), prefix) == 0;)
+    {
+        it = nsIt->second.erase(it);
+    }
+}
+
+base::RespOrError<ResourcePage> Catalog::listResources(const std::string& namespaceId,
+                                                       const std::string& type,
+                                                       const std::string& filter,
+                                                       std::size_t page,
+                                                       std::size_t size) const
+{
+    if (namespaceId.empty())
+    {
+        return base::Error {"Namespace id cannot be empty"};
+    }
+    if (page == 0)
+    {
+        return base::Error {"Page number starts at 1"};
+    }
+    if (size == 0)
+    {
+        return base::Error {"Page size cannot be 0"};
+    }
+
+    std::lock_guard lock {m_indexMutex};
+    ensureIndexed(namespaceId);
+
+    ResourcePage result {};
+    const auto first = (page - 1) * size;
+    for (const auto& [name, summary] : m_summaryIndex[namespaceId])
+    {
+        if (!type.empty() && summary.type != type)
+        {
+            continue;
+        }
+        if (!filter.empty() && name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+        if (result.total >= first && result.items.size() < size)
+        {
+            result.items.push_back(summary);
+        }
+        ++result.total;
+    }
+
+    return result;
+}
+
 base::OptError
 Catalog::validateResource(const Resource& item, const std::string& namespaceId, const std::string& content) const
 {
@@ -548,14 +747,7 @@ Catalog::validateResource(const Resource& item, const std::string& namespaceId,
     }
 
     // Build the content json
-    const auto formatterIt = m_inFormat.find(item.m_format);
-    if (formatterIt == m_inFormat.end())
-    {
-        return base::Error {
-            fmt::format("Formatter was not found for format '{}'", Resource::formatToStr(item.m_format))};
-    }
-
-    const auto contentJson = formatterIt->second(content);
+    const auto contentJson = parseContent(item.m_format, content);
     if (std::holds_alternative<base::Error>(contentJson))
     {
         return base::Error {
@@ -131,9 +131,9 @@ adapter::RouteHandler resourceGet(const std::shared_ptr<ICatalog>& catalog)
             res = adapter::userErrorResponse<ResponseType>(base::getError(queryRes).message);
             return;
         }
-        const auto& content = base::getResponse<std::string>(queryRes);
+        // Move the dump into the protobuf field, catalog dumps can be large
         ResponseType eResponse;
-        eResponse.set_content(content);
+        eResponse.set_content(base::getResponse<std::string>(std::move(queryRes)));
         eResponse.set_status(eEngine::ReturnStatus::OK);
 
         res = adapter::userResponse(eResponse);
@@ -335,6 +335,61 @@ adapter::RouteHandler resourceValidate(const std::shared_ptr<ICatalog>& catalog)
     };
 }
 
+adapter::RouteHandler resourceList(const std::shared_ptr<ICatalog>& catalog)
+{
+    return [weakCatalog = std::weak_ptr<ICatalog> {catalog}](const httplib::Request& req, httplib::Response& res)
+    {
+        using RequestType = eCatalog::ResourceList_Request;
+        using ResponseType = eCatalog::ResourceList_Response;
+
+        auto result = adapter::getReqAndHandler<RequestType, ResponseType, ICatalog>(req, weakCatalog);
+        if (adapter::isError(result))
+        {
+            res = adapter::getErrorResp(result);
+            return;
+        }
+
+        auto [catalog, protoReq] = adapter::getRes(result);
+
+        // Validate the params request
+        if (!protoReq.has_namespaceid())
+        {
+            res = adapter::userErrorResponse<ResponseType>("Missing /namespaceid parameter");
+            return;
+        }
+
+        const auto type = protoReq.has_type() ? Resource::typeToStr(protoReq.type()) : "";
+        const auto page = protoReq.has_page() ? protoReq.page() : 1;
+        const auto size = protoReq.has_size() ? protoReq.size() : 50;
+
+        // Call catalog
+        auto queryRes = catalog->listResources(protoReq.namespaceid(), type, protoReq.filter(), page, size);
+
+        if (base::isError(queryRes))
+        {
+            res = adapter::userErrorResponse<ResponseType>(base::getError(queryRes).message);
+            return;
+        }
+
+        const auto& resourcePage = base::getResponse<ResourcePage>(queryRes);
+        ResponseType eResponse;
+        for (const auto& summary : resourcePage.items)
+        {
+            auto* eItem = eResponse.add_items();
+            eItem->set_name(summary.name);
+            eItem->set_type(Resource::strToType(summary.type.c_str()));
+            if (!summary.title.empty())
+            {
+                eItem->set_title(summary.title);
+            }
+        }
+        eResponse.set_total(static_cast<uint32_t>(resourcePage.total));
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        res = adapter::userResponse(eResponse);
+    };
+}
+
 adapter::RouteHandler getNamespaces(const std::shared_ptr<ICatalog>& catalog)
 {
     return [weakCatalog = std::weak_ptr<ICatalog> {catalog}](const httplib::Request& req, httplib::Response& res)
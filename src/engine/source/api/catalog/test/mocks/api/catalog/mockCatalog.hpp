@@ -27,6 +27,14 @@ public:
                 (const Resource& item, const std::string& namespaceId, const std::string& content),
                 (const, override));
     MOCK_METHOD(std::vector<store::NamespaceId>, getAllNamespaces, (), (const, override));
+    MOCK_METHOD(base::RespOrError<ResourcePage>,
+                listResources,
+                (const std::string& namespaceId,
+                 const std::string& type,
+                 const std::string& filter,
+                 std::size_t page,
+                 std::size_t size),
+                (const, override));
 };
 } // namespace api::catalog::mocks
 
@@ -140,3 +140,146 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(true, successResourceAssetYml, successYml, "user"),
                       std::make_tuple(true, failResourceAsset, successYml, "user"),
                       std::make_tuple(true, successCollectionAssetJson, successJson.str(), "user")));
+
+TEST(CatalogValidationCacheTest, AssetValidatedOncePerContent)
+{
+    logging::testInit();
+    auto config = getConfig();
+    auto validator = std::make_shared<builder::mocks::MockValidator>();
+    config.validator = validator;
+    api::catalog::Catalog catalog {config};
+
+    // The second validation of the same content is served from the cache
+    EXPECT_CALL(*validator, validateAsset(testing::_)).WillOnce(testing::Return(base::noError()));
+
+    ASSERT_FALSE(catalog.validateResource(successResourceAssetJson, "user", successJson.str()));
+    ASSERT_FALSE(catalog.validateResource(successResourceAssetJson, "user", successJson.str()));
+}
+
+TEST(CatalogValidationCacheTest, FailedValidationNotCached)
+{
+    logging::testInit();
+    auto config = getConfig();
+    auto validator = std::make_shared<builder::mocks::MockValidator>();
+    config.validator = validator;
+    api::catalog::Catalog catalog {config};
+
+    EXPECT_CALL(*validator, validateAsset(testing::_))
+        .WillOnce(testing::Return(base::Error {"error"}))
+        .WillOnce(testing::Return(base::noError()));
+
+    ASSERT_TRUE(catalog.validateResource(successResourceAssetJson, "user", successJson.str()));
+    ASSERT_FALSE(catalog.validateResource(successResourceAssetJson, "user", successJson.str()));
+}
+
+class CatalogListTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockStore> m_mockStore;
+    std::unique_ptr<api::catalog::Catalog> m_spCatalog;
+
+    void SetUp() override
+    {
+        logging::testInit();
+
+        m_mockStore = std::make_shared<MockStore>();
+        api::catalog::Config config;
+        config.store = m_mockStore;
+        config.validator = std::make_shared<builder::mocks::MockValidator>();
+        m_spCatalog = std::make_unique<api::catalog::Catalog>(config);
+
+        // The lazy index build walks the store once per namespace: the collections of
+        // each asset type and the title of each document
+        EXPECT_CALL(*m_mockStore, existsDoc(testing::_))
+            .WillRepeatedly(testing::Invoke([](const base::Name& name) { return name.parts().size() == 3; }));
+        EXPECT_CALL(*m_mockStore, readCol(testing::_, testing::_))
+            .Times(testing::AtMost(5)) // One walk per asset type, further list calls hit the index
+            .WillRepeatedly(testing::Invoke(
+                [](const base::Name& name, const store::NamespaceId&) -> base::RespOrError<store::Col>
+                {
+                    if (name == base::Name {"decoder"})
+                    {
+                        return store::Col {base::Name({"decoder", "a", "0"}), base::Name({"decoder", "b", "0"})};
+                    }
+                    if (name == base::Name {"rule"})
+                    {
+                        return store::Col {base::Name({"rule", "a", "0"})};
+                    }
+                    return base::Error {"error"};
+                }));
+        EXPECT_CALL(*m_mockStore, readDoc(testing::_))
+            .WillRepeatedly(testing::Invoke(
+                [](const base::Name& name) -> base::RespOrError<store::Doc>
+                {
+                    if (name == base::Name({"decoder", "a", "0"}))
+                    {
+                        return store::Doc {R"({"metadata": {"title": "Decoder A"}})"};
+                    }
+                    return store::Doc {R"({})"};
+                }));
+    }
+};
+
+TEST_F(CatalogListTest, ListFromIndex)
+{
+    auto result = m_spCatalog->listResources("ns", "", "", 1, 50);
+    ASSERT_FALSE(base::isError(result)) << base::getError(result).message;
+    auto page = base::getResponse<api::catalog::ResourcePage>(result);
+    ASSERT_EQ(page.total, 3);
+    ASSERT_EQ(page.items.size(), 3);
+    ASSERT_EQ(page.items[0].name, "decoder/a/0");
+    ASSERT_EQ(page.items[0].type, "decoder");
+    ASSERT_EQ(page.items[0].title, "Decoder A");
+    ASSERT_EQ(page.items[1].name, "decoder/b/0");
+    ASSERT_TRUE(page.items[1].title.empty());
+    ASSERT_EQ(page.items[2].name, "rule/a/0");
+
+    // Served from the index, the readCol expectation asserts the store is not hit again
+    result = m_spCatalog->listResources("ns", "", "", 1, 50);
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse<api::catalog::ResourcePage>(result).total, 3);
+}
+
+TEST_F(CatalogListTest, ListFiltersAndPaginates)
+{
+    auto result = m_spCatalog->listResources("ns", "decoder", "", 1, 50);
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse<api::catalog::ResourcePage>(result).total, 2);
+
+    result = m_spCatalog->listResources("ns", "", "a/0", 1, 50);
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse<api::catalog::ResourcePage>(result).total, 2);
+
+    // Second page of size 2: one item left, total still reports every match
+    result = m_spCatalog->listResources("ns", "", "", 2, 2);
+    ASSERT_FALSE(base::isError(result));
+    auto page = base::getResponse<api::catalog::ResourcePage>(result);
+    ASSERT_EQ(page.total, 3);
+    ASSERT_EQ(page.items.size(), 1);
+    ASSERT_EQ(page.items[0].name, "rule/a/0");
+}
+
+TEST_F(CatalogListTest, ListInvalidParams)
+{
+    ASSERT_TRUE(base::isError(m_spCatalog->listResources("", "", "", 1, 50)));
+    ASSERT_TRUE(base::isError(m_spCatalog->listResources("ns", "", "", 0, 50)));
+    ASSERT_TRUE(base::isError(m_spCatalog->listResources("ns", "", "", 1, 0)));
+}
+
+TEST_F(CatalogListTest, IndexMaintainedOnDelete)
+{
+    ASSERT_FALSE(base::isError(m_spCatalog->listResources("ns", "", "", 1, 50)));
+
+    EXPECT_CALL(*m_mockStore, getNamespace(testing::_))
+        .WillOnce(testing::Return(std::optional<store::NamespaceId> {store::NamespaceId {"ns"}}));
+    EXPECT_CALL(*m_mockStore, deleteDoc(testing::_)).WillOnce(testing::Return(base::noError()));
+
+    api::catalog::Resource toDelete {base::Name({"decoder", "a", "0"}), api::catalog::Resource::Format::json};
+    ASSERT_FALSE(m_spCatalog->deleteResource(toDelete, "ns"));
+
+    auto result = m_spCatalog->listResources("ns", "", "", 1, 50);
+    ASSERT_FALSE(base::isError(result));
+    auto page = base::getResponse<api::catalog::ResourcePage>(result);
+    ASSERT_EQ(page.total, 2);
+    ASSERT_EQ(page.items[0].name, "decoder/b/0");
+}
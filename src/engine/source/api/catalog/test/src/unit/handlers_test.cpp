@@ -650,6 +650,64 @@ INSTANTIATE_TEST_SUITE_P(
             [](const std::shared_ptr<ICatalog>& catalog) { return resourceValidate(catalog); },
             []() { return userErrorResponse<eEngine::GenericStatus_Response>("Missing /namespaceid parameter"); },
             [](auto&) {}),
+        /***********************************************************************
+         * ListResource
+         **********************************************************************/
+        // Success
+        HandlerT(
+            []()
+            {
+                eEngine::catalog::ResourceList_Request protoReq;
+                protoReq.set_namespaceid("ns");
+                protoReq.set_type(api::catalog::Resource::Type::decoder);
+                protoReq.set_filter("core");
+                protoReq.set_page(2);
+                protoReq.set_size(10);
+                return createRequest<eEngine::catalog::ResourceList_Request>(protoReq);
+            },
+            [](const std::shared_ptr<ICatalog>& catalog) { return resourceList(catalog); },
+            []()
+            {
+                eEngine::catalog::ResourceList_Response protoRes;
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                auto* item = protoRes.add_items();
+                item->set_name("decoder/core-test/0");
+                item->set_type(api::catalog::Resource::Type::decoder);
+                item->set_title("Core test");
+                protoRes.set_total(11);
+                return userResponse<eEngine::catalog::ResourceList_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                EXPECT_CALL(mock, listResources("ns", "decoder", "core", 2, 10))
+                    .WillOnce(testing::Return(api::catalog::ResourcePage {
+                        {api::catalog::ResourceSummary {"decoder/core-test/0", "decoder", "Core test"}}, 11}));
+            }),
+        // Handler Error
+        HandlerT(
+            []()
+            {
+                eEngine::catalog::ResourceList_Request protoReq;
+                protoReq.set_namespaceid("ns");
+                return createRequest<eEngine::catalog::ResourceList_Request>(protoReq);
+            },
+            [](const std::shared_ptr<ICatalog>& catalog) { return resourceList(catalog); },
+            []() { return userErrorResponse<eEngine::catalog::ResourceList_Response>("error"); },
+            [](auto& mock)
+            {
+                EXPECT_CALL(mock, listResources("ns", "", "", 1, 50))
+                    .WillOnce(testing::Return(base::Error {"error"}));
+            }),
+        // Missing namespaceid
+        HandlerT(
+            []()
+            {
+                eEngine::catalog::ResourceList_Request protoReq;
+                return createRequest<eEngine::catalog::ResourceList_Request>(protoReq);
+            },
+            [](const std::shared_ptr<ICatalog>& catalog) { return resourceList(catalog); },
+            []() { return userErrorResponse<eEngine::catalog::ResourceList_Response>("Missing /namespaceid parameter"); },
+            [](auto&) {}),
         /***********************************************************************
          * GetNamespaces
          **********************************************************************/
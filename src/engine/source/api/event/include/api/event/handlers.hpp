@@ -14,6 +14,40 @@ using ProtolHandler = std::function<std::queue<base::Event>(std::string&&)>;
 adapter::RouteHandler pushEvent(const std::shared_ptr<::router::IRouterAPI>& orchestrator,
                                 ProtolHandler protocolHandler);
 
+/**
+ * @brief Streaming variant of pushEvent: parses the NDJSON body incrementally as it
+ * arrives from the socket and posts each event to the orchestrator as soon as its
+ * line is complete, bounding buffer memory to one line instead of the whole batch.
+ *
+ * Events completed before an invalid line are already posted when the 400 response
+ * is returned.
+ *
+ * @param orchestrator Router API receiving the events.
+ * @param eventFactory Optional builder for the event documents (e.g. a recycling
+ * pool); when not given the events are allocated per line.
+ */
+adapter::StreamRouteHandler pushEventStream(const std::shared_ptr<::router::IRouterAPI>& orchestrator,
+                                            std::function<base::Event(std::string_view)> eventFactory = nullptr);
+
+/**
+ * @brief Framed-stream variant of pushEventStream for the persistent framed socket.
+ *
+ * Returns a factory producing one frame handler per connection. Frames carry NDJSON
+ * lines with the same batch layout, but the parser state (agent header and current
+ * module/collector) lives for the whole connection, so a forwarder sends its headers
+ * once and then only event frames.
+ *
+ * A parse error throws out of the handler, dropping the connection so the client
+ * reconnects and resends its headers.
+ *
+ * @param orchestrator Router API receiving the events.
+ * @param eventFactory Optional builder for the event documents (e.g. a recycling
+ * pool); when not given the events are allocated per line.
+ */
+std::function<std::function<void(std::string_view)>()>
+pushEventFramed(const std::shared_ptr<::router::IRouterAPI>& orchestrator,
+                std::function<base::Event(std::string_view)> eventFactory = nullptr);
+
 } // namespace api::event::handlers
 
 #endif // _API_EVENT_HANDLERS_HPP
@@ -1,12 +1,13 @@
 #ifndef _API_EVENT_NDJSONPARSER_HPP
 #define _API_EVENT_NDJSONPARSER_HPP
 
+#include <algorithm>
 #include <functional>
-#include <list>
 #include <queue>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -16,6 +17,9 @@ namespace api::event::protocol
 {
 using ProtocolHandler = std::function<std::queue<base::Event>(std::string&&)>;
 
+/// Builds a base::Event from a raw event line, e.g. parsing into a pooled document
+using EventFactory = std::function<base::Event(std::string_view)>;
+
 namespace
 {
 void throwErrorMsg(const std::string& msg)
@@ -42,8 +46,9 @@ inline ProtocolHandler getNDJsonParser()
         }
 
         // Extract each json raw from ndjson
-        std::list<std::string_view> rawJson {};
+        std::vector<std::string_view> rawJson {};
         {
+            rawJson.reserve(std::count(batch.begin(), batch.end(), '\n') + 1);
             std::replace(batch.begin(), batch.end(), '\n', '\0'); // Use string as buffer
             const char* start = batch.data();
             const char* end = start + batch.size();
@@ -98,6 +103,11 @@ inline ProtocolHandler getNDJsonParser()
         // Merge the header and subheaders with the events
         std::queue<base::Event> events;
 
+        // The module/collector values are copied into every event, extract them once
+        // per subheader instead of once per event.
+        json::Json moduleJson {subHeader->getJson("/module").value()};
+        json::Json collectorJson {subHeader->getJson("/collector").value()};
+
         base::Event currentLine;
         for (auto it = std::next(rawJson.begin(), headerSize); it != rawJson.end(); ++it)
         {
@@ -113,14 +123,16 @@ inline ProtocolHandler getNDJsonParser()
             if (isSubHeader(currentLine))
             {
                 subHeader = currentLine;
+                moduleJson = subHeader->getJson("/module").value();
+                collectorJson = subHeader->getJson("/collector").value();
                 continue;
             }
 
             try
             {
                 currentLine->merge(true, agentInfo);
-                currentLine->set("/event/module", subHeader->getJson("/module").value());
-                currentLine->set("/event/collector", subHeader->getJson("/collector").value());
+                currentLine->set(base::event::modulePath(), moduleJson);
+                currentLine->set(base::event::collectorPath(), collectorJson);
                 events.push(std::move(currentLine));
             }
             catch (const std::exception& e)
@@ -133,6 +145,190 @@ inline ProtocolHandler getNDJsonParser()
     };
 }
 
+/**
+ * @brief Incremental NDJSON parser for streamed request bodies.
+ *
+ * Consumes the body chunk by chunk as it arrives from the socket, cuts events on
+ * newline boundaries and hands each one to the sink as soon as its line is complete,
+ * so buffer memory is bounded by the largest single line instead of the whole batch.
+ *
+ * The batch layout is the same as getNDJsonParser(): a header line with the agent
+ * info, a subheader line with '/module' and '/collector', and then event lines,
+ * with further subheader lines switching the module/collector of the events that
+ * follow. Events already emitted are not rolled back if a later line is invalid.
+ */
+class NDJsonStreamParser
+{
+public:
+    using EventSink = std::function<void(base::Event&&)>;
+
+private:
+    enum class Stage
+    {
+        HEADER,    ///< Waiting for the agent info line
+        SUBHEADER, ///< Waiting for the first subheader line
+        EVENTS     ///< Emitting events
+    };
+
+    Stage m_stage {Stage::HEADER};
+    std::string m_buffer; ///< Pending partial line, reused across lines
+    json::Json m_agentInfo;
+    json::Json m_module;
+    json::Json m_collector;
+    EventSink m_sink;
+    EventFactory m_factory;
+
+    static bool isSubHeader(const json::Json& line) { return line.isString("/module") && line.isString("/collector"); }
+
+    // Process a complete line, borrowed from the chunk or from the pending buffer
+    void processLine(std::string_view line)
+    {
+        if (line.empty())
+        {
+            throwErrorMsg("empty line");
+        }
+
+        switch (m_stage)
+        {
+            case Stage::HEADER:
+                try
+                {
+                    m_agentInfo = json::Json(line);
+                }
+                catch (const std::exception& e)
+                {
+                    throwErrorMsg(fmt::format("invalid header: '{}'", e.what()));
+                }
+                m_stage = Stage::SUBHEADER;
+                break;
+
+            case Stage::SUBHEADER:
+            {
+                json::Json subHeader;
+                try
+                {
+                    subHeader = json::Json(line);
+                }
+                catch (const std::exception& e)
+                {
+                    throwErrorMsg(fmt::format("invalid subheader: '{}'", e.what()));
+                }
+
+                if (!isSubHeader(subHeader))
+                {
+                    throwErrorMsg("invalid subheader, expected '/module' and '/collector' fields");
+                }
+
+                m_module = subHeader.getJson("/module").value();
+                m_collector = subHeader.getJson("/collector").value();
+                m_stage = Stage::EVENTS;
+                break;
+            }
+
+            case Stage::EVENTS:
+            {
+                base::Event event;
+                try
+                {
+                    event = m_factory ? m_factory(line) : std::make_shared<json::Json>(line);
+                }
+                catch (const std::exception& e)
+                {
+                    throwErrorMsg(fmt::format("invalid ndjson line: '{}'", e.what()));
+                }
+
+                if (isSubHeader(*event))
+                {
+                    m_module = event->getJson("/module").value();
+                    m_collector = event->getJson("/collector").value();
+                    break;
+                }
+
+                try
+                {
+                    event->merge(true, m_agentInfo);
+                    event->set(base::event::modulePath(), m_module);
+                    event->set(base::event::collectorPath(), m_collector);
+                }
+                catch (const std::exception& e)
+                {
+                    throwErrorMsg(fmt::format("invalid event: '{}'", e.what()));
+                }
+                m_sink(std::move(event));
+                break;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Construct the parser.
+     *
+     * @param sink Callback receiving each completed event.
+     * @param factory Optional builder for the event documents; when not given the
+     * events are allocated with std::make_shared.
+     */
+    explicit NDJsonStreamParser(EventSink sink, EventFactory factory = nullptr)
+        : m_sink {std::move(sink)}
+        , m_factory {std::move(factory)}
+    {
+        if (!m_sink)
+        {
+            throw std::runtime_error {"NDJson stream parser error, sink cannot be null"};
+        }
+    }
+
+    /**
+     * @brief Consume a chunk of the body, emitting the events it completes.
+     *
+     * Lines fully contained in the chunk are parsed as borrowed views, only a line
+     * split across chunks is copied into the pending buffer.
+     */
+    void write(std::string_view chunk)
+    {
+        std::size_t pos = 0;
+        while (pos < chunk.size())
+        {
+            const auto nl = chunk.find('\n', pos);
+            if (nl == std::string_view::npos)
+            {
+                m_buffer.append(chunk.substr(pos));
+                return;
+            }
+
+            if (m_buffer.empty())
+            {
+                processLine(chunk.substr(pos, nl - pos));
+            }
+            else
+            {
+                m_buffer.append(chunk.substr(pos, nl - pos));
+                processLine(m_buffer);
+                m_buffer.clear();
+            }
+            pos = nl + 1;
+        }
+    }
+
+    /**
+     * @brief Finish the stream, flushing a trailing line without newline and
+     * validating that the batch reached the event stage.
+     */
+    void end()
+    {
+        if (!m_buffer.empty())
+        {
+            processLine(m_buffer);
+            m_buffer.clear();
+        }
+
+        if (m_stage != Stage::EVENTS)
+        {
+            throwErrorMsg("invalid batch, expected at least 3 lines");
+        }
+    }
+};
+
 } // namespace api::event::protocol
 
 #endif // _API_EVENT_NDJSONPARSER_HPP
@@ -1,4 +1,7 @@
+#include <optional>
+
 #include <api/event/handlers.hpp>
+#include <api/event/ndJsonParser.hpp>
 #include <base/logging.hpp>
 
 // TODO add metrics
@@ -47,4 +50,105 @@ adapter::RouteHandler pushEvent(const std::shared_ptr<::router::IRouterAPI>& orc
         res.status = httplib::StatusCode::OK_200;
     };
 }
+
+adapter::StreamRouteHandler pushEventStream(const std::shared_ptr<::router::IRouterAPI>& orchestrator,
+                                            std::function<base::Event(std::string_view)> eventFactory)
+{
+    return [lambdaName = logging::getLambdaName(__FUNCTION__, "apiHandler"),
+            weakOrchestrator = std::weak_ptr(orchestrator),
+            eventFactory = std::move(eventFactory)](
+               const auto& req, auto& res, const httplib::ContentReader& reader)
+    {
+        auto orchestrator = weakOrchestrator.lock();
+        if (!orchestrator)
+        {
+            LOG_ERROR_L(lambdaName.c_str(), "Recieved request but orchestrator is not available");
+            res.status = httplib::StatusCode::InternalServerError_500;
+            res.set_content("{\"error\": \"Internal server error\", \"code\": 500}", "application/json");
+            return;
+        }
+
+        protocol::NDJsonStreamParser parser {[&orchestrator](base::Event&& event)
+                                             { orchestrator->postEvent(std::move(event)); },
+                                             eventFactory};
+
+        // Consume the body as it arrives, events are posted while the body is still
+        // being received. Exceptions must not cross the reader, an error aborts the
+        // read instead.
+        std::optional<std::string> parseError;
+        reader(
+            [&parser, &parseError](const char* data, std::size_t size)
+            {
+                try
+                {
+                    parser.write(std::string_view {data, size});
+                }
+                catch (const std::exception& e)
+                {
+                    parseError = e.what();
+                    return false;
+                }
+                return true;
+            });
+
+        if (!parseError)
+        {
+            try
+            {
+                parser.end();
+            }
+            catch (const std::exception& e)
+            {
+                parseError = e.what();
+            }
+        }
+
+        if (parseError)
+        {
+            LOG_ERROR_L(lambdaName.c_str(), "Failed to parse request: '{}'", parseError.value());
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(fmt::format("{{\"error\": \"{}\", \"code\": 400}}", parseError.value()),
+                            "application/json");
+            return;
+        }
+
+        res.status = httplib::StatusCode::OK_200;
+    };
+}
+
+std::function<std::function<void(std::string_view)>()>
+pushEventFramed(const std::shared_ptr<::router::IRouterAPI>& orchestrator,
+                std::function<base::Event(std::string_view)> eventFactory)
+{
+    return [lambdaName = logging::getLambdaName(__FUNCTION__, "frameHandler"),
+            weakOrchestrator = std::weak_ptr(orchestrator),
+            eventFactory](
+               ) -> std::function<void(std::string_view)>
+    {
+        // The parser state lives for the whole connection: the agent header and the
+        // current module/collector are sent once and apply to every later frame.
+        auto parser = std::make_shared<protocol::NDJsonStreamParser>(
+            [lambdaName, weakOrchestrator](base::Event&& event)
+            {
+                auto orchestrator = weakOrchestrator.lock();
+                if (!orchestrator)
+                {
+                    LOG_ERROR_L(lambdaName.c_str(), "Recieved frame but orchestrator is not available");
+                    throw std::runtime_error {"Orchestrator is not available"};
+                }
+                orchestrator->postEvent(std::move(event));
+            },
+            eventFactory);
+
+        return [parser](std::string_view frame)
+        {
+            parser->write(frame);
+            // Frames carry whole lines, terminate the last one if the client did not
+            if (frame.empty() || frame.back() != '\n')
+            {
+                parser->write("\n");
+            }
+        };
+    };
+}
 } // namespace api::event::handlers
@@ -157,3 +157,88 @@ INSTANTIATE_TEST_SUITE_P(
                              R"({"module)",
                              R"({"original":"event"})"),
                FAILURE())));
+
+// Feed a batch to the stream parser in chunks of the given size and collect the events
+std::queue<base::Event> streamParse(const std::string& batch, std::size_t chunkSize)
+{
+    std::queue<base::Event> got;
+    NDJsonStreamParser parser {[&got](base::Event&& event) { got.push(std::move(event)); }};
+
+    for (std::size_t pos = 0; pos < batch.size(); pos += chunkSize)
+    {
+        parser.write(std::string_view {batch}.substr(pos, chunkSize));
+    }
+    parser.end();
+
+    return got;
+}
+
+TEST(NdJsonStreamParserTest, NullSink)
+{
+    ASSERT_THROW(NDJsonStreamParser {nullptr}, std::runtime_error);
+}
+
+TEST(NdJsonStreamParserTest, EqualToBatchParserAcrossChunkSizes)
+{
+    const auto batch = makeRawNdJson<4>(R"({"header":"header"})",
+                                        R"({"module":"module", "collector":"collector"})",
+                                        R"({"original":"event"})");
+
+    auto expected = getNDJsonParser()(std::string {batch});
+
+    for (auto chunkSize : {std::size_t {1}, std::size_t {3}, std::size_t {16}, batch.size()})
+    {
+        std::queue<base::Event> got;
+        ASSERT_NO_THROW(got = streamParse(batch, chunkSize)) << "chunk size " << chunkSize;
+        ASSERT_EQ(expected.size(), got.size()) << "chunk size " << chunkSize;
+
+        auto expectedCopy = expected;
+        while (!expectedCopy.empty())
+        {
+            ASSERT_EQ(*expectedCopy.front(), *got.front()) << "chunk size " << chunkSize;
+            expectedCopy.pop();
+            got.pop();
+        }
+    }
+}
+
+TEST(NdJsonStreamParserTest, SubheaderSwitch)
+{
+    const auto batch = makeRawNdJson(R"({"header":"header"})",
+                                     R"({"module":"module", "collector":"collector"})",
+                                     R"({"original":"event"})",
+                                     R"({"module":"other", "collector":"other"})",
+                                     R"({"original":"event"})");
+
+    auto got = streamParse(batch, 5);
+    ASSERT_EQ(got.size(), 2);
+    got.pop();
+    ASSERT_EQ(got.front()->getString("/event/module").value(), "other");
+    ASSERT_EQ(got.front()->getString("/event/collector").value(), "other");
+}
+
+TEST(NdJsonStreamParserTest, Failures)
+{
+    // Empty batch
+    ASSERT_THROW(streamParse("", 1), std::runtime_error);
+    // Less than the minimum lines
+    ASSERT_THROW(
+        streamParse(makeRawNdJson(R"({"header":"header"})", R"({"module":"module", "collector":"collector"})"), 7),
+        std::runtime_error);
+    // Invalid header
+    ASSERT_THROW(streamParse(makeRawNdJson("header",
+                                           R"({"module":"module", "collector":"collector"})",
+                                           R"({"original":"event"})"),
+                             7),
+                 std::runtime_error);
+    // Invalid subheader
+    ASSERT_THROW(streamParse(makeRawNdJson(R"({"header":"header"})", "subheader", R"({"original":"event"})"), 7),
+                 std::runtime_error);
+    // Empty line
+    ASSERT_THROW(streamParse(makeRawNdJson(R"({"header":"header"})",
+                                           R"({"module":"module", "collector":"collector"})",
+                                           "",
+                                           R"({"original":"event"})"),
+                             7),
+                 std::runtime_error);
+}
@@ -17,6 +17,7 @@ adapter::RouteHandler managerPost(std::shared_ptr<kvdbManager::IKVDBManager> kvd
 adapter::RouteHandler managerDelete(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager);
 adapter::RouteHandler managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
                                   const std::string& kvdbScopeName);
+adapter::RouteHandler managerStats(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager);
 
 adapter::RouteHandler dbGet(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 adapter::RouteHandler dbDelete(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
@@ -24,6 +25,10 @@ adapter::RouteHandler dbDelete(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMa
 adapter::RouteHandler dbPut(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 adapter::RouteHandler dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
                                const std::string& kvdbScopeName);
+adapter::RouteHandler dbImport(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
+                               const std::string& kvdbScopeName);
+adapter::RouteHandler dbExport(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
+                               const std::string& kvdbScopeName);
 
 inline void registerHandlers(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager,
                              const std::shared_ptr<httpsrv::Server>& server)
@@ -32,11 +37,14 @@ inline void registerHandlers(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
     server->addRoute(httpsrv::Method::POST, "/kvdb/manager/post", managerPost(kvdbManager));
     server->addRoute(httpsrv::Method::POST, "/kvdb/manager/delete", managerDelete(kvdbManager));
     server->addRoute(httpsrv::Method::POST, "/kvdb/manager/dump", managerDump(kvdbManager, "kvdb"));
+    server->addRoute(httpsrv::Method::POST, "/kvdb/manager/stats", managerStats(kvdbManager));
 
     server->addRoute(httpsrv::Method::POST, "/kvdb/db/get", dbGet(kvdbManager, "kvdb"));
     server->addRoute(httpsrv::Method::POST, "/kvdb/db/delete", dbDelete(kvdbManager, "kvdb"));
     server->addRoute(httpsrv::Method::POST, "/kvdb/db/put", dbPut(kvdbManager, "kvdb"));
     server->addRoute(httpsrv::Method::POST, "/kvdb/db/search", dbSearch(kvdbManager, "kvdb"));
+    server->addRoute(httpsrv::Method::POST, "/kvdb/db/import", dbImport(kvdbManager, "kvdb"));
+    server->addRoute(httpsrv::Method::POST, "/kvdb/db/export", dbExport(kvdbManager, "kvdb"));
 }
 
 } // namespace api::kvdb::handlers
@@ -182,6 +182,8 @@ adapter::RouteHandler managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvd
                             ? std::make_optional("Field /page must be greater than 0")
                         : protoReq.has_records() && protoReq.records() == 0
                             ? std::make_optional("Field /records must be greater than 0")
+                        : protoReq.has_cursor() && protoReq.has_page()
+                            ? std::make_optional("Field /cursor cannot be combined with /page")
                             : std::nullopt;
 
         if (errorMsg.has_value())
@@ -207,18 +209,40 @@ adapter::RouteHandler managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvd
         }
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
-        auto dumpRes = handler->dump(page, records);
+        ResponseType eResponse;
+        std::list<std::pair<std::string, std::string>> content;
 
-        if (std::holds_alternative<base::Error>(dumpRes))
+        if (protoReq.has_cursor())
         {
-            res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(dumpRes).message);
-            return;
+            // Cursor mode: a lazy scan bounded to one page, resumable through /next
+            auto scanRes = handler->scan("", protoReq.cursor(), records);
+
+            if (std::holds_alternative<base::Error>(scanRes))
+            {
+                res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(scanRes).message);
+                return;
+            }
+            auto scanPage = std::move(std::get<kvdbManager::ScanPage>(scanRes));
+            content = std::move(scanPage.entries);
+            if (!scanPage.next.empty())
+            {
+                eResponse.set_next(scanPage.next);
+            }
+        }
+        else
+        {
+            auto dumpRes = handler->dump(page, records);
+
+            if (std::holds_alternative<base::Error>(dumpRes))
+            {
+                res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(dumpRes).message);
+                return;
+            }
+            content = std::move(std::get<std::list<std::pair<std::string, std::string>>>(dumpRes));
         }
-        const auto& dump = std::get<std::list<std::pair<std::string, std::string>>>(dumpRes);
-        ResponseType eResponse;
 
         auto entries = eResponse.mutable_entries();
-        for (const auto& [key, value] : dump)
+        for (const auto& [key, value] : content)
         {
             auto entry = eKVDB::Entry();
             entry.mutable_key()->assign(key);
@@ -241,6 +265,39 @@ adapter::RouteHandler managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvd
     };
 }
 
+adapter::RouteHandler managerStats(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager)
+{
+    return [wKvdb = std::weak_ptr<::kvdbManager::IKVDBManager>(kvdbManager)](const auto& req, auto& res)
+    {
+        using RequestType = eKVDB::managerStats_Request;
+        using ResponseType = eKVDB::managerStats_Response;
+
+        auto result = adapter::getReqAndHandler<RequestType, ResponseType, ::kvdbManager::IKVDBManager>(req, wKvdb);
+        if (adapter::isError(result))
+        {
+            res = adapter::getErrorResp(result);
+            return;
+        }
+
+        auto [kvdb, protoReq] = adapter::getRes(result);
+
+        const auto stats = kvdb->getStatistics();
+
+        ResponseType eResponse;
+        eResponse.set_block_cache_usage(stats.blockCacheUsage);
+        eResponse.set_block_cache_capacity(stats.blockCacheCapacity);
+        eResponse.set_block_cache_hit(stats.blockCacheHits);
+        eResponse.set_block_cache_miss(stats.blockCacheMisses);
+
+        const auto totalReads = stats.blockCacheHits + stats.blockCacheMisses;
+        eResponse.set_block_cache_hit_ratio(totalReads > 0 ? static_cast<double>(stats.blockCacheHits) / totalReads
+                                                           : 0.0);
+
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+        res = adapter::userResponse(eResponse);
+    };
+}
+
 /* Specific DB endpoint */
 adapter::RouteHandler dbGet(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
 {
@@ -445,6 +502,202 @@ adapter::RouteHandler dbPut(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManag
     };
 }
 
+adapter::RouteHandler dbImport(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [wKvdb = std::weak_ptr<::kvdbManager::IKVDBManager>(kvdbManager), kvdbScopeName](const auto& req, auto& res)
+    {
+        using RequestType = eKVDB::dbImport_Request;
+        using ResponseType = eKVDB::dbImport_Response;
+
+        auto result = adapter::getReqAndHandler<RequestType, ResponseType, ::kvdbManager::IKVDBManager>(req, wKvdb);
+        if (adapter::isError(result))
+        {
+            res = adapter::getErrorResp(result);
+            return;
+        }
+
+        auto [kvdb, protoReq] = adapter::getRes(result);
+
+        auto errorMsg = !protoReq.has_name()           ? std::make_optional(MESSAGE_MISSING_NAME)
+                        : protoReq.name().empty()      ? std::make_optional(MESSAGE_NAME_EMPTY)
+                        : !protoReq.has_content()      ? std::make_optional("Missing /content")
+                        : protoReq.content().empty()   ? std::make_optional("Field /content is empty")
+                                                       : std::nullopt;
+        if (errorMsg.has_value())
+        {
+            res = adapter::userErrorResponse<ResponseType>(errorMsg.value());
+            return;
+        }
+
+        // Parse the NDJSON content into a batch of entries
+        std::vector<std::pair<std::string, std::string>> entries;
+        std::size_t lineNumber = 0;
+        std::string_view content = protoReq.content();
+        while (!content.empty())
+        {
+            const auto end = content.find('\n');
+            const auto line = content.substr(0, end);
+            content = (end == std::string_view::npos) ? std::string_view {} : content.substr(end + 1);
+            ++lineNumber;
+
+            if (line.empty())
+            {
+                continue;
+            }
+
+            std::optional<std::string> lineError;
+            try
+            {
+                const json::Json entry {line};
+                const auto key = entry.getString("/key");
+                const auto value = entry.getJson("/value");
+                if (!key || key.value().empty())
+                {
+                    lineError = "Missing or empty /key";
+                }
+                else if (!value)
+                {
+                    lineError = "Missing /value";
+                }
+                else
+                {
+                    entries.emplace_back(key.value(), value.value().str());
+                }
+            }
+            catch (const std::exception& e)
+            {
+                lineError = e.what();
+            }
+
+            if (lineError)
+            {
+                res = adapter::userErrorResponse<ResponseType>(
+                    fmt::format("Invalid NDJSON entry at line {}: {}", lineNumber, lineError.value()));
+                return;
+            }
+        }
+
+        if (entries.empty())
+        {
+            res = adapter::userErrorResponse<ResponseType>("Field /content has no entries");
+            return;
+        }
+
+        if (!kvdb->existsDB(protoReq.name()))
+        {
+            res = adapter::userErrorResponse<ResponseType>(fmt::format(MESSAGE_DB_NOT_EXISTS, protoReq.name()));
+            return;
+        }
+
+        auto resultHandler = kvdb->getKVDBHandler(protoReq.name(), kvdbScopeName);
+
+        if (std::holds_alternative<base::Error>(resultHandler))
+        {
+            res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(resultHandler).message);
+            return;
+        }
+
+        auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+        const auto batchError = handler->putBatch(entries);
+
+        if (batchError)
+        {
+            res = adapter::userErrorResponse<ResponseType>(batchError.value().message);
+            return;
+        }
+
+        ResponseType eResponse;
+        eResponse.set_imported(static_cast<uint32_t>(entries.size()));
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+        res = adapter::userResponse(eResponse);
+    };
+}
+
+adapter::RouteHandler dbExport(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [wKvdb = std::weak_ptr<::kvdbManager::IKVDBManager>(kvdbManager), kvdbScopeName](const auto& req, auto& res)
+    {
+        using RequestType = eKVDB::dbExport_Request;
+        using ResponseType = eKVDB::dbExport_Response;
+
+        auto result = adapter::getReqAndHandler<RequestType, ResponseType, ::kvdbManager::IKVDBManager>(req, wKvdb);
+        if (adapter::isError(result))
+        {
+            res = adapter::getErrorResp(result);
+            return;
+        }
+
+        auto [kvdb, protoReq] = adapter::getRes(result);
+
+        auto errorMsg = !protoReq.has_name()      ? std::make_optional(MESSAGE_MISSING_NAME)
+                        : protoReq.name().empty() ? std::make_optional(MESSAGE_NAME_EMPTY)
+                                                  : std::nullopt;
+        if (errorMsg.has_value())
+        {
+            res = adapter::userErrorResponse<ResponseType>(errorMsg.value());
+            return;
+        }
+
+        if (!kvdb->existsDB(protoReq.name()))
+        {
+            res = adapter::userErrorResponse<ResponseType>(fmt::format(MESSAGE_DB_NOT_EXISTS, protoReq.name()));
+            return;
+        }
+
+        auto resultHandler = kvdb->getKVDBHandler(protoReq.name(), kvdbScopeName);
+
+        if (std::holds_alternative<base::Error>(resultHandler))
+        {
+            res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(resultHandler).message);
+            return;
+        }
+
+        auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+        // Walk the database through bounded scans so only one page of entries is
+        // materialized at a time, besides the content being built
+        constexpr unsigned int EXPORT_SCAN_LIMIT = 4096;
+        std::string content;
+        std::string cursor;
+        do
+        {
+            auto scanRes = handler->scan("", cursor, EXPORT_SCAN_LIMIT);
+
+            if (std::holds_alternative<base::Error>(scanRes))
+            {
+                res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(scanRes).message);
+                return;
+            }
+            auto scanPage = std::move(std::get<kvdbManager::ScanPage>(scanRes));
+
+            // One {"key", "value"} object per line, the import counterpart format
+            for (const auto& [key, value] : scanPage.entries)
+            {
+                json::Json line;
+                line.setString(key, "/key");
+                try
+                {
+                    line.set("/value", json::Json {value.c_str()});
+                }
+                catch (const std::exception&)
+                {
+                    // Keys stored through add() have no value
+                    line.setNull("/value");
+                }
+                content += line.str();
+                content += '\n';
+            }
+
+            cursor = std::move(scanPage.next);
+        } while (!cursor.empty());
+
+        ResponseType eResponse;
+        eResponse.set_content(std::move(content));
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+        res = adapter::userResponse(eResponse);
+    };
+}
+
 adapter::RouteHandler dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
 {
     return [wKvdb = std::weak_ptr<::kvdbManager::IKVDBManager>(kvdbManager), kvdbScopeName](const auto& req, auto& res)
@@ -473,6 +726,8 @@ adapter::RouteHandler dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMa
                             ? std::make_optional("Field /page must be greater than 0")
                         : protoReq.has_records() && protoReq.records() == 0
                             ? std::make_optional("Field /records must be greater than 0")
+                        : protoReq.has_cursor() && protoReq.has_page()
+                            ? std::make_optional("Field /cursor cannot be combined with /page")
                             : std::nullopt;
 
         if (errorMsg.has_value())
@@ -496,19 +751,40 @@ adapter::RouteHandler dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMa
         }
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+        ResponseType eResponse;
+        std::list<std::pair<std::string, std::string>> content;
 
-        const auto searchRes = handler->search(protoReq.prefix(), page, records);
+        if (protoReq.has_cursor())
+        {
+            // Cursor mode: a lazy scan bounded to one page, resumable through /next
+            auto scanRes = handler->scan(protoReq.prefix(), protoReq.cursor(), records);
 
-        if (std::holds_alternative<base::Error>(searchRes))
+            if (std::holds_alternative<base::Error>(scanRes))
+            {
+                res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(scanRes).message);
+                return;
+            }
+            auto scanPage = std::move(std::get<kvdbManager::ScanPage>(scanRes));
+            content = std::move(scanPage.entries);
+            if (!scanPage.next.empty())
+            {
+                eResponse.set_next(scanPage.next);
+            }
+        }
+        else
         {
-            res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(searchRes).message);
-            return;
+            auto searchRes = handler->search(protoReq.prefix(), page, records);
+
+            if (std::holds_alternative<base::Error>(searchRes))
+            {
+                res = adapter::userErrorResponse<ResponseType>(std::get<base::Error>(searchRes).message);
+                return;
+            }
+            content = std::move(std::get<std::list<std::pair<std::string, std::string>>>(searchRes));
         }
-        const auto& resultSearch = std::get<std::list<std::pair<std::string, std::string>>>(searchRes);
-        ResponseType eResponse;
 
         auto entries = eResponse.mutable_entries();
-        for (const auto& [key, value] : resultSearch)
+        for (const auto& [key, value] : content)
         {
             auto entry = eKVDB::Entry();
             entry.mutable_key()->assign(key);
@@ -47,6 +47,33 @@ INSTANTIATE_TEST_SUITE_P(
             },
             [](auto& mock)
             { EXPECT_CALL(mock, listDBs(testing::_)).WillOnce(testing::Return(std::vector<std::string> {""})); }),
+        /***********************************************************************
+         * ManagerStats
+         **********************************************************************/
+        // Success
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::managerStats_Request protoReq;
+                return createRequest<eEngine::kvdb::managerStats_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return managerStats(kvdb); },
+            []()
+            {
+                eEngine::kvdb::managerStats_Response protoRes;
+                protoRes.set_block_cache_usage(512);
+                protoRes.set_block_cache_capacity(1024);
+                protoRes.set_block_cache_hit(3);
+                protoRes.set_block_cache_miss(1);
+                protoRes.set_block_cache_hit_ratio(0.75);
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                return userResponse<eEngine::kvdb::managerStats_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                EXPECT_CALL(mock, getStatistics())
+                    .WillOnce(testing::Return(::kvdbManager::KVDBStatistics {512, 1024, 3, 1}));
+            }),
         /***********************************************************************
          * ManagerPost
          **********************************************************************/
@@ -199,6 +226,51 @@ INSTANTIATE_TEST_SUITE_P(
                 const std::list<std::pair<std::string, std::string>> mockList = {{"key1", "1"}};
                 EXPECT_CALL(*mockKvdbHanlder, dump(testing::_, testing::_)).WillOnce(testing::Return(mockList));
             }),
+        // Success with cursor
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::managerDump_Request protoReq;
+                protoReq.set_name("name");
+                protoReq.set_records(1);
+                protoReq.set_cursor("key1");
+                return createRequest<eEngine::kvdb::managerDump_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return managerDump(kvdb, "any_scope"); },
+            []()
+            {
+                eEngine::kvdb::managerDump_Response protoRes;
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                auto* entry1 = protoRes.add_entries();
+                entry1->set_key("key1");
+                entry1->mutable_value()->set_number_value(1);
+                protoRes.set_next("key2");
+                return userResponse<eEngine::kvdb::managerDump_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                auto mockKvdbHanlder = std::make_shared<MockKVDBHandler>();
+                EXPECT_CALL(mock, existsDB(testing::_)).WillOnce(testing::Return(true));
+                EXPECT_CALL(mock, getKVDBHandler(testing::_, testing::_)).WillOnce(testing::Return(mockKvdbHanlder));
+                EXPECT_CALL(*mockKvdbHanlder, scan("", "key1", 1))
+                    .WillOnce(testing::Return(::kvdbManager::ScanPage {{{"key1", "1"}}, "key2"}));
+            }),
+        // Cursor combined with page
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::managerDump_Request protoReq;
+                protoReq.set_name("name");
+                protoReq.set_page(1);
+                protoReq.set_cursor("key1");
+                return createRequest<eEngine::kvdb::managerDump_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return managerDump(kvdb, "any_scope"); },
+            []() {
+                return userErrorResponse<eEngine::kvdb::managerDump_Response>(
+                    "Field /cursor cannot be combined with /page");
+            },
+            [](auto& mock) {}),
         // Invalid page
         HandlerT(
             []()
@@ -579,6 +651,143 @@ INSTANTIATE_TEST_SUITE_P(
                 EXPECT_CALL(*mockKvdbHanlder, set(testing::_, testing::Matcher<const std::string&>(testing::Eq("1"))))
                     .WillOnce(testing::Return(base::Error {"error"}));
             }),
+        /***********************************************************************
+         * DBImport
+         **********************************************************************/
+        // Success
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbImport_Request protoReq;
+                protoReq.set_name("name");
+                protoReq.set_content("{\"key\": \"key1\", \"value\": 1}\n{\"key\": \"key2\", \"value\": \"two\"}\n");
+                return createRequest<eEngine::kvdb::dbImport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbImport(kvdb, "any_scope"); },
+            []()
+            {
+                eEngine::kvdb::dbImport_Response protoRes;
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                protoRes.set_imported(2);
+                return userResponse<eEngine::kvdb::dbImport_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                auto mockKvdbHanlder = std::make_shared<MockKVDBHandler>();
+                EXPECT_CALL(mock, existsDB(testing::_)).WillOnce(testing::Return(true));
+                EXPECT_CALL(mock, getKVDBHandler(testing::_, testing::_)).WillOnce(testing::Return(mockKvdbHanlder));
+                EXPECT_CALL(*mockKvdbHanlder,
+                            putBatch(std::vector<std::pair<std::string, std::string>> {{"key1", "1"},
+                                                                                       {"key2", "\"two\""}}))
+                    .WillOnce(testing::Return(base::noError()));
+            }),
+        // Missing name
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbImport_Request protoReq;
+                protoReq.set_content("{\"key\": \"key1\", \"value\": 1}\n");
+                return createRequest<eEngine::kvdb::dbImport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbImport(kvdb, "any_scope"); },
+            []() { return userErrorResponse<eEngine::kvdb::dbImport_Response>("Missing /name"); },
+            [](auto& mock) {}),
+        // Invalid NDJSON line
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbImport_Request protoReq;
+                protoReq.set_name("name");
+                protoReq.set_content("{\"key\": \"key1\", \"value\": 1}\n{\"value\": 2}\n");
+                return createRequest<eEngine::kvdb::dbImport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbImport(kvdb, "any_scope"); },
+            []()
+            { return userErrorResponse<eEngine::kvdb::dbImport_Response>(
+                  "Invalid NDJSON entry at line 2: Missing or empty /key"); },
+            [](auto& mock) {}),
+        // Handler error
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbImport_Request protoReq;
+                protoReq.set_name("name");
+                protoReq.set_content("{\"key\": \"key1\", \"value\": 1}\n");
+                return createRequest<eEngine::kvdb::dbImport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbImport(kvdb, "any_scope"); },
+            []() { return userErrorResponse<eEngine::kvdb::dbImport_Response>("error"); },
+            [](auto& mock)
+            {
+                auto mockKvdbHanlder = std::make_shared<MockKVDBHandler>();
+                EXPECT_CALL(mock, existsDB(testing::_)).WillOnce(testing::Return(true));
+                EXPECT_CALL(mock, getKVDBHandler(testing::_, testing::_)).WillOnce(testing::Return(mockKvdbHanlder));
+                EXPECT_CALL(*mockKvdbHanlder, putBatch(testing::_)).WillOnce(testing::Return(base::Error {"error"}));
+            }),
+        /***********************************************************************
+         * DBExport
+         **********************************************************************/
+        // Success
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbExport_Request protoReq;
+                protoReq.set_name("name");
+                return createRequest<eEngine::kvdb::dbExport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbExport(kvdb, "any_scope"); },
+            []()
+            {
+                eEngine::kvdb::dbExport_Response protoRes;
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                protoRes.set_content("{\"key\":\"key1\",\"value\":1}\n{\"key\":\"key2\",\"value\":null}\n");
+                return userResponse<eEngine::kvdb::dbExport_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                auto mockKvdbHanlder = std::make_shared<MockKVDBHandler>();
+                EXPECT_CALL(mock, existsDB(testing::_)).WillOnce(testing::Return(true));
+                EXPECT_CALL(mock, getKVDBHandler(testing::_, testing::_)).WillOnce(testing::Return(mockKvdbHanlder));
+                EXPECT_CALL(*mockKvdbHanlder, scan("", "", testing::_))
+                    .WillOnce(testing::Return(
+                        ::kvdbManager::ScanPage {{{"key1", "1"}, {"key2", ""}}, ""}));
+            }),
+        // Success across several scan pages
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbExport_Request protoReq;
+                protoReq.set_name("name");
+                return createRequest<eEngine::kvdb::dbExport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbExport(kvdb, "any_scope"); },
+            []()
+            {
+                eEngine::kvdb::dbExport_Response protoRes;
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                protoRes.set_content("{\"key\":\"key1\",\"value\":1}\n{\"key\":\"key2\",\"value\":2}\n");
+                return userResponse<eEngine::kvdb::dbExport_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                auto mockKvdbHanlder = std::make_shared<MockKVDBHandler>();
+                EXPECT_CALL(mock, existsDB(testing::_)).WillOnce(testing::Return(true));
+                EXPECT_CALL(mock, getKVDBHandler(testing::_, testing::_)).WillOnce(testing::Return(mockKvdbHanlder));
+                EXPECT_CALL(*mockKvdbHanlder, scan("", "", testing::_))
+                    .WillOnce(testing::Return(::kvdbManager::ScanPage {{{"key1", "1"}}, "key2"}));
+                EXPECT_CALL(*mockKvdbHanlder, scan("", "key2", testing::_))
+                    .WillOnce(testing::Return(::kvdbManager::ScanPage {{{"key2", "2"}}, ""}));
+            }),
+        // Missing name
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbExport_Request protoReq;
+                return createRequest<eEngine::kvdb::dbExport_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbExport(kvdb, "any_scope"); },
+            []() { return userErrorResponse<eEngine::kvdb::dbExport_Response>("Missing /name"); },
+            [](auto& mock) {}),
         /***********************************************************************
          * DBSearch
          **********************************************************************/
@@ -611,4 +820,34 @@ INSTANTIATE_TEST_SUITE_P(
                 const std::list<std::pair<std::string, std::string>> mockList = {{"key1", "1"}};
                 EXPECT_CALL(*mockKvdbHanlder, search(testing::_, testing::_, testing::_))
                     .WillOnce(testing::Return(mockList));
+            }),
+        // Success with cursor
+        HandlerT(
+            []()
+            {
+                eEngine::kvdb::dbSearch_Request protoReq;
+                protoReq.set_name("name");
+                protoReq.set_prefix("key");
+                protoReq.set_records(1);
+                protoReq.set_cursor("");
+                return createRequest<eEngine::kvdb::dbSearch_Request>(protoReq);
+            },
+            [](const std::shared_ptr<::kvdbManager::IKVDBManager>& kvdb) { return dbSearch(kvdb, "any_scope"); },
+            []()
+            {
+                eEngine::kvdb::dbSearch_Response protoRes;
+                protoRes.set_status(eEngine::ReturnStatus::OK);
+                auto* entry1 = protoRes.add_entries();
+                entry1->set_key("key1");
+                entry1->mutable_value()->set_number_value(1);
+                protoRes.set_next("key2");
+                return userResponse<eEngine::kvdb::dbSearch_Response>(protoRes);
+            },
+            [](auto& mock)
+            {
+                auto mockKvdbHanlder = std::make_shared<MockKVDBHandler>();
+                EXPECT_CALL(mock, existsDB(testing::_)).WillOnce(testing::Return(true));
+                EXPECT_CALL(mock, getKVDBHandler(testing::_, testing::_)).WillOnce(testing::Return(mockKvdbHanlder));
+                EXPECT_CALL(*mockKvdbHanlder, scan("key", "", 1))
+                    .WillOnce(testing::Return(::kvdbManager::ScanPage {{{"key1", "1"}}, "key2"}));
             })));
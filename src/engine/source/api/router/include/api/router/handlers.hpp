@@ -23,6 +23,11 @@ adapter::RouteHandler getEpsSettings(const std::shared_ptr<::router::IRouterAPI>
 adapter::RouteHandler activateEpsLimiter(const std::shared_ptr<::router::IRouterAPI>& router);
 adapter::RouteHandler deactivateEpsLimiter(const std::shared_ptr<::router::IRouterAPI>& router);
 
+adapter::RouteHandler activateProfiler(const std::shared_ptr<::router::IRouterAPI>& router);
+adapter::RouteHandler deactivateProfiler(const std::shared_ptr<::router::IRouterAPI>& router);
+adapter::RouteHandler profileGet(const std::shared_ptr<::router::IRouterAPI>& router);
+adapter::RouteHandler memoryGet(const std::shared_ptr<::router::IRouterAPI>& router);
+
 inline void registerHandlers(const std::shared_ptr<::router::IRouterAPI>& router,
                              const std::shared_ptr<api::policy::IPolicy>& policy,
                              const std::shared_ptr<httpsrv::Server>& server)
@@ -39,6 +44,12 @@ inline void registerHandlers(const std::shared_ptr<::router::IRouterAPI>& router
     server->addRoute(httpsrv::Method::POST, "/router/eps/getSettings", getEpsSettings(router));
     server->addRoute(httpsrv::Method::POST, "/router/eps/activate", activateEpsLimiter(router));
     server->addRoute(httpsrv::Method::POST, "/router/eps/deactivate", deactivateEpsLimiter(router));
+
+    server->addRoute(httpsrv::Method::POST, "/router/profile/activate", activateProfiler(router));
+    server->addRoute(httpsrv::Method::POST, "/router/profile/deactivate", deactivateProfiler(router));
+    server->addRoute(httpsrv::Method::POST, "/router/profile/get", profileGet(router));
+
+    server->addRoute(httpsrv::Method::POST, "/router/memory/get", memoryGet(router));
 }
 
 } // namespace api::router::handlers
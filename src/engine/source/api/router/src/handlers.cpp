@@ -3,6 +3,7 @@
 #include <api/adapter/adapter.hpp>
 #include <api/adapter/helpers.hpp>
 #include <api/router/handlers.hpp>
+#include <base/json.hpp>
 #include <eMessages/router.pb.h>
 #include <router/iapi.hpp>
 
@@ -467,4 +468,153 @@ adapter::RouteHandler deactivateEpsLimiter(const std::shared_ptr<::router::IRout
     };
 }
 
+// The profile handlers do not use protobuf messages: they take a plain JSON body with
+// the route name and return a plain text table, as the report is meant to be read
+// directly by an operator.
+namespace
+{
+base::RespOrError<std::string> getNameFromBody(const httplib::Request& req)
+{
+    json::Json body {};
+    try
+    {
+        body = json::Json {req.body.c_str()};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Invalid JSON request: {}", e.what())};
+    }
+
+    const auto name = body.getString("/name");
+    if (!name)
+    {
+        return base::Error {"Missing /name in request"};
+    }
+
+    return name.value();
+}
+} // namespace
+
+adapter::RouteHandler activateProfiler(const std::shared_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = std::weak_ptr<::router::IRouterAPI>(router)](const auto& req, auto& res)
+    {
+        auto router = wRouter.lock();
+        if (!router)
+        {
+            res.status = httplib::StatusCode::InternalServerError_500;
+            res.set_content("Router API is not available", "text/plain");
+            return;
+        }
+
+        const auto name = getNameFromBody(req);
+        if (base::isError(name))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(name).message, "text/plain");
+            return;
+        }
+
+        const auto error = router->activateProfiler(base::getResponse(name), true);
+        if (base::isError(error))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(error).message, "text/plain");
+            return;
+        }
+
+        res.set_content("OK", "text/plain");
+    };
+}
+
+adapter::RouteHandler deactivateProfiler(const std::shared_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = std::weak_ptr<::router::IRouterAPI>(router)](const auto& req, auto& res)
+    {
+        auto router = wRouter.lock();
+        if (!router)
+        {
+            res.status = httplib::StatusCode::InternalServerError_500;
+            res.set_content("Router API is not available", "text/plain");
+            return;
+        }
+
+        const auto name = getNameFromBody(req);
+        if (base::isError(name))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(name).message, "text/plain");
+            return;
+        }
+
+        const auto error = router->activateProfiler(base::getResponse(name), false);
+        if (base::isError(error))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(error).message, "text/plain");
+            return;
+        }
+
+        res.set_content("OK", "text/plain");
+    };
+}
+
+adapter::RouteHandler profileGet(const std::shared_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = std::weak_ptr<::router::IRouterAPI>(router)](const auto& req, auto& res)
+    {
+        auto router = wRouter.lock();
+        if (!router)
+        {
+            res.status = httplib::StatusCode::InternalServerError_500;
+            res.set_content("Router API is not available", "text/plain");
+            return;
+        }
+
+        const auto name = getNameFromBody(req);
+        if (base::isError(name))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(name).message, "text/plain");
+            return;
+        }
+
+        const auto report = router->getProfile(base::getResponse(name));
+        if (base::isError(report))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(report).message, "text/plain");
+            return;
+        }
+
+        res.set_content(base::getResponse(report), "text/plain");
+    };
+}
+
+// Same convention as the profile handlers: a plain text report meant to be read
+// directly by an operator. No request body is needed, the report covers every route.
+adapter::RouteHandler memoryGet(const std::shared_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = std::weak_ptr<::router::IRouterAPI>(router)](const auto& req, auto& res)
+    {
+        auto router = wRouter.lock();
+        if (!router)
+        {
+            res.status = httplib::StatusCode::InternalServerError_500;
+            res.set_content("Router API is not available", "text/plain");
+            return;
+        }
+
+        const auto report = router->getMemory();
+        if (base::isError(report))
+        {
+            res.status = httplib::StatusCode::BadRequest_400;
+            res.set_content(base::getError(report).message, "text/plain");
+            return;
+        }
+
+        res.set_content(base::getResponse(report), "text/plain");
+    };
+}
+
 } // namespace api::router::handlers
@@ -2,14 +2,135 @@
 #define _H_BASE_TYPES
 
 #include "result.hpp"
+#include <atomic>
 #include <base/json.hpp>
+#include <cstdint>
 #include <functional>
+#include <string>
+#include <string_view>
 
 namespace base
 {
 using Event = std::shared_ptr<json::Json>;
 using ConstEvent = const std::shared_ptr<const json::Json>&;
 using EngineOp = std::function<result::Result<Event>(Event)>;
+
+namespace event
+{
+// Sampled ingress timestamp (steady clock, nanoseconds) stamped on 1-in-N events when
+// they are posted to the event queue. It is read by the latency histograms recorded at
+// router completion and at the indexer bulk acknowledgement, and erased from the event
+// before it is indexed.
+constexpr std::string_view INGRESS_TIMESTAMP_PATH = "/_engine_ingress_ns";
+
+// Hot fields touched by nearly every route and decoder. Their pointers are compiled
+// once per process so the per-event accesses skip the JSON pointer tokenizer and go
+// straight to the DOM node.
+constexpr std::string_view MODULE_PATH = "/event/module";
+constexpr std::string_view COLLECTOR_PATH = "/event/collector";
+constexpr std::string_view AGENT_ID_PATH = "/agent/id";
+
+inline const json::CompiledPath& ingressTimestampPath()
+{
+    static const json::CompiledPath path {INGRESS_TIMESTAMP_PATH};
+    return path;
+}
+
+inline const json::CompiledPath& modulePath()
+{
+    static const json::CompiledPath path {MODULE_PATH};
+    return path;
+}
+
+inline const json::CompiledPath& collectorPath()
+{
+    static const json::CompiledPath path {COLLECTOR_PATH};
+    return path;
+}
+
+inline const json::CompiledPath& agentIdPath()
+{
+    static const json::CompiledPath path {AGENT_ID_PATH};
+    return path;
+}
+
+/**
+ * @brief Epoch advanced by the pipeline backends for every event (or bundle) they
+ * push, so the serialization cache can tell a recycled allocation apart from the
+ * event it cached.
+ */
+inline std::atomic<std::uint64_t>& pipelineEpoch()
+{
+    static std::atomic<std::uint64_t> epoch {0};
+    return epoch;
+}
+
+/**
+ * @brief Advance the pipeline epoch. Called by the backends when a new event or
+ * bundle enters the pipeline.
+ */
+inline void advancePipelineEpoch()
+{
+    pipelineEpoch().fetch_add(1, std::memory_order_relaxed);
+}
+
+namespace detail
+{
+/// Per-thread cache of the last serialized event.
+struct SerializationCache
+{
+    const void* event {nullptr};
+    std::uint64_t epoch {0};
+    std::string buffer;
+};
+
+inline SerializationCache& serializationCache()
+{
+    thread_local SerializationCache cache;
+    return cache;
+}
+} // namespace detail
+
+/**
+ * @brief Serialize an event, sharing the buffer across the output terms of one pass.
+ *
+ * An event matching several outputs used to be stringified once per output. The
+ * last serialization is kept per thread, keyed by the event address and the
+ * pipeline epoch: the backends advance the epoch for every event they push, so an
+ * allocation recycled by a later event can never resurface a stale buffer. A miss
+ * costs exactly the json::Json::str() it would have paid anyway.
+ *
+ * @param event Event to serialize. Must not be mutated between output terms; a
+ * term that does mutate it must call invalidateSerialization() afterwards.
+ * @return const std::string& Serialized event, valid until the next call on this
+ * thread.
+ */
+inline const std::string& serializeOnce(ConstEvent event)
+{
+    auto& cache = detail::serializationCache();
+
+    const auto epoch = pipelineEpoch().load(std::memory_order_relaxed);
+    if (cache.event != static_cast<const void*>(event.get()) || cache.epoch != epoch)
+    {
+        // Serialize into the retained buffer: after warm-up the capacity covers the
+        // working event size and a miss costs no allocation at all
+        event->str(cache.buffer);
+        cache.event = event.get();
+        cache.epoch = epoch;
+    }
+
+    return cache.buffer;
+}
+
+/**
+ * @brief Drop this thread's cached serialization after mutating an event that may
+ * already have gone through serializeOnce().
+ */
+inline void invalidateSerialization()
+{
+    detail::serializationCache().event = nullptr;
+}
+} // namespace event
 } // namespace base
 
 #endif //_H_BASE_TYPES
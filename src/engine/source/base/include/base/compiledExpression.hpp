@@ -0,0 +1,367 @@
+#ifndef _COMPILED_EXPRESSION_H
+#define _COMPILED_EXPRESSION_H
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+#include <base/json.hpp>
+
+namespace base::eval
+{
+
+/**
+ * @brief An expression flattened into a branch-threaded program.
+ *
+ * Evaluating an Expression tree per event pays one std::function hop and one
+ * virtual dispatch per operation node just to combine the term results. A
+ * CompiledExpression resolves all that control flow at compile time: the tree
+ * is lowered once into a flat array of instructions, each holding a term
+ * operation and the index of the next instruction for the success and failure
+ * outcomes. Per event only the terms themselves run, driven by a tight
+ * interpreter loop with no recursion or intermediate allocations.
+ *
+ * Combinator semantics match the backend controllers: And succeeds when every
+ * operand succeeds, Or when any succeeds, Chain and Broadcast run every
+ * operand and always succeed, and Implication runs its consequence only when
+ * the condition succeeds, failing otherwise.
+ *
+ * Or nodes carrying a dispatch hint (see base::Or::DispatchHint) are lowered
+ * into a single-probe dispatch: the discriminating field is read once and the
+ * program jumps straight to the operand whose literal matches, or past the
+ * whole run when none does. The hint guarantees the run operands are mutually
+ * exclusive, so skipping the scan cannot change the result.
+ *
+ * Or nodes pinned mutually exclusive without a dispatch hint keep the
+ * sequential scan, but the program counts which branch accepted each event:
+ * at most one operand can succeed, so their order does not affect the result
+ * and the owner may periodically recompile with hitOrders() to scan the
+ * hottest branches first. The counters are plain integers, a program belongs
+ * to one controller and is evaluated from one thread at a time.
+ */
+class CompiledExpression
+{
+public:
+    /// Operand visit orders per pinned Or node id, hottest branch first
+    using Orders = std::unordered_map<unsigned int, std::vector<std::size_t>>;
+
+private:
+    /// Sentinel program counters for the two terminal outcomes
+    static constexpr std::size_t ACCEPT = static_cast<std::size_t>(-1);
+    static constexpr std::size_t REJECT = static_cast<std::size_t>(-2);
+
+    /// Single-probe jump table compiled from a dispatch hint
+    struct Dispatch
+    {
+        json::CompiledPath m_field; ///< Discriminating field, pre-tokenized
+        /// Literal -> entry program counter; std::less<> enables lookups with
+        /// the string view read from the event, without materializing a key
+        std::map<std::string, std::size_t, std::less<>> m_cases;
+        std::size_t m_onMiss; ///< Program counter when no literal matches or the field is not a string
+    };
+
+    /// Sentinel for instructions that do not count a branch hit
+    static constexpr std::size_t NO_COUNTER = static_cast<std::size_t>(-1);
+
+    /// Branch of a pinned Or, identifying a slot in m_hits
+    struct BranchCounter
+    {
+        unsigned int m_node;   ///< Id of the pinned Or node
+        std::size_t m_operand; ///< Operand index within the node
+    };
+
+    struct Instruction
+    {
+        EngineOp m_op;           ///< Term operation to execute
+        std::size_t m_onSuccess; ///< Next program counter when the term succeeds
+        std::size_t m_onFailure; ///< Next program counter when the term fails
+        std::shared_ptr<const Dispatch> m_dispatch {}; ///< Set instead of m_op for dispatch instructions
+        std::size_t m_counter {NO_COUNTER}; ///< Hit slot incremented instead of running m_op
+    };
+
+    std::vector<Instruction> m_program;      ///< Flattened program
+    std::size_t m_entry;                     ///< Entry program counter
+    std::vector<BranchCounter> m_counters;   ///< Branches behind each hit slot
+    mutable std::vector<std::uint64_t> m_hits; ///< Accepted events per branch since compilation
+    Orders m_orders;                         ///< Operand orders to honor while lowering
+
+    /**
+     * @brief Lower a node, returning its entry program counter.
+     *
+     * Children are lowered right to left so every jump target is already
+     * emitted when its predecessor is compiled.
+     */
+    std::size_t lower(const Expression& node, std::size_t onSuccess, std::size_t onFailure)
+    {
+        if (node->isTerm())
+        {
+            auto term = node->getPtr<Term<EngineOp>>();
+            m_program.push_back(Instruction {term->getFn(), onSuccess, onFailure});
+            return m_program.size() - 1;
+        }
+
+        if (!node->isOperation())
+        {
+            throw std::runtime_error("Expression node is neither a term nor an operation");
+        }
+
+        const auto& operands = node->getPtr<Operation>()->getOperands();
+
+        if (node->isAnd())
+        {
+            auto entry = onSuccess;
+            for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+            {
+                entry = lower(*it, entry, onFailure);
+            }
+            return entry;
+        }
+
+        if (node->isOr())
+        {
+            auto orNode = node->getPtr<Or>();
+            const auto& hint = orNode->dispatchHint();
+            if (hint)
+            {
+                return lowerDispatchedOr(operands, *hint, onSuccess, onFailure);
+            }
+
+            if (orNode->isMutuallyExclusive())
+            {
+                return lowerCountedOr(orNode, onSuccess, onFailure);
+            }
+
+            auto entry = onFailure;
+            for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+            {
+                entry = lower(*it, onSuccess, entry);
+            }
+            return entry;
+        }
+
+        if (node->isChain() || node->isBroadcast())
+        {
+            // Run every operand regardless of its result, then succeed
+            auto entry = onSuccess;
+            for (auto it = operands.rbegin(); it != operands.rend(); ++it)
+            {
+                entry = lower(*it, entry, entry);
+            }
+            return entry;
+        }
+
+        if (node->isImplication())
+        {
+            if (operands.size() != 2)
+            {
+                throw std::runtime_error("Implication expression must have exactly two operands");
+            }
+
+            // The consequence always succeeds once the condition held
+            auto thenEntry = lower(operands[1], onSuccess, onSuccess);
+            return lower(operands[0], thenEntry, onFailure);
+        }
+
+        throw std::runtime_error("Unsupported operation in expression");
+    }
+
+    /**
+     * @brief Lower an Or whose operands [first, first+count) carry a dispatch
+     * hint, returning the entry program counter.
+     *
+     * The hinted run collapses into one dispatch instruction: on a literal
+     * match the program jumps to that operand, and both a probe miss and a
+     * failure of the dispatched operand continue after the run, since the hint
+     * guarantees no other run operand can succeed. Operands around the run
+     * keep the sequential Or chaining.
+     */
+    std::size_t lowerDispatchedOr(const std::vector<std::shared_ptr<Formula>>& operands,
+                                  const Or::DispatchHint& hint,
+                                  std::size_t onSuccess,
+                                  std::size_t onFailure)
+    {
+        // Operands after the run, chained right to left as in a plain Or
+        auto afterRun = onFailure;
+        for (auto i = operands.size(); i > hint.first + hint.count; --i)
+        {
+            afterRun = lower(operands[i - 1], onSuccess, afterRun);
+        }
+
+        auto dispatch = std::make_shared<Dispatch>();
+        dispatch->m_field = json::CompiledPath {hint.field};
+        dispatch->m_onMiss = afterRun;
+        for (const auto& [literal, index] : hint.cases)
+        {
+            dispatch->m_cases.emplace(literal, lower(operands[index], onSuccess, afterRun));
+        }
+
+        m_program.push_back(Instruction {nullptr, afterRun, afterRun, std::move(dispatch)});
+        auto entry = m_program.size() - 1;
+
+        // Operands before the run fall through to the dispatch on failure
+        for (auto i = hint.first; i > 0; --i)
+        {
+            entry = lower(operands[i - 1], onSuccess, entry);
+        }
+        return entry;
+    }
+
+    /**
+     * @brief Lower a pinned Or counting which branch accepts each event,
+     * returning the entry program counter.
+     *
+     * Every operand succeeds into a counting trampoline that increments its
+     * hit slot before accepting. Operands are visited in the order m_orders
+     * prescribes for the node, falling back to document order; the pin
+     * guarantees at most one operand can succeed, so any order is sound.
+     */
+    std::size_t lowerCountedOr(const std::shared_ptr<Or>& node, std::size_t onSuccess, std::size_t onFailure)
+    {
+        const auto& operands = node->getOperands();
+
+        std::vector<std::size_t> order(operands.size());
+        std::iota(order.begin(), order.end(), 0);
+        auto it = m_orders.find(node->getId());
+        if (it != m_orders.end() && it->second.size() == order.size())
+        {
+            order = it->second;
+        }
+
+        auto entry = onFailure;
+        for (auto pos = order.size(); pos > 0; --pos)
+        {
+            auto index = order[pos - 1];
+            m_counters.push_back(BranchCounter {node->getId(), index});
+            m_program.push_back(Instruction {nullptr, onSuccess, onSuccess, nullptr, m_counters.size() - 1});
+            entry = lower(operands[index], m_program.size() - 1, entry);
+        }
+        return entry;
+    }
+
+public:
+    CompiledExpression()
+        : m_entry {ACCEPT}
+    {
+    }
+
+    /**
+     * @brief Compile the given expression into a flat program.
+     *
+     * @param expression The expression to compile.
+     * @throws std::runtime_error If the expression contains unsupported nodes.
+     */
+    static CompiledExpression compile(const Expression& expression) { return compile(expression, {}); }
+
+    /**
+     * @brief Compile the given expression, visiting the operands of pinned Or
+     * nodes in the given orders.
+     *
+     * @param expression The expression to compile.
+     * @param orders Operand orders per pinned Or node id, typically the
+     * hitOrders() of the previous program. Nodes without an entry, or whose
+     * entry does not cover every operand, keep document order.
+     * @throws std::runtime_error If the expression contains unsupported nodes.
+     */
+    static CompiledExpression compile(const Expression& expression, Orders orders)
+    {
+        CompiledExpression compiled;
+        compiled.m_orders = std::move(orders);
+        compiled.m_entry = compiled.lower(expression, ACCEPT, REJECT);
+        compiled.m_hits.assign(compiled.m_counters.size(), 0);
+        return compiled;
+    }
+
+    /**
+     * @brief Evaluate the program against an event.
+     *
+     * @param event The event every term operates on.
+     * @return true if the expression accepted the event.
+     */
+    bool operator()(const Event& event) const
+    {
+        auto pc = m_entry;
+        while (pc < m_program.size())
+        {
+            const auto& instruction = m_program[pc];
+            if (instruction.m_dispatch)
+            {
+                const auto& dispatch = *instruction.m_dispatch;
+                const auto value = event->getStringView(dispatch.m_field);
+                if (value)
+                {
+                    auto it = dispatch.m_cases.find(value.value());
+                    pc = it != dispatch.m_cases.end() ? it->second : dispatch.m_onMiss;
+                }
+                else
+                {
+                    pc = dispatch.m_onMiss;
+                }
+                continue;
+            }
+            if (instruction.m_counter != NO_COUNTER)
+            {
+                ++m_hits[instruction.m_counter];
+                pc = instruction.m_onSuccess;
+                continue;
+            }
+            pc = instruction.m_op(event).success() ? instruction.m_onSuccess : instruction.m_onFailure;
+        }
+        return pc == ACCEPT;
+    }
+
+    /**
+     * @brief Whether the program counts branch hits, i.e. it lowered at least
+     * one pinned Or without a dispatch hint.
+     */
+    bool countsBranchHits() const { return !m_counters.empty(); }
+
+    /**
+     * @brief Operand orders per pinned Or node, sorted by observed hits.
+     *
+     * The sort is stable over the current visit order, so branches with equal
+     * hits keep their relative position across recompilations.
+     */
+    Orders hitOrders() const
+    {
+        std::unordered_map<unsigned int, std::vector<std::pair<std::uint64_t, std::size_t>>> branches;
+        for (std::size_t slot = 0; slot < m_counters.size(); ++slot)
+        {
+            branches[m_counters[slot].m_node].emplace_back(m_hits[slot], m_counters[slot].m_operand);
+        }
+
+        Orders orders;
+        for (auto& [nodeId, nodeBranches] : branches)
+        {
+            // Slots were appended while lowering right to left, restore visit order
+            std::reverse(nodeBranches.begin(), nodeBranches.end());
+            std::stable_sort(nodeBranches.begin(),
+                             nodeBranches.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+            auto& order = orders[nodeId];
+            order.reserve(nodeBranches.size());
+            for (const auto& [hits, operand] : nodeBranches)
+            {
+                order.push_back(operand);
+            }
+        }
+        return orders;
+    }
+
+    /**
+     * @brief Number of instructions in the program.
+     */
+    std::size_t size() const { return m_program.size(); }
+};
+
+} // namespace base::eval
+
+#endif // _COMPILED_EXPRESSION_H
@@ -2,8 +2,12 @@
 #define _DOT_PATH_HPP
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <fmt/core.h>
@@ -14,59 +18,103 @@
 /**
  * @brief A dot-separated path, used to navigate nested field structures.
  *
+ * Equal paths are interned: parsing a path string yields a shared immutable
+ * representation (integer id + string + parts), so copies are a shared pointer copy and
+ * equality is an identity compare instead of a string compare. The interning table only
+ * grows, which is fine for the intended use: the distinct paths of a deployment are the
+ * schema and policy fields, a bounded set that is touched over and over.
  */
 class DotPath
 {
 private:
-    std::string m_str;                ///< The string representation of the path
-    std::vector<std::string> m_parts; ///< The parts of the path
+    /**
+     * @brief The shared immutable representation of a parsed path.
+     */
+    struct Rep
+    {
+        std::string str;                ///< The string representation of the path
+        std::vector<std::string> parts; ///< The parts of the path
+        size_t id;                      ///< Unique id of this path, usable as an equality token
+    };
+
+    std::shared_ptr<const Rep> m_rep; ///< Shared parsed representation, never null
 
     /**
-     * @brief Parse the string representation of the path into its parts.
+     * @brief Parse a path string into its representation.
      *
-     * @throws std::runtime_error if the path is empty or has empty parts
+     * @param str Path string, already without the optional leading dot.
+     * @param id Id to assign to the representation.
+     * @throws std::runtime_error if the path has empty parts
      */
-    void parse()
+    static std::shared_ptr<const Rep> parse(std::string str, size_t id)
     {
-        m_parts.clear();
-
-        // Remove optional leading dot
-        if (base::utils::string::startsWith(m_str, "."))
-        {
-            m_str = m_str.substr(1);
-        }
+        auto rep = std::make_shared<Rep>();
+        rep->str = std::move(str);
+        rep->id = id;
 
         // Handle root path (empty string)
-        if (m_str.empty())
+        if (rep->str.empty())
         {
-            return;
+            return rep;
         }
 
-        m_parts = base::utils::string::splitEscaped(m_str, '.', '\\');
+        rep->parts = base::utils::string::splitEscaped(rep->str, '.', '\\');
 
-        for (auto part : m_parts)
+        for (const auto& part : rep->parts)
         {
-            if (part.empty() && m_str != ".")
+            if (part.empty() && rep->str != ".")
             {
                 throw std::runtime_error("DotPath cannot have empty parts");
             }
         }
+
+        return rep;
     }
 
-    void copy(const DotPath& rhs)
+    /**
+     * @brief Return the shared representation of a path string, parsing it only the first
+     * time the path is seen.
+     *
+     * @param str Path string, with or without the optional leading dot.
+     * @throws std::runtime_error if the path has empty parts
+     */
+    static std::shared_ptr<const Rep> intern(std::string str)
     {
-        m_str = rhs.m_str;
-        m_parts = rhs.m_parts;
+        // Remove optional leading dot
+        if (base::utils::string::startsWith(str, "."))
+        {
+            str = str.substr(1);
+        }
+
+        static std::shared_mutex mutex;
+        static std::unordered_map<std::string, std::shared_ptr<const Rep>> table;
+
+        // Known paths, the steady-state case, only need a shared lock
+        {
+            std::shared_lock lock {mutex};
+            if (const auto it = table.find(str); it != table.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock {mutex};
+        // Another thread may have interned the path between the locks
+        if (const auto it = table.find(str); it != table.end())
+        {
+            return it->second;
+        }
+
+        auto rep = parse(str, table.size());
+        return table.emplace(rep->str, std::move(rep)).first->second;
     }
 
-    void move(DotPath&& rhs) noexcept
+public:
+    DotPath()
+        : m_rep(intern(""))
     {
-        m_str = std::move(rhs.m_str);
-        m_parts = std::move(rhs.m_parts);
     }
 
-public:
-    DotPath() = default;
     ~DotPath() = default;
 
     /**
@@ -76,9 +124,8 @@ public:
      * @throws std::runtime_error if the path is empty or has empty parts
      */
     DotPath(const std::string& str)
-        : m_str(str)
+        : m_rep(intern(str))
     {
-        parse();
     }
 
     /**
@@ -88,9 +135,8 @@ public:
      * @throws std::runtime_error if the path is empty or has empty parts
      */
     DotPath(const char str[])
-        : m_str(str)
+        : m_rep(intern(str))
     {
-        parse();
     }
 
     /**
@@ -100,18 +146,18 @@ public:
      * @param end
      * @throws std::runtime_error if the path is empty or has empty parts
      */
-    DotPath(decltype(m_parts.cbegin()) begin, const decltype(m_parts.cend())& end)
+    DotPath(std::vector<std::string>::const_iterator begin, std::vector<std::string>::const_iterator end)
     {
-        m_str = "";
+        std::string str;
         for (auto it = begin; it != end; ++it)
         {
-            m_str += *it;
+            str += *it;
             if (it != end - 1)
             {
-                m_str += ".";
+                str += ".";
             }
         }
-        parse();
+        m_rep = intern(std::move(str));
     }
 
     /**
@@ -119,14 +165,7 @@ public:
      *
      * @param rhs
      */
-    DotPath(const DotPath& rhs) { copy(rhs); }
-
-    /**
-     * @brief Construct a new Dot Path object
-     *
-     * @param rhs
-     */
-    DotPath(DotPath&& rhs) noexcept { move(std::move(rhs)); }
+    DotPath(const DotPath& rhs) = default;
 
     /**
      * @brief Copy assignment operator
@@ -134,44 +173,29 @@ public:
      * @param rhs
      * @return DotPath&
      */
-    DotPath& operator=(const DotPath& rhs)
-    {
-        copy(rhs);
-        return *this;
-    }
-
-    /**
-     * @brief Move assignment operator
-     *
-     * @param rhs
-     * @return DotPath&
-     */
-    DotPath& operator=(DotPath&& rhs) noexcept
-    {
-        move(std::move(rhs));
-        return *this;
-    }
+    DotPath& operator=(const DotPath& rhs) = default;
 
     /**
      * @brief Constant iterator to the beginning of the path parts
      *
      * @return auto
      */
-    auto cbegin() const { return m_parts.cbegin(); }
+    auto cbegin() const { return m_rep->parts.cbegin(); }
 
     /**
      * @brief Constant iterator to the end of the path parts
      *
      * @return auto
      */
-    auto cend() const { return m_parts.cend(); }
+    auto cend() const { return m_rep->parts.cend(); }
 
-    friend bool operator==(const DotPath& lhs, const DotPath& rhs) { return lhs.m_str == rhs.m_str; }
+    // Equal paths share one interned representation, so equality is an identity compare.
+    friend bool operator==(const DotPath& lhs, const DotPath& rhs) { return lhs.m_rep == rhs.m_rep; }
     friend bool operator!=(const DotPath& lhs, const DotPath& rhs) { return !(lhs == rhs); }
 
     friend std::ostream& operator<<(std::ostream& os, const DotPath& dp)
     {
-        os << dp.m_str;
+        os << dp.str();
         return os;
     }
 
@@ -180,21 +204,28 @@ public:
      *
      * @return std::string
      */
-    explicit operator std::string() const { return m_str; }
+    explicit operator std::string() const { return m_rep->str; }
 
     /**
      * @brief Get the string representation of the path
      *
      * @return const std::string&
      */
-    const std::string& str() const { return m_str; }
+    const std::string& str() const { return m_rep->str; }
 
     /**
      * @brief Get the parts of the path
      *
      * @return const std::vector<std::string>&
      */
-    const std::vector<std::string>& parts() const { return m_parts; }
+    const std::vector<std::string>& parts() const { return m_rep->parts; }
+
+    /**
+     * @brief Get the unique id of the interned path, usable as an equality token
+     *
+     * @return size_t
+     */
+    size_t id() const { return m_rep->id; }
 
     /**
      * @brief Check if the path is the root path
@@ -202,7 +233,7 @@ public:
      * @return true
      * @return false
      */
-    bool isRoot() const { return m_parts.empty(); }
+    bool isRoot() const { return m_rep->parts.empty(); }
 
     /**
      * @brief Transform pointer path string to dot path string
@@ -285,7 +316,7 @@ namespace std
 template<>
 struct hash<DotPath>
 {
-    std::size_t operator()(const DotPath& path) const { return std::hash<std::string> {}(path.str()); }
+    std::size_t operator()(const DotPath& path) const { return std::hash<std::size_t> {}(path.id()); }
 };
 } // namespace std
 
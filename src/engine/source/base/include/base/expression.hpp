@@ -3,8 +3,11 @@
 
 #include <algorithm>
 #include <functional>
+#include <map>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include <fmt/format.h>
@@ -409,6 +412,24 @@ class Or : public Operation
     */
 
 public:
+    /**
+     * @brief Single-probe dispatch hint over one discriminating field.
+     *
+     * Set by the builder when a contiguous run of operands is known to begin by
+     * comparing the same event field against pairwise distinct string literals:
+     * at most one of them can succeed, so a backend may read the field once and
+     * jump straight to the matching operand instead of scanning the run, and on
+     * a miss skip the run entirely. The hint never changes semantics, backends
+     * that ignore it evaluate the operands sequentially as always.
+     */
+    struct DispatchHint
+    {
+        std::string field;                                      ///< Discriminating field, as a JSON pointer path
+        std::map<std::string, std::size_t, std::less<>> cases;  ///< Literal -> index of the operand it selects
+        std::size_t first;                                      ///< Index of the first operand covered by the hint
+        std::size_t count;                                      ///< Number of contiguous operands covered
+    };
+
     /**
      * @brief Construct a new Or operation object.
      *
@@ -431,6 +452,36 @@ public:
      */
     bool isOr() const override;
 
+    /**
+     * @brief Get the dispatch hint, if the builder set one.
+     *
+     * @return const std::optional<DispatchHint>&
+     */
+    const std::optional<DispatchHint>& dispatchHint() const;
+
+    /**
+     * @brief Set the dispatch hint. Build-time only, the hint is read-only once
+     * the expression is shared.
+     *
+     * @param hint the hint to set
+     * @throw std::runtime_error if the hint does not cover its run exactly or
+     * references operands outside it
+     */
+    void setDispatchHint(DispatchHint hint);
+
+    /**
+     * @brief Check whether the operands are pinned as mutually exclusive.
+     *
+     * @return true if at most one operand can succeed on any event
+     */
+    bool isMutuallyExclusive() const;
+
+    /**
+     * @brief Pin the operands as mutually exclusive: at most one can succeed on
+     * any event, so a backend may evaluate them in any order. Build-time only.
+     */
+    void setMutuallyExclusive();
+
 protected:
     /**
      * @brief Construct a new Or object
@@ -441,6 +492,10 @@ protected:
      * @param operands operands of the operation
      */
     Or(std::string name, std::vector<std::shared_ptr<Formula>> operands);
+
+private:
+    std::optional<DispatchHint> m_dispatchHint; ///< Dispatch hint, set by the builder
+    bool m_mutuallyExclusive {false};           ///< Mutual exclusivity pin, set by the builder
 };
 
 class Chain : public Operation
@@ -79,6 +79,142 @@ private:
 public:
     // TODO: Change to private
     std::unordered_map<K, std::vector<K>> m_edges;
+
+    /**
+     * @brief Read-only compact view of a graph, with dense integer node indexes and CSR
+     * (compressed sparse row) adjacency storage.
+     *
+     * Node ids are mapped once to dense indexes, so traversals become array walks instead
+     * of repeated hash lookups of the full keys. The view holds pointers into the source
+     * graph's node values: it is valid only while the source graph outlives it unmodified.
+     */
+    class Compact
+    {
+    public:
+        /**
+         * @brief Range of children indexes of a node, iterable with range-for.
+         */
+        struct ChildrenRange
+        {
+            const size_t* m_begin; ///< First child index.
+            const size_t* m_end;   ///< Past-the-end child index.
+
+            const size_t* begin() const { return m_begin; }
+            const size_t* end() const { return m_end; }
+            bool empty() const { return m_begin == m_end; }
+        };
+
+        /**
+         * @brief Build the compact view of a graph.
+         *
+         * @param graph Source graph. Must have its root node set.
+         * @throws std::runtime_error if the graph is empty or an edge points to a missing node.
+         */
+        explicit Compact(const Graph& graph)
+        {
+            if (!graph.hasNode(graph.rootId()))
+            {
+                throw std::runtime_error("Engine base graph: Cannot compact a graph without a root node.");
+            }
+
+            // Map every node id to a dense index
+            m_ids.reserve(graph.nodes().size());
+            m_values.reserve(graph.nodes().size());
+            for (const auto& [id, value] : graph.nodes())
+            {
+                m_index.emplace(id, m_ids.size());
+                m_ids.push_back(id);
+                m_values.push_back(&value);
+            }
+            m_root = m_index.at(graph.rootId());
+
+            // CSR adjacency: per-node children counts, then prefix offsets, then targets
+            m_offsets.resize(m_ids.size() + 1, 0);
+            for (size_t node = 0; node < m_ids.size(); ++node)
+            {
+                const auto it = graph.edges().find(m_ids[node]);
+                m_offsets[node + 1] = m_offsets[node] + ((it != graph.edges().end()) ? it->second.size() : 0);
+            }
+
+            m_targets.reserve(m_offsets.back());
+            for (size_t node = 0; node < m_ids.size(); ++node)
+            {
+                const auto it = graph.edges().find(m_ids[node]);
+                if (it == graph.edges().end())
+                {
+                    continue;
+                }
+
+                for (const auto& child : it->second)
+                {
+                    const auto childIt = m_index.find(child);
+                    if (childIt == m_index.end())
+                    {
+                        throw std::runtime_error(
+                            fmt::format("Engine base graph: Node \"{}\" does not exist.", child));
+                    }
+                    m_targets.push_back(childIt->second);
+                }
+            }
+        }
+
+        /**
+         * @brief Number of nodes in the view.
+         */
+        size_t size() const { return m_ids.size(); }
+
+        /**
+         * @brief Dense index of the root node.
+         */
+        size_t rootIndex() const { return m_root; }
+
+        /**
+         * @brief Dense index of a node id.
+         *
+         * @throws std::runtime_error if the node does not exist.
+         */
+        size_t index(const K& id) const
+        {
+            const auto it = m_index.find(id);
+            if (it == m_index.end())
+            {
+                throw std::runtime_error(fmt::format("Engine base graph: Node \"{}\" does not exist.", id));
+            }
+            return it->second;
+        }
+
+        /**
+         * @brief Id of the node at a dense index.
+         */
+        const K& id(size_t index) const { return m_ids[index]; }
+
+        /**
+         * @brief Value of the node at a dense index.
+         */
+        const T& value(size_t index) const { return *m_values[index]; }
+
+        /**
+         * @brief Children indexes of the node at a dense index.
+         */
+        ChildrenRange children(size_t index) const
+        {
+            return {m_targets.data() + m_offsets[index], m_targets.data() + m_offsets[index + 1]};
+        }
+
+        /**
+         * @brief Check if the node at a dense index has children.
+         */
+        bool hasChildren(size_t index) const { return m_offsets[index] != m_offsets[index + 1]; }
+
+    private:
+        std::vector<K> m_ids;                 ///< Node id per dense index.
+        std::vector<const T*> m_values;       ///< Node value per dense index.
+        std::unordered_map<K, size_t> m_index; ///< Node id to dense index.
+        std::vector<size_t> m_offsets;        ///< CSR offsets, one past-the-end per node.
+        std::vector<size_t> m_targets;        ///< CSR children indexes.
+        size_t m_root;                        ///< Dense index of the root node.
+    };
+
     /**
      * @brief Construct a new Graph empty object
      *
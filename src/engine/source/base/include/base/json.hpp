@@ -5,6 +5,7 @@
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -26,6 +27,110 @@ namespace json
 constexpr bool RECURSIVE {true};
 constexpr bool NOT_RECURSIVE {false};
 
+/**
+ * @brief Recyclable allocation arena backing one event or batch of events.
+ *
+ * Wraps a rapidjson::MemoryPoolAllocator over a pre-allocated slab so every
+ * value of a document parsed against it is carved from the same contiguous
+ * buffer instead of going through the CRT allocator. Once the owning event(s)
+ * have been acked the arena can be recycled with a single call, releasing any
+ * overflow chunks while keeping the initial slab for reuse.
+ *
+ * The arena is not thread-safe; it is meant to be owned by a single worker
+ * and shared only between the documents it backs.
+ */
+class Arena
+{
+public:
+    static constexpr size_t DEFAULT_SLAB_SIZE {64 * 1024};
+
+    /**
+     * @brief Construct an arena with a slab of the given size.
+     *
+     * @param slabSize Size in bytes of the initial slab. Allocations beyond it
+     * fall back to heap-allocated chunks released on recycle().
+     */
+    explicit Arena(size_t slabSize = DEFAULT_SLAB_SIZE)
+        : m_slab(slabSize)
+        , m_allocator(m_slab.data(), m_slab.size())
+    {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Get the underlying rapidjson allocator.
+     */
+    rapidjson::MemoryPoolAllocator<>& allocator() { return m_allocator; }
+
+    /**
+     * @brief Release every chunk allocated beyond the initial slab and reset
+     * the slab cursor, making the full capacity available again.
+     *
+     * Must only be called once no document backed by this arena is alive.
+     */
+    void recycle() { m_allocator.Clear(); }
+
+    /**
+     * @brief Total bytes currently reserved by the arena (slab + overflow).
+     */
+    size_t capacity() const { return m_allocator.Capacity(); }
+
+    /**
+     * @brief Bytes currently in use by documents backed by this arena.
+     */
+    size_t size() const { return m_allocator.Size(); }
+
+private:
+    std::vector<char> m_slab;
+    rapidjson::MemoryPoolAllocator<> m_allocator;
+};
+
+/**
+ * @brief Pre-parsed JSON pointer path.
+ *
+ * Parsing a pointer path tokenizes it and validates every segment; doing that
+ * on each access dominates field lookups on the hot path. A CompiledPath is
+ * tokenized once (typically at policy build time) and can then be evaluated
+ * against any document without re-parsing.
+ */
+class CompiledPath
+{
+public:
+    CompiledPath() = default;
+
+    /**
+     * @brief Compile the given pointer path.
+     *
+     * @param pointerPath The pointer path to compile.
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    explicit CompiledPath(std::string_view pointerPath)
+        : m_path {pointerPath}
+        , m_pointer {m_path.data(), m_path.size()}
+    {
+        if (!m_pointer.IsValid())
+        {
+            throw std::runtime_error(std::string {"Invalid pointer path '"} + m_path + "'");
+        }
+    }
+
+    /**
+     * @brief Get the pre-parsed rapidjson pointer.
+     */
+    const rapidjson::Pointer& ptr() const { return m_pointer; }
+
+    /**
+     * @brief Get the original pointer path string.
+     */
+    const std::string& str() const { return m_path; }
+
+private:
+    std::string m_path;
+    rapidjson::Pointer m_pointer;
+};
+
 class Json
 {
 public:
@@ -102,6 +207,9 @@ public:
     }
 
 private:
+    // Declared before m_document so an arena-backed document never outlives
+    // the allocator it was parsed against.
+    std::shared_ptr<Arena> m_arena;
     rapidjson::Document m_document;
 
     /**
@@ -120,6 +228,18 @@ private:
      */
     Json(const rapidjson::GenericObject<true, rapidjson::Value>& object);
 
+    /**
+     * @brief Construct a new Json object whose document allocates from a
+     * borrowed allocator.
+     *
+     * Used by adoptJson() so a detached subtree keeps living on its source
+     * document's pool instead of being deep-copied out of it.
+     *
+     * @param allocator The allocator to borrow. Not owned.
+     * @param arena The arena retaining the allocator, if any.
+     */
+    Json(rapidjson::Document::AllocatorType* allocator, std::shared_ptr<Arena> arena);
+
     /**
      * @brief Get Json type from internal rapidjason type.
      *
@@ -145,6 +265,16 @@ private:
 
     void merge(const bool isRecursive, const rapidjson::Value& source, std::string_view path);
 
+    /**
+     * @brief Merge source into the value at path, adopting the source nodes.
+     *
+     * Source must be allocated on this document's allocator: every merged node is
+     * moved instead of deep-copied, and the traversal is iterative (a work list of
+     * same-type node pairs) rather than recursive. Moved-out source nodes are left
+     * null, so an in-document source can be erased afterwards.
+     */
+    void mergeAdopt(const bool isRecursive, rapidjson::Value& source, std::string_view path);
+
 public:
     /**
      * @brief Construct a new Json empty json object.
@@ -167,6 +297,43 @@ public:
      */
     explicit Json(const char* json);
 
+    /**
+     * @brief Construct a new Json object from a borrowed json string view.
+     *
+     * The view does not need to be null terminated, so a document can be parsed
+     * directly from a slice of a larger buffer without copying it out first.
+     *
+     * @param json The json string view to parse.
+     */
+    explicit Json(std::string_view json);
+
+    /**
+     * @brief Construct a new Json object from a json string, parsing it into
+     * the given arena instead of the default CRT allocator.
+     *
+     * The arena is retained by the Json object (and by any Json it is moved
+     * into) so the backing slab cannot be recycled while the document is
+     * alive. Several events of a batch may share the same arena.
+     *
+     * @param json The json string to parse.
+     * @param arena The arena backing the parsed document.
+     */
+    Json(const char* json, std::shared_ptr<Arena> arena);
+
+    /**
+     * @brief Re-parse this document in place from a json string view.
+     *
+     * Recycles the backing arena (or the document's own allocator when there is
+     * none) before parsing, so a pooled document can be reused for a fresh
+     * event without growing its memory on every cycle.
+     *
+     * Must only be called when no other document shares the arena.
+     *
+     * @param json The json string view to parse.
+     * @throws std::runtime_error If the json string could not be parsed.
+     */
+    void reparse(std::string_view json);
+
     /**
      * @brief Copy constructs a new Json object.
      * Value is copied.
@@ -300,6 +467,84 @@ public:
      */
     std::optional<std::string> getString(std::string_view path = "") const;
 
+    /**
+     * @brief Get a view over the string field without copying it.
+     *
+     * The returned view points into the document's own storage and is
+     * invalidated by any mutation, move or destruction of this Json. Intended
+     * for hot-path reads where the value is consumed before the event is
+     * touched again.
+     *
+     * @param path The pointer path to the field.
+     * @return std::optional<std::string_view> View over the value, or nothing
+     * if the path is not found or is not a string.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<std::string_view> getStringView(std::string_view path = "") const;
+
+    /**
+     * @brief Get a view over the raw bytes of the string field.
+     *
+     * Same lifetime rules as getStringView(), but the length comes from the
+     * document so embedded NUL bytes are preserved.
+     *
+     * @param path The pointer path to the field.
+     * @return std::optional<std::string_view> View over the bytes, or nothing
+     * if the path is not found or is not a string.
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<std::string_view> getBytesView(std::string_view path = "") const;
+
+    /************************************************************************************/
+    // Compiled path accessors: same semantics as the string-path overloads but
+    // evaluate a pre-tokenized pointer, skipping per-access path parsing.
+    /************************************************************************************/
+
+    /**
+     * @brief Check if the Json contains a field at the compiled path.
+     */
+    bool exists(const CompiledPath& path) const;
+
+    /**
+     * @brief Get the string field at the compiled path, copying the value.
+     */
+    std::optional<std::string> getString(const CompiledPath& path) const;
+
+    /**
+     * @brief Get a view over the string field at the compiled path.
+     * Same lifetime rules as getStringView(std::string_view).
+     */
+    std::optional<std::string_view> getStringView(const CompiledPath& path) const;
+
+    /**
+     * @brief Get the value of the int or int64 field at the compiled path as int64.
+     */
+    std::optional<int64_t> getIntAsInt64(const CompiledPath& path) const;
+
+    /**
+     * @brief Get a copy of the Json object at the compiled path.
+     */
+    std::optional<Json> getJson(const CompiledPath& path) const;
+
+    /**
+     * @brief Set the value at the compiled path, creating parents as needed.
+     */
+    void set(const CompiledPath& path, const Json& value);
+
+    /**
+     * @brief Set the int64 value at the compiled path, creating parents as needed.
+     */
+    void setInt64(int64_t value, const CompiledPath& path);
+
+    /**
+     * @brief Erase the field at the compiled path.
+     *
+     * @return true if the field was erased, false if it did not exist.
+     */
+    bool erase(const CompiledPath& path);
+
     /**
      * @brief get the value of the int field.
      * Overwrites previous value. If reference field is not found, sets base field to
@@ -434,6 +679,17 @@ public:
      */
     std::string str() const;
 
+    /**
+     * @brief Serialize the Json into a caller-provided buffer.
+     *
+     * The buffer is cleared but keeps its capacity, so a reused (per-thread
+     * pooled) buffer serializes without allocating once it has grown to the
+     * working event size.
+     *
+     * @param out Buffer receiving the Json string.
+     */
+    void str(std::string& out) const;
+
     /**
      * @brief Get Json string from an object.
      *
@@ -452,6 +708,35 @@ public:
      */
     std::optional<Json> getJson(std::string_view path = "") const;
 
+    /**
+     * @brief Detach the Json subtree at the path and return it without copying.
+     *
+     * The subtree is moved out of this document and erased from it. The returned
+     * Json keeps allocating from this document's allocator, so it must not
+     * outlive this Json unless both are backed by the same arena (the arena is
+     * retained). Adopting the root path leaves this document null.
+     *
+     * @param path The path to the subtree, default value is root object ("").
+     * @return std::optional<Json> The detached subtree, std::nullopt if the path
+     * is not found.
+     * @throw std::runtime_error If path is invalid.
+     */
+    std::optional<Json> adoptJson(std::string_view path = "");
+
+    /**
+     * @brief Set the value at the path, moving the given Json into this document.
+     *
+     * When both documents share one allocator (e.g. the value was adopted from
+     * this document with adoptJson(), or both live on the same arena) the subtree
+     * is relinked without copying and the moved-from value is left null;
+     * otherwise it is deep-copied as set() would.
+     *
+     * @param path The path to set, creating parents as needed.
+     * @param value The Json to move in.
+     * @throw std::runtime_error If path is invalid.
+     */
+    void setJson(std::string_view path, Json&& value);
+
     friend std::ostream& operator<<(std::ostream& os, const Json& json);
 
     /************************************************************************************/
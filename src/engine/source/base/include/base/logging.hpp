@@ -64,6 +64,18 @@ constexpr auto DEFAULT_LOG_THREADS_QUEUE_SIZE {8192};
  */
 constexpr auto DEFAULT_LOG_FLUSH_INTERVAL {1};
 
+/**
+ * @brief Default duplicate suppression window, in seconds.
+ * 0 disables the per-call-site duplicate suppression.
+ */
+constexpr auto DEFAULT_LOG_REPEATED_WINDOW {0};
+
+/**
+ * @brief Default number of messages a single call site may emit per suppression window
+ * before the remaining ones are suppressed and accounted.
+ */
+constexpr auto DEFAULT_LOG_REPEATED_BURST {5};
+
 /**
  * @brief Enum class defining logging levels.
  *
@@ -175,6 +187,10 @@ struct LoggingConfig
     const uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};     ///< Number of dedicated threads.
     const uint32_t queueSize {DEFAULT_LOG_THREADS_QUEUE_SIZE}; ///< Size of the log queue for dedicated threads.
     bool truncate {false}; ///< If true, the log file will be deleted for each start of the engine.
+    const uint32_t repeatedWindowSec {
+        DEFAULT_LOG_REPEATED_WINDOW}; ///< Duplicate suppression window per call site, in seconds. 0 disables it.
+    const uint32_t repeatedBurst {
+        DEFAULT_LOG_REPEATED_BURST}; ///< Messages allowed per call site and window before suppressing.
 };
 
 /**
@@ -207,6 +223,24 @@ void start(const LoggingConfig& cfg);
  */
 void stop();
 
+/**
+ * @brief Number of messages dropped by the async queue since start.
+ *
+ * In async mode (dedicatedThreads > 0) the queue overwrites the oldest pending message
+ * when full instead of blocking the caller; this counter accounts those overwrites.
+ * Always 0 in synchronous mode.
+ *
+ * @return The number of dropped messages.
+ */
+uint64_t droppedLogs();
+
+/**
+ * @brief Number of messages suppressed by the per-call-site duplicate filter since start.
+ *
+ * @return The number of suppressed messages.
+ */
+uint64_t suppressedLogs();
+
 /**
  * @brief Initializes the logger for testing purposes.
  *
@@ -129,6 +129,21 @@ public:
         }
     }
 
+    /**
+     * @brief Removes a single key-value pair from the cache.
+     *
+     * Does nothing if the key is not cached.
+     *
+     * @param key The key to be removed.
+     */
+    void removeKey(const KeyType& key)
+    {
+        if (m_map.erase(key) > 0)
+        {
+            m_list.remove(key);
+        }
+    }
+
     /**
      * @brief Clears the cache by removing all key-value pairs.
      */
@@ -1,10 +1,14 @@
 #ifndef _BASE_NAME_HPP
 #define _BASE_NAME_HPP
 
+#include <cstdint>
 #include <initializer_list>
 #include <iostream>
+#include <mutex>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <fmt/core.h>
@@ -26,6 +30,10 @@ namespace base
  * currently '/'
  *
  * @note The name is not a path, it's a name.
+ *
+ * @note Names are interned: the first construction of a given name assigns it a
+ * dense process-wide id, and equality and hashing compare that id instead of the
+ * string parts, so name-keyed maps resolve without hashing strings.
  */
 class Name
 {
@@ -36,6 +44,35 @@ public:
 
 private:
     std::vector<std::string> m_parts;
+    std::uint32_t m_id {0}; ///< Interned identity; 0 is reserved for the empty name.
+
+    /**
+     * @brief Interns a full name, returning its dense id.
+     *
+     * The first construction of a given name registers it and every later
+     * construction gets the same id back, so equality and hashing work on the
+     * integer identity instead of re-walking the string parts. The registry is
+     * read-mostly: after warm-up every lookup takes the shared lock only.
+     *
+     * @param fullName Full name string.
+     * @return std::uint32_t Dense id of the name, stable for the process lifetime.
+     */
+    static std::uint32_t intern(const std::string& fullName)
+    {
+        static std::shared_mutex mutex;
+        static std::unordered_map<std::string, std::uint32_t> registry;
+
+        {
+            std::shared_lock lock {mutex};
+            if (const auto it = registry.find(fullName); it != registry.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::unique_lock lock {mutex};
+        return registry.emplace(fullName, static_cast<std::uint32_t>(registry.size() + 1)).first->second;
+    }
 
     void assertSize(size_t size) const
     {
@@ -57,8 +94,18 @@ private:
         }
     }
 
-    void copy(const Name& other) { m_parts = other.m_parts; }
-    void copyMove(Name&& other) noexcept { m_parts = std::move(other.m_parts); }
+    void copy(const Name& other)
+    {
+        m_parts = other.m_parts;
+        m_id = other.m_id;
+    }
+
+    void copyMove(Name&& other) noexcept
+    {
+        m_parts = std::move(other.m_parts);
+        m_id = other.m_id;
+        other.m_id = 0; // The moved-from name compares as the empty name.
+    }
 
 public:
     Name() = default;
@@ -74,6 +121,7 @@ public:
     {
         assertSize(parts.size());
         m_parts = parts;
+        m_id = intern(toStr());
     }
 
     /**
@@ -86,6 +134,7 @@ public:
     {
         m_parts = std::move(parts);
         assertSize(m_parts.size());
+        m_id = intern(toStr());
     }
 
     /**
@@ -98,6 +147,10 @@ public:
     {
         m_parts = base::utils::string::split(fullName, SEPARATOR_C);
         assertSize(m_parts.size());
+        // Intern the canonical join of the parts: split() may normalize the
+        // input (e.g. collapse repeated separators), and two names with equal
+        // parts must always share the same id.
+        m_id = intern(toStr());
     }
 
     /**
@@ -162,7 +215,7 @@ public:
      * @return true
      * @return false
      */
-    friend bool operator==(const Name& rh, const Name& lh) { return rh.m_parts == lh.m_parts; }
+    friend bool operator==(const Name& rh, const Name& lh) { return rh.m_id == lh.m_id; }
 
     /**
      * @brief Inequality comparison operator
@@ -252,26 +305,27 @@ public:
      * @return const std::vector<std::string>&
      */
     const std::vector<std::string>& parts() const { return m_parts; }
+
+    /**
+     * @brief Get the interned identity of the name.
+     *
+     * Names with the same parts share the same id within a process, so the id can
+     * key maps and drive comparisons without touching the string parts.
+     *
+     * @return std::uint32_t Dense id, 0 for the empty name.
+     */
+    std::uint32_t id() const { return m_id; }
 };
 
 } // namespace base
 
-/* lazy std::hash specialization for base::Name */
+/* std::hash specialization for base::Name, hashing the interned id */
 namespace std
 {
 template<>
 struct hash<base::Name>
 {
-    size_t operator()(const base::Name& name) const
-    {
-        std::hash<std::string> hasher;
-        size_t hashValue = 0;
-        for (const auto& part : name.parts())
-        {
-            hashValue ^= hasher(part);
-        }
-        return hashValue;
-    }
+    size_t operator()(const base::Name& name) const { return std::hash<std::uint32_t> {}(name.id()); }
 };
 } // namespace std
 
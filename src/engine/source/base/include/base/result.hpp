@@ -2,16 +2,31 @@
 #define _RESULT_H
 
 #include <string>
+#include <string_view>
+#include <utility>
 
 namespace base::result
 {
 
+/**
+ * @brief Outcome of an operation over an event, carrying the payload, the success
+ * flag and, when tracing is compiled in, the trace emitted by the operation.
+ *
+ * When the build disables ENGINE_RESULT_TRACE the trace string is compiled out:
+ * results hold only the payload and the flag, trace() yields an empty string and
+ * setTrace()/popTrace() become no-ops, so the per-operation string churn of the
+ * hot path disappears in builds that never subscribe to traces.
+ *
+ * @tparam Event Payload type.
+ */
 template<typename Event>
 class Result
 {
 private:
     Event m_payload;
+#ifdef ENGINE_RESULT_TRACE
     std::string m_trace;
+#endif
     bool m_success;
 
 public:
@@ -28,12 +43,20 @@ public:
      * @param trace Tracer object.
      * @param success Status of the event.
      */
+#ifdef ENGINE_RESULT_TRACE
     Result(Event payload, std::string trace, bool success)
-        : m_payload {payload}
-        , m_trace {trace}
+        : m_payload {std::move(payload)}
+        , m_trace {std::move(trace)}
         , m_success {success}
     {
     }
+#else
+    Result(Event payload, std::string_view /*trace*/, bool success)
+        : m_payload {std::move(payload)}
+        , m_success {success}
+    {
+    }
+#endif
 
     /**
      * @brief Copy constructs a new Result object.
@@ -42,7 +65,9 @@ public:
      */
     Result(const Result& other)
         : m_payload {other.m_payload}
+#ifdef ENGINE_RESULT_TRACE
         , m_trace {other.m_trace}
+#endif
         , m_success {other.m_success}
     {
     }
@@ -54,7 +79,9 @@ public:
      */
     Result(Result&& other)
         : m_payload {std::move(other.m_payload)}
-        , m_trace {other.m_trace}
+#ifdef ENGINE_RESULT_TRACE
+        , m_trace {std::move(other.m_trace)}
+#endif
         , m_success {other.m_success}
     {
     }
@@ -73,7 +100,9 @@ public:
     Result& operator=(const Result& other)
     {
         m_payload = other.m_payload;
+#ifdef ENGINE_RESULT_TRACE
         m_trace = other.m_trace;
+#endif
         m_success = other.m_success;
         return *this;
     }
@@ -87,7 +116,9 @@ public:
     Result& operator=(Result&& other)
     {
         m_payload = std::move(other.m_payload);
-        m_trace = other.m_trace;
+#ifdef ENGINE_RESULT_TRACE
+        m_trace = std::move(other.m_trace);
+#endif
         m_success = other.m_success;
         return *this;
     }
@@ -126,16 +157,31 @@ public:
     /**
      * @brief Returns the event trace.
      *
-     * @return std::string the event trace.
+     * @return const std::string& the event trace.
      */
-    std::string trace() const { return m_trace; }
+    const std::string& trace() const
+    {
+#ifdef ENGINE_RESULT_TRACE
+        return m_trace;
+#else
+        static const std::string emptyTrace;
+        return emptyTrace;
+#endif
+    }
 
     /**
-     * @brief Returns the event trace.
+     * @brief Returns the event trace, leaving the result without trace.
      *
      * @return std::string the event trace.
      */
-    std::string popTrace() const { return std::move(m_trace); }
+    std::string popTrace()
+    {
+#ifdef ENGINE_RESULT_TRACE
+        return std::move(m_trace);
+#else
+        return {};
+#endif
+    }
 
     /**
      * @brief Get the payload object.
@@ -156,7 +202,11 @@ public:
      *
      * @param trace the trace object.
      */
-    void setTrace(std::string trace) { m_trace = trace; }
+#ifdef ENGINE_RESULT_TRACE
+    void setTrace(std::string trace) { m_trace = std::move(trace); }
+#else
+    void setTrace(std::string_view /*trace*/) {}
+#endif
 
     /**
      * @brief Set the payload object.
@@ -176,11 +226,19 @@ public:
  * @param trace trace to be filled
  * @return Result<Event> Result of the event with all the complete information.
  */
+#ifdef ENGINE_RESULT_TRACE
 template<typename Event>
 Result<Event> makeSuccess(Event payload, std::string trace = "")
 {
-    return Result<Event> {payload, trace, true};
+    return Result<Event> {std::move(payload), std::move(trace), true};
+}
+#else
+template<typename Event>
+Result<Event> makeSuccess(Event payload, std::string_view trace = "")
+{
+    return Result<Event> {std::move(payload), trace, true};
 }
+#endif
 
 /**
  * @brief Returns the result of the event with all the information that it has been
@@ -192,11 +250,19 @@ Result<Event> makeSuccess(Event payload, std::string trace = "")
  * @param trace trace to be filled
  * @return Result<Event> Result of the event with all the complete information.
  */
+#ifdef ENGINE_RESULT_TRACE
 template<typename Event>
 Result<Event> makeFailure(Event payload, std::string trace = "")
 {
-    return Result<Event> {payload, trace, false};
+    return Result<Event> {std::move(payload), std::move(trace), false};
+}
+#else
+template<typename Event>
+Result<Event> makeFailure(Event payload, std::string_view trace = "")
+{
+    return Result<Event> {std::move(payload), trace, false};
 }
+#endif
 
 } // namespace base::result
 
@@ -0,0 +1,179 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SHARDED_LRUCACHE_HPP
+#define _SHARDED_LRUCACHE_HPP
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+#include <base/lruCache.hpp>
+
+/**
+ * @brief A thread-safe Least Recently Used (LRU) cache sharded into independent segments.
+ *
+ * Each key is assigned to one of ShardCount segments by hash, and every segment is an
+ * independent LRUCache guarded by its own mutex. Concurrent accesses to different segments
+ * never contend, so a cache shared across several workers does not become a serialization
+ * point, unlike a single LRUCache guarded by one lock. Eviction is per segment: the
+ * capacity is split evenly between segments, and each one evicts its own least recently
+ * used entry, which approximates the global LRU order.
+ *
+ * @tparam KeyType The type of the keys used for caching. Must be hashable with std::hash.
+ * @tparam ValueType The type of the values associated with the keys.
+ * @tparam ShardCount Number of independent segments. Should be at least the expected
+ * number of concurrent workers; must be greater than zero.
+ */
+template<typename KeyType, typename ValueType, size_t ShardCount = 8>
+class ShardedLRUCache final
+{
+public:
+    /**
+     * @brief Constructor to initialize a ShardedLRUCache with a specified total capacity.
+     *
+     * @param capacity The maximum number of key-value pairs the cache can hold, split
+     * evenly between the segments (at least one entry per segment).
+     */
+    explicit ShardedLRUCache(const size_t capacity)
+        : m_shards {makeShards(capacity, std::make_index_sequence<ShardCount>())}
+    {
+        static_assert(ShardCount > 0, "ShardedLRUCache requires at least one shard");
+    }
+
+    /**
+     * @brief Inserts a key-value pair into the segment that owns the key.
+     *
+     * @param key The key to be inserted.
+     * @param value The value associated with the key.
+     */
+    void insertKey(const KeyType& key, const ValueType& value)
+    {
+        auto& shard = shardFor(key);
+        std::lock_guard lock(shard.mutex);
+        shard.cache.insertKey(key, value);
+    }
+
+    /**
+     * @brief Retrieves the value associated with a key, refreshing its LRU position.
+     *
+     * @param key The key for which to retrieve the value.
+     * @return The value associated with the key, or std::nullopt if the key is not found.
+     */
+    std::optional<ValueType> getValue(const KeyType& key)
+    {
+        auto& shard = shardFor(key);
+        std::lock_guard lock(shard.mutex);
+        return shard.cache.getValue(key);
+    }
+
+    /**
+     * @brief Checks if a key exists in the cache, without refreshing its LRU position.
+     *
+     * @param key The key to be checked.
+     * @return true if the key exists in the cache, false otherwise.
+     */
+    bool isHit(const KeyType& key)
+    {
+        auto& shard = shardFor(key);
+        std::lock_guard lock(shard.mutex);
+        return shard.cache.isHit(key);
+    }
+
+    /**
+     * @brief Iterates over the cache data and applies a function to each key-value pair.
+     *
+     * Segments are visited one at a time under their own lock, so the iteration is not a
+     * consistent snapshot of the whole cache. The iteration stops if the handler returns
+     * false.
+     *
+     * @tparam Handler The type of the handler function. It should be callable with (const KeyType&, const ValueType&).
+     * @param handler The function to be applied to each key-value pair. It should return a boolean value.
+     *                If the handler returns false, the iteration stops.
+     */
+    template<typename Handler>
+    void forEach(Handler&& handler)
+    {
+        for (auto& shard : m_shards)
+        {
+            auto keepGoing = true;
+            std::lock_guard lock(shard.mutex);
+            shard.cache.forEach(
+                [&handler, &keepGoing](const KeyType& key, const ValueType& value)
+                {
+                    keepGoing = handler(key, value);
+                    return keepGoing;
+                });
+
+            if (!keepGoing)
+            {
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Clears the cache by removing all key-value pairs from every segment.
+     */
+    void clear() noexcept
+    {
+        for (auto& shard : m_shards)
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.cache.clear();
+        }
+    }
+
+private:
+    /**
+     * @brief An independent cache segment with its own lock.
+     */
+    struct Shard
+    {
+        /**
+         * @brief Constructor to initialize a segment with its share of the total capacity.
+         *
+         * @param capacity The maximum number of key-value pairs the segment can hold.
+         */
+        explicit Shard(const size_t capacity)
+            : cache(capacity)
+        {
+        }
+
+        std::mutex mutex;                    ///< Serializes access to the segment.
+        LRUCache<KeyType, ValueType> cache;  ///< The segment storage, in LRU order.
+    };
+
+    /**
+     * @brief Builds the segment array, giving each segment its share of the capacity.
+     *
+     * @param capacity The total cache capacity.
+     * @return std::array<Shard, ShardCount> The initialized segments.
+     */
+    template<size_t... Index>
+    static std::array<Shard, ShardCount> makeShards(const size_t capacity, std::index_sequence<Index...>)
+    {
+        const auto shardCapacity = std::max<size_t>(1, (capacity + ShardCount - 1) / ShardCount);
+        return {((void)Index, Shard {shardCapacity})...};
+    }
+
+    /**
+     * @brief Returns the segment that owns a key.
+     *
+     * @param key The key to be mapped to a segment.
+     * @return Shard& The owning segment.
+     */
+    Shard& shardFor(const KeyType& key) { return m_shards[std::hash<KeyType> {}(key) % ShardCount]; }
+
+    std::array<Shard, ShardCount> m_shards; ///< The independent cache segments.
+};
+
+#endif // _SHARDED_LRUCACHE_HPP
@@ -0,0 +1,117 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BLOOM_FILTER_HPP
+#define _BLOOM_FILTER_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace base::utils::bloom
+{
+
+/**
+ * @brief Space-efficient probabilistic membership filter.
+ *
+ * A Bloom filter answers "definitely not present" or "possibly present" for a set of
+ * keys using a fixed bit array and k hash probes per key, with no false negatives.
+ * It is intended as a pre-screen in front of expensive lookups (disk seeks, database
+ * reads): a negative answer skips the lookup entirely, a positive one falls through
+ * to it.
+ *
+ * The filter is not thread-safe while being populated; once built, concurrent
+ * mayContain() calls are safe.
+ */
+class BloomFilter final
+{
+private:
+    std::vector<uint64_t> m_bits;
+    std::size_t m_bitCount {0};
+    std::size_t m_hashCount {0};
+
+    /**
+     * @brief FNV-1a 64-bit hash with a configurable offset basis.
+     *
+     * Two different bases yield the pair of independent hashes used for double
+     * hashing, so each key only walks its bytes twice regardless of k.
+     */
+    static uint64_t fnv1a(std::string_view key, uint64_t basis)
+    {
+        for (const auto byte : key)
+        {
+            basis ^= static_cast<uint8_t>(byte);
+            basis *= 0x100000001B3ULL;
+        }
+        return basis;
+    }
+
+public:
+    /**
+     * @brief Builds a filter sized for the expected number of keys.
+     *
+     * @param expectedElements Number of distinct keys that will be inserted.
+     * @param bitsPerElement Bits budgeted per key; the default of 10 yields a false
+     * positive rate of roughly 1%.
+     */
+    explicit BloomFilter(std::size_t expectedElements, std::size_t bitsPerElement = 10)
+    {
+        if (expectedElements == 0)
+        {
+            expectedElements = 1;
+        }
+        m_bitCount = expectedElements * bitsPerElement;
+        m_bits.resize((m_bitCount + 63) / 64, 0);
+        // Optimal probe count for the chosen bit budget: k = bits/element * ln(2).
+        m_hashCount = std::max<std::size_t>(1, static_cast<std::size_t>(std::lround(bitsPerElement * 0.693)));
+    }
+
+    /**
+     * @brief Inserts a key into the filter.
+     *
+     * @param key Key to insert.
+     */
+    void insert(std::string_view key)
+    {
+        const auto h1 = fnv1a(key, 0xCBF29CE484222325ULL);
+        const auto h2 = fnv1a(key, 0x84222325CBF29CE4ULL) | 1ULL;
+        for (std::size_t i = 0; i < m_hashCount; ++i)
+        {
+            const auto bit = (h1 + i * h2) % m_bitCount;
+            m_bits[bit / 64] |= (1ULL << (bit % 64));
+        }
+    }
+
+    /**
+     * @brief Tests a key for membership.
+     *
+     * @param key Key to test.
+     * @return false if the key was definitely never inserted, true if it may have been.
+     */
+    bool mayContain(std::string_view key) const
+    {
+        const auto h1 = fnv1a(key, 0xCBF29CE484222325ULL);
+        const auto h2 = fnv1a(key, 0x84222325CBF29CE4ULL) | 1ULL;
+        for (std::size_t i = 0; i < m_hashCount; ++i)
+        {
+            const auto bit = (h1 + i * h2) % m_bitCount;
+            if ((m_bits[bit / 64] & (1ULL << (bit % 64))) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace base::utils::bloom
+
+#endif // _BLOOM_FILTER_HPP
@@ -0,0 +1,65 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 26, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ID_GENERATOR_HPP
+#define _ID_GENERATOR_HPP
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+namespace base::utils::id
+{
+
+/**
+ * @brief Generate a unique 32-hex-character document id.
+ *
+ * Each thread draws a 64-bit random prefix from the OS entropy pool on first use
+ * and then appends a local monotonically increasing 64-bit counter, so generating
+ * an id costs a couple of increments instead of an OS-backed UUID call per
+ * document. Ids are collision-safe across threads, processes and restarts as long
+ * as no single thread issues 2^64 ids under one prefix.
+ *
+ * @return std::string 32 lowercase hex characters: 16 of prefix, 16 of counter.
+ */
+static std::string generate()
+{
+    struct ThreadState
+    {
+        uint64_t prefix;
+        uint64_t counter;
+
+        ThreadState()
+            : counter {0}
+        {
+            std::random_device rd;
+            prefix = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+        }
+    };
+
+    thread_local ThreadState state;
+
+    constexpr auto HEX_DIGITS = "0123456789abcdef";
+    const uint64_t counter {state.counter++};
+
+    std::string id(32, '0');
+    for (int i = 0; i < 16; ++i)
+    {
+        id[15 - i] = HEX_DIGITS[(state.prefix >> (i * 4)) & 0xF];
+        id[31 - i] = HEX_DIGITS[(counter >> (i * 4)) & 0xF];
+    }
+
+    return id;
+}
+
+} // namespace base::utils::id
+
+#endif // _ID_GENERATOR_HPP
@@ -102,6 +102,16 @@ public:
 
     std::pair<std::string, ::rocksdb::Slice> operator*() { return {m_it->key().ToString(), m_it->value()}; }
 
+    /**
+     * @brief Zero-copy view of the current entry.
+     *
+     * Unlike operator*, the key is not copied into an owned string: both slices point
+     * into the block pinned by the iterator and stay valid until it advances.
+     *
+     * @return std::pair<::rocksdb::Slice, ::rocksdb::Slice> Current key-value pair.
+     */
+    std::pair<::rocksdb::Slice, ::rocksdb::Slice> current() const { return {m_it->key(), m_it->value()}; }
+
 private:
     std::shared_ptr<::rocksdb::Iterator> m_it;
     std::string_view m_prefix;
@@ -20,6 +20,7 @@
 #include <memory>
 #include <rocksdb/db.h>
 #include <rocksdb/filter_policy.h>
+#include <rocksdb/sst_file_writer.h>
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/transaction_db.h>
@@ -36,6 +37,9 @@ class IRocksDBWrapper
 public:
     virtual void put(const std::string& key, const ::rocksdb::Slice& value, const std::string& columnName) = 0;
     virtual void put(const std::string& key, const ::rocksdb::Slice& value) = 0;
+    virtual void putBatch(const std::vector<std::pair<std::string, ::rocksdb::Slice>>& keyValues,
+                          const std::string& columnName = "",
+                          const bool disableWAL = false) = 0;
     virtual void delete_(const std::string& key, const std::string& columnName) = 0; // NOLINT
     virtual void delete_(const std::string& key) = 0;                                // NOLINT
     virtual void commit() = 0;
@@ -175,6 +179,48 @@ public:
      */
     void put(const std::string& key, const ::rocksdb::Slice& value) override { put(key, value, ""); }
 
+    /**
+     * @brief Put multiple key-value pairs in the database with a single write.
+     *
+     * All the pairs are grouped into a ::rocksdb::WriteBatch, amortizing the write
+     * synchronization cost over the whole batch instead of paying it per key.
+     *
+     * @param keyValues Key-value pairs to put.
+     * @param columnName Column name where the puts will be performed. If empty, the default column will be used.
+     * @param disableWAL Skip the write-ahead log for this batch. Only safe for data that can be
+     * rebuilt after a crash, such as content re-downloadable from a feed.
+     *
+     * @note If a key already exists, the value will be overwritten.
+     */
+    void putBatch(const std::vector<std::pair<std::string, ::rocksdb::Slice>>& keyValues,
+                  const std::string& columnName = "",
+                  const bool disableWAL = false) override
+    {
+        if (keyValues.empty())
+        {
+            return;
+        }
+
+        const auto& columnHandle {getColumnFamilyBasedOnName(columnName)};
+        ::rocksdb::WriteBatch batch;
+        for (const auto& [key, value] : keyValues)
+        {
+            if (key.empty())
+            {
+                throw std::invalid_argument("Key is empty");
+            }
+            batch.Put(columnHandle.handle(), key, value);
+        }
+
+        ::rocksdb::WriteOptions writeOptions;
+        writeOptions.disableWAL = !m_enableWal || disableWAL;
+
+        if (const auto status {m_db->Write(writeOptions, &batch)}; !status.ok())
+        {
+            throw std::runtime_error("Error putting data: " + status.ToString());
+        }
+    }
+
     /**
      * @brief Get a value from the database.
      *
@@ -384,6 +430,84 @@ public:
         m_db->CompactRange(compactOptions, nullptr, nullptr);
     }
 
+    /**
+     * @brief Build an SST file from key-value pairs.
+     *
+     * The file is written offline, without touching the database, and can later be
+     * ingested atomically with ingestSSTFiles(). The pairs are sorted by key before
+     * writing, as the SST format requires.
+     *
+     * @param sstPath Path where the SST file will be created.
+     * @param keyValues Key-value pairs to write.
+     */
+    void createSSTFile(const std::string& sstPath, std::vector<std::pair<std::string, ::rocksdb::Slice>> keyValues)
+    {
+        if (keyValues.empty())
+        {
+            throw std::invalid_argument("No key-value pairs to write");
+        }
+
+        std::sort(keyValues.begin(),
+                  keyValues.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        const ::rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
+        ::rocksdb::SstFileWriter writer {::rocksdb::EnvOptions(), options};
+
+        if (const auto status {writer.Open(sstPath)}; !status.ok())
+        {
+            throw std::runtime_error("Failed to open SST file: " + status.ToString());
+        }
+
+        for (const auto& [key, value] : keyValues)
+        {
+            if (key.empty())
+            {
+                throw std::invalid_argument("Key is empty");
+            }
+
+            if (const auto status {writer.Put(key, value)}; !status.ok())
+            {
+                throw std::runtime_error("Failed to write SST file: " + status.ToString());
+            }
+        }
+
+        if (const auto status {writer.Finish()}; !status.ok())
+        {
+            throw std::runtime_error("Failed to finish SST file: " + status.ToString());
+        }
+    }
+
+    /**
+     * @brief Atomically ingest SST files into a column family.
+     *
+     * The files become visible in one step, replacing key-by-key rewrites and the
+     * compaction load they generate: ingested files land directly in the LSM tree.
+     *
+     * @param sstPaths Paths of the SST files to ingest.
+     * @param columnName Column name where the files will be ingested. If empty, the default column will be used.
+     * @param moveFiles Move the files into the database instead of copying them.
+     */
+    void ingestSSTFiles(const std::vector<std::string>& sstPaths,
+                        const std::string& columnName = "",
+                        const bool moveFiles = true)
+    {
+        if (sstPaths.empty())
+        {
+            throw std::invalid_argument("No SST files to ingest");
+        }
+
+        ::rocksdb::IngestExternalFileOptions ingestOptions;
+        ingestOptions.move_files = moveFiles;
+
+        if (const auto status {
+                m_db->IngestExternalFile(getColumnFamilyBasedOnName(columnName).handle(), sstPaths, ingestOptions)};
+            !status.ok())
+        {
+            throw std::runtime_error("Failed to ingest SST files: " + status.ToString());
+        }
+    }
+
     /**
      * @brief Initialize transaction.
      * @return RocksDBTransaction Transaction object.
@@ -744,6 +868,25 @@ public:
      */
     void put(const std::string& key, const ::rocksdb::Slice& value) override { put(key, value, ""); }
 
+    /**
+     * @brief Put multiple key-value pairs in the database as part of the transaction.
+     *
+     * @param keyValues Key-value pairs to put.
+     * @param columnName Column name where the puts will be performed. If empty, the default column will be used.
+     * @param disableWAL Ignored: the transaction already runs with the WAL disabled.
+     *
+     * @note If a key already exists, the value will be overwritten.
+     */
+    void putBatch(const std::vector<std::pair<std::string, ::rocksdb::Slice>>& keyValues,
+                  const std::string& columnName = "",
+                  [[maybe_unused]] const bool disableWAL = false) override
+    {
+        for (const auto& [key, value] : keyValues)
+        {
+            put(key, value, columnName);
+        }
+    }
+
     /**
      * @brief Delete a key-value pair from the database.
      *
@@ -0,0 +1,62 @@
+#ifndef _SCRATCH_BUFFER_H
+#define _SCRATCH_BUFFER_H
+
+#include <string>
+#include <vector>
+
+namespace base::utils::scratch
+{
+
+/**
+ * @brief RAII lease of a reusable per-thread string buffer.
+ *
+ * Hot paths that build a temporary string per event (parsers, helper
+ * transformations) pay a heap allocation on every call when they use a local
+ * std::string. A Buffer instead leases a string from a thread-local pool: the
+ * string arrives cleared but keeps the capacity it grew on previous events, so
+ * steady-state use allocates nothing.
+ *
+ * Leases nest safely (each Buffer holds its own string), so a parser and a
+ * helper active on the same thread do not clobber each other. The leased
+ * string must not outlive the Buffer; copy it (e.g. into the event) before
+ * the lease ends.
+ */
+class Buffer
+{
+private:
+    std::string m_str;
+
+    static std::vector<std::string>& pool()
+    {
+        thread_local std::vector<std::string> pool;
+        return pool;
+    }
+
+public:
+    Buffer()
+    {
+        auto& p = pool();
+        if (!p.empty())
+        {
+            m_str = std::move(p.back());
+            p.pop_back();
+            m_str.clear();
+        }
+    }
+
+    ~Buffer() { pool().emplace_back(std::move(m_str)); }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+    Buffer(Buffer&&) = delete;
+    Buffer& operator=(Buffer&&) = delete;
+
+    /**
+     * @brief Leased string, cleared on acquisition, capacity preserved across leases.
+     */
+    std::string& str() { return m_str; }
+};
+
+} // namespace base::utils::scratch
+
+#endif // _SCRATCH_BUFFER_H
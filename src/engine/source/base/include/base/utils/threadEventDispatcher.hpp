@@ -14,7 +14,12 @@
 
 #include <atomic>
 #include <iostream>
+#include <queue>
+#include <string_view>
 #include <thread>
+#include <vector>
+
+#include <concurrentqueue/blockingconcurrentqueue.h>
 
 #include <base/logging.hpp>
 
@@ -40,6 +45,65 @@ struct ThreadEventDispatcherParams
     const ThreadEventDispatcherType dispatcherType = ThreadEventDispatcherType::SINGLE_THREADED_ORDERED;
 };
 
+/**
+ * @brief Lock-free MPMC queue backend for the dispatcher.
+ *
+ * In-memory alternative to the RocksDB backed `TSafeQueue`, built on moodycamel's
+ * `BlockingConcurrentQueue`, for dispatchers where producers contend on the publish path and
+ * persistence across restarts is not required. Waits are timeout bounded so consumers can observe
+ * cancellation. Prefixes are not supported: this backend keeps a single unordered stream.
+ *
+ * @tparam T Queue element type.
+ */
+template<typename T>
+class LockFreeQueue
+{
+public:
+    void push(const T& value) { m_queue.enqueue(value); }
+
+    /**
+     * @brief Dequeues up to `elementsQuantity` elements, blocking until at least one is available
+     * or the wait times out.
+     *
+     * @param elementsQuantity Maximum amount of elements to pop.
+     * @return std::queue<T> Popped elements, empty on timeout or cancellation.
+     */
+    std::queue<T> getBulkAndPop(const uint64_t elementsQuantity)
+    {
+        std::vector<T> bulk(elementsQuantity);
+        std::size_t count {0};
+
+        if (!m_cancelled)
+        {
+            count = m_queue.wait_dequeue_bulk_timed(bulk.begin(), elementsQuantity, WAIT_DEQUEUE_TIMEOUT_USEC);
+        }
+
+        std::queue<T> data;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            data.push(std::move(bulk[i]));
+        }
+        return data;
+    }
+
+    size_t size() const { return m_queue.size_approx(); }
+
+    void cancel() { m_cancelled = true; }
+
+    void clear([[maybe_unused]] std::string_view prefix = "")
+    {
+        T discarded;
+        while (m_queue.try_dequeue(discarded)) {}
+    }
+
+private:
+    // Bounds the blocking dequeue so consumers re-check the dispatcher running flag.
+    static constexpr int64_t WAIT_DEQUEUE_TIMEOUT_USEC = 100000;
+
+    moodycamel::BlockingConcurrentQueue<T> m_queue;
+    std::atomic_bool m_cancelled = false;
+};
+
 /**
  * @brief Class in charge to dispatch events in a queue to be processed by a functor.
  *
@@ -61,7 +125,7 @@ public:
         : m_functor {std::move(functor)}
         , m_maxQueueSize {threadEventDispatcherParams.maxQueueSize}
         , m_bulkSize {threadEventDispatcherParams.bulkSize}
-        , m_queue {std::make_unique<TSafeQueueType>(TQueueType(threadEventDispatcherParams.dbPath))}
+        , m_queue {makeQueue(threadEventDispatcherParams.dbPath)}
         , m_dispatcherType {threadEventDispatcherParams.dispatcherType}
     {
         const auto threadsAmount =
@@ -77,7 +141,7 @@ public:
     explicit TThreadEventDispatcher(const ThreadEventDispatcherParams& threadEventDispatcherParams)
         : m_maxQueueSize {threadEventDispatcherParams.maxQueueSize}
         , m_bulkSize {threadEventDispatcherParams.bulkSize}
-        , m_queue {std::make_unique<TSafeQueueType>(TQueueType(threadEventDispatcherParams.dbPath))}
+        , m_queue {makeQueue(threadEventDispatcherParams.dbPath)}
         , m_dispatcherType {threadEventDispatcherParams.dispatcherType}
     {
     }
@@ -145,6 +209,28 @@ private:
     static constexpr bool m_isTSafeQueue =
         std::is_same_v<base::utils::queue::TSafeQueue<T, U, RocksDBQueue<T, U>>, TSafeQueueType>;
 
+    /**
+     * @brief Check if the queue type is a `LockFreeQueue`.
+     *
+     */
+    static constexpr bool m_isLockFreeQueue = std::is_same_v<LockFreeQueue<T>, TSafeQueueType>;
+
+    /**
+     * @brief Builds the queue backend. The lock-free backend is purely in-memory, so the database
+     * path only applies to the persistent one.
+     */
+    static std::unique_ptr<TSafeQueueType> makeQueue([[maybe_unused]] const std::string& dbPath)
+    {
+        if constexpr (m_isLockFreeQueue)
+        {
+            return std::make_unique<TSafeQueueType>();
+        }
+        else
+        {
+            return std::make_unique<TSafeQueueType>(TQueueType(dbPath));
+        }
+    }
+
     /**
      * @brief Dispatch function to handle queue processing based on the number of threads.
      *
@@ -193,6 +279,12 @@ private:
                     m_queue->popBulk(size);
                 }
             }
+            else if constexpr (m_isLockFreeQueue)
+            {
+                // The lock-free backend has no two-phase pop, so a single consumer processes
+                // the same pop-then-reinsert flow as the multi-threaded path.
+                multiAndUnordered();
+            }
             else
             {
                 // static assert to avoid compilation for unsupported queue types
@@ -219,7 +311,7 @@ private:
         std::pair<U, std::string> dataPair;
         try
         {
-            if constexpr (m_isTSafeQueue)
+            if constexpr (m_isTSafeQueue || m_isLockFreeQueue)
             {
                 data = m_queue->getBulkAndPop(m_bulkSize);
 
@@ -269,4 +361,7 @@ private:
 template<typename Type, typename Functor>
 using ThreadEventDispatcher = TThreadEventDispatcher<Type, Type, Functor>;
 
+template<typename Type, typename Functor>
+using LockFreeEventDispatcher = TThreadEventDispatcher<Type, Type, Functor, LockFreeQueue<Type>, LockFreeQueue<Type>>;
+
 #endif // _THREAD_EVENT_DISPATCHER_HPP
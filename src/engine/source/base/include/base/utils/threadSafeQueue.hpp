@@ -17,10 +17,28 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <type_traits>
 
 namespace base::utils::queue
 {
 
+namespace detail
+{
+/**
+ * @brief Detects whether the underlying queue offers a batched `popBulk`, so acks can be
+ * committed as one write instead of one per element.
+ */
+template<typename Tq, typename = void>
+struct HasPopBulk : std::false_type
+{
+};
+
+template<typename Tq>
+struct HasPopBulk<Tq, std::void_t<decltype(std::declval<Tq&>().popBulk(uint64_t {}))>> : std::true_type
+{
+};
+} // namespace detail
+
 template<typename T, typename U, typename Tq = std::queue<T>>
 class TSafeQueue
 {
@@ -131,12 +149,20 @@ public:
     void popBulk(const uint64_t elementsQuantity)
     {
         std::scoped_lock lock {m_mutex};
-        auto counter = 0ULL;
 
-        while (counter < elementsQuantity && !m_queue.empty())
+        if constexpr (detail::HasPopBulk<Tq>::value)
         {
-            m_queue.pop();
-            ++counter;
+            m_queue.popBulk(elementsQuantity);
+        }
+        else
+        {
+            auto counter = 0ULL;
+
+            while (counter < elementsQuantity && !m_queue.empty())
+            {
+                m_queue.pop();
+                ++counter;
+            }
         }
     }
 
@@ -169,9 +195,16 @@ public:
         }
 
         // Pop the elements from the queue after getting them.
-        for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
+        if constexpr (detail::HasPopBulk<Tq>::value)
         {
-            m_queue.pop();
+            m_queue.popBulk(elementsQuantity);
+        }
+        else
+        {
+            for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
+            {
+                m_queue.pop();
+            }
         }
 
         return bulkQueue;
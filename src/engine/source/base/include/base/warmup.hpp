@@ -0,0 +1,39 @@
+#ifndef _BASE_WARMUP_HPP
+#define _BASE_WARMUP_HPP
+
+namespace base::warmup
+{
+
+namespace detail
+{
+inline thread_local bool g_active = false;
+} // namespace detail
+
+/**
+ * @brief Whether the current thread is replaying warm-up traffic.
+ *
+ * Stages with external side effects (e.g. the indexer output) consult this flag and
+ * discard their output while it is set, so a freshly built environment can be warmed
+ * with copies of recent events without publishing duplicates.
+ */
+inline bool active()
+{
+    return detail::g_active;
+}
+
+/**
+ * @brief RAII guard marking the current thread as replaying warm-up traffic.
+ */
+class Scope
+{
+public:
+    Scope() { detail::g_active = true; }
+    ~Scope() { detail::g_active = false; }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+} // namespace base::warmup
+
+#endif // _BASE_WARMUP_HPP
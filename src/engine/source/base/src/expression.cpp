@@ -146,6 +146,41 @@ Or::Or(std::string name, std::vector<std::shared_ptr<Formula>> operands)
 {
 }
 
+const std::optional<Or::DispatchHint>& Or::dispatchHint() const
+{
+    return m_dispatchHint;
+}
+
+void Or::setDispatchHint(DispatchHint hint)
+{
+    if (hint.count < 2 || hint.first + hint.count > m_operands.size() || hint.cases.size() != hint.count)
+    {
+        throw std::runtime_error(
+            fmt::format("Engine base expression: Dispatch hint of \"{}\" does not cover its run exactly", m_name));
+    }
+
+    for (const auto& [literal, index] : hint.cases)
+    {
+        if (index < hint.first || index >= hint.first + hint.count)
+        {
+            throw std::runtime_error(fmt::format(
+                "Engine base expression: Dispatch hint of \"{}\" references an operand outside its run", m_name));
+        }
+    }
+
+    m_dispatchHint = std::move(hint);
+}
+
+bool Or::isMutuallyExclusive() const
+{
+    return m_mutuallyExclusive;
+}
+
+void Or::setMutuallyExclusive()
+{
+    m_mutuallyExclusive = true;
+}
+
 [[nodiscard]] std::shared_ptr<Chain> Chain::create(std::string name, std::vector<std::shared_ptr<Formula>> operands)
 {
     return std::shared_ptr<Chain>(new Chain(name, operands));
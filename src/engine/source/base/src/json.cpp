@@ -34,6 +34,12 @@ Json::Json(const rapidjson::GenericObject<true, rapidjson::Value>& object)
     }
 }
 
+Json::Json(rapidjson::Document::AllocatorType* allocator, std::shared_ptr<Arena> arena)
+    : m_arena {std::move(arena)}
+    , m_document {allocator}
+{
+}
+
 Json::Json()
     : m_document {rapidjson::Document()} {};
 
@@ -59,6 +65,67 @@ Json::Json(const char* json)
     }
 }
 
+Json::Json(std::string_view json)
+    : m_document {rapidjson::Document()}
+{
+    rapidjson::ParseResult result = m_document.Parse(json.data(), json.size());
+    if (!result)
+    {
+        throw std::runtime_error(
+            fmt::format("JSON document could not be parsed: {}", rapidjson::GetParseError_En(result.Code())));
+    }
+
+    auto error = checkDuplicateKeys();
+    if (error)
+    {
+        throw std::runtime_error(fmt::format("JSON document has duplicated keys: {}", error->message));
+    }
+}
+
+Json::Json(const char* json, std::shared_ptr<Arena> arena)
+    : m_arena {std::move(arena)}
+    , m_document {&m_arena->allocator()}
+{
+    rapidjson::ParseResult result = m_document.Parse(json);
+    if (!result)
+    {
+        throw std::runtime_error(
+            fmt::format("JSON document could not be parsed: {}", rapidjson::GetParseError_En(result.Code())));
+    }
+
+    auto error = checkDuplicateKeys();
+    if (error)
+    {
+        throw std::runtime_error(fmt::format("JSON document has duplicated keys: {}", error->message));
+    }
+}
+
+void Json::reparse(std::string_view json)
+{
+    m_document.SetNull();
+    if (m_arena)
+    {
+        m_arena->recycle();
+    }
+    else
+    {
+        m_document.GetAllocator().Clear();
+    }
+
+    rapidjson::ParseResult result = m_document.Parse(json.data(), json.size());
+    if (!result)
+    {
+        throw std::runtime_error(
+            fmt::format("JSON document could not be parsed: {}", rapidjson::GetParseError_En(result.Code())));
+    }
+
+    auto error = checkDuplicateKeys();
+    if (error)
+    {
+        throw std::runtime_error(fmt::format("JSON document has duplicated keys: {}", error->message));
+    }
+}
+
 Json::Json(const Json& other)
     : m_document {}
 {
@@ -123,13 +190,15 @@ std::string Json::formatJsonPath(std::string_view dotPath, bool skipDot)
 }
 
 Json::Json(Json&& other) noexcept
-    : m_document {std::move(other.m_document)}
+    : m_arena {std::move(other.m_arena)}
+    , m_document {std::move(other.m_document)}
 {
 }
 
 Json& Json::operator=(Json&& other) noexcept
 {
     m_document = std::move(other.m_document);
+    m_arena = std::move(other.m_arena);
     return *this;
 }
 
@@ -233,6 +302,97 @@ std::optional<std::string> Json::getString(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<std::string_view> Json::getStringView(std::string_view path) const
+{
+    const auto pp = rapidjson::Pointer(path.data());
+
+    if (pp.IsValid())
+    {
+        const auto* value = pp.Get(m_document);
+        if (value && value->IsString())
+        {
+            return std::string_view {value->GetString(), value->GetStringLength()};
+        }
+        return std::nullopt;
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
+std::optional<std::string_view> Json::getBytesView(std::string_view path) const
+{
+    // rapidjson keeps the length alongside the payload, so the view is exact
+    // even when the value contains embedded NUL bytes.
+    return getStringView(path);
+}
+
+bool Json::exists(const CompiledPath& path) const
+{
+    return path.ptr().Get(m_document) != nullptr;
+}
+
+std::optional<std::string> Json::getString(const CompiledPath& path) const
+{
+    const auto* value = path.ptr().Get(m_document);
+    if (value && value->IsString())
+    {
+        return std::string {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string_view> Json::getStringView(const CompiledPath& path) const
+{
+    const auto* value = path.ptr().Get(m_document);
+    if (value && value->IsString())
+    {
+        return std::string_view {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> Json::getIntAsInt64(const CompiledPath& path) const
+{
+    const auto* value = path.ptr().Get(m_document);
+    if (value)
+    {
+        if (value->IsInt())
+        {
+            return static_cast<int64_t>(value->GetInt());
+        }
+        if (value->IsInt64())
+        {
+            return value->GetInt64();
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Json> Json::getJson(const CompiledPath& path) const
+{
+    const auto* value = path.ptr().Get(m_document);
+    if (value)
+    {
+        return Json {*value};
+    }
+    return std::nullopt;
+}
+
+void Json::set(const CompiledPath& path, const Json& value)
+{
+    path.ptr().Set(m_document, value.m_document);
+}
+
+void Json::setInt64(int64_t value, const CompiledPath& path)
+{
+    path.ptr().Set(m_document, value);
+}
+
+bool Json::erase(const CompiledPath& path)
+{
+    return path.ptr().Erase(m_document);
+}
+
 std::optional<int> Json::getInt(std::string_view path) const
 {
     std::optional<int> retval {std::nullopt};
@@ -494,6 +654,30 @@ std::string Json::str() const
     return buffer.GetString();
 }
 
+namespace
+{
+/**
+ * @brief Minimal rapidjson output stream appending into a std::string, so a reused
+ * buffer keeps its capacity across serializations instead of paying a fresh
+ * StringBuffer allocation per call.
+ */
+struct StdStringOutputStream
+{
+    using Ch = char;
+    std::string& m_out;
+    void Put(Ch c) { m_out.push_back(c); }
+    void Flush() {}
+};
+} // namespace
+
+void Json::str(std::string& out) const
+{
+    out.clear();
+    StdStringOutputStream buffer {out};
+    rapidjson::Writer<StdStringOutputStream, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(buffer);
+    this->m_document.Accept(writer);
+}
+
 std::optional<std::string> Json::str(std::string_view path) const
 {
     std::optional<std::string> retval {std::nullopt};
@@ -1027,80 +1211,104 @@ bool Json::erase(std::string_view path)
     }
 }
 
-void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::string_view path)
+void Json::mergeAdopt(const bool isRecursive, rapidjson::Value& source, std::string_view path)
 {
     const auto pp = rapidjson::Pointer(path.data());
 
-    if (pp.IsValid())
+    if (!pp.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+    }
+
+    auto* dstRoot = pp.Get(m_document);
+    if (!dstRoot)
+    {
+        throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path));
+    }
+
+    auto& allocator = m_document.GetAllocator();
+
+    // Iterative merge: a work list of same-type (source, destination) node pairs
+    // instead of one recursion (and one deep copy) per nested level
+    std::vector<std::pair<rapidjson::Value*, rapidjson::Value*>> pending;
+    pending.emplace_back(&source, dstRoot);
+
+    while (!pending.empty())
     {
-        auto* dstValue = pp.Get(m_document);
-        if (dstValue)
+        auto [src, dst] = pending.back();
+        pending.pop_back();
+
+        if (dst->GetType() != src->GetType())
+        {
+            throw std::runtime_error("JSON objects of different types cannot be merged");
+        }
+
+        if (dst->IsObject())
         {
-            if (dstValue->GetType() == source.GetType())
+            // First pass: adopt the new members and overwrite the non-mergeable
+            // ones. AddMember may grow the member array of dst, so pointers into
+            // it are only taken once this pass is done.
+            for (auto srcIt = src->MemberBegin(); srcIt != src->MemberEnd(); ++srcIt)
             {
-                if (dstValue->IsObject())
+                auto dstIt = dst->FindMember(srcIt->name);
+                if (dstIt == dst->MemberEnd())
                 {
-                    for (auto srcIt = source.MemberBegin(); srcIt != source.MemberEnd(); ++srcIt)
+                    dst->AddMember(srcIt->name, srcIt->value, allocator);
+                }
+                else if (!(isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray())))
+                {
+                    dstIt->value = srcIt->value;
+                }
+            }
+
+            // Second pass: queue the containers to merge member by member. The
+            // members adopted above were left null in the source, so they are
+            // naturally skipped here.
+            if (isRecursive)
+            {
+                for (auto srcIt = src->MemberBegin(); srcIt != src->MemberEnd(); ++srcIt)
+                {
+                    if (srcIt->value.IsObject() || srcIt->value.IsArray())
                     {
-                        if (dstValue->HasMember(srcIt->name))
-                        {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            if (isRecursive && (srcIt->value.IsObject() || srcIt->value.IsArray()))
-                            {
-                                std::string newPath {std::string(path) + "/" + srcIt->name.GetString()};
-                                merge(isRecursive, cpyValue, newPath);
-                            }
-                            else
-                            {
-                                dstValue->FindMember(srcIt->name)->value = cpyValue;
-                            }
-                        }
-                        else
-                        {
-                            rapidjson::Value cpyValue {srcIt->value, m_document.GetAllocator()};
-                            rapidjson::Value cpyName {srcIt->name, m_document.GetAllocator()};
-                            dstValue->AddMember(cpyName, cpyValue, m_document.GetAllocator());
-                        }
+                        pending.emplace_back(&srcIt->value, &dst->FindMember(srcIt->name)->value);
                     }
                 }
-                else if (dstValue->IsArray())
+            }
+        }
+        else if (dst->IsArray())
+        {
+            for (auto srcIt = src->Begin(); srcIt != src->End(); ++srcIt)
+            {
+                // Find if value is already in dst
+                // TODO: this is inefficient, but rapidjson does not provide a way
+                // to do it.
+                auto found = false;
+                for (auto dstIt = dst->Begin(); dstIt != dst->End(); ++dstIt)
                 {
-                    for (auto srcIt = source.Begin(); srcIt != source.End(); ++srcIt)
+                    if (*dstIt == *srcIt)
                     {
-                        // Find if value is already in dstValue
-                        // TODO: this is inefficient, but rapidjson does not provide a way
-                        // to do it.
-                        auto found = false;
-                        for (auto dstIt = dstValue->Begin(); dstIt != dstValue->End(); ++dstIt)
-                        {
-                            if (*dstIt == *srcIt)
-                            {
-                                found = true;
-                                break;
-                            }
-                        }
-                        if (!found)
-                        {
-                            rapidjson::Value cpyValue {*srcIt, m_document.GetAllocator()};
-                            dstValue->PushBack(cpyValue, m_document.GetAllocator());
-                        }
+                        found = true;
+                        break;
                     }
                 }
-                else
+                if (!found)
                 {
-                    throw std::runtime_error("JSON elements must be both either objects or arrays to be merged");
+                    dst->PushBack(*srcIt, allocator);
                 }
-
-                return;
             }
-
-            throw std::runtime_error("JSON objects of different types cannot be merged");
         }
-
-        throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path));
+        else
+        {
+            throw std::runtime_error("JSON elements must be both either objects or arrays to be merged");
+        }
     }
+}
 
-    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::string_view path)
+{
+    // Foreign allocator: one staged deep copy, then the merge adopts every node
+    rapidjson::Value staged {source, m_document.GetAllocator()};
+    mergeAdopt(isRecursive, staged, path);
 }
 
 void Json::merge(const bool isRecursive, const Json& other, std::string_view path)
@@ -1117,7 +1325,9 @@ void Json::merge(const bool isRecursive, std::string_view source, std::string_vi
         auto* srcValue = pp.Get(m_document);
         if (srcValue)
         {
-            merge(isRecursive, *srcValue, path);
+            // The source lives in this document: same allocator, so the values are
+            // adopted in place and only the hollowed-out node is erased
+            mergeAdopt(isRecursive, *srcValue, path);
             erase(source);
             return;
         }
@@ -1146,6 +1356,48 @@ std::optional<Json> Json::getJson(std::string_view path) const
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<Json> Json::adoptJson(std::string_view path)
+{
+    const auto pp = rapidjson::Pointer(path.data());
+
+    if (pp.IsValid())
+    {
+        auto* val = pp.Get(m_document);
+        if (val)
+        {
+            Json retval {&m_document.GetAllocator(), m_arena};
+            static_cast<rapidjson::Value&>(retval.m_document) = std::move(*val);
+            // The move hollowed the source node out to null; drop it. The root
+            // cannot be erased and is simply left null.
+            pp.Erase(m_document);
+            return retval;
+        }
+        return std::nullopt;
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
+void Json::setJson(std::string_view path, Json&& value)
+{
+    const auto pp = rapidjson::Pointer(path.data());
+
+    if (!pp.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+    }
+
+    if (&value.m_document.GetAllocator() == &m_document.GetAllocator())
+    {
+        // Same allocator: relink the subtree in place, no nodes are copied
+        pp.Create(m_document) = std::move(static_cast<rapidjson::Value&>(value.m_document));
+    }
+    else
+    {
+        pp.Set(m_document, value.m_document);
+    }
+}
+
 std::optional<base::Error> Json::validate(const Json& schema) const
 {
     rapidjson::SchemaDocument sd(schema.m_document);
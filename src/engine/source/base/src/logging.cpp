@@ -8,12 +8,23 @@
  *
  */
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <utility>
+
 #include <base/logging.hpp>
 #include <spdlog/pattern_formatter.h>
 
 namespace logging
 {
 
+namespace
+{
+std::atomic<uint64_t> g_suppressedLogs {0}; ///< Messages discarded by the duplicate filter.
+} // namespace
+
 class CustomSink : public spdlog::sinks::sink
 {
 public:
@@ -69,6 +80,95 @@ private:
     std::unique_ptr<spdlog::formatter> m_upFormatter;
 };
 
+/**
+ * @brief Sink decorator that rate limits repeated messages per call site.
+ *
+ * A call site (source file and line) may emit up to a burst of messages per time window;
+ * further ones inside the window are counted and discarded, and a single summary line is
+ * emitted when the window rolls over. This keeps a looping warning from flooding the log
+ * (and, in async mode, from evicting unrelated messages out of the queue).
+ */
+class CallSiteRateLimitSink : public spdlog::sinks::sink
+{
+public:
+    CallSiteRateLimitSink(std::shared_ptr<spdlog::sinks::sink> innerSink,
+                          const uint32_t burst,
+                          const std::chrono::seconds window)
+        : m_innerSink(std::move(innerSink))
+        , m_burst(burst)
+        , m_window(window)
+    {
+    }
+
+    void log(const spdlog::details::log_msg& message) override
+    {
+        // Messages without a call site (e.g. emitted by spdlog itself) are never limited.
+        if (message.source.filename == nullptr)
+        {
+            m_innerSink->log(message);
+            return;
+        }
+
+        std::lock_guard lock(m_mutex);
+        auto& entry = m_callSites[{message.source.filename, message.source.line}];
+
+        if (message.time - entry.windowStart >= m_window)
+        {
+            if (entry.suppressed > 0)
+            {
+                char summary[64];
+                const auto written = fmt::format_to_n(
+                    summary, sizeof(summary), "previous message repeated {} more times", entry.suppressed);
+                const spdlog::details::log_msg summaryMessage {message.source,
+                                                               message.logger_name,
+                                                               message.level,
+                                                               spdlog::string_view_t(summary, written.size)};
+                m_innerSink->log(summaryMessage);
+            }
+
+            entry.windowStart = message.time;
+            entry.count = 0;
+            entry.suppressed = 0;
+        }
+
+        if (entry.count < m_burst)
+        {
+            ++entry.count;
+            m_innerSink->log(message);
+            return;
+        }
+
+        ++entry.suppressed;
+        g_suppressedLogs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void flush() override { m_innerSink->flush(); }
+
+    void set_pattern(const std::string& pattern) override { m_innerSink->set_pattern(pattern); }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override
+    {
+        m_innerSink->set_formatter(std::move(sinkFormatter));
+    }
+
+private:
+    /**
+     * @brief Per-call-site window state.
+     */
+    struct Entry
+    {
+        spdlog::log_clock::time_point windowStart {};
+        uint32_t count {0};      ///< Messages emitted in the current window.
+        uint64_t suppressed {0}; ///< Messages discarded in the current window.
+    };
+
+    std::shared_ptr<spdlog::sinks::sink> m_innerSink;         ///< Decorated sink.
+    const uint32_t m_burst;                                   ///< Messages allowed per window.
+    const std::chrono::seconds m_window;                      ///< Suppression window.
+    std::mutex m_mutex;                                       ///< Protects the call site map.
+    std::map<std::pair<const char*, int>, Entry> m_callSites; ///< Window state per call site.
+};
+
 std::shared_ptr<spdlog::logger> getDefaultLogger()
 {
     auto logger = spdlog::get("default");
@@ -110,24 +210,39 @@ void setLevel(Level level)
 void start(const LoggingConfig& cfg)
 {
     std::shared_ptr<spdlog::logger> logger;
+    std::shared_ptr<spdlog::sinks::sink> sink;
 
-    if (0 < cfg.dedicatedThreads)
+    if (cfg.filePath == STD_ERR_PATH || cfg.filePath == STD_OUT_PATH || cfg.filePath.empty())
     {
-        spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
+        sink = std::make_shared<CustomSink>();
+    }
+    else
+    {
+        sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(cfg.filePath, cfg.truncate);
     }
 
-    if (cfg.filePath == STD_ERR_PATH || cfg.filePath == STD_OUT_PATH || cfg.filePath.empty())
+    if (0 < cfg.repeatedWindowSec)
     {
-        auto custumSink = std::make_shared<CustomSink>();
+        sink = std::make_shared<CallSiteRateLimitSink>(
+            std::move(sink), cfg.repeatedBurst, std::chrono::seconds(cfg.repeatedWindowSec));
+    }
 
-        logger = std::make_shared<spdlog::logger>("default", custumSink);
-        spdlog::set_default_logger(logger);
+    if (0 < cfg.dedicatedThreads)
+    {
+        // Async mode: the workers only enqueue the message and never block on the sink.
+        // When the queue is full the oldest pending message is overwritten instead of
+        // stalling the data path; the overwrites are accounted in droppedLogs().
+        spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
+        logger = std::make_shared<spdlog::async_logger>(
+            "default", std::move(sink), spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
     }
     else
     {
-        logger = spdlog::basic_logger_mt("default", cfg.filePath, cfg.truncate);
+        logger = std::make_shared<spdlog::logger>("default", std::move(sink));
     }
 
+    spdlog::set_default_logger(logger);
+
     setLevel(cfg.level);
     logger->flush_on(spdlog::level::trace);
 }
@@ -137,6 +252,17 @@ void stop()
     spdlog::shutdown();
 }
 
+uint64_t droppedLogs()
+{
+    const auto threadPool = spdlog::thread_pool();
+    return threadPool ? static_cast<uint64_t>(threadPool->overrun_counter()) : 0;
+}
+
+uint64_t suppressedLogs()
+{
+    return g_suppressedLogs.load(std::memory_order_relaxed);
+}
+
 void testInit(Level lvl)
 {
     auto logger = spdlog::get("default");
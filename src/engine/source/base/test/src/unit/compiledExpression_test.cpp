@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <base/compiledExpression.hpp>
+
+using namespace base;
+
+namespace
+{
+
+// Term that records its execution order and returns the given result
+Expression makeTerm(const std::string& name, bool succeeds, std::vector<std::string>& log)
+{
+    return Term<EngineOp>::create(name,
+                                  [name, succeeds, &log](Event event) -> result::Result<Event>
+                                  {
+                                      log.push_back(name);
+                                      if (succeeds)
+                                      {
+                                          return result::makeSuccess(std::move(event));
+                                      }
+                                      return result::makeFailure(std::move(event));
+                                  });
+}
+
+} // namespace
+
+TEST(CompiledExpressionTest, Term)
+{
+    std::vector<std::string> log;
+    auto compiled = eval::CompiledExpression::compile(makeTerm("t", true, log));
+    ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(compiled.size(), 1);
+
+    auto failing = eval::CompiledExpression::compile(makeTerm("t", false, log));
+    ASSERT_FALSE(failing(std::make_shared<json::Json>()));
+}
+
+TEST(CompiledExpressionTest, AndShortCircuits)
+{
+    std::vector<std::string> log;
+    auto expr = And::create("and", {makeTerm("a", true, log), makeTerm("b", false, log), makeTerm("c", true, log)});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    ASSERT_FALSE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"a", "b"}));
+}
+
+TEST(CompiledExpressionTest, OrShortCircuits)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create("or", {makeTerm("a", false, log), makeTerm("b", true, log), makeTerm("c", true, log)});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"a", "b"}));
+}
+
+TEST(CompiledExpressionTest, ChainRunsAllAndSucceeds)
+{
+    std::vector<std::string> log;
+    auto expr = Chain::create("chain", {makeTerm("a", false, log), makeTerm("b", false, log)});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"a", "b"}));
+}
+
+TEST(CompiledExpressionTest, Implication)
+{
+    std::vector<std::string> log;
+    auto expr = Implication::create("impl", makeTerm("cond", true, log), makeTerm("then", false, log));
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    // The consequence runs and the implication succeeds
+    ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"cond", "then"}));
+
+    log.clear();
+    auto exprFail = Implication::create("impl", makeTerm("cond", false, log), makeTerm("then", true, log));
+    auto compiledFail = eval::CompiledExpression::compile(exprFail);
+
+    ASSERT_FALSE(compiledFail(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"cond"}));
+}
+
+TEST(CompiledExpressionTest, DispatchedOrProbesOnce)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create(
+        "or", {makeTerm("sshd", true, log), makeTerm("apache", true, log), makeTerm("fallback", true, log)});
+    expr->getPtr<Or>()->setDispatchHint({"/module", {{"sshd", 0}, {"apache", 1}}, 0, 2});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    // Only the dispatched operand runs, the rest of the run is never scanned
+    auto event = std::make_shared<json::Json>();
+    event->setString("apache", "/module");
+    ASSERT_TRUE(compiled(event));
+    ASSERT_EQ(log, (std::vector<std::string> {"apache"}));
+}
+
+TEST(CompiledExpressionTest, DispatchedOrMissSkipsTheRun)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create(
+        "or", {makeTerm("sshd", true, log), makeTerm("apache", true, log), makeTerm("fallback", true, log)});
+    expr->getPtr<Or>()->setDispatchHint({"/module", {{"sshd", 0}, {"apache", 1}}, 0, 2});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    // Unknown literal jumps straight to the operand after the run
+    auto event = std::make_shared<json::Json>();
+    event->setString("journald", "/module");
+    ASSERT_TRUE(compiled(event));
+    ASSERT_EQ(log, (std::vector<std::string> {"fallback"}));
+
+    // Absent and non-string fields behave the same way
+    log.clear();
+    ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"fallback"}));
+}
+
+TEST(CompiledExpressionTest, DispatchedOrFailureSkipsTheRun)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create(
+        "or", {makeTerm("sshd", false, log), makeTerm("apache", true, log), makeTerm("fallback", false, log)});
+    expr->getPtr<Or>()->setDispatchHint({"/module", {{"sshd", 0}, {"apache", 1}}, 0, 2});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    // A failed dispatched operand falls through past the run, no other run
+    // operand can match a field already probed to a different literal
+    auto event = std::make_shared<json::Json>();
+    event->setString("sshd", "/module");
+    ASSERT_FALSE(compiled(event));
+    ASSERT_EQ(log, (std::vector<std::string> {"sshd", "fallback"}));
+}
+
+TEST(CompiledExpressionTest, DispatchedOrInnerRun)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create("or",
+                           {makeTerm("head", false, log),
+                            makeTerm("sshd", true, log),
+                            makeTerm("apache", true, log),
+                            makeTerm("fallback", true, log)});
+    expr->getPtr<Or>()->setDispatchHint({"/module", {{"sshd", 1}, {"apache", 2}}, 1, 2});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    // Operands before the run scan sequentially, then a single probe dispatches
+    auto event = std::make_shared<json::Json>();
+    event->setString("sshd", "/module");
+    ASSERT_TRUE(compiled(event));
+    ASSERT_EQ(log, (std::vector<std::string> {"head", "sshd"}));
+}
+
+TEST(CompiledExpressionTest, PinnedOrReordersByHits)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create("or", {makeTerm("cold", false, log), makeTerm("hot", true, log)});
+    expr->getPtr<Or>()->setMutuallyExclusive();
+    auto compiled = eval::CompiledExpression::compile(expr);
+    ASSERT_TRUE(compiled.countsBranchHits());
+
+    // With no hits yet the orders keep document order
+    auto initial = eval::CompiledExpression::compile(expr, compiled.hitOrders());
+    ASSERT_TRUE(initial(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"cold", "hot"}));
+
+    // Every event scans the cold branch first and accepts through the hot one
+    log.clear();
+    for (auto i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    }
+    ASSERT_EQ(log, (std::vector<std::string> {"cold", "hot", "cold", "hot", "cold", "hot"}));
+
+    // Recompiled with the observed hits, the hot branch runs first
+    auto reordered = eval::CompiledExpression::compile(expr, compiled.hitOrders());
+    log.clear();
+    ASSERT_TRUE(reordered(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"hot"}));
+}
+
+TEST(CompiledExpressionTest, UnpinnedOrDoesNotCount)
+{
+    std::vector<std::string> log;
+    auto expr = Or::create("or", {makeTerm("a", false, log), makeTerm("b", true, log)});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    ASSERT_FALSE(compiled.countsBranchHits());
+    ASSERT_TRUE(compiled.hitOrders().empty());
+}
+
+TEST(CompiledExpressionTest, NestedOperations)
+{
+    std::vector<std::string> log;
+    auto expr = And::create("and",
+                            {Or::create("or", {makeTerm("a", false, log), makeTerm("b", true, log)}),
+                             Chain::create("chain", {makeTerm("c", true, log)}),
+                             makeTerm("d", true, log)});
+    auto compiled = eval::CompiledExpression::compile(expr);
+
+    ASSERT_TRUE(compiled(std::make_shared<json::Json>()));
+    ASSERT_EQ(log, (std::vector<std::string> {"a", "b", "c", "d"}));
+}
@@ -127,3 +127,25 @@ INSTANTIATE_TEST_SUITE_P(DotPathTest,
                                            BuildsStrTuple("a\\.b", {"a.b"}, true),
                                            BuildsStrTuple("a\\.b.c", {"a.b", "c"}, true),
                                            BuildsStrTuple("a.b\\.c", {"a", "b.c"}, true)));
+
+TEST(DotPathTest, InternedRepresentation)
+{
+    // Equal paths share one interned representation: same id, same parts storage.
+    DotPath a("some.long.field.path");
+    DotPath b("some.long.field.path");
+    DotPath c(".some.long.field.path");
+    DotPath other("some.long.field.other");
+
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(a, c);
+    ASSERT_NE(a, other);
+    ASSERT_EQ(a.id(), b.id());
+    ASSERT_EQ(a.id(), c.id());
+    ASSERT_NE(a.id(), other.id());
+    ASSERT_EQ(&a.parts(), &b.parts());
+    ASSERT_EQ(std::hash<DotPath> {}(a), std::hash<DotPath> {}(b));
+
+    // Copies are representation handles, not deep copies.
+    DotPath copy(a);
+    ASSERT_EQ(&copy.parts(), &a.parts());
+}
@@ -89,6 +89,34 @@ TEST(FormulaTest, OrMethods)
     ASSERT_EQ(orOp, orPtr);
 }
 
+TEST(FormulaTest, OrAnnotations)
+{
+    auto formula1 = base::Term<std::function<bool(int)>>::create("formula1", [](int) { return true; });
+    auto formula2 = base::Term<std::function<bool(int)>>::create("formula2", [](int) { return true; });
+    auto formula3 = base::Term<std::function<bool(int)>>::create("formula3", [](int) { return true; });
+
+    auto orOp = base::Or::create("testOr", {formula1, formula2, formula3});
+    ASSERT_FALSE(orOp->dispatchHint());
+    ASSERT_FALSE(orOp->isMutuallyExclusive());
+
+    orOp->setMutuallyExclusive();
+    ASSERT_TRUE(orOp->isMutuallyExclusive());
+
+    // Run not covered exactly: too few cases, run past the operands, wrong case count
+    ASSERT_THROW(orOp->setDispatchHint({"/field", {{"a", 0}}, 0, 1}), std::runtime_error);
+    ASSERT_THROW(orOp->setDispatchHint({"/field", {{"a", 2}, {"b", 3}}, 2, 2}), std::runtime_error);
+    ASSERT_THROW(orOp->setDispatchHint({"/field", {{"a", 0}}, 0, 2}), std::runtime_error);
+    // Case outside the run
+    ASSERT_THROW(orOp->setDispatchHint({"/field", {{"a", 0}, {"b", 2}}, 0, 2}), std::runtime_error);
+
+    ASSERT_NO_THROW(orOp->setDispatchHint({"/field", {{"a", 0}, {"b", 1}}, 0, 2}));
+    ASSERT_TRUE(orOp->dispatchHint());
+    ASSERT_EQ(orOp->dispatchHint()->field, "/field");
+    ASSERT_EQ(orOp->dispatchHint()->cases.size(), 2);
+    ASSERT_EQ(orOp->dispatchHint()->first, 0);
+    ASSERT_EQ(orOp->dispatchHint()->count, 2);
+}
+
 TEST(FormulaTest, ChainMethods)
 {
     auto formula1 = base::Term<std::function<bool(int)>>::create("formula1", [](int) { return true; });
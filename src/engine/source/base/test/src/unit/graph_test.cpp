@@ -349,3 +349,57 @@ TEST(GraphTest, GetGraphStr)
     ASSERT_NO_THROW(got = graph.getGraphStr());
     ASSERT_EQ(got, expected);
 }
+
+TEST(GraphTest, Compact)
+{
+    auto initialize = []()
+    {
+        return Graph<std::string, int>("root", 0);
+    };
+    ASSERT_NO_THROW(initialize());
+    auto graph = initialize();
+
+    graph.addNode("child1", 1);
+    graph.addNode("child2", 2);
+    graph.addNode("grandchild", 3);
+    graph.addEdge("root", "child1");
+    graph.addEdge("root", "child2");
+    graph.addEdge("child1", "grandchild");
+    graph.addEdge("child2", "grandchild");
+
+    auto compactInitialize = [&]()
+    {
+        return Graph<std::string, int>::Compact(graph);
+    };
+    ASSERT_NO_THROW(compactInitialize());
+    auto compact = compactInitialize();
+
+    ASSERT_EQ(compact.size(), 4);
+    ASSERT_EQ(compact.rootIndex(), compact.index("root"));
+    ASSERT_EQ(compact.id(compact.rootIndex()), "root");
+    ASSERT_EQ(compact.value(compact.index("grandchild")), 3);
+    ASSERT_THROW(compact.index("missing"), std::runtime_error);
+
+    // Root children preserve the insertion order of the edges
+    auto rootChildren = compact.children(compact.rootIndex());
+    std::vector<std::string> gotChildren;
+    for (auto child : rootChildren)
+    {
+        gotChildren.push_back(compact.id(child));
+    }
+    ASSERT_EQ(gotChildren, (std::vector<std::string> {"child1", "child2"}));
+
+    // Shared child resolves to the same dense index from both parents
+    auto child1Children = compact.children(compact.index("child1"));
+    auto child2Children = compact.children(compact.index("child2"));
+    ASSERT_EQ(*child1Children.begin(), *child2Children.begin());
+    ASSERT_EQ(*child1Children.begin(), compact.index("grandchild"));
+
+    ASSERT_TRUE(compact.hasChildren(compact.rootIndex()));
+    ASSERT_FALSE(compact.hasChildren(compact.index("grandchild")));
+    ASSERT_TRUE(compact.children(compact.index("grandchild")).empty());
+
+    // An empty graph cannot be compacted
+    Graph<std::string, int> emptyGraph;
+    ASSERT_THROW((Graph<std::string, int>::Compact(emptyGraph)), std::runtime_error);
+}
@@ -636,6 +636,26 @@ TEST_F(JsonRuntime, Str)
     ASSERT_EQ(expected, doc.str());
 }
 
+TEST_F(JsonRuntime, StrIntoBuffer)
+{
+    std::string expected = "{\"nested\":{\"object\":{\"key\":\"value\"},\"array\":["
+                           "\"value\"],\"int\":123,\"real\":123.456,\"boolT\":true,"
+                           "\"boolF\":false,\"null\":null,\"string\":\"value\"}}";
+
+    Json doc {expected.c_str()};
+
+    // A reused buffer is cleared and keeps its capacity across serializations
+    std::string buffer {"leftover from a previous event"};
+    doc.str(buffer);
+    ASSERT_EQ(expected, buffer);
+
+    const auto capacity = buffer.capacity();
+    Json small {R"({"key":"value"})"};
+    small.str(buffer);
+    ASSERT_EQ(R"({"key":"value"})", buffer);
+    ASSERT_EQ(capacity, buffer.capacity());
+}
+
 // Checking basic functionality of str from path method
 TEST_F(JsonRuntime, strFromPath)
 {
@@ -1863,6 +1883,51 @@ TEST_F(JsonSettersTest, MergeObjRootRecursive)
     ASSERT_EQ(jObjDst, jObjExpected);
 }
 
+TEST_F(JsonSettersTest, MergeObjRootRecursiveDeep)
+{
+    Json jObjSrc {R"({
+        "a": {
+            "b": {
+                "c": {
+                    "added": 1,
+                    "kind": "alert"
+                },
+                "list": [2]
+            }
+        }
+    })"};
+
+    Json jObjDst {R"({
+        "a": {
+            "b": {
+                "c": {
+                    "kind": "event",
+                    "kept": true
+                },
+                "list": [1]
+            },
+            "kept": "yes"
+        }
+    })"};
+
+    Json jObjExpected {R"({
+        "a": {
+            "b": {
+                "c": {
+                    "kind": "alert",
+                    "kept": true,
+                    "added": 1
+                },
+                "list": [1, 2]
+            },
+            "kept": "yes"
+        }
+    })"};
+
+    ASSERT_NO_THROW(jObjDst.merge(json::RECURSIVE, jObjSrc));
+    ASSERT_EQ(jObjDst, jObjExpected);
+}
+
 TEST_F(JsonSettersTest, MergeObjRootWithoutRecursive)
 {
     Json jObjSrc {R"({
@@ -2207,6 +2272,35 @@ TEST_F(JsonSettersTest, MergeArrayNestedRef)
     ASSERT_EQ(jArrayDst, jArrayExpected);
 }
 
+TEST_F(JsonSettersTest, MergeRefRecursiveNested)
+{
+    Json jObjDst {R"({
+        "event": {
+            "category": ["networkOne"],
+            "kind": "event",
+            "module": "suricata"
+        },
+        "to_merge": {
+            "event": {
+                "category": ["network"],
+                "kind": "alert"
+            }
+        }
+    })"};
+
+    Json jObjExpected {R"({
+        "event": {
+            "category": ["networkOne", "network"],
+            "kind": "alert",
+            "module": "suricata"
+        }
+    })"};
+
+    // The in-document source is adopted into the destination and then erased
+    ASSERT_NO_THROW(jObjDst.merge(json::RECURSIVE, "/to_merge"));
+    ASSERT_EQ(jObjDst, jObjExpected);
+}
+
 TEST_F(JsonSettersTest, MergeRefFailCases)
 {
     Json jObjDst {R"({
@@ -2241,6 +2335,90 @@ TEST_F(JsonSettersTest, MergeRefFailCases)
     ASSERT_THROW(jObjDst.merge(json::NOT_RECURSIVE, "/to_merge_obj", "/key1"), std::runtime_error);
 }
 
+TEST_F(JsonSettersTest, AdoptJsonDetachesSubtree)
+{
+    Json j {R"({
+        "key1": "value1",
+        "key2": {
+            "key3": {
+                "key4": "value4"
+            }
+        }
+    })"};
+
+    Json jAdoptedExpected {R"({
+        "key4": "value4"
+    })"};
+
+    Json jRemainderExpected {R"({
+        "key1": "value1",
+        "key2": {}
+    })"};
+
+    auto adopted = j.adoptJson("/key2/key3");
+    ASSERT_TRUE(adopted.has_value());
+    ASSERT_EQ(adopted.value(), jAdoptedExpected);
+    ASSERT_EQ(j, jRemainderExpected);
+}
+
+TEST_F(JsonSettersTest, AdoptJsonFailCases)
+{
+    Json j {R"({
+        "key1": "value1"
+    })"};
+
+    // Path not found
+    ASSERT_FALSE(j.adoptJson("/key2").has_value());
+
+    // Invalid pointer
+    ASSERT_THROW(j.adoptJson("key2"), std::runtime_error);
+}
+
+TEST_F(JsonSettersTest, SetJsonRelinksAdoptedSubtree)
+{
+    Json j {R"({
+        "wrapper": {
+            "original": {
+                "payload": [1, 2, 3]
+            }
+        }
+    })"};
+
+    Json jExpected {R"({
+        "wrapper": {},
+        "payload": [1, 2, 3]
+    })"};
+
+    // Adopted subtree shares the document's allocator, so setJson relinks it
+    // without copying a node
+    auto adopted = j.adoptJson("/wrapper/original/payload").value();
+    ASSERT_NO_THROW(j.erase("/wrapper/original"));
+    ASSERT_NO_THROW(j.setJson("/payload", std::move(adopted)));
+    ASSERT_EQ(j, jExpected);
+}
+
+TEST_F(JsonSettersTest, SetJsonCopiesForeignDocument)
+{
+    Json j {R"({
+        "key1": "value1"
+    })"};
+
+    Json foreign {R"({
+        "key3": "value3"
+    })"};
+
+    Json jExpected {R"({
+        "key1": "value1",
+        "key2": {
+            "key3": "value3"
+        }
+    })"};
+
+    // The value lives on another allocator: setJson falls back to a deep copy
+    ASSERT_NO_THROW(j.setJson("/key2", std::move(foreign)));
+    ASSERT_EQ(j, jExpected);
+}
+
 // json getJson test
 TEST_F(getJsonTest, getObjectOk)
 {
@@ -2512,6 +2690,160 @@ TEST_F(JsonSettersTest, MergesCopiesMergedSubtree)
     ASSERT_EQ(destination, expected);
 }
 
+TEST(JsonTest, compiledPathAccess)
+{
+    json::Json json {R"({"a": {"b": "value", "n": 1}})"};
+    json::CompiledPath strPath {"/a/b"};
+    json::CompiledPath intPath {"/a/n"};
+    json::CompiledPath missing {"/a/c"};
+
+    ASSERT_TRUE(json.exists(strPath));
+    ASSERT_FALSE(json.exists(missing));
+    ASSERT_EQ(json.getString(strPath).value(), "value");
+    ASSERT_EQ(json.getStringView(strPath).value(), "value");
+    ASSERT_EQ(json.getIntAsInt64(intPath).value(), 1);
+    ASSERT_EQ(json.getJson(intPath).value().getInt().value(), 1);
+
+    json.set(missing, json::Json {R"("new")"});
+    ASSERT_EQ(json.getString("/a/c").value(), "new");
+
+    json.setInt64(2, intPath);
+    ASSERT_EQ(json.getIntAsInt64(intPath).value(), 2);
+
+    ASSERT_TRUE(json.erase(strPath));
+    ASSERT_FALSE(json.exists(strPath));
+    ASSERT_FALSE(json.erase(strPath));
+}
+
+TEST(JsonTest, compiledPathInvalid)
+{
+    ASSERT_THROW(json::CompiledPath {"invalid"}, std::runtime_error);
+}
+
+TEST(JsonTest, getStringView)
+{
+    json::Json json {R"({"key": "value", "num": 1})"};
+
+    ASSERT_EQ(json.getStringView("/key").value(), "value");
+    ASSERT_FALSE(json.getStringView("/num").has_value());
+    ASSERT_FALSE(json.getStringView("/missing").has_value());
+    ASSERT_THROW(json.getStringView("invalid"), std::runtime_error);
+}
+
+TEST(JsonTest, getBytesViewEmbeddedNul)
+{
+    json::Json json {"{\"key\": \"a\\u0000b\"}"};
+
+    auto view = json.getBytesView("/key");
+    ASSERT_TRUE(view.has_value());
+    ASSERT_EQ(view->size(), 3);
+    ASSERT_EQ((*view)[1], '\0');
+}
+
+TEST(JsonTest, parseFromStringView)
+{
+    // The view is a slice of a larger buffer, without null termination
+    const std::string buffer {R"({"key": "value"} trailing garbage)"};
+    json::Json json {std::string_view {buffer.data(), 16}};
+
+    ASSERT_EQ(json.getString("/key").value(), "value");
+    ASSERT_THROW((json::Json {std::string_view {buffer.data(), 10}}), std::runtime_error);
+}
+
+TEST(JsonTest, arenaParse)
+{
+    auto arena = std::make_shared<json::Arena>();
+    json::Json json {R"({"key": "value", "nested": {"n": 1}})", arena};
+
+    ASSERT_EQ(json.getString("/key").value(), "value");
+    ASSERT_EQ(json.getInt("/nested/n").value(), 1);
+    // The parsed document was carved from the arena slab
+    ASSERT_GT(arena->size(), 0);
+}
+
+TEST(JsonTest, arenaSharedAcrossBatch)
+{
+    auto arena = std::make_shared<json::Arena>();
+    json::Json first {R"({"id": 1})", arena};
+    json::Json second {R"({"id": 2})", arena};
+
+    ASSERT_EQ(first.getInt("/id").value(), 1);
+    ASSERT_EQ(second.getInt("/id").value(), 2);
+}
+
+TEST(JsonTest, arenaSurvivesMove)
+{
+    auto arena = std::make_shared<json::Arena>();
+    json::Json json {R"({"key": "value"})", arena};
+
+    json::Json moved {std::move(json)};
+    // Arena is retained by the moved-to object, dropping the local reference
+    // must not invalidate the document
+    arena.reset();
+    ASSERT_EQ(moved.getString("/key").value(), "value");
+}
+
+TEST(JsonTest, arenaSurvivesAdoption)
+{
+    auto arena = std::make_shared<json::Arena>();
+    json::Json json {R"({"wrapper": {"key": "value"}, "restored": null})", arena};
+    const auto used = arena->size();
+
+    auto adopted = json.adoptJson("/wrapper").value();
+    // Relinking an adopted subtree into an existing slot allocates nothing
+    // from the arena
+    json.setJson("/restored", std::move(adopted));
+    ASSERT_EQ(arena->size(), used);
+    ASSERT_EQ(json.getString("/restored/key").value(), "value");
+
+    // The adopted subtree retains the arena: dropping every other reference
+    // must not invalidate it
+    auto detached = json.adoptJson("/restored").value();
+    json = json::Json {};
+    arena.reset();
+    ASSERT_EQ(detached.getString("/key").value(), "value");
+}
+
+TEST(JsonTest, reparse)
+{
+    json::Json json {R"({"a": 1})"};
+    json.reparse(R"({"b": 2})");
+
+    ASSERT_EQ(json.getInt("/b").value(), 2);
+    ASSERT_FALSE(json.exists("/a"));
+    ASSERT_THROW(json.reparse("{not json"), std::runtime_error);
+}
+
+TEST(JsonTest, reparseRecyclesArena)
+{
+    auto arena = std::make_shared<json::Arena>();
+    json::Json json {R"({"key": "value"})", arena};
+    const auto capacity = arena->capacity();
+
+    // Repeated reuse keeps carving from the same slab
+    for (auto i = 0; i < 100; ++i)
+    {
+        json.reparse(R"({"key": "another value"})");
+    }
+
+    ASSERT_EQ(json.getString("/key").value(), "another value");
+    ASSERT_EQ(arena->capacity(), capacity);
+}
+
+TEST(JsonTest, arenaRecycle)
+{
+    json::Arena arena {128};
+    {
+        rapidjson::Document doc {&arena.allocator()};
+        doc.Parse(R"({"key": "0123456789012345678901234567890123456789"})");
+        ASSERT_FALSE(doc.HasParseError());
+    }
+    auto used = arena.size();
+    ASSERT_GT(used, 0);
+    arena.recycle();
+    ASSERT_EQ(arena.size(), 0);
+}
+
 TEST(JsonTest, eraseIfKeyInvalidPointer)
 {
     Json json {R"({
@@ -116,6 +116,21 @@ TEST_F(NameTest, Distinct)
     ASSERT_NE(name1, name4);
 }
 
+TEST_F(NameTest, InternedIdentity)
+{
+    // Equal names share the interned id, no matter how they were constructed.
+    base::Name name1({"type", "name", "version"});
+    base::Name name2(fmt::format("type{}name{}version", base::Name::SEPARATOR_S, base::Name::SEPARATOR_S));
+    ASSERT_NE(name1.id(), 0);
+    ASSERT_EQ(name1.id(), name2.id());
+    ASSERT_EQ(std::hash<base::Name>()(name1), std::hash<base::Name>()(name2));
+
+    // Distinct names get distinct ids; the default name keeps the reserved id.
+    base::Name name3({"type", "name", "version2"});
+    ASSERT_NE(name1.id(), name3.id());
+    ASSERT_EQ(base::Name().id(), 0);
+}
+
 TEST_F(NameTest, FullName)
 {
     base::Name name({"type", "name", "version"});
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <base/shardedLRUCache.hpp>
+
+TEST(ShardedLRUCacheTest, InsertAndGet)
+{
+    ShardedLRUCache<std::string, int> cache {64};
+
+    cache.insertKey("one", 1);
+    cache.insertKey("two", 2);
+
+    ASSERT_TRUE(cache.getValue("one").has_value());
+    EXPECT_EQ(cache.getValue("one").value(), 1);
+    ASSERT_TRUE(cache.getValue("two").has_value());
+    EXPECT_EQ(cache.getValue("two").value(), 2);
+    EXPECT_FALSE(cache.getValue("three").has_value());
+
+    EXPECT_TRUE(cache.isHit("one"));
+    EXPECT_FALSE(cache.isHit("three"));
+}
+
+TEST(ShardedLRUCacheTest, EvictionIsBounded)
+{
+    constexpr size_t CAPACITY {64};
+    constexpr size_t SHARDS {8};
+    ShardedLRUCache<std::string, int, SHARDS> cache {CAPACITY};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        cache.insertKey(std::to_string(i), i);
+    }
+
+    size_t entries {0};
+    cache.forEach(
+        [&entries](const std::string&, const int&)
+        {
+            ++entries;
+            return true;
+        });
+
+    // Eviction is per segment, so the total never exceeds the capacity rounded up to a
+    // whole number of entries per segment.
+    EXPECT_LE(entries, CAPACITY + SHARDS);
+    EXPECT_GT(entries, 0);
+}
+
+TEST(ShardedLRUCacheTest, ClearRemovesAllEntries)
+{
+    ShardedLRUCache<std::string, int> cache {64};
+
+    for (int i = 0; i < 32; ++i)
+    {
+        cache.insertKey(std::to_string(i), i);
+    }
+
+    cache.clear();
+
+    for (int i = 0; i < 32; ++i)
+    {
+        EXPECT_FALSE(cache.isHit(std::to_string(i)));
+    }
+}
+
+TEST(ShardedLRUCacheTest, ForEachEarlyStop)
+{
+    ShardedLRUCache<std::string, int> cache {64};
+
+    for (int i = 0; i < 32; ++i)
+    {
+        cache.insertKey(std::to_string(i), i);
+    }
+
+    size_t visited {0};
+    cache.forEach(
+        [&visited](const std::string&, const int&)
+        {
+            ++visited;
+            return visited < 5;
+        });
+
+    EXPECT_EQ(visited, 5);
+}
+
+TEST(ShardedLRUCacheTest, ConcurrentReadersAndWriters)
+{
+    constexpr size_t WORKERS {8};
+    constexpr int OPERATIONS {2000};
+    ShardedLRUCache<std::string, int> cache {256};
+
+    std::vector<std::thread> workers;
+    workers.reserve(WORKERS);
+    for (size_t worker = 0; worker < WORKERS; ++worker)
+    {
+        workers.emplace_back(
+            [&cache, worker]()
+            {
+                for (int i = 0; i < OPERATIONS; ++i)
+                {
+                    const auto key {std::to_string(worker) + "-" + std::to_string(i % 100)};
+                    cache.insertKey(key, i);
+                    const auto cached {cache.getValue(key)};
+                    if (cached.has_value())
+                    {
+                        EXPECT_LE(cached.value(), i);
+                    }
+                }
+            });
+    }
+
+    for (auto& workerThread : workers)
+    {
+        workerThread.join();
+    }
+
+    // The cache must still be consistent after the concurrent churn.
+    cache.insertKey("sentinel", 1);
+    ASSERT_TRUE(cache.getValue("sentinel").has_value());
+    EXPECT_EQ(cache.getValue("sentinel").value(), 1);
+}
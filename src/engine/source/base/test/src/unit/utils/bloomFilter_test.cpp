@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include <base/utils/bloomFilter.hpp>
+
+#include <string>
+
+TEST(BloomFilterTest, NoFalseNegatives)
+{
+    base::utils::bloom::BloomFilter filter(1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        filter.insert("package-" + std::to_string(i));
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_TRUE(filter.mayContain("package-" + std::to_string(i)));
+    }
+}
+
+TEST(BloomFilterTest, LowFalsePositiveRate)
+{
+    base::utils::bloom::BloomFilter filter(1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        filter.insert("present-" + std::to_string(i));
+    }
+
+    // With 10 bits per key the false positive rate is ~1%; allow generous slack.
+    int falsePositives {0};
+    for (int i = 0; i < 10000; ++i)
+    {
+        if (filter.mayContain("absent-" + std::to_string(i)))
+        {
+            ++falsePositives;
+        }
+    }
+    EXPECT_LT(falsePositives, 500);
+}
+
+TEST(BloomFilterTest, EmptyFilterRejectsEverything)
+{
+    base::utils::bloom::BloomFilter filter(1000);
+
+    EXPECT_FALSE(filter.mayContain("anything"));
+    EXPECT_FALSE(filter.mayContain(""));
+}
+
+TEST(BloomFilterTest, ZeroExpectedElements)
+{
+    base::utils::bloom::BloomFilter filter(0);
+
+    filter.insert("key");
+    EXPECT_TRUE(filter.mayContain("key"));
+}
@@ -0,0 +1,77 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 26, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <base/utils/idGenerator.hpp>
+
+TEST(IdGeneratorTest, Format)
+{
+    const auto id {base::utils::id::generate()};
+
+    EXPECT_EQ(32, id.size());
+    EXPECT_TRUE(std::all_of(id.begin(),
+                            id.end(),
+                            [](const char c) {
+                                return ('0' <= c && c <= '9') || ('a' <= c && c <= 'f');
+                            }));
+}
+
+TEST(IdGeneratorTest, SameThreadSharesPrefix)
+{
+    const auto first {base::utils::id::generate()};
+    const auto second {base::utils::id::generate()};
+
+    EXPECT_NE(first, second);
+    // Same thread, same 64-bit prefix; only the counter half changes.
+    EXPECT_EQ(first.substr(0, 16), second.substr(0, 16));
+}
+
+TEST(IdGeneratorTest, UniqueAcrossThreads)
+{
+    constexpr auto THREADS {4};
+    constexpr auto IDS_PER_THREAD {1000};
+
+    std::vector<std::vector<std::string>> perThread(THREADS);
+    std::vector<std::thread> threads;
+
+    for (auto i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&perThread, i]()
+            {
+                perThread[i].reserve(IDS_PER_THREAD);
+                for (auto j = 0; j < IDS_PER_THREAD; ++j)
+                {
+                    perThread[i].push_back(base::utils::id::generate());
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<std::string> unique;
+    for (const auto& ids : perThread)
+    {
+        unique.insert(ids.begin(), ids.end());
+    }
+
+    EXPECT_EQ(THREADS * IDS_PER_THREAD, unique.size());
+}
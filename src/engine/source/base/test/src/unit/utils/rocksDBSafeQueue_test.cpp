@@ -150,6 +150,62 @@ TEST_F(RocksDBSafeQueueTest, CancelBlockingPop)
     t2.join();
 }
 
+TEST_F(RocksDBSafeQueueTest, GetBulkAndPopBatchedAck)
+{
+    const int ITERATION_COUNT = 100;
+    const uint64_t BULK_SIZE = 50;
+
+    for (int i = 0; i < ITERATION_COUNT; i++)
+    {
+        queue->push(std::to_string(i));
+    }
+
+    auto bulk = queue->getBulkAndPop(BULK_SIZE, std::chrono::seconds(0));
+    EXPECT_EQ(BULK_SIZE, bulk.size());
+
+    for (int i = 0; i < static_cast<int>(BULK_SIZE); i++)
+    {
+        EXPECT_EQ(std::to_string(i), bulk.front());
+        bulk.pop();
+    }
+
+    EXPECT_EQ(ITERATION_COUNT - BULK_SIZE, queue->size());
+
+    std::string ret_val {};
+    for (int i = BULK_SIZE; i < ITERATION_COUNT; i++)
+    {
+        EXPECT_TRUE(queue->pop(ret_val, false));
+        EXPECT_EQ(std::to_string(i), ret_val);
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueueTest, PendingGroupCommittedOnClose)
+{
+    const int ITERATION_COUNT = 10;
+
+    // Fewer elements than the group commit threshold: the pending batch must be
+    // committed when the queue is closed and visible after reopening.
+    for (int i = 0; i < ITERATION_COUNT; i++)
+    {
+        queue->push(std::to_string(i));
+    }
+
+    queue.reset();
+    queue = std::make_unique<base::utils::queue::SafeQueue<std::string, RocksDBQueue<std::string>>>(
+        RocksDBQueue<std::string>("test.db"));
+
+    EXPECT_EQ(static_cast<size_t>(ITERATION_COUNT), queue->size());
+
+    std::string ret_val {};
+    for (int i = 0; i < ITERATION_COUNT; i++)
+    {
+        EXPECT_TRUE(queue->pop(ret_val, false));
+        EXPECT_EQ(std::to_string(i), ret_val);
+    }
+}
+
 TEST_F(RocksDBSafeQueueTest, CreateFolderRecursively)
 {
     const std::string DATABASE_NAME {"folder1/folder2/test.db"};
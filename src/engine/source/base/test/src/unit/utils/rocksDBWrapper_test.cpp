@@ -110,6 +110,88 @@ TEST_F(RocksDBWrapperTest, TestPutExistingKeyUpdateValue)
     EXPECT_EQ(value, newValue);
 }
 
+/**
+ * @brief Tests the putBatch function
+ */
+TEST_F(RocksDBWrapperTest, TestPutBatch)
+{
+    const std::vector<std::pair<std::string, rocksdb::Slice>> keyValues {{"batchKey1", "batchValue1"},
+                                                                         {"batchKey2", "batchValue2"}};
+    EXPECT_NO_THROW(db_wrapper->putBatch(keyValues));
+
+    std::string value {};
+    EXPECT_TRUE(db_wrapper->get("batchKey1", value));
+    EXPECT_EQ(value, "batchValue1");
+    EXPECT_TRUE(db_wrapper->get("batchKey2", value));
+    EXPECT_EQ(value, "batchValue2");
+}
+
+/**
+ * @brief Tests the putBatch function with an empty batch
+ */
+TEST_F(RocksDBWrapperTest, TestPutBatchEmpty)
+{
+    EXPECT_NO_THROW(db_wrapper->putBatch({}));
+}
+
+/**
+ * @brief Tests the putBatch function with an empty key
+ */
+TEST_F(RocksDBWrapperTest, TestPutBatchEmptyKey)
+{
+    const std::vector<std::pair<std::string, rocksdb::Slice>> keyValues {{"", "batchValue1"}};
+    EXPECT_THROW(db_wrapper->putBatch(keyValues), std::invalid_argument);
+}
+
+/**
+ * @brief Tests the putBatch function with the WAL disabled
+ */
+TEST_F(RocksDBWrapperTest, TestPutBatchDisableWAL)
+{
+    const std::vector<std::pair<std::string, rocksdb::Slice>> keyValues {{"batchKey3", "batchValue3"}};
+    EXPECT_NO_THROW(db_wrapper->putBatch(keyValues, "", true));
+
+    std::string value {};
+    EXPECT_TRUE(db_wrapper->get("batchKey3", value));
+    EXPECT_EQ(value, "batchValue3");
+}
+
+/**
+ * @brief Tests building an SST file and ingesting it
+ */
+TEST_F(RocksDBWrapperTest, TestCreateAndIngestSSTFile)
+{
+    const auto sstPath {(OUTPUT_FOLDER / "snapshot.sst").string()};
+    const std::vector<std::pair<std::string, rocksdb::Slice>> keyValues {{"sstKey2", "sstValue2"},
+                                                                         {"sstKey1", "sstValue1"}};
+
+    EXPECT_NO_THROW(db_wrapper->createSSTFile(sstPath, keyValues));
+    EXPECT_NO_THROW(db_wrapper->ingestSSTFiles({sstPath}));
+
+    std::string value {};
+    EXPECT_TRUE(db_wrapper->get("sstKey1", value));
+    EXPECT_EQ(value, "sstValue1");
+    EXPECT_TRUE(db_wrapper->get("sstKey2", value));
+    EXPECT_EQ(value, "sstValue2");
+}
+
+/**
+ * @brief Tests building an SST file with no pairs
+ */
+TEST_F(RocksDBWrapperTest, TestCreateSSTFileEmpty)
+{
+    const auto sstPath {(OUTPUT_FOLDER / "empty.sst").string()};
+    EXPECT_THROW(db_wrapper->createSSTFile(sstPath, {}), std::invalid_argument);
+}
+
+/**
+ * @brief Tests ingesting with no SST files
+ */
+TEST_F(RocksDBWrapperTest, TestIngestSSTFilesEmpty)
+{
+    EXPECT_THROW(db_wrapper->ingestSSTFiles({}), std::invalid_argument);
+}
+
 /**
  * @brief Tests the get function
  */
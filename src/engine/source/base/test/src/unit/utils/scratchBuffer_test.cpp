@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <base/utils/scratchBuffer.hpp>
+
+using namespace base::utils::scratch;
+
+TEST(ScratchBufferTest, LeaseIsCleared)
+{
+    {
+        Buffer b;
+        b.str() = "some previous content";
+    }
+
+    Buffer b;
+    EXPECT_TRUE(b.str().empty());
+}
+
+TEST(ScratchBufferTest, CapacityIsReused)
+{
+    size_t grownCapacity {};
+    {
+        Buffer b;
+        b.str().assign(4096, 'x');
+        grownCapacity = b.str().capacity();
+    }
+
+    Buffer b;
+    EXPECT_GE(b.str().capacity(), grownCapacity);
+}
+
+TEST(ScratchBufferTest, NestedLeasesDoNotClobber)
+{
+    Buffer outer;
+    outer.str() = "outer";
+
+    {
+        Buffer inner;
+        inner.str() = "inner";
+        EXPECT_EQ(outer.str(), "outer");
+    }
+
+    EXPECT_EQ(outer.str(), "outer");
+}
+
+TEST(ScratchBufferTest, PerThreadPools)
+{
+    Buffer b;
+    b.str() = "main thread";
+
+    std::thread t(
+        []()
+        {
+            Buffer tb;
+            EXPECT_TRUE(tb.str().empty());
+            tb.str() = "worker thread";
+        });
+    t.join();
+
+    EXPECT_EQ(b.str(), "main thread");
+}
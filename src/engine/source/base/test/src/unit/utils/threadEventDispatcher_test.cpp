@@ -312,6 +312,91 @@ TEST_F(ThreadEventDispatcherTest, CtorNoWorkerSingleThread)
     }
 }
 
+TEST_F(ThreadEventDispatcherTest, LockFreeSingleThread)
+{
+    static const std::vector<int> MESSAGES_TO_SEND_LIST {120, 100};
+
+    for (auto MESSAGES_TO_SEND : MESSAGES_TO_SEND_LIST)
+    {
+        std::atomic<size_t> counter {0};
+        std::promise<void> promise;
+
+        LockFreeEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+            [&counter, &MESSAGES_TO_SEND, &promise](std::queue<std::string>& data)
+            {
+                counter += data.size();
+                while (!data.empty())
+                {
+                    data.pop();
+                }
+
+                if (counter == MESSAGES_TO_SEND)
+                {
+                    promise.set_value();
+                }
+            },
+            {.dbPath = TEST_DB, .bulkSize = BULK_SIZE});
+
+        for (int i = 0; i < MESSAGES_TO_SEND; ++i)
+        {
+            dispatcher.push(std::to_string(i));
+        }
+        promise.get_future().wait_for(std::chrono::seconds(10));
+        EXPECT_EQ(MESSAGES_TO_SEND, counter);
+    }
+}
+
+TEST_F(ThreadEventDispatcherTest, LockFreeMultiThreadedProducersAndConsumers)
+{
+    constexpr auto MESSAGES_PER_PRODUCER {500};
+    constexpr auto PRODUCERS {4};
+    constexpr auto MESSAGES_TO_SEND {MESSAGES_PER_PRODUCER * PRODUCERS};
+
+    std::atomic<size_t> counter {0};
+    std::promise<void> promise;
+
+    LockFreeEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        [&counter, &promise](std::queue<std::string>& data)
+        {
+            counter += data.size();
+            while (!data.empty())
+            {
+                data.pop();
+            }
+
+            if (counter == MESSAGES_TO_SEND)
+            {
+                promise.set_value();
+            }
+        },
+        {.dbPath = TEST_DB,
+         .bulkSize = BULK_SIZE,
+         .maxQueueSize = UNLIMITED_QUEUE_SIZE,
+         .dispatcherType = ThreadEventDispatcherType::MULTI_THREADED_UNORDERED});
+
+    std::vector<std::thread> producers;
+    producers.reserve(PRODUCERS);
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back(
+            [&dispatcher, p]()
+            {
+                for (int i = 0; i < MESSAGES_PER_PRODUCER; ++i)
+                {
+                    dispatcher.push(std::to_string(p * MESSAGES_PER_PRODUCER + i));
+                }
+            });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    EXPECT_EQ(MESSAGES_TO_SEND, counter);
+}
+
 TEST_F(ThreadEventDispatcherTest, CtorPopFeatureSingleThread)
 {
     constexpr auto MESSAGES_TO_SEND {1000};
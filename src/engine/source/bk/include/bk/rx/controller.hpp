@@ -1,13 +1,17 @@
 #ifndef _BK_RX_CONTROLLER_HPP
 #define _BK_RX_CONTROLLER_HPP
 
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 
 #include <rxcpp/rx.hpp>
 
+#include <base/compiledExpression.hpp>
 #include <base/expression.hpp>
+#include <bk/batchExec.hpp>
 #include <bk/icontroller.hpp>
 
 #include <base/baseTypes.hpp>
@@ -33,6 +37,39 @@ private:
     std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
     std::unordered_set<std::string> m_traceables;                          ///< Traceables
     base::Expression m_expression;                                         ///< Expression
+    std::shared_ptr<Profiler> m_profiler;                                  ///< Execution profiler
+    std::shared_ptr<BatchExec> m_batch;                                    ///< Node-at-a-time bundle executor
+    std::function<void()> m_endCallback;                                   ///< End callback, batch path
+
+    /// Flattened program of the expression, set when the compiled fast path is enabled
+    std::optional<base::eval::CompiledExpression> m_compiled {};
+    /// Events evaluated through the compiled program since its last recompilation
+    std::size_t m_fastPathEvents {0};
+    /// Live trace subscriptions across every traceable; the fast path skips trace
+    /// publication entirely, so it only runs while this is zero
+    std::atomic<std::size_t> m_traceSinks {0};
+
+    /// Events between hit-rate recompilations of the compiled program
+    static constexpr std::size_t REORDER_INTERVAL = 1 << 16;
+
+    /// Periodically recompile the program so pinned Or nodes scan their hottest
+    /// branches first; a no-op when the program counts no branches
+    void maybeReorder()
+    {
+        if (!m_compiled->countsBranchHits() || ++m_fastPathEvents < REORDER_INTERVAL)
+        {
+            return;
+        }
+        m_fastPathEvents = 0;
+        m_compiled = base::eval::CompiledExpression::compile(m_expression, m_compiled->hitOrders());
+    }
+
+    /// True while the compiled program can replace the rx chain: traces and profiler
+    /// samples are the only observable difference, so both must be off
+    bool fastPathActive() const
+    {
+        return m_compiled.has_value() && m_traceSinks.load(std::memory_order_relaxed) == 0 && !m_profiler->enabled();
+    }
 
     rxcpp::subjects::subject<RxEvent> m_policySubject;
     rxcpp::subscriber<RxEvent> m_policyInput;
@@ -50,10 +87,13 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param compiledEval compile the expression and evaluate events through the
+     * flattened program while no traces are subscribed and the profiler is off
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()>& endCallback = nullptr);
+               const std::function<void()>& endCallback = nullptr,
+               bool compiledEval = false);
 
     /**
      * @copydoc bk::IController::ingest
@@ -62,6 +102,17 @@ public:
     {
         if (m_policyInput.is_subscribed())
         {
+            base::event::advancePipelineEpoch();
+            if (fastPathActive())
+            {
+                (*m_compiled)(event);
+                maybeReorder();
+                if (m_endCallback != nullptr)
+                {
+                    m_endCallback();
+                }
+                return;
+            }
             RxEvent rxEvent =
                 std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
             m_policyInput.on_next(rxEvent);
@@ -75,6 +126,16 @@ public:
     {
         if (m_policyInput.is_subscribed())
         {
+            if (fastPathActive())
+            {
+                (*m_compiled)(event);
+                maybeReorder();
+                if (m_endCallback != nullptr)
+                {
+                    m_endCallback();
+                }
+                return std::move(event);
+            }
             RxEvent rxEvent =
                 std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
             m_policyInput.on_next(rxEvent);
@@ -84,6 +145,21 @@ public:
         return event;
     };
 
+    /**
+     * @copydoc bk::IController::ingestBatch
+     */
+    void ingestBatch(std::vector<base::Event>& events) override
+    {
+        m_batch->ingest(events);
+        if (m_endCallback != nullptr)
+        {
+            for (std::size_t i = 0; i < events.size(); ++i)
+            {
+                m_endCallback();
+            }
+        }
+    }
+
     /**
      * @copydoc bk::IController::start
      */
@@ -129,11 +205,31 @@ public:
      * @copydoc bk::IController::unsubscribeAll
      */
     void unsubscribeAll() override;
+
+    /**
+     * @copydoc bk::IController::profiler
+     */
+    const std::shared_ptr<Profiler>& profiler() const override { return m_profiler; }
 };
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    bool m_compiledEval; ///< Evaluate events through the compiled fast path
+
 public:
+    /**
+     * @brief Construct a maker for rx controllers.
+     *
+     * @param compiledEval When enabled, controllers evaluate events through a
+     * flattened compiled program while no traces are subscribed and the profiler
+     * is off, skipping the per-node rx dispatch.
+     */
+    explicit ControllerMaker(bool compiledEval = false)
+        : m_compiledEval {compiledEval}
+    {
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -141,7 +237,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_compiledEval);
     }
 };
 
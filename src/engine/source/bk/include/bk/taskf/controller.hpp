@@ -8,6 +8,7 @@
 #include <taskflow/taskflow.hpp>
 
 #include <base/expression.hpp>
+#include <bk/batchExec.hpp>
 #include <bk/icontroller.hpp>
 
 namespace bk::taskf
@@ -21,6 +22,9 @@ private:
     std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
     std::unordered_set<std::string> m_traceables;                          ///< Traceables
     base::Expression m_expression;                                         ///< Expression
+    std::shared_ptr<Profiler> m_profiler;                                  ///< Execution profiler
+    std::shared_ptr<BatchExec> m_batch;                                    ///< Node-at-a-time bundle executor
+    std::function<void()> m_endCallback;                                   ///< End callback, batch path
 
     tf::Taskflow m_tf;       ///< Taskflow
     tf::Executor m_executor; ///< Executor
@@ -39,16 +43,22 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param workers number of executor workers. With more than one worker the
+     * taskflow work-stealing scheduler runs independent branches of the graph
+     * concurrently; the expression must not have branches that mutate the same
+     * event fields for this to be safe.
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()> endCallback = nullptr);
+               const std::function<void()> endCallback = nullptr,
+               std::size_t workers = 1);
 
     /**
      * @copydoc bk::IController::ingest
      */
     void ingest(base::Event&& event) override
     {
+        base::event::advancePipelineEpoch();
         m_event = std::move(event);
         m_executor.run(m_tf).wait();
     }
@@ -62,6 +72,21 @@ public:
         return std::move(m_event);
     };
 
+    /**
+     * @copydoc bk::IController::ingestBatch
+     */
+    void ingestBatch(std::vector<base::Event>& events) override
+    {
+        m_batch->ingest(events);
+        if (m_endCallback != nullptr)
+        {
+            for (std::size_t i = 0; i < events.size(); ++i)
+            {
+                m_endCallback();
+            }
+        }
+    }
+
     /**
      * @copydoc bk::IController::start
      */
@@ -101,11 +126,31 @@ public:
      * @copydoc bk::IController::unsubscribeAll
      */
     void unsubscribeAll() override;
+
+    /**
+     * @copydoc bk::IController::profiler
+     */
+    const std::shared_ptr<Profiler>& profiler() const override { return m_profiler; }
 };
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    std::size_t m_workers; ///< Executor workers for each created controller
+
 public:
+    /**
+     * @brief Construct a new Controller Maker
+     *
+     * @param workers number of executor workers per controller. More than one
+     * enables the taskflow work-stealing scheduler across independent graph
+     * branches.
+     */
+    explicit ControllerMaker(std::size_t workers = 1)
+        : m_workers {workers}
+    {
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -113,7 +158,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_workers);
     }
 };
 
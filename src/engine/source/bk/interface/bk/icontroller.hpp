@@ -5,15 +5,20 @@
 #include <memory>
 #include <string_view>
 #include <unordered_set>
+#include <vector>
 
 #include <base/baseTypes.hpp>
 #include <base/error.hpp>
 #include <base/expression.hpp>
 
+#include <bk/profiler.hpp>
+
 namespace bk
 {
 
-using Subscriber = std::function<void(const std::string&, bool)>; ///< Suscriber type for traces and result
+// Traces are delivered as views into the pre-formatted buffers owned by the
+// expression, valid only for the duration of the call; subscribers copy what they keep.
+using Subscriber = std::function<void(std::string_view, bool)>; ///< Suscriber type for traces and result
 using Subscription = std::size_t;                                 ///< Identifier of the subscription.
 
 /**
@@ -45,6 +50,26 @@ public:
      */
     virtual base::Event ingestGet(base::Event&& event) = 0;
 
+    /**
+     * @brief Ingest a bundle of events in place.
+     *
+     * The base implementation forwards the bundle one event at a time. Backends may
+     * override it with a node-at-a-time walk (see BatchExec) that runs each expression
+     * node over the whole bundle before moving to the next node, amortizing the
+     * indirect call and instruction working set of every node across the bundle at
+     * the cost of per-event latency.
+     *
+     * @param events The bundle to ingest, replaced by the processed events.
+     * @note this method is not thread-safe and its blocking.
+     */
+    virtual void ingestBatch(std::vector<base::Event>& events)
+    {
+        for (auto& event : events)
+        {
+            event = ingestGet(std::move(event));
+        }
+    }
+
     /**
      * @brief Check if the backend is available to ingest data. i.e. if the backend is started and built correctly.
      *
@@ -103,6 +128,16 @@ public:
      *
      */
     virtual void unsubscribeAll() = 0;
+
+    /**
+     * @brief Get the execution profiler of the backend.
+     *
+     * The profiler collects per-expression cumulative time and hit counts while enabled.
+     * It is disabled by default.
+     *
+     * @return const std::shared_ptr<Profiler>& The profiler, never null.
+     */
+    virtual const std::shared_ptr<Profiler>& profiler() const = 0;
 };
 
 /**
@@ -0,0 +1,168 @@
+#ifndef _BK_PROFILER_HPP
+#define _BK_PROFILER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace bk
+{
+
+/**
+ * @brief Cumulative per-expression execution cost collector.
+ *
+ * Each term of the backend graph registers a slot while the graph is built, and the
+ * backends record the hit count and cumulative wall time of every term execution into
+ * that slot. Slots are cache-line aligned and written with relaxed atomics, so recording
+ * costs two relaxed adds and a clock read on the hot path; while the profiler is
+ * disabled (the default) a term only pays a relaxed load.
+ *
+ * The collected table points at the expression names of the policy graph, so the cost of
+ * a decoder, rule or single helper can be read directly from the report.
+ */
+class Profiler
+{
+public:
+    /**
+     * @brief Snapshot of a slot.
+     */
+    struct Sample
+    {
+        std::string name;   ///< Name of the expression
+        uint64_t hits;      ///< Number of executions recorded
+        uint64_t elapsedNs; ///< Cumulative execution time in nanoseconds
+    };
+
+private:
+    /**
+     * @brief Cache-line sized accumulator written with relaxed atomics on the hot path.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> elapsedNs {0};
+    };
+
+    std::vector<std::string> m_names; ///< Slot index -> expression name
+    std::deque<Slot> m_slots;         ///< Slots, deque so growth does not relocate them
+    std::atomic<bool> m_enabled {false};
+
+public:
+    /**
+     * @brief Register a slot for an expression. Only valid while the graph is built,
+     * before events are ingested.
+     *
+     * @param name Name of the expression.
+     * @return std::size_t Index of the slot.
+     */
+    std::size_t addSlot(const std::string& name)
+    {
+        m_names.emplace_back(name);
+        m_slots.emplace_back();
+        return m_slots.size() - 1;
+    }
+
+    /**
+     * @brief Current monotonic timestamp in nanoseconds.
+     */
+    static uint64_t now()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    /**
+     * @brief Whether the profiler is collecting.
+     */
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Start collecting.
+     */
+    void enable() { m_enabled.store(true, std::memory_order_relaxed); }
+
+    /**
+     * @brief Stop collecting. Already collected samples are kept.
+     */
+    void disable() { m_enabled.store(false, std::memory_order_relaxed); }
+
+    /**
+     * @brief Record one execution of the expression owning \p slot.
+     *
+     * @param slot Slot index returned by addSlot.
+     * @param elapsedNs Execution time in nanoseconds.
+     */
+    void record(std::size_t slot, uint64_t elapsedNs)
+    {
+        auto& entry = m_slots[slot];
+        entry.hits.fetch_add(1, std::memory_order_relaxed);
+        entry.elapsedNs.fetch_add(elapsedNs, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Clear all collected samples.
+     */
+    void reset()
+    {
+        for (auto& slot : m_slots)
+        {
+            slot.hits.store(0, std::memory_order_relaxed);
+            slot.elapsedNs.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Snapshot of the slots with at least one hit, sorted by cumulative time
+     * descending.
+     */
+    std::vector<Sample> samples() const
+    {
+        std::vector<Sample> result;
+        for (std::size_t i = 0; i < m_slots.size(); ++i)
+        {
+            const auto hits = m_slots[i].hits.load(std::memory_order_relaxed);
+            if (hits > 0)
+            {
+                result.push_back(Sample {m_names[i], hits, m_slots[i].elapsedNs.load(std::memory_order_relaxed)});
+            }
+        }
+
+        std::sort(result.begin(),
+                  result.end(),
+                  [](const Sample& lhs, const Sample& rhs) { return lhs.elapsedNs > rhs.elapsedNs; });
+
+        return result;
+    }
+
+    /**
+     * @brief Cost table of the collected samples, sorted by cumulative time descending.
+     *
+     * @return std::string One line per expression with cumulative time, hits and average.
+     */
+    std::string report() const
+    {
+        auto sorted = samples();
+        std::string table = fmt::format("{:>14} {:>12} {:>12}  {}\n", "total_us", "hits", "avg_us", "expression");
+        for (const auto& sample : sorted)
+        {
+            table += fmt::format("{:>14.1f} {:>12} {:>12.1f}  {}\n",
+                                 static_cast<double>(sample.elapsedNs) / 1000.0,
+                                 sample.hits,
+                                 static_cast<double>(sample.elapsedNs) / 1000.0 / static_cast<double>(sample.hits),
+                                 sample.name);
+        }
+
+        return table;
+    }
+};
+
+} // namespace bk
+
+#endif // _BK_PROFILER_HPP
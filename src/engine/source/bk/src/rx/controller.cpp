@@ -11,14 +11,21 @@ class Controller::TracerImpl final : public detail::Tracer
 
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()>& endCallback)
+                       const std::function<void()>& endCallback,
+                       const bool compiledEval)
     : m_traceables {traceables}
     , m_expression {expression}
+    , m_profiler {std::make_shared<Profiler>()}
     , m_policyInput {m_policySubject.get_subscriber()}
 {
+    if (compiledEval)
+    {
+        m_compiled = base::eval::CompiledExpression::compile(expression);
+    }
+
     detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    m_policyOutput = builder.build(expression, traces, m_traceables, m_policySubject.get_observable());
+    m_policyOutput = builder.build(expression, traces, m_traceables, m_policySubject.get_observable(), m_profiler);
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
@@ -31,6 +38,16 @@ Controller::Controller(const base::Expression& expression,
     {
         m_policyOutput.subscribe();
     }
+
+    // Batch path: same expression and profiler, publishing through the same tracers
+    m_endCallback = endCallback;
+    m_batch = std::make_shared<BatchExec>(expression,
+                                          m_profiler,
+                                          [this](const std::string& name) -> Subscriber
+                                          {
+                                              auto it = m_traces.find(name);
+                                              return it != m_traces.end() ? it->second->publisher() : nullptr;
+                                          });
 }
 
 base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
@@ -41,7 +58,13 @@ base::RespOrError<Subscription> Controller::subscribe(const std::string& traceab
         return base::Error {"Traceable not found"};
     }
 
-    return it->second->subscribe(subscriber);
+    auto subscription = it->second->subscribe(subscriber);
+    if (!base::isError(subscription))
+    {
+        // The compiled fast path skips trace publication, disable it while any sink is live
+        m_traceSinks.fetch_add(1, std::memory_order_relaxed);
+    }
+    return subscription;
 }
 
 void Controller::unsubscribe(const std::string& traceable, Subscription subscription)
@@ -52,7 +75,10 @@ void Controller::unsubscribe(const std::string& traceable, Subscription subscrip
         return;
     }
 
-    it->second->unsubscribe(subscription);
+    if (it->second->unsubscribe(subscription))
+    {
+        m_traceSinks.fetch_sub(1, std::memory_order_relaxed);
+    }
 }
 
 void Controller::unsubscribeAll()
@@ -61,6 +87,7 @@ void Controller::unsubscribeAll()
     {
         trace->unsubscribeAll();
     }
+    m_traceSinks.store(0, std::memory_order_relaxed);
 }
 
 } // namespace bk::rx
@@ -6,6 +6,7 @@
 
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
+#include <bk/profiler.hpp>
 
 #include "tracer.hpp"
 
@@ -23,6 +24,7 @@ private:
         Publisher publisher;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
+        const std::shared_ptr<Profiler>& profiler;
     };
 
     Observable recBuild(const Observable& input, const base::Expression& expression, BuildParams& params)
@@ -124,13 +126,28 @@ private:
         {
             auto term = expression->getPtr<base::Term<base::EngineOp>>();
             return input.map(
-                [op = term->getFn(), tracer = params.publisher](RxEvent result)
+                [op = term->getFn(),
+                 tracer = params.publisher,
+                 profiler = params.profiler,
+                 slot = params.profiler->addSlot(expression->getName())](RxEvent result)
                 {
+                    uint64_t profStart = 0;
+                    if (profiler->enabled())
+                    {
+                        profStart = Profiler::now();
+                    }
+
                     *result = op(result->payload());
+
+                    if (profStart != 0)
+                    {
+                        profiler->record(slot, Profiler::now() - profStart);
+                    }
+
                     // TODO: should we allow to not include tracer?
                     if (tracer != nullptr)
                     {
-                        tracer(std::string {result->trace()}, result->success());
+                        tracer(result->trace(), result->success());
                     }
                     return result;
                 });
@@ -148,9 +165,10 @@ public:
     Observable build(const base::Expression& expression,
                      std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
                      const std::unordered_set<std::string>& traceables,
-                     const Observable& input)
+                     const Observable& input,
+                     const std::shared_ptr<Profiler>& profiler)
     {
-        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables};
+        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables, .profiler = profiler};
         auto output = recBuild(input, expression, params);
 
         return output;
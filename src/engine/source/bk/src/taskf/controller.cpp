@@ -1,5 +1,7 @@
 #include "controller.hpp"
 
+#include <algorithm>
+
 #include "exprBuilder.hpp"
 #include "tracer.hpp"
 namespace bk::taskf
@@ -11,20 +13,32 @@ class Controller::TracerImpl final : public detail::Tracer
 
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()> endCallback)
+                       const std::function<void()> endCallback,
+                       std::size_t workers)
     : m_tf()
-    , m_executor(1)
+    , m_executor(std::max<std::size_t>(1, workers))
     , m_event()
     , m_traceables(traceables)
     , m_expression(expression)
+    , m_profiler(std::make_shared<Profiler>())
 {
     detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
+    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, m_profiler, endCallback);
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
     }
+
+    // Batch path: same expression and profiler, publishing through the same tracers
+    m_endCallback = endCallback;
+    m_batch = std::make_shared<BatchExec>(m_expression,
+                                          m_profiler,
+                                          [this](const std::string& name) -> Subscriber
+                                          {
+                                              auto it = m_traces.find(name);
+                                              return it != m_traces.end() ? it->second->publisher() : nullptr;
+                                          });
 }
 
 base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
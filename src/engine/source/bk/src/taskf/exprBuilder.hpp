@@ -8,6 +8,7 @@
 
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
+#include <bk/profiler.hpp>
 
 #include "tracer.hpp"
 
@@ -52,15 +53,24 @@ private:
     Publisher m_publisher;
     void* m_data;
     tf::Taskflow& m_tf;
+    std::shared_ptr<Profiler> m_profiler;
+    std::size_t m_profSlot;
 
 public:
-    TaskTerm(base::EngineOp op, const std::string& name, Publisher publisher, void* data, tf::Taskflow& tf)
+    TaskTerm(base::EngineOp op,
+             const std::string& name,
+             Publisher publisher,
+             void* data,
+             tf::Taskflow& tf,
+             const std::shared_ptr<Profiler>& profiler)
         : ITask()
         , m_op(op)
         , m_publisher(publisher)
         , m_data(data)
         , m_tf(tf)
         , m_task(tf.placeholder().name(name))
+        , m_profiler(profiler)
+        , m_profSlot(profiler->addSlot(name))
     {
     }
 
@@ -70,10 +80,22 @@ public:
     {
         assertConnect();
         m_task.work(
-            [fn = m_op, publisher = m_publisher, data = m_data]()
+            [fn = m_op, publisher = m_publisher, data = m_data, profiler = m_profiler, slot = m_profSlot]()
             {
                 auto& event = *static_cast<base::Event*>(data);
+                uint64_t profStart = 0;
+                if (profiler->enabled())
+                {
+                    profStart = Profiler::now();
+                }
+
                 auto res = fn(event);
+
+                if (profStart != 0)
+                {
+                    profiler->record(slot, Profiler::now() - profStart);
+                }
+
                 if (publisher)
                 {
                     publisher(res.trace(), res.success());
@@ -276,12 +298,13 @@ private:
         void* data;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
+        const std::shared_ptr<Profiler>& profiler;
     };
 
     ComplexTask buildTerm(const base::Term<base::EngineOp>& term, BuildParams& params)
     {
-        auto taskTerm =
-            std::make_shared<TaskTerm>(term.getFn(), term.getName(), params.publisher, params.data, params.tf);
+        auto taskTerm = std::make_shared<TaskTerm>(
+            term.getFn(), term.getName(), params.publisher, params.data, params.tf, params.profiler);
         return taskTerm;
     }
 
@@ -416,9 +439,15 @@ public:
                void* data,
                std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
                const std::unordered_set<std::string>& traceables,
+               const std::shared_ptr<Profiler>& profiler,
                std::function<void()> endCallback = nullptr)
     {
-        BuildParams params {.tf = tf, .publisher = nullptr, .data = data, .traces = traces, .traceables = traceables};
+        BuildParams params {.tf = tf,
+                            .publisher = nullptr,
+                            .data = data,
+                            .traces = traces,
+                            .traceables = traceables,
+                            .profiler = profiler};
         // As complex task are not finished until output is connected we need to force the connection
         auto finalTask = recBuild(expression, params);
         auto output = tf.placeholder().name("output");
@@ -1,6 +1,7 @@
 #ifndef _BK_TASKF_TRACER_HPP
 #define _BK_TASKF_TRACER_HPP
 
+#include <atomic>
 #include <memory>
 #include <shared_mutex>
 #include <string>
@@ -22,7 +23,8 @@ private:
     Subscription m_nextSubId {0};                      ///< Next subscription id
     Subscription nextSubId() { return m_nextSubId++; } ///< Get the next subscription id
 
-    std::shared_mutex m_subscribersMutex; ///< Mutex for the subscribers
+    std::shared_mutex m_subscribersMutex;         ///< Mutex for the subscribers
+    std::atomic<std::size_t> m_subscriberCnt {0}; ///< Subscriber count, gates publication without locking
 
 public:
     virtual ~Tracer() = default;
@@ -50,6 +52,7 @@ public:
         }
 
         m_subscribers.emplace(id, subscriber);
+        m_subscriberCnt.store(m_subscribers.size(), std::memory_order_relaxed);
         return id;
     }
 
@@ -62,6 +65,7 @@ public:
     {
         std::unique_lock lock {m_subscribersMutex};
         m_subscribers.erase(subscription);
+        m_subscriberCnt.store(m_subscribers.size(), std::memory_order_relaxed);
     }
 
     /**
@@ -69,9 +73,15 @@ public:
      */
     Publisher publisher()
     {
-        return [thisPtr = this->weak_from_this()](const std::string& message, bool success)
+        return [thisPtr = this->weak_from_this()](std::string_view message, bool success)
         {
             auto thisShared = thisPtr.lock();
+            // Fast path when no sink is attached: skip the lock and the delivery
+            if (!thisShared || thisShared->m_subscriberCnt.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
             std::shared_lock lock {thisShared->m_subscribersMutex};
             for (const auto& [_, subscriber] : thisShared->m_subscribers)
             {
@@ -88,6 +98,7 @@ public:
     {
         std::unique_lock lock {m_subscribersMutex};
         m_subscribers.clear();
+        m_subscriberCnt.store(0, std::memory_order_relaxed);
     }
 };
 
@@ -12,6 +12,7 @@ class MockController : public IController
 public:
     MOCK_METHOD(void, ingest, (base::Event &&), (override));
     MOCK_METHOD(base::Event, ingestGet, (base::Event &&), (override));
+    MOCK_METHOD(void, ingestBatch, (std::vector<base::Event>&), (override));
     MOCK_METHOD(bool, isAviable, (), (const, override));
     MOCK_METHOD(void, start, (), (override));
     MOCK_METHOD(void, stop, (), (override));
@@ -20,6 +21,7 @@ public:
     MOCK_METHOD(base::RespOrError<Subscription>, subscribe, (const std::string&, const Subscriber&), (override));
     MOCK_METHOD(void, unsubscribe, (const std::string&, Subscription), (override));
     MOCK_METHOD(void, unsubscribeAll, (), (override));
+    MOCK_METHOD(const std::shared_ptr<Profiler>&, profiler, (), (const, override));
 };
 
 class MockMakerController : public IControllerMaker
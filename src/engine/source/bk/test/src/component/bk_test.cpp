@@ -61,6 +61,40 @@ inline void buildIngestTest(const base::Expression& expression, const Path& expe
     expected.check(event);
 }
 
+inline void buildIngestCompiledTest(const base::Expression& expression, const Path& expected)
+{
+    auto counter = 0;
+    bk::rx::Controller controller(expression, {}, [&]() { ++counter; }, true);
+    auto event = std::make_shared<json::Json>();
+    ASSERT_NO_THROW(event = controller.ingestGet(std::move(event)));
+
+    ASSERT_EQ(counter, 1) << "Only one event was sent but the end callback received more than one event";
+
+    expected.check(event);
+}
+
+template<typename BackEnd>
+inline void buildIngestBatchTest(const base::Expression& expression, const Path& expected)
+{
+    auto counter = 0;
+    auto controller = BackEnd(expression, {}, [&]() { ++counter; });
+
+    std::vector<base::Event> bundle;
+    for (auto i = 0; i < 3; ++i)
+    {
+        bundle.emplace_back(std::make_shared<json::Json>());
+    }
+    ASSERT_NO_THROW(controller.ingestBatch(bundle));
+
+    ASSERT_EQ(counter, 3) << "The end callback was not called once per event of the bundle";
+
+    // Every event of the bundle must match the per-event result
+    for (auto& event : bundle)
+    {
+        expected.check(event);
+    }
+}
+
 TEST_P(PipelineTest, TfProcessEvent)
 {
     auto [name, expression, expectedPath] = GetParam();
@@ -85,6 +119,28 @@ TEST_P(PipelineTest, RxProcessTraces)
     GTEST_SKIP(); // TODO
 }
 
+// The compiled fast path must be observationally equal to the rx chain
+TEST_P(PipelineTest, RxProcessEventCompiled)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestCompiledTest(testExpression, expectedPath);
+}
+
+TEST_P(PipelineTest, TfProcessEventBatch)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestBatchTest<bk::taskf::Controller>(testExpression, expectedPath);
+}
+
+TEST_P(PipelineTest, RxProcessEventBatch)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestBatchTest<bk::rx::Controller>(testExpression, expectedPath);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     BK,
     PipelineTest,
@@ -879,6 +935,27 @@ void subscribeTraceableNotFoundTest()
     s.checkTraceActivation(c, {});
 }
 
+template<typename Controller>
+void subscribeBatchTest()
+{
+    Controller c(EasyExp::term("term", true), {"term"});
+    Subscriber<Controller> s;
+    auto subRes = c.subscribe("term", s.getSubscriber());
+    ASSERT_FALSE(base::isError(subRes)) << "Error subscribing: " << base::getError(subRes).message;
+
+    std::vector<base::Event> bundle;
+    bundle.emplace_back(std::make_shared<json::Json>());
+    bundle.emplace_back(std::make_shared<json::Json>());
+    ASSERT_NO_THROW(c.ingestBatch(bundle));
+    ASSERT_EQ(s.traces, (std::vector<std::string> {SUCCES_TRACE, SUCCES_TRACE}));
+}
+
+TEST(BKTraceTest, SubscribeBatch)
+{
+    subscribeBatchTest<bk::taskf::Controller>();
+    subscribeBatchTest<bk::rx::Controller>();
+}
+
 TEST(BKTraceTest, SubscribeTraceableNotFound)
 {
     subscribeTraceableNotFoundTest<bk::taskf::Controller>();
@@ -2,7 +2,7 @@
 #define BUILDER_ALLOWEDFIELDS_HPP
 
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -15,7 +15,11 @@ namespace builder
 class AllowedFields final : public IAllowedFields
 {
 private:
-    std::unordered_map<base::Name, std::unordered_set<DotPath>> m_fields; ///< Map of asset types to allowed fields.
+    /// Allowed fields per asset type, as given in the definition. Used to compile checkers.
+    std::unordered_map<base::Name, std::vector<DotPath>> m_fields;
+    /// Allowed fields per asset type, as a bitset over the interned DotPath ids, so a
+    /// check is a bit test instead of a set probe.
+    std::unordered_map<base::Name, std::vector<bool>> m_masks;
 
 public:
     AllowedFields() = default;
@@ -32,6 +36,12 @@ public:
      * @copydoc IAllowedFields::check
      */
     bool check(const base::Name& assetType, const DotPath& field) const override;
+
+    /**
+     * @copydoc IAllowedFields::childChecker
+     */
+    std::function<bool(std::string_view)> childChecker(const base::Name& assetType,
+                                                       const DotPath& parent) const override;
 };
 } // namespace builder
 
@@ -2,6 +2,9 @@
 #define _BUILDER2_BUILDER_HPP
 
 #include <memory>
+#include <mutex>
+
+#include <base/lruCache.hpp>
 
 #include <defs/idefinitions.hpp>
 #include <geo/imanager.hpp>
@@ -44,6 +47,12 @@ private:
 
     std::shared_ptr<Registry> m_registry; ///< builders registry
 
+    /// Built policies keyed by name, content hash and build flags. A policy
+    /// whose hash is unchanged is reused instead of being rebuilt, so N
+    /// workers starting against the same policy pay a single build.
+    mutable LRUCache<std::string, std::shared_ptr<IPolicy>> m_policyCache {8};
+    mutable std::mutex m_policyCacheMutex; ///< Protects m_policyCache
+
 public:
     Builder() = default;
     ~Builder() = default;
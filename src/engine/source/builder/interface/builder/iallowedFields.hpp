@@ -1,6 +1,9 @@
 #ifndef _BUILDER_IALLOWEDFIELDS_HPP
 #define _BUILDER_IALLOWEDFIELDS_HPP
 
+#include <functional>
+#include <string_view>
+
 #include <base/dotPath.hpp>
 #include <base/name.hpp>
 
@@ -24,6 +27,23 @@ public:
      * @return true if the field is allowed to be modified, false otherwise.
      */
     virtual bool check(const base::Name& assetType, const DotPath& field) const = 0;
+
+    /**
+     * @brief Compile the check for the fields nested under a parent into a predicate
+     * over the dot path relative to the parent.
+     *
+     * Resolved once at asset build time, so the per-event validation of dynamic
+     * subfields neither hashes nor appends dot paths. An empty function means the
+     * asset type has no restrictions and the caller can skip the per-field loop
+     * entirely.
+     *
+     * @param assetType The asset type.
+     * @param parent The parent field the candidates are nested under.
+     * @return std::function<bool(std::string_view)> Predicate over the candidate path
+     * below the parent, or an empty function when unrestricted.
+     */
+    virtual std::function<bool(std::string_view)> childChecker(const base::Name& assetType,
+                                                               const DotPath& parent) const = 0;
 };
 } // namespace builder
 
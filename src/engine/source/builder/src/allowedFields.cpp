@@ -1,5 +1,7 @@
 #include <builder/allowedFields.hpp>
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 #include "syntax.hpp"
@@ -48,16 +50,30 @@ AllowedFields::AllowedFields(const json::Json& definition)
                     fmt::format("Allowed field '{}' for asset '{}' must be a string", field.str(), key)};
             }
 
-            m_fields[key].insert(field.getString().value());
+            m_fields[key].emplace_back(field.getString().value());
+        }
+    }
+
+    // Compile each set into a bitset over the interned DotPath ids
+    for (const auto& [assetType, fields] : m_fields)
+    {
+        auto& mask = m_masks[assetType];
+        for (const auto& field : fields)
+        {
+            if (field.id() >= mask.size())
+            {
+                mask.resize(field.id() + 1, false);
+            }
+            mask[field.id()] = true;
         }
     }
 }
 
 bool AllowedFields::check(const base::Name& assetType, const DotPath& field) const
 {
-    auto it = m_fields.find(assetType);
+    auto it = m_masks.find(assetType);
     // No restrictions for this asset type
-    if (it == m_fields.end())
+    if (it == m_masks.end())
     {
         return true;
     }
@@ -68,11 +84,36 @@ bool AllowedFields::check(const base::Name& assetType, const DotPath& field) con
         return true;
     }
 
-    if (it->second.find(field) == it->second.end())
+    // Equal paths share one interned id, so membership is a bit test
+    return field.id() < it->second.size() && it->second[field.id()];
+}
+
+std::function<bool(std::string_view)> AllowedFields::childChecker(const base::Name& assetType,
+                                                                  const DotPath& parent) const
+{
+    auto it = m_fields.find(assetType);
+    // No restrictions for this asset type, the caller can skip its per-field checks
+    if (it == m_fields.end())
     {
-        return false;
+        return {};
     }
 
-    return true;
+    // Keep the part below the parent of every allowed field nested under it
+    const auto prefix = parent.isRoot() ? std::string {} : parent.str() + ".";
+    std::vector<std::string> allowed;
+    for (const auto& field : it->second)
+    {
+        const auto& path = field.str();
+        if (path.size() > prefix.size() && path.compare(0, prefix.size(), prefix) == 0)
+        {
+            allowed.emplace_back(path.substr(prefix.size()));
+        }
+    }
+    std::sort(allowed.begin(), allowed.end());
+
+    return [allowed = std::move(allowed)](std::string_view field)
+    {
+        return std::binary_search(allowed.begin(), allowed.end(), field);
+    };
 }
 } // namespace builder
@@ -11,6 +11,7 @@
 #include "policy/policy.hpp"
 #include "register.hpp"
 #include "registry.hpp"
+#include "syntax.hpp"
 
 namespace builder
 {
@@ -64,7 +65,28 @@ std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name, bool trace
         throw std::runtime_error(base::getError(policyDoc).message);
     }
 
-    auto policy = std::make_shared<policy::Policy>(base::getResponse<store::Doc>(policyDoc),
+    const auto& doc = base::getResponse<store::Doc>(policyDoc);
+
+    // The policy document carries a content hash covering its assets; a
+    // cached build with the same hash and flags is still valid, so reuse it.
+    // Sharing a build means every worker runs the same op closures, so any
+    // mutable state an op captures must be thread-safe (e.g. the geo locator
+    // guards its lookup cache and the file output writer serializes its
+    // buffer); the graph structure itself is never mutated.
+    std::string cacheKey;
+    const auto hash = doc.getString(syntax::policy::PATH_HASH);
+    if (hash)
+    {
+        cacheKey = fmt::format("{}:{}:{}{}", name.fullName(), hash.value(), trace ? "t" : "", sandbox ? "s" : "");
+        std::lock_guard lock {m_policyCacheMutex};
+        auto cached = m_policyCache.getValue(cacheKey);
+        if (cached)
+        {
+            return cached.value();
+        }
+    }
+
+    auto policy = std::make_shared<policy::Policy>(doc,
                                                    m_storeRead,
                                                    m_definitionsBuilder,
                                                    m_registry,
@@ -73,6 +95,16 @@ std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name, bool trace
                                                    trace,
                                                    sandbox);
 
+    if (!cacheKey.empty())
+    {
+        std::lock_guard lock {m_policyCacheMutex};
+        m_policyCache.insertKey(cacheKey, policy);
+    }
+
+    // The asset documents decoded during the build are no longer needed once the
+    // expression graph exists, release them so only the compiled policy stays resident.
+    m_storeRead->flushDocCache();
+
     return policy;
 }
 
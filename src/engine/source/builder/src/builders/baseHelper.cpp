@@ -360,7 +360,7 @@ baseHelperBuilder(const json::Json& definition, const std::shared_ptr<const IBui
         }
         else
         {
-            auto resParse = parsers::getHelperParser(true)(strValue, 0);
+            auto resParse = parsers::parseHelperExpression(strValue);
             if (!resParse.success())
             {
                 throw std::runtime_error(fmt::format("Failed to parse helper definition '{}: {}'{}",
@@ -2,8 +2,11 @@
 #define _BUILDER_HELPER_PARSER_HPP
 
 #include <iostream>
+#include <shared_mutex>
 #include <string>
 #include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -693,6 +696,44 @@ inline parsec::Parser<HelperToken> assertTargetMonadic(const HelperToken& helper
     };
 }
 
+/**
+ * @brief Parse a full helper expression, reusing results for repeated strings.
+ *
+ * The same helper invocation appears across hundreds of assets in a full policy
+ * build, so successful parses are memoized by the raw expression string and the
+ * combinator pipeline is built once instead of per call. Tokens are returned by
+ * value and their arguments are immutable after parsing, so cache hits share the
+ * argument objects safely. Failures are not cached: they carry the parser trace
+ * and abort the build.
+ *
+ * @param expression Raw helper expression, parsed to end of input.
+ * @return parsec::Result<HelperToken> Parse result.
+ */
+inline parsec::Result<HelperToken> parseHelperExpression(const std::string& expression)
+{
+    static std::shared_mutex mutex;
+    static std::unordered_map<std::string, HelperToken> cache;
+
+    {
+        std::shared_lock lock {mutex};
+        if (const auto it = cache.find(expression); it != cache.end())
+        {
+            return parsec::makeSuccess(HelperToken {it->second}, expression.size());
+        }
+    }
+
+    static const auto parser = getHelperParser(true);
+    auto result = parser(expression, 0);
+
+    if (result.success())
+    {
+        std::unique_lock lock {mutex};
+        cache.emplace(expression, std::as_const(result).value());
+    }
+
+    return result;
+}
+
 /**
  * @brief Parser for a helper function or a comparison operation
  *
@@ -7,6 +7,7 @@
 
 #include <re2/re2.h>
 
+#include "builders/regexCache.hpp"
 #include "syntax.hpp"
 #include <base/baseTypes.hpp>
 #include <base/utils/ipUtils.hpp>
@@ -44,11 +45,58 @@ enum class Type
     INT
 };
 
+/**
+ * @brief Compare two operands with the operator selected at compile time.
+ *
+ * Instantiated once per (operator, operand type), so the per-event kernel is a direct
+ * inlined comparison instead of a std::function dispatch.
+ */
+template<Operator op, typename T>
+inline bool compare(T l, T r)
+{
+    if constexpr (op == Operator::EQ)
+    {
+        return l == r;
+    }
+    else if constexpr (op == Operator::NE)
+    {
+        return l != r;
+    }
+    else if constexpr (op == Operator::GT)
+    {
+        return l > r;
+    }
+    else if constexpr (op == Operator::GE)
+    {
+        return l >= r;
+    }
+    else if constexpr (op == Operator::LT)
+    {
+        return l < r;
+    }
+    else if constexpr (op == Operator::LE)
+    {
+        return l <= r;
+    }
+    else if constexpr (op == Operator::ST)
+    {
+        return l.substr(0, r.length()) == r;
+    }
+    else // Operator::CN
+    {
+        if (!r.empty())
+        {
+            return l.find(r) != std::string_view::npos;
+        }
+        return false;
+    }
+}
+
 /**
  * @brief Get the Int Cmp Function object
  *
+ * @tparam op Operator to use, selects the comparison kernel at compile time
  * @param targetField Reference of the field to compare, obtained from the YAML key
- * @param op Operator to use
  * @param rightParameter Right parameter to compare, obtained from the YAML value
  * @return std::function<FilterResult(base::Event)>
  *
@@ -56,16 +104,23 @@ enum class Type
  *   - if the right parameter is a value and not a valid integer
  *   - if helper::base::Parameter::Type is not supported
  */
+template<Operator op>
 FilterOp getIntCmpFunction(const std::string& targetField,
-                           Operator op,
                            const OpArg& rightParameter,
                            const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    // Depending on rValue type we store the reference or the integer value
-    std::variant<std::string, int64_t> rValue {};
+    // Tracing messages
+    const auto name = buildCtx->context().opName;
+    const auto successTrace {fmt::format("[{}] -> Success", name)};
 
+    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
+    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
+    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
+
+    // Value case: the right operand is a constant resolved at build time
     if (rightParameter->isValue())
     {
+        int64_t rValue {};
         try
         {
             rValue = std::static_pointer_cast<Value>(rightParameter)->value().getInt64().value();
@@ -75,102 +130,56 @@ FilterOp getIntCmpFunction(const std::string& targetField,
             throw std::runtime_error(fmt::format(R"(Expected an integer but got '{}'.)",
                                                  std::static_pointer_cast<Value>(rightParameter)->value().str()));
         }
-    }
-    else
-    {
-        auto ref = std::static_pointer_cast<Reference>(rightParameter);
-        if (buildCtx->validator().hasField(ref->dotPath())
-            && buildCtx->validator().getType(ref->dotPath()) != schemf::Type::INTEGER)
-        {
-            throw std::runtime_error(
-                fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
-                            schemf::typeToStr(schemf::Type::INTEGER),
-                            ref->dotPath(),
-                            schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
-        }
-        rValue = std::static_pointer_cast<Reference>(rightParameter)->jsonPath();
-    }
 
-    // Depending on the operator we return the correct function
-    std::function<bool(int64_t l, int64_t r)> cmpFunction;
-    switch (op)
-    {
-        case Operator::EQ:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](int64_t l, int64_t r)
+        return [=, runState = buildCtx->runState(), targetPath = json::CompiledPath {targetField}](
+                   base::ConstEvent event) -> FilterResult
+        {
+            const auto lValue = event->getIntAsInt64(targetPath);
+            if (!lValue.has_value())
             {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](int64_t l, int64_t r)
+                RETURN_FAILURE(runState, false, failureTrace1);
+            }
+
+            if (compare<op>(lValue.value(), rValue))
             {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](int64_t l, int64_t r)
+                RETURN_SUCCESS(runState, true, successTrace);
+            }
+            else
             {
-                return l <= r;
-            };
-            break;
-        default: break;
+                RETURN_FAILURE(runState, false, failureTrace3);
+            }
+        };
     }
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
-
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
-
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
+    // Reference case: the right operand is resolved from the event
+    auto ref = std::static_pointer_cast<Reference>(rightParameter);
+    if (buildCtx->validator().hasField(ref->dotPath())
+        && buildCtx->validator().getType(ref->dotPath()) != schemf::Type::INTEGER)
     {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
+        throw std::runtime_error(fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
+                                             schemf::typeToStr(schemf::Type::INTEGER),
+                                             ref->dotPath(),
+                                             schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
+    }
 
-        auto lValue = event->getIntAsInt64(targetField);
+    return [=,
+            runState = buildCtx->runState(),
+            targetPath = json::CompiledPath {targetField},
+            refPath = json::CompiledPath {ref->jsonPath()}](base::ConstEvent event) -> FilterResult
+    {
+        const auto lValue = event->getIntAsInt64(targetPath);
         if (!lValue.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        int64_t resolvedValue {0};
-        if (std::holds_alternative<std::string>(rValue))
+        const auto rValue = event->getIntAsInt64(refPath);
+        if (!rValue.has_value())
         {
-            auto resolvedRValue = event->getIntAsInt64(std::get<std::string>(rValue));
-            if (!resolvedRValue.has_value())
-            {
-                RETURN_FAILURE(runState, false, failureTrace2);
-            }
-            resolvedValue = resolvedRValue.value();
-        }
-        else
-        {
-            resolvedValue = std::get<int64_t>(rValue);
+            RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        if (cmpFunction(lValue.value(), resolvedValue))
+        if (compare<op>(lValue.value(), rValue.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -184,79 +193,27 @@ FilterOp getIntCmpFunction(const std::string& targetField,
 /**
  * @brief Get the String Cmp Function object
  *
+ * @tparam op Operator to use, selects the comparison kernel at compile time
  * @param targetField Reference of the field to compare, obtained from the YAML key
- * @param op Operator to use
  * @param rightParameter Right parameter to compare, obtained from the YAML value
- * @param name Formatted name of the helper
  * @return std::function<FilterResult(base::Event)>
  *
  * @throws std::runtime_error if helper::base::Parameter::Type is not supported
  */
+template<Operator op>
 FilterOp getStringCmpFunction(const std::string& targetField,
-                              Operator op,
                               const OpArg& rightParameter,
                               const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    // Depending on the operator we return the correct function
-    std::function<bool(const std::string& l, const std::string& r)> cmpFunction;
-    switch (op)
-    {
-        case Operator::EQ:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l <= r;
-            };
-            break;
-        case Operator::ST:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l.substr(0, r.length()) == r;
-            };
-            break;
-        case Operator::CN:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                if (!r.empty())
-                {
-                    return l.find(r) != std::string::npos;
-                }
-                return false;
-            };
-            break;
+    // Tracing messages
+    const auto name = buildCtx->context().opName;
+    const auto successTrace {fmt::format("[{}] -> Success", name)};
 
-        default: break;
-    }
+    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
+    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
+    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
 
+    // Value case: the right operand is a constant owned by the operation
     if (rightParameter->isValue())
     {
         if (!std::static_pointer_cast<Value>(rightParameter)->value().isString())
@@ -264,63 +221,63 @@ FilterOp getStringCmpFunction(const std::string& targetField,
             throw std::runtime_error(fmt::format(R"(Expected a string but got '{}'.)",
                                                  std::static_pointer_cast<Value>(rightParameter)->value().str()));
         }
-    }
-    else
-    {
-        auto ref = std::static_pointer_cast<Reference>(rightParameter);
-        if (buildCtx->validator().hasField(ref->dotPath()))
+
+        return [=,
+                runState = buildCtx->runState(),
+                targetPath = json::CompiledPath {targetField},
+                rValue = std::static_pointer_cast<Value>(rightParameter)->value().getString().value()](
+                   base::ConstEvent event) -> FilterResult
         {
-            auto jType = buildCtx->validator().getJsonType(ref->dotPath());
-            if (jType != json::Json::Type::String)
+            const auto lValue {event->getStringView(targetPath)};
+            if (!lValue.has_value())
             {
-                throw std::runtime_error(
-                    fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
-                                json::Json::typeToStr(json::Json::Type::String),
-                                ref->dotPath(),
-                                json::Json::typeToStr(jType)));
+                RETURN_FAILURE(runState, false, failureTrace1);
             }
-        }
-    }
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
-
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
+            if (compare<op, std::string_view>(lValue.value(), rValue))
+            {
+                RETURN_SUCCESS(runState, true, successTrace);
+            }
+            else
+            {
+                RETURN_FAILURE(runState, false, failureTrace3);
+            }
+        };
+    }
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
+    // Reference case: the right operand is resolved from the event
+    auto ref = std::static_pointer_cast<Reference>(rightParameter);
+    if (buildCtx->validator().hasField(ref->dotPath()))
     {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
+        auto jType = buildCtx->validator().getJsonType(ref->dotPath());
+        if (jType != json::Json::Type::String)
+        {
+            throw std::runtime_error(
+                fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
+                            json::Json::typeToStr(json::Json::Type::String),
+                            ref->dotPath(),
+                            json::Json::typeToStr(jType)));
+        }
+    }
 
-        const auto lValue {event->getString(targetField)};
+    return [=,
+            runState = buildCtx->runState(),
+            targetPath = json::CompiledPath {targetField},
+            refPath = ref->compiledPath()](base::ConstEvent event) -> FilterResult
+    {
+        const auto lValue {event->getStringView(targetPath)};
         if (!lValue.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        std::string rValue {};
-        if (rightParameter->isValue())
-        {
-            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getString().value();
-        }
-        else
+        const auto rValue {event->getStringView(refPath)};
+        if (!rValue.has_value())
         {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
-            if (!resolvedRValue.has_value())
-            {
-                RETURN_FAILURE(runState, false, failureTrace2);
-            }
-
-            rValue = resolvedRValue.value();
+            RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        if (cmpFunction(lValue.value(), rValue))
+        if (compare<op, std::string_view>(lValue.value(), rValue.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -348,19 +305,37 @@ FilterOp opBuilderComparison(const std::string& targetField,
     // Assert expected number of parameters
     utils::assertSize(parameters, 1);
 
-    // Get the expression depending on the type
+    // Select the kernel specialization depending on the type and operator
     switch (t)
     {
         case Type::INT:
-        {
-            auto opFn = getIntCmpFunction(targetField, op, parameters[0], buildCtx);
-            return opFn;
-        }
+            switch (op)
+            {
+                case Operator::EQ: return getIntCmpFunction<Operator::EQ>(targetField, parameters[0], buildCtx);
+                case Operator::NE: return getIntCmpFunction<Operator::NE>(targetField, parameters[0], buildCtx);
+                case Operator::GT: return getIntCmpFunction<Operator::GT>(targetField, parameters[0], buildCtx);
+                case Operator::GE: return getIntCmpFunction<Operator::GE>(targetField, parameters[0], buildCtx);
+                case Operator::LT: return getIntCmpFunction<Operator::LT>(targetField, parameters[0], buildCtx);
+                case Operator::LE: return getIntCmpFunction<Operator::LE>(targetField, parameters[0], buildCtx);
+                default:
+                    throw std::runtime_error(fmt::format("Comparison helper: Operator '{}' not supported for type INT",
+                                                         static_cast<int>(op)));
+            }
         case Type::STRING:
-        {
-            auto opFn = getStringCmpFunction(targetField, op, parameters[0], buildCtx);
-            return opFn;
-        }
+            switch (op)
+            {
+                case Operator::EQ: return getStringCmpFunction<Operator::EQ>(targetField, parameters[0], buildCtx);
+                case Operator::NE: return getStringCmpFunction<Operator::NE>(targetField, parameters[0], buildCtx);
+                case Operator::GT: return getStringCmpFunction<Operator::GT>(targetField, parameters[0], buildCtx);
+                case Operator::GE: return getStringCmpFunction<Operator::GE>(targetField, parameters[0], buildCtx);
+                case Operator::LT: return getStringCmpFunction<Operator::LT>(targetField, parameters[0], buildCtx);
+                case Operator::LE: return getStringCmpFunction<Operator::LE>(targetField, parameters[0], buildCtx);
+                case Operator::ST: return getStringCmpFunction<Operator::ST>(targetField, parameters[0], buildCtx);
+                case Operator::CN: return getStringCmpFunction<Operator::CN>(targetField, parameters[0], buildCtx);
+                default:
+                    throw std::runtime_error(fmt::format(
+                        "Comparison helper: Operator '{}' not supported for type STRING", static_cast<int>(op)));
+            }
         default:
             throw std::runtime_error(fmt::format("Comparison helper: Type '{}' not supported", static_cast<int>(t)));
     }
@@ -566,7 +541,7 @@ FilterOp opBuilderHelperBinaryAnd(const Reference& targetField,
     auto getValue = [targetField, referenceNotFoundTrace, referenceNotValidHexTrace](
                         base::ConstEvent event) -> base::RespOrError<uint64_t>
     {
-        const auto value = event->getString(targetField.jsonPath());
+        const auto value = event->getStringView(targetField.jsonPath());
         if (!value.has_value())
         {
             return base::Error {referenceNotFoundTrace};
@@ -623,7 +598,7 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
 
     auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
+    auto regex_ptr {utils::compileRegex(value)};
     if (!regex_ptr->ok())
     {
         throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", value));
@@ -641,13 +616,13 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
     return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedField {event->getStringView(targetField)};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (RE2::PartialMatch({resolvedField->data(), resolvedField->size()}, *regex_ptr))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -673,7 +648,7 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const auto name = buildCtx->context().opName;
     const auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
+    auto regex_ptr {utils::compileRegex(value)};
     if (!regex_ptr->ok())
     {
         throw std::runtime_error(fmt::format("\"{}\" function: "
@@ -693,13 +668,13 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedField {event->getStringView(targetField)};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (!RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (!RE2::PartialMatch({resolvedField->data(), resolvedField->size()}, *regex_ptr))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -1383,7 +1358,7 @@ FilterOp opBuilderHelperEndsWith(const Reference& targetField,
             targetField = targetField.jsonPath(),
             parameter = opArgs[0]](base::ConstEvent event) -> FilterResult
     {
-        const auto targetString = event->getString(targetField);
+        const auto targetString = event->getStringView(targetField);
         if (!targetString.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
@@ -1392,7 +1367,7 @@ FilterOp opBuilderHelperEndsWith(const Reference& targetField,
         if (parameter->isReference())
         {
             auto refPath = std::static_pointer_cast<Reference>(parameter)->jsonPath();
-            const auto stringReference = event->getString(refPath);
+            const auto stringReference = event->getStringView(refPath);
             if (!stringReference.has_value())
             {
                 RETURN_FAILURE(runState, false, failureTrace1);
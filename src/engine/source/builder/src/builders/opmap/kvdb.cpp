@@ -15,6 +15,9 @@ namespace builder::builders
 {
 using namespace kvdbManager;
 
+// Keys cached per get handler, covering hits and repeated misses (unknown IPs, unlisted users)
+constexpr size_t KVDB_GET_CACHE_CAPACITY = 4096;
+
 TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
                     const std::string& kvdbScopeName,
                     const Reference& targetField,
@@ -74,6 +77,10 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
         throw std::runtime_error(fmt::format("Engine KVDB builder: {}.", std::get<base::Error>(resultHandler).message));
     }
 
+    // The op only reads; a bounded cache keeps the hot keys and the repeated misses without
+    // materializing databases of arbitrary size
+    std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)->enableCache(KVDB_GET_CACHE_CAPACITY);
+
     // Validate the target field
     schemf::ValueValidator validator = nullptr;
     if (buildCtx->validator().hasField(targetField.dotPath()))
@@ -128,12 +135,13 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
     const auto failureTrace8 = fmt::format(
         "{} -> Cannot map subfields of {} because is not allowed for {}", name, targetField.dotPath(), assetType);
 
+    // Subfield admission compiled at build time; empty when the asset type is unrestricted
+    auto subfieldsAllowed = buildCtx->allowedFields().childChecker(assetType, targetField.dotPath());
+
     // Return Op
     return [=,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath(),
-            targetFieldDotPath = targetField.dotPath(),
-            allowedFields = buildCtx->allowedFieldsPtr(),
             kvdbHandler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)](
                base::Event event) -> TransformResult
     {
@@ -179,12 +187,12 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
                     RETURN_FAILURE(runState, event, failureTrace7 + res.value().message);
                 }
             }
-            if (value.isObject())
+            if (subfieldsAllowed && value.isObject())
             {
                 auto fields = value.getFields().value();
                 for (const auto& field : fields)
                 {
-                    if (!allowedFields->check(assetType, DotPath::append(targetFieldDotPath, field)))
+                    if (!subfieldsAllowed(field))
                     {
                         RETURN_FAILURE(runState, event, failureTrace8)
                     }
@@ -287,6 +295,9 @@ FilterOp existanceCheck(std::shared_ptr<IKVDBManager> kvdbManager,
         throw std::runtime_error(fmt::format("Error getting KVDB handler: {}", base::getError(resultHandler).message));
     }
 
+    // The op only checks existence, so per-event lookups can be served from the in-memory snapshot
+    base::getResponse(resultHandler)->enableSnapshot();
+
     // Trace messages
     const auto name = buildCtx->context().opName;
     const auto successTrace = fmt::format("{} -> Success", name);
@@ -760,6 +771,9 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                 fmt::format("Engine KVDB builder: {}.", std::get<base::Error>(resultHandler).message));
         }
 
+        // The op only reads, so per-event lookups can be served from the in-memory snapshot
+        std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)->enableSnapshot();
+
         // Validate target field
         auto valRes = buildCtx->validator().validate(targetField.dotPath(), schemf::isArrayToken());
         if (base::isError(valRes))
@@ -842,22 +856,29 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                 keys = std::static_pointer_cast<const Value>(keyArray)->value().getArray().value();
             }
 
-            // Get values from KVDB
+            // Get values from KVDB in a single batched read
+            std::vector<std::string> rawKeys;
+            rawKeys.reserve(keys.size());
+            for (const auto& jKey : keys)
+            {
+                rawKeys.emplace_back(jKey.getString().value());
+            }
+
+            auto resultValues = kvdbHandler->multiGet(rawKeys);
+            if (base::isError(resultValues))
+            {
+                RETURN_FAILURE(runState, event, failureTrace3 + base::getError(resultValues).message);
+            }
+
             bool first = true;
             json::Json::Type type;
             std::vector<json::Json> values;
-            for (const auto& jKey : keys)
+            for (const auto& rawValue : base::getResponse(resultValues))
             {
-                auto resultValue = kvdbHandler->get(jKey.getString().value());
-                if (base::isError(resultValue))
-                {
-                    RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
-                }
-
                 json::Json jValue;
                 try
                 {
-                    jValue = json::Json {std::get<std::string>(resultValue).c_str()};
+                    jValue = json::Json {rawValue.c_str()};
                 }
                 catch (const std::runtime_error& e)
                 {
@@ -5,6 +5,21 @@ namespace builder::builders::mmdb
 
 namespace
 {
+// MMDB paths queried per event, interned once instead of per lookup
+const DotPath CITY_NAME {"city.names.en"};
+const DotPath CONTINENT_CODE {"continent.code"};
+const DotPath CONTINENT_NAME {"continent.names.en"};
+const DotPath COUNTRY_ISO_CODE {"country.iso_code"};
+const DotPath COUNTRY_NAME {"country.names.en"};
+const DotPath LOCATION_LAT {"location.latitude"};
+const DotPath LOCATION_LON {"location.longitude"};
+const DotPath POSTAL_CODE {"postal.code"};
+const DotPath TIME_ZONE {"location.time_zone"};
+const DotPath REGION_ISO_CODE {"subdivisions.0.iso_code"};
+const DotPath REGION_NAME {"subdivisions.0.names.en"};
+const DotPath AS_NUMBER {"autonomous_system_number"};
+const DotPath AS_ORGANIZATION {"autonomous_system_organization"};
+
 MapOp dumpFailTransform(const std::string& trace, const std::shared_ptr<const RunState>& runstate)
 {
 
@@ -21,67 +36,67 @@ json::Json mapGeoToECS(const std::string& ip, const std::shared_ptr<geo::ILocato
     cityData.setObject();
 
     // Geo data
-    auto city = locator->getString(ip, "city.names.en");
+    auto city = locator->getString(ip, CITY_NAME);
     if (!base::isError(city))
     {
         cityData.setString(getResponse(city), "/city_name");
     }
 
-    auto continentCode = locator->getString(ip, "continent.code");
+    auto continentCode = locator->getString(ip, CONTINENT_CODE);
     if (!base::isError(continentCode))
     {
         cityData.setString(getResponse(continentCode), "/continent_code");
     }
 
-    auto continentName = locator->getString(ip, "continent.names.en");
+    auto continentName = locator->getString(ip, CONTINENT_NAME);
     if (!base::isError(continentName))
     {
         cityData.setString(getResponse(continentName), "/continent_name");
     }
 
-    auto countryIsoCode = locator->getString(ip, "country.iso_code");
+    auto countryIsoCode = locator->getString(ip, COUNTRY_ISO_CODE);
     if (!base::isError(countryIsoCode))
     {
         cityData.setString(getResponse(countryIsoCode), "/country_iso_code");
     }
 
-    auto countryName = locator->getString(ip, "country.names.en");
+    auto countryName = locator->getString(ip, COUNTRY_NAME);
     if (!base::isError(countryName))
     {
         cityData.setString(getResponse(countryName), "/country_name");
     }
 
-    auto lat = locator->getDouble(ip, "location.latitude");
+    auto lat = locator->getDouble(ip, LOCATION_LAT);
     if (!base::isError(lat))
     {
         cityData.setDouble(getResponse(lat), "/location/lat");
     }
 
-    auto lon = locator->getDouble(ip, "location.longitude");
+    auto lon = locator->getDouble(ip, LOCATION_LON);
     if (!base::isError(lon))
     {
         cityData.setDouble(getResponse(lon), "/location/lon");
     }
 
-    auto postalCode = locator->getString(ip, "postal.code");
+    auto postalCode = locator->getString(ip, POSTAL_CODE);
     if (!base::isError(postalCode))
     {
         cityData.setString(getResponse(postalCode), "/postal_code");
     }
 
-    auto timeZone = locator->getString(ip, "location.time_zone");
+    auto timeZone = locator->getString(ip, TIME_ZONE);
     if (!base::isError(timeZone))
     {
         cityData.setString(getResponse(timeZone), "/timezone");
     }
 
-    auto regionIsoCode = locator->getString(ip, "subdivisions.0.iso_code");
+    auto regionIsoCode = locator->getString(ip, REGION_ISO_CODE);
     if (!base::isError(regionIsoCode))
     {
         cityData.setString(getResponse(regionIsoCode), "/region_iso_code");
     }
 
-    auto regionName = locator->getString(ip, "subdivisions.0.names.en");
+    auto regionName = locator->getString(ip, REGION_NAME);
     if (!base::isError(regionName))
     {
         cityData.setString(getResponse(regionName), "/region_name");
@@ -95,13 +110,13 @@ json::Json mapAStoECS(const std::string& ip, const std::shared_ptr<geo::ILocator
     json::Json asData;
     asData.setObject();
 
-    auto asn = locator->getUint32(ip, "autonomous_system_number");
+    auto asn = locator->getUint32(ip, AS_NUMBER);
     if (!base::isError(asn))
     {
         asData.setInt64(getResponse(asn), "/number");
     }
 
-    auto asnOrg = locator->getString(ip, "autonomous_system_organization");
+    auto asnOrg = locator->getString(ip, AS_ORGANIZATION);
     if (!base::isError(asnOrg))
     {
         asData.setString(getResponse(asnOrg), "/organization/name");
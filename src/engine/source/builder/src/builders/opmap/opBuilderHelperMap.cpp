@@ -1,6 +1,7 @@
 #include "opBuilderHelperMap.hpp"
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <numeric>
 #include <optional>
@@ -15,8 +16,10 @@
 #include <re2/re2.h>
 
 #include <base/utils/ipUtils.hpp>
+#include <base/utils/scratchBuffer.hpp>
 #include <base/utils/stringUtils.hpp>
 
+#include "builders/regexCache.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -145,23 +148,21 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
     const auto& rightParameter = opArgs[0];
 
     // Depending on the operator we return the correct function
-    std::function<std::string(const std::string& value)> transformFunction;
+    // The transform writes into a caller-provided scratch string to avoid a
+    // per-event allocation
+    std::function<void(std::string_view value, std::string& result)> transformFunction;
     switch (op)
     {
         case StringOperator::UP:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](std::string_view value, std::string& result)
             {
-                std::string result;
                 std::transform(value.begin(), value.end(), std::back_inserter(result), ::toupper);
-                return result;
             };
             break;
         case StringOperator::LO:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](std::string_view value, std::string& result)
             {
-                std::string result;
                 std::transform(value.begin(), value.end(), std::back_inserter(result), ::tolower);
-                return result;
             };
             break;
         default: break;
@@ -184,7 +185,7 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
         if (rightParameter->isReference())
         {
             const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
+                event->getStringView(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
 
             if (!resolvedRValue.has_value())
             {
@@ -193,7 +194,9 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
             else
             {
                 // TODO: should we check the result?
-                auto res {transformFunction(resolvedRValue.value())};
+                base::utils::scratch::Buffer scratch;
+                auto& res = scratch.str();
+                transformFunction(resolvedRValue.value(), res);
                 json::Json result;
                 result.setString(res);
                 RETURN_SUCCESS(runState, result, successTrace);
@@ -202,8 +205,9 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
         else
         {
             // TODO: should we check the result?
-            const auto res {
-                transformFunction(std::static_pointer_cast<Value>(rightParameter)->value().getString().value())};
+            base::utils::scratch::Buffer scratch;
+            auto& res = scratch.str();
+            transformFunction(std::static_pointer_cast<Value>(rightParameter)->value().getString().value(), res);
             json::Json result;
             result.setString(res);
             RETURN_SUCCESS(runState, result, successTrace);
@@ -870,7 +874,8 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
         // Return Op
         return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
         {
-            std::string result {};
+            base::utils::scratch::Buffer scratch;
+            auto& result = scratch.str();
 
             for (const auto& arg : opArgs)
             {
@@ -897,7 +902,9 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
                     // Get field value
                     if (event->isString(ref))
                     {
-                        resolvedField = event->getString(ref).value();
+                        // Append the view directly, skipping the intermediate copy
+                        result.append(event->getStringView(ref).value());
+                        continue;
                     }
                     else if (event->isDouble(ref))
                     {
@@ -1148,16 +1155,21 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
             RETURN_FAILURE(runState, json::Json {}, failureTrace1);
         }
 
-        const auto refStrHEX = event->getString(sourceField);
+        const auto refStrHEX = event->getStringView(sourceField);
         if (!refStrHEX.has_value())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
-        std::stringstream ss;
-        ss << refStrHEX.value();
-        std::int64_t result;
-        ss >> std::hex >> result;
-        if (ss.fail() || !ss.eof())
+        // Parse in place, allowing the optional '0x' prefix the stream-based
+        // extraction accepted
+        auto hexView = refStrHEX.value();
+        if (hexView.size() > 2 && hexView[0] == '0' && (hexView[1] == 'x' || hexView[1] == 'X'))
+        {
+            hexView.remove_prefix(2);
+        }
+        std::int64_t result {};
+        const auto [ptr, ec] = std::from_chars(hexView.data(), hexView.data() + hexView.size(), result, 16);
+        if (ec != std::errc {} || ptr != hexView.data() + hexView.size())
         {
             RETURN_FAILURE(runState,
                            json::Json {},
@@ -1354,7 +1366,7 @@ MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::s
         throw std::runtime_error(fmt::format("Expected 'string' parameter but got type '{}'",
                                              std::static_pointer_cast<Value>(opArgs[1])->value().typeName()));
     }
-    auto regex_ptr = std::make_shared<RE2>(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
+    auto regex_ptr = utils::compileRegex(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
     if (!regex_ptr->ok())
     {
         throw std::runtime_error(fmt::format("Invalid regex: {}", regex_ptr->error()));
@@ -1437,12 +1449,13 @@ TransformOp opBuilderHelperMergeRecursively(const Reference& targetField,
     const auto failureTrace5 = fmt::format(
         "{} -> Cannot map subfields of {} because is not allowed for {}", name, targetField.dotPath(), assetType);
 
+    // Subfield admission compiled at build time; empty when the asset type is unrestricted
+    auto subfieldsAllowed = buildCtx->allowedFields().childChecker(assetType, targetField.dotPath());
+
     // Return Op
     return [=,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath(),
-            targetFieldDotPath = targetField.dotPath(),
-            allowedFields = buildCtx->allowedFieldsPtr(),
             fieldReference = refField.jsonPath()](base::Event event) -> TransformResult
     {
         // Check target and reference field exists
@@ -1467,13 +1480,13 @@ TransformOp opBuilderHelperMergeRecursively(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace4);
         }
 
-        if (targetType == json::Json::Type::Object)
+        if (subfieldsAllowed && targetType == json::Json::Type::Object)
         {
             auto ref = event->getJson(fieldReference).value();
             auto fields = ref.getFields().value();
             for (const auto& field : fields)
             {
-                if (!allowedFields->check(assetType, DotPath::append(targetFieldDotPath, field)))
+                if (!subfieldsAllowed(field))
                 {
                     RETURN_FAILURE(runState, event, failureTrace5)
                 }
@@ -1620,12 +1633,13 @@ TransformOp opBuilderHelperMerge(const Reference& targetField,
     const auto failureTrace5 = fmt::format(
         "{} -> Cannot map subfields of {} because is not allowed for {}", name, targetField.dotPath(), assetType);
 
+    // Subfield admission compiled at build time; empty when the asset type is unrestricted
+    auto subfieldsAllowed = buildCtx->allowedFields().childChecker(assetType, targetField.dotPath());
+
     // Return Op
     return [=,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath(),
-            targetFieldDotPath = targetField.dotPath(),
-            allowedFields = buildCtx->allowedFieldsPtr(),
             fieldReference = refField.jsonPath()](base::Event event) -> TransformResult
     {
         // Check target and reference field exists
@@ -1650,13 +1664,13 @@ TransformOp opBuilderHelperMerge(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace4);
         }
 
-        if (targetType == json::Json::Type::Object)
+        if (subfieldsAllowed && targetType == json::Json::Type::Object)
         {
             auto ref = event->getJson(fieldReference).value();
             auto fields = ref.getFields().value();
             for (const auto& field : fields)
             {
-                if (!allowedFields->check(assetType, DotPath::append(targetFieldDotPath, field)))
+                if (!subfieldsAllowed(field))
                 {
                     RETURN_FAILURE(runState, event, failureTrace5)
                 }
@@ -1768,8 +1782,7 @@ TransformOp opBuilderHelperRenameField(const Reference& targetField,
     const auto successTrace = fmt::format("{} -> Success", name);
     const auto failureTrace1 = fmt::format("{} -> Target field '{}' already exists", name, targetField.dotPath());
     const auto failureTrace2 = fmt::format("{} -> Source field '{}' does not exists", name, srcField.dotPath());
-    const auto failureTrace3 = fmt::format("{} -> Source field '{}' could not be erased", name, targetField.dotPath());
-    const auto failureTrace4 = fmt::format("{} -> Source field '{}' is not valid: ", name, srcField.dotPath());
+    const auto failureTrace3 = fmt::format("{} -> Source field '{}' is not valid: ", name, srcField.dotPath());
 
     return
         [=, runState = buildCtx->runState(), targetField = targetField.jsonPath(), sourceField = srcField.jsonPath()](
@@ -1785,22 +1798,21 @@ TransformOp opBuilderHelperRenameField(const Reference& targetField,
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        auto refValue = event->getJson(sourceField).value();
+        // Detach the subtree instead of copying it out: the payload is relinked
+        // under the target field without duplicating a single node
+        auto refValue = event->adoptJson(sourceField).value();
         if (runValidator != nullptr)
         {
             auto res = runValidator(refValue);
             if (base::isError(res))
             {
-                RETURN_FAILURE(runState, event, failureTrace4 + base::getError(res).message);
+                // Reattach the detached payload so a failed rename leaves the event untouched
+                event->setJson(sourceField, std::move(refValue));
+                RETURN_FAILURE(runState, event, failureTrace3 + base::getError(res).message);
             }
         }
 
-        if (!event->erase(sourceField))
-        {
-            RETURN_FAILURE(runState, event, failureTrace3);
-        }
-
-        event->set(targetField, refValue);
+        event->setJson(targetField, std::move(refValue));
 
         RETURN_SUCCESS(runState, event, successTrace);
     };
@@ -2154,12 +2166,13 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
     const auto failureTrace9 = fmt::format(
         "{} -> Cannot map subfields of {} because is not allowed for {}", name, targetField.dotPath(), assetType);
 
+    // Subfield admission compiled at build time; empty when the asset type is unrestricted
+    auto subfieldsAllowed = buildCtx->allowedFields().childChecker(assetType, targetField.dotPath());
+
     // Return Op
     return [=,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath(),
-            targetFieldDotPath = targetField.dotPath(),
-            allowedFields = buildCtx->allowedFieldsPtr(),
             parameter = opArgs[0],
             key = keyRef.jsonPath()](base::Event event) -> TransformResult
     {
@@ -2227,12 +2240,12 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
             }
         }
 
-        if (resolvedValue.value().isObject())
+        if (subfieldsAllowed && resolvedValue.value().isObject())
         {
             auto fields = resolvedValue.value().getFields().value();
             for (const auto& field : fields)
             {
-                if (!allowedFields->check(assetType, DotPath::append(targetFieldDotPath, field)))
+                if (!subfieldsAllowed(field))
                 {
                     RETURN_FAILURE(runState, event, failureTrace9)
                 }
@@ -0,0 +1,42 @@
+#include "regexCache.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace builder::builders::utils
+{
+
+std::shared_ptr<const RE2> compileRegex(const std::string& pattern)
+{
+    static std::unordered_map<std::string, std::weak_ptr<const RE2>> cache;
+    static std::mutex cacheMutex;
+
+    std::lock_guard<std::mutex> lock {cacheMutex};
+
+    auto it = cache.find(pattern);
+    if (it != cache.end())
+    {
+        if (auto compiled = it->second.lock())
+        {
+            return compiled;
+        }
+    }
+
+    auto compiled = std::make_shared<const RE2>(pattern, RE2::Quiet);
+    if (!compiled->ok())
+    {
+        // Do not cache failures, the caller reports the error
+        return compiled;
+    }
+
+    // Drop expired entries before inserting, builds are rare so the sweep is cheap
+    for (auto expired = cache.begin(); expired != cache.end();)
+    {
+        expired = expired->second.expired() ? cache.erase(expired) : std::next(expired);
+    }
+
+    cache[pattern] = compiled;
+    return compiled;
+}
+
+} // namespace builder::builders::utils
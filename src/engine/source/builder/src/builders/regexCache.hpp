@@ -0,0 +1,30 @@
+#ifndef _BUILDER_BUILDERS_REGEXCACHE_HPP
+#define _BUILDER_BUILDERS_REGEXCACHE_HPP
+
+#include <memory>
+#include <string>
+
+#include <re2/re2.h>
+
+namespace builder::builders::utils
+{
+
+/**
+ * @brief Compile a regex, deduplicating identical patterns across helper builders.
+ *
+ * The same pattern appears in many assets of a policy and is rebuilt once per worker,
+ * this returns a shared compiled RE2 so every operation using the pattern shares one
+ * compiled program. The cache holds weak references, a pattern no longer used by any
+ * operation is recompiled on the next build instead of being retained.
+ *
+ * Compilation failures are not cached, the caller keeps its own ok() check and error
+ * message.
+ *
+ * @param pattern The regex pattern to compile.
+ * @return std::shared_ptr<const RE2> The compiled regex, check ok() before use.
+ */
+std::shared_ptr<const RE2> compileRegex(const std::string& pattern);
+
+} // namespace builder::builders::utils
+
+#endif // _BUILDER_BUILDERS_REGEXCACHE_HPP
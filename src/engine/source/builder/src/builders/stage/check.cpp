@@ -92,8 +92,10 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
         // Apply definitions
         auto replacedExpr = buildCtx->definitions().replace(logicExpr);
         // TODO: make a factory and inject this dependency
+        // The term parser is stateless, so it is built once and shared across stages.
+        static const auto termParser = parsers::getTermParser();
         evaluator = logicexpr::buildDijstraEvaluator<base::Event, parsers::HelperToken>(
-            replacedExpr, getTermBuilder(buildCtx), parsers::getTermParser());
+            replacedExpr, getTermBuilder(buildCtx), termParser);
     }
     catch (const std::exception& e)
     {
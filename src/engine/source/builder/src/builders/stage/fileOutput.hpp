@@ -1,10 +1,14 @@
 #ifndef _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 #define _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <system_error>
 
 #include <fmt/format.h>
 
@@ -16,37 +20,105 @@ namespace builder::builders
 namespace detail
 {
 /**
- * @brief implements a subscriber which will save all received events
- * of type E into a file. Needed to implement Destructor to close file.
+ * @brief Buffered, rotating writer for the file output stage.
  *
+ * Events are appended to an in-memory buffer and written out in one batch when
+ * the buffer reaches the flush size or the flush interval has elapsed, instead
+ * of one flushed append per event. When the file grows past the rotation size
+ * it is renamed aside with a timestamp suffix and a fresh file is opened, so an
+ * archive-everything route never grows a single unbounded file.
  *
+ * One writer is shared by every worker running the same built policy, so the
+ * buffer, stream and rotation state are serialized behind an internal mutex;
+ * events from concurrent workers land as whole lines, in flush order.
  */
 class FileOutput
 {
+public:
+    constexpr static std::size_t DEFAULT_FLUSH_SIZE {64 * 1024};                 ///< Flush when the buffer reaches this size.
+    constexpr static std::chrono::milliseconds DEFAULT_FLUSH_INTERVAL {1000};    ///< Flush at least this often while writing.
+    constexpr static std::size_t DEFAULT_ROTATE_SIZE {1024 * 1024 * 1024};      ///< Rotate past this file size, 0 disables.
+
 protected:
     std::ofstream m_os;
+    std::string m_path;
+    std::string m_buffer;
+    std::size_t m_fileSize {0};
+    std::size_t m_flushSize;
+    std::size_t m_rotateSize;
+    std::chrono::milliseconds m_flushInterval;
+    std::chrono::steady_clock::time_point m_lastFlush;
+    std::mutex m_mutex; ///< Serializes buffer and stream access, the writer is shared when a built policy is
+
+    /**
+     * @brief Rename the current file aside and reopen a fresh one.
+     *
+     * @note The caller must hold m_mutex.
+     */
+    void rotate()
+    {
+        this->m_os.close();
+
+        const auto stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+        std::error_code ec;
+        std::filesystem::rename(m_path, fmt::format("{}.{}", m_path, stamp), ec);
+        // On rename failure keep appending to the same file rather than losing events.
+
+        this->m_os.open(m_path, std::ios::out | std::ios::app | std::ios::binary);
+        if (!this->m_os)
+        {
+            throw std::runtime_error(fmt::format("Could not reopen file {} after rotation", m_path));
+        }
+        m_fileSize = ec ? m_fileSize : 0;
+    }
 
 public:
     /**
      * @brief Construct a new File Output object
      *
      * @param path file to store the events received
+     * @param flushSize Buffer size that triggers a flush.
+     * @param flushInterval Maximum time buffered events wait before a write flushes them.
+     * @param rotateSize File size that triggers rotation, 0 to disable.
      */
-    explicit FileOutput(const std::string& path)
+    explicit FileOutput(const std::string& path,
+                        std::size_t flushSize = DEFAULT_FLUSH_SIZE,
+                        std::chrono::milliseconds flushInterval = DEFAULT_FLUSH_INTERVAL,
+                        std::size_t rotateSize = DEFAULT_ROTATE_SIZE)
         : m_os {path, std::ios::out | std::ios::app | std::ios::binary}
+        , m_path {path}
+        , m_flushSize {flushSize}
+        , m_rotateSize {rotateSize}
+        , m_flushInterval {flushInterval}
+        , m_lastFlush {std::chrono::steady_clock::now()}
     {
         if (!this->m_os)
         {
             throw std::invalid_argument(fmt::format("Could not open file {}", path));
         }
+
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(path, ec);
+        m_fileSize = ec ? 0 : size;
+        m_buffer.reserve(m_flushSize * 2);
     }
 
     /**
-     * @brief Closes file if open
+     * @brief Flushes pending events and closes the file if open.
      *
      */
     ~FileOutput()
     {
+        try
+        {
+            flush();
+        }
+        catch (...) // NOLINT(bugprone-empty-catch): nowhere to report from a destructor
+        {
+        }
+
         if (this->m_os.is_open())
         {
             this->m_os.close();
@@ -54,11 +126,55 @@ public:
     }
 
     /**
-     * @brief Write event string to file
+     * @brief Write the buffered events out in one batch, rotating if the file
+     * grew past the rotation size.
+     */
+    void flush()
+    {
+        std::lock_guard lock {m_mutex};
+        flushUnlocked();
+    }
+
+    /**
+     * @brief Buffer an event, flushing when the buffer is full or the flush
+     * interval elapsed.
      *
      * @param e
      */
-    void write(base::ConstEvent e) { this->m_os << e->str() << std::endl; }
+    void write(base::ConstEvent e)
+    {
+        std::lock_guard lock {m_mutex};
+        m_buffer += base::event::serializeOnce(e);
+        m_buffer += '\n';
+
+        if (m_buffer.size() >= m_flushSize || std::chrono::steady_clock::now() - m_lastFlush >= m_flushInterval)
+        {
+            flushUnlocked();
+        }
+    }
+
+protected:
+    /**
+     * @brief Flush implementation shared by write() and flush().
+     *
+     * @note The caller must hold m_mutex.
+     */
+    void flushUnlocked()
+    {
+        if (!m_buffer.empty())
+        {
+            this->m_os.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            this->m_os.flush();
+            m_fileSize += m_buffer.size();
+            m_buffer.clear();
+        }
+        m_lastFlush = std::chrono::steady_clock::now();
+
+        if (m_rotateSize > 0 && m_fileSize >= m_rotateSize)
+        {
+            rotate();
+        }
+    }
 };
 } // namespace detail
 
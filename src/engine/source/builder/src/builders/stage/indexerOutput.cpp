@@ -1,9 +1,12 @@
 #include "indexerOutput.hpp"
 
+#include <iterator>
 #include <memory>
 #include <regex>
 #include <stdexcept>
 
+#include <base/warmup.hpp>
+
 #include "builders/utils.hpp"
 
 namespace builder::builders
@@ -68,9 +71,43 @@ base::Expression indexerOutputBuilder(const json::Json& definition,
                 RETURN_FAILURE(runState, event, failureTrace);
             }
 
-            const auto pushEvent =
-                fmt::format(R"({{"operation": "ADD", "index": "{}", "data": {} }})", indexName, event->str());
-            iConnector->publish(pushEvent);
+            // Warm-up replays exercise the whole pipeline but must not publish duplicates
+            if (base::warmup::active())
+            {
+                RETURN_SUCCESS(runState, event, successTrace);
+            }
+
+            // Move the sampled ingress timestamp from the event to the envelope, so the
+            // connector can measure the latency to the bulk acknowledgement without
+            // indexing the timestamp as part of the document.
+            int64_t ingressNs = 0;
+            if (const auto timestamp = event->getIntAsInt64(base::event::ingressTimestampPath()))
+            {
+                ingressNs = timestamp.value();
+                event->erase(base::event::ingressTimestampPath());
+                base::event::invalidateSerialization();
+            }
+
+            // Reused per-thread envelope: the capacity is retained across events, so
+            // wrapping the serialized document costs no allocation in steady state
+            thread_local std::string envelope;
+            envelope.clear();
+            if (ingressNs != 0)
+            {
+                fmt::format_to(std::back_inserter(envelope),
+                               R"({{"operation": "ADD", "index": "{}", "ingress_ns": {}, "data": {} }})",
+                               indexName,
+                               ingressNs,
+                               base::event::serializeOnce(event));
+            }
+            else
+            {
+                fmt::format_to(std::back_inserter(envelope),
+                               R"({{"operation": "ADD", "index": "{}", "data": {} }})",
+                               indexName,
+                               base::event::serializeOnce(event));
+            }
+            iConnector->publish(envelope);
 
             RETURN_SUCCESS(runState, event, successTrace);
         });
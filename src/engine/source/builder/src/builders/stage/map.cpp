@@ -1,12 +1,218 @@
 #include "map.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <base/json.hpp>
+#include <base/utils/stringUtils.hpp>
 
 #include "builders/baseHelper.hpp"
+#include "builders/helperParser.hpp"
 #include "syntax.hpp"
 
+namespace
+{
+using namespace builder::builders;
+
+/// In-place step of a fused string transform chain.
+using FusedStep = std::function<void(std::string&)>;
+
+/**
+ * @brief A map entry that rewrites its own target string in place, candidate for
+ * fusion with its neighbours.
+ */
+struct FusableOp
+{
+    std::string target; ///< Dot path of the target field
+    std::string name;   ///< Helper call, for the fused term name
+    FusedStep step;     ///< The transform over the scratch string
+};
+
+/**
+ * @brief Interpret a map entry as an in-place string transform over its own target.
+ *
+ * Recognizes `trim(begin|end|both, char)`, and `upcase`/`downcase` whose single
+ * argument is a reference to the target itself. Anything else, including entries the
+ * helper parser rejects, is left for the regular per-operation build.
+ */
+std::optional<FusableOp> asFusable(const json::Json& mapDef)
+{
+    if (!mapDef.isObject() || mapDef.size() != 1)
+    {
+        return std::nullopt;
+    }
+
+    auto [target, jValue] = mapDef.getObject().value()[0];
+    if (!jValue.isString())
+    {
+        return std::nullopt;
+    }
+
+    auto strValue = jValue.getString().value();
+    if (parsers::isDefaultHelper(strValue))
+    {
+        return std::nullopt;
+    }
+
+    auto parseRes = parsers::parseHelperExpression(strValue);
+    if (!parseRes.success())
+    {
+        return std::nullopt;
+    }
+
+    const auto& token = std::as_const(parseRes).value();
+    FusableOp op {target, fmt::format("{}: {}", target, strValue), {}};
+
+    if (token.name == "trim")
+    {
+        if (token.args.size() != 2 || !token.args[0]->isValue() || !token.args[1]->isValue())
+        {
+            return std::nullopt;
+        }
+
+        auto trimType = std::static_pointer_cast<Value>(token.args[0])->value().getString();
+        auto trimChar = std::static_pointer_cast<Value>(token.args[1])->value().getString();
+        if (!trimType || !trimChar || trimChar.value().size() != 1)
+        {
+            return std::nullopt;
+        }
+
+        const char c = trimChar.value()[0];
+        if (trimType.value() == "begin")
+        {
+            op.step = [c](std::string& value) { value.erase(0, value.find_first_not_of(c)); };
+        }
+        else if (trimType.value() == "end")
+        {
+            op.step = [c](std::string& value) { value.erase(value.find_last_not_of(c) + 1); };
+        }
+        else if (trimType.value() == "both")
+        {
+            op.step = [c](std::string& value)
+            {
+                value.erase(0, value.find_first_not_of(c));
+                value.erase(value.find_last_not_of(c) + 1);
+            };
+        }
+        else
+        {
+            return std::nullopt;
+        }
+
+        return op;
+    }
+
+    if (token.name == "upcase" || token.name == "downcase")
+    {
+        if (token.args.size() != 1 || !token.args[0]->isReference()
+            || std::static_pointer_cast<Reference>(token.args[0])->dotPath() != target)
+        {
+            return std::nullopt;
+        }
+
+        if (token.name == "upcase")
+        {
+            op.step = [](std::string& value) { std::transform(value.begin(), value.end(), value.begin(), ::toupper); };
+        }
+        else
+        {
+            op.step = [](std::string& value) { std::transform(value.begin(), value.end(), value.begin(), ::tolower); };
+        }
+
+        return op;
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Check the fused write is allowed and the schema accepts a string on the target
+ * without a runtime validator, the preconditions for replacing the per-operation terms.
+ */
+bool canFuseOn(const std::string& target, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto assetType = base::Name(buildCtx->context().assetName).parts().front();
+    if (!buildCtx->allowedFields().check(assetType, target))
+    {
+        return false;
+    }
+
+    auto resp = buildCtx->validator().validate(target, schemf::JTypeToken::create(json::Json::Type::String));
+    if (base::isError(resp))
+    {
+        return false;
+    }
+
+    return !base::getResponse<schemf::ValidationResult>(resp).needsRuntimeValidation();
+}
+
+/**
+ * @brief Compile a run of fusable operations over the same target into one term doing
+ * a single read of the field, every step over the scratch string, and a single write.
+ *
+ * Every constituent reads the target as a string, so the fused term fails exactly
+ * where each of them would have: target missing or not a string. The trace names the
+ * fused calls instead of one line per operation.
+ */
+base::Expression
+buildFusedTerm(std::vector<FusableOp>&& ops, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const Reference target {ops.front().target};
+
+    std::vector<std::string> opNames;
+    std::transform(
+        ops.begin(), ops.end(), std::back_inserter(opNames), [](const FusableOp& op) { return op.name; });
+    const auto name = fmt::format("fused[{}]", base::utils::string::join(opNames, " | "));
+
+    std::vector<FusedStep> steps;
+    steps.reserve(ops.size());
+    for (auto& op : ops)
+    {
+        steps.emplace_back(std::move(op.step));
+    }
+
+    const std::string successTrace {fmt::format("[{}] -> Success", name)};
+    const std::string failureTraceNotFound {
+        fmt::format("[{}] -> Failure: Target field '{}' reference not found", name, target.dotPath())};
+    const std::string failureTraceNotString {
+        fmt::format("[{}] -> Failure: Target field '{}' type is not string", name, target.dotPath())};
+
+    TransformOp op = [steps = std::move(steps),
+                      targetPath = target.jsonPath(),
+                      successTrace,
+                      failureTraceNotFound,
+                      failureTraceNotString,
+                      runState = buildCtx->runState()](base::Event event) -> TransformResult
+    {
+        if (!event->exists(targetPath))
+        {
+            RETURN_FAILURE(runState, event, failureTraceNotFound);
+        }
+
+        auto resolved = event->getString(targetPath);
+        if (!resolved.has_value())
+        {
+            RETURN_FAILURE(runState, event, failureTraceNotString);
+        }
+
+        auto value = std::move(resolved.value());
+        for (const auto& step : steps)
+        {
+            step(value);
+        }
+        event->setString(value, targetPath);
+
+        RETURN_SUCCESS(runState, event, successTrace);
+    };
+
+    return toExpression(op, name);
+}
+} // namespace
+
 namespace builder::builders
 {
 base::Expression mapBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
@@ -25,14 +231,40 @@ base::Expression mapBuilder(const json::Json& definition, const std::shared_ptr<
 
     auto list = definition.getArray().value();
     std::vector<base::Expression> mapExpressions;
-    std::transform(list.begin(),
-                   list.end(),
-                   std::back_inserter(mapExpressions),
-                   [buildCtx](const auto& mapDef)
-                   {
-                       auto opExpr = baseHelperBuilder(mapDef, buildCtx, builders::HelperType::MAP);
-                       return opExpr;
-                   });
+
+    // Consecutive in-place string transforms over the same target (trim -> downcase and
+    // friends) are fused into one term with a single field read and write, instead of
+    // one term with its own lookup, result and write per operation.
+    for (std::size_t i = 0; i < list.size();)
+    {
+        auto fusable = asFusable(list[i]);
+        if (fusable.has_value())
+        {
+            std::vector<FusableOp> run;
+            run.emplace_back(std::move(fusable.value()));
+            auto next = i + 1;
+            while (next < list.size())
+            {
+                auto candidate = asFusable(list[next]);
+                if (!candidate.has_value() || candidate.value().target != run.front().target)
+                {
+                    break;
+                }
+                run.emplace_back(std::move(candidate.value()));
+                ++next;
+            }
+
+            if (run.size() > 1 && canFuseOn(run.front().target, buildCtx))
+            {
+                mapExpressions.emplace_back(buildFusedTerm(std::move(run), buildCtx));
+                i = next;
+                continue;
+            }
+        }
+
+        mapExpressions.emplace_back(baseHelperBuilder(list[i], buildCtx, builders::HelperType::MAP));
+        ++i;
+    }
 
     auto expression = base::Chain::create("stage.map", mapExpressions);
     return expression;
@@ -1,9 +1,59 @@
 #include "parse.hpp"
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
 #include <base/json.hpp>
 
 #include "syntax.hpp"
 
+namespace
+{
+
+/**
+ * @brief Build or reuse the extraction plan of a logpar expression.
+ *
+ * Dozens of decoders parse the same prefix (e.g. the syslog header) with identical
+ * logpar expressions; sharing the compiled plan deduplicates them across the policy
+ * and gives every identical parse operation the same plan identity, which the
+ * per-event failure memo keys on. Entries are weak references so plans of unloaded
+ * policies are not retained.
+ */
+std::shared_ptr<const hlp::parser::ExtractionPlan>
+getSharedPlan(const std::shared_ptr<hlp::logpar::Logpar>& logpar, const std::string& logparExpr)
+{
+    static std::map<std::pair<const void*, std::string>, std::weak_ptr<const hlp::parser::ExtractionPlan>> cache;
+    static std::mutex cacheMutex;
+
+    std::lock_guard<std::mutex> lock {cacheMutex};
+
+    // Plans depend on the logpar configuration, so it is part of the key
+    auto key = std::make_pair(static_cast<const void*>(logpar.get()), logparExpr);
+    auto it = cache.find(key);
+    if (it != cache.end())
+    {
+        if (auto plan = it->second.lock())
+        {
+            return plan;
+        }
+    }
+
+    auto plan = std::make_shared<const hlp::parser::ExtractionPlan>(logpar->buildPlan(logparExpr));
+
+    // Drop expired entries before inserting, builds are rare so the sweep is cheap
+    for (auto expired = cache.begin(); expired != cache.end();)
+    {
+        expired = expired->second.expired() ? cache.erase(expired) : std::next(expired);
+    }
+
+    cache[key] = plan;
+    return plan;
+}
+
+} // namespace
+
 namespace builder::builders
 {
 // TODO: QoL error messages
@@ -54,10 +104,10 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
             auto logparExpr = std::get<1>(itemObj[0]).getString().value();
             logparExpr = buildCtx->definitions().replace(logparExpr);
 
-            hlp::parser::Parser parser;
+            std::shared_ptr<const hlp::parser::ExtractionPlan> parser;
             try
             {
-                parser = logpar->build(logparExpr);
+                parser = getSharedPlan(logpar, logparExpr);
             }
             catch (const std::exception& e)
             {
@@ -83,6 +133,19 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
                     logparExpr,
                     [=, parser = std::move(parser)](base::Event event)
                     {
+                        // Per-event memo of failed attempts, shared by every parse
+                        // operation of the policy. Sibling decoders re-run identical
+                        // header parsers on the same input; the first failure is
+                        // replayed without re-parsing. This is sound because run()
+                        // leaves the event untouched on failure and the result
+                        // depends only on the plan and the input text.
+                        struct FailureMemo
+                        {
+                            const void* event {nullptr};
+                            std::unordered_map<const void*, std::unordered_map<std::string, std::string>> failures;
+                        };
+                        thread_local FailureMemo memo;
+
                         if (!event->exists(field))
                         {
                             return base::result::makeFailure(std::move(event), failureTrace1);
@@ -92,10 +155,24 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
                             return base::result::makeFailure(std::move(event), failureTrace3);
                         }
 
+                        if (memo.event != static_cast<const void*>(event.get()))
+                        {
+                            memo.event = static_cast<const void*>(event.get());
+                            memo.failures.clear();
+                        }
+
                         auto ev = event->getString(field).value();
-                        auto error = hlp::parser::run(parser, ev, *event);
+                        auto& planFailures = memo.failures[static_cast<const void*>(parser.get())];
+                        auto memoIt = planFailures.find(ev);
+                        if (memoIt != planFailures.end())
+                        {
+                            return base::result::makeFailure(std::move(event), failureTrace2 + memoIt->second);
+                        }
+
+                        auto error = parser->run(ev, *event);
                         if (error)
                         {
+                            planFailures.emplace(std::move(ev), error.value().message);
                             return base::result::makeFailure(std::move(event), failureTrace2 + error.value().message);
                         }
 
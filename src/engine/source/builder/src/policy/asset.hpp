@@ -1,9 +1,12 @@
 #ifndef _BUILDER_POLICY_ASSET_HPP
 #define _BUILDER_POLICY_ASSET_HPP
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include <base/expression.hpp>
+#include <base/json.hpp>
 
 namespace builder::policy
 {
@@ -14,10 +17,27 @@ namespace builder::policy
  */
 class Asset
 {
+public:
+    /**
+     * @brief First check condition of the asset when it has the form
+     * field == scalar literal.
+     *
+     * The asset can only accept an event whose field equals the literal, so
+     * sibling assets discriminating on the same field with distinct literals
+     * are mutually exclusive. The factory uses this to compile sequential
+     * sibling scans into a dispatch (see base::Or::DispatchHint).
+     */
+    struct Discriminant
+    {
+        std::string field;  ///< Discriminating field, as a dot path
+        json::Json literal; ///< Scalar literal the field is compared against
+    };
+
 private:
-    base::Name m_name;                 ///< Asset name
-    base::Expression m_expression;     ///< Asset expression
-    std::vector<base::Name> m_parents; ///< Asset parents
+    base::Name m_name;                           ///< Asset name
+    base::Expression m_expression;               ///< Asset expression
+    std::vector<base::Name> m_parents;           ///< Asset parents
+    std::optional<Discriminant> m_discriminant;  ///< Discriminant of the check stage, if recognized
 
 public:
     Asset() = default;
@@ -28,11 +48,16 @@ public:
      * @param name Name of the asset
      * @param expression Expression of the asset
      * @param parents Parents of the asset
+     * @param discriminant Discriminant of the check stage, if recognized
      */
-    Asset(base::Name&& name, base::Expression&& expression, std::vector<base::Name>&& parents)
+    Asset(base::Name&& name,
+          base::Expression&& expression,
+          std::vector<base::Name>&& parents,
+          std::optional<Discriminant>&& discriminant = std::nullopt)
         : m_name(std::move(name))
         , m_expression(std::move(expression))
         , m_parents(std::move(parents))
+        , m_discriminant(std::move(discriminant))
     {
     }
 
@@ -58,6 +83,13 @@ public:
     inline const std::vector<base::Name>& parents() const { return m_parents; }
     std::vector<base::Name>& parents() { return m_parents; }
 
+    /**
+     * @brief Get the discriminant of the check stage, if one was recognized
+     *
+     * @return const std::optional<Discriminant>&
+     */
+    inline const std::optional<Discriminant>& discriminant() const { return m_discriminant; }
+
     friend bool operator==(const Asset& lhs, const Asset& rhs)
     {
         return lhs.m_name == rhs.m_name && lhs.m_expression == rhs.m_expression && lhs.m_parents == rhs.m_parents;
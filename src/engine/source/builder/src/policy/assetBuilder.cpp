@@ -3,6 +3,7 @@
 #include <base/utils/stringUtils.hpp>
 #include <fmt/format.h>
 
+#include "builders/helperParser.hpp"
 #include "syntax.hpp"
 
 namespace builder::policy
@@ -221,6 +222,79 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
     return base::Implication::create(name, std::move(condition), std::move(consequence));
 }
 
+std::optional<Asset::Discriminant>
+AssetBuilder::getDiscriminant(const std::vector<std::tuple<std::string, json::Json>>& objDoc) const
+{
+    // Find the check stage as buildExpression will see it: the first stage key,
+    // skipping the definitions stage which may appear anywhere
+    const json::Json* checkValue = nullptr;
+    for (const auto& [key, value] : objDoc)
+    {
+        if (key == syntax::asset::DEFINITIONS_KEY)
+        {
+            continue;
+        }
+        if (key == syntax::asset::CHECK_KEY)
+        {
+            checkValue = &value;
+        }
+        break;
+    }
+
+    if (checkValue == nullptr || !checkValue->isArray())
+    {
+        return std::nullopt;
+    }
+
+    auto conditions = checkValue->getArray().value();
+    if (conditions.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto condObj = conditions.front().getObject();
+    if (!condObj || condObj.value().size() != 1)
+    {
+        return std::nullopt;
+    }
+
+    const auto& [field, jValue] = condObj.value().front();
+
+    if (jValue.isBool() || jValue.isNumber())
+    {
+        return Asset::Discriminant {field, json::Json {jValue}};
+    }
+
+    if (jValue.isString())
+    {
+        auto strValue = jValue.getString().value();
+        if (!builders::parsers::isDefaultHelper(strValue))
+        {
+            // Helper call, the acceptance set is not a single literal
+            return std::nullopt;
+        }
+
+        if (!strValue.empty() && strValue.front() == syntax::field::REF_ANCHOR)
+        {
+            // Reference, the compared value depends on the event
+            return std::nullopt;
+        }
+
+        if (strValue.size() >= 2 && strValue[0] == syntax::helper::DEFAULT_ESCAPE
+            && strValue[1] == syntax::field::REF_ANCHOR)
+        {
+            // Escaped reference anchor, the literal is the unescaped string
+            strValue = strValue.substr(1);
+        }
+
+        json::Json literal;
+        literal.setString(strValue);
+        return Asset::Discriminant {field, std::move(literal)};
+    }
+
+    return std::nullopt;
+}
+
 Asset AssetBuilder::operator()(const store::Doc& document) const
 {
     // Check document is an object
@@ -274,10 +348,13 @@ Asset AssetBuilder::operator()(const store::Doc& document) const
         }
     }
 
+    // Recognize the discriminant before the stages are consumed
+    auto discriminant = getDiscriminant(objDoc);
+
     // Build the expression (rest of keys if any)
     auto expression = buildExpression(name, objDoc);
 
-    return Asset {std::move(name), std::move(expression), std::move(parents)};
+    return Asset {std::move(name), std::move(expression), std::move(parents), std::move(discriminant)};
 }
 
 } // namespace builder::policy
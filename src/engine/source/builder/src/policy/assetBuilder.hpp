@@ -71,6 +71,22 @@ public:
     base::Expression buildExpression(const base::Name& name,
                                      std::vector<std::tuple<std::string, json::Json>>& objDoc) const;
 
+    /**
+     * @brief Recognize the discriminant of the asset, if its first check
+     * condition has the form field == scalar literal.
+     *
+     * Only the list form of the check stage is inspected, and only conditions
+     * whose value is a plain scalar: references, helper calls and expression
+     * form checks are never recognized, their acceptance set cannot be proven
+     * from the document alone.
+     *
+     * @param objDoc Object containing the asset stages, not consumed.
+     *
+     * @return std::optional<Asset::Discriminant>
+     */
+    std::optional<Asset::Discriminant>
+    getDiscriminant(const std::vector<std::tuple<std::string, json::Json>>& objDoc) const;
+
     /**
      * @copydoc IAssetBuilder::operator()
      */
@@ -1,7 +1,16 @@
 #include "policy/factory.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <numeric> // std::accumulate
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -317,52 +326,245 @@ PolicyData readData(const store::Doc& doc, const std::shared_ptr<store::IStoreRe
     return data;
 }
 
+namespace
+{
+
+/**
+ * @brief Build an asset through a process-wide cache keyed by build flavor, asset name
+ * and source document hash.
+ *
+ * Policies are rebuilt whole when any asset changes; with the cache, every asset whose
+ * document is untouched reuses its previous build and a single-decoder edit only pays
+ * for that decoder. Cached subtrees are shrunk to their optimization fixed point
+ * before insertion, so later policy-level optimization passes over reused subtrees
+ * are read-only and the expressions can be shared safely between environments.
+ */
+Asset getCachedAsset(const std::string& cacheTag,
+                     const base::Name& name,
+                     const store::Doc& document,
+                     const std::shared_ptr<IAssetBuilder>& assetBuilder)
+{
+    static std::unordered_map<std::string, std::pair<std::size_t, Asset>> cache;
+    static std::mutex cacheMutex;
+
+    const auto key = fmt::format("{}:{}", cacheTag, name.fullName());
+    const auto docHash = std::hash<std::string> {}(document.str());
+
+    {
+        std::lock_guard lock {cacheMutex};
+        auto it = cache.find(key);
+        if (it != cache.end() && it->second.first == docHash)
+        {
+            return it->second.second;
+        }
+    }
+
+    auto asset = (*assetBuilder)(document);
+    auto optimized = optimizeExpression(asset.expression(), {asset.name().toStr()});
+    Asset built {base::Name {asset.name()},
+                 std::move(optimized),
+                 std::vector<base::Name> {asset.parents()},
+                 std::optional<Asset::Discriminant> {asset.discriminant()}};
+
+    {
+        std::lock_guard lock {cacheMutex};
+        cache[key] = {docHash, built};
+    }
+
+    return built;
+}
+
+} // namespace
+
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder)
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        const std::string& cacheTag)
 {
-    BuiltAssets builtAssets;
+    // Flatten the asset list so the builds can be distributed among threads.
+    // Each build clones its own context, so assets are independent of each
+    // other; only the store and registry are shared, and both are read-only
+    // during the build.
+    struct Task
+    {
+        PolicyData::AssetType m_type;
+        store::NamespaceId m_ns;
+        base::Name m_name;
+        std::optional<Asset> m_asset;
+    };
 
-    // Build assets for each type
+    std::vector<Task> tasks;
     for (const auto& [assetType, subgraphData] : data.subgraphs())
     {
         for (const auto& [assetNs, assetNames] : subgraphData.assets)
         {
             for (const auto& assetName : assetNames)
+            {
+                tasks.push_back(Task {assetType, assetNs, assetName, std::nullopt});
+            }
+        }
+    }
+
+    const auto nThreads =
+        std::min<std::size_t>(tasks.size(), std::max<std::size_t>(1, std::thread::hardware_concurrency()));
+
+    std::atomic_size_t nextTask {0};
+    std::mutex errorMutex;
+    std::optional<std::string> firstError;
+
+    auto buildWorker = [&]()
+    {
+        for (auto i = nextTask.fetch_add(1); i < tasks.size(); i = nextTask.fetch_add(1))
+        {
+            auto& task = tasks[i];
+            try
             {
                 // Get document
-                auto resp = store::utils::get(store, assetName);
+                auto resp = store::utils::get(store, task.m_name);
                 if (base::isError(resp))
                 {
-                    throw std::runtime_error(fmt::format("Asset '{}' not found", assetName));
+                    throw std::runtime_error(fmt::format("Asset '{}' not found", task.m_name));
                 }
 
-                Asset asset = (*assetBuilder)(base::getResponse<store::Doc>(resp));
-
-                // Add parents
-                if (asset.parents().empty())
+                if (cacheTag.empty())
                 {
-                    auto defParentIt = subgraphData.defaultParents.find(assetNs);
-                    if (defParentIt != subgraphData.defaultParents.end() && defParentIt->second != assetName)
-                    {
-                        asset.parents().emplace_back(defParentIt->second);
-                    }
+                    task.m_asset = (*assetBuilder)(base::getResponse<store::Doc>(resp));
                 }
-
-                // Add built asset to the subgraph
-                if (builtAssets.find(assetType) == builtAssets.end())
+                else
                 {
-                    builtAssets.emplace(assetType, std::unordered_map<base::Name, Asset> {});
+                    task.m_asset =
+                        getCachedAsset(cacheTag, task.m_name, base::getResponse<store::Doc>(resp), assetBuilder);
                 }
+            }
+            catch (const std::exception& e)
+            {
+                std::lock_guard lock {errorMutex};
+                if (!firstError)
+                {
+                    firstError = e.what();
+                }
+            }
+        }
+    };
 
-                builtAssets[assetType].emplace(assetName, asset);
+    if (nThreads <= 1)
+    {
+        buildWorker();
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(nThreads);
+        for (std::size_t i = 0; i < nThreads; ++i)
+        {
+            threads.emplace_back(buildWorker);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    if (firstError)
+    {
+        throw std::runtime_error(firstError.value());
+    }
+
+    // Assemble the subgraphs sequentially, preserving the original ordering
+    // and duplicate handling
+    BuiltAssets builtAssets;
+    for (auto& task : tasks)
+    {
+        const auto& subgraphData = data.subgraphs().at(task.m_type);
+        Asset asset = std::move(task.m_asset.value());
+
+        // Add parents
+        if (asset.parents().empty())
+        {
+            auto defParentIt = subgraphData.defaultParents.find(task.m_ns);
+            if (defParentIt != subgraphData.defaultParents.end() && defParentIt->second != task.m_name)
+            {
+                asset.parents().emplace_back(defParentIt->second);
             }
         }
+
+        // Add built asset to the subgraph
+        if (builtAssets.find(task.m_type) == builtAssets.end())
+        {
+            builtAssets.emplace(task.m_type, std::unordered_map<base::Name, Asset> {});
+        }
+
+        builtAssets[task.m_type].emplace(task.m_name, asset);
     }
 
     return builtAssets;
 }
 
+void annotateOrDispatch(const std::shared_ptr<base::Or>& node, const std::vector<const Asset*>& children)
+{
+    if (children.size() < 2 || node->getOperands().size() != children.size())
+    {
+        return;
+    }
+
+    // Pin mutual exclusivity when every operand discriminates on one field with
+    // pairwise distinct scalar literals; the serialized literal distinguishes
+    // types, "5" the string never collides with 5 the number
+    {
+        std::unordered_set<std::string> literals;
+        bool exclusive = children.front()->discriminant().has_value();
+        for (std::size_t i = 0; exclusive && i < children.size(); ++i)
+        {
+            const auto& discriminant = children[i]->discriminant();
+            exclusive = discriminant.has_value()
+                        && discriminant->field == children.front()->discriminant()->field
+                        && literals.insert(discriminant->literal.str()).second;
+        }
+
+        if (exclusive)
+        {
+            node->setMutuallyExclusive();
+        }
+    }
+
+    // Hint the longest contiguous run discriminating on one field with distinct
+    // string literals; string keys are what a dispatch table can probe
+    base::Or::DispatchHint best {};
+    for (std::size_t start = 0; start + 1 < children.size();)
+    {
+        const auto& discriminant = children[start]->discriminant();
+        if (!discriminant || !discriminant->literal.isString())
+        {
+            ++start;
+            continue;
+        }
+
+        base::Or::DispatchHint run {json::Json::formatJsonPath(discriminant->field), {}, start, 0};
+        auto end = start;
+        for (; end < children.size(); ++end)
+        {
+            const auto& next = children[end]->discriminant();
+            if (!next || next->field != discriminant->field || !next->literal.isString()
+                || !run.cases.emplace(next->literal.getString().value(), end).second)
+            {
+                break;
+            }
+        }
+
+        run.count = end - start;
+        if (run.count > best.count)
+        {
+            best = std::move(run);
+        }
+        start = end > start ? end : start + 1;
+    }
+
+    if (best.count >= 2)
+    {
+        node->setDispatchHint(std::move(best));
+    }
+}
+
 Graph<base::Name, Asset> buildSubgraph(const std::string& subgraphName,
                                        const SubgraphData& subgraphData,
                                        const SubgraphData& filtersData,
@@ -508,4 +710,64 @@ base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& dat
     return policy;
 }
 
+base::Expression optimizeExpression(const base::Expression& expression,
+                                    const std::unordered_set<std::string>& keepNames)
+{
+    if (expression == nullptr || !expression->isOperation())
+    {
+        return expression;
+    }
+
+    auto& operands = expression->getPtr<base::Operation>()->getOperands();
+
+    // Optimize the children first, a child may become empty or collapse
+    for (auto& operand : operands)
+    {
+        operand = optimizeExpression(operand, keepNames);
+    }
+
+    // Implication has a fixed condition/consequence shape, only its operands change
+    if (expression->isImplication())
+    {
+        return expression;
+    }
+
+    // Dispatch hints and exclusivity pins reference operands by index, so an
+    // annotated Or keeps its operand list as built; children were already
+    // optimized in place above, which preserves the indexes
+    if (expression->isOr())
+    {
+        auto orNode = expression->getPtr<base::Or>();
+        if (orNode->dispatchHint() || orNode->isMutuallyExclusive())
+        {
+            return expression;
+        }
+    }
+
+    // Drop empty operations that cannot alter the parent result: any operand of a
+    // Chain/Broadcast (their results are ignored) and same-type operands of And/Or
+    // (true is the identity of And, false the identity of Or)
+    const bool resultIgnored = expression->isChain() || expression->isBroadcast();
+    auto removable = [&](const base::Expression& operand)
+    {
+        if (!operand->isOperation() || !operand->getPtr<base::Operation>()->getOperands().empty()
+            || keepNames.find(operand->getName()) != keepNames.end())
+        {
+            return false;
+        }
+        return resultIgnored || (expression->isAnd() && operand->isAnd())
+               || (expression->isOr() && operand->isOr());
+    };
+    operands.erase(std::remove_if(operands.begin(), operands.end(), removable), operands.end());
+
+    // Collapse single-operand And/Or wrappers, the result and effects are the operand's
+    if ((expression->isAnd() || expression->isOr()) && operands.size() == 1
+        && keepNames.find(expression->getName()) == keepNames.end())
+    {
+        return operands.front();
+    }
+
+    return expression;
+}
+
 } // namespace builder::policy::factory
@@ -5,6 +5,7 @@
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -241,9 +242,15 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
 /**
  * @brief Build the assets of the policy.
  *
+ * When a cache tag is provided, built assets are reused across policy builds as long
+ * as their source document has not changed, so a rebuild after a single-asset edit
+ * only pays for that asset. The tag must encode every build flag that affects the
+ * produced expressions (e.g. trace and sandbox modes).
+ *
  * @param data Policy data.
  * @param store The store interface to query assets and namespaces.
  * @param assetBuilder The asset builder instance to build each asset.
+ * @param cacheTag Build flavor tag enabling the asset cache, empty to disable it.
  *
  * @return BuiltAssets
  *
@@ -251,7 +258,8 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
  */
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder);
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        const std::string& cacheTag = "");
 
 /**
  * @brief This struct contains the policy graphs by type.
@@ -303,6 +311,23 @@ Graph<base::Name, Asset> buildSubgraph(const std::string& subgraphName,
  */
 PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data);
 
+/**
+ * @brief Annotate an Or over sibling assets with the dispatch information their
+ * discriminants prove.
+ *
+ * Contiguous operands whose assets discriminate on the same field with pairwise
+ * distinct string literals can only be entered by the operand matching the
+ * field value, so the longest such run (of at least two operands) becomes a
+ * dispatch hint and a backend can replace its sequential scan with one probe.
+ * When every operand discriminates on one field with distinct scalar literals
+ * the node is additionally pinned mutually exclusive, allowing backends to
+ * evaluate the operands in any order.
+ *
+ * @param node Or node whose operands are the sibling asset expressions, in order.
+ * @param children Asset of each operand, aligned with the operand order.
+ */
+void annotateOrDispatch(const std::shared_ptr<base::Or>& node, const std::vector<const Asset*>& children);
+
 /**
  * @brief Generates the expression of a subgraph.
  *
@@ -321,14 +346,17 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
 
     auto root = ChildOperator::create(subgraph.rootId(), {});
 
+    // Map the node names once to dense indexes and traverse the CSR adjacency, instead of
+    // hashing the full asset names on every visit.
+    const typename Graph<base::Name, Asset>::Compact compact(subgraph);
+
     // Avoid duplicating nodes when multiple parents has the same child node
-    std::map<std::string, base::Expression> builtNodes;
+    std::vector<base::Expression> builtNodes(compact.size());
 
-    // parentNode Expression is passed as filters need it.
-    auto visit = [&](const std::string& current, const std::string& parent, auto& visitRef) -> base::Expression
+    auto visit = [&](const size_t current, auto& visitRef) -> base::Expression
     {
         // If node is already built, return it
-        if (builtNodes.find(current) != builtNodes.end())
+        if (builtNodes[current])
         {
             return builtNodes[current];
         }
@@ -338,19 +366,26 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
             // If node has children, create an auxiliary Implication node, with
             // asset as condition and children as consequence, otherwise create an
             // asset node.
-            auto asset = subgraph.node(current);
+            const auto& asset = compact.value(current);
             std::shared_ptr<base::Operation> assetNode;
 
-            if (subgraph.hasChildren(current))
+            if (compact.hasChildren(current))
             {
                 auto assetChildren = ChildOperator::create(asset.name() + "Children", {});
 
                 assetNode = base::Implication::create(asset.name() + "Node", asset.expression(), assetChildren);
 
                 // Visit children and add them to the children node
-                for (auto& child : subgraph.children(current))
+                std::vector<const Asset*> childAssets;
+                for (const auto child : compact.children(current))
+                {
+                    assetChildren->getOperands().push_back(visitRef(child, visitRef));
+                    childAssets.push_back(&compact.value(child));
+                }
+
+                if constexpr (std::is_same_v<ChildOperator, base::Or>)
                 {
-                    assetChildren->getOperands().push_back(visitRef(child, current, visitRef));
+                    annotateOrDispatch(assetChildren, childAssets);
                 }
             }
             else
@@ -362,7 +397,7 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
             // Add it to builtNodes
             if (asset.parents().size() > 1)
             {
-                builtNodes.insert(std::make_pair(current, assetNode));
+                builtNodes[current] = assetNode;
             }
 
             return assetNode;
@@ -370,9 +405,16 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
     };
 
     // Visit root childs and add them to the root expression
-    for (auto& child : subgraph.children(subgraph.rootId()))
+    std::vector<const Asset*> rootAssets;
+    for (const auto child : compact.children(compact.rootIndex()))
     {
-        root->getOperands().push_back(visit(child, subgraph.rootId(), visit));
+        root->getOperands().push_back(visit(child, visit));
+        rootAssets.push_back(&compact.value(child));
+    }
+
+    if constexpr (std::is_same_v<ChildOperator, base::Or>)
+    {
+        annotateOrDispatch(root, rootAssets);
     }
 
     return root;
@@ -390,6 +432,28 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
  */
 base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data);
 
+/**
+ * @brief Structural optimization pass over the policy expression graph.
+ *
+ * Shrinks the graph handed to the backend, every surviving node costs an indirect call
+ * per event. The pass:
+ * - Drops empty operations from Chain and Broadcast operands, their result is ignored
+ *   and they compute nothing.
+ * - Drops empty same-type operands of And/Or nodes, they are the identity of the parent.
+ * - Collapses single-operand And/Or wrappers into their operand.
+ *
+ * Nodes whose name is in @p keepNames are never dropped nor collapsed, tracing
+ * subscribes to asset nodes by name. Or nodes carrying a dispatch hint or an
+ * exclusivity pin keep their operand list untouched, the annotations reference
+ * operands by index.
+ *
+ * @param expression Policy expression to optimize, modified in place.
+ * @param keepNames Names of nodes that must be preserved.
+ * @return base::Expression The optimized expression.
+ */
+base::Expression optimizeExpression(const base::Expression& expression,
+                                    const std::unordered_set<std::string>& keepNames = {});
+
 } // namespace builder::policy::factory
 
 #endif // _BUILDER_POLICY_FACTORY_HPP
@@ -38,7 +38,10 @@ Policy::Policy(const store::Doc& doc,
     buildCtx->setAllowedFields(allowedFields);
 
     auto assetBuilder = std::make_shared<AssetBuilder>(buildCtx, definitionsBuilder);
-    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder);
+    // The cache tag encodes the build flags, so cached assets are only reused by
+    // builds of the same flavor
+    auto builtAssets =
+        factory::buildAssets(policyData, store, assetBuilder, fmt::format("{:d}{:d}", trace, sandbox));
 
     // Assign the assets
     for (const auto& [type, assets] : builtAssets)
@@ -54,8 +57,15 @@ Policy::Policy(const store::Doc& doc,
     auto policyGraph = factory::buildGraph(builtAssets, policyData);
     // TODO: Assign graphiv string
 
-    // Build the expression
-    m_expression = factory::buildExpression(policyGraph, policyData);
+    // Build the expression and shrink the no-op wrapper nodes; asset nodes are kept
+    // as-is because tracing subscribes to them by name
+    std::unordered_set<std::string> assetNames;
+    assetNames.reserve(m_assets.size());
+    for (const auto& asset : m_assets)
+    {
+        assetNames.insert(asset.toStr());
+    }
+    m_expression = factory::optimizeExpression(factory::buildExpression(policyGraph, policyData), assetNames);
 }
 
 } // namespace builder::policy
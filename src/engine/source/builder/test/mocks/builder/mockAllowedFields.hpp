@@ -11,6 +11,10 @@ class MockAllowedFields : public IAllowedFields
 {
 public:
     MOCK_METHOD(bool, check, (const base::Name& assetType, const DotPath& field), (const, override));
+    MOCK_METHOD(std::function<bool(std::string_view)>,
+                childChecker,
+                (const base::Name& assetType, const DotPath& parent),
+                (const, override));
 };
 } // namespace builder::mocks
 
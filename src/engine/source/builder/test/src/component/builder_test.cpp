@@ -108,23 +108,18 @@ TEST_P(BuildPolicy, Doc)
                                [](const json::Json& jsonName, const base::Name& baseName)
                                { return jsonName.getString().value() == baseName.toStr(); }));
 
+        // The optimization pass collapses the single-operand wrapper nodes
+        // (decoder/Input, stage.check, Children, condition), asset nodes are preserved
         auto expectedExpression = base::Chain::create(
             "policy/test/0",
-            {base::Or::create(
-                "decoder/Input",
-                {base::Implication::create(
-                    "decoder/parent-test/0/Node",
-                    base::And::create("decoder/parent-test/0",
-                                      {base::And::create("condition",
-                                                         {base::And::create("stage.check",
-                                                                            {base::Term<base::EngineOp>::create(
-                                                                                "event.code: filter(2)", {})}),
-                                                          base::Term<base::EngineOp>::create("AcceptAll", {})})}),
-                    base::Or::create("decoder/parent-test/0/Children",
-                                     {base::And::create("decoder/test/0",
-                                                        {base::And::create("condition",
-                                                                           {base::Term<base::EngineOp>::create(
-                                                                               "AcceptAll", {})})})}))})});
+            {base::Implication::create(
+                "decoder/parent-test/0/Node",
+                base::And::create(
+                    "decoder/parent-test/0",
+                    {base::And::create("condition",
+                                       {base::Term<base::EngineOp>::create("event.code: filter(2)", {}),
+                                        base::Term<base::EngineOp>::create("AcceptAll", {})})}),
+                base::And::create("decoder/test/0", {base::Term<base::EngineOp>::create("AcceptAll", {})}))});
         assertEqualExpr(expectedExpression, policyExpected->expression());
     }
     else
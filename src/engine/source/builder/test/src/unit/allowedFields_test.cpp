@@ -225,3 +225,59 @@ TEST(AllowedFieldsTest, CheckRootField)
     ASSERT_FALSE(allowedFields.check("filter", DotPath::append(rootPath, "field3")));
     ASSERT_FALSE(allowedFields.check("output", DotPath::append(rootPath, "field3")));
 }
+
+TEST(AllowedFieldsTest, ChildChecker)
+{
+    json::Json definition {
+        R"({
+            "name": "schema/allowed-fields/0",
+            "allowed_fields": {
+                "decoder": ["target.field1", "target.nested.field2", "other.field3"]
+            }
+        })"};
+
+    AllowedFields allowedFields {definition};
+
+    auto checker = allowedFields.childChecker("decoder", DotPath {"target"});
+    ASSERT_TRUE(checker);
+    ASSERT_TRUE(checker("field1"));
+    ASSERT_TRUE(checker("nested.field2"));
+    ASSERT_FALSE(checker("field3"));
+    ASSERT_FALSE(checker("nested"));
+}
+
+TEST(AllowedFieldsTest, ChildCheckerRoot)
+{
+    json::Json definition {
+        R"({
+            "name": "schema/allowed-fields/0",
+            "allowed_fields": {
+                "decoder": ["field1", "target.field2"]
+            }
+        })"};
+
+    AllowedFields allowedFields {definition};
+
+    auto checker = allowedFields.childChecker("decoder", DotPath {"."});
+    ASSERT_TRUE(checker);
+    ASSERT_TRUE(checker("field1"));
+    ASSERT_TRUE(checker("target.field2"));
+    ASSERT_FALSE(checker("field2"));
+}
+
+TEST(AllowedFieldsTest, ChildCheckerUnrestricted)
+{
+    json::Json definition {
+        R"({
+            "name": "schema/allowed-fields/0",
+            "allowed_fields": {
+                "decoder": ["target.field1"]
+            }
+        })"};
+
+    AllowedFields allowedFields {definition};
+
+    // No restrictions for the asset type: no checker, callers skip the per-field loop
+    ASSERT_FALSE(allowedFields.childChecker("rule", DotPath {"target"}));
+    ASSERT_FALSE(AllowedFields {}.childChecker("decoder", DotPath {"target"}));
+}
@@ -63,6 +63,9 @@ protected:
         ON_CALL(*mocks->ctx, allowedFields()).WillByDefault(testing::ReturnRef(*(mocks->allowedFields)));
 
         ON_CALL(*mocks->allowedFields, check(testing::_, testing::_)).WillByDefault(testing::Return(true));
+        // An empty checker means unrestricted, matching the check default above
+        ON_CALL(*mocks->allowedFields, childChecker(testing::_, testing::_))
+            .WillByDefault(testing::Return(std::function<bool(std::string_view)> {}));
         ON_CALL(*mocks->ctx, allowedFieldsPtr()).WillByDefault(testing::Return(mocks->allowedFields));
 
         mocks->context.policyName = "policy/name/0";
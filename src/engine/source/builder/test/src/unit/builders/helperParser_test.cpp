@@ -193,6 +193,25 @@ TEST_P(ParseHelperTest, parse)
     parserTest<HelperToken>(input, getHelperParser(true), expected, cmpFn);
 }
 
+TEST(ParseHelperExpressionTest, CachesRepeatedExpressions)
+{
+    const std::string expression = "parse_json($event.original)";
+
+    const auto first = parseHelperExpression(expression);
+    ASSERT_TRUE(first.success());
+    ASSERT_EQ(first.value().name, "parse_json");
+    ASSERT_EQ(first.value().args.size(), 1);
+
+    // The second parse is served from the cache and shares the argument objects.
+    const auto second = parseHelperExpression(expression);
+    ASSERT_TRUE(second.success());
+    ASSERT_EQ(second.value().name, first.value().name);
+    ASSERT_EQ(second.value().args, first.value().args);
+
+    // Failures keep reporting through the parser result.
+    ASSERT_FALSE(parseHelperExpression("not a helper(").success());
+}
+
 using IsDefaultT = std::tuple<std::string, bool>;
 class IsDefaultHelperTest : public ::testing::TestWithParam<IsDefaultT>
 {
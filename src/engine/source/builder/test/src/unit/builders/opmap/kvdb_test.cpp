@@ -819,8 +819,9 @@ INSTANTIATE_TEST_SUITE_P(
                                customRefExpected("ref", "target")(mocks);
                                EXPECT_CALL(*mocks.allowedFields, check(testing::_, DotPath("target")))
                                    .WillOnce(testing::Return(true));
-                               EXPECT_CALL(*mocks.allowedFields, check(testing::_, DotPath("target.notAllowed")))
-                                   .WillOnce(testing::Return(false));
+                               EXPECT_CALL(*mocks.allowedFields, childChecker(testing::_, DotPath("target")))
+                                   .WillOnce(testing::Return([](std::string_view field)
+                                                             { return field != "notAllowed"; }));
                                return None {};
                            })),
         /*** GET MERGE ***/
@@ -870,8 +871,9 @@ INSTANTIATE_TEST_SUITE_P(
                                customRefExpected("ref", "target")(mocks);
                                EXPECT_CALL(*mocks.allowedFields, check(testing::_, DotPath("target")))
                                    .WillOnce(testing::Return(true));
-                               EXPECT_CALL(*mocks.allowedFields, check(testing::_, DotPath("target.notAllowed")))
-                                   .WillOnce(testing::Return(false));
+                               EXPECT_CALL(*mocks.allowedFields, childChecker(testing::_, DotPath("target")))
+                                   .WillOnce(testing::Return([](std::string_view field)
+                                                             { return field != "notAllowed"; }));
                                return None {};
                            })),
         TransformDepsT(R"({"ref": "key"})",
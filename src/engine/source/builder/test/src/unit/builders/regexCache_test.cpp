@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+
+#include "builders/regexCache.hpp"
+
+using namespace builder::builders;
+
+TEST(RegexCacheTest, SamePatternSharesCompiledRegex)
+{
+    auto first = utils::compileRegex("^wazuh-(\\d+)$");
+    auto second = utils::compileRegex("^wazuh-(\\d+)$");
+
+    ASSERT_TRUE(first->ok());
+    ASSERT_EQ(first.get(), second.get());
+}
+
+TEST(RegexCacheTest, DifferentPatternsNotShared)
+{
+    auto first = utils::compileRegex("^first$");
+    auto second = utils::compileRegex("^second$");
+
+    ASSERT_TRUE(first->ok());
+    ASSERT_TRUE(second->ok());
+    ASSERT_NE(first.get(), second.get());
+}
+
+TEST(RegexCacheTest, InvalidPatternNotCached)
+{
+    auto first = utils::compileRegex("(unclosed");
+    auto second = utils::compileRegex("(unclosed");
+
+    ASSERT_FALSE(first->ok());
+    ASSERT_FALSE(second->ok());
+    ASSERT_NE(first.get(), second.get());
+}
+
+TEST(RegexCacheTest, ExpiredPatternRecompiled)
+{
+    std::weak_ptr<const RE2> weak;
+    {
+        auto first = utils::compileRegex("^expired-(\\d+)$");
+        weak = first;
+    }
+
+    // The cache holds weak references, it must not keep the pattern alive nor
+    // resurrect the expired entry on the next compile
+    ASSERT_TRUE(weak.expired());
+    auto second = utils::compileRegex("^expired-(\\d+)$");
+    ASSERT_TRUE(second->ok());
+    ASSERT_TRUE(weak.expired());
+}
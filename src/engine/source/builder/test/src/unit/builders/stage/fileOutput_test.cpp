@@ -70,6 +70,10 @@ class FileOutputTest : public ::testing::Test
 {
     void SetUp() override
     {
+        // Each test uses a fresh event, so the shared serialization cache must not
+        // carry over from a previous test.
+        base::event::advancePipelineEpoch();
+
         if (std::filesystem::exists(FILE_PATH))
         {
             std::filesystem::remove(FILE_PATH);
@@ -103,6 +107,8 @@ TEST_F(FileOutputTest, Write)
     auto msg = std::make_shared<json::Json>(messageStr);
     auto output = FileOutput(FILE_PATH);
     ASSERT_NO_THROW(output.write(msg));
+    // Events are buffered until a flush.
+    ASSERT_NO_THROW(output.flush());
 
     std::ifstream ifs(FILE_PATH);
     std::stringstream buffer;
@@ -110,4 +116,48 @@ TEST_F(FileOutputTest, Write)
 
     ASSERT_EQ(buffer.str(), compact_message);
 }
+
+TEST_F(FileOutputTest, WriteFlushesOnDestruction)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    {
+        auto output = FileOutput(FILE_PATH);
+        ASSERT_NO_THROW(output.write(msg));
+    }
+
+    std::ifstream ifs(FILE_PATH);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    ASSERT_EQ(buffer.str(), compact_message);
+}
+
+TEST_F(FileOutputTest, Rotation)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+
+    // Flush on every write and rotate after the first byte.
+    auto output = FileOutput(FILE_PATH, 1, FileOutput::DEFAULT_FLUSH_INTERVAL, 1);
+    ASSERT_NO_THROW(output.write(msg));
+    ASSERT_NO_THROW(output.write(msg));
+
+    // Every write overflowed the rotation size, so each one was rotated aside
+    // and the live file is left empty.
+    std::ifstream ifs(FILE_PATH);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+    ASSERT_TRUE(buffer.str().empty());
+
+    auto rotated = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::path(FILE_PATH).parent_path()))
+    {
+        const auto name = entry.path().filename().string();
+        if (name.rfind(std::filesystem::path(FILE_PATH).filename().string() + ".", 0) == 0)
+        {
+            ++rotated;
+            std::filesystem::remove(entry.path());
+        }
+    }
+    ASSERT_EQ(rotated, 2);
+}
 } // namespace fileoutputtest
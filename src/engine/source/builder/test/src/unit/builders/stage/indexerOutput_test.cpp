@@ -1,5 +1,7 @@
 #include <memory>
 
+#include <base/warmup.hpp>
+
 #include "builders/baseBuilders_test.hpp"
 #include "builders/stage/indexerOutput.hpp"
 
@@ -149,6 +151,28 @@ TEST_F(IndexerOutputOperationTest, output_success)
     ASSERT_EQ(*result.payload(), *event);
 }
 
+TEST_F(IndexerOutputOperationTest, output_discarded_during_warmup)
+{
+    auto iConnector = std::make_shared<indexerconnector::mocks::MockIConnector>();
+    auto builder = getIndexerOutputBuilder(iConnector);
+
+    EXPECT_CALL(*(mocks->ctx), runState());
+    auto expression = builder(definition, this->mocks->ctx);
+    auto event = std::make_shared<json::Json>(messageStr.c_str());
+
+    // Check the operation
+    auto operation = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+    ASSERT_TRUE(operation);
+
+    // Nothing must reach the connector while the warm-up guard is active
+    EXPECT_CALL(*iConnector, publish(testing::_)).Times(0);
+
+    base::warmup::Scope guard {};
+    auto result = operation(event);
+    ASSERT_TRUE(result.success());
+    ASSERT_EQ(*result.payload(), *event);
+}
+
 TEST_F(IndexerOutputOperationTest, output_fail)
 {
     std::shared_ptr<indexerconnector::mocks::MockIConnector> iConnector {nullptr};
@@ -81,6 +81,17 @@ INSTANTIATE_TEST_SUITE_P(
         StageT(R"z([{"target": "dummyOk()"}, {"target": "dummyThrow()"}, {"target": "dummyOk2()"}])z",
                mapBuilder,
                FAILURE(expectAnyMapHelper<OpBuilderEntry>(Helper<OpBuilderEntry> {"dummyOk", getDummyMap(true)},
-                                                          Helper<OpBuilderEntry> {"dummyThrow", getDummyMapThrow()})))),
+                                                          Helper<OpBuilderEntry> {"dummyThrow", getDummyMapThrow()}))),
+        // Consecutive in-place string transforms over the same target are fused into one term
+        StageT(R"z([{"target": "trim(both, ' ')"}, {"target": "downcase($target)"}])z",
+               mapBuilder,
+               SUCCESS(
+                   [](const auto& mocks)
+                   {
+                       EXPECT_CALL(*mocks.validator, validate(testing::_, testing::_))
+                           .WillOnce(testing::Return(schemf::ValidationResult()));
+                       return base::Chain::create(
+                           "stage.map", {dummyTerm("fused[target: trim(both, ' ') | target: downcase($target)]")});
+                   }))),
     testNameFormatter<StageBuilderTest>("Map"));
 } // namespace stagebuildtest
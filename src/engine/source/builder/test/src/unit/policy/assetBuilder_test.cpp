@@ -141,6 +141,59 @@ INSTANTIATE_TEST_SUITE_P(AssetBuilder,
 
 } // namespace getparentstest
 
+namespace getdiscriminanttest
+{
+using DiscriminantT = std::tuple<std::string, std::optional<Asset::Discriminant>>;
+
+std::optional<Asset::Discriminant> disc(const std::string& field, const std::string& literalJson)
+{
+    return Asset::Discriminant {field, json::Json(literalJson.c_str())};
+}
+
+using GetDiscriminant = AssetBuilderTest<DiscriminantT>;
+TEST_P(GetDiscriminant, Doc)
+{
+    auto [docStr, expected] = GetParam();
+
+    json::Json doc(docStr.c_str());
+    auto objDoc = doc.getObject().value();
+
+    auto got = m_assetBuilder->getDiscriminant(objDoc);
+    if (expected)
+    {
+        ASSERT_TRUE(got.has_value());
+        EXPECT_EQ(got->field, expected->field);
+        EXPECT_EQ(got->literal, expected->literal);
+    }
+    else
+    {
+        EXPECT_FALSE(got.has_value());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AssetBuilder,
+    GetDiscriminant,
+    ::testing::Values(
+        // Scalar literals in the first condition are recognized
+        DiscriminantT(R"({"check": [{"event.module": "sshd"}]})", disc("event.module", R"("sshd")")),
+        DiscriminantT(R"({"check": [{"event.code": 5}]})", disc("event.code", "5")),
+        DiscriminantT(R"({"check": [{"event.enabled": true}]})", disc("event.enabled", "true")),
+        // An escaped reference anchor is a plain literal
+        DiscriminantT(R"({"check": [{"field": "\\$value"}]})", disc("field", R"("$value")")),
+        // The definitions stage may precede the check stage
+        DiscriminantT(R"({"definitions": {}, "check": [{"field": "value"}]})", disc("field", R"("value")")),
+        // References, helper calls and non-scalar values are not literals
+        DiscriminantT(R"({"check": [{"field": "$reference"}]})", std::nullopt),
+        DiscriminantT(R"({"check": [{"field": "exists()"}]})", std::nullopt),
+        DiscriminantT(R"({"check": [{"field": ["value"]}]})", std::nullopt),
+        // Expression form, empty list and missing stage are never inspected
+        DiscriminantT(R"({"check": "field == value"})", std::nullopt),
+        DiscriminantT(R"({"check": []})", std::nullopt),
+        DiscriminantT(R"({"normalize": [{"map": [{"field": "value"}]}]})", std::nullopt)));
+
+} // namespace getdiscriminanttest
+
 namespace assetbuildexpressiontest
 {
 using SuccessExpected = InnerExpected<base::Expression, Mocks>;
@@ -355,6 +355,33 @@ INSTANTIATE_TEST_SUITE_P(
 
             ));
 
+TEST(BuildAssetsCache, ReusesUnchangedAssets)
+{
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+    factory::PolicyData policyData {
+        D {.name = "test",
+           .hash = "test",
+           .assets = {{factory::PolicyData::AssetType::DECODER, {{"ns", {{"decoder/asset"}}}}}}}};
+
+    store::Doc assetDoc;
+    base::Name assetName {"decoder/asset"};
+    EXPECT_CALL(*store, readDoc(assetName)).WillRepeatedly(testing::Return(storeReadDocResp(assetDoc)));
+    // The builder runs once, the second build is served from the cache
+    EXPECT_CALL(*assetBuilder, CallableOp(assetDoc))
+        .WillOnce(testing::Return(
+            Asset {base::Name {assetName}, buildgraphtest::assetExpr("decoder/asset"), std::vector<base::Name> {}}));
+
+    factory::BuiltAssets first;
+    ASSERT_NO_THROW(first = factory::buildAssets(policyData, store, assetBuilder, "cachetest"));
+    factory::BuiltAssets second;
+    ASSERT_NO_THROW(second = factory::buildAssets(policyData, store, assetBuilder, "cachetest"));
+
+    // Both builds share the same compiled expression subtree
+    ASSERT_EQ(first.at(factory::PolicyData::AssetType::DECODER).at(assetName).expression(),
+              second.at(factory::PolicyData::AssetType::DECODER).at(assetName).expression());
+}
+
 } // namespace buildassetstest
 
 namespace buildgraphtest
@@ -801,3 +828,206 @@ INSTANTIATE_TEST_SUITE_P(
             ));
 
 } // namespace buildexpressiontest
+
+namespace optimizeexpressiontest
+{
+using AD = buildgraphtest::AssetData;
+using buildgraphtest::assetExpr;
+using namespace base;
+
+TEST(OptimizeExpression, CollapsesSingleOperandWrappers)
+{
+    // Input wrapper and the asset inner And collapse, the protected asset node stays
+    auto expression =
+        Chain::create("policy/testname", {Or::create("decoder/Input", {assetExpr("decoder/asset")})});
+    auto expected = Chain::create("policy/testname",
+                                  {And::create("decoder/asset", {Term<int>::create("fake", 0)})});
+
+    auto got = factory::optimizeExpression(expression, {"decoder/asset"});
+    builder::test::assertEqualExpr(got, expected);
+}
+
+TEST(OptimizeExpression, UnprotectedNodesCollapseToTerm)
+{
+    auto expression =
+        Chain::create("policy/testname", {Or::create("decoder/Input", {assetExpr("decoder/asset")})});
+    auto expected = Chain::create("policy/testname", {Term<int>::create("fake", 0)});
+
+    auto got = factory::optimizeExpression(expression, {});
+    builder::test::assertEqualExpr(got, expected);
+}
+
+TEST(OptimizeExpression, RemovesEmptyOperationsFromChain)
+{
+    auto expression = Chain::create(
+        "policy/testname", {Or::create("decoder/Input", {}), Broadcast::create("rule/Input", {})});
+    auto expected = Chain::create("policy/testname", {});
+
+    auto got = factory::optimizeExpression(expression, {});
+    builder::test::assertEqualExpr(got, expected);
+}
+
+TEST(OptimizeExpression, KeepsEmptyOperandWhenResultMatters)
+{
+    // An empty And is true, removing it from an Or would change the result
+    auto expression = Or::create("or", {And::create("empty", {}), Term<int>::create("fake", 0)});
+    auto expected = Or::create("or", {And::create("empty", {}), Term<int>::create("fake", 0)});
+
+    auto got = factory::optimizeExpression(expression, {"or"});
+    builder::test::assertEqualExpr(got, expected);
+}
+
+TEST(OptimizeExpression, OptimizesImplicationOperands)
+{
+    auto expression = Implication::create("asset/Node",
+                                          Or::create("cond", {Term<int>::create("fake", 0)}),
+                                          Or::create("children", {Term<int>::create("fake", 0)}));
+    auto expected =
+        Implication::create("asset/Node", Term<int>::create("fake", 0), Term<int>::create("fake", 0));
+
+    auto got = factory::optimizeExpression(expression, {});
+    builder::test::assertEqualExpr(got, expected);
+}
+
+TEST(OptimizeExpression, KeepsAnnotatedOrUntouched)
+{
+    // The annotations reference operands by index, a pinned Or must not be
+    // collapsed or have operands erased
+    auto orNode = Or::create("decoder/Input", {Term<int>::create("fake", 0)});
+    orNode->setMutuallyExclusive();
+    auto expression = Chain::create("policy/testname", {orNode});
+
+    auto got = factory::optimizeExpression(expression, {});
+    ASSERT_TRUE(got->isChain());
+    ASSERT_EQ(got->getPtr<Chain>()->getOperands().size(), 1);
+    ASSERT_EQ(got->getPtr<Chain>()->getOperands()[0], orNode);
+}
+
+} // namespace optimizeexpressiontest
+
+namespace annotateordispatchtest
+{
+using namespace base;
+
+Asset discAsset(const std::string& name, const std::string& field, const std::string& literalJson)
+{
+    return Asset {base::Name {name},
+                  Term<int>::create("fake", 0),
+                  std::vector<base::Name> {},
+                  Asset::Discriminant {field, json::Json(literalJson.c_str())}};
+}
+
+Asset plainAsset(const std::string& name)
+{
+    return Asset {base::Name {name}, Term<int>::create("fake", 0), std::vector<base::Name> {}};
+}
+
+std::shared_ptr<Or> orNodeFor(const std::vector<Asset>& children)
+{
+    std::vector<Expression> operands;
+    for (const auto& child : children)
+    {
+        operands.emplace_back(child.expression());
+    }
+    return Or::create("decoder/Input", std::move(operands));
+}
+
+std::vector<const Asset*> ptrs(const std::vector<Asset>& children)
+{
+    std::vector<const Asset*> out;
+    for (const auto& child : children)
+    {
+        out.emplace_back(&child);
+    }
+    return out;
+}
+
+TEST(AnnotateOrDispatch, HintsAndPinsStringRun)
+{
+    std::vector<Asset> children {discAsset("decoder/a/0", "event.module", R"("sshd")"),
+                                 discAsset("decoder/b/0", "event.module", R"("apache")"),
+                                 discAsset("decoder/c/0", "event.module", R"("journald")")};
+    auto node = orNodeFor(children);
+
+    factory::annotateOrDispatch(node, ptrs(children));
+
+    EXPECT_TRUE(node->isMutuallyExclusive());
+    ASSERT_TRUE(node->dispatchHint());
+    EXPECT_EQ(node->dispatchHint()->field, "/event/module");
+    EXPECT_EQ(node->dispatchHint()->first, 0);
+    EXPECT_EQ(node->dispatchHint()->count, 3);
+    EXPECT_EQ(node->dispatchHint()->cases.at("sshd"), 0);
+    EXPECT_EQ(node->dispatchHint()->cases.at("apache"), 1);
+    EXPECT_EQ(node->dispatchHint()->cases.at("journald"), 2);
+}
+
+TEST(AnnotateOrDispatch, HintsTheRunWithoutPinning)
+{
+    // An undiscriminated sibling forbids the pin but not the run hint
+    std::vector<Asset> children {plainAsset("decoder/a/0"),
+                                 discAsset("decoder/b/0", "event.module", R"("sshd")"),
+                                 discAsset("decoder/c/0", "event.module", R"("apache")")};
+    auto node = orNodeFor(children);
+
+    factory::annotateOrDispatch(node, ptrs(children));
+
+    EXPECT_FALSE(node->isMutuallyExclusive());
+    ASSERT_TRUE(node->dispatchHint());
+    EXPECT_EQ(node->dispatchHint()->first, 1);
+    EXPECT_EQ(node->dispatchHint()->count, 2);
+}
+
+TEST(AnnotateOrDispatch, NumbersPinWithoutHint)
+{
+    // Distinct non-string literals prove exclusivity but cannot key a dispatch
+    std::vector<Asset> children {discAsset("decoder/a/0", "event.code", "1"),
+                                 discAsset("decoder/b/0", "event.code", "2")};
+    auto node = orNodeFor(children);
+
+    factory::annotateOrDispatch(node, ptrs(children));
+
+    EXPECT_TRUE(node->isMutuallyExclusive());
+    EXPECT_FALSE(node->dispatchHint());
+}
+
+TEST(AnnotateOrDispatch, LiteralTypesAreDistinct)
+{
+    // "5" the string never collides with 5 the number
+    std::vector<Asset> children {discAsset("decoder/a/0", "event.code", R"("5")"),
+                                 discAsset("decoder/b/0", "event.code", "5")};
+    auto node = orNodeFor(children);
+
+    factory::annotateOrDispatch(node, ptrs(children));
+
+    EXPECT_TRUE(node->isMutuallyExclusive());
+    EXPECT_FALSE(node->dispatchHint());
+}
+
+TEST(AnnotateOrDispatch, MixedFieldsAreNotAnnotated)
+{
+    std::vector<Asset> children {discAsset("decoder/a/0", "event.module", R"("sshd")"),
+                                 discAsset("decoder/b/0", "event.provider", R"("apache")")};
+    auto node = orNodeFor(children);
+
+    factory::annotateOrDispatch(node, ptrs(children));
+
+    EXPECT_FALSE(node->isMutuallyExclusive());
+    EXPECT_FALSE(node->dispatchHint());
+}
+
+TEST(AnnotateOrDispatch, DuplicateLiteralsBreakTheRun)
+{
+    std::vector<Asset> children {discAsset("decoder/a/0", "event.module", R"("sshd")"),
+                                 discAsset("decoder/b/0", "event.module", R"("sshd")"),
+                                 discAsset("decoder/c/0", "event.module", R"("apache")")};
+    auto node = orNodeFor(children);
+
+    factory::annotateOrDispatch(node, ptrs(children));
+
+    EXPECT_FALSE(node->isMutuallyExclusive());
+    ASSERT_TRUE(node->dispatchHint());
+    EXPECT_EQ(node->dispatchHint()->first, 1);
+    EXPECT_EQ(node->dispatchHint()->count, 2);
+}
+
+} // namespace annotateordispatchtest
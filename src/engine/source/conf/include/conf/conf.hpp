@@ -1,10 +1,13 @@
 #ifndef _CONFIG_CONFIG_HPP
 #define _CONFIG_CONFIG_HPP
 
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -61,6 +64,11 @@ private:
     std::unordered_map<std::string, std::shared_ptr<internal::BaseUnitConf>> m_units; ///< The configuration units.
     std::shared_ptr<IApiLoader> m_apiLoader;                                          ///< The API loader.
 
+    /// Callbacks to apply runtime-tunable keys when a reload changes them.
+    std::unordered_map<std::string, std::vector<std::function<void()>>> m_callbacks;
+
+    mutable std::shared_mutex m_mutex; ///< Readers take it shared, load/reload exclusively.
+
     /**
      * @brief Validate the configuration
      *
@@ -87,6 +95,31 @@ public:
      */
     void load();
 
+    /**
+     * @brief Reload the configuration from the framework API without restarting.
+     *
+     * Fetches and validates a fresh configuration, swaps it in and invokes the
+     * callbacks registered with onChange for every key whose effective value changed.
+     * Keys pinned by an environment variable never change at runtime and are skipped.
+     * Callbacks run outside the internal lock, so they can read the new values
+     * through get(); a throwing callback is logged and does not stop the others.
+     *
+     * @return std::vector<std::string> The keys whose value changed.
+     * @throw std::logic_error If the configuration was never loaded.
+     * @throw std::runtime_error If the new configuration is invalid or cannot be
+     * retrieved; the previous configuration stays in effect.
+     */
+    std::vector<std::string> reload();
+
+    /**
+     * @brief Register a callback invoked when a reload changes the value of the key.
+     *
+     * @param key The registered configuration key to watch.
+     * @param callback The callback to invoke.
+     * @throw std::runtime_error If the key is not registered.
+     */
+    void onChange(std::string_view key, std::function<void()> callback);
+
     /**
      * @brief Add a new configuration unit.
      *
@@ -140,6 +173,8 @@ public:
     template<typename T>
     T get(std::string_view key) const
     {
+        std::shared_lock lock {m_mutex};
+
         if (m_units.find(key.data()) == m_units.end())
         {
             throw std::runtime_error(
@@ -9,8 +9,13 @@ namespace conf::key
 constexpr std::string_view LOGGING_LEVEL = "/engine/logging/level";
 
 constexpr std::string_view STORE_PATH = "/engine/store/path";
+constexpr std::string_view STORE_DOC_CACHE_SIZE = "/engine/store/doc_cache_size";
+constexpr std::string_view STORE_WATCH = "/engine/store/watch";
 
 constexpr std::string_view KVDB_PATH = "/engine/kvdb/path";
+constexpr std::string_view KVDB_BLOCK_CACHE_SIZE = "/engine/kvdb/block_cache_size";
+constexpr std::string_view KVDB_BLOOM_FILTER_BITS = "/engine/kvdb/bloom_filter_bits";
+constexpr std::string_view KVDB_COMPRESSION = "/engine/kvdb/compression";
 
 constexpr std::string_view INDEXER_INDEX = "/indexer/index";
 constexpr std::string_view INDEXER_HOST = "/indexer/hosts";
@@ -31,12 +36,30 @@ constexpr std::string_view QUEUE_FLOOD_FILE = "/engine/queue/flood_file";
 constexpr std::string_view QUEUE_FLOOD_ATTEMPS = "/engine/queue/flood_attempts";
 constexpr std::string_view QUEUE_FLOOD_SLEEP = "/engine/queue/flood_sleep";
 constexpr std::string_view QUEUE_DROP_ON_FLOOD = "/engine/queue/drop_on_flood";
+constexpr std::string_view QUEUE_FLOOD_REPLAY = "/engine/queue/flood_replay";
+
+constexpr std::string_view SHUTDOWN_TIMEOUT = "/engine/shutdown/timeout";
 
 constexpr std::string_view ORCHESTRATOR_THREADS = "/engine/orchestrator/threads";
+constexpr std::string_view ORCHESTRATOR_PIN_WORKERS = "/engine/orchestrator/pin_workers";
+constexpr std::string_view ORCHESTRATOR_LATENCY_SAMPLE = "/engine/orchestrator/latency_sample_every";
+constexpr std::string_view ORCHESTRATOR_STICKY_WORKERS = "/engine/orchestrator/sticky_workers";
+constexpr std::string_view ORCHESTRATOR_TENANT_KEY = "/engine/orchestrator/tenant_key";
+constexpr std::string_view ORCHESTRATOR_TENANT_WORKERS = "/engine/orchestrator/tenant_workers";
+constexpr std::string_view ORCHESTRATOR_SNAPSHOT_INTERVAL = "/engine/orchestrator/snapshot_interval";
+constexpr std::string_view ORCHESTRATOR_GOVERNOR_INTERVAL = "/engine/orchestrator/governor_interval";
+constexpr std::string_view ORCHESTRATOR_GOVERNOR_SHED_ENTER = "/engine/orchestrator/governor_shed_enter";
+constexpr std::string_view ORCHESTRATOR_GOVERNOR_SHED_EXIT = "/engine/orchestrator/governor_shed_exit";
+constexpr std::string_view ORCHESTRATOR_GOVERNOR_LIMIT_ENTER = "/engine/orchestrator/governor_limit_enter";
+constexpr std::string_view ORCHESTRATOR_GOVERNOR_LIMIT_EXIT = "/engine/orchestrator/governor_limit_exit";
+constexpr std::string_view ORCHESTRATOR_COMPILED_EVAL = "/engine/orchestrator/compiled_eval";
 
 constexpr std::string_view SERVER_EVENT_SOCKET = "/engine/server/event_socket";
 constexpr std::string_view SERVER_API_SOCKET = "/engine/server/api_socket";
 constexpr std::string_view SERVER_API_TIMEOUT = "/engine/server/api_timeout";
+constexpr std::string_view SERVER_API_THREADS = "/engine/server/api_threads";
+constexpr std::string_view SERVER_EVENT_THREADS = "/engine/server/event_threads";
+constexpr std::string_view SERVER_EVENT_STREAM_SOCKET = "/engine/server/event_stream_socket";
 
 constexpr std::string_view TZDB_PATH = "/engine/tzdb/path";
 constexpr std::string_view TZDB_AUTO_UPDATE = "/engine/tzdb/auto_update";
@@ -44,6 +67,8 @@ constexpr std::string_view TZDB_AUTO_UPDATE = "/engine/tzdb/auto_update";
 constexpr std::string_view METRICS_ENABLED = "/engine/metrics/enabled";
 constexpr std::string_view METRICS_EXPORT_INTERVAL = "/engine/metrics/export_interval";
 constexpr std::string_view METRICS_EXPORT_TIMEOUT = "/engine/metrics/export_timeout";
+constexpr std::string_view METRICS_FOLD_INTERVAL = "/engine/metrics/fold_interval";
+constexpr std::string_view METRICS_SAMPLE_EVERY = "/engine/metrics/sample_every";
 
 }; // namespace conf::key
 
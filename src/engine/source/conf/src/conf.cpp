@@ -1,5 +1,6 @@
 #include <conf/conf.hpp>
 
+#include <cstdlib>
 #include <unistd.h>
 
 #include <fmt/format.h>
@@ -43,9 +44,15 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
 
     // Store module
     addUnit<std::string>(key::STORE_PATH, "WAZUH_STORE_PATH", "/var/lib/wazuh-server/engine/store");
+    // Decoded documents kept resident between reads, 0 disables the cache
+    addUnit<int>(key::STORE_DOC_CACHE_SIZE, "WAZUH_STORE_DOC_CACHE_SIZE", 128);
+    addUnit<bool>(key::STORE_WATCH, "WAZUH_STORE_WATCH", true);
 
     // KVDB module
     addUnit<std::string>(key::KVDB_PATH, "WAZUH_KVDB_PATH", "/var/lib/wazuh-server/engine/kvdb/");
+    addUnit<int>(key::KVDB_BLOCK_CACHE_SIZE, "WAZUH_KVDB_BLOCK_CACHE_SIZE", 64 * 1024 * 1024);
+    addUnit<int>(key::KVDB_BLOOM_FILTER_BITS, "WAZUH_KVDB_BLOOM_FILTER_BITS", 10);
+    addUnit<bool>(key::KVDB_COMPRESSION, "WAZUH_KVDB_COMPRESSION", true);
 
     // Indexer connector
     addUnit<std::string>(key::INDEXER_INDEX, "WAZUH_INDEXER_INDEX", "wazuh-alerts-5.x-0001");
@@ -71,16 +78,52 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
     addUnit<int>(key::QUEUE_FLOOD_SLEEP, "WAZUH_QUEUE_FLOOD_SLEEP", 100);
     // If enabled, the queue will drop the flood events instead of storing them in the file.
     addUnit<bool>(key::QUEUE_DROP_ON_FLOOD, "WAZUH_QUEUE_DROP_ON_FLOOD", true);
+    // If enabled, flooded events are reinjected in the background while the queue has spare capacity.
+    addUnit<bool>(key::QUEUE_FLOOD_REPLAY, "WAZUH_QUEUE_FLOOD_REPLAY", false);
+
+    // Shutdown
+    // Milliseconds granted to the exit handlers before a wedged one is abandoned.
+    addUnit<int>(key::SHUTDOWN_TIMEOUT, "WAZUH_SHUTDOWN_TIMEOUT", 5000);
 
     // Orchestrator module
     addUnit<int>(key::ORCHESTRATOR_THREADS, "WAZUH_ORCHESTRATOR_THREADS", 1);
+    // If enabled, each worker thread is pinned to a CPU core (round-robin).
+    addUnit<bool>(key::ORCHESTRATOR_PIN_WORKERS, "WAZUH_ORCHESTRATOR_PIN_WORKERS", false);
+    // One of every N events is stamped at ingress to measure end-to-end latency. 0 disables it.
+    addUnit<int>(key::ORCHESTRATOR_LATENCY_SAMPLE, "WAZUH_ORCHESTRATOR_LATENCY_SAMPLE", 1000);
+    // If enabled, events are dispatched to a per-worker queue by agent id, preserving per-agent order.
+    addUnit<bool>(key::ORCHESTRATOR_STICKY_WORKERS, "WAZUH_ORCHESTRATOR_STICKY_WORKERS", false);
+    // Event field (json pointer) holding the tenant name. Empty disables tenant worker lanes.
+    addUnit<std::string>(key::ORCHESTRATOR_TENANT_KEY, "WAZUH_ORCHESTRATOR_TENANT_KEY", "");
+    // "tenant:count" entries reserving count dedicated workers for each named tenant.
+    addUnit<std::vector<std::string>>(key::ORCHESTRATOR_TENANT_WORKERS, "WAZUH_ORCHESTRATOR_TENANT_WORKERS", {});
+    // Seconds between warm-state snapshots, 0 disables the periodic writes.
+    addUnit<int>(key::ORCHESTRATOR_SNAPSHOT_INTERVAL, "WAZUH_ORCHESTRATOR_SNAPSHOT_INTERVAL", 60);
+    // Overload governor: milliseconds between queue utilization samples (0 disables
+    // it) and the enter/exit utilization percentages of the shedding and EPS
+    // admission reactions. Separate enter/exit watermarks give each reaction
+    // hysteresis so it does not flap around a single boundary.
+    addUnit<int>(key::ORCHESTRATOR_GOVERNOR_INTERVAL, "WAZUH_ORCHESTRATOR_GOVERNOR_INTERVAL", 250);
+    addUnit<int>(key::ORCHESTRATOR_GOVERNOR_SHED_ENTER, "WAZUH_ORCHESTRATOR_GOVERNOR_SHED_ENTER", 75);
+    addUnit<int>(key::ORCHESTRATOR_GOVERNOR_SHED_EXIT, "WAZUH_ORCHESTRATOR_GOVERNOR_SHED_EXIT", 50);
+    addUnit<int>(key::ORCHESTRATOR_GOVERNOR_LIMIT_ENTER, "WAZUH_ORCHESTRATOR_GOVERNOR_LIMIT_ENTER", 90);
+    addUnit<int>(key::ORCHESTRATOR_GOVERNOR_LIMIT_EXIT, "WAZUH_ORCHESTRATOR_GOVERNOR_LIMIT_EXIT", 60);
+    // If enabled, events run through a flattened compiled program while no traces are subscribed.
+    addUnit<bool>(key::ORCHESTRATOR_COMPILED_EVAL, "WAZUH_ORCHESTRATOR_COMPILED_EVAL", false);
 
     // Http server module
     addUnit<std::string>(key::SERVER_API_SOCKET, "WAZUH_SERVER_API_SOCKET", "/run/wazuh-server/engine-api.socket");
     addUnit<int>(key::SERVER_API_TIMEOUT, "WAZUH_SERVER_API_TIMEOUT", 5000);
+    // Handler worker pool size per server, 0 keeps the httplib default
+    addUnit<int>(key::SERVER_API_THREADS, "WAZUH_SERVER_API_THREADS", 4);
+    addUnit<int>(key::SERVER_EVENT_THREADS, "WAZUH_SERVER_EVENT_THREADS", 4);
     addUnit<std::string>(key::SERVER_EVENT_SOCKET,
                          "WAZUH_SERVER_EVENT_SOCKET",
                          "/run/wazuh-server/engine.socket"); // /run/wazuh-server/queue
+    // Persistent framed-stream ingestion, alternative to the HTTP event endpoint
+    addUnit<std::string>(key::SERVER_EVENT_STREAM_SOCKET,
+                         "WAZUH_SERVER_EVENT_STREAM_SOCKET",
+                         "/run/wazuh-server/engine-stream.socket");
 
     // TZDB module
     addUnit<std::string>(key::TZDB_PATH, "WAZUH_TZDB_PATH", "/var/lib/wazuh-server/engine/tzdb");
@@ -90,6 +133,8 @@ Conf::Conf(std::shared_ptr<IApiLoader> apiLoader)
     addUnit<bool>(key::METRICS_ENABLED, "WAZUH_METRICS_ENABLED", false);
     addUnit<int64_t>(key::METRICS_EXPORT_INTERVAL, "WAZUH_METRICS_EXPORT_INTERVAL", 10000);
     addUnit<int64_t>(key::METRICS_EXPORT_TIMEOUT, "WAZUH_METRICS_EXPORT_TIMEOUT", 1000);
+    addUnit<int64_t>(key::METRICS_FOLD_INTERVAL, "WAZUH_METRICS_FOLD_INTERVAL", 100);
+    addUnit<int64_t>(key::METRICS_SAMPLE_EVERY, "WAZUH_METRICS_SAMPLE_EVERY", 1);
 };
 
 void Conf::validate(const json::Json& config) const
@@ -159,6 +204,8 @@ void Conf::validate(const json::Json& config) const
 
 void Conf::load()
 {
+    std::unique_lock lock {m_mutex};
+
     if (!m_apiConfig.isNull())
     {
         throw std::logic_error("The configuration is already loaded.");
@@ -168,4 +215,72 @@ void Conf::load()
     m_apiConfig = std::move(apiConf);
 }
 
+std::vector<std::string> Conf::reload()
+{
+    std::vector<std::string> changed;
+    std::vector<std::function<void()>> toNotify;
+
+    {
+        std::unique_lock lock {m_mutex};
+
+        if (m_apiConfig.isNull())
+        {
+            throw std::logic_error("The configuration is not loaded yet.");
+        }
+
+        json::Json apiConf = (*m_apiLoader)();
+        validate(apiConf);
+
+        for (const auto& [key, unit] : m_units)
+        {
+            // Keys pinned by an environment variable cannot change at runtime
+            if (std::getenv(unit->getEnv().c_str()) != nullptr)
+            {
+                continue;
+            }
+
+            if (m_apiConfig.str(key) == apiConf.str(key))
+            {
+                continue;
+            }
+
+            changed.push_back(key);
+            const auto it = m_callbacks.find(key);
+            if (it != m_callbacks.end())
+            {
+                toNotify.insert(toNotify.end(), it->second.begin(), it->second.end());
+            }
+        }
+
+        m_apiConfig = std::move(apiConf);
+    }
+
+    // Outside the lock so the callbacks can read the new values through get()
+    for (const auto& notify : toNotify)
+    {
+        try
+        {
+            notify();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Configuration reload callback failed: {}", e.what());
+        }
+    }
+
+    return changed;
+}
+
+void Conf::onChange(std::string_view key, std::function<void()> callback)
+{
+    std::unique_lock lock {m_mutex};
+
+    if (m_units.find(key.data()) == m_units.end())
+    {
+        throw std::runtime_error(fmt::format("The key '{}' is not found in the configuration options.", key.data()));
+    }
+
+    m_callbacks[key.data()].emplace_back(std::move(callback));
+}
+
 } // namespace conf
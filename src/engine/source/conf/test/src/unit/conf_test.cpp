@@ -522,4 +522,95 @@ TEST(ConfGet, badKey)
 
     EXPECT_THROW(conf.get<int>("/TEST"), std::runtime_error);
 }
+
+/************************************************************************
+ *                       Reload Test
+ ************************************************************************/
+namespace
+{
+// Mock API loader returning a different configuration on each call (load + reloads)
+std::shared_ptr<conf::mocks::MockApiLoader> createSequencedApiLoader(const std::vector<std::string>& jsons)
+{
+    auto mockApiLoader = std::make_shared<conf::mocks::MockApiLoader>();
+    auto& expectation = EXPECT_CALL(*mockApiLoader, load());
+    for (const auto& json : jsons)
+    {
+        expectation.WillOnce(testing::Return(json::Json(json.c_str())));
+    }
+    return mockApiLoader;
+}
+} // namespace
+
+TEST(ReloadTest, NotLoaded)
+{
+    conf::Conf conf(std::make_shared<conf::mocks::MockApiLoader>());
+    EXPECT_THROW(conf.reload(), std::logic_error);
+}
+
+TEST(ReloadTest, ChangedKeysAndCallbacks)
+{
+    auto mockApiLoader = createSequencedApiLoader({R"({"TEST_INT": 10})", R"({"TEST_INT": 42})"});
+    conf::Conf conf(mockApiLoader);
+    conf.addUnit("/TEST_INT", "TEST_RELOAD_ENV_INT", 0);
+    conf.addUnit("/TEST_STRING", "TEST_RELOAD_ENV_STRING", std::string("test"));
+
+    std::size_t changedCalls = 0;
+    std::size_t unchangedCalls = 0;
+    conf.onChange("/TEST_INT", [&]() { changedCalls++; });
+    conf.onChange("/TEST_STRING", [&]() { unchangedCalls++; });
+
+    conf.load();
+    EXPECT_EQ(conf.get<int>("/TEST_INT"), 10);
+
+    const auto changed = conf.reload();
+    ASSERT_EQ(changed, std::vector<std::string> {"/TEST_INT"});
+    EXPECT_EQ(changedCalls, 1);
+    EXPECT_EQ(unchangedCalls, 0);
+
+    // The callback and later readers see the new value
+    EXPECT_EQ(conf.get<int>("/TEST_INT"), 42);
+}
+
+TEST(ReloadTest, EnvPinnedKeySkipped)
+{
+    auto mockApiLoader = createSequencedApiLoader({R"({"TEST_INT": 10})", R"({"TEST_INT": 42})"});
+    conf::Conf conf(mockApiLoader);
+    conf.addUnit("/TEST_INT", "TEST_RELOAD_ENV_PINNED", 0);
+
+    std::size_t calls = 0;
+    conf.onChange("/TEST_INT", [&]() { calls++; });
+
+    setEnv("TEST_RELOAD_ENV_PINNED", "7");
+    conf.load();
+
+    const auto changed = conf.reload();
+    EXPECT_TRUE(changed.empty());
+    EXPECT_EQ(calls, 0);
+
+    // The environment variable keeps the priority over the API value
+    EXPECT_EQ(conf.get<int>("/TEST_INT"), 7);
+    unsetEnv("TEST_RELOAD_ENV_PINNED");
+}
+
+TEST(ReloadTest, InvalidConfigKeepsPrevious)
+{
+    auto mockApiLoader = createSequencedApiLoader({R"({"TEST_INT": 10})", R"({"TEST_INT": "invalid"})"});
+    conf::Conf conf(mockApiLoader);
+    conf.addUnit("/TEST_INT", "TEST_RELOAD_ENV_INVALID", 0);
+
+    std::size_t calls = 0;
+    conf.onChange("/TEST_INT", [&]() { calls++; });
+
+    conf.load();
+
+    EXPECT_THROW(conf.reload(), std::runtime_error);
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(conf.get<int>("/TEST_INT"), 10);
+}
+
+TEST(OnChangeTest, badKey)
+{
+    conf::Conf conf(std::make_shared<conf::mocks::MockApiLoader>());
+    EXPECT_THROW(conf.onChange("/TEST", []() {}), std::runtime_error);
+}
 } // namespace
@@ -2,8 +2,12 @@
 #define _DEFS_HPP_
 
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <base/json.hpp>
 #include <defs/idefinitions.hpp>
@@ -19,6 +23,12 @@ class Definitions : public IDefinitions
 private:
     std::unique_ptr<json::Json> m_definitions;
 
+    /// Precompiled ("$name", value) replacements, in inverse order of definition declaration.
+    std::vector<std::pair<std::string, std::string>> m_replacements;
+
+    mutable std::shared_mutex m_cacheMutex;                      ///< Protects the replacement cache.
+    mutable std::unordered_map<std::string, std::string> m_cache; ///< Replaced outputs by input string.
+
 public:
     Definitions() = default;
     ~Definitions() = default;
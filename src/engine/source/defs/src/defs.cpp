@@ -1,6 +1,8 @@
 #include "defs.hpp"
 
 #include <algorithm>
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 
 #include <fmt/format.h>
@@ -26,6 +28,15 @@ Definitions::Definitions(const json::Json& definitions)
     }
 
     m_definitions = std::make_unique<json::Json>(definitions);
+
+    // Precompile the replacements once, in inverse order of definition declaration, so that
+    // definitions can reference each other without causing infinite recursion
+    m_replacements.reserve(defVars.size());
+    for (auto def = defVars.rbegin(); def != defVars.rend(); ++def)
+    {
+        m_replacements.emplace_back("$" + std::get<0>(*def),
+                                    std::get<1>(*def).getString().value_or(std::get<1>(*def).str()));
+    }
 }
 
 json::Json Definitions::get(std::string_view name) const
@@ -51,34 +62,66 @@ std::string Definitions::replace(std::string_view input) const
         return std::string(input);
     }
 
-    // Replace in inverse order of definition declaration, so that definitions can reference each other
-    // without causing infinite recursion
     auto replaced = std::string(input);
-    auto defObj = m_definitions->getObject().value();
 
-    for (auto def = defObj.rbegin(); def != defObj.rend(); ++def)
+    // Assets are rebuilt with the same serialized values over and over, serve repeated inputs
+    // from the cache
+    {
+        std::shared_lock lock(m_cacheMutex);
+        if (const auto it = m_cache.find(replaced); it != m_cache.end())
+        {
+            return it->second;
+        }
+    }
+
+    for (const auto& [defName, defValue] : m_replacements)
     {
-        // Find and replace every occurrence of the definition name in the input string
-        std::string defName = "$" + std::get<0>(*def);
-        std::string defValue = std::get<1>(*def).getString().value_or(std::get<1>(*def).str());
+        // Find every occurrence of the definition name and splice the output into a new
+        // string, instead of repeatedly shifting the tail with in-place replacements
+        size_t pos = replaced.find(defName);
+        if (pos == std::string::npos)
+        {
+            continue;
+        }
 
-        size_t pos = 0;
-        while ((pos = replaced.find(defName, pos)) != std::string::npos)
+        std::string spliced;
+        spliced.reserve(replaced.size());
+        size_t last = 0;
+        while (pos != std::string::npos)
         {
-            // Check if the found $ is escaped with '\'
-            if (pos > 0 && replaced[pos - 1] == '\\')
+            // Check if the found $ is escaped with '\'. The preceding character is either in
+            // the pending region or, if the match is adjacent to the previous splice, at the
+            // end of the already spliced output.
+            const auto escaped =
+                (pos > last) ? (replaced[pos - 1] == '\\') : (!spliced.empty() && spliced.back() == '\\');
+
+            if (escaped)
             {
-                replaced.erase(pos - 1, 1);  // Remove the escape character '\'
-                pos += defName.length() - 1; // Counter the erase and move over the name
+                // Remove the escape character '\' and keep the name as written
+                if (pos > last)
+                {
+                    spliced.append(replaced, last, pos - 1 - last);
+                }
+                else
+                {
+                    spliced.pop_back();
+                }
+                spliced.append(defName);
             }
             else
             {
-                replaced.replace(pos, defName.length(), defValue);
-                pos += defValue.length(); // Move forward to avoid infinite loop
+                spliced.append(replaced, last, pos - last);
+                spliced.append(defValue);
             }
+
+            last = pos + defName.length();
+            pos = replaced.find(defName, last);
         }
+        spliced.append(replaced, last, std::string::npos);
+        replaced = std::move(spliced);
     }
 
-    return replaced;
+    std::unique_lock lock(m_cacheMutex);
+    return m_cache.emplace(std::string(input), std::move(replaced)).first->second;
 }
 } // namespace defs
@@ -96,4 +96,16 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(json::Json(R"({"a": "value"})"), "\\$a$a", "$avalue"),
                       std::make_tuple(json::Json(R"({"a": "value", "b": "$a", "c": "$b"})"), "$c", "value"),
                       std::make_tuple(json::Json(R"({"a": "$b", "b": "value"})"), "$a", "$b"),
-                      std::make_tuple(json::Json(R"({"a": "$a"})"), "$a", "$a")));
+                      std::make_tuple(json::Json(R"({"a": "$a"})"), "$a", "$a"),
+                      std::make_tuple(json::Json(R"({"a": "value"})"), "$a $a $a", "value value value")));
+
+TEST(DefsReplaceCacheTest, RepeatedReplaceIsStable)
+{
+    auto def = defs::Definitions(json::Json(R"({"a": "value", "b": "$a"})"));
+
+    // Repeated calls with the same input are served from the cache and must match
+    const auto first = def.replace("$b and \\$a");
+    ASSERT_EQ(first, "value and $a");
+    ASSERT_EQ(def.replace("$b and \\$a"), first);
+    ASSERT_EQ(def.replace("$a"), "value");
+}
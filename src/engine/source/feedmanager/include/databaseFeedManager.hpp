@@ -14,6 +14,7 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <regex>
 #include <shared_mutex>
 #include <string>
@@ -22,6 +23,7 @@
 #include <nlohmann/json.hpp>
 
 #include <base/lruCache.hpp>
+#include <base/utils/bloomFilter.hpp>
 #include <base/utils/rocksDBWrapper.hpp>
 
 #include "packageTranslation_generated.h"
@@ -166,6 +168,9 @@ public:
     /**
      * @brief Get the Vulnerabilities Candidates information.
      *
+     * @note When a package has many candidates their CVEs are evaluated on a worker pool, so the
+     * callback may be invoked from several threads at once and must be thread-safe.
+     *
      * @param cnaName RocksDB table identifier.
      * @param package Struct with package data.
      * @param callback Store vulnerability data.
@@ -302,6 +307,21 @@ private:
     std::unique_ptr<LRUCache<std::string, std::vector<PackageData>>> m_translationL1Cache =
         std::make_unique<LRUCache<std::string, std::vector<PackageData>>>(1024);
 
+    /**
+     * Protects the L1 translation cache and the translation filter, which are mutated
+     * while scans run. The L2 cache is only rebuilt during feed updates, which hold the
+     * feed mutex exclusively, so reads on it need no extra lock.
+     */
+    std::mutex m_translationCacheMutex;
+
+    /**
+     * Per-CNA Bloom filters over the package names present in each candidates column.
+     * Most packages on a host have no CVE candidates at all, so a definite miss here
+     * answers getVulnerabilitiesCandidates() from memory without a database seek.
+     * Rebuilt together with the global maps, under the exclusive feed mutex.
+     */
+    std::unordered_map<std::string, base::utils::bloom::BloomFilter> m_packagePrescreen;
+
     /**
      * @brief Reads the vendor and os cpe maps from the database and loads the data into memory.
      *
@@ -310,6 +330,15 @@ private:
      */
     void reloadGlobalMaps();
 
+    /**
+     * @brief Rebuilds the per-CNA package name Bloom filters from the feed database.
+     *
+     * Iterates the keys of every candidates column and inserts the package name prefix
+     * of each entry, so scans can discard packages with no candidates without touching
+     * the database.
+     */
+    void buildPackagePrescreenFilters();
+
     nlohmann::json m_cnaMappings;
     nlohmann::json m_vendorsMap;
     nlohmann::json m_cpeMappings;
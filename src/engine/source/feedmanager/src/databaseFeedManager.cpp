@@ -9,7 +9,9 @@
  * Foundation.
  */
 
+#include <algorithm>
 #include <filesystem>
+#include <thread>
 
 #include <base/logging.hpp>
 #include <fs/archiveHelper.hpp>
@@ -30,6 +32,7 @@ const std::filesystem::path VD_FEED_DB_BASE_PATH {WAZUH_LIB_PATH / "vd/"};
 const std::filesystem::path VD_UPDATER_DB_BASE_PATH {WAZUH_LIB_PATH / "vd_updater/"}; //< Path to the updater database.
 
 constexpr auto OFFSET_TRANSACTION_SIZE {1000};
+constexpr std::size_t PARALLEL_SCAN_MIN_CANDIDATES {128}; //< Candidates per extra worker when scanning one package.
 constexpr auto EMPTY_KEY {""};
 constexpr auto TRANSLATIONS_COLUMN {"translation"};
 constexpr auto VENDOR_MAP_COLUMN {"vendor_map"};
@@ -115,12 +118,9 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
     {
         // logInfo(WM_VULNSCAN_LOGTAG, "Initiating update feed process.");
         processMessage(message, topicName, orchestrationLambda);
-        auto eventContext =
-            std::make_shared<EventContext>(EventContext {.message = message,
-                                                         .resource = resource,
-                                                         .feedDatabase = feedDatabaseArg,
-                                                         .resourceType = ResourceType::UNKNOWN});
-        eventDecoder->handleRequest(std::move(eventContext));
+        // Decode the whole delta page in one transaction: one commit per page
+        // instead of one database write per event.
+        eventDecoder->decodePage(message, resources, *m_feedDatabase);
 
         // Verify vendor-map and oscpe-map values and update the maps in memory
         reloadGlobalMaps();
@@ -298,12 +298,30 @@ void DatabaseFeedManager::getVulnerabilitiesCandidates(
         throw std::runtime_error("Invalid package/cna name.");
     }
 
+    // Pre-screen against the in-memory package name filter: most packages have no
+    // candidates at all, and a definite miss here avoids the database seek entirely.
+    if (const auto prescreen = m_packagePrescreen.find(cnaName);
+        prescreen != m_packagePrescreen.end() && !prescreen->second.mayContain(package.name))
+    {
+        return;
+    }
+
     std::string packageNameWithSeparator;
     packageNameWithSeparator.append(package.name);
     packageNameWithSeparator.append("_CVE");
 
-    for (const auto& [key, value] : m_feedDatabase->seek(packageNameWithSeparator, cnaName))
+    // Each row holds the candidate array of one CVE for this package. The rows are collected
+    // first so the heavy evaluation can be spread over a worker pool when a package (kernel,
+    // openssl) carries thousands of candidates; the copy is a few KB per CVE and the slices
+    // returned by the iterator are only pinned while it stays on the row.
+    std::vector<std::string> rows;
+    std::size_t totalCandidates {0};
+
+    auto it = m_feedDatabase->seek(packageNameWithSeparator, cnaName);
+    for (it.begin(); it != it.end(); ++it)
     {
+        const auto value = it.current().second;
+
         if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
             !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
         {
@@ -311,19 +329,81 @@ void DatabaseFeedManager::getVulnerabilitiesCandidates(
                 "Error getting ScanVulnerabilityCandidateArray object from rocksdb. FlatBuffers verifier failed");
         }
 
-        auto candidatesArray =
-            NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(reinterpret_cast<const uint8_t*>(value.data()));
+        if (const auto candidatesArray = NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(
+                reinterpret_cast<const uint8_t*>(value.data()));
+            candidatesArray && candidatesArray->candidates())
+        {
+            totalCandidates += candidatesArray->candidates()->size();
+            rows.emplace_back(value.data(), value.size());
+        }
+    }
 
-        if (candidatesArray)
+    // Evaluate the candidates of one CVE, stopping at the first confirmed match: once a CVE is
+    // confirmed for the package, the remaining conditions of that CVE are redundant.
+    const auto evaluateRow = [&callback, &cnaName, &package](const std::string& row)
+    {
+        const auto candidatesArray =
+            NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(reinterpret_cast<const uint8_t*>(row.data()));
+
+        for (const auto& candidate : *candidatesArray->candidates())
         {
-            for (const auto& candidate : *candidatesArray->candidates())
+            if (callback(cnaName, package, *candidate))
             {
-                if (callback(cnaName, package, *candidate))
+                // If the candidate is vulnerable, we stop looking for.
+                break;
+            }
+        }
+    };
+
+    const auto workerCount =
+        std::min<std::size_t>({std::max<std::size_t>(std::thread::hardware_concurrency(), 1),
+                               totalCandidates / PARALLEL_SCAN_MIN_CANDIDATES + 1,
+                               rows.size()});
+
+    if (workerCount <= 1)
+    {
+        for (const auto& row : rows)
+        {
+            evaluateRow(row);
+        }
+        return;
+    }
+
+    // Shard the CVE rows across a worker pool. Detections for different CVEs are independent,
+    // so the callback is the only shared state and is expected to be thread-safe.
+    std::vector<std::exception_ptr> workerErrors(workerCount);
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    for (std::size_t w = 0; w < workerCount; ++w)
+    {
+        workers.emplace_back(
+            [&, w]()
+            {
+                try
                 {
-                    // If the candidate is vulnerable, we stop looking for.
-                    break;
+                    for (std::size_t i = w; i < rows.size(); i += workerCount)
+                    {
+                        evaluateRow(rows.at(i));
+                    }
                 }
-            }
+                catch (...)
+                {
+                    workerErrors.at(w) = std::current_exception();
+                }
+            });
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (const auto& error : workerErrors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
         }
     }
 }
@@ -355,23 +435,28 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
         }
     };
 
-    // Check first the filter
-    if (m_translationFilter->count(cacheKey) > 0)
+    // Check first the filter and the Level 1 cache. Both are mutated while scans run,
+    // and scans may shard packages across threads, so the accesses are serialized.
     {
-        LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
-                  package.name,
-                  osPlatform);
-        return vulnerabilityTranslations;
-    }
+        std::lock_guard cacheLock(m_translationCacheMutex);
 
-    // Check Level 1 cache
-    if (m_translationL1Cache->isHit(cacheKey))
-    {
-        LOG_DEBUG("Translation for package '{}' on platform '{}' found in Level 1 cache.", package.name, osPlatform);
+        if (m_translationFilter->count(cacheKey) > 0)
+        {
+            LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
+                      package.name,
+                      osPlatform);
+            return vulnerabilityTranslations;
+        }
 
-        const auto L1Translations = m_translationL1Cache->getValue(cacheKey).value();
-        translatePackage(L1Translations);
-        return vulnerabilityTranslations;
+        if (m_translationL1Cache->isHit(cacheKey))
+        {
+            LOG_DEBUG(
+                "Translation for package '{}' on platform '{}' found in Level 1 cache.", package.name, osPlatform);
+
+            const auto L1Translations = m_translationL1Cache->getValue(cacheKey).value();
+            translatePackage(L1Translations);
+            return vulnerabilityTranslations;
+        }
     }
 
     // Check Level 2 cache
@@ -383,12 +468,16 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
         translatePackage(L2Translations);
 
         // Store translations in Level 1 cache
+        std::lock_guard cacheLock(m_translationCacheMutex);
         m_translationL1Cache->insertKey(cacheKey, L2Translations);
         return vulnerabilityTranslations;
     }
 
     // Insert the key in the filter to avoid searching for it again
-    m_translationFilter->insert(cacheKey);
+    {
+        std::lock_guard cacheLock(m_translationCacheMutex);
+        m_translationFilter->insert(cacheKey);
+    }
     LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
               package.name,
               osPlatform);
@@ -529,6 +618,62 @@ void DatabaseFeedManager::reloadGlobalMaps()
 
     // Load translations into the Level 2 cache
     fillL2CacheTranslations();
+
+    // Rebuild the per-CNA package name filters used to pre-screen candidate lookups
+    buildPackagePrescreenFilters();
+}
+
+void DatabaseFeedManager::buildPackagePrescreenFilters()
+{
+    // Columns that do not hold package→CVE candidates and must not be indexed.
+    static const std::unordered_set<std::string_view> NON_CANDIDATE_COLUMNS {"default",
+                                                                             "cve5",
+                                                                             TRANSLATIONS_COLUMN,
+                                                                             VENDOR_MAP_COLUMN,
+                                                                             OS_CPE_RULES_COLUMN,
+                                                                             CNA_MAPPING_COLUMN,
+                                                                             REMEDIATIONS_COLUMN,
+                                                                             HOTFIXES_APPLICATIONS_COLUMN};
+
+    std::unordered_map<std::string, base::utils::bloom::BloomFilter> packagePrescreen;
+
+    for (const auto& columnName : m_feedDatabase->getAllColumns())
+    {
+        if (NON_CANDIDATE_COLUMNS.count(columnName) > 0
+            || base::utils::string::startsWith(columnName, DESCRIPTIONS_COLUMN)
+            || base::utils::string::startsWith(columnName, CVE_PACKAGE_COLUMN_NAME_PREFIX))
+        {
+            continue;
+        }
+
+        // First pass: collect the distinct package names so the filter can be sized
+        // for them. Candidate keys have the form '<packageName>_CVE-<id>'.
+        std::unordered_set<std::string> packageNames;
+        auto it = m_feedDatabase->begin(columnName);
+        for (it.begin(); it != it.end(); ++it)
+        {
+            const auto key = it.current().first;
+            const std::string_view keyView {key.data(), key.size()};
+            if (const auto separator = keyView.find("_CVE-"); separator != std::string_view::npos)
+            {
+                packageNames.emplace(keyView.substr(0, separator));
+            }
+        }
+
+        if (packageNames.empty())
+        {
+            continue;
+        }
+
+        base::utils::bloom::BloomFilter filter(packageNames.size());
+        for (const auto& packageName : packageNames)
+        {
+            filter.insert(packageName);
+        }
+        packagePrescreen.emplace(columnName, std::move(filter));
+    }
+
+    m_packagePrescreen = std::move(packagePrescreen);
 }
 
 auto DatabaseFeedManager::cnaMappings() const -> const nlohmann::json&
@@ -21,6 +21,9 @@
 #include "flatbuffers/idl.h"
 #include "packageTranslation_generated.h"
 #include "packageTranslation_schema.h"
+#include <map>
+#include <memory>
+#include <utility>
 
 const static std::map<ResourceType, const char*> SCHEMA = {{ResourceType::CVE, cve5_SCHEMA},
                                                            {ResourceType::TRANSLATION, packageTranslation_SCHEMA},
@@ -41,6 +44,50 @@ const static std::map<ResourceType, const char*> COLUMNS = {{ResourceType::CVE,
 class EventDecoder final : public utils::patterns::AbstractHandler<std::shared_ptr<EventContext>>
 {
 private:
+    /**
+     * @brief Pre-parsed schema parser for a resource type, built once per thread and
+     * reused across events.
+     *
+     * Re-parsing the .fbs schema text on every record dominates the cost of the
+     * reflection-based JSON conversion (the cve5 schema alone is several KB of IDL),
+     * so it is paid once per thread instead; only the record's JSON still goes
+     * through the generic parser, which keeps handling every field the schema knows
+     * about. The builder is cleared on each hand-out so its buffer is reused too.
+     *
+     * @param resourceType Resource type whose schema the parser holds.
+     * @param strictJson Whether the parser emits/accepts strict JSON with default
+     * scalars, as the update path requires.
+     */
+    static flatbuffers::Parser& schemaParser(const ResourceType resourceType, const bool strictJson)
+    {
+        thread_local std::map<std::pair<ResourceType, bool>, std::unique_ptr<flatbuffers::Parser>> parsers;
+
+        auto& parser {parsers[{resourceType, strictJson}]};
+
+        if (!parser)
+        {
+            if (strictJson)
+            {
+                flatbuffers::IDLOptions options;
+                options.output_default_scalars_in_json = true;
+                options.strict_json = true;
+                parser = std::make_unique<flatbuffers::Parser>(options);
+            }
+            else
+            {
+                parser = std::make_unique<flatbuffers::Parser>();
+            }
+
+            if (!parser->Parse(SCHEMA.at(resourceType)))
+            {
+                throw std::runtime_error("Unable to parse schema: " + parser->error_);
+            }
+        }
+
+        parser->builder_.Clear();
+        return *parser;
+    }
+
     /**
      * @brief Process a CVE5 or Translation message.
      *
@@ -100,10 +147,10 @@ private:
                 }
                 else
                 {
-                    // Resources in flatbuffer format.
-                    flatbuffers::Parser parser;
+                    // Resources in flatbuffer format, converted through the cached schema parser.
+                    auto& parser {schemaParser(data->resourceType, false)};
 
-                    if (!parser.Parse(schema) || !parser.Parse(data->resource.at("payload").dump().c_str()))
+                    if (!parser.ParseJson(data->resource.at("payload").dump().c_str()))
                     {
                         throw std::runtime_error("Unable to parse payload: " + parser.error_);
                     }
@@ -158,18 +205,14 @@ private:
                             }
                             break;
                     }
-                    flatbuffers::IDLOptions options;
-                    options.output_default_scalars_in_json = true;
-                    options.strict_json = true;
-                    flatbuffers::Parser parser(options);
-                    parser.Parse(schema);
+                    auto& parser {schemaParser(data->resourceType, true)};
 
                     std::string strData;
                     flatbuffers::GenText(parser, reinterpret_cast<const uint8_t*>(slice.data()), &strData);
                     auto jsonData = nlohmann::json::parse(strData);
 
                     jsonData.patch_inplace(data->resource.at("operations"));
-                    if (!parser.Parse(jsonData.dump().c_str()))
+                    if (!parser.ParseJson(jsonData.dump().c_str()))
                     {
                         throw std::runtime_error("Unable to parse patched data: " + parser.error_);
                     }
@@ -223,6 +266,40 @@ public:
         }
         return nullptr;
     }
+
+    /**
+     * @brief Decodes a whole delta page inside one database transaction.
+     *
+     * Every event of the page runs through the regular decode chain, but each write
+     * lands in a single RocksDB transaction that is committed once at the end, so a
+     * page costs one batch apply instead of one database write per event. The cached
+     * thread-local schema parsers keep the flatbuffer conversions on a reused builder
+     * buffer, so page decoding is bounded by the final commit rather than by per-event
+     * work. If any event fails, the transaction rolls back and the feed stays as it
+     * was before the page.
+     *
+     * @param message Raw message the page was taken from.
+     * @param resources Array with the page's delta events.
+     * @param feedDatabase CVEs database the page is committed to.
+     */
+    void decodePage(const std::vector<char>& message,
+                    const nlohmann::json& resources,
+                    utils::rocksdb::RocksDBWrapper& feedDatabase)
+    {
+        utils::rocksdb::RocksDBTransaction transaction {&feedDatabase};
+
+        for (const auto& resource : resources)
+        {
+            auto eventContext =
+                std::make_shared<EventContext>(EventContext {.message = message,
+                                                             .resource = resource,
+                                                             .feedDatabase = &transaction,
+                                                             .resourceType = ResourceType::UNKNOWN});
+            handleRequest(std::move(eventContext));
+        }
+
+        transaction.commit();
+    }
 };
 
 #endif // _EVENT_DECODER_HPP
@@ -173,6 +173,14 @@ public:
                 }
             }
 
+            // Group the changed candidates into one batch per column. The candidate slices
+            // point into the flatbuffer builders held by candidatesArraysMap, and the reverse
+            // values point into candidatePuts, so both vectors are reserved up front.
+            std::vector<std::pair<std::string, rocksdb::Slice>> candidatePuts;
+            std::vector<std::pair<std::string, rocksdb::Slice>> reversePuts;
+            candidatePuts.reserve(candidatesArraysMap.size());
+            reversePuts.reserve(candidatesArraysMap.size());
+
             for (auto& [key, value] : candidatesArraysMap)
             {
                 const auto finalArray =
@@ -191,10 +199,14 @@ public:
                     || currentValueCandidate.size() != slice.size()
                     || std::memcmp(currentValueCandidate.data(), slice.data(), slice.size()) != 0)
                 {
-                    feedDatabase->put(finalKey, slice, shortName);
-                    feedDatabase->put(reverseKey, finalKey, CVE_PACKAGE_COLUMN_NAME);
+                    candidatePuts.emplace_back(finalKey, slice);
+                    reversePuts.emplace_back(reverseKey, candidatePuts.back().first);
                 }
             }
+
+            // The batches skip the WAL: the feed can be re-downloaded if the process dies mid-load.
+            feedDatabase->putBatch(candidatePuts, shortName, true);
+            feedDatabase->putBatch(reversePuts, CVE_PACKAGE_COLUMN_NAME, true);
         };
 
         if (cve5Flatbuffer->containers()->adp())
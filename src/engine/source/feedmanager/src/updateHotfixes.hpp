@@ -73,9 +73,10 @@ public:
 
         const auto cveId = data->cveMetadata()->cveId()->str();
 
+        std::vector<std::pair<std::string, rocksdb::Slice>> hotfixKeys;
         std::for_each(windowsRemediations->begin(),
                       windowsRemediations->end(),
-                      [&feedDatabase, &cveId](const cve_v5::Remediation* remediation)
+                      [&hotfixKeys, &cveId](const cve_v5::Remediation* remediation)
                       {
                           if (!remediation->anyOf())
                           {
@@ -84,10 +85,12 @@ public:
 
                           for (const auto hotfix : *remediation->anyOf())
                           {
-                              const auto key = hotfix->str() + "_" + cveId;
-                              feedDatabase->put(key, "", HOTFIXES_APPLICATIONS_COLUMN);
+                              hotfixKeys.emplace_back(hotfix->str() + "_" + cveId, "");
                           }
                       });
+
+        // The batch skips the WAL: the feed can be re-downloaded if the process dies mid-load.
+        feedDatabase->putBatch(hotfixKeys, HOTFIXES_APPLICATIONS_COLUMN, true);
     }
 
     /**
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _FS_STREAM_READER_HPP
+#define _FS_STREAM_READER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace fs
+{
+
+/**
+ * @brief Options for StreamReader.
+ */
+struct StreamReaderOptions
+{
+    /// Bytes read per chunk. Rounded up to the block alignment when directIO is set.
+    size_t chunkSize {1024 * 1024};
+    /// Open the file with O_DIRECT, bypassing the page cache entirely. Falls back to
+    /// a buffered read when the filesystem does not support it (e.g. tmpfs).
+    bool directIO {false};
+    /// Drop the consumed pages from the page cache after each chunk
+    /// (POSIX_FADV_DONTNEED). Ignored when directIO is in effect.
+    bool dropCache {true};
+};
+
+/**
+ * @brief Sequential chunked reader for large files.
+ *
+ * Reads a file front to back through a fixed internal buffer instead of
+ * materializing it in memory. The kernel is hinted with
+ * POSIX_FADV_SEQUENTIAL so readahead stays effective, and the consumed range
+ * is released with POSIX_FADV_DONTNEED (or skipped entirely with O_DIRECT) so
+ * multi-GB content files do not evict warmer pages, such as the RocksDB block
+ * cache, while they are processed.
+ */
+class StreamReader final
+{
+public:
+    StreamReader() = delete;
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    /**
+     * @brief Open the file and apply the readahead hints.
+     *
+     * @param filepath Path to the file.
+     * @param options Reader options.
+     * @throw std::runtime_error If the file cannot be opened or is not readable.
+     */
+    explicit StreamReader(const std::string& filepath, const StreamReaderOptions& options = {});
+
+    ~StreamReader();
+
+    /**
+     * @brief Read the next chunk.
+     *
+     * The view points into the internal buffer and is invalidated by the next
+     * call.
+     *
+     * @return std::string_view The chunk read, empty at end of file.
+     * @throw std::runtime_error If the read fails.
+     */
+    std::string_view next();
+
+    /**
+     * @brief Size of the file in bytes at open time.
+     */
+    size_t size() const { return m_size; }
+
+    /**
+     * @brief Bytes consumed so far.
+     */
+    size_t offset() const { return m_offset; }
+
+    /**
+     * @brief Whether O_DIRECT is in effect (the request may have fallen back).
+     */
+    bool isDirect() const { return m_direct; }
+
+    /**
+     * @brief Convenience wrapper: stream the whole file through a callback.
+     *
+     * @param filepath Path to the file.
+     * @param onChunk Invoked once per chunk, in file order.
+     * @param options Reader options.
+     * @throw std::runtime_error If the file cannot be opened or read.
+     */
+    static void
+    forEach(const std::string& filepath, const std::function<void(std::string_view)>& onChunk,
+            const StreamReaderOptions& options = {});
+
+private:
+    int m_fd {-1};          ///< File descriptor.
+    char* m_buffer {nullptr}; ///< Block-aligned chunk buffer.
+    size_t m_chunkSize {0}; ///< Effective chunk size.
+    size_t m_size {0};      ///< File size at open time.
+    size_t m_offset {0};    ///< Bytes consumed so far.
+    bool m_direct {false};  ///< O_DIRECT in effect.
+    bool m_dropCache {false}; ///< Release consumed pages after each chunk.
+};
+
+} // namespace fs
+
+#endif // _FS_STREAM_READER_HPP
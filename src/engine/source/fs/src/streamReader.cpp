@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "fs/streamReader.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+// O_DIRECT needs the buffer, the offset and the length aligned to the logical
+// block size; 4 KiB covers every block device in use.
+constexpr size_t BLOCK_ALIGNMENT {4096};
+
+size_t alignUp(const size_t value, const size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+namespace fs
+{
+
+StreamReader::StreamReader(const std::string& filepath, const StreamReaderOptions& options)
+    : m_dropCache {options.dropCache}
+{
+    if (options.chunkSize == 0)
+    {
+        throw std::runtime_error {"Stream reader chunk size cannot be zero."};
+    }
+
+    if (options.directIO)
+    {
+        m_fd = ::open(filepath.c_str(), O_RDONLY | O_DIRECT);
+        m_direct = m_fd >= 0;
+    }
+
+    if (m_fd < 0)
+    {
+        // Either O_DIRECT was not requested or the filesystem rejected it
+        // (e.g. tmpfs); fall back to a buffered read with cache hints.
+        m_fd = ::open(filepath.c_str(), O_RDONLY);
+    }
+
+    if (m_fd < 0)
+    {
+        throw std::runtime_error {"Error opening file: " + filepath + " (" + std::strerror(errno) + ")"};
+    }
+
+    struct stat st = {};
+    if (::fstat(m_fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        ::close(m_fd);
+        throw std::runtime_error {"Error opening file: " + filepath + " is not a regular file."};
+    }
+    m_size = static_cast<size_t>(st.st_size);
+
+    m_chunkSize = m_direct ? alignUp(options.chunkSize, BLOCK_ALIGNMENT) : options.chunkSize;
+    void* buffer {nullptr};
+    if (::posix_memalign(&buffer, BLOCK_ALIGNMENT, m_chunkSize) != 0)
+    {
+        ::close(m_fd);
+        throw std::runtime_error {"Error allocating the stream reader buffer."};
+    }
+    m_buffer = static_cast<char*>(buffer);
+
+    if (!m_direct)
+    {
+        // Sequential access: double the readahead window and let the kernel
+        // drop pages behind the read pointer eagerly.
+        ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+}
+
+StreamReader::~StreamReader()
+{
+    if (m_fd >= 0)
+    {
+        if (!m_direct && m_dropCache)
+        {
+            ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_DONTNEED);
+        }
+        ::close(m_fd);
+    }
+    std::free(m_buffer);
+}
+
+std::string_view StreamReader::next()
+{
+    ssize_t bytes {0};
+    do
+    {
+        bytes = ::read(m_fd, m_buffer, m_chunkSize);
+    } while (bytes < 0 && errno == EINTR);
+
+    if (bytes < 0)
+    {
+        throw std::runtime_error {std::string {"Error reading file: "} + std::strerror(errno)};
+    }
+
+    if (bytes == 0)
+    {
+        return {};
+    }
+
+    if (!m_direct && m_dropCache)
+    {
+        // Release the pages already consumed, rounded down to a page boundary so
+        // the tail of the previous chunk is covered too.
+        const auto dropTo = m_offset / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+        if (dropTo > 0)
+        {
+            ::posix_fadvise(m_fd, 0, static_cast<off_t>(dropTo), POSIX_FADV_DONTNEED);
+        }
+    }
+
+    m_offset += static_cast<size_t>(bytes);
+    return {m_buffer, static_cast<size_t>(bytes)};
+}
+
+void StreamReader::forEach(const std::string& filepath,
+                           const std::function<void(std::string_view)>& onChunk,
+                           const StreamReaderOptions& options)
+{
+    StreamReader reader {filepath, options};
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+        onChunk(chunk);
+    }
+}
+
+} // namespace fs
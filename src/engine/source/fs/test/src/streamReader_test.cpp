@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <fs/streamReader.hpp>
+
+class StreamReaderTest : public ::testing::Test
+{
+protected:
+    StreamReaderTest() = default;
+    virtual ~StreamReaderTest() = default;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    std::filesystem::path m_testFile;
+};
+
+void StreamReaderTest::SetUp()
+{
+    m_testFile = std::filesystem::temp_directory_path() / "streamReader_test_file.bin";
+
+    // Content larger than a chunk and not a multiple of the block size.
+    std::string content;
+    content.reserve(3 * 4096 + 123);
+    for (size_t i = 0; content.size() < 3 * 4096 + 123; ++i)
+    {
+        content += static_cast<char>('a' + i % 26);
+    }
+    std::ofstream out {m_testFile, std::ios::binary};
+    out << content;
+};
+
+void StreamReaderTest::TearDown()
+{
+    std::filesystem::remove(m_testFile);
+};
+
+using namespace fs;
+
+static std::string fileContent(const std::filesystem::path& path)
+{
+    std::ifstream in {path, std::ios::binary};
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+TEST_F(StreamReaderTest, NonExistentFile)
+{
+    EXPECT_THROW(StreamReader reader {"/tmp/streamReader_does_not_exist"}, std::runtime_error);
+}
+
+TEST_F(StreamReaderTest, ZeroChunkSize)
+{
+    StreamReaderOptions options;
+    options.chunkSize = 0;
+    EXPECT_THROW(StreamReader(m_testFile.string(), options), std::runtime_error);
+}
+
+TEST_F(StreamReaderTest, ReadWholeFileInChunks)
+{
+    const auto expected = fileContent(m_testFile);
+
+    StreamReaderOptions options;
+    options.chunkSize = 4096;
+    StreamReader reader {m_testFile.string(), options};
+    EXPECT_EQ(reader.size(), expected.size());
+
+    std::string content;
+    size_t chunks {0};
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+        EXPECT_LE(chunk.size(), options.chunkSize);
+        content.append(chunk);
+        ++chunks;
+    }
+
+    EXPECT_EQ(content, expected);
+    EXPECT_EQ(reader.offset(), expected.size());
+    EXPECT_EQ(chunks, 4);
+}
+
+TEST_F(StreamReaderTest, ForEachStreamsInOrder)
+{
+    const auto expected = fileContent(m_testFile);
+
+    std::string content;
+    StreamReader::forEach(m_testFile.string(), [&content](std::string_view chunk) { content.append(chunk); });
+
+    EXPECT_EQ(content, expected);
+}
+
+TEST_F(StreamReaderTest, DirectIOReadsOrFallsBack)
+{
+    const auto expected = fileContent(m_testFile);
+
+    // O_DIRECT depends on the filesystem backing the temp dir; the reader falls
+    // back to a buffered read where it is unsupported, the content is identical
+    // either way.
+    StreamReaderOptions options;
+    options.chunkSize = 4096;
+    options.directIO = true;
+    StreamReader reader {m_testFile.string(), options};
+
+    std::string content;
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+        content.append(chunk);
+    }
+
+    EXPECT_EQ(content, expected);
+}
+
+TEST_F(StreamReaderTest, NoDropCache)
+{
+    const auto expected = fileContent(m_testFile);
+
+    StreamReaderOptions options;
+    options.dropCache = false;
+    StreamReader reader {m_testFile.string(), options};
+
+    std::string content;
+    for (auto chunk = reader.next(); !chunk.empty(); chunk = reader.next())
+    {
+        content.append(chunk);
+    }
+
+    EXPECT_EQ(content, expected);
+}
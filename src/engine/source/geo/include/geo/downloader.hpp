@@ -14,6 +14,7 @@ public:
     base::RespOrError<std::string> downloadHTTPS(const std::string& url) const override;
     std::string computeMD5(const std::string& data) const override;
     base::RespOrError<std::string> downloadMD5(const std::string& url) const override;
+    base::RespOrError<std::string> computeMD5File(const std::string& filepath) const override;
 };
 } // namespace geo
 
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 
@@ -30,6 +31,7 @@ private:
     std::map<std::string, std::shared_ptr<DbEntry>> m_dbs; ///< The databases that have been added.
     std::map<Type, std::string> m_dbTypes;  ///< Map by Types for quick access to the db name. (only one db per type)
     mutable std::shared_mutex m_rwMapMutex; ///< Mutex to avoid simultaneous updates on the db map
+    std::mutex m_updateMutex; ///< Serializes remote updates; never held while lookups resolve the map
 
     std::shared_ptr<store::IStoreInternal> m_store; ///< The store used to store the MMDB hash.
     std::shared_ptr<IDownloader> m_downloader;      ///< The downloader used to download the MMDB database.
@@ -37,10 +39,14 @@ private:
     /**
      * @brief Upsert the internal store entry for a database.
      *
+     * The stored hash is the validator for the next update check, surviving restarts.
+     *
      * @param path The path to the database.
+     * @param type The type of the database.
+     * @param hash The known hash of the file, empty to compute it chunk by chunk.
      * @return base::OptError An error if the store entry could not be upserted.
      */
-    base::OptError upsertStoreEntry(const std::string& path);
+    base::OptError upsertStoreEntry(const std::string& path, Type type, const std::string& hash);
 
     /**
      * @brief Remove the internal store entry for a database.
@@ -15,6 +15,17 @@ public:
     virtual base::RespOrError<std::string> downloadHTTPS(const std::string& url) const = 0;
     virtual std::string computeMD5(const std::string& data) const = 0;
     virtual base::RespOrError<std::string> downloadMD5(const std::string& url) const = 0;
+
+    /**
+     * @brief Compute the MD5 hash of a file reading it in chunks.
+     *
+     * Bounded memory regardless of the file size, so multi-GB databases can be
+     * verified without materializing them.
+     *
+     * @param filepath Path to the file.
+     * @return base::RespOrError<std::string> The hash or an error if the file cannot be read.
+     */
+    virtual base::RespOrError<std::string> computeMD5File(const std::string& filepath) const = 0;
 };
 } // namespace geo
 
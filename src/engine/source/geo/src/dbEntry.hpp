@@ -1,32 +1,60 @@
 #ifndef _GEO_DBENTRY_HPP
 #define _GEO_DBENTRY_HPP
 
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
 
 #include <maxminddb.h>
 
+#include <base/error.hpp>
 #include <geo/imanager.hpp>
 
 namespace geo
 {
 
+/**
+ * @brief Opens an MMDB database in read-only memory-mapped mode.
+ *
+ * The returned handle closes the database when the last reference is dropped, so readers
+ * that are still holding it during an update keep a valid mapping until they finish.
+ *
+ * @param path The path to the database file.
+ * @return A base::RespOrError object containing the handle or an error message.
+ */
+inline base::RespOrError<std::shared_ptr<MMDB_s>> openMmdb(const std::string& path)
+{
+    auto mmdb = std::make_unique<MMDB_s>();
+    int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, mmdb.get());
+    if (MMDB_SUCCESS != status)
+    {
+        return base::Error {MMDB_strerror(status)};
+    }
+
+    return std::shared_ptr<MMDB_s>(mmdb.release(),
+                                   [](MMDB_s* handle)
+                                   {
+                                       MMDB_close(handle);
+                                       delete handle;
+                                   });
+}
+
 /**
  * @brief Class to hold the needed information for a database.
+ *
+ * The MMDB handle is published atomically (RCU style): updates open a new handle and swap
+ * it in, while lookups load the current handle without taking any lock. The memory-mapped
+ * file of a replaced handle stays alive until the last in-flight lookup releases it.
  */
 class DbEntry
 {
 public:
-    std::string path;                  ///< The path to the database.
-    Type type;                         ///< The type of database.
-    mutable std::shared_mutex rwMutex; ///< Read-Write mutex for thread safety access to the MMDB database.
-    std::unique_ptr<MMDB_s> mmdb;      ///< The MMDB database.
+    std::string path; ///< The path to the database.
+    Type type;        ///< The type of database.
 
     DbEntry(const std::string& path, Type type)
         : path(path)
         , type(type)
     {
-        mmdb = std::make_unique<MMDB_s>();
     }
 
     DbEntry(const DbEntry&) = delete;
@@ -34,13 +62,22 @@ public:
     DbEntry(DbEntry&&) = delete;
     DbEntry& operator=(DbEntry&&) = delete;
 
-    ~DbEntry()
-    {
-        if (mmdb != nullptr)
-        {
-            MMDB_close(mmdb.get());
-        }
-    }
+    /**
+     * @brief Publish a new MMDB handle, replacing the current one.
+     *
+     * @param mmdb The handle to publish.
+     */
+    void setMmdb(std::shared_ptr<MMDB_s> mmdb) { std::atomic_store(&m_mmdb, std::move(mmdb)); }
+
+    /**
+     * @brief Get the current MMDB handle.
+     *
+     * @return The current handle, or nullptr if no database has been published yet.
+     */
+    std::shared_ptr<MMDB_s> getMmdb() const { return std::atomic_load(&m_mmdb); }
+
+private:
+    std::shared_ptr<MMDB_s> m_mmdb; ///< The MMDB database, swapped atomically on update.
 };
 } // namespace geo
 #endif // _GEO_DBENTRY_HPP
@@ -8,6 +8,7 @@
 #include <fmt/format.h>
 
 #include <HTTPRequest.hpp>
+#include <fs/streamReader.hpp>
 
 namespace
 {
@@ -24,6 +25,57 @@ bool isMD5Hash(const std::string& str)
     // Check if the string has 32 characters and consists of hexadecimal digits
     return str.size() == 32 && std::all_of(str.begin(), str.end(), ::isxdigit);
 }
+
+/**
+ * @brief Incremental MD5 digest, hex-encoded on finish.
+ */
+class Md5Digest
+{
+public:
+    Md5Digest()
+        : m_ctx {EVP_MD_CTX_new()}
+    {
+        m_ok = m_ctx != nullptr && EVP_DigestInit_ex(m_ctx, EVP_md5(), nullptr) == 1;
+    }
+
+    ~Md5Digest()
+    {
+        if (m_ctx != nullptr)
+        {
+            EVP_MD_CTX_free(m_ctx);
+        }
+    }
+
+    Md5Digest(const Md5Digest&) = delete;
+    Md5Digest& operator=(const Md5Digest&) = delete;
+
+    void update(const void* data, size_t size)
+    {
+        m_ok = m_ok && EVP_DigestUpdate(m_ctx, data, size) == 1;
+    }
+
+    // Returns the hex digest, or an empty string if any step failed
+    std::string finish()
+    {
+        unsigned char digest[EVP_MAX_MD_SIZE];
+        unsigned int digestLen {0};
+        if (!m_ok || EVP_DigestFinal_ex(m_ctx, digest, &digestLen) != 1)
+        {
+            return "";
+        }
+
+        std::stringstream ss;
+        for (unsigned int i = 0; i < digestLen; ++i)
+        {
+            ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+        }
+        return ss.str();
+    }
+
+private:
+    EVP_MD_CTX* m_ctx;
+    bool m_ok {false};
+};
 } // namespace
 
 namespace geo
@@ -50,46 +102,32 @@ base::RespOrError<std::string> Downloader::downloadHTTPS(const std::string& url)
 // Function to compute the MD5 hash of input data
 std::string Downloader::computeMD5(const std::string& data) const
 {
-    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-    if (!ctx)
-    {
-        // Handle error
-        return "";
-    }
-
-    if (EVP_DigestInit_ex(ctx, EVP_md5(), nullptr) != 1)
-    {
-        // Handle error
-        EVP_MD_CTX_free(ctx);
-        return "";
-    }
+    Md5Digest digest;
+    digest.update(data.c_str(), data.size());
+    return digest.finish();
+}
 
-    if (EVP_DigestUpdate(ctx, data.c_str(), data.size()) != 1)
+base::RespOrError<std::string> Downloader::computeMD5File(const std::string& filepath) const
+{
+    Md5Digest digest;
+    try
     {
-        // Handle error
-        EVP_MD_CTX_free(ctx);
-        return "";
+        // Chunked read with page-cache release so hashing a multi-GB database does
+        // not evict warmer pages.
+        fs::StreamReader::forEach(filepath,
+                                  [&digest](std::string_view chunk) { digest.update(chunk.data(), chunk.size()); });
     }
-
-    unsigned char digest[EVP_MAX_MD_SIZE];
-    unsigned int digest_len;
-
-    if (EVP_DigestFinal_ex(ctx, digest, &digest_len) != 1)
+    catch (const std::exception& e)
     {
-        // Handle error
-        EVP_MD_CTX_free(ctx);
-        return "";
+        return base::Error {fmt::format("Cannot hash file '{}': {}", filepath, e.what())};
     }
 
-    EVP_MD_CTX_free(ctx);
-
-    std::stringstream ss;
-    for (unsigned int i = 0; i < digest_len; ++i)
+    auto hash = digest.finish();
+    if (hash.empty())
     {
-        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+        return base::Error {fmt::format("Cannot hash file '{}'", filepath)};
     }
-
-    return ss.str();
+    return hash;
 }
 
 base::RespOrError<std::string> Downloader::downloadMD5(const std::string& url) const
@@ -4,7 +4,6 @@
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
-#include <shared_mutex>
 #include <sstream>
 
 #include "dbEntry.hpp"
@@ -247,17 +246,31 @@ static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
 namespace geo
 {
 
-base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEntry>& entry)
+base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<MMDB_s>& mmdb)
 {
+    // The database was swapped, cached results point into the replaced mapping
+    if (mmdb != m_cachedMmdb)
+    {
+        m_ipCache.clear();
+        m_cachedMmdb = mmdb;
+        m_cachedIp.clear();
+    }
     // Check if the IP address is the same as the cached one
-    if (ip == m_cachedIp)
+    else if (ip == m_cachedIp)
+    {
+        return base::noError();
+    }
+    // Check the per-IP cache
+    else if (auto cached = m_ipCache.getValue(ip); cached.has_value())
     {
+        m_cachedIp = ip;
+        m_cachedResult = cached.value();
         return base::noError();
     }
 
     // Lookup the IP address in the database
     int gai_error, mmdb_error;
-    MMDB_lookup_result_s result = MMDB_lookup_string(entry->mmdb.get(), ip.c_str(), &gai_error, &mmdb_error);
+    MMDB_lookup_result_s result = MMDB_lookup_string(mmdb.get(), ip.c_str(), &gai_error, &mmdb_error);
 
     if (0 != gai_error) // translation error
     {
@@ -271,6 +284,7 @@ base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEn
 
     m_cachedIp = ip;
     m_cachedResult = result;
+    m_ipCache.insertKey(ip, result);
 
     return base::noError();
 }
@@ -303,19 +317,17 @@ base::RespOrError<std::string> Locator::getString(const std::string& ip, const D
         return base::Error {"Database is not available"};
     }
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Load the current handle, the shared_ptr keeps the mapping alive during the lookup
+    auto mmdb = entry->getMmdb();
+    if (mmdb == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    // Lookup the IP address in the database; the cached state is shared when the
+    // built policy is, so it is read and updated under the cache lock
+    std::lock_guard lock {m_cacheMutex};
+    auto lookError = lookup(ip, mmdb);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -347,19 +359,17 @@ base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotP
         return base::Error {"Database is not available"};
     }
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Load the current handle, the shared_ptr keeps the mapping alive during the lookup
+    auto mmdb = entry->getMmdb();
+    if (mmdb == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    // Lookup the IP address in the database; the cached state is shared when the
+    // built policy is, so it is read and updated under the cache lock
+    std::lock_guard lock {m_cacheMutex};
+    auto lookError = lookup(ip, mmdb);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -391,19 +401,17 @@ base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPat
         return base::Error {"Database is not available"};
     }
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Load the current handle, the shared_ptr keeps the mapping alive during the lookup
+    auto mmdb = entry->getMmdb();
+    if (mmdb == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    // Lookup the IP address in the database; the cached state is shared when the
+    // built policy is, so it is read and updated under the cache lock
+    std::lock_guard lock {m_cacheMutex};
+    auto lookError = lookup(ip, mmdb);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -435,19 +443,17 @@ base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const Do
         return base::Error {"Database is not available"};
     }
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Load the current handle, the shared_ptr keeps the mapping alive during the lookup
+    auto mmdb = entry->getMmdb();
+    if (mmdb == nullptr)
     {
         return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
+    // Lookup the IP address in the database; the cached state is shared when the
+    // built policy is, so it is read and updated under the cache lock
+    std::lock_guard lock {m_cacheMutex};
+    auto lookError = lookup(ip, mmdb);
     if (base::isError(lookError))
     {
         return base::getError(lookError);
@@ -1,39 +1,66 @@
 #ifndef _GEO_LOCATOR_HPP
 #define _GEO_LOCATOR_HPP
 
+#include <memory>
+#include <mutex>
+
 #include <geo/ilocator.hpp>
 
 #include <maxminddb.h>
 
+#include <base/lruCache.hpp>
+
 namespace geo
 {
 
 class DbEntry; ///< Forward declaration
 
+constexpr size_t LOCATOR_IP_CACHE_SIZE = 1024; ///< Capacity of the per-locator IP result cache.
+
+/**
+ * @brief Locator for a geo database.
+ *
+ * Lookups load the current MMDB handle atomically, so concurrent database updates never
+ * block the enrichment path. Results are cached per IP; a locator is shared by every
+ * worker running the same built policy, so the cached state is guarded by a per-locator
+ * mutex.
+ */
 class Locator final : public ILocator
 {
 private:
     std::weak_ptr<DbEntry> m_weakDbEntry; ///< The weak pointer to the database entry.
 
+    mutable std::mutex m_cacheMutex; ///< Guards the cached lookup state, shared when a built policy is.
+
     std::string m_cachedIp;              ///< The cached IP address.
-    MMDB_lookup_result_s m_cachedResult; ///< The cached lookup result.
+    MMDB_lookup_result_s m_cachedResult {}; ///< The cached lookup result.
+
+    std::shared_ptr<MMDB_s> m_cachedMmdb; ///< Handle the cached results point into. Keeps the mapping
+                                          ///< alive and detects database swaps to flush the cache.
+    LRUCache<std::string, MMDB_lookup_result_s> m_ipCache {
+        LOCATOR_IP_CACHE_SIZE}; ///< Per-IP result cache for the current handle.
 
     /**
      * @brief Retrieves the entry data for a given dot path.
      *
      * @param path The dot path to retrieve the entry data for.
      * @return A base::RespOrError object containing the entry data or an error message.
+     * @note The caller must hold m_cacheMutex.
      */
     base::RespOrError<MMDB_entry_data_s> getEData(const DotPath& path);
 
     /**
      * @brief Looks up the given IP address in the database if it is not already cached.
      *
+     * If the handle differs from the one the cache was built against the cache is flushed
+     * first, as cached results point into the replaced memory mapping.
+     *
      * @param ip The IP address to look up.
-     * @param dbEntry The database entry to use for the lookup.
+     * @param mmdb The MMDB handle to use for the lookup.
      * @return A base::OptError object containing an error message if the lookup failed.
+     * @note The caller must hold m_cacheMutex.
      */
-    base::OptError lookup(const std::string& ip, const std::shared_ptr<DbEntry>& dbEntry);
+    base::OptError lookup(const std::string& ip, const std::shared_ptr<MMDB_s>& mmdb);
 
 public:
     virtual ~Locator() = default;
@@ -79,14 +106,22 @@ public:
      *
      * @return The cached IP address.
      */
-    inline const std::string& getCachedIp() const { return m_cachedIp; }
+    inline std::string getCachedIp() const
+    {
+        std::lock_guard lock {m_cacheMutex};
+        return m_cachedIp;
+    }
 
     /**
      * @brief Retrieves the cached lookup result.
      *
      * @return The cached lookup result.
      */
-    inline const MMDB_lookup_result_s& getCachedResult() const { return m_cachedResult; }
+    inline MMDB_lookup_result_s getCachedResult() const
+    {
+        std::lock_guard lock {m_cacheMutex};
+        return m_cachedResult;
+    }
 };
 
 } // namespace geo
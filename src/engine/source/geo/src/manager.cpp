@@ -5,7 +5,6 @@
 #include <mutex>
 
 #include <fmt/format.h>
-#include <maxminddb.h>
 
 #include <base/logging.hpp>
 #include <store/istore.hpp>
@@ -61,29 +60,29 @@ Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std:
     }
 }
 
-base::OptError Manager::upsertStoreEntry(const std::string& path)
+base::OptError Manager::upsertStoreEntry(const std::string& path, Type type, const std::string& hash)
 {
     std::filesystem::path dbPath(path);
 
-    // Open file and compute hash
-    auto file = std::ifstream(path, std::ios::binary);
-    if (!file.is_open())
+    // Hash the file in chunks only when the caller does not know the hash already
+    // (remote updates verified it against the published one on download).
+    auto fileHash = hash;
+    if (fileHash.empty())
     {
-        return base::Error {fmt::format("Cannot open file '{}'", path)};
+        auto hashResp = m_downloader->computeMD5File(path);
+        if (base::isError(hashResp))
+        {
+            return base::getError(hashResp);
+        }
+        fileHash = base::getResponse(hashResp);
     }
 
-    // Get content of the file to compute the hash
-    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-
-    auto hash = m_downloader->computeMD5(content);
-    file.close();
-
     // Create and upsert the internal document
     auto internalName = base::Name(std::vector<std::string>({INTERNAL_NAME, dbPath.filename().string()}));
     auto doc = store::Doc();
     doc.setString(path, PATH_PATH);
-    doc.setString(hash, HASH_PATH);
-    doc.setString(typeName(m_dbs.at(dbPath.filename().string())->type), TYPE_PATH);
+    doc.setString(fileHash, HASH_PATH);
+    doc.setString(typeName(type), TYPE_PATH);
 
     return m_store->upsertInternalDoc(internalName, doc);
 }
@@ -113,19 +112,21 @@ base::OptError Manager::addDbUnsafe(const std::string& path, Type type, bool ups
     }
 
     // Add the database
-    auto entry = std::make_shared<DbEntry>(path, type);
-    int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->mmdb.get());
-    if (MMDB_SUCCESS != status)
+    auto mmdbResp = openMmdb(path);
+    if (base::isError(mmdbResp))
     {
-        return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        return base::Error {fmt::format("Cannot add database '{}': {}", path, base::getError(mmdbResp).message)};
     }
 
+    auto entry = std::make_shared<DbEntry>(path, type);
+    entry->setMmdb(base::getResponse(mmdbResp));
+
     m_dbs.emplace(name, std::move(entry));
     m_dbTypes.emplace(type, name);
 
     if (upsertStore)
     {
-        auto internalResp = upsertStoreEntry(path);
+        auto internalResp = upsertStoreEntry(path, type, "");
         if (base::isError(internalResp))
         {
             LOG_WARNING("Cannot update internal store for '{}': {}", path, base::getError(internalResp).message);
@@ -145,22 +146,9 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
         return base::Error {fmt::format("Database '{}' not found", name)};
     }
 
-    {
-        // We need to hold the entry so the lock is not released after the entry is removed
-        auto entry = m_dbs.at(name);
-
-        // Lock the database entry internal mutex for write
-        std::unique_lock<std::shared_mutex> lockEntry(entry->rwMutex);
-
-        // Remove the database
-        m_dbs.erase(name);
-
-        // Unlock the entry mutex
-        lockEntry.unlock();
-
-        // Freed the entry
-        entry.reset();
-    }
+    // Remove the database. In-flight lookups hold the MMDB handle, so the memory mapping
+    // is released when the last of them finishes.
+    m_dbs.erase(name);
 
     // Remove the type from the map if it was the one in use
     for (auto it = m_dbTypes.begin(); it != m_dbTypes.end(); ++it)
@@ -189,11 +177,14 @@ base::OptError Manager::writeDb(const std::string& path, const std::string& cont
         return base::Error {fmt::format("Cannot create directories for '{}': {}", path, e.what())};
     }
 
-    // Write the content to the file
-    std::ofstream file(path, std::ios::binary);
+    // Write the content to a temporary file and rename it into place. The current file
+    // may still be memory-mapped by in-flight lookups, and truncating it in place would
+    // corrupt their mapping; the rename leaves the old inode intact until it is released.
+    auto tmpPath = filePath.string() + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary);
     if (!file.is_open())
     {
-        return base::Error {fmt::format("Cannot open file '{}'", path)};
+        return base::Error {fmt::format("Cannot open file '{}'", tmpPath)};
     }
     try
     {
@@ -203,6 +194,17 @@ base::OptError Manager::writeDb(const std::string& path, const std::string& cont
     catch (const std::exception& e)
     {
         file.close();
+        std::filesystem::remove(tmpPath);
+        return base::Error {fmt::format("Cannot write to file '{}': {}", tmpPath, e.what())};
+    }
+
+    try
+    {
+        std::filesystem::rename(tmpPath, filePath);
+    }
+    catch (const std::exception& e)
+    {
+        std::filesystem::remove(tmpPath);
         return base::Error {fmt::format("Cannot write to file '{}': {}", path, e.what())};
     }
 
@@ -232,20 +234,30 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
 {
     auto name = std::filesystem::path(path).filename().string();
 
-    // Hold write lock on the map
-    std::unique_lock lock(m_rwMapMutex);
+    // One remote update at a time. The map lock is only taken for the short checks
+    // and the final swap, so lookups through getLocator never wait on the network
+    // or disk transfers below.
+    std::lock_guard updateLock(m_updateMutex);
 
-    // If the type has a different database, fail
-    if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+    bool exists {false};
     {
-        return base::Error {fmt::format(
-            "The name '{}' does not correspond to any database for type '{}'. "
-            "If you want it to correspond, please delete the existing database and recreate it with this name.",
-            name,
-            typeName(type))};
+        std::shared_lock lock(m_rwMapMutex);
+
+        // If the type has a different database, fail
+        if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+        {
+            return base::Error {fmt::format(
+                "The name '{}' does not correspond to any database for type '{}'. "
+                "If you want it to correspond, please delete the existing database and recreate it with this name.",
+                name,
+                typeName(type))};
+        }
+
+        exists = m_dbs.find(name) != m_dbs.end();
     }
 
-    // Download the database hash
+    // Revalidate against the published hash. The stored hash survives restarts, so
+    // an unchanged database costs exactly this one small request.
     auto hashResp = m_downloader->downloadMD5(hashUrl);
     if (base::isError(hashResp))
     {
@@ -255,8 +267,7 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
     auto hash = base::getResponse(hashResp);
 
     // Check if it is already updated
-    auto entry = m_dbs.find(name);
-    if (entry != m_dbs.end())
+    if (exists)
     {
         auto internalResp =
             m_store->readInternalDoc(base::Name(fmt::format("{}{}{}", INTERNAL_NAME, base::Name::SEPARATOR_S, name)));
@@ -299,46 +310,48 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
         return error;
     }
 
-    // Write the database to the file
-    // If the database is already added, hold the internal mutex for write
-    if (entry != m_dbs.end())
+    // Write the verified content next to the current file and rename it into place,
+    // still without the map lock.
+    auto writeResp = writeDb(path, content);
+    if (base::isError(writeResp))
     {
-        std::unique_lock lockEntry(entry->second->rwMutex);
-        auto writeResp = writeDb(path, content);
-        if (base::isError(writeResp))
-        {
-            return base::getError(writeResp);
-        }
-
-        // Close the MMDB and reopen it
-        MMDB_close(entry->second->mmdb.get());
-        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->second->mmdb.get());
-        if (MMDB_SUCCESS != status)
-        {
-            // Remove the database
-            lockEntry.unlock();
-            removeDbUnsafe(path);
-
-            return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
-        }
+        return base::getError(writeResp);
     }
-    else
+
+    // Publish: open the new mapping and swap it in. The write lock covers only the
+    // open and the map update. Readers keep the old mapping alive until their
+    // in-flight lookups finish.
     {
-        auto writeResp = writeDb(path, content);
-        if (base::isError(writeResp))
+        std::unique_lock lock(m_rwMapMutex);
+
+        auto entry = m_dbs.find(name);
+        if (entry != m_dbs.end())
         {
-            return base::getError(writeResp);
-        }
+            auto mmdbResp = openMmdb(path);
+            if (base::isError(mmdbResp))
+            {
+                // Remove the database
+                removeDbUnsafe(path);
 
-        auto addResp = addDbUnsafe(path, type, false);
-        if (base::isError(addResp))
+                return base::Error {
+                    fmt::format("Cannot add database '{}': {}", path, base::getError(mmdbResp).message)};
+            }
+
+            entry->second->setMmdb(base::getResponse(mmdbResp));
+        }
+        else
         {
-            return base::getError(addResp);
+            auto addResp = addDbUnsafe(path, type, false);
+            if (base::isError(addResp))
+            {
+                return base::getError(addResp);
+            }
         }
     }
 
-    // Update the internal store
-    auto internalResp = upsertStoreEntry(path);
+    // Persist the validator for the next update check; the content was already
+    // verified against it, so the file is not re-read.
+    auto internalResp = upsertStoreEntry(path, type, hash);
     if (base::isError(internalResp))
     {
         LOG_WARNING("Cannot update internal store for '{}': {}", path, base::getError(internalResp).message);
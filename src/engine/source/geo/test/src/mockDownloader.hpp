@@ -13,6 +13,7 @@ public:
     MOCK_METHOD((base::RespOrError<std::string>), downloadHTTPS, (const std::string& url), (const override));
     MOCK_METHOD(std::string, computeMD5, (const std::string& data), (const override));
     MOCK_METHOD(base::RespOrError<std::string>, downloadMD5, (const std::string& url), (const override));
+    MOCK_METHOD(base::RespOrError<std::string>, computeMD5File, (const std::string& filepath), (const override));
 };
 } // namespace geo::mocks
 #endif // _GEO_MOCK_DOWNLOADER_HPP
@@ -191,6 +191,40 @@ TEST(LocatorInitTest, InitializeExpired)
     ASSERT_THROW(Locator(nullptr), std::runtime_error);
 }
 
+TEST(LocatorInitTest, GetWithoutHandle)
+{
+    auto dbEntry = std::make_shared<DbEntry>("path", Type::CITY);
+    Locator locator(dbEntry);
+
+    decltype(locator.getString({}, {})) res;
+    ASSERT_NO_THROW(res = locator.getString(g_ipFullData, "test_map.test_str1"));
+    ASSERT_TRUE(base::isError(res));
+}
+
+TEST(LocatorInitTest, GetAfterHandleSwap)
+{
+    auto dbEntry = std::make_shared<DbEntry>(g_maxmindDbPath, Type::CITY);
+    auto handle = openMmdb(g_maxmindDbPath);
+    ASSERT_FALSE(base::isError(handle));
+    dbEntry->setMmdb(base::getResponse(handle));
+
+    Locator locator(dbEntry);
+
+    decltype(locator.getString({}, {})) res;
+    ASSERT_NO_THROW(res = locator.getString(g_ipFullData, "test_map.test_str1"));
+    ASSERT_FALSE(base::isError(res)) << base::getError(res).message;
+    ASSERT_EQ("Wazuh", base::getResponse<std::string>(res));
+
+    // Swap in a new handle; the cached results for the old mapping must be discarded
+    auto newHandle = openMmdb(g_maxmindDbPath);
+    ASSERT_FALSE(base::isError(newHandle));
+    dbEntry->setMmdb(base::getResponse(newHandle));
+
+    ASSERT_NO_THROW(res = locator.getString(g_ipFullData, "test_map.test_str1"));
+    ASSERT_FALSE(base::isError(res)) << base::getError(res).message;
+    ASSERT_EQ("Wazuh", base::getResponse<std::string>(res));
+}
+
 TEST_F(LocatorTest, Get)
 {
     testAllGetBehavesEqual(g_ipFullData, true);
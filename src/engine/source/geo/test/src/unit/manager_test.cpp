@@ -271,7 +271,7 @@ TEST_F(GeoManagerTest, AddDb)
     auto hash = "hash";
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
-    EXPECT_CALL(*mockDownloader, computeMD5(testing::_)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, computeMD5File(dbPath)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -340,7 +340,7 @@ TEST_F(GeoManagerTest, AddDbErrorUpsert)
     auto hash = "hash";
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
-    EXPECT_CALL(*mockDownloader, computeMD5(testing::_)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, computeMD5File(dbPath)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeError()));
 
     base::OptError error;
@@ -418,7 +418,7 @@ TEST_F(GeoManagerTest, RemoteUpsertDb)
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
     EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
         .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -498,7 +498,7 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailOneDownload)
     EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
         .WillOnce(testing::Return(base::Error {"error"}))
         .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -528,7 +528,6 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailOneHash)
         .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
     EXPECT_CALL(*mockDownloader, computeMD5(content))
         .WillOnce(testing::Return("other_hash"))
-        .WillOnce(testing::Return(hash))
         .WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
@@ -580,7 +579,7 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailInternalStore)
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
     EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
         .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeError()));
 
     base::OptError error;
@@ -64,6 +64,8 @@ Parser getBoolParser(const Params& params);
  * @return
  */
 Parser getByteParser(const Params& params);
+Parser getShortParser(const Params& params);
+Parser getIntegerParser(const Params& params);
 Parser getLongParser(const Params& params);
 Parser getFloatParser(const Params& params);
 Parser getDoubleParser(const Params& params);
@@ -116,6 +116,112 @@ inline std::optional<base::Error> run(const Parser& parser, std::string_view tex
     return std::nullopt;
 }
 
+/**
+ * @brief A logpar expression fused into a single-pass extraction plan.
+ *
+ * Running a logpar parser through run() builds a tree of nested results and a
+ * fresh mapper vector per event. A plan keeps the ordered sub-parsers flat
+ * instead of wrapping them in a top-level combinator: each step is executed
+ * directly on the remaining input and its semantic parser is applied as soon
+ * as the step succeeds, so no top-level result tree is built. Mappers are
+ * collected into a thread-local scratch vector, reused across events, and
+ * applied only after every step succeeded so a failing plan never touches the
+ * event.
+ */
+class ExtractionPlan
+{
+private:
+    std::vector<Parser> m_steps; ///< Ordered literal anchors and field captures
+
+    /**
+     * @brief Apply the semantic parsers of a step result, collecting its mappers.
+     */
+    static std::optional<base::Error> collect(const Result& result, std::vector<Mapper>& mappers)
+    {
+        if (result.hasValue())
+        {
+            auto res = result.value().semParser(result.value().parsed);
+            if (std::holds_alternative<base::Error>(res))
+            {
+                return std::get<base::Error>(res);
+            }
+
+            mappers.emplace_back(std::get<Mapper>(std::move(res)));
+        }
+
+        for (const auto& child : result.nested())
+        {
+            auto error = collect(child, mappers);
+            if (error)
+            {
+                return std::move(error);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+public:
+    ExtractionPlan() = default;
+
+    /**
+     * @brief Construct a plan from the ordered sub-parsers of a logpar expression.
+     */
+    explicit ExtractionPlan(std::vector<Parser> steps)
+        : m_steps(std::move(steps))
+    {
+    }
+
+    /**
+     * @brief Extract the fields of the text into the event in a single pass.
+     *
+     * @param text Text to parse.
+     * @param event Event to map to, left untouched on failure.
+     * @return std::optional<base::Error>
+     */
+    std::optional<base::Error> run(std::string_view text, json::Json& event) const
+    {
+        // Scratch mappers reused across events; only alive within this call
+        thread_local std::vector<Mapper> mappers;
+        mappers.clear();
+
+        auto remaining = text;
+        for (const auto& step : m_steps)
+        {
+            auto result = step(remaining);
+            if (result.failure())
+            {
+                return base::Error {fmt::format("Parser {} failed at: {}", result.trace(), result.remaining())};
+            }
+
+            remaining = result.remaining();
+
+            auto error = collect(result, mappers);
+            if (error)
+            {
+                return std::move(error);
+            }
+        }
+
+        for (const auto& mapper : mappers)
+        {
+            mapper(event);
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Number of steps in the plan.
+     */
+    size_t size() const { return m_steps.size(); }
+
+    /**
+     * @brief Ordered sub-parsers of the plan, for per-step instrumentation.
+     */
+    const std::vector<Parser>& steps() const { return m_steps; }
+};
+
 /**
  * @brief Combinators used by HLP.
  *
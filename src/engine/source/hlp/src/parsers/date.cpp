@@ -1,8 +1,12 @@
+#include <array>
 #include <chrono>
 #include <locale>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <curl/curl.h>
@@ -12,6 +16,7 @@
 #include <base/logging.hpp>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -19,6 +24,31 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
+/**
+ * @brief Locate a timezone by name, caching the lookup.
+ *
+ * date::make_zoned walks the timezone database per call; decoders repeat the
+ * same few abbreviations millions of times, so cache the located zone. Zone
+ * pointers are stable and DST transitions are resolved by zoned_time at format
+ * time, so cached entries never go stale.
+ *
+ * @throws std::runtime_error if the timezone is not found (as locate_zone does)
+ */
+const date::time_zone* locateZoneCached(const std::string& name)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, const date::time_zone*> cache;
+
+    std::lock_guard<std::mutex> lock {mutex};
+    auto it = cache.find(name);
+    if (it == cache.end())
+    {
+        it = cache.emplace(name, date::locate_zone(name)).first;
+    }
+
+    return it->second;
+}
+
 Mapper getMapper(std::string&& parsed, std::string_view targetField)
 {
     return [parsed = std::move(parsed), targetField](json::Json& event)
@@ -66,7 +96,7 @@ SemParser getSemParser(std::string_view targetField,
                 // we might consider restrict the abbrev supported
                 try
                 {
-                    auto tz = date::make_zoned(abbrev, tms);
+                    auto tz = date::make_zoned(locateZoneCached(abbrev), tms);
                     date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tz);
                 }
                 catch (std::exception& e)
@@ -88,6 +118,281 @@ SemParser getSemParser(std::string_view targetField,
     };
 }
 
+/**
+ * @brief Formats scanned by hand instead of through stream-based date::parse.
+ *
+ * Building an istringstream, imbuing a locale and running the format
+ * interpreter per event dominates date parsing. The common fixed formats are
+ * scanned with plain digit reads; anything the scanner does not recognize
+ * falls back to the stream parser, so accepted inputs do not change.
+ */
+enum class FastFormat
+{
+    NONE,    ///< Stream parser only
+    SYSLOG,  ///< %b %d %T (RFC3164 timestamp, no year)
+    ISO8601, ///< %FT%T%Ez (RFC3339 with numeric offset)
+    ISO8601Z ///< %FT%TZ
+};
+
+/**
+ * @brief Fields extracted by the fast scanner.
+ */
+struct FastDate
+{
+    date::fields<std::chrono::nanoseconds> fds {};
+    std::chrono::minutes offset {0};
+    size_t consumed {0};
+};
+
+/// Year sentinel outside date::year::ok(), marking formats that carry no year
+constexpr int NO_YEAR = -32768;
+
+/**
+ * @brief Read exactly count digits at pos, advancing pos on success.
+ */
+bool readDigits(std::string_view text, size_t& pos, size_t count, int& out)
+{
+    if (pos + count > text.size())
+    {
+        return false;
+    }
+
+    int value = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto c = text[pos + i];
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+
+    out = value;
+    pos += count;
+    return true;
+}
+
+/**
+ * @brief Read a single expected character at pos, advancing pos on success.
+ */
+bool readChar(std::string_view text, size_t& pos, char expected)
+{
+    if (pos >= text.size() || text[pos] != expected)
+    {
+        return false;
+    }
+
+    ++pos;
+    return true;
+}
+
+/**
+ * @brief Read an optional fractional seconds suffix (. plus up to nine digits).
+ */
+bool readFraction(std::string_view text, size_t& pos, std::chrono::nanoseconds& out)
+{
+    out = std::chrono::nanoseconds {0};
+    if (pos >= text.size() || text[pos] != '.')
+    {
+        return true;
+    }
+
+    auto digits = 0;
+    int64_t value = 0;
+    auto cursor = pos + 1;
+    while (cursor < text.size() && digits < 9 && text[cursor] >= '0' && text[cursor] <= '9')
+    {
+        value = value * 10 + (text[cursor] - '0');
+        ++digits;
+        ++cursor;
+    }
+
+    if (digits == 0)
+    {
+        return false;
+    }
+
+    for (auto i = digits; i < 9; ++i)
+    {
+        value *= 10;
+    }
+
+    out = std::chrono::nanoseconds {value};
+    pos = cursor;
+    return true;
+}
+
+/**
+ * @brief Read the time of day HH:MM:SS with optional fraction.
+ */
+bool readTime(std::string_view text, size_t& pos, date::hh_mm_ss<std::chrono::nanoseconds>& out)
+{
+    int hour {};
+    int minute {};
+    int second {};
+    std::chrono::nanoseconds fraction {};
+
+    if (!readDigits(text, pos, 2, hour) || hour > 23 || !readChar(text, pos, ':') || !readDigits(text, pos, 2, minute)
+        || minute > 59 || !readChar(text, pos, ':') || !readDigits(text, pos, 2, second) || second > 59
+        || !readFraction(text, pos, fraction))
+    {
+        return false;
+    }
+
+    out = date::hh_mm_ss<std::chrono::nanoseconds> {std::chrono::hours {hour} + std::chrono::minutes {minute}
+                                                    + std::chrono::seconds {second} + fraction};
+    return true;
+}
+
+/**
+ * @brief Read a C-locale month abbreviation (Jan..Dec), case-insensitive.
+ *
+ * @return month number 1..12, or 0 on mismatch
+ */
+int readMonthAbbrev(std::string_view text, size_t& pos)
+{
+    static constexpr std::array<std::string_view, 12> MONTHS {
+        "jan", "feb", "mar", "apr", "may", "jun", "jul", "aug", "sep", "oct", "nov", "dec"};
+
+    for (size_t i = 0; i < MONTHS.size(); ++i)
+    {
+        if (scan::startsWithLower(text.substr(pos), MONTHS[i]))
+        {
+            pos += MONTHS[i].size();
+            return static_cast<int>(i) + 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Scan the text with the hand-rolled path for the given format.
+ *
+ * @return std::nullopt when the text does not match strictly; the caller falls
+ * back to the stream parser.
+ */
+std::optional<FastDate> scanDate(FastFormat format, std::string_view text)
+{
+    FastDate result {};
+    size_t pos = 0;
+
+    if (format == FastFormat::SYSLOG)
+    {
+        const auto month = readMonthAbbrev(text, pos);
+        if (month == 0 || !readChar(text, pos, ' '))
+        {
+            return std::nullopt;
+        }
+
+        // Day may be space padded (Jun  4)
+        while (pos < text.size() && text[pos] == ' ')
+        {
+            ++pos;
+        }
+
+        int day {};
+        if (!readDigits(text, pos, 2, day) && !readDigits(text, pos, 1, day))
+        {
+            return std::nullopt;
+        }
+
+        date::hh_mm_ss<std::chrono::nanoseconds> tod {};
+        if (day < 1 || day > 31 || !readChar(text, pos, ' ') || !readTime(text, pos, tod))
+        {
+            return std::nullopt;
+        }
+
+        result.fds = date::fields<std::chrono::nanoseconds> {
+            date::year {NO_YEAR} / date::month {static_cast<unsigned>(month)} / date::day {static_cast<unsigned>(day)},
+            tod};
+        result.consumed = pos;
+        return result;
+    }
+
+    // ISO8601 variants: YYYY-MM-DDTHH:MM:SS[.frac] plus Z or +-HH:MM
+    int year {};
+    int month {};
+    int day {};
+    date::hh_mm_ss<std::chrono::nanoseconds> tod {};
+
+    if (!readDigits(text, pos, 4, year) || !readChar(text, pos, '-') || !readDigits(text, pos, 2, month)
+        || !readChar(text, pos, '-') || !readDigits(text, pos, 2, day) || !readChar(text, pos, 'T')
+        || !readTime(text, pos, tod))
+    {
+        return std::nullopt;
+    }
+
+    const auto ymd =
+        date::year {year} / date::month {static_cast<unsigned>(month)} / date::day {static_cast<unsigned>(day)};
+    if (!ymd.ok())
+    {
+        return std::nullopt;
+    }
+
+    if (format == FastFormat::ISO8601Z)
+    {
+        if (!readChar(text, pos, 'Z'))
+        {
+            return std::nullopt;
+        }
+    }
+    else
+    {
+        if (pos >= text.size() || (text[pos] != '+' && text[pos] != '-'))
+        {
+            return std::nullopt;
+        }
+
+        const auto negative = text[pos] == '-';
+        ++pos;
+
+        int offsetHour {};
+        int offsetMinute {};
+        if (!readDigits(text, pos, 2, offsetHour) || offsetHour > 23 || !readChar(text, pos, ':')
+            || !readDigits(text, pos, 2, offsetMinute) || offsetMinute > 59)
+        {
+            return std::nullopt;
+        }
+
+        result.offset = std::chrono::minutes {(negative ? -1 : 1) * (offsetHour * 60 + offsetMinute)};
+    }
+
+    result.fds = date::fields<std::chrono::nanoseconds> {ymd, tod};
+    result.consumed = pos;
+    return result;
+}
+
+/**
+ * @brief Select the fast scanner for the format, if one applies.
+ *
+ * Month names are matched against the C locale, so any custom parsing locale
+ * keeps the stream path.
+ */
+FastFormat fastFormatFor(const std::string& format, const std::locale& parserLocale)
+{
+    if (parserLocale != std::locale::classic())
+    {
+        return FastFormat::NONE;
+    }
+
+    if (format == "%b %d %T")
+    {
+        return FastFormat::SYSLOG;
+    }
+    if (format == "%FT%T%Ez")
+    {
+        return FastFormat::ISO8601;
+    }
+    if (format == "%FT%TZ")
+    {
+        return FastFormat::ISO8601Z;
+    }
+
+    return FastFormat::NONE;
+}
+
 /**
  * Supported formats, this will be injected by the config module in due time
  */
@@ -276,9 +581,23 @@ Parser getDateParser(const Params& params)
     }
 
     const auto target = params.targetField.empty() ? std::string {} : params.targetField;
+    const auto fastFormat = fastFormatFor(format, parserLocale);
 
-    return [format, parserLocale, outputLocale, name = params.name, target](std::string_view text)
+    return [format, parserLocale, outputLocale, fastFormat, name = params.name, target](std::string_view text)
     {
+        if (fastFormat != FastFormat::NONE)
+        {
+            auto fast = scanDate(fastFormat, text);
+            if (fast)
+            {
+                return abs::makeSuccess(
+                    SemToken {text.substr(0, fast->consumed),
+                              getSemParser(target, fast->fds, outputLocale, std::string {}, name, fast->offset)},
+                    text.substr(fast->consumed));
+            }
+            // Fall through to the stream parser for inputs the scanner rejects
+        }
+
         auto ss = std::istringstream(std::string(text));
         ss.imbue(parserLocale);
 
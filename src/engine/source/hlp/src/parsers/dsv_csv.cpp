@@ -40,7 +40,7 @@ SemParser getSemParser(json::Json&& doc, const std::string& targetField)
  * @param delimiter The delimiter character
  * @param quote The quote character for quoted fields
  * @param escape The escape character for quoted fields
- * @param headers The header names (destination)
+ * @param headers The header names (destination), empty entries mark skipped columns
  * @return parsec::Parser<json::Json>
  */
 inline Parser dsvParserFunction(std::string name,
@@ -86,8 +86,12 @@ inline Parser dsvParserFunction(std::string name,
 
             auto fValue = field.value();
 
-            auto v = remaining.substr(fValue.start(), fValue.len());
-            updateDoc(doc, headers[i], v, fValue.isEscaped(), std::string_view {&escapeChar, 1}, fValue.isQuoted());
+            // Skipped columns are scanned for their delimiter but never materialized
+            if (!headers[i].empty())
+            {
+                auto v = remaining.substr(fValue.start(), fValue.len());
+                updateDoc(doc, headers[i], v, fValue.isEscaped(), std::string_view {&escapeChar, 1}, fValue.isQuoted());
+            }
 
             start += fValue.end() + 1;
             i++;
@@ -145,7 +149,7 @@ Parser getDSVParser(const Params& params)
     std::transform(std::next(params.options.begin(), 3),
                    params.options.end(),
                    std::back_inserter(headers),
-                   [](auto s) { return fmt::format("/{}", s); });
+                   [](const auto& s) { return s == "_" ? std::string {} : fmt::format("/{}", s); });
 
     return dsvParserFunction(params.name, params.stop, delimiter, quote, scape, headers, params.targetField);
 }
@@ -165,7 +169,7 @@ Parser getCSVParser(const Params& params)
     std::transform(params.options.begin(),
                    params.options.end(),
                    std::back_inserter(headers),
-                   [](auto s) { return fmt::format("/{}", s); });
+                   [](const auto& s) { return s == "_" ? std::string {} : fmt::format("/{}", s); });
 
     return dsvParserFunction(params.name, params.stop, delimiter, quote, scape, headers, params.targetField);
 }
@@ -1,3 +1,4 @@
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -6,6 +7,8 @@
 #include <arpa/inet.h>
 #include <fmt/format.h>
 
+#include <base/lruCache.hpp>
+
 #include "hlp.hpp"
 #include "syntax.hpp"
 
@@ -14,6 +17,69 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
+constexpr std::size_t IP_CACHE_SIZE {256};
+
+/**
+ * @brief Validate a dotted-quad IPv4 address with a plain digit walk.
+ *
+ * Same acceptance as inet_pton(AF_INET): four decimal octets of one to three
+ * digits, values up to 255 and no leading zeros, but working directly on the
+ * borrowed view without the string copy and the libc call.
+ */
+bool isIPv4(std::string_view text)
+{
+    std::size_t pos = 0;
+    for (auto octet = 0; octet < 4; ++octet)
+    {
+        if (octet > 0)
+        {
+            if (pos >= text.size() || text[pos] != '.')
+            {
+                return false;
+            }
+            ++pos;
+        }
+
+        const auto start = pos;
+        auto value = 0u;
+        while (pos < text.size() && pos - start < 3 && text[pos] >= '0' && text[pos] <= '9')
+        {
+            value = value * 10 + static_cast<unsigned>(text[pos] - '0');
+            ++pos;
+        }
+
+        const auto len = pos - start;
+        if (len == 0 || value > 255 || (len > 1 && text[start] == '0'))
+        {
+            return false;
+        }
+    }
+
+    return pos == text.size();
+}
+
+/**
+ * @brief Validate an IPv6 address with inet_pton, memoizing recent results.
+ *
+ * Flow logs repeat the same few addresses over and over, so a small per-thread
+ * cache keeps the libc validation off the hot path.
+ */
+bool isIPv6(std::string_view text)
+{
+    thread_local LRUCache<std::string, bool> cache {IP_CACHE_SIZE};
+
+    std::string address {text};
+    if (const auto hit = cache.getValue(address))
+    {
+        return *hit;
+    }
+
+    struct in6_addr ip6;
+    const auto valid = inet_pton(AF_INET6, address.c_str(), &ip6) == 1;
+    cache.insertKey(address, valid);
+    return valid;
+}
+
 Mapper getMapper(std::string_view parsed, std::string_view targetField)
 {
     return [parsed, targetField](json::Json& event)
@@ -26,11 +92,7 @@ SemParser getSemParser(const std::string& targetField)
 {
     return [targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
-        struct in_addr ip;
-        struct in6_addr ip6;
-
-        if (!inet_pton(AF_INET, std::string(parsed).c_str(), &ip)
-            && !inet_pton(AF_INET6, std::string(parsed).c_str(), &ip6))
+        if (!isIPv4(parsed) && !isIPv6(parsed))
         {
             return base::Error {"Invalid IPv4 or IPv6 address"};
         }
@@ -1,9 +1,12 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 #include <rapidjson/document.h>
+#include <rapidjson/pointer.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 
 #include "hlp.hpp"
@@ -30,31 +33,291 @@ SemParser getSemParser(std::string_view targetField, json::Json&& parsed)
     };
 }
 
+/**
+ * @brief SAX handler extracting a fixed subset of fields from a JSON payload.
+ *
+ * Building a full DOM for large payloads where the decoder maps only a few
+ * fields wastes allocator work on values that are thrown away. This handler
+ * tracks the pointer path of the value being visited and materializes only the
+ * subtrees rooted at one of the wanted paths; everything else is tokenized by
+ * the reader but never allocated.
+ *
+ * Wanted paths address object members only; a path crossing an array never
+ * matches and the array is passed over.
+ */
+class SubsetHandler
+{
+private:
+    const std::vector<std::string>& m_wanted; ///< Pointer paths to extract
+    rapidjson::Document m_doc;                ///< Output document holding the captured subset
+
+    /// Escaped key per open object while navigating; arrays push a sentinel no key can produce
+    std::vector<std::string> m_keys;
+    static constexpr std::string_view ARRAY_SENTINEL = "\n";
+
+    bool m_capturing {false};
+    std::string m_capturePath; ///< Wanted path of the subtree being captured
+    /// Values under construction, each with the pending member key of its next child
+    std::vector<std::pair<rapidjson::Value, std::string>> m_build;
+
+    /**
+     * @brief Pointer path of the value about to be visited, with keys escaped.
+     */
+    std::string currentPath() const
+    {
+        std::string path;
+        for (const auto& key : m_keys)
+        {
+            path += '/';
+            path += key;
+        }
+        return path;
+    }
+
+    /**
+     * @brief Escape a member key for pointer path comparison.
+     */
+    static std::string escape(std::string_view key)
+    {
+        std::string escaped;
+        escaped.reserve(key.size());
+        for (const auto c : key)
+        {
+            if (c == '~')
+            {
+                escaped += "~0";
+            }
+            else if (c == '/')
+            {
+                escaped += "~1";
+            }
+            else
+            {
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    bool isWanted(const std::string& path) const
+    {
+        for (const auto& wanted : m_wanted)
+        {
+            if (wanted == path)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Attach a finished value to the subtree under construction, or
+     * store the completed capture in the output document.
+     */
+    bool emit(rapidjson::Value&& value)
+    {
+        auto& allocator = m_doc.GetAllocator();
+        if (m_build.empty())
+        {
+            rapidjson::Pointer {m_capturePath.data(), m_capturePath.size()}.Set(
+                m_doc, std::move(value), allocator);
+            m_capturing = false;
+            return true;
+        }
+
+        auto& [parent, pendingKey] = m_build.back();
+        if (parent.IsObject())
+        {
+            parent.AddMember(
+                rapidjson::Value {pendingKey.data(), static_cast<rapidjson::SizeType>(pendingKey.size()), allocator},
+                std::move(value),
+                allocator);
+        }
+        else
+        {
+            parent.PushBack(std::move(value), allocator);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Handle a scalar, either attaching it to a capture or checking if
+     * it starts one.
+     */
+    bool scalar(rapidjson::Value&& value)
+    {
+        if (m_capturing)
+        {
+            return emit(std::move(value));
+        }
+
+        if (!m_keys.empty() && m_keys.back() != ARRAY_SENTINEL && isWanted(currentPath()))
+        {
+            m_capturePath = currentPath();
+            m_capturing = true;
+            return emit(std::move(value));
+        }
+        return true;
+    }
+
+public:
+    explicit SubsetHandler(const std::vector<std::string>& wanted)
+        : m_wanted(wanted)
+    {
+        // Matches are rooted under an object; with none found the subset is empty
+        m_doc.SetObject();
+    }
+
+    /**
+     * @brief Extracted subset, rooted at the original relative paths.
+     */
+    rapidjson::Document& doc() { return m_doc; }
+
+    // rapidjson::Reader handler interface
+    bool Null() { return scalar(rapidjson::Value {}); }
+    bool Bool(bool b) { return scalar(rapidjson::Value {b}); }
+    bool Int(int i) { return scalar(rapidjson::Value {i}); }
+    bool Uint(unsigned u) { return scalar(rapidjson::Value {u}); }
+    bool Int64(int64_t i) { return scalar(rapidjson::Value {i}); }
+    bool Uint64(uint64_t u) { return scalar(rapidjson::Value {u}); }
+    bool Double(double d) { return scalar(rapidjson::Value {d}); }
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool)
+    {
+        return scalar(rapidjson::Value {str, length, m_doc.GetAllocator()});
+    }
+    bool String(const char* str, rapidjson::SizeType length, bool)
+    {
+        return scalar(rapidjson::Value {str, length, m_doc.GetAllocator()});
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool)
+    {
+        if (m_capturing)
+        {
+            m_build.back().second.assign(str, length);
+        }
+        else
+        {
+            m_keys.back() = escape({str, length});
+        }
+        return true;
+    }
+
+    bool StartObject()
+    {
+        if (!m_capturing && !m_keys.empty() && m_keys.back() != ARRAY_SENTINEL && isWanted(currentPath()))
+        {
+            m_capturePath = currentPath();
+            m_capturing = true;
+        }
+
+        if (m_capturing)
+        {
+            m_build.emplace_back(rapidjson::Value {rapidjson::kObjectType}, std::string {});
+        }
+        else
+        {
+            m_keys.emplace_back();
+        }
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        if (m_capturing)
+        {
+            auto value = std::move(m_build.back().first);
+            m_build.pop_back();
+            return emit(std::move(value));
+        }
+
+        m_keys.pop_back();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        if (!m_capturing && !m_keys.empty() && m_keys.back() != ARRAY_SENTINEL && isWanted(currentPath()))
+        {
+            m_capturePath = currentPath();
+            m_capturing = true;
+        }
+
+        if (m_capturing)
+        {
+            m_build.emplace_back(rapidjson::Value {rapidjson::kArrayType}, std::string {});
+        }
+        else
+        {
+            m_keys.emplace_back(ARRAY_SENTINEL);
+        }
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType)
+    {
+        if (m_capturing)
+        {
+            auto value = std::move(m_build.back().first);
+            m_build.pop_back();
+            return emit(std::move(value));
+        }
+
+        m_keys.pop_back();
+        return true;
+    }
+};
+
 } // namespace
 namespace hlp::parsers
 {
 
 Parser getJSONParser(const Params& params)
 {
-    if (!params.options.empty())
+    // Options select the subset of fields to extract; without them the whole
+    // payload is parsed into a DOM as before
+    std::vector<std::string> wanted;
+    for (const auto& opt : params.options)
     {
-        throw std::runtime_error(fmt::format("JSON parser do not accept arguments!"));
+        if (opt.empty())
+        {
+            throw std::runtime_error(fmt::format("JSON parser does not accept empty field names!"));
+        }
+        wanted.emplace_back(json::Json::formatJsonPath(opt));
     }
 
     const auto target = params.targetField.empty() ? "" : params.targetField;
 
-    return [name = params.name, target](std::string_view txt)
+    return [name = params.name, target, wanted](std::string_view txt)
     {
         if (txt.empty())
         {
             return abs::makeFailure<ResultT>(txt, name);
         }
 
-        rapidjson::Reader reader;
         const auto ssInput = std::string(txt);
         rapidjson::StringStream ss(ssInput.c_str());
-        rapidjson::Document doc;
 
+        // Subset mode: SAX extraction of the wanted fields only
+        if (!wanted.empty())
+        {
+            rapidjson::Reader reader;
+            SubsetHandler handler {wanted};
+            reader.Parse<rapidjson::kParseStopWhenDoneFlag>(ss, handler);
+            if (reader.HasParseError())
+            {
+                return abs::makeFailure<ResultT>(txt, name);
+            }
+
+            const auto parsed = txt.substr(0, ss.Tell());
+            const auto remaining = txt.substr(ss.Tell());
+            const auto semP =
+                target.empty() ? noSemParser() : getSemParser(target, json::Json(std::move(handler.doc())));
+            return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, remaining);
+        }
+
+        rapidjson::Document doc;
         doc.ParseStream<rapidjson::kParseStopWhenDoneFlag>(ss);
         if (doc.HasParseError())
         {
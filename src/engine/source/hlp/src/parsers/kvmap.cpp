@@ -1,3 +1,4 @@
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -16,19 +17,33 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& doc, std::string_view targetField)
+Mapper getMapper(std::string_view kvInput, const std::vector<Field>& fields, char esc, const std::string& targetField)
 {
-    return [doc, targetField](json::Json& event)
+    return [kvInput, fields, esc, targetField](json::Json& event)
     {
-        event.set(targetField, doc);
+        // Write each pair straight into the event document, so the pairs are allocated
+        // once with the event's allocator instead of being materialized in an
+        // intermediate document and copied on merge
+        event.setObject(targetField);
+        for (std::size_t i = 0; i + 1 < fields.size(); i += 2)
+        {
+            const auto key = kvInput.substr(fields[i].start(), fields[i].len());
+            const auto value = kvInput.substr(fields[i + 1].start(), fields[i + 1].len());
+            updateDoc(event,
+                      fmt::format("{}/{}", targetField, key),
+                      value,
+                      fields[i + 1].isEscaped(),
+                      std::string_view {&esc, 1},
+                      fields[i + 1].isQuoted());
+        }
     };
 }
 
-SemParser getSemParser(json::Json&& doc, const std::string& targetField)
+SemParser getSemParser(std::string_view kvInput, std::vector<Field>&& fields, char esc, const std::string& targetField)
 {
-    return [targetField, doc](std::string_view)
+    return [kvInput, fields = std::move(fields), esc, targetField](std::string_view)
     {
-        return getMapper(doc, targetField);
+        return getMapper(kvInput, fields, esc, targetField);
     };
 }
 } // namespace
@@ -72,7 +87,6 @@ Parser getKVParser(const Params& params)
         auto remaining = txt.substr(kvInput.size());
 
         size_t start {0}, end {0};
-        json::Json doc;
 
         std::vector<Field> kv;
         auto dlm = sep;
@@ -109,7 +123,6 @@ Parser getKVParser(const Params& params)
         for (auto i = 0; i < kv.size() - 1; i += 2)
         {
             auto k = kvInput.substr(kv[i].start(), kv[i].len());
-            auto v = kvInput.substr(kv[i + 1].start(), kv[i + 1].len());
             if (k.empty())
             {
                 return abs::makeFailure<ResultT>(txt.substr(kv[i].start()), name);
@@ -119,8 +132,6 @@ Parser getKVParser(const Params& params)
                 //     index);
             }
             end = kv[i + 1].end();
-            updateDoc(
-                doc, fmt::format("/{}", k), v, kv[i + 1].isEscaped(), std::string_view {&esc, 1}, kv[i + 1].isQuoted());
         }
 
         if (start - 1 != end)
@@ -135,7 +146,7 @@ Parser getKVParser(const Params& params)
             return abs::makeFailure<ResultT>(txt.substr(end), name);
         }
 
-        const auto semP = targetField.empty() ? noSemParser() : getSemParser(std::move(doc), targetField);
+        auto semP = targetField.empty() ? noSemParser() : getSemParser(kvInput, std::move(kv), esc, targetField);
         return abs::makeSuccess<ResultT>(SemToken {kvInput, std::move(semP)}, remaining);
     };
 }
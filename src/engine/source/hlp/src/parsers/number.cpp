@@ -15,6 +15,16 @@ void setNumber(std::string_view targetField, json::Json& doc, int8_t val)
     doc.setInt(val, targetField);
 }
 
+void setNumber(std::string_view targetField, json::Json& doc, int16_t val)
+{
+    doc.setInt(val, targetField);
+}
+
+void setNumber(std::string_view targetField, json::Json& doc, int32_t val)
+{
+    doc.setInt(val, targetField);
+}
+
 void setNumber(std::string_view targetField, json::Json& doc, int64_t val)
 {
     doc.setInt64(val, targetField);
@@ -35,6 +45,16 @@ std::from_chars_result from_chars(const char* first, const char* last, int8_t& v
     return std::from_chars(first, last, val);
 }
 
+std::from_chars_result from_chars(const char* first, const char* last, int16_t& val)
+{
+    return std::from_chars(first, last, val);
+}
+
+std::from_chars_result from_chars(const char* first, const char* last, int32_t& val)
+{
+    return std::from_chars(first, last, val);
+}
+
 std::from_chars_result from_chars(const char* first, const char* last, int64_t& val)
 {
     return std::from_chars(first, last, val);
@@ -62,6 +82,16 @@ Parser getByteParser(const Params& params)
     return getNumericParser<int8_t>(params);
 }
 
+Parser getShortParser(const Params& params)
+{
+    return getNumericParser<int16_t>(params);
+}
+
+Parser getIntegerParser(const Params& params)
+{
+    return getNumericParser<int32_t>(params);
+}
+
 Parser getLongParser(const Params& params)
 {
     return getNumericParser<int64_t>(params);
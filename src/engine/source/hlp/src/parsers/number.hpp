@@ -17,10 +17,14 @@
 namespace utils
 {
 void setNumber(std::string_view targetField, json::Json& doc, int8_t val);
+void setNumber(std::string_view targetField, json::Json& doc, int16_t val);
+void setNumber(std::string_view targetField, json::Json& doc, int32_t val);
 void setNumber(std::string_view targetField, json::Json& doc, int64_t val);
 void setNumber(std::string_view targetField, json::Json& doc, float_t val);
 void setNumber(std::string_view targetField, json::Json& doc, double_t val);
 std::from_chars_result from_chars(const char* first, const char* last, int8_t& val);
+std::from_chars_result from_chars(const char* first, const char* last, int16_t& val);
+std::from_chars_result from_chars(const char* first, const char* last, int32_t& val);
 std::from_chars_result from_chars(const char* first, const char* last, int64_t& val);
 std::from_chars_result from_chars(const char* first, const char* last, float& val);
 std::from_chars_result from_chars(const char* first, const char* last, double& val);
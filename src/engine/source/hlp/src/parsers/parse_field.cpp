@@ -1,6 +1,7 @@
 #include "parse_field.hpp"
 #include "fmt/format.h"
 #include "number.hpp"
+#include "scan.hpp"
 #include <base/json.hpp>
 #include <iostream>
 #include <string_view>
@@ -24,6 +25,14 @@ getField(std::string_view input, const char delimiter, const char quote, const c
 
     for (auto i = 0ul; i < input.size(); i++)
     {
+        // Jump straight to the next character that can change the parse state;
+        // everything in between is plain field content
+        i = quote_opened ? scan::findFirstOf(input, quote, escape, i) : scan::findFirstOf(input, delimiter, quote, i);
+        if (i == std::string_view::npos)
+        {
+            break;
+        }
+
         if (input[i] == delimiter && !quote_opened)
         {
             // Found delimiter outside quotes, return field
@@ -5,6 +5,8 @@
 
 #include <fmt/format.h>
 
+#include <base/utils/scratchBuffer.hpp>
+
 #include "hlp.hpp"
 #include "syntax.hpp"
 
@@ -25,7 +27,10 @@ SemParser getSemParser(const std::string& targetField, char escape)
 {
     return [targetField, escape](std::string_view parsed)
     {
-        std::string tr(parsed.begin() + 1, parsed.end() - 1);
+        // Unescape into a leased scratch string; the mapper copies it out
+        base::utils::scratch::Buffer scratch;
+        auto& tr = scratch.str();
+        tr.assign(parsed.begin() + 1, parsed.end() - 1);
         tr.erase(std::remove(tr.begin(), tr.end(), escape), tr.end());
         return getMapper(tr, targetField);
     };
@@ -10,6 +10,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -17,6 +18,167 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
+/**
+ * @brief Component views of a URL split by the fast path, borrowed from the parsed text.
+ */
+struct UriParts
+{
+    std::string_view scheme;
+    std::string_view domain;
+    std::string_view port;
+    std::string_view path;
+    std::string_view query;
+    std::string_view fragment;
+};
+
+const scan::CharClass& schemeClass()
+{
+    static const scan::CharClass c {[](int ch) { return std::islower(ch) || std::isdigit(ch); }, "+-."};
+    return c;
+}
+
+const scan::CharClass& hostClass()
+{
+    static const scan::CharClass c {[](int ch) { return std::islower(ch) || std::isdigit(ch); }, ".-"};
+    return c;
+}
+
+const scan::CharClass& portClass()
+{
+    static const scan::CharClass c {[](int ch) { return std::isdigit(ch); }};
+    return c;
+}
+
+const scan::CharClass& pathClass()
+{
+    static const scan::CharClass c {[](int ch) { return std::isalnum(ch); }, "-._~!$&'()*+,;=:@/"};
+    return c;
+}
+
+const scan::CharClass& queryClass()
+{
+    static const scan::CharClass c {[](int ch) { return std::isalnum(ch); }, "-._~!$&'()*+,;=:@/?"};
+    return c;
+}
+
+/**
+ * @brief Split a well-formed URL into component views with a single pass.
+ *
+ * Only accepts inputs that libcurl would reproduce byte for byte: lowercase scheme and
+ * host, explicit path, no userinfo, no IP literals, no percent escapes and no dot
+ * segments. Anything else returns false so the caller falls back to the strict curl
+ * parser, which owns normalization.
+ */
+bool splitUri(std::string_view uri, UriParts& parts)
+{
+    // Anything that curl would re-encode, decode or normalize disqualifies the fast path
+    for (const auto anomaly : {'%', '@', '[', ' ', '\\'})
+    {
+        if (scan::findChar(uri, anomaly) != std::string_view::npos)
+        {
+            return false;
+        }
+    }
+
+    // scheme "://"
+    if (uri.empty() || !std::islower(static_cast<unsigned char>(uri.front())))
+    {
+        return false;
+    }
+    auto pos = schemeClass().skip(uri, 1);
+    if (uri.compare(pos, 3, "://") != 0)
+    {
+        return false;
+    }
+    parts.scheme = uri.substr(0, pos);
+    pos += 3;
+
+    // host
+    const auto hostStart = pos;
+    pos = hostClass().skip(uri, pos);
+    if (pos == hostStart)
+    {
+        return false;
+    }
+    parts.domain = uri.substr(hostStart, pos - hostStart);
+
+    // optional port, leading zeros would not round-trip through curl
+    if (pos < uri.size() && uri[pos] == ':')
+    {
+        const auto portStart = pos + 1;
+        pos = portClass().skip(uri, portStart);
+        const auto len = pos - portStart;
+        if (len == 0 || len > 5 || uri[portStart] == '0')
+        {
+            return false;
+        }
+        parts.port = uri.substr(portStart, len);
+    }
+
+    // explicit path, curl synthesizes "/" when it is missing
+    if (pos >= uri.size() || uri[pos] != '/')
+    {
+        return false;
+    }
+    const auto pathStart = pos;
+    pos = pathClass().skip(uri, pos);
+    parts.path = uri.substr(pathStart, pos - pathStart);
+    if (parts.path.find("/.") != std::string_view::npos)
+    {
+        return false;
+    }
+
+    // optional query
+    if (pos < uri.size() && uri[pos] == '?')
+    {
+        const auto queryStart = pos + 1;
+        pos = queryClass().skip(uri, queryStart);
+        if (pos == queryStart)
+        {
+            return false;
+        }
+        parts.query = uri.substr(queryStart, pos - queryStart);
+    }
+
+    // optional fragment
+    if (pos < uri.size() && uri[pos] == '#')
+    {
+        const auto fragmentStart = pos + 1;
+        pos = queryClass().skip(uri, fragmentStart);
+        if (pos == fragmentStart)
+        {
+            return false;
+        }
+        parts.fragment = uri.substr(fragmentStart, pos - fragmentStart);
+    }
+
+    return pos == uri.size();
+}
+
+Mapper getUriPartsMapper(std::string_view parsed, const UriParts& parts, std::string_view targetField)
+{
+    return [parsed, parts, targetField](json::Json& event)
+    {
+        const auto base = std::string {targetField};
+        event.setString(parsed, base + "/original");
+        event.setString(parts.scheme, base + "/scheme");
+        event.setString(parts.domain, base + "/domain");
+        event.setString(parts.path, base + "/path");
+        if (!parts.port.empty())
+        {
+            event.setString(parts.port, base + "/port");
+        }
+        if (!parts.query.empty())
+        {
+            event.setString(parts.query, base + "/query");
+        }
+        if (!parts.fragment.empty())
+        {
+            event.setString(parts.fragment, base + "/fragment");
+        }
+    };
+}
+
 Mapper getUriMapper(std::map<std::string, std::string>&& uriAttrs, std::string_view targetField)
 {
     return [uriAttrs, targetField](json::Json& event)
@@ -33,6 +195,19 @@ SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields,
 {
     return [mapCurlFields, targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
+        // Fast path: split conforming URLs into borrowed views, no curl handle and no
+        // per-component copies. The strict parser below keeps handling everything that
+        // needs normalization.
+        UriParts parts;
+        if (splitUri(parsed, parts))
+        {
+            if (targetField.empty())
+            {
+                return noMapper();
+            }
+            return getUriPartsMapper(parsed, parts, targetField);
+        }
+
         const auto urlstr = std::string(parsed);
         auto urlCleanup = [](auto* url)
         {
@@ -1,6 +1,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 #include <pugixml.hpp>
@@ -51,6 +52,18 @@ std::unordered_map<std::string_view, xmlModule> xmlModules = {
     {"windows", xmlWinModule},
 };
 
+/**
+ * @brief A field selection for the windows module, limiting the conversion to the
+ * System/EventData entries the decoder actually maps.
+ */
+struct SelectedField
+{
+    std::string section; ///< "System" or "EventData"
+    std::string name;    ///< Element or Data name, empty to take the whole section
+};
+
+void convertElement(pugi::xml_node& node, json::Json& docJson, const xmlModule& mod, const std::string& path);
+
 void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod, const std::string& path = "")
 {
     // TODO: add array support
@@ -63,67 +76,153 @@ void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod
             continue;
         }
 
-        std::string localPath {path};
+        convertElement(node, docJson, mod, path);
+    }
+}
 
-        // Check if we have special rules and if are applied
-        auto processed = false;
-        if (mod)
-        {
-            processed = mod(node, docJson, localPath);
-        }
+// Convert a single element and its subtree, applying the module rules
+void convertElement(pugi::xml_node& node, json::Json& docJson, const xmlModule& mod, const std::string& path)
+{
+    std::string localPath {path};
 
-        bool isElementOfArray = false; // If the element is an array, the path should be adjusted
+    // Check if we have special rules and if are applied
+    auto processed = false;
+    if (mod)
+    {
+        processed = mod(node, docJson, localPath);
+    }
 
-        if (!processed)
-        {
-            localPath += "/" + std::string {node.name()};
+    bool isElementOfArray = false; // If the element is an array, the path should be adjusted
 
-            // Check if the element already exists
-            if (docJson.exists(localPath))
-            {
-                isElementOfArray = true; // If exists, should be an array
-                if (docJson.isObject(localPath))
-                {
-                    json::Json tmp = docJson.getJson(localPath).value();
-                    docJson.setArray(localPath);
-                    docJson.appendJson(tmp, localPath);
-                    localPath += "/1";
-                }
-                else if (docJson.isArray(localPath))
-                {
-                    size_t index = docJson.size(localPath);
-                    localPath += "/" + std::to_string(index);
-                }
-            }
+    if (!processed)
+    {
+        localPath += "/" + std::string {node.name()};
 
-            if (!node.text().empty())
+        // Check if the element already exists
+        if (docJson.exists(localPath))
+        {
+            isElementOfArray = true; // If exists, should be an array
+            if (docJson.isObject(localPath))
             {
-                docJson.setString(node.text().as_string(), localPath + "/#text");
+                json::Json tmp = docJson.getJson(localPath).value();
+                docJson.setArray(localPath);
+                docJson.appendJson(tmp, localPath);
+                localPath += "/1";
             }
-
-            for (auto attr : node.attributes())
+            else if (docJson.isArray(localPath))
             {
-                docJson.setString(attr.value(), localPath + "/@" + attr.name());
+                size_t index = docJson.size(localPath);
+                localPath += "/" + std::to_string(index);
             }
+        }
+
+        if (!node.text().empty())
+        {
+            docJson.setString(node.text().as_string(), localPath + "/#text");
+        }
+
+        for (auto attr : node.attributes())
+        {
+            docJson.setString(attr.value(), localPath + "/@" + attr.name());
+        }
+
+        if (node.text().empty() && node.attributes().empty())
+        {
+            docJson.setObject(localPath);
+        }
+    }
+
+    // Ajdust path if the element is an array
+    if (isElementOfArray)
+    {
+        localPath = localPath.substr(0, localPath.find_last_of('/'));
+    }
+
+    // Process children
+    if (!node.first_child().empty())
+    {
+        xmlToJson(node, docJson, mod, localPath);
+    }
+}
+
+/**
+ * @brief Convert only the selected System/EventData fields instead of the whole document.
+ *
+ * Navigates straight to the requested elements and reuses convertElement on each hit, so
+ * the selected fields keep exactly the shape the full conversion gives them while the rest
+ * of the event is never turned into json.
+ */
+void extractSelected(pugi::xml_document& xmlDoc,
+                     json::Json& docJson,
+                     const xmlModule& mod,
+                     const std::vector<SelectedField>& fields)
+{
+    docJson.setObject();
+
+    // EventChannel events wrap the sections in an Event element, bare fragments do not
+    pugi::xml_node base = xmlDoc.child("Event");
+    if (base.empty())
+    {
+        base = xmlDoc;
+    }
+
+    for (const auto& field : fields)
+    {
+        auto section = base.child(field.section.c_str());
+        if (section.empty())
+        {
+            continue;
+        }
 
-            if (node.text().empty() && node.attributes().empty())
+        if (field.name.empty())
+        {
+            convertElement(section, docJson, mod, "");
+        }
+        else if (field.section == "EventData")
+        {
+            // Data entries are keyed by their Name attribute, not their element name
+            const std::string sectionPath = "/" + field.section;
+            for (auto data : section.children("Data"))
             {
-                docJson.setObject(localPath);
+                if (field.name == data.attribute("Name").as_string())
+                {
+                    convertElement(data, docJson, mod, sectionPath);
+                }
             }
         }
-
-        // Ajdust path if the element is an array
-        if (isElementOfArray)
+        else
         {
-            localPath = localPath.substr(0, localPath.find_last_of('/'));
+            const std::string sectionPath = "/" + field.section;
+            for (auto node : section.children(field.name.c_str()))
+            {
+                convertElement(node, docJson, mod, sectionPath);
+            }
         }
+    }
+}
 
-        // Process children
-        if (!node.first_child().empty())
+// Parse the extra parser options into field selections, e.g. "System.EventID" or "EventData"
+std::vector<SelectedField> parseSelectedFields(const std::vector<std::string>& options)
+{
+    std::vector<SelectedField> fields;
+    for (auto it = options.begin() + 1; it != options.end(); ++it)
+    {
+        const auto dot = it->find('.');
+        SelectedField field {it->substr(0, dot), dot == std::string::npos ? "" : it->substr(dot + 1)};
+
+        if ((field.section != "System" && field.section != "EventData")
+            || (dot != std::string::npos && field.name.empty()))
         {
-            xmlToJson(node, docJson, mod, localPath);
+            throw std::runtime_error(
+                fmt::format("XML parser: invalid field selection '{}', expected 'System', 'EventData', "
+                            "'System.<element>' or 'EventData.<name>'.",
+                            *it));
         }
+
+        fields.emplace_back(std::move(field));
     }
+
+    return fields;
 }
 
 Mapper getMapper(const json::Json& parsed, std::string_view targetField)
@@ -134,20 +233,30 @@ Mapper getMapper(const json::Json& parsed, std::string_view targetField)
     };
 }
 
-SemParser getSemParser(const std::string& targetField, xmlModule moduleFn)
+SemParser getSemParser(const std::string& targetField, xmlModule moduleFn, std::vector<SelectedField> selected)
 {
-    return [targetField, moduleFn](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    return [targetField, moduleFn, selected = std::move(selected)](
+               std::string_view parsed) -> std::variant<Mapper, base::Error>
     {
         json::Json jParsed;
         pugi::xml_document xmlDoc;
-        auto bufferInput = std::string(parsed);
-        auto parseResult = xmlDoc.load_buffer(bufferInput.data(), bufferInput.size());
+        // load_buffer copies into the document's own pool, the borrowed view does not
+        // need to be NUL terminated
+        auto parseResult = xmlDoc.load_buffer(parsed.data(), parsed.size());
 
         if (parseResult.status != pugi::status_ok)
         {
             return base::Error {"Invalid XML"};
         }
-        xmlToJson(xmlDoc, jParsed, moduleFn);
+
+        if (selected.empty())
+        {
+            xmlToJson(xmlDoc, jParsed, moduleFn);
+        }
+        else
+        {
+            extractSelected(xmlDoc, jParsed, moduleFn, selected);
+        }
 
         if (targetField.empty())
         {
@@ -171,27 +280,34 @@ Parser getXMLParser(const Params& params)
     }
 
     std::string moduleName;
+    std::vector<SelectedField> selected;
 
     if (params.options.empty())
     {
         moduleName = "default";
     }
-    else if (params.options.size() == 1)
+    else
     {
         moduleName = params.options[0];
         if (xmlModules.count(moduleName) == 0)
         {
             throw std::runtime_error(fmt::format("XML parser module {} not found.", moduleName));
         }
-    }
-    else
-    {
-        throw std::runtime_error(fmt::format("XML parser requires 0 or 1 arguments."));
+
+        if (params.options.size() > 1)
+        {
+            if (moduleName != "windows")
+            {
+                throw std::runtime_error(
+                    fmt::format("XML parser: field selection is only supported by the windows module."));
+            }
+            selected = parseSelectedFields(params.options);
+        }
     }
 
     xmlModule moduleFn = xmlModules[moduleName];
     const auto target = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getSemParser(target, moduleFn);
+    const auto semP = getSemParser(target, moduleFn, std::move(selected));
     const auto synP = syntax::parsers::toEnd(params.stop);
 
     return [moduleFn, name = params.name, semP, synP](std::string_view txt)
@@ -0,0 +1,163 @@
+#ifndef _HLP_SCAN_HPP
+#define _HLP_SCAN_HPP
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <string_view>
+
+/**
+ * @brief Byte scanning kernels shared by the hlp parsers.
+ *
+ * The hot preamble scans (literal match, delimiter find, character class skip)
+ * go through memchr/memcmp instead of hand-rolled byte-at-a-time loops. libc
+ * dispatches those primitives at runtime to the widest vector unit the CPU
+ * offers (SSE4.2/AVX2 on x86_64, ASIMD on aarch64), so every parser built on
+ * these kernels gets the SIMD path with a scalar fallback for free.
+ */
+namespace hlp::scan
+{
+
+/**
+ * @brief Position of the first occurrence of c at or after from, npos if absent.
+ */
+inline std::size_t findChar(std::string_view input, char c, std::size_t from = 0)
+{
+    if (from >= input.size())
+    {
+        return std::string_view::npos;
+    }
+
+    const auto* hit =
+        static_cast<const char*>(std::memchr(input.data() + from, static_cast<unsigned char>(c), input.size() - from));
+    return hit != nullptr ? static_cast<std::size_t>(hit - input.data()) : std::string_view::npos;
+}
+
+/**
+ * @brief Position of the first occurrence of either a or b at or after from, npos if neither is present.
+ */
+inline std::size_t findFirstOf(std::string_view input, char a, char b, std::size_t from = 0)
+{
+    const auto posA = findChar(input, a, from);
+    const auto posB = (a == b) ? posA : findChar(input, b, from);
+    // npos is the largest size_t, so min() picks the real hit when only one matched
+    return std::min(posA, posB);
+}
+
+/**
+ * @brief True when input starts with the literal.
+ */
+inline bool startsWith(std::string_view input, std::string_view literal)
+{
+    return input.size() >= literal.size() && std::memcmp(input.data(), literal.data(), literal.size()) == 0;
+}
+
+/**
+ * @brief Lowercase mapping table, built once instead of calling std::tolower per byte.
+ */
+inline const std::array<unsigned char, 256>& lowerTable()
+{
+    static const auto table = []()
+    {
+        std::array<unsigned char, 256> t {};
+        for (std::size_t c = 0; c < t.size(); ++c)
+        {
+            t[c] = static_cast<unsigned char>(std::tolower(static_cast<int>(c)));
+        }
+        return t;
+    }();
+    return table;
+}
+
+/**
+ * @brief True when input starts with the literal, ignoring case. The literal must already be lowercase.
+ */
+inline bool startsWithLower(std::string_view input, std::string_view lowerLiteral)
+{
+    if (input.size() < lowerLiteral.size())
+    {
+        return false;
+    }
+
+    const auto& lower = lowerTable();
+    for (std::size_t i = 0; i < lowerLiteral.size(); ++i)
+    {
+        if (lower[static_cast<unsigned char>(input[i])] != static_cast<unsigned char>(lowerLiteral[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Byte membership table for character class matching and skipping.
+ *
+ * Replaces per-character calls into <cctype> (and substring searches for
+ * additional characters) with a single table lookup.
+ */
+class CharClass
+{
+private:
+    std::array<bool, 256> m_table {};
+
+public:
+    /**
+     * @brief Build the class from a <cctype>-style predicate plus explicitly allowed characters.
+     */
+    explicit CharClass(int (*predicate)(int), std::string_view additional = "")
+    {
+        if (predicate != nullptr)
+        {
+            for (std::size_t c = 0; c < m_table.size(); ++c)
+            {
+                m_table[c] = predicate(static_cast<int>(c)) != 0;
+            }
+        }
+        for (const auto c : additional)
+        {
+            m_table[static_cast<unsigned char>(c)] = true;
+        }
+    }
+
+    /**
+     * @brief Class of decimal digits.
+     */
+    static CharClass digits() { return CharClass {[](int c) { return std::isdigit(c); }}; }
+
+    /**
+     * @brief Class of hexadecimal digits.
+     */
+    static CharClass xdigits() { return CharClass {[](int c) { return std::isxdigit(c); }}; }
+
+    /**
+     * @brief Class of alphanumeric characters plus explicitly allowed ones.
+     */
+    static CharClass alnum(std::string_view additional = "")
+    {
+        return CharClass {[](int c) { return std::isalnum(c); }, additional};
+    }
+
+    /**
+     * @brief True when the character belongs to the class.
+     */
+    bool contains(char c) const { return m_table[static_cast<unsigned char>(c)]; }
+
+    /**
+     * @brief Index of the first character at or after from that is not in the class, input.size() if all are.
+     */
+    std::size_t skip(std::string_view input, std::size_t from = 0) const
+    {
+        auto i = from;
+        while (i < input.size() && m_table[static_cast<unsigned char>(input[i])])
+        {
+            ++i;
+        }
+        return i;
+    }
+};
+
+} // namespace hlp::scan
+
+#endif // _HLP_SCAN_HPP
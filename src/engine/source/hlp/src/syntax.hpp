@@ -5,6 +5,7 @@
 #include <stdexcept>
 
 #include "abstractParser.hpp"
+#include "scan.hpp"
 
 /**
  * @brief Contains the Parser and Result types for the syntax parsers
@@ -186,9 +187,10 @@ inline Parser char_(char c)
  */
 inline Parser digit()
 {
+    static const auto digits = scan::CharClass::digits();
     return [](std::string_view input) -> Result
     {
-        if (input.empty() || !std::isdigit(input[0]))
+        if (input.empty() || !digits.contains(input[0]))
         {
             return abs::makeFailure<ResultT>(input, {});
         }
@@ -210,7 +212,7 @@ inline Parser literal(const std::string lit, bool caseSensitive = true)
     {
         return [lit](std::string_view input) -> Result
         {
-            if (input.empty() || input.substr(0, lit.size()) != lit)
+            if (input.empty() || !scan::startsWith(input, lit))
             {
                 return abs::makeFailure<ResultT>(input, {});
             }
@@ -224,19 +226,11 @@ inline Parser literal(const std::string lit, bool caseSensitive = true)
         std::transform(lowerLit.begin(), lowerLit.end(), lowerLit.begin(), [](char c) { return std::tolower(c); });
         return [lowerLit](std::string_view input) -> Result
         {
-            if (input.size() < lowerLit.size())
+            if (!scan::startsWithLower(input, lowerLit))
             {
                 return abs::makeFailure<ResultT>(input, {});
             }
 
-            for (auto i = 0; i < lowerLit.size(); ++i)
-            {
-                if (std::tolower(input[i]) != lowerLit[i])
-                {
-                    return abs::makeFailure<ResultT>(input, {});
-                }
-            }
-
             return abs::makeSuccess<ResultT>(input.substr(lowerLit.size()));
         };
     }
@@ -355,9 +349,9 @@ inline Parser toEnd(const std::vector<std::string>& endTokens)
  */
 inline Parser alnum(const std::string& additional = "")
 {
-    return [additional](std::string_view input) -> Result
+    return [chars = scan::CharClass::alnum(additional)](std::string_view input) -> Result
     {
-        if (!input.empty() && (std::isalnum(input[0]) || additional.find(input[0]) != std::string::npos))
+        if (!input.empty() && chars.contains(input[0]))
         {
             return abs::makeSuccess<ResultT>(input.substr(1));
         }
@@ -373,9 +367,10 @@ inline Parser alnum(const std::string& additional = "")
  */
 inline Parser hex()
 {
+    static const auto hexDigits = scan::CharClass::xdigits();
     return [](std::string_view input) -> Result
     {
-        if (input.empty() || !std::isxdigit(input[0]))
+        if (input.empty() || !hexDigits.contains(input[0]))
         {
             return abs::makeFailure<ResultT>(input, {});
         }
@@ -230,7 +230,30 @@ INSTANTIATE_TEST_SUITE_P(
                j(fmt::format(R"({{"{}":{{"f1":"v1","f2":"v2","f3":"v3"}}}})", TARGET.substr(1))),
                14,
                getCSVParser,
-               {NAME, TARGET, {""}, {"f1", "f2", "f3"}})));
+               {NAME, TARGET, {""}, {"f1", "f2", "f3"}}),
+
+        // Columns named "_" are skip-scanned but not mapped
+        ParseT(SUCCESS,
+               "hi,skipped,bye",
+               j(fmt::format(R"({{"{}":{{"field_1":"hi","field_3":"bye"}}}})", TARGET.substr(1))),
+               strlen("hi,skipped,bye"),
+               getCSVParser,
+               {NAME, TARGET, {""}, {"field_1", "_", "field_3"}}),
+
+        // A skipped column still has to respect the quoting rules
+        ParseT(SUCCESS,
+               R"(a,"q,uoted",c)",
+               j(fmt::format(R"({{"{}":{{"f1":"a","f3":"c"}}}})", TARGET.substr(1))),
+               strlen(R"(a,"q,uoted",c)"),
+               getCSVParser,
+               {NAME, TARGET, {""}, {"f1", "_", "f3"}}),
+
+        ParseT(FAILURE,
+               "hi,  \"wazuh\",bye",
+               {},
+               2,
+               getCSVParser,
+               {NAME, TARGET, {""}, {"field_1", "_", "field_3"}})));
 
 /************************************
  *  DSV Parser
@@ -474,4 +497,12 @@ INSTANTIATE_TEST_SUITE_P(
                              TARGET.substr(1))),
                strlen(R"("\"value1\""|value2|value3|valueN)"),
                getDSVParser,
-               {NAME, TARGET, {""}, {"|", "\"", "\\", "out1", "out2", "out3", "outN"}})));
+               {NAME, TARGET, {""}, {"|", "\"", "\\", "out1", "out2", "out3", "outN"}}),
+
+        // Flow-log style projection: only the mapped columns end up in the document
+        ParseT(SUCCESS,
+               "2 123456789012 eni-abc123 ACCEPT OK",
+               j(fmt::format(R"({{"{}":{{"account":"123456789012","action":"ACCEPT"}}}})", TARGET.substr(1))),
+               strlen("2 123456789012 eni-abc123 ACCEPT OK"),
+               getDSVParser,
+               {NAME, TARGET, {""}, {" ", "\"", "\\", "_", "account", "_", "action", "_"}})));
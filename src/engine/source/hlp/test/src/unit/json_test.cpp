@@ -8,7 +8,8 @@ static const std::string TARGET = "/TargetField";
 INSTANTIATE_TEST_SUITE_P(JSONBuild,
                          HlpBuildTest,
                          ::testing::Values(BuildT(SUCCESS, getJSONParser, {NAME, TARGET, {}, {}}),
-                                           BuildT(FAILURE, getJSONParser, {NAME, TARGET, {}, {"unexpected"}})));
+                                           BuildT(SUCCESS, getJSONParser, {NAME, TARGET, {}, {"alert.signature"}}),
+                                           BuildT(FAILURE, getJSONParser, {NAME, TARGET, {}, {""}})));
 
 INSTANTIATE_TEST_SUITE_P(
     JSONParse,
@@ -121,4 +122,27 @@ INSTANTIATE_TEST_SUITE_P(
                 R"({"Actors":[{"name":"Tom Cruise","age":56,"Born At":"Syracuse, NY","Birthdate":"July 3, 1962","photo":"https://jsonformatterdotorg/img/tom-cruise.jpg","wife":null,"weight":67.5,"hasChildren":true,"hasGreyHair":false,"children":["Suri","Isabella Jane","Connor"]},{"name":"Robert Downey Jr.","age":53,"Born At":"New York City, NY","Birthdate":"April 4, 1965","photo":"https://jsonformatterdotorg/img/Robert-Downey-Jr.jpg","wife":"Susan Downey","weight":77.1,"hasChildren":true,"hasGreyHair":false,"children":["Indio Falconer","Avri Roel","Exton Elias"]}]})")),
             552,
             getJSONParser,
-            {NAME, TARGET, {}, {}})));
+            {NAME, TARGET, {}, {}}),
+        // Subset extraction: only the requested fields are materialized
+        ParseT(SUCCESS,
+               R"({"event":{"severity":3,"category":"net"},"alert":{"signature":"ET SCAN"},"payload":"discarded"})",
+               j(fmt::format(R"({{"{}":{{"event":{{"severity":3}},"alert":{{"signature":"ET SCAN"}}}}}})",
+                             TARGET.substr(1))),
+               95,
+               getJSONParser,
+               {NAME, TARGET, {}, {"event.severity", "alert.signature"}}),
+        // Missing wanted fields leave an empty subset
+        ParseT(SUCCESS,
+               R"({"other":1})",
+               j(fmt::format(R"({{"{}":{{}}}})", TARGET.substr(1))),
+               11,
+               getJSONParser,
+               {NAME, TARGET, {}, {"missing"}}),
+        // Wanted subtrees are captured whole, arrays included
+        ParseT(SUCCESS,
+               R"({"a":{"b":[1,2],"c":"x"},"d":0}left over)",
+               j(fmt::format(R"({{"{}":{{"a":{{"b":[1,2],"c":"x"}}}}}})", TARGET.substr(1))),
+               31,
+               getJSONParser,
+               {NAME, TARGET, {}, {"a"}}),
+        ParseT(FAILURE, R"({"a":)", {}, 0, getJSONParser, {NAME, TARGET, {}, {"a"}})));
@@ -51,6 +51,63 @@ INSTANTIATE_TEST_SUITE_P(ByteParse,
                                                   getByteParser,
                                                   {NAME, TARGET, {}, {}})));
 
+INSTANTIATE_TEST_SUITE_P(ShortBuild,
+                         HlpBuildTest,
+                         ::testing::Values(BuildT(SUCCESS, getShortParser, {NAME, TARGET, {}, {}}),
+                                           BuildT(FAILURE, getShortParser, {NAME, TARGET, {}, {"unexpected"}})));
+
+INSTANTIATE_TEST_SUITE_P(ShortParse,
+                         HlpParseTest,
+                         ::testing::Values(ParseT(SUCCESS,
+                                                  "1234",
+                                                  j(fmt::format(R"({{"{}": 1234}})", TARGET.substr(1))),
+                                                  4,
+                                                  getShortParser,
+                                                  {NAME, TARGET, {}, {}}),
+                                           ParseT(SUCCESS,
+                                                  "32767",
+                                                  j(fmt::format(R"({{"{}": 32767}})", TARGET.substr(1))),
+                                                  5,
+                                                  getShortParser,
+                                                  {NAME, TARGET, {}, {}}),
+                                           ParseT(SUCCESS,
+                                                  "-32768",
+                                                  j(fmt::format(R"({{"{}": -32768}})", TARGET.substr(1))),
+                                                  6,
+                                                  getShortParser,
+                                                  {NAME, TARGET, {}, {}}),
+                                           ParseT(FAILURE, "32768", {}, 5, getShortParser, {NAME, TARGET, {}, {}}),
+                                           ParseT(FAILURE, "-32769", {}, 6, getShortParser, {NAME, TARGET, {}, {}})));
+
+INSTANTIATE_TEST_SUITE_P(IntegerBuild,
+                         HlpBuildTest,
+                         ::testing::Values(BuildT(SUCCESS, getIntegerParser, {NAME, TARGET, {}, {}}),
+                                           BuildT(FAILURE, getIntegerParser, {NAME, TARGET, {}, {"unexpected"}})));
+
+INSTANTIATE_TEST_SUITE_P(
+    IntegerParse,
+    HlpParseTest,
+    ::testing::Values(ParseT(SUCCESS,
+                             "123456",
+                             j(fmt::format(R"({{"{}": 123456}})", TARGET.substr(1))),
+                             6,
+                             getIntegerParser,
+                             {NAME, TARGET, {}, {}}),
+                      ParseT(SUCCESS,
+                             "2147483647",
+                             j(fmt::format(R"({{"{}": 2147483647}})", TARGET.substr(1))),
+                             10,
+                             getIntegerParser,
+                             {NAME, TARGET, {}, {}}),
+                      ParseT(SUCCESS,
+                             "-2147483648",
+                             j(fmt::format(R"({{"{}": -2147483648}})", TARGET.substr(1))),
+                             11,
+                             getIntegerParser,
+                             {NAME, TARGET, {}, {}}),
+                      ParseT(FAILURE, "2147483648", {}, 10, getIntegerParser, {NAME, TARGET, {}, {}}),
+                      ParseT(FAILURE, "-2147483649", {}, 11, getIntegerParser, {NAME, TARGET, {}, {}})));
+
 INSTANTIATE_TEST_SUITE_P(LongBuild,
                          HlpBuildTest,
                          ::testing::Values(BuildT(SUCCESS, getLongParser, {NAME, TARGET, {}, {}}),
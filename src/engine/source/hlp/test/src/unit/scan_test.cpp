@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include "scan.hpp"
+
+using namespace hlp;
+
+TEST(ScanTest, FindChar)
+{
+    ASSERT_EQ(scan::findChar("a,b,c", ','), 1);
+    ASSERT_EQ(scan::findChar("a,b,c", ',', 2), 3);
+    ASSERT_EQ(scan::findChar("a,b,c", ';'), std::string_view::npos);
+    ASSERT_EQ(scan::findChar("abc", 'a', 3), std::string_view::npos);
+    ASSERT_EQ(scan::findChar("", 'a'), std::string_view::npos);
+}
+
+TEST(ScanTest, FindFirstOf)
+{
+    ASSERT_EQ(scan::findFirstOf(R"(ab"cd,ef)", ',', '"'), 2);
+    ASSERT_EQ(scan::findFirstOf(R"(ab"cd,ef)", ',', '"', 3), 5);
+    ASSERT_EQ(scan::findFirstOf("abc", ',', '"'), std::string_view::npos);
+    ASSERT_EQ(scan::findFirstOf("a\\b", '\\', '\\'), 1);
+}
+
+TEST(ScanTest, StartsWith)
+{
+    ASSERT_TRUE(scan::startsWith("literal and more", "literal"));
+    ASSERT_TRUE(scan::startsWith("literal", ""));
+    ASSERT_FALSE(scan::startsWith("lit", "literal"));
+    ASSERT_FALSE(scan::startsWith("Literal", "literal"));
+}
+
+TEST(ScanTest, StartsWithLower)
+{
+    ASSERT_TRUE(scan::startsWithLower("LiTeRaL and more", "literal"));
+    ASSERT_TRUE(scan::startsWithLower("123-abc", "123-abc"));
+    ASSERT_FALSE(scan::startsWithLower("lit", "literal"));
+    ASSERT_FALSE(scan::startsWithLower("literax", "literal"));
+}
+
+TEST(ScanTest, CharClass)
+{
+    const auto digits = scan::CharClass::digits();
+    ASSERT_TRUE(digits.contains('0'));
+    ASSERT_FALSE(digits.contains('a'));
+    ASSERT_EQ(digits.skip("123abc"), 3);
+    ASSERT_EQ(digits.skip("abc"), 0);
+    ASSERT_EQ(digits.skip("123"), 3);
+
+    const auto alnum = scan::CharClass::alnum("_-");
+    ASSERT_TRUE(alnum.contains('_'));
+    ASSERT_TRUE(alnum.contains('z'));
+    ASSERT_FALSE(alnum.contains(' '));
+    ASSERT_EQ(alnum.skip("user_name-1 rest"), 11);
+
+    const auto hex = scan::CharClass::xdigits();
+    ASSERT_TRUE(hex.contains('F'));
+    ASSERT_FALSE(hex.contains('g'));
+}
@@ -51,6 +51,15 @@ INSTANTIATE_TEST_SUITE_P(
             83,
             getUriParser,
             {NAME, TARGET, {""}, {}}),
+        // Conforming URL without port or query, taken by the fast-path splitter
+        ParseT(SUCCESS,
+               "https://demo.wazuh.com/user.php",
+               j(fmt::format(
+                   R"({{"{}": {{"original":"https://demo.wazuh.com/user.php","domain":"demo.wazuh.com","path":"/user.php","scheme":"https"}}}})",
+                   TARGET.substr(1))),
+               31,
+               getUriParser,
+               {NAME, TARGET, {""}, {}}),
         ParseT(
             SUCCESS,
             "telnet://192.0.2.16:80/",
@@ -13,7 +13,12 @@ INSTANTIATE_TEST_SUITE_P(
                       BuildT(SUCCESS, getXMLParser, {NAME, TARGET, {""}, {}}),
                       BuildT(SUCCESS, getXMLParser, {NAME, TARGET, {""}, {"windows"}}),
                       BuildT(FAILURE, getXMLParser, {NAME, TARGET, {""}, {"not_supported"}}),
-                      BuildT(FAILURE, getXMLParser, {NAME, TARGET, {""}, {"windows", "unexpected"}})));
+                      BuildT(FAILURE, getXMLParser, {NAME, TARGET, {""}, {"windows", "unexpected"}}),
+                      BuildT(SUCCESS, getXMLParser, {NAME, TARGET, {""}, {"windows", "System.EventID", "EventData"}}),
+                      BuildT(SUCCESS, getXMLParser, {NAME, TARGET, {""}, {"windows", "EventData.TargetUserName"}}),
+                      BuildT(FAILURE, getXMLParser, {NAME, TARGET, {""}, {"windows", "UserData.Something"}}),
+                      BuildT(FAILURE, getXMLParser, {NAME, TARGET, {""}, {"windows", "System."}}),
+                      BuildT(FAILURE, getXMLParser, {NAME, TARGET, {""}, {"default", "System.EventID"}})));
 
 INSTANTIATE_TEST_SUITE_P(
     XmlParse,
@@ -256,4 +261,23 @@ Name='IpAddress'>::1</Data><Data Name='IpPort'>0</Data></EventData>)",
 )")),
                1573,
                getXMLParser,
-               {NAME, TARGET, {""}})));
+               {NAME, TARGET, {""}}),
+        ParseT(
+            SUCCESS,
+            R"(<Event><System><EventID>4625</EventID><Channel>Security</Channel></System><EventData><Data Name='TargetUserName'>bosch</Data><Data Name='Status'>0xc000006d</Data></EventData></Event>)",
+            j(fmt::format(
+                R"({{"{}":{}}})",
+                TARGET.substr(1),
+                R"({"System":{"EventID":{"#text":"4625"}},"EventData":{"TargetUserName":"bosch"}})")),
+            182,
+            getXMLParser,
+            {NAME, TARGET, {""}, {"windows", "System.EventID", "EventData.TargetUserName", "System.Missing"}}),
+        ParseT(
+            SUCCESS,
+            R"(<Event><System><EventID>4625</EventID><Channel>Security</Channel></System><EventData><Data Name='TargetUserName'>bosch</Data><Data Name='Status'>0xc000006d</Data></EventData></Event>)",
+            j(fmt::format(R"({{"{}":{}}})",
+                          TARGET.substr(1),
+                          R"({"EventData":{"TargetUserName":"bosch","Status":"0xc000006d"}})")),
+            182,
+            getXMLParser,
+            {NAME, TARGET, {""}, {"windows", "EventData"}})));
@@ -0,0 +1,97 @@
+#ifndef _HTTPSRV_FRAMEDSERVER_HPP
+#define _HTTPSRV_FRAMEDSERVER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace httpsrv
+{
+
+/**
+ * @brief Persistent framed-stream server over a unix socket.
+ *
+ * Alternative ingestion path to the HTTP event endpoint for high-rate forwarders:
+ * instead of one HTTP request per batch, a client keeps a long-lived connection and
+ * sends length-prefixed frames (4-byte little-endian payload size followed by the
+ * payload), so no HTTP parsing happens per event.
+ *
+ * Each connection gets its own frame handler from the factory, so framing state
+ * (e.g. the agent header of an NDJSON stream) is per connection. A handler
+ * exception or a malformed frame drops the connection; the client reconnects and
+ * resends its header.
+ */
+class FramedServer
+{
+public:
+    /** @brief Called once per frame with the payload, borrowed until it returns. */
+    using FrameHandler = std::function<void(std::string_view)>;
+
+    /** @brief Builds the frame handler of a new connection. */
+    using HandlerFactory = std::function<FrameHandler()>;
+
+    /** @brief Frames above this size drop the connection, the payload is one event batch. */
+    static constexpr std::size_t MAX_FRAME_SIZE = 1024 * 1024;
+
+    /**
+     * @brief Construct a new Framed Server object
+     *
+     * @param id Server string identifier
+     * @param handlerFactory Factory invoked once per accepted connection.
+     */
+    FramedServer(const std::string& id, HandlerFactory handlerFactory);
+
+    ~FramedServer() { stop(); }
+
+    FramedServer(const FramedServer&) = delete;
+    FramedServer& operator=(const FramedServer&) = delete;
+
+    /**
+     * @brief Start the server at the specified socket path.
+     *
+     * @param socketPath Socket path, if the file exists it will be removed, and the parent directory must exist.
+     * @param useThread If true, the accept loop runs in a separate thread.
+     *
+     * @throws std::runtime_error If the server fails to start.
+     */
+    void start(const std::filesystem::path& socketPath, bool useThread = true);
+
+    /**
+     * @brief Stop the server, closing every connection and waiting for their handlers.
+     */
+    void stop() noexcept;
+
+    /**
+     * @brief Check if the server is running.
+     */
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+private:
+    std::string m_id;                ///< Server identifier
+    HandlerFactory m_handlerFactory; ///< Per-connection frame handler factory
+    int m_listenFd {-1};             ///< Listening socket descriptor
+    std::atomic<bool> m_running {false};
+    std::thread m_acceptThread; ///< Accept loop thread when started with useThread
+
+    std::mutex m_connMutex;              ///< Guards the client fd list and the worker count
+    std::condition_variable m_connCv;    ///< Signaled when a connection worker finishes
+    std::vector<int> m_clientFds;        ///< Open connections, shut down on stop
+    std::size_t m_activeConnections {0}; ///< Connection workers still running
+
+    /** @brief Accept connections until the listening socket is shut down. */
+    void acceptLoop();
+
+    /** @brief Read and dispatch the frames of one connection, runs in its own thread. */
+    void serveConnection(int clientFd);
+};
+
+} // namespace httpsrv
+
+#endif // _HTTPSRV_FRAMEDSERVER_HPP
@@ -1,6 +1,8 @@
 #ifndef _HTTPSRV_SERVER_HPP
 #define _HTTPSRV_SERVER_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <thread>
 
@@ -11,6 +13,23 @@
 namespace httpsrv
 {
 
+/**
+ * @brief Snapshot of the request statistics of a server.
+ *
+ * Distinguishes where ingestion time goes without a capture session: request and byte
+ * rates show whether traffic arrives at all, 4xx counts parse/client failures and 5xx
+ * counts handler failures and pushback.
+ */
+struct ServerStats
+{
+    uint64_t requests {0};          ///< Requests dispatched, successful or not.
+    uint64_t requestBytes {0};      ///< Request body bytes read from the socket.
+    uint64_t status2xx {0};         ///< Responses answered with a 2xx status.
+    uint64_t status4xx {0};         ///< Responses answered with a 4xx status (client/parse errors).
+    uint64_t status5xx {0};         ///< Responses answered with a 5xx status (handler errors).
+    uint64_t handlerExceptions {0}; ///< Route handler exceptions caught by the server.
+};
+
 /**
  * @brief Implementation of the server using httplib.
  *
@@ -18,17 +37,39 @@ namespace httpsrv
 class Server : public IServer<Server>
 {
 private:
+    /**
+     * @brief Request counters shared with the httplib callbacks.
+     *
+     * Handlers on the worker pool bump them with relaxed increments, so counting adds
+     * no synchronization to the request path; readers fold them into a ServerStats
+     * snapshot on demand.
+     */
+    struct Counters
+    {
+        std::atomic<uint64_t> requests {0};
+        std::atomic<uint64_t> requestBytes {0};
+        std::atomic<uint64_t> status2xx {0};
+        std::atomic<uint64_t> status4xx {0};
+        std::atomic<uint64_t> status5xx {0};
+        std::atomic<uint64_t> handlerExceptions {0};
+    };
+
     std::shared_ptr<httplib::Server> m_srv; ///< Httplib Server instance
     std::thread m_thread;                   ///< Server thread
     std::string m_id;                       ///< Server identifier
+    std::shared_ptr<Counters> m_counters;   ///< Request counters, shared with the httplib callbacks
 
 public:
     /**
      * @brief Construct a new Server object
      *
+     * The listen thread only accepts connections; requests are handled by a dedicated
+     * worker pool, so a slow handler does not block the accept loop.
+     *
      * @param id Server string identifier
+     * @param threads Handler worker pool size, 0 keeps the httplib default.
      */
-    Server(const std::string& id);
+    Server(const std::string& id, std::size_t threads = 0);
 
     /**
      * @brief Destroy the Server object
@@ -62,6 +103,22 @@ public:
                   const std::string& route,
                   const std::function<void(const httplib::Request&, httplib::Response&)>& handler);
 
+    /**
+     * @brief Add a route whose handler consumes the request body as a stream.
+     *
+     * The handler receives the httplib content reader and is invoked before the body
+     * is buffered, so it can process the body chunk by chunk as it arrives from the
+     * socket. Only POST and PUT routes can carry a body.
+     *
+     * @param method Method of the route (POST or PUT)
+     * @param route Route path
+     * @param handler Handler function
+     */
+    void addStreamRoute(
+        Method method,
+        const std::string& route,
+        const std::function<void(const httplib::Request&, httplib::Response&, const httplib::ContentReader&)>& handler);
+
     /**
      * @brief Check if the server is running.
      *
@@ -69,6 +126,15 @@ public:
      * @return false Otherwise.
      */
     bool isRunning() const { return m_srv->is_running(); }
+
+    /**
+     * @brief Fold the request counters into a snapshot.
+     *
+     * Safe to call at any time, including while the server is handling requests.
+     *
+     * @return ServerStats Counter values at the time of the call.
+     */
+    ServerStats stats() const;
 };
 } // namespace httpsrv
 
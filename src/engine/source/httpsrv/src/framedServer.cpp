@@ -0,0 +1,238 @@
+#include "framedServer.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <endian.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include <base/logging.hpp>
+
+namespace
+{
+/**
+ * @brief Read exactly size bytes, retrying on partial reads and EINTR.
+ *
+ * @return true On success, false on EOF or error.
+ */
+bool readFull(int fd, char* data, std::size_t size)
+{
+    std::size_t done = 0;
+    while (done < size)
+    {
+        const auto n = ::read(fd, data + done, size - done);
+        if (n > 0)
+        {
+            done += static_cast<std::size_t>(n);
+        }
+        else if (n == 0 || errno != EINTR)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+namespace httpsrv
+{
+
+FramedServer::FramedServer(const std::string& id, HandlerFactory handlerFactory)
+    : m_id(id)
+    , m_handlerFactory(std::move(handlerFactory))
+{
+    if (!m_handlerFactory)
+    {
+        throw std::runtime_error(fmt::format("Framed server {} needs a non-null handler factory", id));
+    }
+}
+
+void FramedServer::start(const std::filesystem::path& socketPath, bool useThread)
+{
+    if (socketPath.empty())
+    {
+        throw std::runtime_error(fmt::format("Cannot start framed server {}: empty socket path", m_id));
+    }
+
+    if (isRunning())
+    {
+        throw std::runtime_error(fmt::format("Cannot start framed server {}: already running", m_id));
+    }
+
+    if (!std::filesystem::exists(socketPath.parent_path()))
+    {
+        throw std::runtime_error(fmt::format("Cannot start framed server {}: parent directory {} does not exist",
+                                             m_id,
+                                             socketPath.parent_path().string()));
+    }
+
+    if (socketPath.string().size() >= sizeof(sockaddr_un::sun_path))
+    {
+        throw std::runtime_error(
+            fmt::format("Cannot start framed server {}: socket path {} is too long", m_id, socketPath.string()));
+    }
+
+    if (std::filesystem::exists(socketPath))
+    {
+        std::filesystem::remove(socketPath);
+        LOG_TRACE("Framed server {} removed existing socket file {}", m_id, socketPath.string());
+    }
+
+    m_listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (m_listenFd < 0)
+    {
+        throw std::runtime_error(
+            fmt::format("Cannot start framed server {}: socket failed: {}", m_id, std::strerror(errno)));
+    }
+
+    sockaddr_un addr {};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+    if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0
+        || ::listen(m_listenFd, SOMAXCONN) < 0)
+    {
+        const auto error = std::strerror(errno);
+        ::close(m_listenFd);
+        m_listenFd = -1;
+        throw std::runtime_error(fmt::format(
+            "Cannot start framed server {} at {}: {}", m_id, socketPath.string(), error));
+    }
+
+    m_running.store(true, std::memory_order_release);
+
+    if (useThread)
+    {
+        m_acceptThread = std::thread([this]() { acceptLoop(); });
+        LOG_INFO("Framed server {} started at {}", m_id, socketPath.string());
+    }
+    else
+    {
+        LOG_INFO("Starting framed server {} at {}", m_id, socketPath.string());
+        acceptLoop();
+    }
+}
+
+void FramedServer::acceptLoop()
+{
+    while (m_running.load(std::memory_order_acquire))
+    {
+        const auto clientFd = ::accept(m_listenFd, nullptr, nullptr);
+        if (clientFd < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            // The listening socket was shut down by stop()
+            break;
+        }
+
+        // Identify the peer for traceability, connections are long-lived
+        ucred cred {};
+        socklen_t credLen = sizeof(cred);
+        if (::getsockopt(clientFd, SOL_SOCKET, SO_PEERCRED, &cred, &credLen) == 0)
+        {
+            LOG_DEBUG("Framed server {} accepted connection from pid {} uid {}", m_id, cred.pid, cred.uid);
+        }
+
+        {
+            std::lock_guard lock(m_connMutex);
+            m_clientFds.push_back(clientFd);
+            ++m_activeConnections;
+        }
+
+        // One thread per connection: clients are a handful of long-lived forwarder
+        // streams, not per-event connections.
+        std::thread([this, clientFd]() { serveConnection(clientFd); }).detach();
+    }
+}
+
+void FramedServer::serveConnection(int clientFd)
+{
+    try
+    {
+        auto handler = m_handlerFactory();
+        std::string payload;
+
+        while (m_running.load(std::memory_order_acquire))
+        {
+            uint32_t sizeLe {0};
+            if (!readFull(clientFd, reinterpret_cast<char*>(&sizeLe), sizeof(sizeLe)))
+            {
+                break;
+            }
+
+            const std::size_t size = le32toh(sizeLe);
+            if (size == 0 || size > MAX_FRAME_SIZE)
+            {
+                LOG_WARNING("Framed server {} dropping connection: invalid frame size {}", m_id, size);
+                break;
+            }
+
+            payload.resize(size);
+            if (!readFull(clientFd, payload.data(), size))
+            {
+                LOG_WARNING("Framed server {} dropping connection: truncated frame", m_id);
+                break;
+            }
+
+            handler(std::string_view {payload});
+        }
+    }
+    catch (const std::exception& e)
+    {
+        // The handler state of this connection is poisoned, drop it so the client
+        // reconnects and resends its framing header.
+        LOG_WARNING("Framed server {} dropping connection: {}", m_id, e.what());
+    }
+
+    ::close(clientFd);
+
+    {
+        std::lock_guard lock(m_connMutex);
+        m_clientFds.erase(std::remove(m_clientFds.begin(), m_clientFds.end(), clientFd), m_clientFds.end());
+        --m_activeConnections;
+    }
+    m_connCv.notify_all();
+}
+
+void FramedServer::stop() noexcept
+{
+    if (!m_running.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // Unblock the accept loop and every connection reader
+    ::shutdown(m_listenFd, SHUT_RDWR);
+    {
+        std::lock_guard lock(m_connMutex);
+        for (const auto fd : m_clientFds)
+        {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+    }
+
+    if (m_acceptThread.joinable())
+    {
+        m_acceptThread.join();
+    }
+
+    ::close(m_listenFd);
+    m_listenFd = -1;
+
+    // Wait until every connection worker has finished with its handler
+    std::unique_lock lock(m_connMutex);
+    m_connCv.wait(lock, [this]() { return m_activeConnections == 0; });
+
+    LOG_INFO("Framed server {} stopped", m_id);
+}
+
+} // namespace httpsrv
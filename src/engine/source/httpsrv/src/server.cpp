@@ -1,24 +1,66 @@
 #include "server.hpp"
 
+#include <cstdlib>
 #include <sstream>
 #include <stdexcept>
 
 #include <fmt/format.h>
 
 #include <base/logging.hpp>
+#include <metrics/imanager.hpp>
+
+namespace
+{
+/**
+ * @brief Register a counter metric, picking it up by name if already registered.
+ *
+ * Returns nullptr when the metrics manager is not available (e.g. unit tests), in
+ * which case only the in-process counters are kept.
+ */
+std::shared_ptr<metrics::IMetric> counterMetric(const std::string& name, const std::string& desc, const std::string& unit)
+{
+    try
+    {
+        return metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER, name, desc, unit);
+    }
+    catch (const std::exception&)
+    {
+        try
+        {
+            return metrics::getManager().getMetric(name);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_DEBUG("Server: Metric '{}' not available: {}", name, e.what());
+            return nullptr;
+        }
+    }
+}
+} // namespace
 
 namespace httpsrv
 {
 
-Server::Server(const std::string& id)
+Server::Server(const std::string& id, std::size_t threads)
     : m_srv(std::make_shared<httplib::Server>())
     , m_id(id)
+    , m_counters(std::make_shared<Counters>())
 {
+    // Each server owns its worker pool, so slow handlers of one server cannot starve
+    // the others.
+    if (threads > 0)
+    {
+        m_srv->new_task_queue = [threads] { return new httplib::ThreadPool(threads); };
+        LOG_DEBUG("Server {} handler pool size: {}", id, threads);
+    }
+
     // General exception handler for routes handlers, handlers must not throw exceptions.
     auto excptFnName = fmt::format("Server::Server({})::set_exception_handler", id);
     m_srv->set_exception_handler(
-        [id, excptFnName](const auto&, auto& res, std::exception_ptr ep)
+        [id, excptFnName, counters = m_counters](const auto&, auto& res, std::exception_ptr ep)
         {
+            counters->handlerExceptions.fetch_add(1, std::memory_order_relaxed);
+
             try
             {
                 std::rethrow_exception(ep);
@@ -37,10 +79,77 @@ Server::Server(const std::string& id)
             res.set_content("Internal server error", "text/plain");
         });
 
-    // TODO: Add Metrics
+    // The logger callback runs once per request, after the response is built, on the
+    // worker that handled it. That makes it the single place where every request can
+    // be counted, whatever route or outcome.
+    auto mRequests = counterMetric(fmt::format("httpsrv.{}.Requests", id), "Requests dispatched to a handler", "");
+    auto mRequestBytes =
+        counterMetric(fmt::format("httpsrv.{}.RequestBytes", id), "Request body bytes read from the socket", "B");
+    auto mClientErrors =
+        counterMetric(fmt::format("httpsrv.{}.ClientErrors", id), "Responses with a 4xx status", "");
+    auto mServerErrors =
+        counterMetric(fmt::format("httpsrv.{}.ServerErrors", id), "Responses with a 5xx status", "");
+
     auto loggerFnName = fmt::format("Server::Server({})::set_logger", id);
-    m_srv->set_logger([id, loggerFnName](const auto& /*req*/, const auto& /*res*/)
-                      { LOG_TRACE_L(loggerFnName.c_str(), "Server {} request received", id); });
+    m_srv->set_logger(
+        [id, loggerFnName, counters = m_counters, mRequests, mRequestBytes, mClientErrors, mServerErrors](
+            const auto& req, const auto& res)
+        {
+            LOG_TRACE_L(loggerFnName.c_str(), "Server {} request received", id);
+
+            counters->requests.fetch_add(1, std::memory_order_relaxed);
+
+            // Streamed routes consume the body without buffering it into req.body, so
+            // fall back to the Content-Length header for those.
+            auto bytes = static_cast<uint64_t>(req.body.size());
+            if (bytes == 0 && req.has_header("Content-Length"))
+            {
+                bytes = std::strtoull(req.get_header_value("Content-Length").c_str(), nullptr, 10);
+            }
+            counters->requestBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+            if (res.status >= 200 && res.status < 300)
+            {
+                counters->status2xx.fetch_add(1, std::memory_order_relaxed);
+            }
+            else if (res.status >= 400 && res.status < 500)
+            {
+                counters->status4xx.fetch_add(1, std::memory_order_relaxed);
+                if (mClientErrors)
+                {
+                    mClientErrors->update(uint64_t {1});
+                }
+            }
+            else if (res.status >= 500)
+            {
+                counters->status5xx.fetch_add(1, std::memory_order_relaxed);
+                if (mServerErrors)
+                {
+                    mServerErrors->update(uint64_t {1});
+                }
+            }
+
+            if (mRequests)
+            {
+                mRequests->update(uint64_t {1});
+            }
+            if (mRequestBytes && bytes > 0)
+            {
+                mRequestBytes->update(bytes);
+            }
+        });
+}
+
+ServerStats Server::stats() const
+{
+    ServerStats snapshot;
+    snapshot.requests = m_counters->requests.load(std::memory_order_relaxed);
+    snapshot.requestBytes = m_counters->requestBytes.load(std::memory_order_relaxed);
+    snapshot.status2xx = m_counters->status2xx.load(std::memory_order_relaxed);
+    snapshot.status4xx = m_counters->status4xx.load(std::memory_order_relaxed);
+    snapshot.status5xx = m_counters->status5xx.load(std::memory_order_relaxed);
+    snapshot.handlerExceptions = m_counters->handlerExceptions.load(std::memory_order_relaxed);
+    return snapshot;
 }
 
 void Server::addRoute(Method method,
@@ -66,6 +175,28 @@ void Server::addRoute(Method method,
     LOG_DEBUG("Server {} added route: {} {}", m_id, methodToStr(method), route);
 }
 
+void Server::addStreamRoute(
+    Method method,
+    const std::string& route,
+    const std::function<void(const httplib::Request&, httplib::Response&, const httplib::ContentReader&)>& handler)
+{
+    try
+    {
+        switch (method)
+        {
+            case Method::POST: m_srv->Post(route, handler); break;
+            case Method::PUT: m_srv->Put(route, handler); break;
+            default: throw std::runtime_error("Invalid method for a streamed route");
+        }
+    }
+    catch (const std::exception& e)
+    {
+        throw std::runtime_error(fmt::format("Server {} failed to add stream route: {}", m_id, e.what()));
+    }
+
+    LOG_DEBUG("Server {} added stream route: {} {}", m_id, methodToStr(method), route);
+}
+
 void Server::start(const std::filesystem::path& socketPath, bool useThread)
 {
     if (socketPath.empty())
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <filesystem>
 #include <thread>
 
@@ -316,3 +317,84 @@ INSTANTIATE_TEST_SUITE_P(
                               "/test",
                               [](httplib::Client& cli, const std::string& route, const httplib::Headers&)
                               { return cli.Delete(route.c_str()); })));
+
+/*******************************************************************************
+ * Server stats tests
+ ******************************************************************************/
+class StatsTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<httpsrv::Server> m_srv;
+
+    auto getSocketPath(const std::string& name) { return uniquePath() / name; }
+
+    // The logger folding the counters runs on the worker thread, so a request may be
+    // answered slightly before it is counted; wait until the expected count is seen.
+    void waitForRequests(uint64_t expected)
+    {
+        for (int i = 0; i < 100 && m_srv->stats().requests < expected; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+public:
+    void SetUp() override
+    {
+        logging::testInit();
+        m_srv = std::make_shared<httpsrv::Server>("stats");
+
+        std::filesystem::create_directory(uniquePath());
+    }
+
+    void TearDown() override
+    {
+        m_srv->stop();
+        m_srv.reset();
+        if (std::filesystem::exists(uniquePath()))
+        {
+            // Remove folder
+            std::filesystem::remove_all(uniquePath());
+        }
+    }
+};
+
+TEST_F(StatsTest, CountsRequestsByOutcome)
+{
+    m_srv->addRoute(httpsrv::Method::POST,
+                    "/ok",
+                    [](const httplib::Request&, httplib::Response& res)
+                    {
+                        res.status = 200;
+                        res.set_content("OK", "text/plain");
+                    });
+    m_srv->addRoute(httpsrv::Method::POST,
+                    "/bad",
+                    [](const httplib::Request&, httplib::Response& res)
+                    {
+                        res.status = 400;
+                        res.set_content("Bad request", "text/plain");
+                    });
+    m_srv->addRoute(httpsrv::Method::GET,
+                    "/throw",
+                    [](const httplib::Request&, httplib::Response&) { throw std::runtime_error("Test"); });
+
+    m_srv->start(getSocketPath("stats.sock"));
+
+    httplib::Client cli(getSocketPath("stats.sock").string(), true);
+    cli.set_address_family(AF_UNIX);
+
+    ASSERT_TRUE(cli.Post("/ok", "0123456789", "text/plain"));
+    ASSERT_TRUE(cli.Post("/bad", "12345", "text/plain"));
+    ASSERT_TRUE(cli.Get("/throw"));
+
+    waitForRequests(3);
+
+    auto stats = m_srv->stats();
+    EXPECT_EQ(stats.requests, 3);
+    EXPECT_EQ(stats.requestBytes, 15);
+    EXPECT_EQ(stats.status2xx, 1);
+    EXPECT_EQ(stats.status4xx, 1);
+    EXPECT_EQ(stats.status5xx, 1);
+    EXPECT_EQ(stats.handlerExceptions, 1);
+}
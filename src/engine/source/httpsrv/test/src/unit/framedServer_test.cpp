@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <endian.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+#include <httpsrv/framedServer.hpp>
+
+namespace
+{
+std::filesystem::path uniquePath()
+{
+    auto pid = getpid();
+    auto tid = std::this_thread::get_id();
+    std::stringstream ss;
+    ss << pid << "_" << tid; // Unique path per thread and process
+    return std::filesystem::path("/tmp") / (ss.str());
+}
+
+// Minimal framed client over a unix socket
+class FramedClient
+{
+public:
+    explicit FramedClient(const std::filesystem::path& socketPath)
+    {
+        m_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        sockaddr_un addr {};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+        m_connected = ::connect(m_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+    }
+
+    ~FramedClient()
+    {
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    bool connected() const { return m_connected; }
+
+    void sendFrame(const std::string& payload)
+    {
+        const uint32_t size = htole32(static_cast<uint32_t>(payload.size()));
+        ASSERT_EQ(::write(m_fd, &size, sizeof(size)), static_cast<ssize_t>(sizeof(size)));
+        ASSERT_EQ(::write(m_fd, payload.data(), payload.size()), static_cast<ssize_t>(payload.size()));
+    }
+
+    void sendRawSize(uint32_t size)
+    {
+        const uint32_t sizeLe = htole32(size);
+        ASSERT_EQ(::write(m_fd, &sizeLe, sizeof(sizeLe)), static_cast<ssize_t>(sizeof(sizeLe)));
+    }
+
+    bool peerClosed()
+    {
+        char byte;
+        return ::read(m_fd, &byte, 1) == 0;
+    }
+
+private:
+    int m_fd {-1};
+    bool m_connected {false};
+};
+} // namespace
+
+class FramedServerTest : public ::testing::Test
+{
+protected:
+    std::vector<std::string> m_frames;
+    std::mutex m_framesMutex;
+
+    auto getSocketPath(const std::string& name) { return uniquePath() / name; }
+
+    auto collectingFactory()
+    {
+        return [this]()
+        {
+            return [this](std::string_view frame)
+            {
+                std::lock_guard lock(m_framesMutex);
+                m_frames.emplace_back(frame);
+            };
+        };
+    }
+
+    void waitForFrames(std::size_t expected)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            {
+                std::lock_guard lock(m_framesMutex);
+                if (m_frames.size() >= expected)
+                {
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    void SetUp() override
+    {
+        logging::testInit();
+        std::filesystem::create_directory(uniquePath());
+    }
+
+    void TearDown() override
+    {
+        if (std::filesystem::exists(uniquePath()))
+        {
+            // Remove folder
+            std::filesystem::remove_all(uniquePath());
+        }
+    }
+};
+
+TEST_F(FramedServerTest, Create)
+{
+    EXPECT_NO_THROW(httpsrv::FramedServer srv("test", collectingFactory()));
+}
+
+TEST_F(FramedServerTest, CreateNullFactory)
+{
+    EXPECT_THROW(httpsrv::FramedServer srv("test", nullptr), std::runtime_error);
+}
+
+TEST_F(FramedServerTest, StartEmptySocketPath)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+    EXPECT_THROW(srv.start(""), std::runtime_error);
+}
+
+TEST_F(FramedServerTest, StartInvalidSocketPath)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+    EXPECT_THROW(srv.start("/non/existent/dir/test.sock"), std::runtime_error);
+}
+
+TEST_F(FramedServerTest, StartStop)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+
+    EXPECT_FALSE(srv.isRunning());
+    EXPECT_NO_THROW(srv.start(getSocketPath("test.sock")));
+    EXPECT_TRUE(srv.isRunning());
+    EXPECT_NO_THROW(srv.stop());
+    EXPECT_FALSE(srv.isRunning());
+}
+
+TEST_F(FramedServerTest, StartAlreadyStarted)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+
+    srv.start(getSocketPath("test.sock"));
+    EXPECT_THROW(srv.start(getSocketPath("test.sock")), std::runtime_error);
+    srv.stop();
+}
+
+TEST_F(FramedServerTest, StopNotStarted)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+    EXPECT_NO_THROW(srv.stop());
+}
+
+TEST_F(FramedServerTest, DeliversFramesInOrder)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+    srv.start(getSocketPath("test.sock"));
+
+    FramedClient cli(getSocketPath("test.sock"));
+    ASSERT_TRUE(cli.connected());
+
+    cli.sendFrame("first");
+    cli.sendFrame("second");
+    cli.sendFrame("third");
+
+    waitForFrames(3);
+    {
+        std::lock_guard lock(m_framesMutex);
+        ASSERT_EQ(m_frames.size(), 3);
+        EXPECT_EQ(m_frames[0], "first");
+        EXPECT_EQ(m_frames[1], "second");
+        EXPECT_EQ(m_frames[2], "third");
+    }
+
+    srv.stop();
+}
+
+TEST_F(FramedServerTest, OversizedFrameDropsConnection)
+{
+    httpsrv::FramedServer srv("test", collectingFactory());
+    srv.start(getSocketPath("test.sock"));
+
+    FramedClient cli(getSocketPath("test.sock"));
+    ASSERT_TRUE(cli.connected());
+
+    cli.sendRawSize(httpsrv::FramedServer::MAX_FRAME_SIZE + 1);
+    EXPECT_TRUE(cli.peerClosed());
+
+    srv.stop();
+}
+
+TEST_F(FramedServerTest, HandlerExceptionDropsConnection)
+{
+    httpsrv::FramedServer srv("test", []() { return [](std::string_view) { throw std::runtime_error("Test"); }; });
+    srv.start(getSocketPath("test.sock"));
+
+    FramedClient cli(getSocketPath("test.sock"));
+    ASSERT_TRUE(cli.connected());
+
+    cli.sendFrame("boom");
+    EXPECT_TRUE(cli.peerClosed());
+
+    srv.stop();
+}
+
+TEST_F(FramedServerTest, HandlerStateIsPerConnection)
+{
+    // Each connection must get its own handler from the factory
+    std::atomic<int> handlersBuilt {0};
+    httpsrv::FramedServer srv("test",
+                              [&handlersBuilt]()
+                              {
+                                  ++handlersBuilt;
+                                  return [](std::string_view) {};
+                              });
+    srv.start(getSocketPath("test.sock"));
+
+    FramedClient cliA(getSocketPath("test.sock"));
+    FramedClient cliB(getSocketPath("test.sock"));
+    ASSERT_TRUE(cliA.connected());
+    ASSERT_TRUE(cliB.connected());
+
+    cliA.sendFrame("a");
+    cliB.sendFrame("b");
+
+    for (int i = 0; i < 100 && handlersBuilt.load() < 2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(handlersBuilt.load(), 2);
+
+    srv.stop();
+}
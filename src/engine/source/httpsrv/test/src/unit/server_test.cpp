@@ -43,6 +43,19 @@ TEST_F(ServerTest, Create)
     EXPECT_NO_THROW(httpsrv::Server srv("test"));
 }
 
+TEST_F(ServerTest, CreateWithWorkerPool)
+{
+    EXPECT_NO_THROW(httpsrv::Server srv("test", 2));
+}
+
+TEST_F(ServerTest, StartStopWithWorkerPool)
+{
+    httpsrv::Server srv("test", 2);
+
+    EXPECT_NO_THROW(srv.start(getSocketPath("test.sock")));
+    EXPECT_NO_THROW(srv.stop());
+}
+
 TEST_F(ServerTest, StartEmptySocketPath)
 {
     httpsrv::Server srv("test");
@@ -133,3 +146,16 @@ TEST_F(ServerTest, IsRunning)
     EXPECT_NO_THROW(srv.stop());
     EXPECT_FALSE(srv.isRunning());
 }
+
+TEST_F(ServerTest, StatsStartAtZero)
+{
+    httpsrv::Server srv("test");
+
+    auto stats = srv.stats();
+    EXPECT_EQ(stats.requests, 0);
+    EXPECT_EQ(stats.requestBytes, 0);
+    EXPECT_EQ(stats.status2xx, 0);
+    EXPECT_EQ(stats.status4xx, 0);
+    EXPECT_EQ(stats.status5xx, 0);
+    EXPECT_EQ(stats.handlerExceptions, 0);
+}
@@ -15,6 +15,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <queue>
 
@@ -55,6 +57,12 @@ struct IndexerConnectorOptions
 template<typename TMonitoring = void>
 class TServerSelector;
 class SecureCommunication;
+class BulkBufferPool;
+
+namespace metrics
+{
+class IMetric;
+}
 
 using ThreadDispatchQueue = ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>>;
 
@@ -73,6 +81,25 @@ class EXPORTED IndexerConnector final : public IIndexerConnector
     std::string m_indexName;
     std::mutex m_syncMutex;
     std::unique_ptr<ThreadDispatchQueue> m_dispatcher;
+    std::atomic<size_t> m_flushBytes {0};       ///< Adaptive byte threshold to flush a bulk request.
+    std::atomic<uint64_t> m_avgBulkLatencyMs {0}; ///< Smoothed latency of the bulk requests.
+    std::shared_ptr<BulkBufferPool> m_bulkBufferPool; ///< Reusable buffers for bulk body assembly.
+    std::map<std::string, std::shared_ptr<metrics::IMetric>>
+        m_serverLatencyMetrics; ///< Per-server bulk latency metrics.
+    std::shared_ptr<metrics::IMetric>
+        m_ingestLatencyMetric; ///< End-to-end latency of the sampled events, ingress to bulk acknowledgement.
+    std::atomic<uint32_t> m_consecutiveFailures {0}; ///< Failed flushes in a row, drives the retry backoff.
+    std::mutex m_backoffMutex;                       ///< Guards the retry backoff wait on m_cv.
+
+    /**
+     * @brief Adjusts the flush byte threshold from the latency observed on the last flush.
+     *
+     * The threshold backs off when the smoothed latency exceeds the target and grows
+     * towards the maximum bulk size while there is latency headroom.
+     *
+     * @param bulkLatencyMs Average latency per bulk of the last flush, in milliseconds.
+     */
+    void updateFlushThreshold(uint64_t bulkLatencyMs);
 
 public:
     /**
@@ -84,7 +111,10 @@ public:
      * health-checked using the API endpoint (/_cat/health)
      * 3. Sets up the dispatcher to process messages asynchronously using a persistent queue. Messages are dispatched in
      * bulk either when the maximum bulk size or the time interval is reached. The bulk size is 1000 messages and the
-     * interval is 5 seconds.
+     * interval is 5 seconds. Batches are additionally split by an adaptive byte threshold tuned from the observed
+     * indexer latency, and the resulting bulks are sent concurrently. Bulk bodies are sent uncompressed: request
+     * compression (Content-Encoding) needs support in the wazuh-http-request layer, which is built from a separate
+     * repository.
      * 4. In each bulk query, the index name "$(date)" placeholder will be replaced by the current date.
      *
      * @param config Indexer connector configuration
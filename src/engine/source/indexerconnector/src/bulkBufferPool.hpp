@@ -0,0 +1,132 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 26, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_BUFFER_POOL_HPP
+#define _BULK_BUFFER_POOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Pool of reusable buffers for assembling bulk request bodies.
+ *
+ * Growing a fresh string for every bulk body reallocates several times, re-copying
+ * everything already appended, and the resulting capacity is discarded after each flush.
+ * Buffers leased from this pool keep their capacity between flushes, so in steady state a
+ * body is written exactly once into already-sized memory and peak allocation stays
+ * bounded by the largest bulk seen. The pool is shared by the concurrent in-flight
+ * bulks, hence the lock on lease and release.
+ */
+class BulkBufferPool final : public std::enable_shared_from_this<BulkBufferPool>
+{
+public:
+    /**
+     * @brief RAII lease of a pooled buffer.
+     *
+     * The buffer, with its grown capacity, returns to the pool when the lease is
+     * destroyed. Leases are move-only.
+     */
+    class Buffer final
+    {
+    public:
+        Buffer(std::shared_ptr<BulkBufferPool> pool, std::string&& data)
+            : m_pool(std::move(pool))
+            , m_data(std::move(data))
+        {
+        }
+
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        Buffer(Buffer&& other) noexcept
+            : m_pool(std::move(other.m_pool))
+            , m_data(std::move(other.m_data))
+        {
+            other.m_pool.reset();
+        }
+
+        Buffer& operator=(Buffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_pool = std::move(other.m_pool);
+                m_data = std::move(other.m_data);
+                other.m_pool.reset();
+            }
+            return *this;
+        }
+
+        ~Buffer() { release(); }
+
+        /**
+         * @brief Access the underlying buffer.
+         *
+         * @return The buffer content.
+         */
+        std::string& data() { return m_data; }
+
+        /**
+         * @copydoc data
+         */
+        const std::string& data() const { return m_data; }
+
+    private:
+        void release()
+        {
+            if (m_pool)
+            {
+                m_pool->returnBuffer(std::move(m_data));
+                m_pool.reset();
+            }
+        }
+
+        std::shared_ptr<BulkBufferPool> m_pool;
+        std::string m_data;
+    };
+
+    /**
+     * @brief Lease a buffer from the pool.
+     *
+     * The buffer arrives empty but keeps the capacity it grew on previous leases. A new
+     * buffer is created if the pool is empty.
+     *
+     * @return The leased buffer.
+     */
+    Buffer lease()
+    {
+        std::string data;
+        {
+            std::scoped_lock lock(m_mutex);
+            if (!m_buffers.empty())
+            {
+                data = std::move(m_buffers.back());
+                m_buffers.pop_back();
+            }
+        }
+        data.clear();
+        return Buffer(shared_from_this(), std::move(data));
+    }
+
+private:
+    void returnBuffer(std::string&& data)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_buffers.emplace_back(std::move(data));
+    }
+
+    std::mutex m_mutex;                 ///< Protects the free list.
+    std::vector<std::string> m_buffers; ///< Buffers available for lease.
+};
+
+#endif // _BULK_BUFFER_POOL_HPP
@@ -9,18 +9,26 @@
  * Foundation.
  */
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <grp.h>
 #include <pwd.h>
 #include <unistd.h>
+#include <vector>
 
 #include <HTTPRequest.hpp>
 #include <base/logging.hpp>
+#include <base/utils/idGenerator.hpp>
 #include <base/utils/stringUtils.hpp>
 #include <base/utils/timeUtils.hpp>
 #include <indexerConnector/indexerConnector.hpp>
+#include <metrics/imanager.hpp>
 
+#include "bulkBufferPool.hpp"
 #include "secureCommunication.hpp"
 #include "serverSelector.hpp"
 
@@ -28,6 +36,23 @@ constexpr auto INDEXER_COLUMN {"indexer"};
 constexpr auto USER_KEY {"username"};
 constexpr auto PASSWORD_KEY {"password"};
 constexpr auto ELEMENTS_PER_BULK {1000};
+
+// Adaptive flush policy. A batch is shipped as soon as it reaches the current byte
+// threshold (or the dispatcher's document count/age limits hit first), and the threshold
+// is tuned from the observed bulk latency so the connector tracks the indexer's capacity.
+constexpr size_t MIN_FLUSH_BYTES {256 * 1024};
+constexpr size_t MAX_FLUSH_BYTES {8 * 1024 * 1024};
+constexpr size_t DEFAULT_FLUSH_BYTES {1024 * 1024};
+constexpr uint64_t TARGET_BULK_LATENCY_MS {500};
+// Maximum bulk requests kept in flight concurrently against the selected server.
+constexpr size_t MAX_IN_FLIGHT_BULKS {4};
+
+// Replay policy after failed flushes. The dispatcher queue is RocksDB-backed, so events
+// already spool to disk while the indexer is unreachable; these bounds pace the retries
+// so recovery replays the backlog at a controlled rate instead of hot-spinning.
+constexpr uint64_t RETRY_BACKOFF_BASE_MS {1000};
+constexpr uint64_t RETRY_BACKOFF_MAX_MS {30000};
+constexpr uint32_t RETRY_BACKOFF_MAX_SHIFT {5};
 constexpr auto WAZUH_OWNER {"wazuh"};
 constexpr auto WAZUH_GROUP {"wazuh"};
 constexpr auto MERGED_CA_PATH {"/var/lib/wazuh-server/tmp/root-ca-merged.pem"};
@@ -76,6 +101,13 @@ static void initConfiguration(SecureCommunication& secureCommunication, const In
         .skipPeerVerification(config.sslOptions.skipVerifyPeer);
 }
 
+static std::string sanitizeMetricName(std::string name)
+{
+    std::replace_if(
+        name.begin(), name.end(), [](const unsigned char c) { return std::isalnum(c) == 0; }, '_');
+    return name;
+}
+
 static void builderBulkDelete(std::string& bulkData, std::string_view id, std::string_view index)
 {
     bulkData.append(R"({"delete":{"_index":")");
@@ -107,6 +139,41 @@ IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnect
 {
     // Get index name.
     m_indexName = indexerConnectorOptions.name;
+    m_flushBytes.store(DEFAULT_FLUSH_BYTES, std::memory_order_relaxed);
+    m_bulkBufferPool = std::make_shared<BulkBufferPool>();
+
+    // Per-server bulk latency, exported when the metrics manager is available. It is not
+    // instantiated in standalone tools and tests, in which case the export is skipped.
+    for (const auto& host : indexerConnectorOptions.hosts)
+    {
+        try
+        {
+            m_serverLatencyMetrics[host] =
+                metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM,
+                                                "indexerconnector." + sanitizeMetricName(host) + ".BulkLatency",
+                                                "Latency of the bulk requests sent to the server",
+                                                "ms");
+        }
+        catch (const std::exception& e)
+        {
+            LOG_DEBUG("Bulk latency metric not available for '{}': {}", host, e.what());
+        }
+    }
+
+    // End-to-end latency of the events that were stamped at ingress (1-in-N sampling,
+    // see the orchestrator configuration), measured up to the bulk acknowledgement.
+    try
+    {
+        m_ingestLatencyMetric =
+            metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM,
+                                            "indexerconnector." + sanitizeMetricName(m_indexName) + ".IngestLatency",
+                                            "Latency from event ingress to the bulk acknowledgement",
+                                            "ms");
+    }
+    catch (const std::exception& e)
+    {
+        LOG_DEBUG("Ingest latency metric not available for '{}': {}", m_indexName, e.what());
+    }
 
     if (base::utils::string::haveUpperCaseCharacters(m_indexName))
     {
@@ -138,86 +205,237 @@ IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnect
                 throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
             }
 
-            auto url = selector->getNext();
-            std::string bulkData;
-            url.append("/_bulk");
-
-            std::string indexNameCurrentDate = m_indexName;
-            base::utils::string::replaceAll(indexNameCurrentDate, "$(date)", base::utils::time::getCurrentDate("."));
-
-            while (!dataQueue.empty())
+            // Controlled-rate replay: after consecutive failed flushes (e.g. every
+            // indexer server down) back off exponentially before retrying, so the
+            // persistent queue is replayed at a controlled rate on recovery instead of
+            // hot-spinning against unreachable servers.
+            if (const auto failures = m_consecutiveFailures.load(); failures > 0)
             {
-                auto data = dataQueue.front();
-                dataQueue.pop();
-                auto parsedData = nlohmann::json::parse(data, nullptr, false);
+                const auto backoffMs = std::min<uint64_t>(
+                    RETRY_BACKOFF_MAX_MS, RETRY_BACKOFF_BASE_MS << std::min(failures - 1, RETRY_BACKOFF_MAX_SHIFT));
+                std::unique_lock lockBackoff(m_backoffMutex);
+                m_cv.wait_for(lockBackoff, std::chrono::milliseconds(backoffMs), [this]() { return m_stopping.load(); });
 
-                // If the data is not a valid JSON, log a warning and continue.
-                if (parsedData.is_discarded())
+                if (m_stopping.load())
                 {
-                    LOG_WARNING("Failed to parse event data: {}", data);
-                    continue;
+                    throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
                 }
+            }
 
-                // Validate required fields.
-                if (!parsedData.contains("operation"))
+            try
+            {
+                const auto server = selector->getNext();
+                auto url = server;
+                url.append("/_bulk");
+
+                std::string indexNameCurrentDate = m_indexName;
+                base::utils::string::replaceAll(indexNameCurrentDate, "$(date)", base::utils::time::getCurrentDate("."));
+
+                // Split the batch in chunks of the current flush threshold, so large batches
+                // are shipped as several concurrent bulks instead of a single oversized one.
+                // Chunk bodies are assembled in pooled buffers that keep their capacity
+                // between flushes, so documents are appended once into already-sized memory.
+                const auto flushBytes = m_flushBytes.load(std::memory_order_relaxed);
+                std::vector<BulkBufferPool::Buffer> bulkChunks;
+                auto bulkBuffer = m_bulkBufferPool->lease();
+
+                // Ingress timestamps of the sampled events of this batch, recorded into
+                // the ingest latency histogram once the bulks are acknowledged.
+                std::vector<int64_t> sampledIngressNs;
+
+                while (!dataQueue.empty())
                 {
-                    LOG_WARNING("Event required field (operation) is missing: {}", data);
-                    continue;
-                }
-
-                // Operation is the action to be performed on the element.
-                const auto& operation = parsedData.at("operation").get_ref<const std::string&>();
+                    auto data = std::move(dataQueue.front());
+                    dataQueue.pop();
+                    auto parsedData = nlohmann::json::parse(data, nullptr, false);
 
-                // Id is the unique identifier of the element.
-                const auto& id = parsedData.contains("id") ? parsedData.at("id").get_ref<const std::string&>() : "";
+                    // If the data is not a valid JSON, log a warning and continue.
+                    if (parsedData.is_discarded())
+                    {
+                        LOG_WARNING("Failed to parse event data: {}", data);
+                        continue;
+                    }
 
-                if (operation.compare("DELETED") == 0)
-                {
                     // Validate required fields.
-                    if (id.empty())
+                    if (!parsedData.contains("operation"))
                     {
-                        LOG_WARNING("Event required field (id) is missing: {}", data);
+                        LOG_WARNING("Event required field (operation) is missing: {}", data);
                         continue;
                     }
 
-                    builderBulkDelete(bulkData, id, indexNameCurrentDate);
+                    // Operation is the action to be performed on the element.
+                    const auto& operation = parsedData.at("operation").get_ref<const std::string&>();
+
+                    // Id is the unique identifier of the element.
+                    const auto& id = parsedData.contains("id") ? parsedData.at("id").get_ref<const std::string&>() : "";
+
+                    if (operation.compare("DELETED") == 0)
+                    {
+                        // Validate required fields.
+                        if (id.empty())
+                        {
+                            LOG_WARNING("Event required field (id) is missing: {}", data);
+                            continue;
+                        }
+
+                        builderBulkDelete(bulkBuffer.data(), id, indexNameCurrentDate);
+                    }
+                    else
+                    {
+                        // Validate required fields.
+                        if (!parsedData.contains("data"))
+                        {
+                            LOG_WARNING("Event required field (data) is missing: {}", data);
+                            continue;
+                        }
+
+                        if (parsedData.contains("index"))
+                        {
+                            indexNameCurrentDate = parsedData.at("index").get<std::string>();
+                            base::utils::string::replaceAll(
+                                indexNameCurrentDate, "$(date)", base::utils::time::getCurrentDate("."));
+                        }
+
+                        const auto dataString = parsedData.at("data").dump();
+                        // Documents without an id get a locally generated one (per-thread random
+                        // prefix + counter), sparing the server an id generation per document.
+                        builderBulkIndex(bulkBuffer.data(),
+                                         id.empty() ? base::utils::id::generate() : id,
+                                         indexNameCurrentDate,
+                                         dataString);
+
+                        if (const auto it = parsedData.find("ingress_ns");
+                            it != parsedData.end() && it->is_number_integer())
+                        {
+                            sampledIngressNs.push_back(it->get<int64_t>());
+                        }
+                    }
+
+                    if (bulkBuffer.data().size() >= flushBytes)
+                    {
+                        bulkChunks.emplace_back(std::move(bulkBuffer));
+                        bulkBuffer = m_bulkBufferPool->lease();
+                    }
                 }
-                else
+
+                if (!bulkBuffer.data().empty())
                 {
-                    // Validate required fields.
-                    if (!parsedData.contains("data"))
+                    bulkChunks.emplace_back(std::move(bulkBuffer));
+                }
+
+                if (!bulkChunks.empty())
+                {
+                    const auto sendBulk = [&url, &secureCommunication](const std::string& chunk)
                     {
-                        LOG_WARNING("Event required field (data) is missing: {}", data);
-                        continue;
+                        HTTPRequest::instance().post(
+                            {.url = HttpURL(url), .data = chunk, .secureCommunication = secureCommunication},
+                            {.onSuccess =
+                                 [functionName = logging::getLambdaName(__FUNCTION__, "handleSuccessfulPostResponse")](
+                                     const std::string& response)
+                             { LOG_DEBUG_L(functionName.c_str(), "Response: {}", response.c_str()); },
+                             .onError =
+                                 [functionName = logging::getLambdaName(__FUNCTION__, "handlePostResponseError")](
+                                     const std::string& error, const long statusCode)
+                             {
+                                 LOG_ERROR_L(functionName.c_str(), "{}, status code: {}.", error.c_str(), statusCode);
+                                 throw std::runtime_error(error);
+                             }});
+                    };
+
+                    const auto startTime = std::chrono::steady_clock::now();
+
+                    try
+                    {
+                        if (bulkChunks.size() == 1)
+                        {
+                            // Process data.
+                            sendBulk(bulkChunks.front().data());
+                        }
+                        else
+                        {
+                            // Keep several bulks in flight so throughput is not capped by the
+                            // round-trip latency of a single synchronous request.
+                            std::exception_ptr firstError;
+                            std::vector<std::future<void>> inFlight;
+
+                            const auto drainInFlight = [&firstError, &inFlight]()
+                            {
+                                for (auto& bulk : inFlight)
+                                {
+                                    try
+                                    {
+                                        bulk.get();
+                                    }
+                                    catch (...)
+                                    {
+                                        if (!firstError)
+                                        {
+                                            firstError = std::current_exception();
+                                        }
+                                    }
+                                }
+                                inFlight.clear();
+                            };
+
+                            for (const auto& chunk : bulkChunks)
+                            {
+                                inFlight.emplace_back(
+                                    std::async(std::launch::async, sendBulk, std::cref(chunk.data())));
+                                if (inFlight.size() >= MAX_IN_FLIGHT_BULKS)
+                                {
+                                    drainInFlight();
+                                }
+                            }
+                            drainInFlight();
+
+                            // Rethrow so the dispatcher re-queues the batch, as with a single bulk.
+                            if (firstError)
+                            {
+                                std::rethrow_exception(firstError);
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        // A failed bulk is itself a health signal: take the server out of the
+                        // rotation and let the monitoring re-probe it at the fast cadence.
+                        selector->reportFailure(server);
+                        throw;
                     }
 
-                    if (parsedData.contains("index"))
+                    const auto elapsedMs = static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime)
+                            .count());
+                    const auto perBulkLatencyMs = elapsedMs / bulkChunks.size();
+                    updateFlushThreshold(perBulkLatencyMs);
+                    selector->reportLatency(server, perBulkLatencyMs);
+
+                    if (const auto metric = m_serverLatencyMetrics.find(server); metric != m_serverLatencyMetrics.end())
                     {
-                        indexNameCurrentDate = parsedData.at("index").get<std::string>();
-                        base::utils::string::replaceAll(
-                            indexNameCurrentDate, "$(date)", base::utils::time::getCurrentDate("."));
+                        metric->second->update(perBulkLatencyMs);
                     }
 
-                    const auto dataString = parsedData.at("data").dump();
-                    builderBulkIndex(bulkData, id, indexNameCurrentDate, dataString);
+                    if (m_ingestLatencyMetric && !sampledIngressNs.empty())
+                    {
+                        const auto nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                               std::chrono::steady_clock::now().time_since_epoch())
+                                               .count();
+                        for (const auto ingressNs : sampledIngressNs)
+                        {
+                            if (nowNs > ingressNs)
+                            {
+                                m_ingestLatencyMetric->update(static_cast<uint64_t>(nowNs - ingressNs) / 1000000);
+                            }
+                        }
+                    }
                 }
-            }
 
-            if (!bulkData.empty())
+                m_consecutiveFailures.store(0);
+            }
+            catch (...)
             {
-                // Process data.
-                HTTPRequest::instance().post(
-                    {.url = HttpURL(url), .data = bulkData, .secureCommunication = secureCommunication},
-                    {.onSuccess = [functionName = logging::getLambdaName(__FUNCTION__, "handleSuccessfulPostResponse")](
-                                      const std::string& response)
-                     { LOG_DEBUG_L(functionName.c_str(), "Response: {}", response.c_str()); },
-                     .onError =
-                         [functionName = logging::getLambdaName(__FUNCTION__, "handlePostResponseError")](
-                             const std::string& error, const long statusCode)
-                     {
-                         LOG_ERROR_L(functionName.c_str(), "{}, status code: {}.", error.c_str(), statusCode);
-                         throw std::runtime_error(error);
-                     }});
+                m_consecutiveFailures.fetch_add(1);
+                throw;
             }
         },
         ThreadEventDispatcherParams {.dbPath = indexerConnectorOptions.databasePath + m_indexName,
@@ -228,6 +446,26 @@ IndexerConnector::IndexerConnector(const IndexerConnectorOptions& indexerConnect
                                               : ThreadEventDispatcherType::MULTI_THREADED_UNORDERED)});
 }
 
+void IndexerConnector::updateFlushThreshold(const uint64_t bulkLatencyMs)
+{
+    auto avgLatency = m_avgBulkLatencyMs.load(std::memory_order_relaxed);
+    avgLatency = (avgLatency == 0) ? bulkLatencyMs : (3 * avgLatency + bulkLatencyMs) / 4;
+    m_avgBulkLatencyMs.store(avgLatency, std::memory_order_relaxed);
+
+    auto threshold = m_flushBytes.load(std::memory_order_relaxed);
+    if (avgLatency > TARGET_BULK_LATENCY_MS)
+    {
+        // The indexer is falling behind, back off to smaller bulks.
+        threshold = std::max(MIN_FLUSH_BYTES, threshold / 2);
+    }
+    else
+    {
+        // Latency headroom available, grow the bulks to improve throughput.
+        threshold = std::min(MAX_FLUSH_BYTES, threshold + threshold / 10);
+    }
+    m_flushBytes.store(threshold, std::memory_order_relaxed);
+}
+
 IndexerConnector::~IndexerConnector()
 {
     m_stopping.store(true);
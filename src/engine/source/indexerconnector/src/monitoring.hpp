@@ -14,6 +14,7 @@
 
 #include "HTTPRequest.hpp"
 #include "secureCommunication.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -22,17 +23,35 @@
 #include <nlohmann/json.hpp>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 // 60 seconds interval for monitoring
 constexpr auto HEALTH_CHECK_INTERVAL_MS = 60000u;
 
+// Probe cadence while any server is unavailable, capped by the configured interval
+constexpr auto HEALTH_CHECK_FAST_INTERVAL_MS = 5000u;
+
 // 5 seconds timeout for health check requests
 constexpr auto HEALTH_CHECK_TIMEOUT_MS = 5000u;
 
 // Name of the field that contains the server status
 constexpr auto SERVER_HEALTH_FIELD_NAME {"status"};
 
+// A server is shed by the selector when its smoothed latency exceeds the fastest
+// available server's latency by this factor.
+constexpr auto LATENCY_SHED_FACTOR = 2;
+
+/**
+ * @brief Health and latency information tracked per server.
+ */
+struct ServerInfo
+{
+    bool available {false}; ///< Whether the last health check reported green or yellow status.
+    uint64_t latencyMs {0}; ///< Smoothed request latency in milliseconds (0 until the first sample).
+    std::chrono::steady_clock::time_point lastEvidence {}; ///< Last time a probe or live traffic proved the server up.
+};
+
 /**
  * @brief Monitoring class.
  *
@@ -46,33 +65,37 @@ constexpr auto SERVER_HEALTH_FIELD_NAME {"status"};
 template<typename THTTPRequest = HTTPRequest>
 class TMonitoring final
 {
-    std::map<std::string, bool, std::less<>> m_servers;
+    std::map<std::string, ServerInfo, std::less<>> m_servers;
     std::thread m_thread;
     std::mutex m_mutex;
     std::condition_variable m_condition;
     std::atomic<bool> m_stop {false};
+    bool m_probeAsap {false};
     uint32_t m_interval {HEALTH_CHECK_INTERVAL_MS};
 
     /**
-     * @brief Checks the health of a server.
+     * @brief Probes the health of a server.
      *
-     * @note It sends a request to the \p serverAddress and update the serverStatus. The \p authentication object is
-     * used to provide secure communication.
+     * @note It sends a request to the \p serverAddress health endpoint. The \p authentication object is
+     * used to provide secure communication. The result is returned instead of applied so that the
+     * caller can run probes without holding the monitoring mutex, keeping availability queries
+     * responsive while a probe is in flight.
      *
-     * @note The serverStatus is updated to true if the server is green or yellow, otherwise it is updated to false.
+     * @note The server is considered available if it reports green or yellow status.
      *
      * @param serverAddress Server's address.
      * @param authentication Object that provides secure communication.
+     * @return Availability and probe round trip in milliseconds (0 when the probe failed).
      */
-    void healthCheck(const std::string& serverAddress, const SecureCommunication& authentication)
+    std::pair<bool, uint64_t> probe(const std::string& serverAddress, const SecureCommunication& authentication)
     {
-        auto& serverStatus = m_servers[serverAddress];
+        bool available {false};
+        uint64_t elapsedMs {0};
 
-        // Set the server status to unavailable by default
-        serverStatus = false;
+        const auto startTime = std::chrono::steady_clock::now();
 
         // On success callback
-        const auto onSuccess = [&serverStatus](std::string response)
+        const auto onSuccess = [&available, &elapsedMs, startTime](std::string response)
         {
             // Parse the response without throwing exceptions
             // Response example:
@@ -102,14 +125,18 @@ class TMonitoring final
             if (!data.is_discarded() && data.contains(SERVER_HEALTH_FIELD_NAME))
             {
                 const auto& serverHealth = data.at(SERVER_HEALTH_FIELD_NAME).get_ref<const std::string&>();
-                serverStatus = serverHealth.compare("green") == 0 || serverHealth.compare("yellow") == 0;
+                available = serverHealth.compare("green") == 0 || serverHealth.compare("yellow") == 0;
             }
+
+            elapsedMs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime)
+                    .count());
         };
 
         // On error callback
-        const auto onError = [&serverStatus](const std::string& /*error*/, const long /*statusCode*/)
+        const auto onError = [&available](const std::string& /*error*/, const long /*statusCode*/)
         {
-            serverStatus = false;
+            available = false;
         };
 
         // Get the health of the server.
@@ -117,6 +144,55 @@ class TMonitoring final
             RequestParameters {.url = HttpURL(serverAddress + "/_cat/health"), .secureCommunication = authentication},
             PostRequestParameters {.onSuccess = onSuccess, .onError = onError},
             ConfigurationParameters {.timeout = HEALTH_CHECK_TIMEOUT_MS});
+
+        return {available, elapsedMs};
+    }
+
+    /**
+     * @brief Applies a probe result to a server's information.
+     *
+     * @note Must be called with the monitoring mutex held.
+     *
+     * @param serverInfo Server's information to update.
+     * @param available Availability reported by the probe.
+     * @param elapsedMs Probe round trip in milliseconds (0 when the probe failed).
+     */
+    static void applyProbe(ServerInfo& serverInfo, const bool available, const uint64_t elapsedMs)
+    {
+        serverInfo.available = available;
+        if (elapsedMs != 0)
+        {
+            serverInfo.latencyMs = smooth(serverInfo.latencyMs, elapsedMs);
+        }
+        if (available)
+        {
+            serverInfo.lastEvidence = std::chrono::steady_clock::now();
+        }
+    }
+
+    /**
+     * @brief Checks whether any monitored server is currently unavailable.
+     *
+     * @note Must be called with the monitoring mutex held.
+     *
+     * @return true if at least one server is unavailable.
+     */
+    bool anyUnavailable() const
+    {
+        return std::any_of(
+            m_servers.begin(), m_servers.end(), [](const auto& entry) { return !entry.second.available; });
+    }
+
+    /**
+     * @brief Smooths a latency sample into the current moving average.
+     *
+     * @param current Current smoothed value (0 means no previous sample).
+     * @param sample New latency sample.
+     * @return The updated smoothed value.
+     */
+    static uint64_t smooth(const uint64_t current, const uint64_t sample)
+    {
+        return (current == 0) ? sample : (3 * current + sample) / 4;
     }
 
     /**
@@ -136,7 +212,8 @@ class TMonitoring final
                 // If the thread is stopped, break the loop.
                 return;
             }
-            healthCheck(serverAddress, authentication);
+            const auto [available, elapsedMs] = probe(serverAddress, authentication);
+            applyProbe(m_servers[serverAddress], available, elapsedMs);
         }
     }
 
@@ -172,18 +249,51 @@ public:
             {
                 while (!m_stop)
                 {
-                    // Wait for the interval.
                     std::unique_lock lock(m_mutex);
-                    m_condition.wait_for(
-                        lock, std::chrono::milliseconds(m_interval), [this]() { return m_stop.load(); });
+
+                    // Probe faster while any server is out, so recovery is noticed promptly. A
+                    // reported failure wakes the loop immediately through m_probeAsap.
+                    const auto waitMs =
+                        anyUnavailable() ? std::min(m_interval, HEALTH_CHECK_FAST_INTERVAL_MS) : m_interval;
+                    m_condition.wait_for(lock,
+                                         std::chrono::milliseconds(waitMs),
+                                         [this]() { return m_stop.load() || m_probeAsap; });
 
                     // If the thread is not stopped, check the health of the servers.
                     if (!m_stop)
                     {
-                        // Check the health of the servers.
-                        for (const auto& [serverAddress, _] : m_servers)
+                        m_probeAsap = false;
+
+                        // Servers with fresh evidence from live traffic do not need a probe, so in
+                        // steady state the health checks cost no extra requests.
+                        std::vector<std::string> staleServers;
+                        const auto now = std::chrono::steady_clock::now();
+                        for (const auto& [serverAddress, serverInfo] : m_servers)
                         {
-                            healthCheck(serverAddress, authentication);
+                            if (!serverInfo.available
+                                || now - serverInfo.lastEvidence >= std::chrono::milliseconds(m_interval))
+                            {
+                                staleServers.emplace_back(serverAddress);
+                            }
+                        }
+
+                        // Probe without the lock so availability queries never wait on a request.
+                        lock.unlock();
+                        std::vector<std::pair<std::string, std::pair<bool, uint64_t>>> results;
+                        results.reserve(staleServers.size());
+                        for (const auto& serverAddress : staleServers)
+                        {
+                            if (m_stop)
+                            {
+                                return;
+                            }
+                            results.emplace_back(serverAddress, probe(serverAddress, authentication));
+                        }
+
+                        lock.lock();
+                        for (const auto& [serverAddress, result] : results)
+                        {
+                            applyProbe(m_servers[serverAddress], result.first, result.second);
                         }
                     }
                 }
@@ -200,7 +310,94 @@ public:
     bool isAvailable(const std::string& serverAddress)
     {
         std::scoped_lock lock(m_mutex);
-        return m_servers.at(serverAddress);
+        return m_servers.at(serverAddress).available;
+    }
+
+    /**
+     * @brief Feeds a latency sample observed for a server, e.g. a bulk request round trip.
+     *
+     * @param serverAddress Server's address.
+     * @param latencyMs Observed latency in milliseconds.
+     */
+    void reportLatency(const std::string& serverAddress, const uint64_t latencyMs)
+    {
+        std::scoped_lock lock(m_mutex);
+        const auto it = m_servers.find(serverAddress);
+        if (it != m_servers.end())
+        {
+            it->second.latencyMs = smooth(it->second.latencyMs, latencyMs);
+
+            // A successful request is health evidence, the next probe cycle can skip the server.
+            if (it->second.available)
+            {
+                it->second.lastEvidence = std::chrono::steady_clock::now();
+            }
+        }
+    }
+
+    /**
+     * @brief Reports a failed request against a server, e.g. a bulk that could not be delivered.
+     *
+     * @note The server is marked unavailable right away and the monitoring thread is woken up, so
+     * it gets re-probed immediately and then at the fast cadence until it recovers.
+     *
+     * @param serverAddress Server's address.
+     */
+    void reportFailure(const std::string& serverAddress)
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            const auto it = m_servers.find(serverAddress);
+            if (it == m_servers.end())
+            {
+                return;
+            }
+            it->second.available = false;
+            m_probeAsap = true;
+        }
+        m_condition.notify_one();
+    }
+
+    /**
+     * @brief Checks whether a server is significantly slower than the fastest available one.
+     *
+     * @note A server without latency samples is never considered degraded, so new servers
+     * always get probed.
+     *
+     * @param serverAddress Server's address.
+     * @return true if the server's smoothed latency exceeds the fastest available server's
+     * by more than LATENCY_SHED_FACTOR.
+     */
+    bool isDegraded(const std::string& serverAddress)
+    {
+        std::scoped_lock lock(m_mutex);
+        const auto it = m_servers.find(serverAddress);
+        if (it == m_servers.end() || it->second.latencyMs == 0)
+        {
+            return false;
+        }
+
+        auto minLatency = it->second.latencyMs;
+        for (const auto& [_, info] : m_servers)
+        {
+            if (info.available && info.latencyMs != 0 && info.latencyMs < minLatency)
+            {
+                minLatency = info.latencyMs;
+            }
+        }
+
+        return it->second.latencyMs > LATENCY_SHED_FACTOR * minLatency;
+    }
+
+    /**
+     * @brief Gets a snapshot of the per-server health and latency information.
+     *
+     * @return Map of server address to its information.
+     */
+    std::map<std::string, ServerInfo, std::less<>> stats()
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_servers;
     }
 };
 
@@ -48,23 +48,68 @@ public:
     /**
      * @brief Get next selected server.
      *
+     * @note Rotates round-robin over the available servers, shedding those whose smoothed
+     * latency is significantly worse than the fastest one. If every available server is
+     * being shed, the first available one is returned so the rotation never stalls.
+     *
      * @return std::string Server address.
      */
     std::string getNext()
     {
         auto initialValue {RoundRobinSelector<std::string>::getNext()};
         auto retValue {initialValue};
+        std::string fallback;
 
-        while (!monitoring->isAvailable(retValue))
+        do
         {
-            retValue = RoundRobinSelector<std::string>::getNext();
-            if (retValue.compare(initialValue) == 0)
+            if (monitoring->isAvailable(retValue))
             {
-                throw std::runtime_error("No available server");
+                if (!monitoring->isDegraded(retValue))
+                {
+                    return retValue;
+                }
+
+                if (fallback.empty())
+                {
+                    fallback = retValue;
+                }
             }
+            retValue = RoundRobinSelector<std::string>::getNext();
+        } while (retValue.compare(initialValue) != 0);
+
+        if (!fallback.empty())
+        {
+            return fallback;
         }
-        return retValue;
+
+        throw std::runtime_error("No available server");
     }
+
+    /**
+     * @brief Feeds a latency sample observed for a server, e.g. a bulk request round trip.
+     *
+     * @param serverAddress Server's address.
+     * @param latencyMs Observed latency in milliseconds.
+     */
+    void reportLatency(const std::string& serverAddress, const uint64_t latencyMs)
+    {
+        monitoring->reportLatency(serverAddress, latencyMs);
+    }
+
+    /**
+     * @brief Reports a failed request against a server, taking it out of the rotation until the
+     * monitoring re-probes it.
+     *
+     * @param serverAddress Server's address.
+     */
+    void reportFailure(const std::string& serverAddress) { monitoring->reportFailure(serverAddress); }
+
+    /**
+     * @brief Gets a snapshot of the per-server health and latency information.
+     *
+     * @return Map of server address to its information.
+     */
+    std::map<std::string, ServerInfo, std::less<>> stats() { return monitoring->stats(); }
 };
 
 #endif // _SERVER_SELECTOR_HPP
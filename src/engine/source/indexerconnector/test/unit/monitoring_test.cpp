@@ -158,6 +158,82 @@ TEST_F(MonitoringTest, TestInstantiationWithGreenRedServers)
     EXPECT_FALSE(monitoring->isAvailable(RED_SERVER));
 }
 
+/**
+ * @brief Test to verify that a reported failure takes effect long before the periodic cadence.
+ *
+ * This test uses an interval far longer than the test itself, so the recovery can only come
+ * from the immediate re-probe triggered by reportFailure().
+ */
+TEST_F(MonitoringTest, TestReportFailureTriggersImmediateReProbe)
+{
+    // Set up the expectations for the MockHTTPRequest with the generalized lambda
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(mockHTTPRequestLambda));
+
+    // Instantiate the Monitoring object with a 10 seconds interval
+    auto monitoring = std::make_shared<TMonitoring<TrampolineHTTPRequest>>(m_servers, 10000u);
+
+    EXPECT_TRUE(monitoring->isAvailable(GREEN_SERVER));
+
+    // A failed request takes the server out until it is re-probed
+    monitoring->reportFailure(GREEN_SERVER);
+
+    // The monitoring thread is woken up right away, so the server recovers well before the
+    // 10 seconds cadence
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    EXPECT_TRUE(monitoring->isAvailable(GREEN_SERVER));
+    EXPECT_FALSE(monitoring->isAvailable(RED_SERVER));
+
+    // Reporting a failure for an unregistered server is a no-op
+    EXPECT_NO_THROW(monitoring->reportFailure("http://localhost:9500"));
+}
+
+/**
+ * @brief Test to verify that fresh traffic evidence suppresses the periodic probes.
+ *
+ * This test keeps feeding latency samples for an available server, so the monitoring thread
+ * never needs to probe it after the initialization and the health checks cost no requests.
+ */
+TEST_F(MonitoringTest, TestFreshTrafficSuppressesProbes)
+{
+    std::atomic<size_t> probeCount {0};
+
+    // Count the probes while answering with the generalized lambda
+    EXPECT_CALL(*spHTTPRequest, get(::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke(
+            [&probeCount](RequestParameters requestParameters,
+                          PostRequestParameters postRequestParameters,
+                          ConfigurationParameters configurationParameters)
+            {
+                ++probeCount;
+                mockHTTPRequestLambda(std::move(requestParameters),
+                                      std::move(postRequestParameters),
+                                      std::move(configurationParameters));
+            }));
+
+    // Monitor only the green server, an unavailable one would force the fast cadence
+    m_servers.clear();
+    m_servers.emplace_back(GREEN_SERVER);
+
+    // Instantiate the Monitoring object with a 100 milliseconds interval
+    auto monitoring = std::make_shared<TMonitoring<TrampolineHTTPRequest>>(m_servers, 100u);
+
+    EXPECT_TRUE(monitoring->isAvailable(GREEN_SERVER));
+    EXPECT_EQ(probeCount, 1u);
+
+    // Keep the evidence fresher than the interval through several probe cycles
+    for (auto i = 0; i < 35; ++i)
+    {
+        monitoring->reportLatency(GREEN_SERVER, 10);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // The initialization probe is the only request ever sent
+    EXPECT_EQ(probeCount, 1u);
+    EXPECT_TRUE(monitoring->isAvailable(GREEN_SERVER));
+}
+
 /**
  * @brief Test to verify instantiation without any servers.
  *
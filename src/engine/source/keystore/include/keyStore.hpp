@@ -38,9 +38,29 @@ private:
      */
     static base::utils::KeyValue readAndDecrypt(const std::string& filePath);
 
+    /**
+     * @brief Returns the cached decrypted keystore content, decrypting the file only when the
+     * cached entry is missing or stale. The caller must hold the cache lock.
+     *
+     * @param keyStorePath Path to the keystore.
+     * @return base::utils::KeyValue& Decrypted key-value content.
+     */
+    static base::utils::KeyValue& refreshCacheLocked(const std::string& keyStorePath);
+
 public:
     Keystore() = default;
 
+    /**
+     * @brief Decrypts the keystore once and keeps it cached, so later gets are memory lookups.
+     *
+     * The cache is refreshed automatically whenever the file modification time changes, so calling
+     * this method is optional: it only moves the first-access decryption cost to a convenient time
+     * (e.g. process start instead of the first reconnection).
+     *
+     * @param keyStorePath The path to the database file.
+     */
+    static void preload(const std::string& keyStorePath = KEYSTORE_PATH);
+
     /**
      * Insert or update a key-value pair in the keystore.
      *
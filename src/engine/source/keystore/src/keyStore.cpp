@@ -9,7 +9,11 @@
  * Foundation.
  */
 
+#include <cstdint>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <utility>
 
 #include <base/logging.hpp>
 #include <base/utils/evpHelper.hpp>
@@ -18,6 +22,23 @@
 
 constexpr auto KS_VALUE_SEPARATOR {':'}; // Default separator for key-value pairs.
 
+namespace
+{
+// Decrypted keystore cache. Credentials are queried on every reconnection, so the store is
+// decrypted once per file state and later reads are memory lookups. An entry is refreshed
+// when the file modification time (or size) no longer matches the cached one, which covers
+// out-of-process updates made with the keystore tool.
+struct CacheEntry
+{
+    base::utils::KeyValue keyValue;            ///< Decrypted key-value content.
+    std::filesystem::file_time_type lastWrite; ///< File modification time at decryption.
+    uintmax_t fileSize;                        ///< File size at decryption, in bytes.
+};
+
+std::mutex g_cacheMutex;                       ///< Protects the cache map.
+std::map<std::string, CacheEntry> g_cache;     ///< Cached keystores, keyed by file path.
+} // namespace
+
 void Keystore::fileCreate(const std::filesystem::path& keyStorePath)
 {
     // Create file and update permissions only if it does not exist
@@ -65,9 +86,27 @@ base::utils::KeyValue Keystore::readAndDecrypt(const std::string& filePath)
     return base::utils::KeyValue(decryptedKeystoreStr, KS_VALUE_SEPARATOR);
 }
 
+base::utils::KeyValue& Keystore::refreshCacheLocked(const std::string& keyStorePath)
+{
+    const auto lastWrite = std::filesystem::last_write_time(keyStorePath);
+    const auto fileSize = std::filesystem::file_size(keyStorePath);
+
+    if (const auto it = g_cache.find(keyStorePath);
+        it != g_cache.end() && it->second.lastWrite == lastWrite && it->second.fileSize == fileSize)
+    {
+        return it->second.keyValue;
+    }
+
+    g_cache.erase(keyStorePath);
+    return g_cache.emplace(keyStorePath, CacheEntry {readAndDecrypt(keyStorePath), lastWrite, fileSize})
+        .first->second.keyValue;
+}
+
 void Keystore::put(const std::string& key, const std::string& value, const std::string& keyStorePath)
 {
     fileCreate(keyStorePath);
+
+    std::lock_guard lock(g_cacheMutex);
     auto keyValue = readAndDecrypt(keyStorePath);
     keyValue.put(key, value);
 
@@ -82,12 +121,27 @@ void Keystore::put(const std::string& key, const std::string& value, const std::
 
     outFile.write(encryptedKeystore.data(), encryptedKeystore.size());
     outFile.close();
+
+    // Refresh the cache with the content just written, so the next read is a memory lookup.
+    g_cache.erase(keyStorePath);
+    g_cache.emplace(keyStorePath,
+                    CacheEntry {std::move(keyValue),
+                                std::filesystem::last_write_time(keyStorePath),
+                                std::filesystem::file_size(keyStorePath)});
 }
 
 bool Keystore::get(const std::string& key, std::string& value, const std::string& keyStorePath)
 {
     fileCreate(keyStorePath);
-    auto keyValue = readAndDecrypt(keyStorePath);
 
-    return keyValue.get(key, value);
+    std::lock_guard lock(g_cacheMutex);
+    return refreshCacheLocked(keyStorePath).get(key, value);
+}
+
+void Keystore::preload(const std::string& keyStorePath)
+{
+    fileCreate(keyStorePath);
+
+    std::lock_guard lock(g_cacheMutex);
+    refreshCacheLocked(keyStorePath);
 }
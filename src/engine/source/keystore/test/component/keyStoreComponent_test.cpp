@@ -74,3 +74,31 @@ TEST_F(KeyStoreComponentTest, CreationAndPermissions)
     ASSERT_FALSE((perms & std::filesystem::perms::others_write) != std::filesystem::perms::none);
     ASSERT_FALSE((perms & std::filesystem::perms::others_exec) != std::filesystem::perms::none);
 }
+
+TEST_F(KeyStoreComponentTest, CachedReadsAndExternalInvalidation)
+{
+    constexpr auto OTHER_KEYSTORE_PATH {"./keys_other.keystore"};
+    std::filesystem::remove_all(TEST_KEYSTORE_PATH);
+    std::filesystem::remove_all(OTHER_KEYSTORE_PATH);
+
+    Keystore::put("key1", "value1", TEST_KEYSTORE_PATH);
+    Keystore::preload(TEST_KEYSTORE_PATH);
+
+    // Repeated reads are served from the cache and stay coherent with later writes.
+    std::string out;
+    ASSERT_TRUE(Keystore::get("key1", out, TEST_KEYSTORE_PATH));
+    ASSERT_EQ(out, "value1");
+    Keystore::put("key1", "value2", TEST_KEYSTORE_PATH);
+    ASSERT_TRUE(Keystore::get("key1", out, TEST_KEYSTORE_PATH));
+    ASSERT_EQ(out, "value2");
+
+    // An out-of-process file replacement must invalidate the cached entry.
+    Keystore::put("key1", "external", OTHER_KEYSTORE_PATH);
+    std::filesystem::copy_file(
+        OTHER_KEYSTORE_PATH, TEST_KEYSTORE_PATH, std::filesystem::copy_options::overwrite_existing);
+
+    ASSERT_TRUE(Keystore::get("key1", out, TEST_KEYSTORE_PATH));
+    ASSERT_EQ(out, "external");
+
+    std::filesystem::remove_all(OTHER_KEYSTORE_PATH);
+}
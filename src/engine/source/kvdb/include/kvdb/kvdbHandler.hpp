@@ -1,6 +1,14 @@
 #ifndef _KVDB_HANDLER_H
 #define _KVDB_HANDLER_H
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <base/shardedLRUCache.hpp>
 #include <kvdb/ikvdbhandler.hpp>
 #include <kvdb/ikvdbhandlercollection.hpp>
 
@@ -91,6 +99,18 @@ public:
      */
     base::RespOrError<std::string> get(const std::string& key) override;
 
+    /**
+     * @copydoc IKVDBHandler::multiGet
+     *
+     */
+    base::RespOrError<std::vector<std::string>> multiGet(const std::vector<std::string>& keys) override;
+
+    /**
+     * @copydoc IKVDBHandler::putBatch
+     *
+     */
+    base::OptError putBatch(const std::vector<std::pair<std::string, std::string>>& entries) override;
+
     /**
      * @copydoc IKVDBHandler::dump
      *
@@ -105,6 +125,26 @@ public:
     base::RespOrError<std::list<std::pair<std::string, std::string>>>
     search(const std::string& filter, const unsigned int page, const unsigned int records) override;
 
+    /**
+     * @copydoc IKVDBHandler::scan
+     *
+     * Seeks the RocksDB iterator straight to the cursor and reads at most limit entries,
+     * never materializing more than one page.
+     */
+    base::RespOrError<ScanPage> scan(const std::string& prefix, const std::string& cursor, unsigned int limit) override;
+
+    /**
+     * @copydoc IKVDBHandler::enableSnapshot
+     *
+     */
+    void enableSnapshot() override;
+
+    /**
+     * @copydoc IKVDBHandler::enableCache
+     *
+     */
+    void enableCache(const size_t capacity) override;
+
 protected:
     /**
      *  @brief Weak Pointer to the RocksDB:ColumnFamilyHandle instance.
@@ -137,6 +177,14 @@ protected:
     std::shared_ptr<IKVDBHandlerCollection> m_spCollection;
 
 private:
+    /**
+     * @brief Batches of at least this many entries are ingested as an external SST file,
+     * skipping the memtable and WAL, instead of going through a WriteBatch. Sized so
+     * initial bulk loads take the ingest path while regular updates do not.
+     *
+     */
+    constexpr static std::size_t SST_INGEST_MIN_ENTRIES = 65536;
+
     /**
      * @brief Function to page the content of iterator
      *
@@ -157,6 +205,70 @@ private:
      */
     base::RespOrError<std::list<std::pair<std::string, std::string>>> pageContent(const unsigned int page,
                                                                                   const unsigned int records);
+
+    /**
+     * @brief Immutable in-memory index of the column family, tagged with the DB sequence
+     * number it was built at.
+     *
+     */
+    struct Snapshot
+    {
+        std::unordered_map<std::string, std::string> index;
+        uint64_t sequence;
+    };
+
+    /**
+     * @brief Returns the current snapshot, rebuilding it if the database changed since it
+     * was built. Published and read with atomic shared_ptr operations, so readers keep a
+     * consistent index while a rebuild swaps in a fresh one.
+     *
+     * @return base::RespOrError<std::shared_ptr<const Snapshot>> Snapshot or specific error.
+     */
+    base::RespOrError<std::shared_ptr<const Snapshot>> snapshot();
+
+    /**
+     * @brief Whether get/contains are served from the in-memory snapshot.
+     *
+     */
+    bool m_snapshotEnabled {false};
+
+    /**
+     * @brief Last published snapshot. Accessed only through std::atomic_load/store.
+     *
+     */
+    std::shared_ptr<const Snapshot> m_snapshot;
+
+    /**
+     * @brief A cached get result, nullopt caching a key known to be absent. Tagged with the
+     * DB sequence number it was read at, so an entry inserted concurrently with a cache
+     * flush is detected as stale and ignored instead of served.
+     *
+     */
+    struct CachedGet
+    {
+        uint64_t sequence;
+        std::optional<std::string> value;
+    };
+
+    /**
+     * @brief Bounded cache of get results. Present only after enableCache. Sharded, so
+     * lookups from several workers do not serialize on a single lock; flushed when the DB
+     * sequence number changes.
+     *
+     */
+    std::unique_ptr<ShardedLRUCache<std::string, CachedGet>> m_cache;
+
+    /**
+     * @brief Serializes the lazy creation of the cache.
+     *
+     */
+    std::mutex m_cacheMutex;
+
+    /**
+     * @brief DB sequence number the cache was last flushed at.
+     *
+     */
+    std::atomic<uint64_t> m_cacheSequence {0};
 };
 
 } // namespace kvdbManager
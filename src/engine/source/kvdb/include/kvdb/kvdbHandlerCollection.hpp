@@ -3,8 +3,10 @@
 
 #include <kvdb/ikvdbhandlercollection.hpp>
 
+#include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 
@@ -27,8 +29,10 @@ public:
      *
      * @param scopeName Name of the Scope.
      *
+     * @return true The scope was added.
+     * @return false The instance was already retired, the caller must create a new one.
      */
-    void addScope(const std::string& scopeName);
+    bool addScope(const std::string& scopeName);
 
     /**
      * @brief Remove a scope from the reference counter.
@@ -45,6 +49,16 @@ public:
      */
     bool emptyScopes(void);
 
+    /**
+     * @brief Atomically retire the instance if no scopes reference it.
+     * A retired instance rejects further addScope calls, so it can be safely
+     * removed from the collection without losing a concurrent registration.
+     *
+     * @return true The instance was retired and can be removed.
+     * @return false Some scopes are still referencing this DB.
+     */
+    bool retireIfEmpty(void);
+
     /**
      * @brief Get the list of scopes referencing this DB.
      *
@@ -66,6 +80,12 @@ private:
      */
     RefCounter m_scopeCounter;
 
+    /**
+     * @brief Once set, the instance is being removed from the collection and rejects new scopes.
+     *
+     */
+    bool m_retired {false};
+
     /**
      * @brief Mutex to protect the internal counter.
      *
@@ -76,6 +96,12 @@ private:
 /**
  * @brief Collection of KVDB Handlers for a given DB and the Scopes referencing them.
  *
+ * The collection is striped by DB name and each stripe publishes an immutable
+ * snapshot of its instance map. In the stable case (handler set unchanged, only
+ * reference counts move) acquisition and release read the snapshot without
+ * taking any collection lock, so concurrent policies do not contend here.
+ * Stripe mutexes are only taken to insert or erase an instance.
+ *
  */
 class KVDBHandlerCollection : public IKVDBHandlerCollection
 {
@@ -116,17 +142,38 @@ public:
     std::map<std::string, uint32_t> getRefMap(const std::string& dbName);
 
 private:
+    using InstanceMap = std::map<std::string, std::shared_ptr<KVDBHandlerInstance>>;
+
     /**
-     * @brief Internal map holding DB names and their KVDBHandlerInstance with extra info.
+     * @brief One lock stripe: an immutable snapshot of the instances hashed to
+     * it, swapped atomically by writers serialized on the stripe mutex.
      *
      */
-    std::map<std::string, std::shared_ptr<KVDBHandlerInstance>> m_mapInstances;
+    struct Stripe
+    {
+        std::shared_ptr<const InstanceMap> snapshot {std::make_shared<const InstanceMap>()};
+        std::mutex writeMutex;
+    };
 
     /**
-     * @brief Mutex to protect the internal map.
+     * @brief Number of lock stripes. Kept modest, contention is per-DB-name hash.
      *
      */
-    std::shared_mutex m_mutex;
+    static constexpr std::size_t STRIPE_COUNT {16};
+
+    /**
+     * @brief Get the stripe holding the given DB name.
+     *
+     * @param dbName Name of the DB.
+     * @return Stripe& The stripe.
+     */
+    Stripe& getStripe(const std::string& dbName);
+
+    /**
+     * @brief Internal stripes holding DB names and their KVDBHandlerInstance with extra info.
+     *
+     */
+    std::array<Stripe, STRIPE_COUNT> m_stripes;
 };
 
 } // namespace kvdbManager
@@ -20,6 +20,9 @@ namespace kvdbManager
 
 constexpr static const char* DEFAULT_CF_NAME {"default"};
 
+constexpr static size_t DEFAULT_BLOCK_CACHE_SIZE {64 * 1024 * 1024};
+constexpr static int DEFAULT_BLOOM_FILTER_BITS {10};
+
 /**
  * @brief Options for the KVDBManager.
  *
@@ -28,6 +31,9 @@ struct KVDBManagerOptions
 {
     std::filesystem::path dbStoragePath;
     std::string dbName;
+    size_t blockCacheSize {DEFAULT_BLOCK_CACHE_SIZE}; ///< Bytes of the shared block cache, 0 disables it
+    int bloomFilterBits {DEFAULT_BLOOM_FILTER_BITS};  ///< Bloom filter bits per key, 0 disables the filters
+    bool enableCompression {true};                    ///< Compress table blocks (LZ4)
 };
 
 /**
@@ -79,6 +85,12 @@ public:
      */
     uint32_t getKVDBHandlersCount(const std::string& dbName) const override;
 
+    /**
+     * @copydoc IKVDBManager::getStatistics
+     *
+     */
+    KVDBStatistics getStatistics() const override;
+
     /**
      * @copydoc IKVDBManager::getKVDBHandler
      *
@@ -183,6 +195,18 @@ private:
      */
     rocksdb::Options m_rocksDBOptions;
 
+    /**
+     * @brief Block cache shared by every Column Family, sized through the Manager options.
+     *
+     */
+    std::shared_ptr<rocksdb::Cache> m_blockCache;
+
+    /**
+     * @brief RocksDB statistics object, source of the cache hit/miss counters.
+     *
+     */
+    std::shared_ptr<rocksdb::Statistics> m_statistics;
+
     /**
      * @brief Internal rocksdb::DB object. This is the main object through which all operations are done.
      *
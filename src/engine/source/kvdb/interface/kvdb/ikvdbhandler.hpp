@@ -1,11 +1,13 @@
 #ifndef _I_KVDB_HANDLER_H
 #define _I_KVDB_HANDLER_H
 
+#include <cstddef>
 #include <list>
 #include <map>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <base/error.hpp>
 #include <base/json.hpp>
@@ -13,6 +15,16 @@
 namespace kvdbManager
 {
 
+/**
+ * @brief A bounded slice of a database scan, in key order.
+ *
+ */
+struct ScanPage
+{
+    std::list<std::pair<std::string, std::string>> entries; ///< Key-value pairs of the slice.
+    std::string next; ///< Key the next scan must resume from. Empty when the scan is exhausted.
+};
+
 /**
  * @brief Interface of KVDB Handler. Holds the basic operations to interact with the database.
  *
@@ -80,6 +92,60 @@ public:
      */
     virtual base::RespOrError<std::string> get(const std::string& key) = 0;
 
+    /**
+     * @brief Gets the values of several keys in one call.
+     *
+     * Batching lets implementations amortize per-lookup costs; the default implementation
+     * falls back to one get per key. A single missing key fails the whole call.
+     *
+     * @param keys Provided keys.
+     * @return base::RespOrError<std::vector<std::string>> Values in the order of the keys.
+     * Specific error otherwise.
+     */
+    virtual base::RespOrError<std::vector<std::string>> multiGet(const std::vector<std::string>& keys)
+    {
+        std::vector<std::string> values;
+        values.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            auto result = get(key);
+            if (base::isError(result))
+            {
+                return base::getError(result);
+            }
+
+            values.emplace_back(base::getResponse(std::move(result)));
+        }
+
+        return values;
+    }
+
+    /**
+     * @brief Stores several key-value pairs in one call.
+     *
+     * Batching lets implementations write all the entries atomically and amortize the
+     * per-write costs; large batches may be ingested directly as SST files, skipping the
+     * memtable and WAL entirely. The default implementation falls back to one set per
+     * entry. A failing entry fails the whole call.
+     *
+     * @param entries Key-value pairs, the values serialized as JSON strings.
+     * @return base::OptError If base::Error not exists the entries were stored
+     * successfully. Specific error otherwise.
+     */
+    virtual base::OptError putBatch(const std::vector<std::pair<std::string, std::string>>& entries)
+    {
+        for (const auto& [key, value] : entries)
+        {
+            auto error = set(key, value);
+            if (error)
+            {
+                return error;
+            }
+        }
+
+        return base::noError();
+    }
+
     /**
      * @brief Retrieves all content with pagination from the database.
      *
@@ -131,6 +197,76 @@ public:
     {
         return search(prefix, 0, 0);
     };
+
+    /**
+     * @brief Retrieves a bounded slice of the entries whose keys start with the prefix.
+     *
+     * Unlike dump and search, the scan is lazy: each call reads at most limit entries
+     * starting from the cursor, so the memory used per call is bounded regardless of the
+     * database size. Passing the next token of a page as the cursor of the following call
+     * resumes the scan where it left off. The default implementation falls back to
+     * materializing the whole search and slicing it.
+     *
+     * @param prefix Key prefix to match. Empty matches every key.
+     * @param cursor Key to resume from, inclusive. Empty to start from the first match.
+     * @param limit Maximum quantity of entries to return. Must be greater than 0.
+     * @return base::RespOrError<ScanPage> Slice and continuation token. Specific error otherwise.
+     */
+    virtual base::RespOrError<ScanPage> scan(const std::string& prefix, const std::string& cursor, unsigned int limit)
+    {
+        if (0 == limit)
+        {
+            return base::Error {"Scan limit must be greater than 0"};
+        }
+
+        auto result = search(prefix);
+        if (base::isError(result))
+        {
+            return base::getError(result);
+        }
+
+        auto content = base::getResponse(std::move(result));
+        ScanPage scanPage;
+        for (auto& [key, value] : content)
+        {
+            if (!cursor.empty() && key < cursor)
+            {
+                continue;
+            }
+
+            if (scanPage.entries.size() == limit)
+            {
+                scanPage.next = key;
+                break;
+            }
+
+            scanPage.entries.emplace_back(std::move(key), std::move(value));
+        }
+
+        return scanPage;
+    }
+
+    /**
+     * @brief Enables snapshot mode for read-mostly databases.
+     *
+     * In snapshot mode the handler may materialize the database into an immutable in-memory
+     * index and serve get/contains from it, rebuilding the index when the database changes.
+     * Intended for enrichment databases that are read per event but written rarely.
+     * Implementations without such an index ignore the hint.
+     */
+    virtual void enableSnapshot() {};
+
+    /**
+     * @brief Enables a bounded per-handler cache for get lookups.
+     *
+     * The cache keeps the most recently used keys, including negative results for keys
+     * repeatedly asked for but absent from the database, and is flushed when the database
+     * changes. Unlike snapshot mode its memory is bounded by the capacity, so it suits
+     * databases too large to materialize. Implementations without a cache ignore the hint.
+     *
+     * @param capacity Maximum number of cached keys.
+     */
+    virtual void enableCache(const size_t capacity) {};
 };
 
 } // namespace kvdbManager
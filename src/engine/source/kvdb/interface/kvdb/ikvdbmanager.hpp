@@ -1,6 +1,7 @@
 #ifndef _I_KVDB_MANAGER_H
 #define _I_KVDB_MANAGER_H
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
@@ -18,6 +19,18 @@ namespace kvdbManager
  */
 using RefInfo = std::map<std::string, uint32_t>;
 
+/**
+ * @brief Block cache statistics of the underlying storage, used to size enrichment memory.
+ *
+ */
+struct KVDBStatistics
+{
+    uint64_t blockCacheUsage {0};    ///< Bytes currently held by the shared block cache
+    uint64_t blockCacheCapacity {0}; ///< Configured capacity of the shared block cache
+    uint64_t blockCacheHits {0};     ///< Block reads served from the cache
+    uint64_t blockCacheMisses {0};   ///< Block reads that went to disk
+};
+
 /**
  * @brief Interface for the KVDBManager class.
  *
@@ -133,6 +146,14 @@ public:
      *
      */
     virtual uint32_t getKVDBHandlersCount(const std::string& dbName) const = 0;
+
+    /**
+     * @brief Returns block cache statistics of the underlying storage.
+     *
+     * @return KVDBStatistics Usage, capacity and hit/miss counters.
+     *
+     */
+    virtual KVDBStatistics getStatistics() const = 0;
 };
 
 } // namespace kvdbManager
@@ -1,9 +1,14 @@
 #include <kvdb/kvdbHandler.hpp>
 
+#include <filesystem>
+#include <map>
+
 #include <base/json.hpp>
 #include <base/logging.hpp>
 #include <fmt/format.h>
 #include <rocksdb/db.h>
+#include <rocksdb/sst_file_writer.h>
+#include <rocksdb/write_batch.h>
 
 namespace kvdbManager
 {
@@ -13,6 +18,64 @@ KVDBHandler::~KVDBHandler()
     m_spCollection->removeKVDBHandler(m_dbName, m_scopeName);
 }
 
+void KVDBHandler::enableSnapshot()
+{
+    m_snapshotEnabled = true;
+}
+
+void KVDBHandler::enableCache(const size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    if (!m_cache)
+    {
+        m_cache = std::make_unique<ShardedLRUCache<std::string, CachedGet>>(capacity);
+    }
+}
+
+base::RespOrError<std::shared_ptr<const KVDBHandler::Snapshot>> KVDBHandler::snapshot()
+{
+    auto pRocksDB = m_weakDB.lock();
+    if (!pRocksDB)
+    {
+        return base::Error {"Can not access RocksDB::DB"};
+    }
+
+    // The sequence number advances on every write to the DB, so a snapshot tagged with the
+    // current value is up to date. Tagging before iterating is conservative: writes racing
+    // with the rebuild make the fresh snapshot look stale and trigger another rebuild.
+    auto current = std::atomic_load(&m_snapshot);
+    const auto sequence = pRocksDB->GetLatestSequenceNumber();
+    if (current && current->sequence == sequence)
+    {
+        return current;
+    }
+
+    auto pCFhandle = m_weakCFHandle.lock();
+    if (!pCFhandle)
+    {
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    auto fresh = std::make_shared<Snapshot>();
+    fresh->sequence = sequence;
+
+    std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), pCFhandle.get()));
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next())
+    {
+        fresh->index.insert_or_assign(iter->key().ToString(), iter->value().ToString());
+    }
+
+    if (!iter->status().ok())
+    {
+        return base::Error {fmt::format(
+            "Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+    }
+
+    std::shared_ptr<const Snapshot> published {std::move(fresh)};
+    std::atomic_store(&m_snapshot, published);
+    return published;
+}
+
 std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::string& value)
 {
     auto pRocksDB = m_weakDB.lock();
@@ -84,6 +147,17 @@ std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 
 std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
 {
+    if (m_snapshotEnabled)
+    {
+        auto resSnapshot = snapshot();
+        if (base::isError(resSnapshot))
+        {
+            return base::getError(resSnapshot);
+        }
+
+        return base::getResponse(resSnapshot)->index.count(key) > 0;
+    }
+
     auto pRocksDB = m_weakDB.lock();
     if (pRocksDB)
     {
@@ -127,9 +201,78 @@ std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
 
 std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
 {
+    if (m_snapshotEnabled)
+    {
+        auto resSnapshot = snapshot();
+        if (base::isError(resSnapshot))
+        {
+            return base::getError(resSnapshot);
+        }
+
+        const auto& index = base::getResponse(resSnapshot)->index;
+        auto it = index.find(key);
+        if (it == index.end())
+        {
+            return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, "Key not found")};
+        }
+
+        return it->second;
+    }
+
     auto pRocksDB = m_weakDB.lock();
     if (pRocksDB)
     {
+        // Bounded cache of hits and negative results, flushed whenever the DB changed
+        if (m_cache)
+        {
+            const auto sequence = pRocksDB->GetLatestSequenceNumber();
+
+            // Flush once per DB change. Entries are also tagged with the sequence they were
+            // read at, so an insert racing with the flush leaves a stale entry that is
+            // ignored below rather than served.
+            auto cachedSequence = m_cacheSequence.load(std::memory_order_acquire);
+            if (sequence != cachedSequence
+                && m_cacheSequence.compare_exchange_strong(cachedSequence, sequence, std::memory_order_acq_rel))
+            {
+                m_cache->clear();
+            }
+
+            if (auto cached = m_cache->getValue(key); cached.has_value() && cached->sequence == sequence)
+            {
+                if (cached->value.has_value())
+                {
+                    return cached->value.value();
+                }
+
+                return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, "Key not found")};
+            }
+
+            auto pCFhandle = m_weakCFHandle.lock();
+            if (!pCFhandle)
+            {
+                return base::Error {"Can not access RocksDB Column Family Handle"};
+            }
+
+            std::string value;
+            auto status = pRocksDB->Get(rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value);
+
+            if (status.ok())
+            {
+                m_cache->insertKey(key, CachedGet {sequence, value});
+                return value;
+            }
+
+            bool isNotFound = status.IsNotFound() && value.empty();
+            if (isNotFound)
+            {
+                m_cache->insertKey(key, CachedGet {sequence, std::nullopt});
+                return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, "Key not found")};
+            }
+
+            std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
+            return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, error)};
+        }
+
         auto pCFhandle = m_weakCFHandle.lock();
         if (pCFhandle)
         {
@@ -158,6 +301,158 @@ std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
     return base::Error {"Can not access RocksDB::DB"};
 }
 
+std::variant<std::vector<std::string>, base::Error> KVDBHandler::multiGet(const std::vector<std::string>& keys)
+{
+    if (m_snapshotEnabled)
+    {
+        auto resSnapshot = snapshot();
+        if (base::isError(resSnapshot))
+        {
+            return base::getError(resSnapshot);
+        }
+
+        const auto& index = base::getResponse(resSnapshot)->index;
+        std::vector<std::string> values;
+        values.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            auto it = index.find(key);
+            if (it == index.end())
+            {
+                return base::Error {fmt::format("Can not get key '{}'. Error: {}", key, "Key not found")};
+            }
+
+            values.emplace_back(it->second);
+        }
+
+        return values;
+    }
+
+    auto pRocksDB = m_weakDB.lock();
+    if (pRocksDB)
+    {
+        auto pCFhandle = m_weakCFHandle.lock();
+        if (pCFhandle)
+        {
+            // Single batched read, amortizing bloom and block probes across the keys
+            std::vector<rocksdb::Slice> slices;
+            slices.reserve(keys.size());
+            for (const auto& key : keys)
+            {
+                slices.emplace_back(key);
+            }
+
+            std::vector<rocksdb::ColumnFamilyHandle*> cfHandles(keys.size(), pCFhandle.get());
+            std::vector<std::string> values;
+            auto statuses = pRocksDB->MultiGet(rocksdb::ReadOptions(), cfHandles, slices, &values);
+
+            for (size_t i = 0; i < statuses.size(); i++)
+            {
+                if (!statuses[i].ok())
+                {
+                    std::string_view error = statuses[i].IsNotFound()               ? "Key not found"
+                                             : statuses[i].getState() != nullptr    ? statuses[i].getState()
+                                                                                    : "Unknown";
+                    return base::Error {fmt::format("Can not get key '{}'. Error: {}", keys[i], error)};
+                }
+            }
+
+            return values;
+        }
+
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    return base::Error {"Can not access RocksDB::DB"};
+}
+
+base::OptError KVDBHandler::putBatch(const std::vector<std::pair<std::string, std::string>>& entries)
+{
+    if (entries.empty())
+    {
+        return base::noError();
+    }
+
+    auto pRocksDB = m_weakDB.lock();
+    if (!pRocksDB)
+    {
+        return base::Error {"Can not access RocksDB::DB"};
+    }
+
+    auto pCFhandle = m_weakCFHandle.lock();
+    if (!pCFhandle)
+    {
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    if (entries.size() >= SST_INGEST_MIN_ENTRIES)
+    {
+        // Initial loads skip the memtable and WAL: write the entries into a sorted SST
+        // file aside and ingest it as an external file. The ingest requires strictly
+        // increasing keys, so sort references and let the last occurrence of a repeated
+        // key win, matching the WriteBatch semantics.
+        std::map<std::string_view, std::string_view> sorted;
+        for (const auto& [key, value] : entries)
+        {
+            sorted.insert_or_assign(key, value);
+        }
+
+        const auto path = fmt::format("{}/{}.ingest.sst", pRocksDB->GetName(), m_dbName);
+        rocksdb::SstFileWriter writer {rocksdb::EnvOptions {}, rocksdb::Options {}};
+
+        auto status = writer.Open(path);
+        for (auto it = sorted.begin(); status.ok() && it != sorted.end(); ++it)
+        {
+            status = writer.Put(rocksdb::Slice(it->first.data(), it->first.size()),
+                                rocksdb::Slice(it->second.data(), it->second.size()));
+        }
+        if (status.ok())
+        {
+            status = writer.Finish();
+        }
+
+        if (status.ok())
+        {
+            rocksdb::IngestExternalFileOptions ingestOptions;
+            ingestOptions.move_files = true;
+            status = pRocksDB->IngestExternalFile(pCFhandle.get(), {path}, ingestOptions);
+        }
+
+        if (!status.ok())
+        {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+            std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
+            return base::Error {fmt::format("Can not ingest batch of {} entries. Error: {}", entries.size(), error)};
+        }
+
+        // An ingest of non-overlapping keys may not advance the sequence number, so the
+        // staleness checks of the snapshot and the cache would miss it. Drop both.
+        std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot> {});
+        if (m_cache)
+        {
+            m_cache->clear();
+        }
+
+        return base::noError();
+    }
+
+    rocksdb::WriteBatch batch;
+    for (const auto& [key, value] : entries)
+    {
+        batch.Put(pCFhandle.get(), rocksdb::Slice(key), rocksdb::Slice(value));
+    }
+
+    auto status = pRocksDB->Write(rocksdb::WriteOptions(), &batch);
+    if (!status.ok())
+    {
+        std::string_view error = status.getState() != nullptr ? status.getState() : "Unknown";
+        return base::Error {fmt::format("Can not write batch of {} entries. Error: {}", entries.size(), error)};
+    }
+
+    return base::noError();
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::dump(const unsigned int page,
                                                                                             const unsigned int records)
 {
@@ -180,6 +475,55 @@ KVDBHandler::search(const std::string& prefix, const unsigned int page, const un
     return pageContent(page, records, filter);
 }
 
+base::RespOrError<ScanPage>
+KVDBHandler::scan(const std::string& prefix, const std::string& cursor, unsigned int limit)
+{
+    if (0 == limit)
+    {
+        return base::Error {"Scan limit must be greater than 0"};
+    }
+
+    auto pRocksDB = m_weakDB.lock();
+    if (!pRocksDB)
+    {
+        return base::Error {"Can not access RocksDB::DB"};
+    }
+
+    auto pCFhandle = m_weakCFHandle.lock();
+    if (!pCFhandle)
+    {
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), pCFhandle.get()));
+    rocksdb::Slice slicePrefix(prefix);
+    ScanPage scanPage;
+
+    for (iter->Seek(cursor.empty() ? slicePrefix : rocksdb::Slice(cursor)); iter->Valid(); iter->Next())
+    {
+        if (!iter->key().starts_with(slicePrefix))
+        {
+            break;
+        }
+
+        if (scanPage.entries.size() == limit)
+        {
+            scanPage.next = iter->key().ToString();
+            break;
+        }
+
+        scanPage.entries.emplace_back(iter->key().ToString(), iter->value().ToString());
+    }
+
+    if (!iter->status().ok())
+    {
+        return base::Error {
+            fmt::format("Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+    }
+
+    return scanPage;
+}
+
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
 KVDBHandler::pageContent(const unsigned int page, const unsigned int records)
 {
@@ -202,7 +546,8 @@ std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHa
             unsigned int toRecords = fromRecords + records;
 
             unsigned int i = 0;
-            for (iter->SeekToFirst(); iter->Valid() && i < toRecords; iter->Next())
+            // Page and records in 0 mean no paging: everything is retrieved
+            for (iter->SeekToFirst(); iter->Valid() && (0 == records || i < toRecords); iter->Next())
             {
                 if (!filter || filter(iter->key()))
                 {
@@ -1,3 +1,5 @@
+#include <functional>
+
 #include <fmt/format.h>
 
 #include <base/logging.hpp>
@@ -7,50 +9,95 @@
 namespace kvdbManager
 {
 
+KVDBHandlerCollection::Stripe& KVDBHandlerCollection::getStripe(const std::string& dbName)
+{
+    return m_stripes[std::hash<std::string> {}(dbName) % STRIPE_COUNT];
+}
+
 void KVDBHandlerCollection::addKVDBHandler(const std::string& dbName, const std::string& scopeName)
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto& stripe = getStripe(dbName);
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    // Lock-free fast path: the DB already has an instance, only its counter moves.
     {
-        auto& instance = it->second;
-        instance->addScope(scopeName);
+        auto snapshot = std::atomic_load_explicit(&stripe.snapshot, std::memory_order_acquire);
+        const auto it = snapshot->find(dbName);
+        if (it != snapshot->end() && it->second->addScope(scopeName))
+        {
+            return;
+        }
     }
-    else
+
+    // The instance is missing or was retired concurrently, publish a new snapshot.
+    std::lock_guard<std::mutex> lock(stripe.writeMutex);
+
+    auto snapshot = std::atomic_load_explicit(&stripe.snapshot, std::memory_order_acquire);
+    const auto it = snapshot->find(dbName);
+    if (it != snapshot->end())
     {
-        auto spInstance = std::make_shared<KVDBHandlerInstance>();
-        spInstance->addScope(scopeName);
-        m_mapInstances.emplace(dbName, std::move(spInstance));
+        // Retired instances are erased in the same critical section that retires
+        // them, so under the stripe mutex this cannot fail.
+        it->second->addScope(scopeName);
+        return;
     }
+
+    auto spInstance = std::make_shared<KVDBHandlerInstance>();
+    spInstance->addScope(scopeName);
+
+    auto newMap = std::make_shared<InstanceMap>(*snapshot);
+    newMap->emplace(dbName, std::move(spInstance));
+    std::atomic_store_explicit(
+        &stripe.snapshot, std::shared_ptr<const InstanceMap>(std::move(newMap)), std::memory_order_release);
 }
 
 void KVDBHandlerCollection::removeKVDBHandler(const std::string& dbName, const std::string& scopeName)
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto& stripe = getStripe(dbName);
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    // Lock-free fast path: other scopes still reference the DB, the map is unchanged.
     {
-        auto& instance = it->second;
-        instance->removeScope(scopeName);
-        if (instance->emptyScopes())
+        auto snapshot = std::atomic_load_explicit(&stripe.snapshot, std::memory_order_acquire);
+        const auto it = snapshot->find(dbName);
+        if (it == snapshot->end())
+        {
+            return;
+        }
+
+        it->second->removeScope(scopeName);
+        if (!it->second->emptyScopes())
         {
-            m_mapInstances.erase(it);
+            return;
         }
     }
+
+    // Last reference gone, retire the instance and publish a snapshot without it.
+    std::lock_guard<std::mutex> lock(stripe.writeMutex);
+
+    auto snapshot = std::atomic_load_explicit(&stripe.snapshot, std::memory_order_acquire);
+    const auto it = snapshot->find(dbName);
+    if (it == snapshot->end() || !it->second->retireIfEmpty())
+    {
+        // A concurrent registration took the instance back, keep it.
+        return;
+    }
+
+    auto newMap = std::make_shared<InstanceMap>(*snapshot);
+    newMap->erase(dbName);
+    std::atomic_store_explicit(
+        &stripe.snapshot, std::shared_ptr<const InstanceMap>(std::move(newMap)), std::memory_order_release);
 }
 
 std::vector<std::string> KVDBHandlerCollection::getDBNames()
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
-
     std::vector<std::string> dbNames;
-    dbNames.reserve(m_mapInstances.size());
 
-    for (const auto& instance : m_mapInstances)
+    for (auto& stripe : m_stripes)
     {
-        dbNames.push_back(instance.first);
+        auto snapshot = std::atomic_load_explicit(&stripe.snapshot, std::memory_order_acquire);
+        for (const auto& instance : *snapshot)
+        {
+            dbNames.push_back(instance.first);
+        }
     }
 
     return dbNames;
@@ -58,10 +105,11 @@ std::vector<std::string> KVDBHandlerCollection::getDBNames()
 
 std::map<std::string, uint32_t> KVDBHandlerCollection::getRefMap(const std::string& dbName)
 {
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto& stripe = getStripe(dbName);
+    auto snapshot = std::atomic_load_explicit(&stripe.snapshot, std::memory_order_acquire);
 
-    const auto it = m_mapInstances.find(dbName);
-    if (it != m_mapInstances.end())
+    const auto it = snapshot->find(dbName);
+    if (it != snapshot->end())
     {
         return it->second->getRefMap();
     }
@@ -69,11 +117,17 @@ std::map<std::string, uint32_t> KVDBHandlerCollection::getRefMap(const std::stri
     return {};
 }
 
-void KVDBHandlerInstance::addScope(const std::string& scopeName)
+bool KVDBHandlerInstance::addScope(const std::string& scopeName)
 {
     std::unique_lock<std::shared_mutex> lock(m_mutex);
 
+    if (m_retired)
+    {
+        return false;
+    }
+
     m_scopeCounter.addRef(scopeName);
+    return true;
 }
 
 void KVDBHandlerInstance::removeScope(const std::string& scopeName)
@@ -85,11 +139,24 @@ void KVDBHandlerInstance::removeScope(const std::string& scopeName)
 
 bool KVDBHandlerInstance::emptyScopes()
 {
-    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
 
     return m_scopeCounter.empty();
 }
 
+bool KVDBHandlerInstance::retireIfEmpty()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+    if (!m_scopeCounter.empty())
+    {
+        return false;
+    }
+
+    m_retired = true;
+    return true;
+}
+
 std::vector<std::string> KVDBHandlerInstance::getRefNames()
 {
     std::shared_lock<std::shared_mutex> lock(m_mutex);
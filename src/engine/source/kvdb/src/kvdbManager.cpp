@@ -3,8 +3,12 @@
 #include <fstream>
 #include <optional>
 
+#include "rocksdb/cache.h"
 #include "rocksdb/db.h"
+#include "rocksdb/filter_policy.h"
 #include "rocksdb/options.h"
+#include "rocksdb/statistics.h"
+#include "rocksdb/table.h"
 
 #include <base/logging.hpp>
 #include <kvdb/kvdbManager.hpp>
@@ -43,6 +47,28 @@ void KVDBManager::initializeOptions()
     m_rocksDBOptions.IncreaseParallelism();
     m_rocksDBOptions.OptimizeLevelStyleCompaction();
     m_rocksDBOptions.create_if_missing = true;
+
+    // Shared block cache and bloom filters, sized from the Manager options so enrichment
+    // memory is a deliberate budget instead of falling through to page-cache misses
+    rocksdb::BlockBasedTableOptions tableOptions;
+    if (m_ManagerOptions.blockCacheSize > 0)
+    {
+        m_blockCache = rocksdb::NewLRUCache(m_ManagerOptions.blockCacheSize);
+        tableOptions.block_cache = m_blockCache;
+    }
+
+    if (m_ManagerOptions.bloomFilterBits > 0)
+    {
+        tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(m_ManagerOptions.bloomFilterBits));
+    }
+
+    m_rocksDBOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+
+    m_rocksDBOptions.compression =
+        m_ManagerOptions.enableCompression ? rocksdb::kLZ4Compression : rocksdb::kNoCompression;
+
+    m_statistics = rocksdb::CreateDBStatistics();
+    m_rocksDBOptions.statistics = m_statistics;
 }
 
 void KVDBManager::initializeMainDB()
@@ -69,7 +95,7 @@ void KVDBManager::initializeMainDB()
                 hasDefaultCF = true;
             }
 
-            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions());
+            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions(m_rocksDBOptions));
             cfDescriptors.push_back(newDescriptor);
         }
     }
@@ -77,7 +103,7 @@ void KVDBManager::initializeMainDB()
     if (!hasDefaultCF)
     {
         auto newDescriptor =
-            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions());
+            rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions(m_rocksDBOptions));
         cfDescriptors.push_back(newDescriptor);
     }
 
@@ -338,10 +364,29 @@ uint32_t KVDBManager::getKVDBHandlersCount(const std::string& dbName) const
     return retValue;
 }
 
+KVDBStatistics KVDBManager::getStatistics() const
+{
+    KVDBStatistics stats;
+
+    if (m_blockCache)
+    {
+        stats.blockCacheUsage = m_blockCache->GetUsage();
+        stats.blockCacheCapacity = m_blockCache->GetCapacity();
+    }
+
+    if (m_statistics)
+    {
+        stats.blockCacheHits = m_statistics->getTickerCount(rocksdb::BLOCK_CACHE_HIT);
+        stats.blockCacheMisses = m_statistics->getTickerCount(rocksdb::BLOCK_CACHE_MISS);
+    }
+
+    return stats;
+}
+
 base::OptError KVDBManager::createColumnFamily(const std::string& name)
 {
     rocksdb::ColumnFamilyHandle* cfHandle {nullptr};
-    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(), name, &cfHandle)};
+    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(m_rocksDBOptions), name, &cfHandle)};
 
     if (s.ok())
     {
@@ -69,6 +69,10 @@ public:
     MOCK_METHOD((base::OptError), remove, (const std::string& key), (override));
     MOCK_METHOD((base::RespOrError<bool>), contains, (const std::string& key), (override));
     MOCK_METHOD((base::RespOrError<std::string>), get, (const std::string& key), (override));
+    MOCK_METHOD((base::OptError),
+                putBatch,
+                ((const std::vector<std::pair<std::string, std::string>>&)),
+                (override));
     MOCK_METHOD((base::RespOrError<std::list<std::pair<std::string, std::string>>>),
                 dump,
                 (const unsigned int page, const unsigned int records),
@@ -82,6 +86,10 @@ public:
                 search,
                 (const std::string& prefix),
                 ());
+    MOCK_METHOD((base::RespOrError<kvdbManager::ScanPage>),
+                scan,
+                (const std::string& prefix, const std::string& cursor, unsigned int limit),
+                (override));
 };
 
 } // namespace kvdb::mocks
@@ -59,6 +59,7 @@ public:
                 (const std::string& dbName, const std::string& scopeName),
                 (override));
     MOCK_METHOD((uint32_t), getKVDBHandlersCount, (const std::string& dbName), (const));
+    MOCK_METHOD((kvdbManager::KVDBStatistics), getStatistics, (), (const, override));
 };
 
 } // namespace kvdb::mocks
@@ -5,6 +5,8 @@
 #include <thread>
 #include <unistd.h>
 
+#include <fmt/format.h>
+
 #include <base/json.hpp>
 #include <base/logging.hpp>
 #include <kvdb/ikvdbmanager.hpp>
@@ -237,6 +239,273 @@ TEST_F(KVDBHandlerTest, GetKeyWithoutValue)
     ASSERT_EQ(std::get<std::string>(resultGet), "");
 }
 
+TEST_F(KVDBHandlerTest, SnapshotGetAndContains)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("SnapshotGetAndContains"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("SnapshotGetAndContains", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key1", "value") == std::nullopt);
+
+    handler->enableSnapshot();
+
+    auto resultGet = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value");
+
+    auto resultContains = handler->contains("key1");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContains));
+    ASSERT_TRUE(std::get<bool>(resultContains));
+
+    auto resultGetMissing = handler->get("missing");
+    ASSERT_TRUE(std::holds_alternative<base::Error>(resultGetMissing));
+
+    auto resultContainsMissing = handler->contains("missing");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContainsMissing));
+    ASSERT_FALSE(std::get<bool>(resultContainsMissing));
+}
+
+TEST_F(KVDBHandlerTest, SnapshotRebuildsOnWrite)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("SnapshotRebuildsOnWrite"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("SnapshotRebuildsOnWrite", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key1", "value") == std::nullopt);
+
+    handler->enableSnapshot();
+
+    auto resultGet = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value");
+
+    // Writes after the snapshot was built must be visible on the next read
+    ASSERT_TRUE(handler->set("key2", "late value") == std::nullopt);
+
+    auto resultGetLate = handler->get("key2");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGetLate));
+    ASSERT_EQ(std::get<std::string>(resultGetLate), "late value");
+
+    ASSERT_TRUE(handler->remove("key1") == std::nullopt);
+
+    auto resultGetRemoved = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<base::Error>(resultGetRemoved));
+}
+
+TEST_F(KVDBHandlerTest, CacheGetHitAndNegativeResult)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("CacheGetHitAndNegativeResult"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("CacheGetHitAndNegativeResult", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key1", "value") == std::nullopt);
+
+    handler->enableCache(8);
+
+    // First read fills the cache, second is served from it
+    for (auto i = 0; i < 2; i++)
+    {
+        auto resultGet = handler->get("key1");
+        ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+        ASSERT_EQ(std::get<std::string>(resultGet), "value");
+
+        auto resultGetMissing = handler->get("missing");
+        ASSERT_TRUE(std::holds_alternative<base::Error>(resultGetMissing));
+    }
+}
+
+TEST_F(KVDBHandlerTest, CacheFlushedOnWrite)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("CacheFlushedOnWrite"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("CacheFlushedOnWrite", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    handler->enableCache(8);
+
+    // Cache the key as absent, then write it: the next read must see the value
+    auto resultGetMissing = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<base::Error>(resultGetMissing));
+
+    ASSERT_TRUE(handler->set("key1", "value") == std::nullopt);
+
+    auto resultGet = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value");
+}
+
+TEST_F(KVDBHandlerTest, MultiGetKeys)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("MultiGetKeys"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("MultiGetKeys", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key1", "value1") == std::nullopt);
+    ASSERT_TRUE(handler->set("key2", "value2") == std::nullopt);
+
+    auto resultMultiGet = handler->multiGet({"key1", "key2"});
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultMultiGet));
+
+    auto values = std::get<std::vector<std::string>>(resultMultiGet);
+    ASSERT_EQ(values.size(), 2);
+    ASSERT_EQ(values[0], "value1");
+    ASSERT_EQ(values[1], "value2");
+
+    // A single missing key fails the whole call
+    auto resultMissing = handler->multiGet({"key1", "missing"});
+    ASSERT_TRUE(std::holds_alternative<base::Error>(resultMissing));
+
+    // Served from the snapshot index as well
+    handler->enableSnapshot();
+    auto resultSnapshot = handler->multiGet({"key2", "key1"});
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultSnapshot));
+
+    auto snapshotValues = std::get<std::vector<std::string>>(resultSnapshot);
+    ASSERT_EQ(snapshotValues.size(), 2);
+    ASSERT_EQ(snapshotValues[0], "value2");
+    ASSERT_EQ(snapshotValues[1], "value1");
+}
+
+TEST_F(KVDBHandlerTest, PutBatch)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("PutBatch"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("PutBatch", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    auto resultBatch = handler->putBatch({{"key1", "value1"}, {"key2", "value2"}, {"key1", "value1bis"}});
+    ASSERT_TRUE(resultBatch == std::nullopt);
+
+    // The last occurrence of a repeated key wins
+    auto resultGet = handler->get("key1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value1bis");
+
+    resultGet = handler->get("key2");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value2");
+
+    // An empty batch is a no-op
+    ASSERT_TRUE(handler->putBatch({}) == std::nullopt);
+}
+
+TEST_F(KVDBHandlerTest, PutBatchSstIngest)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("PutBatchSstIngest"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("PutBatchSstIngest", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("key0", "preexisting") == std::nullopt);
+
+    // Large enough to take the external SST file ingestion path
+    constexpr size_t ENTRIES = 70000;
+    std::vector<std::pair<std::string, std::string>> entries;
+    entries.reserve(ENTRIES);
+    for (size_t i = 0; i < ENTRIES; ++i)
+    {
+        entries.emplace_back(fmt::format("key{}", i), fmt::format("value{}", i));
+    }
+
+    auto resultBatch = handler->putBatch(entries);
+    ASSERT_TRUE(resultBatch == std::nullopt) << resultBatch.value().message;
+
+    // The ingested entries overwrite the pre-existing key and are all readable
+    auto resultGet = handler->get("key0");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value0");
+
+    resultGet = handler->get(fmt::format("key{}", ENTRIES - 1));
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), fmt::format("value{}", ENTRIES - 1));
+
+    auto resultDump = handler->dump();
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultDump));
+    ASSERT_EQ(std::get<std::list<std::pair<std::string, std::string>>>(resultDump).size(), ENTRIES);
+}
+
+TEST_F(KVDBHandlerTest, Scan)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("Scan"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("Scan", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_TRUE(handler->set("genre", "\"fiction\"") == std::nullopt);
+    for (auto i = 1; i <= 5; i++)
+    {
+        ASSERT_TRUE(handler->set(fmt::format("key{0}", i), fmt::format("\"value{0}\"", i)) == std::nullopt);
+    }
+
+    // First page of a prefixed scan
+    auto resultScan = handler->scan("key", "", 2);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultScan));
+    auto page = std::get<kvdbManager::ScanPage>(resultScan);
+    ASSERT_EQ(page.entries.size(), 2);
+    ASSERT_EQ(page.entries.front().first, "key1");
+    ASSERT_EQ(page.entries.back().first, "key2");
+    ASSERT_EQ(page.next, "key3");
+
+    // Resuming from the cursor continues where the previous page stopped
+    resultScan = handler->scan("key", page.next, 2);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultScan));
+    page = std::get<kvdbManager::ScanPage>(resultScan);
+    ASSERT_EQ(page.entries.size(), 2);
+    ASSERT_EQ(page.entries.front().first, "key3");
+    ASSERT_EQ(page.next, "key5");
+
+    // The last page is short and carries no cursor
+    resultScan = handler->scan("key", page.next, 2);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultScan));
+    page = std::get<kvdbManager::ScanPage>(resultScan);
+    ASSERT_EQ(page.entries.size(), 1);
+    ASSERT_EQ(page.entries.front().first, "key5");
+    ASSERT_TRUE(page.next.empty());
+
+    // An empty prefix scans the whole database
+    resultScan = handler->scan("", "", 10);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultScan));
+    page = std::get<kvdbManager::ScanPage>(resultScan);
+    ASSERT_EQ(page.entries.size(), 6);
+    ASSERT_EQ(page.entries.front().first, "genre");
+    ASSERT_TRUE(page.next.empty());
+
+    // A zero limit is rejected
+    resultScan = handler->scan("key", "", 0);
+    ASSERT_TRUE(std::holds_alternative<base::Error>(resultScan));
+}
+
+TEST_F(KVDBHandlerTest, DumpNoPaging)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("DumpNoPaging"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("DumpNoPaging", "scope1");
+
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    for (auto i = 1; i <= 3; i++)
+    {
+        ASSERT_TRUE(handler->set(fmt::format("key{0}", i), fmt::format("\"value{0}\"", i)) == std::nullopt);
+    }
+
+    // Page and records in 0 retrieve the whole database
+    auto resultDump = handler->dump();
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultDump));
+    ASSERT_EQ(std::get<std::list<std::pair<std::string, std::string>>>(resultDump).size(), 3);
+}
+
 TEST_F(KVDBHandlerTest, DumpOkValidateOrder)
 {
     ASSERT_FALSE(m_kvdbManager->createDB("DumpOkValidateOrder"));
@@ -81,6 +81,13 @@ TEST_F(KVDBManagerTest, Startup)
     ASSERT_NE(m_kvdbManager, nullptr);
 }
 
+TEST_F(KVDBManagerTest, Statistics)
+{
+    auto stats = m_kvdbManager->getStatistics();
+    ASSERT_EQ(stats.blockCacheCapacity, kvdbManager::DEFAULT_BLOCK_CACHE_SIZE);
+    ASSERT_LE(stats.blockCacheUsage, stats.blockCacheCapacity);
+}
+
 TEST_F(KVDBManagerTest, InitializeDBInUseWithSameManager)
 {
     // First initialize in setup
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <kvdb/kvdbHandlerCollection.hpp>
+
+using namespace kvdbManager;
+
+namespace
+{
+
+constexpr auto DB_COUNT = 8;
+constexpr auto OPS_PER_THREAD = 20000;
+constexpr auto MAX_THREADS = 16;
+
+std::string dbName(const int index)
+{
+    return "test_db_" + std::to_string(index % DB_COUNT);
+}
+
+} // namespace
+
+TEST(KVDBHandlerCollectionTest, SingleThreadRefCounting)
+{
+    KVDBHandlerCollection collection;
+
+    collection.addKVDBHandler("db_a", "scope_1");
+    collection.addKVDBHandler("db_a", "scope_1");
+    collection.addKVDBHandler("db_a", "scope_2");
+
+    auto refMap = collection.getRefMap("db_a");
+    EXPECT_EQ(refMap.size(), 2);
+    EXPECT_EQ(refMap["scope_1"], 2);
+    EXPECT_EQ(refMap["scope_2"], 1);
+
+    collection.removeKVDBHandler("db_a", "scope_1");
+    collection.removeKVDBHandler("db_a", "scope_2");
+    refMap = collection.getRefMap("db_a");
+    EXPECT_EQ(refMap.size(), 1);
+    EXPECT_EQ(refMap["scope_1"], 1);
+
+    collection.removeKVDBHandler("db_a", "scope_1");
+    EXPECT_TRUE(collection.getRefMap("db_a").empty());
+    EXPECT_TRUE(collection.getDBNames().empty());
+}
+
+TEST(KVDBHandlerCollectionTest, ConcurrentAddRemoveIsConsistent)
+{
+    KVDBHandlerCollection collection;
+
+    // Every thread churns the same DB names with its own scope, including the
+    // last-reference erase path, so instance creation and retirement race.
+    std::vector<std::thread> workers;
+    workers.reserve(MAX_THREADS);
+    for (auto t = 0; t < MAX_THREADS; ++t)
+    {
+        workers.emplace_back(
+            [&collection, t]()
+            {
+                const auto scopeName = "scope_" + std::to_string(t);
+                for (auto i = 0; i < OPS_PER_THREAD; ++i)
+                {
+                    collection.addKVDBHandler(dbName(i), scopeName);
+                    collection.removeKVDBHandler(dbName(i), scopeName);
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    // Every add was paired with a remove, nothing may remain registered.
+    EXPECT_TRUE(collection.getDBNames().empty());
+    for (auto i = 0; i < DB_COUNT; ++i)
+    {
+        EXPECT_TRUE(collection.getRefMap(dbName(i)).empty());
+    }
+}
+
+TEST(KVDBHandlerCollectionTest, ConcurrentAnchoredCountsAreExact)
+{
+    KVDBHandlerCollection collection;
+
+    // With an anchor scope the instances never retire, so after the churn every
+    // per-scope count must be back to zero and only the anchor remains.
+    for (auto i = 0; i < DB_COUNT; ++i)
+    {
+        collection.addKVDBHandler(dbName(i), "anchor_scope");
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(MAX_THREADS);
+    for (auto t = 0; t < MAX_THREADS; ++t)
+    {
+        workers.emplace_back(
+            [&collection, t]()
+            {
+                const auto scopeName = "scope_" + std::to_string(t);
+                for (auto i = 0; i < OPS_PER_THREAD; ++i)
+                {
+                    collection.addKVDBHandler(dbName(i), scopeName);
+                    collection.removeKVDBHandler(dbName(i), scopeName);
+                }
+            });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    EXPECT_EQ(collection.getDBNames().size(), DB_COUNT);
+    for (auto i = 0; i < DB_COUNT; ++i)
+    {
+        const auto refMap = collection.getRefMap(dbName(i));
+        EXPECT_EQ(refMap.size(), 1);
+        EXPECT_EQ(refMap.at("anchor_scope"), 1);
+    }
+
+    for (auto i = 0; i < DB_COUNT; ++i)
+    {
+        collection.removeKVDBHandler(dbName(i), "anchor_scope");
+    }
+    EXPECT_TRUE(collection.getDBNames().empty());
+}
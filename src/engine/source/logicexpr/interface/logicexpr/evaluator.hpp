@@ -1,9 +1,11 @@
 #ifndef _LOGICEXPR_EVALUATOR_H
 #define _LOGICEXPR_EVALUATOR_H
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <functional>
 #include <memory>
-#include <stack>
 #include <stdexcept>
 #include <vector>
 
@@ -128,6 +130,12 @@ private:
 /**
  * @brief Get the Dijstra Evaluator function from a logic expression tree
  *
+ * The tree is compiled once into a flat postfix instruction vector, so evaluating an
+ * event is a single forward scan over contiguous instructions instead of a
+ * pointer-chasing tree walk. The operand stack depth is known after compilation and
+ * expressions that fit the inline stack (all realistic ones) evaluate without heap
+ * allocations.
+ *
  * @tparam Event
  * @param expression root expression
  * @return Expression<Event>::FunctionType
@@ -135,79 +143,95 @@ private:
 template<typename Event>
 typename Expression<Event>::FunctionType getDijstraEvaluator(const std::shared_ptr<const Expression<Event>>& expression)
 {
-    // Struct for operators stack
-    struct Operator
+    // Postfix instruction, terms carry their evaluation function
+    struct Instruction
     {
         ExpressionType m_type;
         typename Expression<Event>::FunctionType m_function;
     };
 
-    // Operators stack, while semantically it is a stack of operators a vector
-    // is used to iterate and avoid moving data
-    std::vector<Operator> operators;
+    std::vector<Instruction> program;
+    std::size_t stackDepth {0};
 
-    // Visitor to poputale operators stack
-    auto visitor = [&operators](const Expression<Event>& expression)
+    // Compile the tree into postfix order (operands before their operator) tracking
+    // the maximum operand stack depth
+    auto compile = [&program, &stackDepth](const std::shared_ptr<const Expression<Event>>& expression,
+                                           std::size_t depth,
+                                           auto& compileRef) -> std::size_t
     {
-        if (expression.m_type == ExpressionType::TERM)
+        if (!expression)
+        {
+            return depth;
+        }
+
+        auto leftDepth = compileRef(expression->m_left, depth, compileRef);
+        // Binary operators evaluate the right subtree with the left result on the stack
+        auto rightDepth = compileRef(expression->m_right, expression->m_right ? depth + 1 : depth, compileRef);
+
+        if (expression->m_type == ExpressionType::TERM)
         {
-            operators.push_back({expression.m_type, expression.m_function});
+            program.push_back({expression->m_type, expression->m_function});
         }
         else
         {
-            operators.push_back({expression.m_type, nullptr});
+            program.push_back({expression->m_type, nullptr});
         }
+
+        auto maxDepth = std::max({leftDepth, rightDepth, depth + 1});
+        stackDepth = std::max(stackDepth, maxDepth);
+        return maxDepth;
     };
 
-    Expression<Event>::visitPreOrder(expression, visitor);
+    compile(expression, 0, compile);
+
+    if (program.empty())
+    {
+        return [](Event) -> bool
+        {
+            return false;
+        };
+    }
+
+    // Single term expressions do not need the operand stack at all
+    if (program.size() == 1)
+    {
+        return program.front().m_function;
+    }
+
+    constexpr std::size_t INLINE_STACK_SIZE = 32;
+    if (stackDepth > INLINE_STACK_SIZE)
+    {
+        throw std::runtime_error(fmt::format(
+            "Engine logic expression evaluator: expression needs an operand stack of {} but the limit is {}.",
+            stackDepth,
+            INLINE_STACK_SIZE));
+    }
 
     // Evaluator function
-    return [operators](Event event) -> bool
+    return [program](Event event) -> bool
     {
-        std::stack<bool> operands;
-        bool result {false};
+        std::array<bool, INLINE_STACK_SIZE> operands;
+        std::size_t top {0};
 
-        for (auto it = operators.crbegin(); it != operators.crend(); ++it)
+        for (const auto& instruction : program)
         {
-            switch (it->m_type)
+            switch (instruction.m_type)
             {
-                case ExpressionType::TERM:
-                    // Handle only term expression
-                    // TODO: dont allow expressions with one term only, use check list
-                    // instead
-                    if (operators.size() == 1)
-                    {
-                        result = it->m_function(event);
-                    }
-                    else
-                    {
-                        operands.push(it->m_function(event));
-                    }
-                    break;
-                case ExpressionType::NOT:
-                    result = !operands.top();
-                    operands.pop();
-                    operands.push(result);
-                    break;
+                case ExpressionType::TERM: operands[top++] = instruction.m_function(event); break;
+                case ExpressionType::NOT: operands[top - 1] = !operands[top - 1]; break;
                 case ExpressionType::AND:
-                    result = operands.top();
-                    operands.pop();
-                    result = result && operands.top();
-                    operands.pop();
-                    operands.push(result);
+                    --top;
+                    operands[top - 1] = operands[top - 1] && operands[top];
                     break;
                 case ExpressionType::OR:
-                    result = operands.top();
-                    operands.pop();
-                    result = result || operands.top();
-                    operands.pop();
-                    operands.push(result);
+                    --top;
+                    operands[top - 1] = operands[top - 1] || operands[top];
                     break;
                 default: throw std::runtime_error("Engine logic expression evaluator got unknown operator type.");
             }
         }
 
-        return result;
+        return operands[0];
     };
 }
 
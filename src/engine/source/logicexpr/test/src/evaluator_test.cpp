@@ -88,6 +88,32 @@ TEST(LogicExpressionEvaluator, getDijstraEvaluatorNotTerm)
     EXPECT_TRUE(evaluator(7));
 }
 
+TEST(LogicExpressionEvaluator, getDijstraEvaluatorDeepExpression)
+{
+    // Right-deep chain: i > 0 and (i > 1 and (... and i > 15))
+    auto root = Expression<int>::create(ExpressionType::AND);
+    auto current = root;
+    for (int threshold = 0; threshold < 15; ++threshold)
+    {
+        current->m_left = Expression<int>::create([threshold](int i) { return i > threshold; });
+        if (threshold < 14)
+        {
+            current->m_right = Expression<int>::create(ExpressionType::AND);
+            current = current->m_right;
+        }
+        else
+        {
+            current->m_right = Expression<int>::create([](int i) { return i > 15; });
+        }
+    }
+
+    std::function<bool(int)> evaluator;
+    ASSERT_NO_THROW(evaluator = getDijstraEvaluator<int>(root));
+
+    EXPECT_FALSE(evaluator(15));
+    EXPECT_TRUE(evaluator(16));
+}
+
 TEST(LogicExpressionEvaluator, getDijstraEvaluatorSingleTerm)
 {
     // True if: not pair
@@ -36,8 +36,10 @@ enum class ParserType
     P_BYTE,
     P_DOUBLE,
     P_FLOAT,
+    P_INTEGER,
     P_LONG,
     P_SCALED_FLOAT,
+    P_SHORT,
     // Other types
     P_ALPHANUMERIC,
     P_BOOL,
@@ -72,6 +74,7 @@ constexpr auto parserTypeToStr(ParserType type)
         case ParserType::P_FLOAT: return "float";
         case ParserType::P_FQDN: return "fqdn";
         case ParserType::P_IGNORE: return "ignore";
+        case ParserType::P_INTEGER: return "integer";
         case ParserType::P_IP: return "ip";
         case ParserType::P_JSON: return "json";
         case ParserType::P_KV: return "kv";
@@ -79,6 +82,7 @@ constexpr auto parserTypeToStr(ParserType type)
         case ParserType::P_LONG: return "long";
         case ParserType::P_QUOTED: return "quoted";
         case ParserType::P_SCALED_FLOAT: return "scaled_float";
+        case ParserType::P_SHORT: return "short";
         case ParserType::P_TEXT: return "text";
         case ParserType::P_URI: return "uri";
         case ParserType::P_USER_AGENT: return "useragent";
@@ -99,6 +103,10 @@ constexpr auto strToParserType(std::string_view str)
         return ParserType::P_SCALED_FLOAT;
     if (str == parserTypeToStr(ParserType::P_BYTE))
         return ParserType::P_BYTE;
+    if (str == parserTypeToStr(ParserType::P_SHORT))
+        return ParserType::P_SHORT;
+    if (str == parserTypeToStr(ParserType::P_INTEGER))
+        return ParserType::P_INTEGER;
     if (str == parserTypeToStr(ParserType::P_TEXT))
         return ParserType::P_TEXT;
     if (str == parserTypeToStr(ParserType::P_LITERAL))
@@ -299,6 +307,9 @@ private:
     Hlp buildChoiceParser(const parser::Choice& choice, const std::vector<std::string>& endTokens = {}) const;
     Hlp buildGroupOptParser(const parser::Group& group, size_t recurLvl) const;
 
+    // build the ordered sub-parsers while adding the target field to the json
+    std::vector<Hlp> buildParserList(const std::list<parser::ParserInfo>& parserInfos, size_t recurLvl) const;
+
     // build the parsers while adding the target field to the json
     Hlp buildParsers(const std::list<parser::ParserInfo>& parserInfos, size_t recurLvl) const;
 
@@ -389,6 +400,18 @@ public:
      * @throws std::runtime_error if errors occur while building the parser
      */
     Hlp build(std::string_view logpar) const;
+
+    /**
+     * @brief Compile the given logpar expression into a single-pass extraction plan
+     *
+     * The plan runs the same sub-parsers as build() but flat, without the
+     * top-level combinator, so no intermediate result tree is built per event
+     *
+     * @param logpar the logpar expression
+     * @return hlp::parser::ExtractionPlan the compiled plan
+     * @throws std::runtime_error if errors occur while building the parser
+     */
+    hlp::parser::ExtractionPlan buildPlan(std::string_view logpar) const;
 };
 } // namespace logpar
 } // namespace hlp
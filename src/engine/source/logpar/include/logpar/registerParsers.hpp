@@ -11,6 +11,8 @@ inline void registerParsers(std::shared_ptr<logpar::Logpar> logpar)
 {
     // Numeric
     logpar->registerBuilder(ParserType::P_LONG, parsers::getLongParser);
+    logpar->registerBuilder(ParserType::P_SHORT, parsers::getShortParser);
+    logpar->registerBuilder(ParserType::P_INTEGER, parsers::getIntegerParser);
     logpar->registerBuilder(ParserType::P_DOUBLE, parsers::getDoubleParser);
     logpar->registerBuilder(ParserType::P_FLOAT, parsers::getFloatParser);
     logpar->registerBuilder(ParserType::P_SCALED_FLOAT, parsers::getScaledFloatParser);
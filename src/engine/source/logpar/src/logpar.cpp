@@ -338,8 +338,8 @@ Logpar::Logpar(const json::Json& fieldParserOverrides,
     // Schema type -> parser table
     m_typeParsers = {{schemf::Type::BOOLEAN, ParserType::P_BOOL},
                      {schemf::Type::BYTE, ParserType::P_BYTE},
-                     {schemf::Type::SHORT, ParserType::P_LONG},
-                     {schemf::Type::INTEGER, ParserType::P_LONG},
+                     {schemf::Type::SHORT, ParserType::P_SHORT},
+                     {schemf::Type::INTEGER, ParserType::P_INTEGER},
                      {schemf::Type::LONG, ParserType::P_LONG},
                      {schemf::Type::FLOAT, ParserType::P_FLOAT},
                      {schemf::Type::HALF_FLOAT, ParserType::P_FLOAT},
@@ -444,7 +444,8 @@ Logpar::Hlp Logpar::buildGroupOptParser(const parser::Group& group, size_t recur
     return hlp::parser::combinator::opt(p);
 }
 
-Logpar::Hlp Logpar::buildParsers(const std::list<parser::ParserInfo>& parserInfos, size_t recurLvl) const
+std::vector<Logpar::Hlp> Logpar::buildParserList(const std::list<parser::ParserInfo>& parserInfos,
+                                                 size_t recurLvl) const
 {
     if (recurLvl > m_maxGroupRecursion)
     {
@@ -611,10 +612,12 @@ Logpar::Hlp Logpar::buildParsers(const std::list<parser::ParserInfo>& parserInfo
         }
     }
 
-    // return parsers;
-    auto p = hlp::parser::combinator::all(parsers);
+    return parsers;
+}
 
-    return p;
+Logpar::Hlp Logpar::buildParsers(const std::list<parser::ParserInfo>& parserInfos, size_t recurLvl) const
+{
+    return hlp::parser::combinator::all(buildParserList(parserInfos, recurLvl));
 }
 
 void Logpar::registerBuilder(ParserType type, const ParserBuilder& builder)
@@ -641,4 +644,19 @@ Logpar::Hlp Logpar::build(std::string_view logpar) const
     return hlp::parser::combinator::all({p, hlp::parsers::getEofParser({.name = "EOF"})});
 }
 
+hlp::parser::ExtractionPlan Logpar::buildPlan(std::string_view logpar) const
+{
+    auto result = parser::pLogpar()(logpar, 0);
+    if (result.failure())
+    {
+        throw std::runtime_error(parsec::formatTrace(logpar, result.trace(), 1));
+    }
+
+    auto parserInfos = result.value();
+    auto steps = buildParserList(parserInfos, 0);
+    steps.emplace_back(hlp::parsers::getEofParser({.name = "EOF"}));
+
+    return hlp::parser::ExtractionPlan {std::move(steps)};
+}
+
 } // namespace hlp::logpar
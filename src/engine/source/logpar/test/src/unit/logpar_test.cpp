@@ -161,6 +161,56 @@ INSTANTIATE_TEST_SUITE_P(
         BuildParseT(false, "[date] <~host> <text>(?|<~opt/text>|):<~>", "[date] host text|opt|:", {}),
         BuildParseT(false, "[date] <~host> <text>(?|<~opt/text>|):<~>", "[date] host text|opt|left over", {})));
 
+class LogparBuildPlanTest
+    : public ::testing::TestWithParam<BuildParseT>
+    , public logpar_test::LogparPBase
+{
+protected:
+    void SetUp() override { init(); }
+};
+
+TEST_P(LogparBuildPlanTest, BuildPlan)
+{
+    auto [shouldPass, expression, text, expected] = GetParam();
+    auto plan = logpar->buildPlan(expression);
+
+    json::Json event;
+    auto error = plan.run(text, event);
+
+    if (shouldPass)
+    {
+        ASSERT_FALSE(error) << error.value().message;
+        ASSERT_EQ(event, expected);
+    }
+    else
+    {
+        ASSERT_TRUE(error);
+        // A failing plan leaves the event untouched
+        json::Json untouched;
+        ASSERT_EQ(event, untouched);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BuildPlan,
+    LogparBuildPlanTest,
+    ::testing::Values(
+        BuildParseT(true, "literal", "literal", {}),
+        BuildParseT(false, "literal", "literalleftover", {}),
+        BuildParseT(true, "<text>", "some text", logpar_test::J(R"({"text":"some text"})")),
+        BuildParseT(true, "lit<text>:<~a/long><~>", "literal:1ignored", logpar_test::J(R"({"text":"eral","~a":1})")),
+        // The text capture succeeds before the long fails; nothing may be mapped
+        BuildParseT(false, "lit<text>:<~a/long>", "literal:x", {}),
+        BuildParseT(true,
+                    "lit<text>:<~a/long><~>:(?<~opt/text>)",
+                    "literal:1ignored:optional",
+                    logpar_test::J(R"({"text":"eral","~a":1,"~opt":"optional"})")),
+        BuildParseT(true,
+                    "[date] <~host> <text>(?|<~opt/text>|):<~>",
+                    "[date] host text|opt|:left over",
+                    logpar_test::J(R"({"~host":"host","text":"text","~opt":"opt"})")),
+        BuildParseT(false, "[date] <~host> <text>(?|<~opt/text>|):<~>", "[date] host text|opt|left over", {})));
+
 using FieldParserT = std::tuple<bool, std::string, std::string, bool, std::list<std::string>, bool, size_t>;
 class LogparFieldParserTest : public ::testing::TestWithParam<FieldParserT>
 {
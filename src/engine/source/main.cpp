@@ -1,16 +1,22 @@
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <csignal>
 #include <exception>
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include <api/catalog/catalog.hpp>
-#include <api/event/ndJsonParser.hpp>
 #include <api/handlers.hpp>
 #include <api/policy/policy.hpp>
+#include <base/json.hpp>
 #include <base/logging.hpp>
 #include <base/utils/singletonLocator.hpp>
 #include <base/utils/singletonLocatorStrategies.hpp>
@@ -23,6 +29,7 @@
 #include <eMessages/eMessage.h>
 #include <geo/downloader.hpp>
 #include <geo/manager.hpp>
+#include <httpsrv/framedServer.hpp>
 #include <httpsrv/server.hpp>
 #include <indexerConnector/indexerConnector.hpp>
 #include <kvdb/kvdbManager.hpp>
@@ -30,6 +37,7 @@
 #include <logpar/registerParsers.hpp>
 #include <metrics/manager.hpp>
 #include <queue/concurrentQueue.hpp>
+#include <queue/eventPool.hpp>
 #include <rbac/rbac.hpp>
 #include <router/orchestrator.hpp>
 #include <schemf/schema.hpp>
@@ -50,9 +58,23 @@ struct QueueTraits : public moodycamel::ConcurrentQueueDefaultTraits
 } // namespace
 
 std::shared_ptr<httpsrv::Server> g_engineServer {};
+std::shared_ptr<httpsrv::FramedServer> g_eventStreamServer {};
+std::atomic<bool> g_reloadRequested {false};
+
+void sighupHandler(const int signum)
+{
+    // Only raise the flag; the reload itself runs on the watcher thread.
+    g_reloadRequested.store(true, std::memory_order_relaxed);
+}
 
 void sigintHandler(const int signum)
 {
+    if (g_eventStreamServer)
+    {
+        g_eventStreamServer->stop();
+        g_eventStreamServer.reset();
+    }
+
     if (g_engineServer)
     {
         g_engineServer->stop();
@@ -106,6 +128,14 @@ int main(int argc, char* argv[])
         sigPipeHandler.sa_flags = 0;
         sigaction(SIGPIPE, &sigPipeHandler, nullptr);
     }
+    // Set signal [SIGHUP]: Configuration hot-reload
+    {
+        struct sigaction sigHupHandler = {};
+        sigHupHandler.sa_handler = sighupHandler;
+        sigemptyset(&sigHupHandler.sa_mask);
+        sigHupHandler.sa_flags = 0;
+        sigaction(SIGHUP, &sigHupHandler, nullptr);
+    }
 
     // Init modules
     std::shared_ptr<store::Store> store;
@@ -135,77 +165,160 @@ int main(int argc, char* argv[])
             }
         }
 
-        // Metrics
-        {
-            SingletonLocator::registerManager<metrics::IManager,
-                                              base::PtrSingleton<metrics::IManager, metrics::Manager>>();
-            auto config = std::make_shared<metrics::Manager::ImplConfig>();
-            config->logLevel = logging::Level::Err;
-            config->exportInterval =
-                std::chrono::milliseconds(confManager.get<int64_t>(conf::key::METRICS_EXPORT_INTERVAL));
-            config->exportTimeout =
-                std::chrono::milliseconds(confManager.get<int64_t>(conf::key::METRICS_EXPORT_TIMEOUT));
-
-            // TODO Update index configuration when it is defined
-            IndexerConnectorOptions icConfig {};
-            icConfig.name = "metrics-index";
-            icConfig.hosts = confManager.get<std::vector<std::string>>(conf::key::INDEXER_HOST);
-            icConfig.username = confManager.get<std::string>(conf::key::INDEXER_USER);
-            icConfig.password = confManager.get<std::string>(conf::key::INDEXER_PASSWORD);
-            if (confManager.get<bool>(conf::key::INDEXER_SSL_USE_SSL))
-            {
-                icConfig.sslOptions.cacert = confManager.get<std::string>(conf::key::INDEXER_SSL_CA_BUNDLE);
-                icConfig.sslOptions.cert = confManager.get<std::string>(conf::key::INDEXER_SSL_CERTIFICATE);
-                icConfig.sslOptions.key = confManager.get<std::string>(conf::key::INDEXER_SSL_KEY);
-            }
+        // Independent modules are initialized as a small fork-join task graph: the
+        // store scan, the GeoIP database load, the KVDB open and the indexer
+        // connector do not depend on each other and dominate startup. Tasks only
+        // build their module; exit handlers are registered on this thread after the
+        // join, and exceptions surface through future::get() into the catch below.
 
-            icConfig.databasePath = confManager.get<std::string>(conf::key::INDEXER_DB_PATH);
-            const auto to = confManager.get<int>(conf::key::INDEXER_TIMEOUT);
-            if (to < 0)
+        // Metrics (configured here; the exporters are non-critical and are started
+        // after the event endpoint is accepting)
+        auto metricsReady = std::async(
+            std::launch::async,
+            [&confManager]()
             {
-                throw std::runtime_error("Invalid indexer timeout value.");
-            }
-            icConfig.timeout = to;
-            const auto wt = confManager.get<int>(conf::key::INDEXER_THREADS);
-            if (wt < 0)
-            {
-                throw std::runtime_error("Invalid indexer threads value.");
-            }
-            icConfig.workingThreads = wt;
+                SingletonLocator::registerManager<metrics::IManager,
+                                                  base::PtrSingleton<metrics::IManager, metrics::Manager>>();
+                auto config = std::make_shared<metrics::Manager::ImplConfig>();
+                config->logLevel = logging::Level::Err;
+                config->exportInterval =
+                    std::chrono::milliseconds(confManager.get<int64_t>(conf::key::METRICS_EXPORT_INTERVAL));
+                config->exportTimeout =
+                    std::chrono::milliseconds(confManager.get<int64_t>(conf::key::METRICS_EXPORT_TIMEOUT));
+                config->foldInterval =
+                    std::chrono::milliseconds(confManager.get<int64_t>(conf::key::METRICS_FOLD_INTERVAL));
+                config->sampleEvery = static_cast<uint32_t>(confManager.get<int64_t>(conf::key::METRICS_SAMPLE_EVERY));
 
-            config->indexerConnectorFactory = [icConfig]() -> std::shared_ptr<IIndexerConnector>
-            {
-                return std::make_shared<IndexerConnector>(icConfig);
-            };
+                // TODO Update index configuration when it is defined
+                IndexerConnectorOptions icConfig {};
+                icConfig.name = "metrics-index";
+                icConfig.hosts = confManager.get<std::vector<std::string>>(conf::key::INDEXER_HOST);
+                icConfig.username = confManager.get<std::string>(conf::key::INDEXER_USER);
+                icConfig.password = confManager.get<std::string>(conf::key::INDEXER_PASSWORD);
+                if (confManager.get<bool>(conf::key::INDEXER_SSL_USE_SSL))
+                {
+                    icConfig.sslOptions.cacert = confManager.get<std::string>(conf::key::INDEXER_SSL_CA_BUNDLE);
+                    icConfig.sslOptions.cert = confManager.get<std::string>(conf::key::INDEXER_SSL_CERTIFICATE);
+                    icConfig.sslOptions.key = confManager.get<std::string>(conf::key::INDEXER_SSL_KEY);
+                }
 
-            SingletonLocator::instance<metrics::IManager>().configure(config);
+                icConfig.databasePath = confManager.get<std::string>(conf::key::INDEXER_DB_PATH);
+                const auto to = confManager.get<int>(conf::key::INDEXER_TIMEOUT);
+                if (to < 0)
+                {
+                    throw std::runtime_error("Invalid indexer timeout value.");
+                }
+                icConfig.timeout = to;
+                const auto wt = confManager.get<int>(conf::key::INDEXER_THREADS);
+                if (wt < 0)
+                {
+                    throw std::runtime_error("Invalid indexer threads value.");
+                }
+                icConfig.workingThreads = wt;
+
+                config->indexerConnectorFactory = [icConfig]() -> std::shared_ptr<IIndexerConnector>
+                {
+                    return std::make_shared<IndexerConnector>(icConfig);
+                };
+
+                SingletonLocator::instance<metrics::IManager>().configure(config);
 
-            LOG_INFO("Metrics initialized.");
+                LOG_INFO("Metrics initialized.");
+            });
 
-            if (confManager.get<bool>(conf::key::METRICS_ENABLED))
+        // KVDB
+        auto kvdbReady = std::async(
+            std::launch::async,
+            [&confManager, &kvdbManager]()
             {
-                SingletonLocator::instance<metrics::IManager>().enable();
-                LOG_INFO("Metrics enabled.");
-            }
-            else
+                kvdbManager::KVDBManagerOptions kvdbOptions {
+                    confManager.get<std::string>(conf::key::KVDB_PATH),
+                    "kvdb",
+                    static_cast<size_t>(confManager.get<int>(conf::key::KVDB_BLOCK_CACHE_SIZE)),
+                    confManager.get<int>(conf::key::KVDB_BLOOM_FILTER_BITS),
+                    confManager.get<bool>(conf::key::KVDB_COMPRESSION)};
+                kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions);
+                kvdbManager->initialize();
+                LOG_INFO("KVDB initialized.");
+            });
+
+        // Indexer Connector
+        auto indexerReady = std::async(
+            std::launch::async,
+            [&confManager, &iConnector]()
             {
-                SingletonLocator::instance<metrics::IManager>().disable();
-                LOG_INFO("Metrics disabled.");
-            }
+                IndexerConnectorOptions icConfig {};
+                icConfig.name = confManager.get<std::string>(conf::key::INDEXER_INDEX);
+                icConfig.hosts = confManager.get<std::vector<std::string>>(conf::key::INDEXER_HOST);
+                icConfig.username = confManager.get<std::string>(conf::key::INDEXER_USER);
+                icConfig.password = confManager.get<std::string>(conf::key::INDEXER_PASSWORD);
+                if (confManager.get<bool>(conf::key::INDEXER_SSL_USE_SSL))
+                {
+                    icConfig.sslOptions.cacert = confManager.get<std::string>(conf::key::INDEXER_SSL_CA_BUNDLE);
+                    icConfig.sslOptions.cert = confManager.get<std::string>(conf::key::INDEXER_SSL_CERTIFICATE);
+                    icConfig.sslOptions.key = confManager.get<std::string>(conf::key::INDEXER_SSL_KEY);
+                    icConfig.sslOptions.skipVerifyPeer = !confManager.get<bool>(conf::key::INDEXER_SSL_VERIFY_CERTS);
+                }
+                else
+                {
+                    // If not use SSL, check if url start with https
+                    for (const auto& host : icConfig.hosts)
+                    {
+                        if (base::utils::string::startsWith(host, "https://"))
+                        {
+                            throw std::runtime_error(fmt::format(
+                                "The host '{}' for indexer connector is using HTTPS but the SSL options are not "
+                                "enabled.",
+                                host));
+                        }
+                    }
+                }
 
-            exitHandler.add(
-                []()
+                icConfig.databasePath = confManager.get<std::string>(conf::key::INDEXER_DB_PATH);
+                const auto to = confManager.get<int>(conf::key::INDEXER_TIMEOUT);
+                if (to < 0)
                 {
-                    SingletonLocator::instance<metrics::IManager>().disable();
-                    SingletonLocator::clear();
-                });
-        }
+                    throw std::runtime_error("Invalid indexer timeout value.");
+                }
+                icConfig.timeout = to;
+                const auto wt = confManager.get<int>(conf::key::INDEXER_THREADS);
+                if (wt < 0)
+                {
+                    throw std::runtime_error("Invalid indexer threads value.");
+                }
+                icConfig.workingThreads = wt;
+
+                iConnector = std::make_shared<IndexerConnector>(icConfig);
+                LOG_INFO("Indexer Connector initialized.");
+            });
 
-        // Store
+        // Store (on this thread, almost every other module reads from it)
         {
             auto fileStorage = confManager.get<std::string>(conf::key::STORE_PATH);
             auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
-            store = std::make_shared<store::Store>(fileDriver);
+            auto docCacheSize = confManager.get<int>(conf::key::STORE_DOC_CACHE_SIZE);
+            if (docCacheSize < 0)
+            {
+                throw std::runtime_error("Store document cache size cannot be negative.");
+            }
+            store = std::make_shared<store::Store>(fileDriver, static_cast<std::size_t>(docCacheSize));
+
+            // Invalidate only the documents touched on disk by external tooling
+            if (confManager.get<bool>(conf::key::STORE_WATCH))
+            {
+                auto error = fileDriver->startWatcher(
+                    [weakStore = std::weak_ptr<store::Store>(store)](const base::Name& realName)
+                    {
+                        if (auto store = weakStore.lock())
+                        {
+                            store->invalidateDoc(realName);
+                        }
+                    });
+                if (error)
+                {
+                    LOG_WARNING("Store watcher could not be started: {}", error.value().message);
+                }
+            }
             LOG_INFO("Store initialized.");
         }
 
@@ -215,27 +328,16 @@ int main(int argc, char* argv[])
             LOG_INFO("RBAC initialized.");
         }
 
-        // KVDB
-        {
-            kvdbManager::KVDBManagerOptions kvdbOptions {confManager.get<std::string>(conf::key::KVDB_PATH), "kvdb"};
-            kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions);
-            kvdbManager->initialize();
-            LOG_INFO("KVDB initialized.");
-            exitHandler.add(
-                [kvdbManager, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
-                {
-                    kvdbManager->finalize();
-                    LOG_INFO_L(functionName.c_str(), "KVDB terminated.");
-                });
-        }
-
-        // GEO
-        {
-            // TODO: This is a optional right now, but it be mandatory in the future
-            auto geoDownloader = std::make_shared<geo::Downloader>();
-            geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
-            LOG_INFO("Geo initialized.");
-        }
+        // GEO (needs the store; the database load runs beside the schema and HLP reads)
+        auto geoReady = std::async(
+            std::launch::async,
+            [&store, &geoManager]()
+            {
+                // TODO: This is a optional right now, but it be mandatory in the future
+                auto geoDownloader = std::make_shared<geo::Downloader>();
+                geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
+                LOG_INFO("Geo initialized.");
+            });
 
         // Schema
         {
@@ -273,51 +375,28 @@ int main(int argc, char* argv[])
             LOG_INFO("HLP initialized.");
         }
 
-        // Indexer Connector
+        // Join the task graph: the builder and everything after it need the full set
+        // of modules. The exit handlers are registered here, on this thread, once the
+        // modules exist.
         {
-            IndexerConnectorOptions icConfig {};
-            icConfig.name = confManager.get<std::string>(conf::key::INDEXER_INDEX);
-            icConfig.hosts = confManager.get<std::vector<std::string>>(conf::key::INDEXER_HOST);
-            icConfig.username = confManager.get<std::string>(conf::key::INDEXER_USER);
-            icConfig.password = confManager.get<std::string>(conf::key::INDEXER_PASSWORD);
-            if (confManager.get<bool>(conf::key::INDEXER_SSL_USE_SSL))
-            {
-                icConfig.sslOptions.cacert = confManager.get<std::string>(conf::key::INDEXER_SSL_CA_BUNDLE);
-                icConfig.sslOptions.cert = confManager.get<std::string>(conf::key::INDEXER_SSL_CERTIFICATE);
-                icConfig.sslOptions.key = confManager.get<std::string>(conf::key::INDEXER_SSL_KEY);
-                icConfig.sslOptions.skipVerifyPeer = !confManager.get<bool>(conf::key::INDEXER_SSL_VERIFY_CERTS);
-            }
-            else
-            {
-                // If not use SSL, check if url start with https
-                for (const auto& host : icConfig.hosts)
+            metricsReady.get();
+            exitHandler.add(
+                []()
                 {
-                    if (base::utils::string::startsWith(host, "https://"))
-                    {
-                        throw std::runtime_error(fmt::format(
-                            "The host '{}' for indexer connector is using HTTPS but the SSL options are not "
-                            "enabled.",
-                            host));
-                    }
-                }
-            }
+                    SingletonLocator::instance<metrics::IManager>().disable();
+                    SingletonLocator::clear();
+                });
 
-            icConfig.databasePath = confManager.get<std::string>(conf::key::INDEXER_DB_PATH);
-            const auto to = confManager.get<int>(conf::key::INDEXER_TIMEOUT);
-            if (to < 0)
-            {
-                throw std::runtime_error("Invalid indexer timeout value.");
-            }
-            icConfig.timeout = to;
-            const auto wt = confManager.get<int>(conf::key::INDEXER_THREADS);
-            if (wt < 0)
-            {
-                throw std::runtime_error("Invalid indexer threads value.");
-            }
-            icConfig.workingThreads = wt;
+            kvdbReady.get();
+            exitHandler.add(
+                [kvdbManager, functionName = logging::getLambdaName(__FUNCTION__, "exitHandler")]()
+                {
+                    kvdbManager->finalize();
+                    LOG_INFO_L(functionName.c_str(), "KVDB terminated.");
+                });
 
-            iConnector = std::make_shared<IndexerConnector>(icConfig);
-            LOG_INFO("Indexer Connector initialized.");
+            indexerReady.get();
+            geoReady.get();
         }
 
         // Builder and registry
@@ -374,6 +453,18 @@ int main(int argc, char* argv[])
 
             std::shared_ptr<QEventType> eventQueue {};
             std::shared_ptr<QTestType> testQueue {};
+
+            // Under overload verbose app logs are shed first: everything else (FIM,
+            // inventory, keepalives, ...) keeps the full capacity while logcollector
+            // traffic is only admitted below the watermark.
+            const auto priorityClassifier = [](const base::Event& event)
+            {
+                const auto module = event->getStringView(base::event::modulePath());
+                return (module && *module == "logcollector") ? base::queue::Priority::LOW
+                                                             : base::queue::Priority::HIGH;
+            };
+            const auto lowLaneCapacity =
+                std::max(1, confManager.get<int>(conf::key::QUEUE_SIZE) * 3 / 4);
             {
                 // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
                 eventQueue = std::make_shared<QEventType>(confManager.get<int>(conf::key::QUEUE_SIZE),
@@ -382,6 +473,17 @@ int main(int argc, char* argv[])
                                                           confManager.get<int>(conf::key::QUEUE_FLOOD_ATTEMPS),
                                                           confManager.get<int>(conf::key::QUEUE_FLOOD_SLEEP),
                                                           confManager.get<bool>(conf::key::QUEUE_DROP_ON_FLOOD));
+                eventQueue->setPriorityClassifier(priorityClassifier, lowLaneCapacity);
+
+                // With a flood file and replay enabled, flooded events are reinjected
+                // automatically while the queue has spare capacity
+                if (!confManager.get<bool>(conf::key::QUEUE_DROP_ON_FLOOD)
+                    && !confManager.get<std::string>(conf::key::QUEUE_FLOOD_FILE).empty()
+                    && confManager.get<bool>(conf::key::QUEUE_FLOOD_REPLAY))
+                {
+                    eventQueue->enableFloodReplay([](std::string&& line) -> base::Event
+                                                  { return std::make_shared<json::Json>(line.c_str()); });
+                }
                 LOG_DEBUG("Event queue created.");
             }
 
@@ -390,13 +492,125 @@ int main(int argc, char* argv[])
                 LOG_DEBUG("Test queue created.");
             }
 
+            // Tenant lanes: "tenant:count" entries reserve dedicated workers for each
+            // named tenant, and imply sticky mode since lanes are slices of the
+            // per-worker queues
+            const auto tenantKey = confManager.get<std::string>(conf::key::ORCHESTRATOR_TENANT_KEY);
+            std::vector<std::pair<std::string, std::size_t>> tenantWorkers {};
+            for (const auto& entry : confManager.get<std::vector<std::string>>(conf::key::ORCHESTRATOR_TENANT_WORKERS))
+            {
+                const auto sep = entry.rfind(':');
+                if (sep == std::string::npos || sep == 0 || sep == entry.size() - 1)
+                {
+                    throw std::runtime_error {
+                        fmt::format("Invalid tenant workers entry '{}', expected 'tenant:count'", entry)};
+                }
+                tenantWorkers.emplace_back(entry.substr(0, sep), std::stoul(entry.substr(sep + 1)));
+            }
+
+            // Sticky mode: one queue per worker, events dispatched by agent id
+            std::vector<std::shared_ptr<router::ProdQueueType>> workerQueues {};
+            std::vector<std::shared_ptr<QEventType>> shedQueues {eventQueue};
+            if (confManager.get<bool>(conf::key::ORCHESTRATOR_STICKY_WORKERS) || !tenantWorkers.empty())
+            {
+                const auto numThreads = confManager.get<int>(conf::key::ORCHESTRATOR_THREADS);
+                for (int i = 0; i < numThreads; ++i)
+                {
+                    auto workerQueue =
+                        std::make_shared<QEventType>(confManager.get<int>(conf::key::QUEUE_SIZE),
+                                                     fmt::format("routerEventQueue.{}", i),
+                                                     confManager.get<std::string>(conf::key::QUEUE_FLOOD_FILE),
+                                                     confManager.get<int>(conf::key::QUEUE_FLOOD_ATTEMPS),
+                                                     confManager.get<int>(conf::key::QUEUE_FLOOD_SLEEP),
+                                                     confManager.get<bool>(conf::key::QUEUE_DROP_ON_FLOOD));
+                    workerQueue->setPriorityClassifier(priorityClassifier, lowLaneCapacity);
+                    shedQueues.emplace_back(workerQueue);
+                    workerQueues.emplace_back(std::move(workerQueue));
+                }
+                LOG_DEBUG("Sticky worker queues created.");
+            }
+
+            // On shutdown, once the workers stopped consuming, the backlog still
+            // queued is flushed to the flood file instead of being drained, so the
+            // restart is fast and replay reinjects the events on the next start
+            if (!confManager.get<bool>(conf::key::QUEUE_DROP_ON_FLOOD)
+                && !confManager.get<std::string>(conf::key::QUEUE_FLOOD_FILE).empty())
+            {
+                exitHandler.add(
+                    [shedQueues]()
+                    {
+                        std::size_t flushed = 0;
+                        for (const auto& queue : shedQueues)
+                        {
+                            flushed += queue->flushToFlood();
+                        }
+                        if (flushed > 0)
+                        {
+                            LOG_INFO("Flushed {} queued event(s) to the flood file for replay on the next start.",
+                                     flushed);
+                        }
+                    });
+            }
+
+            // The KVDB handler set travels with the warm-state snapshot so a standby
+            // knows which databases the active environments hold open
+            std::vector<std::pair<std::string, std::function<json::Json()>>> stateProviders {
+                {"kvdb",
+                 [kvdbManager]() -> json::Json
+                 {
+                     json::Json section;
+                     section.setObject();
+                     for (const auto& [dbName, refInfo] : kvdbManager->getKVDBHandlersInfo())
+                     {
+                         for (const auto& [scope, count] : refInfo)
+                         {
+                             section.setInt64(count, std::string("/") + dbName + "/" + scope);
+                         }
+                     }
+                     return section;
+                 }}};
+
+            // Overload governor actuator: engaged halves the LOW lane watermark of
+            // every event queue so sheddable traffic is dropped earlier, disengaged
+            // restores the configured watermark
+            const auto shedLowLaneCapacity = std::max(1, confManager.get<int>(conf::key::QUEUE_SIZE) / 2);
+            const auto shedActuator = [shedQueues, lowLaneCapacity, shedLowLaneCapacity](bool engaged)
+            {
+                for (const auto& queue : shedQueues)
+                {
+                    queue->setLowLaneCapacity(engaged ? shedLowLaneCapacity : lowLaneCapacity);
+                }
+            };
+
             router::Orchestrator::Options config {.m_numThreads = confManager.get<int>(conf::key::ORCHESTRATOR_THREADS),
+                                                  .m_pinWorkers =
+                                                      confManager.get<bool>(conf::key::ORCHESTRATOR_PIN_WORKERS),
+                                                  .m_latencySampleEvery =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_LATENCY_SAMPLE),
                                                   .m_wStore = store,
                                                   .m_builder = builder,
-                                                  .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(),
+                                                  .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(
+                                                      confManager.get<bool>(conf::key::ORCHESTRATOR_COMPILED_EVAL)),
                                                   .m_prodQueue = eventQueue,
                                                   .m_testQueue = testQueue,
-                                                  .m_testTimeout = confManager.get<int>(conf::key::SERVER_API_TIMEOUT)};
+                                                  .m_workerQueues = workerQueues,
+                                                  .m_tenantKeyPath = tenantKey,
+                                                  .m_tenantWorkers = tenantWorkers,
+                                                  .m_testTimeout = confManager.get<int>(conf::key::SERVER_API_TIMEOUT),
+                                                  .m_snapshotInterval =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_SNAPSHOT_INTERVAL),
+                                                  .m_stateProviders = stateProviders,
+                                                  .m_governorInterval =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_GOVERNOR_INTERVAL),
+                                                  .m_governorShedEnter =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_GOVERNOR_SHED_ENTER),
+                                                  .m_governorShedExit =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_GOVERNOR_SHED_EXIT),
+                                                  .m_governorLimitEnter = confManager.get<int>(
+                                                      conf::key::ORCHESTRATOR_GOVERNOR_LIMIT_ENTER),
+                                                  .m_governorLimitExit =
+                                                      confManager.get<int>(conf::key::ORCHESTRATOR_GOVERNOR_LIMIT_EXIT),
+                                                  .m_shedActuator = shedActuator};
 
             orchestrator = std::make_shared<router::Orchestrator>(config);
             orchestrator->start();
@@ -412,7 +626,12 @@ int main(int argc, char* argv[])
 
         // Create and configure the api endpints
         {
-            apiServer = std::make_shared<httpsrv::Server>("API_SRV");
+            auto apiThreads = confManager.get<int>(conf::key::SERVER_API_THREADS);
+            if (apiThreads < 0)
+            {
+                throw std::runtime_error("API server thread count cannot be negative.");
+            }
+            apiServer = std::make_shared<httpsrv::Server>("API_SRV", static_cast<std::size_t>(apiThreads));
 
             // API
             exitHandler.add(
@@ -609,13 +828,114 @@ int main(int argc, char* argv[])
                                 });
             LOG_DEBUG("VD API endpoint registered.");
 
+            // Ingestion statistics: fold the per-request counters of both servers so
+            // network-, parse- and handler-bound stalls can be told apart without a
+            // capture session.
+            apiServer->addRoute(
+                httpsrv::Method::GET,
+                "/server/stats",
+                [weakApi = std::weak_ptr<httpsrv::Server>(apiServer)](const auto&, auto& res)
+                {
+                    auto setStats = [](json::Json& body, const std::string& prefix, const httpsrv::ServerStats& stats)
+                    {
+                        body.setInt64(static_cast<int64_t>(stats.requests), prefix + "/requests");
+                        body.setInt64(static_cast<int64_t>(stats.requestBytes), prefix + "/request_bytes");
+                        body.setInt64(static_cast<int64_t>(stats.status2xx), prefix + "/status_2xx");
+                        body.setInt64(static_cast<int64_t>(stats.status4xx), prefix + "/status_4xx");
+                        body.setInt64(static_cast<int64_t>(stats.status5xx), prefix + "/status_5xx");
+                        body.setInt64(static_cast<int64_t>(stats.handlerExceptions), prefix + "/handler_exceptions");
+                    };
+
+                    json::Json body;
+                    body.setObject();
+                    if (auto api = weakApi.lock())
+                    {
+                        setStats(body, "/api", api->stats());
+                    }
+                    if (auto engine = g_engineServer)
+                    {
+                        setStats(body, "/event", engine->stats());
+                    }
+                    res.set_content(body.str(), "application/json");
+                });
+            LOG_DEBUG("Server stats endpoint registered.");
+
             // Finally start the API server
             apiServer->start(confManager.get<std::string>(conf::key::SERVER_API_SOCKET));
         }
 
+        // Configuration hot-reload (SIGHUP)
+        {
+            // Runtime-tunable keys applied without restarting workers. Keys read once at
+            // startup (queue sizes, worker counts, sockets) still require a restart.
+            confManager.onChange(conf::key::ORCHESTRATOR_LATENCY_SAMPLE,
+                                 [&confManager, orchestrator]()
+                                 {
+                                     const auto every = confManager.get<int>(conf::key::ORCHESTRATOR_LATENCY_SAMPLE);
+                                     if (every >= 0)
+                                     {
+                                         orchestrator->setLatencySampleEvery(static_cast<uint64_t>(every));
+                                         LOG_INFO("Latency sampling stride changed to {}.", every);
+                                     }
+                                 });
+            confManager.onChange(conf::key::METRICS_ENABLED,
+                                 [&confManager]()
+                                 {
+                                     if (confManager.get<bool>(conf::key::METRICS_ENABLED))
+                                     {
+                                         SingletonLocator::instance<metrics::IManager>().enable();
+                                         LOG_INFO("Metrics enabled.");
+                                     }
+                                     else
+                                     {
+                                         SingletonLocator::instance<metrics::IManager>().disable();
+                                         LOG_INFO("Metrics disabled.");
+                                     }
+                                 });
+
+            // The signal handler only raises a flag; this thread performs the reload.
+            auto reloadStop = std::make_shared<std::atomic<bool>>(false);
+            auto reloadThread = std::make_shared<std::thread>(
+                [&confManager, reloadStop]()
+                {
+                    while (!reloadStop->load(std::memory_order_relaxed))
+                    {
+                        if (g_reloadRequested.exchange(false, std::memory_order_relaxed))
+                        {
+                            try
+                            {
+                                const auto changed = confManager.reload();
+                                LOG_INFO("Configuration reloaded, {} key(s) changed.", changed.size());
+                            }
+                            catch (const std::exception& e)
+                            {
+                                LOG_ERROR("Configuration reload failed, previous settings kept: {}", e.what());
+                            }
+                        }
+                        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+                    }
+                });
+            // Independent of the API server stop registered before it, so both
+            // teardowns overlap within the shutdown deadline
+            exitHandler.addParallel(
+                [reloadStop, reloadThread]()
+                {
+                    reloadStop->store(true, std::memory_order_relaxed);
+                    if (reloadThread->joinable())
+                    {
+                        reloadThread->join();
+                    }
+                });
+        }
+
         // Server
         {
-            g_engineServer = std::make_shared<httpsrv::Server>("EVENT_SRV");
+            auto eventThreads = confManager.get<int>(conf::key::SERVER_EVENT_THREADS);
+            if (eventThreads < 0)
+            {
+                throw std::runtime_error("Event server thread count cannot be negative.");
+            }
+            g_engineServer = std::make_shared<httpsrv::Server>("EVENT_SRV", static_cast<std::size_t>(eventThreads));
 
             // clang-format off
             /**
@@ -684,10 +1004,41 @@ int main(int argc, char* argv[])
              *     }
              */
             // clang-format on
-            g_engineServer->addRoute(
-                httpsrv::Method::POST,
-                "/events/stateless",
-                api::event::handlers::pushEvent(orchestrator, api::event::protocol::getNDJsonParser()));
+            // Streamed body: events are parsed and posted while the batch is still
+            // being received, bounding buffer memory to one line. Event documents are
+            // recycled through a pool sized to the event queue, so steady-state
+            // turnover reuses acked slabs instead of the heap.
+            auto eventPool = std::make_shared<base::queue::EventPool>(confManager.get<int>(conf::key::QUEUE_SIZE),
+                                                                      "eventPool");
+            g_engineServer->addStreamRoute(httpsrv::Method::POST,
+                                           "/events/stateless",
+                                           api::event::handlers::pushEventStream(
+                                               orchestrator,
+                                               [eventPool](std::string_view event)
+                                               { return eventPool->acquire(event); }));
+
+            // Persistent framed-stream ingestion on a dedicated socket: long-lived
+            // connections carrying length-prefixed NDJSON frames, no HTTP parsing per
+            // batch. The HTTP endpoint above stays for compatibility.
+            g_eventStreamServer = std::make_shared<httpsrv::FramedServer>(
+                "EVENT_STREAM_SRV",
+                api::event::handlers::pushEventFramed(orchestrator,
+                                                      [eventPool](std::string_view event)
+                                                      { return eventPool->acquire(event); }));
+            g_eventStreamServer->start(confManager.get<std::string>(conf::key::SERVER_EVENT_STREAM_SOCKET));
+        }
+
+        // Metrics exporters are non-critical: they are started last, once the event
+        // endpoint is wired, so they never delay the data path coming up.
+        if (confManager.get<bool>(conf::key::METRICS_ENABLED))
+        {
+            SingletonLocator::instance<metrics::IManager>().enable();
+            LOG_INFO("Metrics enabled.");
+        }
+        else
+        {
+            SingletonLocator::instance<metrics::IManager>().disable();
+            LOG_INFO("Metrics disabled.");
         }
     }
     catch (const std::exception& e)
@@ -709,6 +1060,6 @@ int main(int argc, char* argv[])
         LOG_ERROR("An error occurred while running the server: {}.", utils::getExceptionStack(e));
     }
 
-    // Clean exit
-    exitHandler.execute();
+    // Clean exit, bounded so a wedged handler cannot hold the restart hostage
+    exitHandler.execute(std::chrono::milliseconds(confManager.get<int>(conf::key::SHUTDOWN_TIMEOUT)));
 }
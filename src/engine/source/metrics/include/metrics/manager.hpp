@@ -3,11 +3,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include <base/logging.hpp>
@@ -27,6 +29,8 @@ public:
             : indexerConnectorFactory(nullptr)
             , exportInterval(1000)
             , exportTimeout(333)
+            , foldInterval(10)
+            , sampleEvery(1)
             , logLevel(logging::Level::Err)
         {
         }
@@ -41,6 +45,8 @@ public:
         std::function<std::shared_ptr<IIndexerConnector>()> indexerConnectorFactory;
         std::chrono::milliseconds exportInterval;
         std::chrono::milliseconds exportTimeout;
+        std::chrono::milliseconds foldInterval; ///< Period of the thread folding buffered updates into OT.
+        uint32_t sampleEvery;                   ///< Record one of every N samples on histogram metrics.
         logging::Level logLevel;
     };
 
@@ -49,9 +55,17 @@ private:
     std::unordered_map<DotPath, std::shared_ptr<detail::IManagedMetric>> m_metrics;
     mutable std::shared_mutex m_mutex;
     bool m_enabled;
+    std::thread m_foldThread;
+    std::mutex m_foldMutex;
+    std::condition_variable m_foldCv;
+    std::atomic<bool> m_foldStop;
 
     bool unsafeEnabled() const;
 
+    void startFoldThread();
+
+    void stopFoldThread();
+
     void validateConfig(const std::shared_ptr<ImplConfig>& config);
 
     void unsafeConfigure(const std::shared_ptr<Config>& config);
@@ -71,7 +85,7 @@ public:
     Manager& operator=(const Manager&) = delete;
     Manager& operator=(Manager&&) = delete;
 
-    ~Manager() override = default;
+    ~Manager() override;
 
     void configure(const std::shared_ptr<Config>& config) override;
 
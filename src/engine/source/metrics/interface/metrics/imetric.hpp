@@ -9,6 +9,7 @@
 #ifndef _METRICS_IMETRIC_HPP
 #define _METRICS_IMETRIC_HPP
 
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -124,6 +125,22 @@ public:
      * @return false If the metric is disabled.
      */
     virtual bool isEnabled() const = 0;
+
+    /**
+     * @brief Fold the updates buffered on the hot path into the underlying instrument.
+     * Called periodically by the manager's fold thread.
+     *
+     */
+    virtual void fold() = 0;
+
+    /**
+     * @brief Record only one of every \p everyN updates on metrics that record individual
+     * samples (histograms). Metrics whose updates are summed into the buffered layer are
+     * not affected.
+     *
+     * @param everyN Sampling rate, 1 records every update.
+     */
+    virtual void setSampleEvery(uint32_t everyN) = 0;
 };
 
 /**
@@ -1,6 +1,7 @@
 #include "indexerMetricsExporter.hpp"
 
 #include <stdexcept>
+#include <vector>
 
 #include <base/logging.hpp>
 #include <base/utils/timeUtils.hpp>
@@ -16,29 +17,67 @@ otsdk::ExportResult IndexerMetricsExporter::Export(const otsdk::ResourceMetrics&
 {
     try
     {
+        // Documents are built first and published in one batch at the end, so a cycle
+        // where nothing changed issues no writes at all
+        std::vector<std::string> documents;
 
         for (const auto& record : data.scope_metric_data_)
         {
+            auto& scopeCache = m_scopeCache[record.scope_->GetName()];
+            if (scopeCache.scope.isNull())
+            {
+                scopeCache.scope = details::scopeToJson(*record.scope_);
+            }
+
             json::Json jsonMessage;
             jsonMessage.setString("ADD", "/operation");
+            jsonMessage.set("/data", scopeCache.scope);
 
-            jsonMessage.set("/data", details::scopeToJson(*record.scope_));
+            bool changed {false};
             for (const auto& metric : record.metric_data_)
             {
-                auto metricJson = details::metricDataToJson(metric);
+                auto& metricCache = scopeCache.metrics[metric.instrument_descriptor.name_];
+                if (metricCache.descriptor.isNull())
+                {
+                    metricCache.descriptor = details::metricDataToJson(metric);
+                }
+
+                json::Json pointsJson;
+                pointsJson.setArray();
                 for (const auto& point : metric.point_data_attr_)
                 {
-                    auto pointDataJson = details::pointDataToJson(point.point_data);
-                    metricJson.appendJson(pointDataJson, "/points");
+                    pointsJson.appendJson(details::pointDataToJson(point.point_data));
+                }
+
+                // Skip instruments whose points did not change since the previous cycle
+                auto points = pointsJson.str();
+                if (points == metricCache.lastPoints)
+                {
+                    continue;
                 }
+                metricCache.lastPoints = std::move(points);
+                changed = true;
+
+                json::Json metricJson {metricCache.descriptor};
+                metricJson.set("/points", pointsJson);
                 jsonMessage.appendJson(metricJson, "/data/metrics");
             }
 
+            if (!changed)
+            {
+                continue;
+            }
+
             const auto timestamp = base::utils::time::getCurrentISO8601();
             jsonMessage.setString(timestamp, "/data/timestamp");
+            documents.emplace_back(jsonMessage.str());
+        }
 
-            this->m_indexerConnector->publish(jsonMessage.str());
+        for (const auto& document : documents)
+        {
+            this->m_indexerConnector->publish(document);
         }
+
         return otsdk::ExportResult::kSuccess;
     }
     catch (const std::exception& e)
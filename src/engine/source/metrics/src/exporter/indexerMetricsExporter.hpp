@@ -3,6 +3,8 @@
 
 #include <memory>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 
 #include <base/json.hpp>
 #include <indexerConnector/iindexerconnector.hpp>
@@ -18,7 +20,28 @@ namespace metrics
 class IndexerMetricsExporter final : public otsdk::PushMetricExporter
 {
 private:
+    /**
+     * @brief Cache of an instrument between export cycles.
+     *
+     */
+    struct MetricCache
+    {
+        json::Json descriptor;  ///< Serialized instrument descriptor, stable across cycles.
+        std::string lastPoints; ///< Points of the previous cycle, to skip unchanged instruments.
+    };
+
+    /**
+     * @brief Cache of a scope between export cycles, with its instruments keyed by name.
+     *
+     */
+    struct ScopeCache
+    {
+        json::Json scope;                                    ///< Serialized scope, stable across cycles.
+        std::unordered_map<std::string, MetricCache> metrics; ///< Instrument caches keyed by name.
+    };
+
     std::shared_ptr<IIndexerConnector> m_indexerConnector;
+    std::unordered_map<std::string, ScopeCache> m_scopeCache; ///< Scope caches keyed by scope name.
 
 public:
     ~IndexerMetricsExporter() override = default;
@@ -40,6 +63,13 @@ public:
     /**
      * Exports a batch of metrics data. This method must not be called
      * concurrently for the same exporter instance.
+     *
+     * The export is delta aware: instruments whose points did not change since the
+     * previous cycle are skipped, scopes where nothing changed are not published at
+     * all, and the stable parts of each document are serialized only once. The
+     * documents of a cycle are built first and pushed to the connector in one batch
+     * at the end.
+     *
      * @param data metrics data
      */
     otsdk::ExportResult Export(const otsdk::ResourceMetrics& data) noexcept override;
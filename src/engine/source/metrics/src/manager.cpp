@@ -55,6 +55,7 @@ namespace metrics
 Manager::Manager()
     : m_config(std::make_unique<ImplConfig>())
     , m_enabled(false)
+    , m_foldStop(false)
 {
     std::call_once(LOGGER_FLAG,
                    [level = m_config->logLevel]()
@@ -65,11 +66,61 @@ Manager::Manager()
                    });
 }
 
+Manager::~Manager()
+{
+    stopFoldThread();
+}
+
 bool Manager::unsafeEnabled() const
 {
     return m_enabled;
 }
 
+void Manager::startFoldThread()
+{
+    m_foldStop.store(false);
+    m_foldThread = std::thread(
+        [this, interval = m_config->foldInterval]()
+        {
+            while (!m_foldStop.load())
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_foldMutex);
+                    m_foldCv.wait_for(lock, interval, [this]() { return m_foldStop.load(); });
+                }
+
+                if (m_foldStop.load())
+                {
+                    break;
+                }
+
+                // Never block on the manager mutex: disable() joins this thread while
+                // holding it exclusively, a blocking lock here would deadlock. Skipping
+                // a cycle while the manager is busy is harmless.
+                std::shared_lock<std::shared_mutex> lock(m_mutex, std::try_to_lock);
+                if (!lock.owns_lock())
+                {
+                    continue;
+                }
+
+                for (const auto& [name, metric] : m_metrics)
+                {
+                    metric->fold();
+                }
+            }
+        });
+}
+
+void Manager::stopFoldThread()
+{
+    m_foldStop.store(true);
+    m_foldCv.notify_all();
+    if (m_foldThread.joinable())
+    {
+        m_foldThread.join();
+    }
+}
+
 void Manager::validateConfig(const std::shared_ptr<ImplConfig>& config)
 {
     if (!config->indexerConnectorFactory)
@@ -92,6 +143,16 @@ void Manager::validateConfig(const std::shared_ptr<ImplConfig>& config)
         throw std::runtime_error("Export timeout must be less than export interval");
     }
 
+    if (config->foldInterval.count() <= 0)
+    {
+        throw std::runtime_error("Fold interval must be greater than zero");
+    }
+
+    if (config->sampleEvery == 0)
+    {
+        throw std::runtime_error("Sample rate must be greater than zero");
+    }
+
     if (config->logLevel != logging::Level::Warn && config->logLevel != logging::Level::Err
         && config->logLevel != logging::Level::Info && config->logLevel != logging::Level::Debug)
     {
@@ -145,6 +206,7 @@ void Manager::unsafeCreateOtPipeline()
     // Create all metrics
     for (const auto& [name, metric] : m_metrics)
     {
+        metric->setSampleEvery(m_config->sampleEvery);
         metric->create();
     }
 }
@@ -179,6 +241,8 @@ void Manager::unsafeEnable()
         throw;
     }
 
+    startFoldThread();
+
     m_enabled = true;
 
     LOG_INFO("Metrics pipeline enabled successfully");
@@ -188,6 +252,8 @@ void Manager::unsafeDisable()
 {
     if (unsafeEnabled())
     {
+        // Stop folding first so that destroy() drains the pending updates exactly once.
+        stopFoldThread();
         unsafeDestroyOtPipeline();
         LOG_INFO("Metrics pipeline disabled successfully");
         m_enabled = false;
@@ -224,6 +290,7 @@ Manager::addMetric(MetricType metricType, const DotPath& name, const std::string
 
     if (unsafeEnabled())
     {
+        it->second->setSampleEvery(m_config->sampleEvery);
         it->second->create();
     }
 
@@ -38,6 +38,9 @@ public:
 
     void otDestroy() override { m_histogram.reset(); }
 
+    // Histograms record individual samples, they cannot be folded as a sum.
+    bool otSummable() const override { return false; }
+
     void otUpdate(double value) override
     {
         if (m_histogram)
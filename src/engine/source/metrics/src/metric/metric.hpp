@@ -1,6 +1,7 @@
 #ifndef _METRIC_METRIC_HPP
 #define _METRIC_METRIC_HPP
 
+#include <array>
 #include <atomic>
 #include <mutex>
 #include <shared_mutex>
@@ -10,20 +11,41 @@
 namespace metrics
 {
 
+// Number of update shards per metric. Calling threads are spread over the shards so that
+// concurrent updates on the hot path do not contend on a single cache line.
+constexpr size_t METRIC_UPDATE_SHARDS = 16;
+
 /**
  * @brief Base metric interface.
  *
+ * Updates are not forwarded to the OpenTelemetry instrument one by one. Summable metrics
+ * (counters) accumulate into per-thread shards with relaxed atomics and the pending sum
+ * is folded into the instrument periodically by the manager's fold thread, so updating a
+ * metric on the event path costs a single relaxed add. Metrics that record individual
+ * samples (histograms) go through the instrument directly, optionally subsampled.
+ *
  * @tparam T Type of the value to update the metric with.
  */
 template<typename T>
 class BaseOtMetric : public detail::BaseMetric<T>
 {
 protected:
+    /**
+     * @brief Cache-line sized accumulator written with relaxed atomics on the hot path.
+     */
+    struct alignas(64) Shard
+    {
+        std::atomic<T> pending {};     ///< Sum of the updates not yet folded.
+        std::atomic<uint64_t> ticks {0}; ///< Update counter, drives the sampling decision.
+    };
+
     std::shared_mutex m_mutex;
     std::atomic_bool m_enabled;
     std::string m_name;
     std::string m_description;
     std::string m_unit;
+    std::array<Shard, METRIC_UPDATE_SHARDS> m_shards;
+    std::atomic<uint32_t> m_sampleEvery;
 
     BaseOtMetric(std::string&& name, std::string&& description, std::string&& unit)
         : m_enabled(true)
@@ -31,6 +53,8 @@ protected:
         , m_description(std::move(description))
         , m_unit(std::move(unit))
         , m_mutex()
+        , m_shards()
+        , m_sampleEvery(1)
     {
     }
 
@@ -46,6 +70,57 @@ protected:
 
     virtual void otDestroy() = 0;
 
+    /**
+     * @brief Whether updates can be summed into the shards and folded later. Counters
+     * are summable, histograms record individual samples and must override to false.
+     */
+    virtual bool otSummable() const { return true; }
+
+    /**
+     * @brief Index of the shard assigned to the calling thread.
+     */
+    static size_t shardIndex()
+    {
+        static std::atomic<size_t> nextShard {0};
+        thread_local const auto index = nextShard.fetch_add(1, std::memory_order_relaxed) % METRIC_UPDATE_SHARDS;
+        return index;
+    }
+
+    /**
+     * @brief Relaxed atomic add, CAS based for floating point types.
+     */
+    static void shardAdd(std::atomic<T>& target, T value)
+    {
+        if constexpr (std::is_integral_v<T>)
+        {
+            target.fetch_add(value, std::memory_order_relaxed);
+        }
+        else
+        {
+            auto current = target.load(std::memory_order_relaxed);
+            while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    /**
+     * @brief Drains the shards into the instrument. The caller must hold m_mutex.
+     */
+    void unsafeFold()
+    {
+        T total {};
+        for (auto& shard : m_shards)
+        {
+            total += shard.pending.exchange(T {}, std::memory_order_relaxed);
+        }
+
+        if (total != T {})
+        {
+            otUpdate(total);
+        }
+    }
+
 public:
     static_assert(std::is_arithmetic_v<T>, "BaseMetric type must be arithmetic");
     static_assert(std::is_same_v<T, uint64_t> || std::is_same_v<T, double> || std::is_same_v<T, int64_t>,
@@ -68,16 +143,44 @@ public:
     void destroy() override
     {
         std::unique_lock<std::shared_mutex> lock(m_mutex);
+        // Publish whatever is pending before the instrument goes away.
+        unsafeFold();
         otDestroy();
     }
 
+    void fold() override
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        unsafeFold();
+    }
+
+    void setSampleEvery(uint32_t everyN) override
+    {
+        m_sampleEvery.store(everyN == 0 ? 1 : everyN, std::memory_order_relaxed);
+    }
+
     void update(T value)
     {
-        if (isEnabled())
+        if (!isEnabled())
+        {
+            return;
+        }
+
+        if (otSummable())
         {
-            std::shared_lock<std::shared_mutex> lock(m_mutex);
-            otUpdate(value);
+            // Hot path: a relaxed add on the calling thread's shard, folded later.
+            shardAdd(m_shards[shardIndex()].pending, value);
+            return;
         }
+
+        const auto every = m_sampleEvery.load(std::memory_order_relaxed);
+        if (every > 1 && m_shards[shardIndex()].ticks.fetch_add(1, std::memory_order_relaxed) % every != 0)
+        {
+            return;
+        }
+
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        otUpdate(value);
     }
 };
 
@@ -18,6 +18,8 @@ public:
     MOCK_METHOD(void, enable, (), (override));
     MOCK_METHOD(void, disable, (), (override));
     MOCK_METHOD(bool, isEnabled, (), (const, override));
+    MOCK_METHOD(void, fold, (), (override));
+    MOCK_METHOD(void, setSampleEvery, (uint32_t everyN), (override));
 };
 
 } // namespace metrics::mocks
@@ -15,6 +15,8 @@ public:
     void enable() override {}
     void disable() override {}
     bool isEnabled() const override { return false; }
+    void fold() override {}
+    void setSampleEvery(uint32_t everyN) override {}
 };
 
 class NoOpDoubleMetric : public detail::BaseMetric<double>
@@ -26,6 +28,8 @@ public:
     void enable() override {}
     void disable() override {}
     bool isEnabled() const override { return false; }
+    void fold() override {}
+    void setSampleEvery(uint32_t everyN) override {}
 };
 
 class NoOpIntMetric : public detail::BaseMetric<int64_t>
@@ -37,6 +41,8 @@ public:
     void enable() override {}
     void disable() override {}
     bool isEnabled() const override { return false; }
+    void fold() override {}
+    void setSampleEvery(uint32_t everyN) override {}
 };
 } // namespace metrics::mocks
 
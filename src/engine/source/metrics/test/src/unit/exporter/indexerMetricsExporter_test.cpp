@@ -418,4 +418,31 @@ INSTANTIATE_TEST_SUITE_P(
                     return None {};
                 }))));
 
+TEST(IndexerMetricsExporterDelta, UnchangedInstrumentsAreSkipped)
+{
+    auto indexerConnector = std::make_shared<indexerconnector::mocks::MockIConnector>();
+
+    auto exporter = std::make_unique<metrics::IndexerMetricsExporter>(indexerConnector);
+    auto readerOptions = opentelemetry::sdk::metrics::PeriodicExportingMetricReaderOptions();
+    readerOptions.export_interval_millis = std::chrono::milliseconds(200);
+    readerOptions.export_timeout_millis = std::chrono::milliseconds(100);
+    auto reader = std::make_shared<otsdk::PeriodicExportingMetricReader>(
+        std::unique_ptr<otsdk::PushMetricExporter>(std::move(exporter)), readerOptions);
+    auto provider = std::make_shared<otsdk::MeterProvider>();
+    provider->AddMetricReader(reader);
+
+    // One publish per change of the counter, no matter how many cycles run in between
+    EXPECT_CALL(*indexerConnector, publish(testing::_)).Times(2);
+
+    auto meter = provider->GetMeter("test");
+    auto counter = meter->CreateUInt64Counter("counter");
+    auto context = otapi::RuntimeContext::GetCurrent();
+
+    counter->Add(1, context);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+
+    counter->Add(1, context);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+}
+
 } // namespace exporttest
@@ -242,6 +242,24 @@ Result<T> makeError(std::string&& error, size_t index, Trace::nestedTracesT&& in
                       Trace {false, index, std::make_optional<std::string>(std::move(error)), std::move(innerTrace)}};
 }
 
+/**
+ * @brief Build the nested traces of a combinator step by moving the child traces.
+ *
+ * Brace-initializing the nested vector copies every child trace tree, which
+ * made each combinator step O(subtree) in allocations; moving keeps it O(1).
+ *
+ * @param traces child traces, consumed
+ * @return Trace::nestedTracesT vector owning the moved traces
+ */
+template<typename... Traces>
+Trace::nestedTracesT nest(Traces&&... traces)
+{
+    std::vector<Trace> nested;
+    nested.reserve(sizeof...(Traces));
+    (nested.emplace_back(std::forward<Traces>(traces)), ...);
+    return std::make_optional(std::move(nested));
+}
+
 inline const Trace& firstError(const Trace& trace)
 {
     if (trace.innerTraces().has_value())
@@ -393,11 +411,11 @@ Parser<T> opt(const Parser<T>& p)
         auto res = p(s, i);
         if (res.success())
         {
-            return makeSuccess<T>(res.value(), res.index(), "OPT(P), P failed", {{res.trace()}});
+            return makeSuccess<T>(res.value(), res.index(), "OPT(P), P failed", nest(res.trace()));
         }
         else
         {
-            return makeSuccess<T>({}, i, "OPT(P), P succeeded", {{res.trace()}});
+            return makeSuccess<T>({}, i, "OPT(P), P succeeded", nest(res.trace()));
         }
     };
 }
@@ -418,11 +436,11 @@ Parser<T> negativeLook(const Parser<T>& p)
         auto res = p(s, i);
         if (res.success())
         {
-            return makeError<T>("NEG(P), P succeeded", res.index(), {{res.trace()}});
+            return makeError<T>("NEG(P), P succeeded", res.index(), nest(res.trace()));
         }
         else
         {
-            return makeSuccess<T>({}, i, "NEG(P), P failed", {{res.trace()}});
+            return makeSuccess<T>({}, i, "NEG(P), P failed", nest(res.trace()));
         }
     };
 }
@@ -443,11 +461,11 @@ Parser<T> positiveLook(const Parser<T>& p)
         auto res = p(s, i);
         if (res.success())
         {
-            return makeSuccess<T>({}, i, "POS(P), P succeeded", {{res.trace()}});
+            return makeSuccess<T>({}, i, "POS(P), P succeeded", nest(res.trace()));
         }
         else
         {
-            return makeError<T>("POS(P), P failed", res.index(), {{res.trace()}});
+            return makeError<T>("POS(P), P failed", res.index(), nest(res.trace()));
         }
     };
 }
@@ -470,16 +488,16 @@ Parser<L> operator<<(const Parser<L>& l, const Parser<R>& r)
         auto resL = l(s, i);
         if (resL.failure())
         {
-            return makeError<L>("L<<R, L failed", resL.index(), {{resL.trace()}});
+            return makeError<L>("L<<R, L failed", resL.index(), nest(resL.trace()));
         }
 
         auto resR = r(s, resL.index());
         if (resR.failure())
         {
-            return makeError<L>("L<<R, R failed", resR.index(), {{resL.trace(), resR.trace()}});
+            return makeError<L>("L<<R, R failed", resR.index(), nest(resL.trace(), resR.trace()));
         }
 
-        return makeSuccess(resL.value(), resR.index(), "L<<R, succeeded", {{resL.trace(), resR.trace()}});
+        return makeSuccess(resL.value(), resR.index(), "L<<R, succeeded", nest(resL.trace(), resR.trace()));
     };
 
     return fn;
@@ -503,16 +521,16 @@ Parser<R> operator>>(const Parser<L>& l, const Parser<R>& r)
         auto resL = l(s, i);
         if (resL.failure())
         {
-            return makeError<R>("L>>R, L failed", resL.index(), {{resL.trace()}});
+            return makeError<R>("L>>R, L failed", resL.index(), nest(resL.trace()));
         }
 
         auto resR = r(s, resL.index());
         if (resR.failure())
         {
-            return makeError<R>("L>>R, R failed", resR.index(), {{resL.trace(), resR.trace()}});
+            return makeError<R>("L>>R, R failed", resR.index(), nest(resL.trace(), resR.trace()));
         }
 
-        return makeSuccess(resR.value(), resR.index(), "L>>R, succeeded", {{resL.trace(), resR.trace()}});
+        return makeSuccess(resR.value(), resR.index(), "L>>R, succeeded", nest(resL.trace(), resR.trace()));
     };
 
     return fn;
@@ -535,16 +553,16 @@ Parser<T> operator|(const Parser<T>& l, const Parser<T>& r)
         auto resL = l(s, i);
         if (resL.success())
         {
-            return makeSuccess<T>(resL.value(), resL.index(), "L|R, L succeeded", {{resL.trace()}});
+            return makeSuccess<T>(resL.value(), resL.index(), "L|R, L succeeded", nest(resL.trace()));
         }
 
         auto resR = r(s, i);
         if (resR.success())
         {
-            return makeSuccess<T>(resR.value(), resR.index(), "L|R, R succeeded", {{resL.trace(), resR.trace()}});
+            return makeSuccess<T>(resR.value(), resR.index(), "L|R, R succeeded", nest(resL.trace(), resR.trace()));
         }
 
-        return makeError<T>("L|R, both failed", i, {{resL.trace(), resR.trace()}});
+        return makeError<T>("L|R, both failed", i, nest(resL.trace(), resR.trace()));
     };
 }
 
@@ -566,18 +584,18 @@ Parser<std::tuple<L, R>> operator&(const Parser<L>& l, const Parser<R>& r)
         auto resL = l(s, i);
         if (resL.failure())
         {
-            return makeError<std::tuple<L, R>>("L&R, L failed", resL.index(), {{resL.trace()}});
+            return makeError<std::tuple<L, R>>("L&R, L failed", resL.index(), nest(resL.trace()));
         }
         auto resR = r(s, resL.index());
         if (resR.failure())
         {
-            return makeError<std::tuple<L, R>>("L&R, R failed", resR.index(), {{resL.trace(), resR.trace()}});
+            return makeError<std::tuple<L, R>>("L&R, R failed", resR.index(), nest(resL.trace(), resR.trace()));
         }
 
         return makeSuccess<std::tuple<L, R>>(std::make_tuple(resL.value(), resR.value()),
                                              resR.index(),
                                              "L&R, succeeded",
-                                             {{resL.trace(), resR.trace()}});
+                                             nest(resL.trace(), resR.trace()));
     };
 }
 
@@ -600,9 +618,9 @@ Parser<Tx> fmap(std::function<Tx(T)> f, const Parser<T>& p)
         auto res = p(s, i);
         if (res.failure())
         {
-            return makeError<Tx>("FMAP(P), P failed", res.index(), {{res.trace()}});
+            return makeError<Tx>("FMAP(P), P failed", res.index(), nest(res.trace()));
         }
-        return makeSuccess<Tx>(f(res.value()), res.index(), "FMAP(P), P succeeded", {{res.trace()}});
+        return makeSuccess<Tx>(f(res.value()), res.index(), "FMAP(P), P succeeded", nest(res.trace()));
     };
 }
 
@@ -629,17 +647,17 @@ Parser<Tx> operator>>=(const Parser<T>& p, M<Tx, T> f)
         auto res = p(s, i);
         if (res.failure())
         {
-            return makeError<Tx>("P>>=M, P failed", res.index(), {{res.trace()}});
+            return makeError<Tx>("P>>=M, P failed", res.index(), nest(res.trace()));
         }
 
         auto newParser = f(res.value());
         auto res2 = newParser(s, res.index());
         if (res2.failure())
         {
-            return makeError<Tx>("P>>=M, M failed", res2.index(), {{res.trace(), res2.trace()}});
+            return makeError<Tx>("P>>=M, M failed", res2.index(), nest(res.trace(), res2.trace()));
         }
 
-        return makeSuccess<Tx>(res2.value(), res2.index(), "P>>=M, succeeded", {{res.trace(), res2.trace()}});
+        return makeSuccess<Tx>(res2.value(), res2.index(), "P>>=M, succeeded", nest(res.trace(), res2.trace()));
     };
 }
 
@@ -702,7 +720,7 @@ Parser<Values<T>> many1(const Parser<T>& p)
         auto firstRes = p(s, i);
         if (firstRes.failure())
         {
-            return makeError<Values<T>>("MANY1(P), P failed", firstRes.index(), {{firstRes.trace()}});
+            return makeError<Values<T>>("MANY1(P), P failed", firstRes.index(), nest(firstRes.trace()));
         }
 
         Values<T> values {firstRes.value()};
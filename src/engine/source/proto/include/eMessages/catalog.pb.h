@@ -67,12 +67,21 @@ extern ResourceGet_RequestDefaultTypeInternal _ResourceGet_Request_default_insta
 class ResourceGet_Response;
 struct ResourceGet_ResponseDefaultTypeInternal;
 extern ResourceGet_ResponseDefaultTypeInternal _ResourceGet_Response_default_instance_;
+class ResourceList_Request;
+struct ResourceList_RequestDefaultTypeInternal;
+extern ResourceList_RequestDefaultTypeInternal _ResourceList_Request_default_instance_;
+class ResourceList_Response;
+struct ResourceList_ResponseDefaultTypeInternal;
+extern ResourceList_ResponseDefaultTypeInternal _ResourceList_Response_default_instance_;
 class ResourcePost_Request;
 struct ResourcePost_RequestDefaultTypeInternal;
 extern ResourcePost_RequestDefaultTypeInternal _ResourcePost_Request_default_instance_;
 class ResourcePut_Request;
 struct ResourcePut_RequestDefaultTypeInternal;
 extern ResourcePut_RequestDefaultTypeInternal _ResourcePut_Request_default_instance_;
+class ResourceSummary;
+struct ResourceSummaryDefaultTypeInternal;
+extern ResourceSummaryDefaultTypeInternal _ResourceSummary_default_instance_;
 class ResourceValidate_Request;
 struct ResourceValidate_RequestDefaultTypeInternal;
 extern ResourceValidate_RequestDefaultTypeInternal _ResourceValidate_Request_default_instance_;
@@ -87,8 +96,11 @@ template<> ::com::wazuh::api::engine::catalog::NamespacesGet_Response* Arena::Cr
 template<> ::com::wazuh::api::engine::catalog::ResourceDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceDelete_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourceList_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceList_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourceList_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceList_Response>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourcePost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcePost_Request>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourcePut_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourcePut_Request>(Arena*);
+template<> ::com::wazuh::api::engine::catalog::ResourceSummary* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceSummary>(Arena*);
 template<> ::com::wazuh::api::engine::catalog::ResourceValidate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::catalog::ResourceValidate_Request>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace com {
@@ -1350,23 +1362,24 @@ class ResourceValidate_Request final :
 };
 // -------------------------------------------------------------------
 
-class NamespacesGet_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.NamespacesGet_Request) */ {
+class ResourceSummary final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceSummary) */ {
  public:
-  inline NamespacesGet_Request() : NamespacesGet_Request(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR NamespacesGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ResourceSummary() : ResourceSummary(nullptr) {}
+  ~ResourceSummary() override;
+  explicit PROTOBUF_CONSTEXPR ResourceSummary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NamespacesGet_Request(const NamespacesGet_Request& from);
-  NamespacesGet_Request(NamespacesGet_Request&& from) noexcept
-    : NamespacesGet_Request() {
+  ResourceSummary(const ResourceSummary& from);
+  ResourceSummary(ResourceSummary&& from) noexcept
+    : ResourceSummary() {
     *this = ::std::move(from);
   }
 
-  inline NamespacesGet_Request& operator=(const NamespacesGet_Request& from) {
+  inline ResourceSummary& operator=(const ResourceSummary& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NamespacesGet_Request& operator=(NamespacesGet_Request&& from) noexcept {
+  inline ResourceSummary& operator=(ResourceSummary&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1389,20 +1402,20 @@ class NamespacesGet_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const NamespacesGet_Request& default_instance() {
+  static const ResourceSummary& default_instance() {
     return *internal_default_instance();
   }
-  static inline const NamespacesGet_Request* internal_default_instance() {
-    return reinterpret_cast<const NamespacesGet_Request*>(
-               &_NamespacesGet_Request_default_instance_);
+  static inline const ResourceSummary* internal_default_instance() {
+    return reinterpret_cast<const ResourceSummary*>(
+               &_ResourceSummary_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     6;
 
-  friend void swap(NamespacesGet_Request& a, NamespacesGet_Request& b) {
+  friend void swap(ResourceSummary& a, ResourceSummary& b) {
     a.Swap(&b);
   }
-  inline void Swap(NamespacesGet_Request* other) {
+  inline void Swap(ResourceSummary* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1415,7 +1428,7 @@ class NamespacesGet_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(NamespacesGet_Request* other) {
+  void UnsafeArenaSwap(ResourceSummary* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1423,26 +1436,40 @@ class NamespacesGet_Request final :
 
   // implements Message ----------------------------------------------
 
-  NamespacesGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<NamespacesGet_Request>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const NamespacesGet_Request& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  ResourceSummary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceSummary>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const NamespacesGet_Request& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceSummary& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceSummary& from) {
+    ResourceSummary::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourceSummary* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.catalog.NamespacesGet_Request";
+    return "com.wazuh.api.engine.catalog.ResourceSummary";
   }
   protected:
-  explicit NamespacesGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ResourceSummary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1455,7 +1482,61 @@ class NamespacesGet_Request final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.NamespacesGet_Request)
+  enum : int {
+    kNameFieldNumber = 1,
+    kTitleFieldNumber = 3,
+    kTypeFieldNumber = 2,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string title = 3;
+  bool has_title() const;
+  private:
+  bool _internal_has_title() const;
+  public:
+  void clear_title();
+  const std::string& title() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_title(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_title();
+  PROTOBUF_NODISCARD std::string* release_title();
+  void set_allocated_title(std::string* title);
+  private:
+  const std::string& _internal_title() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_title(const std::string& value);
+  std::string* _internal_mutable_title();
+  public:
+
+  // optional .com.wazuh.api.engine.catalog.ResourceType type = 2;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::com::wazuh::api::engine::catalog::ResourceType type() const;
+  void set_type(::com::wazuh::api::engine::catalog::ResourceType value);
+  private:
+  ::com::wazuh::api::engine::catalog::ResourceType _internal_type() const;
+  void _internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourceSummary)
  private:
   class _Internal;
 
@@ -1463,29 +1544,35 @@ class NamespacesGet_Request final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr title_;
+    int type_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_catalog_2eproto;
 };
 // -------------------------------------------------------------------
 
-class NamespacesGet_Response final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.NamespacesGet_Response) */ {
+class ResourceList_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceList_Request) */ {
  public:
-  inline NamespacesGet_Response() : NamespacesGet_Response(nullptr) {}
-  ~NamespacesGet_Response() override;
-  explicit PROTOBUF_CONSTEXPR NamespacesGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ResourceList_Request() : ResourceList_Request(nullptr) {}
+  ~ResourceList_Request() override;
+  explicit PROTOBUF_CONSTEXPR ResourceList_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  NamespacesGet_Response(const NamespacesGet_Response& from);
-  NamespacesGet_Response(NamespacesGet_Response&& from) noexcept
-    : NamespacesGet_Response() {
+  ResourceList_Request(const ResourceList_Request& from);
+  ResourceList_Request(ResourceList_Request&& from) noexcept
+    : ResourceList_Request() {
     *this = ::std::move(from);
   }
 
-  inline NamespacesGet_Response& operator=(const NamespacesGet_Response& from) {
+  inline ResourceList_Request& operator=(const ResourceList_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline NamespacesGet_Response& operator=(NamespacesGet_Response&& from) noexcept {
+  inline ResourceList_Request& operator=(ResourceList_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1508,20 +1595,20 @@ class NamespacesGet_Response final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const NamespacesGet_Response& default_instance() {
+  static const ResourceList_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const NamespacesGet_Response* internal_default_instance() {
-    return reinterpret_cast<const NamespacesGet_Response*>(
-               &_NamespacesGet_Response_default_instance_);
+  static inline const ResourceList_Request* internal_default_instance() {
+    return reinterpret_cast<const ResourceList_Request*>(
+               &_ResourceList_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(NamespacesGet_Response& a, NamespacesGet_Response& b) {
+  friend void swap(ResourceList_Request& a, ResourceList_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(NamespacesGet_Response* other) {
+  inline void Swap(ResourceList_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1534,7 +1621,7 @@ class NamespacesGet_Response final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(NamespacesGet_Response* other) {
+  void UnsafeArenaSwap(ResourceList_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1542,14 +1629,14 @@ class NamespacesGet_Response final :
 
   // implements Message ----------------------------------------------
 
-  NamespacesGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<NamespacesGet_Response>(arena);
+  ResourceList_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceList_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const NamespacesGet_Response& from);
+  void CopyFrom(const ResourceList_Request& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const NamespacesGet_Response& from) {
-    NamespacesGet_Response::MergeImpl(*this, from);
+  void MergeFrom( const ResourceList_Request& from) {
+    ResourceList_Request::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1567,15 +1654,15 @@ class NamespacesGet_Response final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(NamespacesGet_Response* other);
+  void InternalSwap(ResourceList_Request* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.catalog.NamespacesGet_Response";
+    return "com.wazuh.api.engine.catalog.ResourceList_Request";
   }
   protected:
-  explicit NamespacesGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ResourceList_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1589,62 +1676,88 @@ class NamespacesGet_Response final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNamespacesFieldNumber = 3,
-    kErrorFieldNumber = 2,
-    kStatusFieldNumber = 1,
+    kNamespaceidFieldNumber = 1,
+    kFilterFieldNumber = 3,
+    kTypeFieldNumber = 2,
+    kPageFieldNumber = 4,
+    kSizeFieldNumber = 5,
   };
-  // repeated string namespaces = 3;
-  int namespaces_size() const;
+  // optional string namespaceid = 1;
+  bool has_namespaceid() const;
   private:
-  int _internal_namespaces_size() const;
+  bool _internal_has_namespaceid() const;
   public:
-  void clear_namespaces();
-  const std::string& namespaces(int index) const;
-  std::string* mutable_namespaces(int index);
-  void set_namespaces(int index, const std::string& value);
-  void set_namespaces(int index, std::string&& value);
-  void set_namespaces(int index, const char* value);
-  void set_namespaces(int index, const char* value, size_t size);
-  std::string* add_namespaces();
-  void add_namespaces(const std::string& value);
-  void add_namespaces(std::string&& value);
-  void add_namespaces(const char* value);
-  void add_namespaces(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& namespaces() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_namespaces();
+  void clear_namespaceid();
+  const std::string& namespaceid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_namespaceid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_namespaceid();
+  PROTOBUF_NODISCARD std::string* release_namespaceid();
+  void set_allocated_namespaceid(std::string* namespaceid);
   private:
-  const std::string& _internal_namespaces(int index) const;
-  std::string* _internal_add_namespaces();
+  const std::string& _internal_namespaceid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_namespaceid(const std::string& value);
+  std::string* _internal_mutable_namespaceid();
   public:
 
-  // optional string error = 2;
-  bool has_error() const;
+  // optional string filter = 3;
+  bool has_filter() const;
   private:
-  bool _internal_has_error() const;
+  bool _internal_has_filter() const;
   public:
-  void clear_error();
-  const std::string& error() const;
+  void clear_filter();
+  const std::string& filter() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_error(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_error();
-  PROTOBUF_NODISCARD std::string* release_error();
-  void set_allocated_error(std::string* error);
+  void set_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filter();
+  PROTOBUF_NODISCARD std::string* release_filter();
+  void set_allocated_filter(std::string* filter);
   private:
-  const std::string& _internal_error() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
-  std::string* _internal_mutable_error();
+  const std::string& _internal_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filter(const std::string& value);
+  std::string* _internal_mutable_filter();
   public:
 
-  // .com.wazuh.api.engine.ReturnStatus status = 1;
-  void clear_status();
-  ::com::wazuh::api::engine::ReturnStatus status() const;
-  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  // optional .com.wazuh.api.engine.catalog.ResourceType type = 2;
+  bool has_type() const;
   private:
-  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
-  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::com::wazuh::api::engine::catalog::ResourceType type() const;
+  void set_type(::com::wazuh::api::engine::catalog::ResourceType value);
+  private:
+  ::com::wazuh::api::engine::catalog::ResourceType _internal_type() const;
+  void _internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+  // optional uint32 page = 4;
+  bool has_page() const;
+  private:
+  bool _internal_has_page() const;
+  public:
+  void clear_page();
+  uint32_t page() const;
+  void set_page(uint32_t value);
+  private:
+  uint32_t _internal_page() const;
+  void _internal_set_page(uint32_t value);
+  public:
+
+  // optional uint32 size = 5;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  uint32_t size() const;
+  void set_size(uint32_t value);
+  private:
+  uint32_t _internal_size() const;
+  void _internal_set_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourceList_Request)
  private:
   class _Internal;
 
@@ -1654,261 +1767,1108 @@ class NamespacesGet_Response final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> namespaces_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
-    int status_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr namespaceid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
+    int type_;
+    uint32_t page_;
+    uint32_t size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_catalog_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class ResourceList_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.ResourceList_Response) */ {
+ public:
+  inline ResourceList_Response() : ResourceList_Response(nullptr) {}
+  ~ResourceList_Response() override;
+  explicit PROTOBUF_CONSTEXPR ResourceList_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// ResourcePost_Request
+  ResourceList_Response(const ResourceList_Response& from);
+  ResourceList_Response(ResourceList_Response&& from) noexcept
+    : ResourceList_Response() {
+    *this = ::std::move(from);
+  }
 
-// optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
-inline bool ResourcePost_Request::_internal_has_type() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline bool ResourcePost_Request::has_type() const {
-  return _internal_has_type();
-}
-inline void ResourcePost_Request::clear_type() {
-  _impl_.type_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline ::com::wazuh::api::engine::catalog::ResourceType ResourcePost_Request::_internal_type() const {
-  return static_cast< ::com::wazuh::api::engine::catalog::ResourceType >(_impl_.type_);
-}
-inline ::com::wazuh::api::engine::catalog::ResourceType ResourcePost_Request::type() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.type)
-  return _internal_type();
-}
-inline void ResourcePost_Request::_internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.type_ = value;
-}
-inline void ResourcePost_Request::set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.type)
-}
+  inline ResourceList_Response& operator=(const ResourceList_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResourceList_Response& operator=(ResourceList_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// optional .com.wazuh.api.engine.catalog.ResourceFormat format = 2;
-inline bool ResourcePost_Request::_internal_has_format() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
-  return value;
-}
-inline bool ResourcePost_Request::has_format() const {
-  return _internal_has_format();
-}
-inline void ResourcePost_Request::clear_format() {
-  _impl_.format_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000008u;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResourceList_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResourceList_Response* internal_default_instance() {
+    return reinterpret_cast<const ResourceList_Response*>(
+               &_ResourceList_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ResourceList_Response& a, ResourceList_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResourceList_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResourceList_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResourceList_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResourceList_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResourceList_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResourceList_Response& from) {
+    ResourceList_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResourceList_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.ResourceList_Response";
+  }
+  protected:
+  explicit ResourceList_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kItemsFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kTotalFieldNumber = 4,
+  };
+  // repeated .com.wazuh.api.engine.catalog.ResourceSummary items = 3;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+  public:
+  void clear_items();
+  ::com::wazuh::api::engine::catalog::ResourceSummary* mutable_items(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceSummary >*
+      mutable_items();
+  private:
+  const ::com::wazuh::api::engine::catalog::ResourceSummary& _internal_items(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceSummary* _internal_add_items();
+  public:
+  const ::com::wazuh::api::engine::catalog::ResourceSummary& items(int index) const;
+  ::com::wazuh::api::engine::catalog::ResourceSummary* add_items();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceSummary >&
+      items() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // optional uint32 total = 4;
+  bool has_total() const;
+  private:
+  bool _internal_has_total() const;
+  public:
+  void clear_total();
+  uint32_t total() const;
+  void set_total(uint32_t value);
+  private:
+  uint32_t _internal_total() const;
+  void _internal_set_total(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.ResourceList_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceSummary > items_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    uint32_t total_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NamespacesGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.NamespacesGet_Request) */ {
+ public:
+  inline NamespacesGet_Request() : NamespacesGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR NamespacesGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NamespacesGet_Request(const NamespacesGet_Request& from);
+  NamespacesGet_Request(NamespacesGet_Request&& from) noexcept
+    : NamespacesGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline NamespacesGet_Request& operator=(const NamespacesGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NamespacesGet_Request& operator=(NamespacesGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NamespacesGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NamespacesGet_Request* internal_default_instance() {
+    return reinterpret_cast<const NamespacesGet_Request*>(
+               &_NamespacesGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(NamespacesGet_Request& a, NamespacesGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NamespacesGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NamespacesGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NamespacesGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NamespacesGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const NamespacesGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const NamespacesGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.NamespacesGet_Request";
+  }
+  protected:
+  explicit NamespacesGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.NamespacesGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NamespacesGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.catalog.NamespacesGet_Response) */ {
+ public:
+  inline NamespacesGet_Response() : NamespacesGet_Response(nullptr) {}
+  ~NamespacesGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR NamespacesGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NamespacesGet_Response(const NamespacesGet_Response& from);
+  NamespacesGet_Response(NamespacesGet_Response&& from) noexcept
+    : NamespacesGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline NamespacesGet_Response& operator=(const NamespacesGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NamespacesGet_Response& operator=(NamespacesGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NamespacesGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NamespacesGet_Response* internal_default_instance() {
+    return reinterpret_cast<const NamespacesGet_Response*>(
+               &_NamespacesGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(NamespacesGet_Response& a, NamespacesGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NamespacesGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NamespacesGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NamespacesGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NamespacesGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NamespacesGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NamespacesGet_Response& from) {
+    NamespacesGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NamespacesGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.catalog.NamespacesGet_Response";
+  }
+  protected:
+  explicit NamespacesGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNamespacesFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated string namespaces = 3;
+  int namespaces_size() const;
+  private:
+  int _internal_namespaces_size() const;
+  public:
+  void clear_namespaces();
+  const std::string& namespaces(int index) const;
+  std::string* mutable_namespaces(int index);
+  void set_namespaces(int index, const std::string& value);
+  void set_namespaces(int index, std::string&& value);
+  void set_namespaces(int index, const char* value);
+  void set_namespaces(int index, const char* value, size_t size);
+  std::string* add_namespaces();
+  void add_namespaces(const std::string& value);
+  void add_namespaces(std::string&& value);
+  void add_namespaces(const char* value);
+  void add_namespaces(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& namespaces() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_namespaces();
+  private:
+  const std::string& _internal_namespaces(int index) const;
+  std::string* _internal_add_namespaces();
+  public:
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.catalog.NamespacesGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> namespaces_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_catalog_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ResourcePost_Request
+
+// optional .com.wazuh.api.engine.catalog.ResourceType type = 1;
+inline bool ResourcePost_Request::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ResourcePost_Request::has_type() const {
+  return _internal_has_type();
+}
+inline void ResourcePost_Request::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourcePost_Request::_internal_type() const {
+  return static_cast< ::com::wazuh::api::engine::catalog::ResourceType >(_impl_.type_);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourcePost_Request::type() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.type)
+  return _internal_type();
+}
+inline void ResourcePost_Request::_internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void ResourcePost_Request::set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.type)
+}
+
+// optional .com.wazuh.api.engine.catalog.ResourceFormat format = 2;
+inline bool ResourcePost_Request::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ResourcePost_Request::has_format() const {
+  return _internal_has_format();
+}
+inline void ResourcePost_Request::clear_format() {
+  _impl_.format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePost_Request::_internal_format() const {
+  return static_cast< ::com::wazuh::api::engine::catalog::ResourceFormat >(_impl_.format_);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePost_Request::format() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.format)
+  return _internal_format();
+}
+inline void ResourcePost_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.format_ = value;
+}
+inline void ResourcePost_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+  _internal_set_format(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.format)
+}
+
+// optional string content = 3;
+inline bool ResourcePost_Request::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResourcePost_Request::has_content() const {
+  return _internal_has_content();
+}
+inline void ResourcePost_Request::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResourcePost_Request::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourcePost_Request::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+}
+inline std::string* ResourcePost_Request::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+  return _s;
+}
+inline const std::string& ResourcePost_Request::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ResourcePost_Request::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourcePost_Request::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourcePost_Request::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourcePost_Request::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+}
+
+// optional string namespaceid = 4;
+inline bool ResourcePost_Request::_internal_has_namespaceid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResourcePost_Request::has_namespaceid() const {
+  return _internal_has_namespaceid();
+}
+inline void ResourcePost_Request::clear_namespaceid() {
+  _impl_.namespaceid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ResourcePost_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+  return _internal_namespaceid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourcePost_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+}
+inline std::string* ResourcePost_Request::mutable_namespaceid() {
+  std::string* _s = _internal_mutable_namespaceid();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+  return _s;
+}
+inline const std::string& ResourcePost_Request::_internal_namespaceid() const {
+  return _impl_.namespaceid_.Get();
+}
+inline void ResourcePost_Request::_internal_set_namespaceid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourcePost_Request::_internal_mutable_namespaceid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourcePost_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+  if (!_internal_has_namespaceid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.namespaceid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourcePost_Request::set_allocated_namespaceid(std::string* namespaceid) {
+  if (namespaceid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+}
+
+// -------------------------------------------------------------------
+
+// ResourceGet_Request
+
+// optional string name = 1;
+inline bool ResourceGet_Request::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResourceGet_Request::has_name() const {
+  return _internal_has_name();
+}
+inline void ResourceGet_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResourceGet_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourceGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+}
+inline std::string* ResourceGet_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+  return _s;
+}
+inline const std::string& ResourceGet_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void ResourceGet_Request::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourceGet_Request::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourceGet_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePost_Request::_internal_format() const {
+inline void ResourceGet_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+}
+
+// optional .com.wazuh.api.engine.catalog.ResourceFormat format = 2;
+inline bool ResourceGet_Request::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ResourceGet_Request::has_format() const {
+  return _internal_has_format();
+}
+inline void ResourceGet_Request::clear_format() {
+  _impl_.format_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceGet_Request::_internal_format() const {
   return static_cast< ::com::wazuh::api::engine::catalog::ResourceFormat >(_impl_.format_);
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePost_Request::format() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.format)
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceGet_Request::format() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Request.format)
   return _internal_format();
 }
-inline void ResourcePost_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
-  _impl_._has_bits_[0] |= 0x00000008u;
+inline void ResourceGet_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
   _impl_.format_ = value;
 }
-inline void ResourcePost_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+inline void ResourceGet_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
   _internal_set_format(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.format)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Request.format)
 }
 
-// optional string content = 3;
-inline bool ResourcePost_Request::_internal_has_content() const {
+// optional string namespaceid = 3;
+inline bool ResourceGet_Request::_internal_has_namespaceid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResourceGet_Request::has_namespaceid() const {
+  return _internal_has_namespaceid();
+}
+inline void ResourceGet_Request::clear_namespaceid() {
+  _impl_.namespaceid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ResourceGet_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+  return _internal_namespaceid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourceGet_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+}
+inline std::string* ResourceGet_Request::mutable_namespaceid() {
+  std::string* _s = _internal_mutable_namespaceid();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+  return _s;
+}
+inline const std::string& ResourceGet_Request::_internal_namespaceid() const {
+  return _impl_.namespaceid_.Get();
+}
+inline void ResourceGet_Request::_internal_set_namespaceid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourceGet_Request::_internal_mutable_namespaceid() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourceGet_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+  if (!_internal_has_namespaceid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.namespaceid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourceGet_Request::set_allocated_namespaceid(std::string* namespaceid) {
+  if (namespaceid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+}
+
+// -------------------------------------------------------------------
+
+// ResourceGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void ResourceGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus ResourceGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus ResourceGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Response.status)
+  return _internal_status();
+}
+inline void ResourceGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void ResourceGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool ResourceGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ResourcePost_Request::has_content() const {
-  return _internal_has_content();
+inline bool ResourceGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void ResourcePost_Request::clear_content() {
-  _impl_.content_.ClearToEmpty();
+inline void ResourceGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ResourcePost_Request::content() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
-  return _internal_content();
+inline const std::string& ResourceGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourcePost_Request::set_content(ArgT0&& arg0, ArgT... args) {
+void ResourceGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
 }
-inline std::string* ResourcePost_Request::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+inline std::string* ResourceGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
   return _s;
 }
-inline const std::string& ResourcePost_Request::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& ResourceGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void ResourcePost_Request::_internal_set_content(const std::string& value) {
+inline void ResourceGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourcePost_Request::_internal_mutable_content() {
+inline std::string* ResourceGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourcePost_Request::release_content() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
-  if (!_internal_has_content()) {
+inline std::string* ResourceGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.content_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourcePost_Request::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void ResourceGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePost_Request.content)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
 }
 
-// optional string namespaceid = 4;
-inline bool ResourcePost_Request::_internal_has_namespaceid() const {
+// optional string content = 3;
+inline bool ResourceGet_Response::_internal_has_content() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ResourcePost_Request::has_namespaceid() const {
-  return _internal_has_namespaceid();
+inline bool ResourceGet_Response::has_content() const {
+  return _internal_has_content();
 }
-inline void ResourcePost_Request::clear_namespaceid() {
-  _impl_.namespaceid_.ClearToEmpty();
+inline void ResourceGet_Response::clear_content() {
+  _impl_.content_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& ResourcePost_Request::namespaceid() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
-  return _internal_namespaceid();
+inline const std::string& ResourceGet_Response::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
+  return _internal_content();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourcePost_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+void ResourceGet_Response::set_content(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
 }
-inline std::string* ResourcePost_Request::mutable_namespaceid() {
-  std::string* _s = _internal_mutable_namespaceid();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+inline std::string* ResourceGet_Response::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
   return _s;
 }
-inline const std::string& ResourcePost_Request::_internal_namespaceid() const {
-  return _impl_.namespaceid_.Get();
+inline const std::string& ResourceGet_Response::_internal_content() const {
+  return _impl_.content_.Get();
 }
-inline void ResourcePost_Request::_internal_set_namespaceid(const std::string& value) {
+inline void ResourceGet_Response::_internal_set_content(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourcePost_Request::_internal_mutable_namespaceid() {
+inline std::string* ResourceGet_Response::_internal_mutable_content() {
   _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
+  return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourcePost_Request::release_namespaceid() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
-  if (!_internal_has_namespaceid()) {
+inline std::string* ResourceGet_Response::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
+  if (!_internal_has_content()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.namespaceid_.Release();
+  auto* p = _impl_.content_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.namespaceid_.IsDefault()) {
-    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourcePost_Request::set_allocated_namespaceid(std::string* namespaceid) {
-  if (namespaceid != nullptr) {
+inline void ResourceGet_Response::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.namespaceid_.IsDefault()) {
-    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePost_Request.namespaceid)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
 }
 
 // -------------------------------------------------------------------
 
-// ResourceGet_Request
+// ResourcePut_Request
 
 // optional string name = 1;
-inline bool ResourceGet_Request::_internal_has_name() const {
+inline bool ResourcePut_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ResourceGet_Request::has_name() const {
+inline bool ResourcePut_Request::has_name() const {
   return _internal_has_name();
 }
-inline void ResourceGet_Request::clear_name() {
+inline void ResourcePut_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ResourceGet_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+inline const std::string& ResourcePut_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void ResourcePut_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
 }
-inline std::string* ResourceGet_Request::mutable_name() {
+inline std::string* ResourcePut_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
   return _s;
 }
-inline const std::string& ResourceGet_Request::_internal_name() const {
+inline const std::string& ResourcePut_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void ResourceGet_Request::_internal_set_name(const std::string& value) {
+inline void ResourcePut_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Request::_internal_mutable_name() {
+inline std::string* ResourcePut_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+inline std::string* ResourcePut_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
@@ -1921,7 +2881,7 @@ inline std::string* ResourceGet_Request::release_name() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceGet_Request::set_allocated_name(std::string* name) {
+inline void ResourcePut_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -1933,82 +2893,150 @@ inline void ResourceGet_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
 }
 
 // optional .com.wazuh.api.engine.catalog.ResourceFormat format = 2;
-inline bool ResourceGet_Request::_internal_has_format() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+inline bool ResourcePut_Request::_internal_has_format() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
-inline bool ResourceGet_Request::has_format() const {
+inline bool ResourcePut_Request::has_format() const {
   return _internal_has_format();
 }
-inline void ResourceGet_Request::clear_format() {
+inline void ResourcePut_Request::clear_format() {
   _impl_.format_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceGet_Request::_internal_format() const {
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePut_Request::_internal_format() const {
   return static_cast< ::com::wazuh::api::engine::catalog::ResourceFormat >(_impl_.format_);
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceGet_Request::format() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Request.format)
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePut_Request::format() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.format)
   return _internal_format();
 }
-inline void ResourceGet_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
+inline void ResourcePut_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
   _impl_.format_ = value;
 }
-inline void ResourceGet_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+inline void ResourcePut_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
   _internal_set_format(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Request.format)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.format)
 }
 
-// optional string namespaceid = 3;
-inline bool ResourceGet_Request::_internal_has_namespaceid() const {
+// optional string content = 3;
+inline bool ResourcePut_Request::_internal_has_content() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ResourceGet_Request::has_namespaceid() const {
+inline bool ResourcePut_Request::has_content() const {
+  return _internal_has_content();
+}
+inline void ResourcePut_Request::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ResourcePut_Request::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResourcePut_Request::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+}
+inline std::string* ResourcePut_Request::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+  return _s;
+}
+inline const std::string& ResourcePut_Request::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void ResourcePut_Request::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResourcePut_Request::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResourcePut_Request::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResourcePut_Request::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+}
+
+// optional string namespaceid = 4;
+inline bool ResourcePut_Request::_internal_has_namespaceid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ResourcePut_Request::has_namespaceid() const {
   return _internal_has_namespaceid();
 }
-inline void ResourceGet_Request::clear_namespaceid() {
+inline void ResourcePut_Request::clear_namespaceid() {
   _impl_.namespaceid_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline const std::string& ResourceGet_Request::namespaceid() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+inline const std::string& ResourcePut_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
   return _internal_namespaceid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceGet_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
+void ResourcePut_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
  _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
 }
-inline std::string* ResourceGet_Request::mutable_namespaceid() {
+inline std::string* ResourcePut_Request::mutable_namespaceid() {
   std::string* _s = _internal_mutable_namespaceid();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
   return _s;
 }
-inline const std::string& ResourceGet_Request::_internal_namespaceid() const {
+inline const std::string& ResourcePut_Request::_internal_namespaceid() const {
   return _impl_.namespaceid_.Get();
 }
-inline void ResourceGet_Request::_internal_set_namespaceid(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
+inline void ResourcePut_Request::_internal_set_namespaceid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
   _impl_.namespaceid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Request::_internal_mutable_namespaceid() {
-  _impl_._has_bits_[0] |= 0x00000002u;
+inline std::string* ResourcePut_Request::_internal_mutable_namespaceid() {
+  _impl_._has_bits_[0] |= 0x00000004u;
   return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Request::release_namespaceid() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+inline std::string* ResourcePut_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
   if (!_internal_has_namespaceid()) {
     return nullptr;
   }
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
   auto* p = _impl_.namespaceid_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (_impl_.namespaceid_.IsDefault()) {
@@ -2017,11 +3045,11 @@ inline std::string* ResourceGet_Request::release_namespaceid() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceGet_Request::set_allocated_namespaceid(std::string* namespaceid) {
+inline void ResourcePut_Request::set_allocated_namespaceid(std::string* namespaceid) {
   if (namespaceid != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
   _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2029,214 +3057,194 @@ inline void ResourceGet_Request::set_allocated_namespaceid(std::string* namespac
     _impl_.namespaceid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Request.namespaceid)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
 }
 
 // -------------------------------------------------------------------
 
-// ResourceGet_Response
-
-// .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void ResourceGet_Response::clear_status() {
-  _impl_.status_ = 0;
-}
-inline ::com::wazuh::api::engine::ReturnStatus ResourceGet_Response::_internal_status() const {
-  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
-}
-inline ::com::wazuh::api::engine::ReturnStatus ResourceGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Response.status)
-  return _internal_status();
-}
-inline void ResourceGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  
-  _impl_.status_ = value;
-}
-inline void ResourceGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Response.status)
-}
+// ResourceDelete_Request
 
-// optional string error = 2;
-inline bool ResourceGet_Response::_internal_has_error() const {
+// optional string name = 1;
+inline bool ResourceDelete_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ResourceGet_Response::has_error() const {
-  return _internal_has_error();
+inline bool ResourceDelete_Request::has_name() const {
+  return _internal_has_name();
 }
-inline void ResourceGet_Response::clear_error() {
-  _impl_.error_.ClearToEmpty();
+inline void ResourceDelete_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ResourceGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
-  return _internal_error();
+inline const std::string& ResourceDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void ResourceDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
 }
-inline std::string* ResourceGet_Response::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
+inline std::string* ResourceDelete_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
   return _s;
 }
-inline const std::string& ResourceGet_Response::_internal_error() const {
-  return _impl_.error_.Get();
+inline const std::string& ResourceDelete_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void ResourceGet_Response::_internal_set_error(const std::string& value) {
+inline void ResourceDelete_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Response::_internal_mutable_error() {
+inline std::string* ResourceDelete_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
-  if (!_internal_has_error()) {
+inline std::string* ResourceDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+  if (!_internal_has_name()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.error_.Release();
+  auto* p = _impl_.name_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceGet_Response::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
+inline void ResourceDelete_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
 }
 
-// optional string content = 3;
-inline bool ResourceGet_Response::_internal_has_content() const {
+// optional string namespaceid = 2;
+inline bool ResourceDelete_Request::_internal_has_namespaceid() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ResourceGet_Response::has_content() const {
-  return _internal_has_content();
+inline bool ResourceDelete_Request::has_namespaceid() const {
+  return _internal_has_namespaceid();
 }
-inline void ResourceGet_Response::clear_content() {
-  _impl_.content_.ClearToEmpty();
+inline void ResourceDelete_Request::clear_namespaceid() {
+  _impl_.namespaceid_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& ResourceGet_Response::content() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
-  return _internal_content();
+inline const std::string& ResourceDelete_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
+  return _internal_namespaceid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceGet_Response::set_content(ArgT0&& arg0, ArgT... args) {
+void ResourceDelete_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
+ _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
 }
-inline std::string* ResourceGet_Response::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
+inline std::string* ResourceDelete_Request::mutable_namespaceid() {
+  std::string* _s = _internal_mutable_namespaceid();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
   return _s;
 }
-inline const std::string& ResourceGet_Response::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& ResourceDelete_Request::_internal_namespaceid() const {
+  return _impl_.namespaceid_.Get();
 }
-inline void ResourceGet_Response::_internal_set_content(const std::string& value) {
+inline void ResourceDelete_Request::_internal_set_namespaceid(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Response::_internal_mutable_content() {
+inline std::string* ResourceDelete_Request::_internal_mutable_namespaceid() {
   _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceGet_Response::release_content() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
-  if (!_internal_has_content()) {
+inline std::string* ResourceDelete_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
+  if (!_internal_has_namespaceid()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.content_.Release();
+  auto* p = _impl_.namespaceid_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceGet_Response::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void ResourceDelete_Request::set_allocated_namespaceid(std::string* namespaceid) {
+  if (namespaceid != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceGet_Response.content)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
 }
 
 // -------------------------------------------------------------------
 
-// ResourcePut_Request
+// ResourceValidate_Request
 
 // optional string name = 1;
-inline bool ResourcePut_Request::_internal_has_name() const {
+inline bool ResourceValidate_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ResourcePut_Request::has_name() const {
+inline bool ResourceValidate_Request::has_name() const {
   return _internal_has_name();
 }
-inline void ResourcePut_Request::clear_name() {
+inline void ResourceValidate_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ResourcePut_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
+inline const std::string& ResourceValidate_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourcePut_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void ResourceValidate_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
 }
-inline std::string* ResourcePut_Request::mutable_name() {
+inline std::string* ResourceValidate_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
   return _s;
 }
-inline const std::string& ResourcePut_Request::_internal_name() const {
+inline const std::string& ResourceValidate_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void ResourcePut_Request::_internal_set_name(const std::string& value) {
+inline void ResourceValidate_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourcePut_Request::_internal_mutable_name() {
+inline std::string* ResourceValidate_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourcePut_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
+inline std::string* ResourceValidate_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
@@ -2249,7 +3257,7 @@ inline std::string* ResourcePut_Request::release_name() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourcePut_Request::set_allocated_name(std::string* name) {
+inline void ResourceValidate_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -2261,78 +3269,78 @@ inline void ResourcePut_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePut_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
 }
 
 // optional .com.wazuh.api.engine.catalog.ResourceFormat format = 2;
-inline bool ResourcePut_Request::_internal_has_format() const {
+inline bool ResourceValidate_Request::_internal_has_format() const {
   bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
-inline bool ResourcePut_Request::has_format() const {
+inline bool ResourceValidate_Request::has_format() const {
   return _internal_has_format();
 }
-inline void ResourcePut_Request::clear_format() {
+inline void ResourceValidate_Request::clear_format() {
   _impl_.format_ = 0;
   _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePut_Request::_internal_format() const {
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceValidate_Request::_internal_format() const {
   return static_cast< ::com::wazuh::api::engine::catalog::ResourceFormat >(_impl_.format_);
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourcePut_Request::format() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.format)
+inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceValidate_Request::format() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.format)
   return _internal_format();
 }
-inline void ResourcePut_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+inline void ResourceValidate_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
   _impl_._has_bits_[0] |= 0x00000008u;
   _impl_.format_ = value;
 }
-inline void ResourcePut_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
+inline void ResourceValidate_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
   _internal_set_format(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.format)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.format)
 }
 
 // optional string content = 3;
-inline bool ResourcePut_Request::_internal_has_content() const {
+inline bool ResourceValidate_Request::_internal_has_content() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ResourcePut_Request::has_content() const {
+inline bool ResourceValidate_Request::has_content() const {
   return _internal_has_content();
 }
-inline void ResourcePut_Request::clear_content() {
+inline void ResourceValidate_Request::clear_content() {
   _impl_.content_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& ResourcePut_Request::content() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+inline const std::string& ResourceValidate_Request::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
   return _internal_content();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourcePut_Request::set_content(ArgT0&& arg0, ArgT... args) {
+void ResourceValidate_Request::set_content(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
  _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
 }
-inline std::string* ResourcePut_Request::mutable_content() {
+inline std::string* ResourceValidate_Request::mutable_content() {
   std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
   return _s;
 }
-inline const std::string& ResourcePut_Request::_internal_content() const {
+inline const std::string& ResourceValidate_Request::_internal_content() const {
   return _impl_.content_.Get();
 }
-inline void ResourcePut_Request::_internal_set_content(const std::string& value) {
+inline void ResourceValidate_Request::_internal_set_content(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
   _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourcePut_Request::_internal_mutable_content() {
+inline std::string* ResourceValidate_Request::_internal_mutable_content() {
   _impl_._has_bits_[0] |= 0x00000002u;
   return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourcePut_Request::release_content() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+inline std::string* ResourceValidate_Request::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
   if (!_internal_has_content()) {
     return nullptr;
   }
@@ -2345,7 +3353,7 @@ inline std::string* ResourcePut_Request::release_content() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourcePut_Request::set_allocated_content(std::string* content) {
+inline void ResourceValidate_Request::set_allocated_content(std::string* content) {
   if (content != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
@@ -2357,50 +3365,50 @@ inline void ResourcePut_Request::set_allocated_content(std::string* content) {
     _impl_.content_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePut_Request.content)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
 }
 
 // optional string namespaceid = 4;
-inline bool ResourcePut_Request::_internal_has_namespaceid() const {
+inline bool ResourceValidate_Request::_internal_has_namespaceid() const {
   bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
-inline bool ResourcePut_Request::has_namespaceid() const {
+inline bool ResourceValidate_Request::has_namespaceid() const {
   return _internal_has_namespaceid();
 }
-inline void ResourcePut_Request::clear_namespaceid() {
+inline void ResourceValidate_Request::clear_namespaceid() {
   _impl_.namespaceid_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline const std::string& ResourcePut_Request::namespaceid() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
+inline const std::string& ResourceValidate_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
   return _internal_namespaceid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourcePut_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+void ResourceValidate_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000004u;
  _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
 }
-inline std::string* ResourcePut_Request::mutable_namespaceid() {
+inline std::string* ResourceValidate_Request::mutable_namespaceid() {
   std::string* _s = _internal_mutable_namespaceid();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
   return _s;
 }
-inline const std::string& ResourcePut_Request::_internal_namespaceid() const {
+inline const std::string& ResourceValidate_Request::_internal_namespaceid() const {
   return _impl_.namespaceid_.Get();
 }
-inline void ResourcePut_Request::_internal_set_namespaceid(const std::string& value) {
+inline void ResourceValidate_Request::_internal_set_namespaceid(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000004u;
   _impl_.namespaceid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourcePut_Request::_internal_mutable_namespaceid() {
+inline std::string* ResourceValidate_Request::_internal_mutable_namespaceid() {
   _impl_._has_bits_[0] |= 0x00000004u;
   return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourcePut_Request::release_namespaceid() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
+inline std::string* ResourceValidate_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
   if (!_internal_has_namespaceid()) {
     return nullptr;
   }
@@ -2413,7 +3421,7 @@ inline std::string* ResourcePut_Request::release_namespaceid() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourcePut_Request::set_allocated_namespaceid(std::string* namespaceid) {
+inline void ResourceValidate_Request::set_allocated_namespaceid(std::string* namespaceid) {
   if (namespaceid != nullptr) {
     _impl_._has_bits_[0] |= 0x00000004u;
   } else {
@@ -2425,54 +3433,54 @@ inline void ResourcePut_Request::set_allocated_namespaceid(std::string* namespac
     _impl_.namespaceid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourcePut_Request.namespaceid)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
 }
 
 // -------------------------------------------------------------------
 
-// ResourceDelete_Request
+// ResourceSummary
 
 // optional string name = 1;
-inline bool ResourceDelete_Request::_internal_has_name() const {
+inline bool ResourceSummary::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ResourceDelete_Request::has_name() const {
+inline bool ResourceSummary::has_name() const {
   return _internal_has_name();
 }
-inline void ResourceDelete_Request::clear_name() {
+inline void ResourceSummary::clear_name() {
   _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ResourceDelete_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+inline const std::string& ResourceSummary::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceSummary.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void ResourceSummary::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceSummary.name)
 }
-inline std::string* ResourceDelete_Request::mutable_name() {
+inline std::string* ResourceSummary::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceSummary.name)
   return _s;
 }
-inline const std::string& ResourceDelete_Request::_internal_name() const {
+inline const std::string& ResourceSummary::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void ResourceDelete_Request::_internal_set_name(const std::string& value) {
+inline void ResourceSummary::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceDelete_Request::_internal_mutable_name() {
+inline std::string* ResourceSummary::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceDelete_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+inline std::string* ResourceSummary::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceSummary.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
@@ -2485,7 +3493,7 @@ inline std::string* ResourceDelete_Request::release_name() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceDelete_Request::set_allocated_name(std::string* name) {
+inline void ResourceSummary::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -2497,311 +3505,487 @@ inline void ResourceDelete_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceDelete_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceSummary.name)
 }
 
-// optional string namespaceid = 2;
-inline bool ResourceDelete_Request::_internal_has_namespaceid() const {
+// optional .com.wazuh.api.engine.catalog.ResourceType type = 2;
+inline bool ResourceSummary::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ResourceSummary::has_type() const {
+  return _internal_has_type();
+}
+inline void ResourceSummary::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourceSummary::_internal_type() const {
+  return static_cast< ::com::wazuh::api::engine::catalog::ResourceType >(_impl_.type_);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourceSummary::type() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceSummary.type)
+  return _internal_type();
+}
+inline void ResourceSummary::_internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
+}
+inline void ResourceSummary::set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceSummary.type)
+}
+
+// optional string title = 3;
+inline bool ResourceSummary::_internal_has_title() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ResourceDelete_Request::has_namespaceid() const {
-  return _internal_has_namespaceid();
+inline bool ResourceSummary::has_title() const {
+  return _internal_has_title();
 }
-inline void ResourceDelete_Request::clear_namespaceid() {
-  _impl_.namespaceid_.ClearToEmpty();
+inline void ResourceSummary::clear_title() {
+  _impl_.title_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& ResourceDelete_Request::namespaceid() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
-  return _internal_namespaceid();
+inline const std::string& ResourceSummary::title() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceSummary.title)
+  return _internal_title();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceDelete_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
+void ResourceSummary::set_title(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
+ _impl_.title_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceSummary.title)
 }
-inline std::string* ResourceDelete_Request::mutable_namespaceid() {
-  std::string* _s = _internal_mutable_namespaceid();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
+inline std::string* ResourceSummary::mutable_title() {
+  std::string* _s = _internal_mutable_title();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceSummary.title)
   return _s;
 }
-inline const std::string& ResourceDelete_Request::_internal_namespaceid() const {
-  return _impl_.namespaceid_.Get();
+inline const std::string& ResourceSummary::_internal_title() const {
+  return _impl_.title_.Get();
 }
-inline void ResourceDelete_Request::_internal_set_namespaceid(const std::string& value) {
+inline void ResourceSummary::_internal_set_title(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
+  _impl_.title_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceDelete_Request::_internal_mutable_namespaceid() {
+inline std::string* ResourceSummary::_internal_mutable_title() {
   _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
+  return _impl_.title_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceDelete_Request::release_namespaceid() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
-  if (!_internal_has_namespaceid()) {
+inline std::string* ResourceSummary::release_title() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceSummary.title)
+  if (!_internal_has_title()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.namespaceid_.Release();
+  auto* p = _impl_.title_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.namespaceid_.IsDefault()) {
-    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  if (_impl_.title_.IsDefault()) {
+    _impl_.title_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceDelete_Request::set_allocated_namespaceid(std::string* namespaceid) {
-  if (namespaceid != nullptr) {
+inline void ResourceSummary::set_allocated_title(std::string* title) {
+  if (title != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
+  _impl_.title_.SetAllocated(title, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.namespaceid_.IsDefault()) {
-    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  if (_impl_.title_.IsDefault()) {
+    _impl_.title_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceDelete_Request.namespaceid)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceSummary.title)
 }
 
 // -------------------------------------------------------------------
 
-// ResourceValidate_Request
+// ResourceList_Request
 
-// optional string name = 1;
-inline bool ResourceValidate_Request::_internal_has_name() const {
+// optional string namespaceid = 1;
+inline bool ResourceList_Request::_internal_has_namespaceid() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool ResourceValidate_Request::has_name() const {
-  return _internal_has_name();
+inline bool ResourceList_Request::has_namespaceid() const {
+  return _internal_has_namespaceid();
 }
-inline void ResourceValidate_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+inline void ResourceList_Request::clear_namespaceid() {
+  _impl_.namespaceid_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& ResourceValidate_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
-  return _internal_name();
+inline const std::string& ResourceList_Request::namespaceid() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Request.namespaceid)
+  return _internal_namespaceid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceValidate_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void ResourceList_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
+ _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Request.namespaceid)
 }
-inline std::string* ResourceValidate_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
+inline std::string* ResourceList_Request::mutable_namespaceid() {
+  std::string* _s = _internal_mutable_namespaceid();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceList_Request.namespaceid)
   return _s;
 }
-inline const std::string& ResourceValidate_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& ResourceList_Request::_internal_namespaceid() const {
+  return _impl_.namespaceid_.Get();
 }
-inline void ResourceValidate_Request::_internal_set_name(const std::string& value) {
+inline void ResourceList_Request::_internal_set_namespaceid(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceValidate_Request::_internal_mutable_name() {
+inline std::string* ResourceList_Request::_internal_mutable_namespaceid() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceValidate_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
-  if (!_internal_has_name()) {
+inline std::string* ResourceList_Request::release_namespaceid() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceList_Request.namespaceid)
+  if (!_internal_has_namespaceid()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.name_.Release();
+  auto* p = _impl_.namespaceid_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceValidate_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void ResourceList_Request::set_allocated_namespaceid(std::string* namespaceid) {
+  if (namespaceid != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.namespaceid_.IsDefault()) {
+    _impl_.namespaceid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceValidate_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceList_Request.namespaceid)
 }
 
-// optional .com.wazuh.api.engine.catalog.ResourceFormat format = 2;
-inline bool ResourceValidate_Request::_internal_has_format() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+// optional .com.wazuh.api.engine.catalog.ResourceType type = 2;
+inline bool ResourceList_Request::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
-inline bool ResourceValidate_Request::has_format() const {
-  return _internal_has_format();
+inline bool ResourceList_Request::has_type() const {
+  return _internal_has_type();
 }
-inline void ResourceValidate_Request::clear_format() {
-  _impl_.format_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000008u;
+inline void ResourceList_Request::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceValidate_Request::_internal_format() const {
-  return static_cast< ::com::wazuh::api::engine::catalog::ResourceFormat >(_impl_.format_);
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourceList_Request::_internal_type() const {
+  return static_cast< ::com::wazuh::api::engine::catalog::ResourceType >(_impl_.type_);
 }
-inline ::com::wazuh::api::engine::catalog::ResourceFormat ResourceValidate_Request::format() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.format)
-  return _internal_format();
+inline ::com::wazuh::api::engine::catalog::ResourceType ResourceList_Request::type() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Request.type)
+  return _internal_type();
 }
-inline void ResourceValidate_Request::_internal_set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
-  _impl_._has_bits_[0] |= 0x00000008u;
-  _impl_.format_ = value;
+inline void ResourceList_Request::_internal_set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
 }
-inline void ResourceValidate_Request::set_format(::com::wazuh::api::engine::catalog::ResourceFormat value) {
-  _internal_set_format(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.format)
+inline void ResourceList_Request::set_type(::com::wazuh::api::engine::catalog::ResourceType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Request.type)
 }
 
-// optional string content = 3;
-inline bool ResourceValidate_Request::_internal_has_content() const {
+// optional string filter = 3;
+inline bool ResourceList_Request::_internal_has_filter() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool ResourceValidate_Request::has_content() const {
-  return _internal_has_content();
+inline bool ResourceList_Request::has_filter() const {
+  return _internal_has_filter();
 }
-inline void ResourceValidate_Request::clear_content() {
-  _impl_.content_.ClearToEmpty();
+inline void ResourceList_Request::clear_filter() {
+  _impl_.filter_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& ResourceValidate_Request::content() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
-  return _internal_content();
+inline const std::string& ResourceList_Request::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Request.filter)
+  return _internal_filter();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceValidate_Request::set_content(ArgT0&& arg0, ArgT... args) {
+void ResourceList_Request::set_filter(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Request.filter)
 }
-inline std::string* ResourceValidate_Request::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
+inline std::string* ResourceList_Request::mutable_filter() {
+  std::string* _s = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceList_Request.filter)
   return _s;
 }
-inline const std::string& ResourceValidate_Request::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& ResourceList_Request::_internal_filter() const {
+  return _impl_.filter_.Get();
 }
-inline void ResourceValidate_Request::_internal_set_content(const std::string& value) {
+inline void ResourceList_Request::_internal_set_filter(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.content_.Set(value, GetArenaForAllocation());
+  _impl_.filter_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceValidate_Request::_internal_mutable_content() {
+inline std::string* ResourceList_Request::_internal_mutable_filter() {
   _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceValidate_Request::release_content() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
-  if (!_internal_has_content()) {
+inline std::string* ResourceList_Request::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceList_Request.filter)
+  if (!_internal_has_filter()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.content_.Release();
+  auto* p = _impl_.filter_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceValidate_Request::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
+inline void ResourceList_Request::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceValidate_Request.content)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceList_Request.filter)
 }
 
-// optional string namespaceid = 4;
-inline bool ResourceValidate_Request::_internal_has_namespaceid() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+// optional uint32 page = 4;
+inline bool ResourceList_Request::_internal_has_page() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
-inline bool ResourceValidate_Request::has_namespaceid() const {
-  return _internal_has_namespaceid();
+inline bool ResourceList_Request::has_page() const {
+  return _internal_has_page();
 }
-inline void ResourceValidate_Request::clear_namespaceid() {
-  _impl_.namespaceid_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000004u;
+inline void ResourceList_Request::clear_page() {
+  _impl_.page_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline const std::string& ResourceValidate_Request::namespaceid() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
-  return _internal_namespaceid();
+inline uint32_t ResourceList_Request::_internal_page() const {
+  return _impl_.page_;
+}
+inline uint32_t ResourceList_Request::page() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Request.page)
+  return _internal_page();
+}
+inline void ResourceList_Request::_internal_set_page(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.page_ = value;
+}
+inline void ResourceList_Request::set_page(uint32_t value) {
+  _internal_set_page(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Request.page)
+}
+
+// optional uint32 size = 5;
+inline bool ResourceList_Request::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ResourceList_Request::has_size() const {
+  return _internal_has_size();
+}
+inline void ResourceList_Request::clear_size() {
+  _impl_.size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ResourceList_Request::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint32_t ResourceList_Request::size() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Request.size)
+  return _internal_size();
+}
+inline void ResourceList_Request::_internal_set_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.size_ = value;
+}
+inline void ResourceList_Request::set_size(uint32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Request.size)
+}
+
+// -------------------------------------------------------------------
+
+// ResourceList_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void ResourceList_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus ResourceList_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus ResourceList_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Response.status)
+  return _internal_status();
+}
+inline void ResourceList_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void ResourceList_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Response.status)
+}
+
+// optional string error = 2;
+inline bool ResourceList_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResourceList_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void ResourceList_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResourceList_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ResourceValidate_Request::set_namespaceid(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000004u;
- _impl_.namespaceid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
+void ResourceList_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Response.error)
 }
-inline std::string* ResourceValidate_Request::mutable_namespaceid() {
-  std::string* _s = _internal_mutable_namespaceid();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
+inline std::string* ResourceList_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceList_Response.error)
   return _s;
 }
-inline const std::string& ResourceValidate_Request::_internal_namespaceid() const {
-  return _impl_.namespaceid_.Get();
+inline const std::string& ResourceList_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void ResourceValidate_Request::_internal_set_namespaceid(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.namespaceid_.Set(value, GetArenaForAllocation());
+inline void ResourceList_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ResourceValidate_Request::_internal_mutable_namespaceid() {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  return _impl_.namespaceid_.Mutable(GetArenaForAllocation());
+inline std::string* ResourceList_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ResourceValidate_Request::release_namespaceid() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
-  if (!_internal_has_namespaceid()) {
+inline std::string* ResourceList_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.catalog.ResourceList_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
-  _impl_._has_bits_[0] &= ~0x00000004u;
-  auto* p = _impl_.namespaceid_.Release();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.namespaceid_.IsDefault()) {
-    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void ResourceValidate_Request::set_allocated_namespaceid(std::string* namespaceid) {
-  if (namespaceid != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000004u;
+inline void ResourceList_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.namespaceid_.SetAllocated(namespaceid, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.namespaceid_.IsDefault()) {
-    _impl_.namespaceid_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceValidate_Request.namespaceid)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.catalog.ResourceList_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.catalog.ResourceSummary items = 3;
+inline int ResourceList_Response::_internal_items_size() const {
+  return _impl_.items_.size();
+}
+inline int ResourceList_Response::items_size() const {
+  return _internal_items_size();
+}
+inline void ResourceList_Response::clear_items() {
+  _impl_.items_.Clear();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceSummary* ResourceList_Response::mutable_items(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.catalog.ResourceList_Response.items)
+  return _impl_.items_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceSummary >*
+ResourceList_Response::mutable_items() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.catalog.ResourceList_Response.items)
+  return &_impl_.items_;
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceSummary& ResourceList_Response::_internal_items(int index) const {
+  return _impl_.items_.Get(index);
+}
+inline const ::com::wazuh::api::engine::catalog::ResourceSummary& ResourceList_Response::items(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Response.items)
+  return _internal_items(index);
+}
+inline ::com::wazuh::api::engine::catalog::ResourceSummary* ResourceList_Response::_internal_add_items() {
+  return _impl_.items_.Add();
+}
+inline ::com::wazuh::api::engine::catalog::ResourceSummary* ResourceList_Response::add_items() {
+  ::com::wazuh::api::engine::catalog::ResourceSummary* _add = _internal_add_items();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.catalog.ResourceList_Response.items)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::catalog::ResourceSummary >&
+ResourceList_Response::items() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.catalog.ResourceList_Response.items)
+  return _impl_.items_;
+}
+
+// optional uint32 total = 4;
+inline bool ResourceList_Response::_internal_has_total() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResourceList_Response::has_total() const {
+  return _internal_has_total();
+}
+inline void ResourceList_Response::clear_total() {
+  _impl_.total_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ResourceList_Response::_internal_total() const {
+  return _impl_.total_;
+}
+inline uint32_t ResourceList_Response::total() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.catalog.ResourceList_Response.total)
+  return _internal_total();
+}
+inline void ResourceList_Response::_internal_set_total(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.total_ = value;
+}
+inline void ResourceList_Response::set_total(uint32_t value) {
+  _internal_set_total(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.catalog.ResourceList_Response.total)
 }
 
 // -------------------------------------------------------------------
@@ -2992,6 +4176,12 @@ NamespacesGet_Response::mutable_namespaces() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
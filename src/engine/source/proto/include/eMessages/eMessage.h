@@ -1,6 +1,7 @@
 #ifndef _PROTO_EMESSAGE_EMESSAGE_HPP
 #define _PROTO_EMESSAGE_EMESSAGE_HPP
 
+#include <optional>
 #include <type_traits>
 #include <variant>
 
@@ -67,6 +68,40 @@ std::variant<base::Error, std::string> eMessageToJson(const T& message, bool pri
     return base::Error {res.ToString()};
 }
 
+/**
+* @brief Serialize a google::protobuf::Message appending the JSON to an existing string.
+*
+* Serializes straight into the caller's buffer (e.g. an httplib response body), so no
+* intermediate string is allocated and copied per response.
+*
+* @tparam T The type of the google::protobuf::Message.
+* @param message The message to serialize.
+* @param out The string the JSON is appended to. Left as it was on error.
+* @param printPrimitiveFields Whether to always print primitive fields, even if their values are their default values.
+* @return std::nullopt on success, the error otherwise.
+*/
+template<typename T>
+std::optional<base::Error> eMessageToJson(const T& message, std::string& out, bool printPrimitiveFields = true)
+{
+    static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
+
+    google::protobuf::util::JsonPrintOptions outOptions = google::protobuf::util::JsonPrintOptions();
+    outOptions.add_whitespace = false;
+    outOptions.always_print_primitive_fields = printPrimitiveFields;
+    outOptions.preserve_proto_field_names = true;
+    outOptions.always_print_enums_as_ints = false;
+
+    const auto baseSize = out.size();
+    const auto res = google::protobuf::util::MessageToJsonString(message, &out, outOptions);
+    if (res.ok())
+    {
+        return std::nullopt;
+    }
+
+    out.resize(baseSize);
+    return base::Error {res.ToString()};
+}
+
 /**
 * @brief Serialize a google::protobuf::RepeatedPtrField<T> into a JSON string.
 *
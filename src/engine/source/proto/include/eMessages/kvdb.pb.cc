@@ -77,6 +77,7 @@ PROTOBUF_CONSTEXPR dbSearch_Request::dbSearch_Request(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/0u
   , /*decltype(_impl_.records_)*/0u} {}
 struct dbSearch_RequestDefaultTypeInternal {
@@ -94,6 +95,7 @@ PROTOBUF_CONSTEXPR dbSearch_Response::dbSearch_Response(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.entries_)*/{}
   , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.next_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.status_)*/0} {}
 struct dbSearch_ResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR dbSearch_ResponseDefaultTypeInternal()
@@ -134,6 +136,67 @@ struct dbPut_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dbPut_RequestDefaultTypeInternal _dbPut_Request_default_instance_;
+PROTOBUF_CONSTEXPR dbImport_Request::dbImport_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct dbImport_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR dbImport_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~dbImport_RequestDefaultTypeInternal() {}
+  union {
+    dbImport_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dbImport_RequestDefaultTypeInternal _dbImport_Request_default_instance_;
+PROTOBUF_CONSTEXPR dbImport_Response::dbImport_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.imported_)*/0u} {}
+struct dbImport_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR dbImport_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~dbImport_ResponseDefaultTypeInternal() {}
+  union {
+    dbImport_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dbImport_ResponseDefaultTypeInternal _dbImport_Response_default_instance_;
+PROTOBUF_CONSTEXPR dbExport_Request::dbExport_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct dbExport_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR dbExport_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~dbExport_RequestDefaultTypeInternal() {}
+  union {
+    dbExport_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dbExport_RequestDefaultTypeInternal _dbExport_Request_default_instance_;
+PROTOBUF_CONSTEXPR dbExport_Response::dbExport_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0} {}
+struct dbExport_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR dbExport_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~dbExport_ResponseDefaultTypeInternal() {}
+  union {
+    dbExport_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 dbExport_ResponseDefaultTypeInternal _dbExport_Response_default_instance_;
 PROTOBUF_CONSTEXPR managerGet_Request::managerGet_Request(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
@@ -199,6 +262,7 @@ PROTOBUF_CONSTEXPR managerDump_Request::managerDump_Request(
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cursor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/0u
   , /*decltype(_impl_.records_)*/0u} {}
 struct managerDump_RequestDefaultTypeInternal {
@@ -216,6 +280,7 @@ PROTOBUF_CONSTEXPR managerDump_Response::managerDump_Response(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.entries_)*/{}
   , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.next_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.status_)*/0} {}
 struct managerDump_ResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR managerDump_ResponseDefaultTypeInternal()
@@ -226,12 +291,43 @@ struct managerDump_ResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 managerDump_ResponseDefaultTypeInternal _managerDump_Response_default_instance_;
+PROTOBUF_CONSTEXPR managerStats_Request::managerStats_Request(
+    ::_pbi::ConstantInitialized) {}
+struct managerStats_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR managerStats_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~managerStats_RequestDefaultTypeInternal() {}
+  union {
+    managerStats_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 managerStats_RequestDefaultTypeInternal _managerStats_Request_default_instance_;
+PROTOBUF_CONSTEXPR managerStats_Response::managerStats_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.block_cache_usage_)*/uint64_t{0u}
+  , /*decltype(_impl_.block_cache_capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_.block_cache_hit_)*/uint64_t{0u}
+  , /*decltype(_impl_.block_cache_miss_)*/uint64_t{0u}
+  , /*decltype(_impl_.block_cache_hit_ratio_)*/0
+  , /*decltype(_impl_.status_)*/0} {}
+struct managerStats_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR managerStats_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~managerStats_ResponseDefaultTypeInternal() {}
+  union {
+    managerStats_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 managerStats_ResponseDefaultTypeInternal _managerStats_Response_default_instance_;
 }  // namespace kvdb
 }  // namespace engine
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_kvdb_2eproto[13];
+static ::_pb::Metadata file_level_metadata_kvdb_2eproto[19];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_kvdb_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_kvdb_2eproto = nullptr;
 
@@ -278,10 +374,12 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.prefix_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Request, _impl_.cursor_),
   0,
   1,
-  2,
   3,
+  4,
+  2,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -291,9 +389,11 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbSearch_Response, _impl_.next_),
   ~0u,
   0,
   ~0u,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbDelete_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbDelete_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -314,6 +414,48 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbPut_Request, _impl_.entry_),
   0,
   1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Request, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Request, _impl_.content_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbImport_Response, _impl_.imported_),
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Request, _impl_.name_),
+  0,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::dbExport_Response, _impl_.content_),
+  ~0u,
+  0,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerGet_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerGet_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -363,9 +505,11 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Request, _impl_.cursor_),
   0,
-  1,
   2,
+  3,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -375,24 +519,58 @@ const uint32_t TableStruct_kvdb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(pro
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.entries_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerDump_Response, _impl_.next_),
   ~0u,
   0,
   ~0u,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.block_cache_usage_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.block_cache_capacity_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.block_cache_hit_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.block_cache_miss_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::kvdb::managerStats_Response, _impl_.block_cache_hit_ratio_),
+  ~0u,
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 8, -1, sizeof(::com::wazuh::api::engine::kvdb::Entry)},
   { 10, 18, -1, sizeof(::com::wazuh::api::engine::kvdb::dbGet_Request)},
   { 20, 29, -1, sizeof(::com::wazuh::api::engine::kvdb::dbGet_Response)},
-  { 32, 42, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Request)},
-  { 46, 55, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Response)},
-  { 58, 66, -1, sizeof(::com::wazuh::api::engine::kvdb::dbDelete_Request)},
-  { 68, 76, -1, sizeof(::com::wazuh::api::engine::kvdb::dbPut_Request)},
-  { 78, 86, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Request)},
-  { 88, 97, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Response)},
-  { 100, 108, -1, sizeof(::com::wazuh::api::engine::kvdb::managerPost_Request)},
-  { 110, 117, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDelete_Request)},
-  { 118, 127, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Request)},
-  { 130, 139, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Response)},
+  { 32, 43, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Request)},
+  { 48, 58, -1, sizeof(::com::wazuh::api::engine::kvdb::dbSearch_Response)},
+  { 62, 70, -1, sizeof(::com::wazuh::api::engine::kvdb::dbDelete_Request)},
+  { 72, 80, -1, sizeof(::com::wazuh::api::engine::kvdb::dbPut_Request)},
+  { 82, 90, -1, sizeof(::com::wazuh::api::engine::kvdb::dbImport_Request)},
+  { 92, 101, -1, sizeof(::com::wazuh::api::engine::kvdb::dbImport_Response)},
+  { 104, 111, -1, sizeof(::com::wazuh::api::engine::kvdb::dbExport_Request)},
+  { 112, 121, -1, sizeof(::com::wazuh::api::engine::kvdb::dbExport_Response)},
+  { 124, 132, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Request)},
+  { 134, 143, -1, sizeof(::com::wazuh::api::engine::kvdb::managerGet_Response)},
+  { 146, 154, -1, sizeof(::com::wazuh::api::engine::kvdb::managerPost_Request)},
+  { 156, 163, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDelete_Request)},
+  { 164, 174, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Request)},
+  { 178, 188, -1, sizeof(::com::wazuh::api::engine::kvdb::managerDump_Response)},
+  { 192, -1, -1, sizeof(::com::wazuh::api::engine::kvdb::managerStats_Request)},
+  { 198, 211, -1, sizeof(::com::wazuh::api::engine::kvdb::managerStats_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -403,12 +581,18 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::kvdb::_dbSearch_Response_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_dbDelete_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_dbPut_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_dbImport_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_dbImport_Response_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_dbExport_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_dbExport_Response_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerGet_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerPost_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerDelete_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerDump_Request_default_instance_._instance,
   &::com::wazuh::api::engine::kvdb::_managerDump_Response_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_managerStats_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::kvdb::_managerStats_Response_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_kvdb_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -421,35 +605,59 @@ const char descriptor_table_protodef_kvdb_2eproto[] PROTOBUF_SECTION_VARIABLE(pr
   "key\"\230\001\n\016dbGet_Response\0222\n\006status\030\001 \001(\0162\""
   ".com.wazuh.api.engine.ReturnStatus\022\022\n\005er"
   "ror\030\002 \001(\tH\000\210\001\001\022*\n\005value\030\003 \001(\0132\026.google.p"
-  "rotobuf.ValueH\001\210\001\001B\010\n\006_errorB\010\n\006_value\"\214"
+  "rotobuf.ValueH\001\210\001\001B\010\n\006_errorB\010\n\006_value\"\254"
   "\001\n\020dbSearch_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\023"
   "\n\006prefix\030\002 \001(\tH\001\210\001\001\022\021\n\004page\030\003 \001(\rH\002\210\001\001\022\024"
-  "\n\007records\030\004 \001(\rH\003\210\001\001B\007\n\005_nameB\t\n\007_prefix"
-  "B\007\n\005_pageB\n\n\010_records\"\230\001\n\021dbSearch_Respo"
+  "\n\007records\030\004 \001(\rH\003\210\001\001\022\023\n\006cursor\030\005 \001(\tH\004\210\001"
+  "\001B\007\n\005_nameB\t\n\007_prefixB\007\n\005_pageB\n\n\010_recor"
+  "dsB\t\n\007_cursor\"\264\001\n\021dbSearch_Response\0222\n\006s"
+  "tatus\030\001 \001(\0162\".com.wazuh.api.engine.Retur"
+  "nStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007entries\030\003"
+  " \003(\0132 .com.wazuh.api.engine.kvdb.Entry\022\021"
+  "\n\004next\030\004 \001(\tH\001\210\001\001B\010\n\006_errorB\007\n\005_next\"H\n\020"
+  "dbDelete_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\020\n\003k"
+  "ey\030\002 \001(\tH\001\210\001\001B\007\n\005_nameB\006\n\004_key\"k\n\rdbPut_"
+  "Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001\0224\n\005entry\030\002 \001("
+  "\0132 .com.wazuh.api.engine.kvdb.EntryH\001\210\001\001"
+  "B\007\n\005_nameB\010\n\006_entry\"P\n\020dbImport_Request\022"
+  "\021\n\004name\030\001 \001(\tH\000\210\001\001\022\024\n\007content\030\002 \001(\tH\001\210\001\001"
+  "B\007\n\005_nameB\n\n\010_content\"\211\001\n\021dbImport_Respo"
   "nse\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engi"
-  "ne.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007e"
-  "ntries\030\003 \003(\0132 .com.wazuh.api.engine.kvdb"
-  ".EntryB\010\n\006_error\"H\n\020dbDelete_Request\022\021\n\004"
-  "name\030\001 \001(\tH\000\210\001\001\022\020\n\003key\030\002 \001(\tH\001\210\001\001B\007\n\005_na"
-  "meB\006\n\004_key\"k\n\rdbPut_Request\022\021\n\004name\030\001 \001("
-  "\tH\000\210\001\001\0224\n\005entry\030\002 \001(\0132 .com.wazuh.api.en"
-  "gine.kvdb.EntryH\001\210\001\001B\007\n\005_nameB\010\n\006_entry\""
-  "\\\n\022managerGet_Request\022\026\n\016must_be_loaded\030"
-  "\001 \001(\010\022\033\n\016filter_by_name\030\020 \001(\tH\000\210\001\001B\021\n\017_f"
-  "ilter_by_name\"t\n\023managerGet_Response\0222\n\006"
-  "status\030\001 \001(\0162\".com.wazuh.api.engine.Retu"
-  "rnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\013\n\003dbs\030\003 \003("
-  "\tB\010\n\006_error\"M\n\023managerPost_Request\022\021\n\004na"
-  "me\030\001 \001(\tH\000\210\001\001\022\021\n\004path\030\002 \001(\tH\001\210\001\001B\007\n\005_nam"
-  "eB\007\n\005_path\"3\n\025managerDelete_Request\022\021\n\004n"
-  "ame\030\001 \001(\tH\000\210\001\001B\007\n\005_name\"o\n\023managerDump_R"
-  "equest\022\021\n\004name\030\001 \001(\tH\000\210\001\001\022\021\n\004page\030\002 \001(\rH"
-  "\001\210\001\001\022\024\n\007records\030\003 \001(\rH\002\210\001\001B\007\n\005_nameB\007\n\005_"
-  "pageB\n\n\010_records\"\233\001\n\024managerDump_Respons"
-  "e\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engine"
-  ".ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\007ent"
-  "ries\030\003 \003(\0132 .com.wazuh.api.engine.kvdb.E"
-  "ntryB\010\n\006_errorb\006proto3"
+  "ne.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\025\n\010i"
+  "mported\030\003 \001(\rH\001\210\001\001B\010\n\006_errorB\013\n\t_importe"
+  "d\".\n\020dbExport_Request\022\021\n\004name\030\001 \001(\tH\000\210\001\001"
+  "B\007\n\005_name\"\207\001\n\021dbExport_Response\0222\n\006statu"
+  "s\030\001 \001(\0162\".com.wazuh.api.engine.ReturnSta"
+  "tus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\024\n\007content\030\003 \001(\t"
+  "H\001\210\001\001B\010\n\006_errorB\n\n\010_content\"\\\n\022managerGe"
+  "t_Request\022\026\n\016must_be_loaded\030\001 \001(\010\022\033\n\016fil"
+  "ter_by_name\030\020 \001(\tH\000\210\001\001B\021\n\017_filter_by_nam"
+  "e\"t\n\023managerGet_Response\0222\n\006status\030\001 \001(\016"
+  "2\".com.wazuh.api.engine.ReturnStatus\022\022\n\005"
+  "error\030\002 \001(\tH\000\210\001\001\022\013\n\003dbs\030\003 \003(\tB\010\n\006_error\""
+  "M\n\023managerPost_Request\022\021\n\004name\030\001 \001(\tH\000\210\001"
+  "\001\022\021\n\004path\030\002 \001(\tH\001\210\001\001B\007\n\005_nameB\007\n\005_path\"3"
+  "\n\025managerDelete_Request\022\021\n\004name\030\001 \001(\tH\000\210"
+  "\001\001B\007\n\005_name\"\217\001\n\023managerDump_Request\022\021\n\004n"
+  "ame\030\001 \001(\tH\000\210\001\001\022\021\n\004page\030\002 \001(\rH\001\210\001\001\022\024\n\007rec"
+  "ords\030\003 \001(\rH\002\210\001\001\022\023\n\006cursor\030\004 \001(\tH\003\210\001\001B\007\n\005"
+  "_nameB\007\n\005_pageB\n\n\010_recordsB\t\n\007_cursor\"\267\001"
+  "\n\024managerDump_Response\0222\n\006status\030\001 \001(\0162\""
+  ".com.wazuh.api.engine.ReturnStatus\022\022\n\005er"
+  "ror\030\002 \001(\tH\000\210\001\001\0221\n\007entries\030\003 \003(\0132 .com.wa"
+  "zuh.api.engine.kvdb.Entry\022\021\n\004next\030\004 \001(\tH"
+  "\001\210\001\001B\010\n\006_errorB\007\n\005_next\"\026\n\024managerStats_"
+  "Request\"\377\002\n\025managerStats_Response\0222\n\006sta"
+  "tus\030\001 \001(\0162\".com.wazuh.api.engine.ReturnS"
+  "tatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\036\n\021block_cache"
+  "_usage\030\003 \001(\004H\001\210\001\001\022!\n\024block_cache_capacit"
+  "y\030\004 \001(\004H\002\210\001\001\022\034\n\017block_cache_hit\030\005 \001(\004H\003\210"
+  "\001\001\022\035\n\020block_cache_miss\030\006 \001(\004H\004\210\001\001\022\"\n\025blo"
+  "ck_cache_hit_ratio\030\007 \001(\001H\005\210\001\001B\010\n\006_errorB"
+  "\024\n\022_block_cache_usageB\027\n\025_block_cache_ca"
+  "pacityB\022\n\020_block_cache_hitB\023\n\021_block_cac"
+  "he_missB\030\n\026_block_cache_hit_ratiob\006proto"
+  "3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_kvdb_2eproto_deps[2] = {
   &::descriptor_table_engine_2eproto,
@@ -457,9 +665,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_kvdb_2eproto_deps[2
 };
 static ::_pbi::once_flag descriptor_table_kvdb_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_kvdb_2eproto = {
-    false, false, 1502, descriptor_table_protodef_kvdb_2eproto,
+    false, false, 2441, descriptor_table_protodef_kvdb_2eproto,
     "kvdb.proto",
-    &descriptor_table_kvdb_2eproto_once, descriptor_table_kvdb_2eproto_deps, 2, 13,
+    &descriptor_table_kvdb_2eproto_once, descriptor_table_kvdb_2eproto_deps, 2, 19,
     schemas, file_default_instances, TableStruct_kvdb_2eproto::offsets,
     file_level_metadata_kvdb_2eproto, file_level_enum_descriptors_kvdb_2eproto,
     file_level_service_descriptors_kvdb_2eproto,
@@ -1347,10 +1555,13 @@ class dbSearch_Request::_Internal {
     (*has_bits)[0] |= 2u;
   }
   static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
+    (*has_bits)[0] |= 8u;
   }
   static void set_has_records(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
 };
 
@@ -1368,6 +1579,7 @@ dbSearch_Request::dbSearch_Request(const dbSearch_Request& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
     , decltype(_impl_.prefix_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){}
     , decltype(_impl_.records_){}};
 
@@ -1388,6 +1600,14 @@ dbSearch_Request::dbSearch_Request(const dbSearch_Request& from)
     _this->_impl_.prefix_.Set(from._internal_prefix(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
   ::memcpy(&_impl_.page_, &from._impl_.page_,
     static_cast<size_t>(reinterpret_cast<char*>(&_impl_.records_) -
     reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -1403,6 +1623,7 @@ inline void dbSearch_Request::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
     , decltype(_impl_.prefix_){}
+    , decltype(_impl_.cursor_){}
     , decltype(_impl_.page_){0u}
     , decltype(_impl_.records_){0u}
   };
@@ -1414,6 +1635,10 @@ inline void dbSearch_Request::SharedCtor(
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.prefix_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 dbSearch_Request::~dbSearch_Request() {
@@ -1429,6 +1654,7 @@ inline void dbSearch_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
   _impl_.prefix_.Destroy();
+  _impl_.cursor_.Destroy();
 }
 
 void dbSearch_Request::SetCachedSize(int size) const {
@@ -1442,15 +1668,18 @@ void dbSearch_Request::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x00000007u) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.name_.ClearNonDefaultToEmpty();
     }
     if (cached_has_bits & 0x00000002u) {
       _impl_.prefix_.ClearNonDefaultToEmpty();
     }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
   }
-  if (cached_has_bits & 0x0000000cu) {
+  if (cached_has_bits & 0x00000018u) {
     ::memset(&_impl_.page_, 0, static_cast<size_t>(
         reinterpret_cast<char*>(&_impl_.records_) -
         reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
@@ -1504,6 +1733,16 @@ const char* dbSearch_Request::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // optional string cursor = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbSearch_Request.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1566,6 +1805,16 @@ uint8_t* dbSearch_Request::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_records(), target);
   }
 
+  // optional string cursor = 5;
+  if (_internal_has_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.dbSearch_Request.cursor");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_cursor(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1583,7 +1832,7 @@ size_t dbSearch_Request::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000001fu) {
     // optional string name = 1;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -1598,13 +1847,20 @@ size_t dbSearch_Request::ByteSizeLong() const {
           this->_internal_prefix());
     }
 
-    // optional uint32 page = 3;
+    // optional string cursor = 5;
     if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional uint32 page = 3;
+    if (cached_has_bits & 0x00000008u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
     }
 
     // optional uint32 records = 4;
-    if (cached_has_bits & 0x00000008u) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_records());
     }
 
@@ -1628,7 +1884,7 @@ void dbSearch_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000001fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_name(from._internal_name());
     }
@@ -1636,9 +1892,12 @@ void dbSearch_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
       _this->_internal_set_prefix(from._internal_prefix());
     }
     if (cached_has_bits & 0x00000004u) {
-      _this->_impl_.page_ = from._impl_.page_;
+      _this->_internal_set_cursor(from._internal_cursor());
     }
     if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.page_ = from._impl_.page_;
+    }
+    if (cached_has_bits & 0x00000010u) {
       _this->_impl_.records_ = from._impl_.records_;
     }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
@@ -1671,6 +1930,10 @@ void dbSearch_Request::InternalSwap(dbSearch_Request* other) {
       &_impl_.prefix_, lhs_arena,
       &other->_impl_.prefix_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
       PROTOBUF_FIELD_OFFSET(dbSearch_Request, _impl_.records_)
       + sizeof(dbSearch_Request::_impl_.records_)
@@ -1693,6 +1956,9 @@ class dbSearch_Response::_Internal {
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_next(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 dbSearch_Response::dbSearch_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -1709,6 +1975,7 @@ dbSearch_Response::dbSearch_Response(const dbSearch_Response& from)
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){from._impl_.entries_}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_){}
     , decltype(_impl_.status_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1720,6 +1987,14 @@ dbSearch_Response::dbSearch_Response(const dbSearch_Response& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.next_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_next()) {
+    _this->_impl_.next_.Set(from._internal_next(), 
+      _this->GetArenaForAllocation());
+  }
   _this->_impl_.status_ = from._impl_.status_;
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.dbSearch_Response)
 }
@@ -1733,12 +2008,17 @@ inline void dbSearch_Response::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.entries_){arena}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.next_){}
     , decltype(_impl_.status_){0}
   };
   _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.error_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.next_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 dbSearch_Response::~dbSearch_Response() {
@@ -1754,6 +2034,7 @@ inline void dbSearch_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.entries_.~RepeatedPtrField();
   _impl_.error_.Destroy();
+  _impl_.next_.Destroy();
 }
 
 void dbSearch_Response::SetCachedSize(int size) const {
@@ -1768,8 +2049,13 @@ void dbSearch_Response::Clear() {
 
   _impl_.entries_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.next_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
@@ -1815,6 +2101,16 @@ const char* dbSearch_Response::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
+      // optional string next = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_next();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbSearch_Response.next"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1870,6 +2166,16 @@ uint8_t* dbSearch_Response::_InternalSerialize(
         InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // optional string next = 4;
+  if (_internal_has_next()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next().data(), static_cast<int>(this->_internal_next().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.dbSearch_Response.next");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_next(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1893,14 +2199,23 @@ size_t dbSearch_Response::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // optional string error = 2;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional string next = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_next());
+    }
 
+  }
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   if (this->_internal_status() != 0) {
     total_size += 1 +
@@ -1926,8 +2241,14 @@ void dbSearch_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   (void) cached_has_bits;
 
   _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_next(from._internal_next());
+    }
   }
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
@@ -1957,6 +2278,10 @@ void dbSearch_Response::InternalSwap(dbSearch_Response* other) {
       &_impl_.error_, lhs_arena,
       &other->_impl_.error_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_, lhs_arena,
+      &other->_impl_.next_, rhs_arena
+  );
   swap(_impl_.status_, other->_impl_.status_);
 }
 
@@ -2516,60 +2841,74 @@ void dbPut_Request::InternalSwap(dbPut_Request* other) {
 
 // ===================================================================
 
-class managerGet_Request::_Internal {
+class dbImport_Request::_Internal {
  public:
-  using HasBits = decltype(std::declval<managerGet_Request>()._impl_._has_bits_);
-  static void set_has_filter_by_name(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<dbImport_Request>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
-managerGet_Request::managerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+dbImport_Request::dbImport_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerGet_Request)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.dbImport_Request)
 }
-managerGet_Request::managerGet_Request(const managerGet_Request& from)
+dbImport_Request::dbImport_Request(const dbImport_Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  managerGet_Request* const _this = this; (void)_this;
+  dbImport_Request* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.filter_by_name_){}
-    , decltype(_impl_.must_be_loaded_){}};
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.content_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.filter_by_name_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.filter_by_name_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_filter_by_name()) {
-    _this->_impl_.filter_by_name_.Set(from._internal_filter_by_name(), 
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.must_be_loaded_ = from._impl_.must_be_loaded_;
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerGet_Request)
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.dbImport_Request)
 }
 
-inline void managerGet_Request::SharedCtor(
+inline void dbImport_Request::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.filter_by_name_){}
-    , decltype(_impl_.must_be_loaded_){false}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.content_){}
   };
-  _impl_.filter_by_name_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.filter_by_name_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-managerGet_Request::~managerGet_Request() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerGet_Request)
+dbImport_Request::~dbImport_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.dbImport_Request)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2577,52 +2916,59 @@ managerGet_Request::~managerGet_Request() {
   SharedDtor();
 }
 
-inline void managerGet_Request::SharedDtor() {
+inline void dbImport_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.filter_by_name_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.content_.Destroy();
 }
 
-void managerGet_Request::SetCachedSize(int size) const {
+void dbImport_Request::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void managerGet_Request::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+void dbImport_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.dbImport_Request)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.filter_by_name_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.content_.ClearNonDefaultToEmpty();
+    }
   }
-  _impl_.must_be_loaded_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* managerGet_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* dbImport_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bool must_be_loaded = 1;
+      // optional string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.must_be_loaded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbImport_Request.name"));
         } else
           goto handle_unusual;
         continue;
-      // optional string filter_by_name = 16;
-      case 16:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
-          auto str = _internal_mutable_filter_by_name();
+      // optional string content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerGet_Request.filter_by_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbImport_Request.content"));
         } else
           goto handle_unusual;
         continue;
@@ -2650,109 +2996,123 @@ failure:
 #undef CHK_
 }
 
-uint8_t* managerGet_Request::_InternalSerialize(
+uint8_t* dbImport_Request::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.dbImport_Request)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bool must_be_loaded = 1;
-  if (this->_internal_must_be_loaded() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_must_be_loaded(), target);
+  // optional string name = 1;
+  if (_internal_has_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.dbImport_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
 
-  // optional string filter_by_name = 16;
-  if (_internal_has_filter_by_name()) {
+  // optional string content = 2;
+  if (_internal_has_content()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_filter_by_name().data(), static_cast<int>(this->_internal_filter_by_name().length()),
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerGet_Request.filter_by_name");
+      "com.wazuh.api.engine.kvdb.dbImport_Request.content");
     target = stream->WriteStringMaybeAliased(
-        16, this->_internal_filter_by_name(), target);
+        2, this->_internal_content(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerGet_Request)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.dbImport_Request)
   return target;
 }
 
-size_t managerGet_Request::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+size_t dbImport_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.dbImport_Request)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string filter_by_name = 16;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_filter_by_name());
-  }
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
 
-  // bool must_be_loaded = 1;
-  if (this->_internal_must_be_loaded() != 0) {
-    total_size += 1 + 1;
-  }
+    // optional string content = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_content());
+    }
 
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerGet_Request::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData dbImport_Request::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    managerGet_Request::MergeImpl
+    dbImport_Request::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerGet_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*dbImport_Request::GetClassData() const { return &_class_data_; }
 
 
-void managerGet_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<managerGet_Request*>(&to_msg);
-  auto& from = static_cast<const managerGet_Request&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+void dbImport_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<dbImport_Request*>(&to_msg);
+  auto& from = static_cast<const dbImport_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.dbImport_Request)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_filter_by_name()) {
-    _this->_internal_set_filter_by_name(from._internal_filter_by_name());
-  }
-  if (from._internal_must_be_loaded() != 0) {
-    _this->_internal_set_must_be_loaded(from._internal_must_be_loaded());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_content(from._internal_content());
+    }
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void managerGet_Request::CopyFrom(const managerGet_Request& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+void dbImport_Request::CopyFrom(const dbImport_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.dbImport_Request)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool managerGet_Request::IsInitialized() const {
+bool dbImport_Request::IsInitialized() const {
   return true;
 }
 
-void managerGet_Request::InternalSwap(managerGet_Request* other) {
+void dbImport_Request::InternalSwap(dbImport_Request* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.filter_by_name_, lhs_arena,
-      &other->_impl_.filter_by_name_, rhs_arena
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
   );
-  swap(_impl_.must_be_loaded_, other->_impl_.must_be_loaded_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata managerGet_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata dbImport_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
       file_level_metadata_kvdb_2eproto[7]);
@@ -2760,29 +3120,32 @@ void managerGet_Request::InternalSwap(managerGet_Request* other) {
 
 // ===================================================================
 
-class managerGet_Response::_Internal {
+class dbImport_Response::_Internal {
  public:
-  using HasBits = decltype(std::declval<managerGet_Response>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<dbImport_Response>()._impl_._has_bits_);
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_imported(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
-managerGet_Response::managerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+dbImport_Response::dbImport_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerGet_Response)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.dbImport_Response)
 }
-managerGet_Response::managerGet_Response(const managerGet_Response& from)
+dbImport_Response::dbImport_Response(const dbImport_Response& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  managerGet_Response* const _this = this; (void)_this;
+  dbImport_Response* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.dbs_){from._impl_.dbs_}
     , decltype(_impl_.error_){}
-    , decltype(_impl_.status_){}};
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.imported_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.error_.InitDefault();
@@ -2793,20 +3156,22 @@ managerGet_Response::managerGet_Response(const managerGet_Response& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.status_ = from._impl_.status_;
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerGet_Response)
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.imported_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.imported_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.dbImport_Response)
 }
 
-inline void managerGet_Response::SharedCtor(
+inline void dbImport_Response::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.dbs_){arena}
     , decltype(_impl_.error_){}
     , decltype(_impl_.status_){0}
+    , decltype(_impl_.imported_){0u}
   };
   _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2814,8 +3179,8 @@ inline void managerGet_Response::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-managerGet_Response::~managerGet_Response() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerGet_Response)
+dbImport_Response::~dbImport_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.dbImport_Response)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2823,33 +3188,32 @@ managerGet_Response::~managerGet_Response() {
   SharedDtor();
 }
 
-inline void managerGet_Response::SharedDtor() {
+inline void dbImport_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.dbs_.~RepeatedPtrField();
   _impl_.error_.Destroy();
 }
 
-void managerGet_Response::SetCachedSize(int size) const {
+void dbImport_Response::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void managerGet_Response::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+void dbImport_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.dbImport_Response)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.dbs_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     _impl_.error_.ClearNonDefaultToEmpty();
   }
   _impl_.status_ = 0;
+  _impl_.imported_ = 0u;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* managerGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* dbImport_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -2871,22 +3235,16 @@ const char* managerGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_error();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerGet_Response.error"));
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbImport_Response.error"));
         } else
           goto handle_unusual;
         continue;
-      // repeated string dbs = 3;
+      // optional uint32 imported = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_dbs();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerGet_Response.dbs"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_imported(&has_bits);
+          _impl_.imported_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -2914,9 +3272,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* managerGet_Response::_InternalSerialize(
+uint8_t* dbImport_Response::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.dbImport_Response)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -2932,45 +3290,33 @@ uint8_t* managerGet_Response::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerGet_Response.error");
+      "com.wazuh.api.engine.kvdb.dbImport_Response.error");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_error(), target);
   }
 
-  // repeated string dbs = 3;
-  for (int i = 0, n = this->_internal_dbs_size(); i < n; i++) {
-    const auto& s = this->_internal_dbs(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerGet_Response.dbs");
-    target = stream->WriteString(3, s, target);
+  // optional uint32 imported = 3;
+  if (_internal_has_imported()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_imported(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerGet_Response)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.dbImport_Response)
   return target;
 }
 
-size_t managerGet_Response::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+size_t dbImport_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.dbImport_Response)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string dbs = 3;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.dbs_.size());
-  for (int i = 0, n = _impl_.dbs_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.dbs_.Get(i));
-  }
-
   // optional string error = 2;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
@@ -2985,60 +3331,71 @@ size_t managerGet_Response::ByteSizeLong() const {
       ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
+  // optional uint32 imported = 3;
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_imported());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerGet_Response::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData dbImport_Response::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    managerGet_Response::MergeImpl
+    dbImport_Response::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerGet_Response::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*dbImport_Response::GetClassData() const { return &_class_data_; }
 
 
-void managerGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<managerGet_Response*>(&to_msg);
-  auto& from = static_cast<const managerGet_Response&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+void dbImport_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<dbImport_Response*>(&to_msg);
+  auto& from = static_cast<const dbImport_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.dbImport_Response)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.dbs_.MergeFrom(from._impl_.dbs_);
   if (from._internal_has_error()) {
     _this->_internal_set_error(from._internal_error());
   }
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
   }
+  if (from._internal_has_imported()) {
+    _this->_internal_set_imported(from._internal_imported());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void managerGet_Response::CopyFrom(const managerGet_Response& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+void dbImport_Response::CopyFrom(const dbImport_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.dbImport_Response)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool managerGet_Response::IsInitialized() const {
+bool dbImport_Response::IsInitialized() const {
   return true;
 }
 
-void managerGet_Response::InternalSwap(managerGet_Response* other) {
+void dbImport_Response::InternalSwap(dbImport_Response* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.dbs_.InternalSwap(&other->_impl_.dbs_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.error_, lhs_arena,
       &other->_impl_.error_, rhs_arena
   );
-  swap(_impl_.status_, other->_impl_.status_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(dbImport_Response, _impl_.imported_)
+      + sizeof(dbImport_Response::_impl_.imported_)
+      - PROTOBUF_FIELD_OFFSET(dbImport_Response, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata managerGet_Response::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata dbImport_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
       file_level_metadata_kvdb_2eproto[8]);
@@ -3046,31 +3403,27 @@ void managerGet_Response::InternalSwap(managerGet_Response* other) {
 
 // ===================================================================
 
-class managerPost_Request::_Internal {
+class dbExport_Request::_Internal {
  public:
-  using HasBits = decltype(std::declval<managerPost_Request>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<dbExport_Request>()._impl_._has_bits_);
   static void set_has_name(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_path(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
 };
 
-managerPost_Request::managerPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+dbExport_Request::dbExport_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerPost_Request)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.dbExport_Request)
 }
-managerPost_Request::managerPost_Request(const managerPost_Request& from)
+dbExport_Request::dbExport_Request(const dbExport_Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  managerPost_Request* const _this = this; (void)_this;
+  dbExport_Request* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.name_){}
-    , decltype(_impl_.path_){}};
+    , decltype(_impl_.name_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.name_.InitDefault();
@@ -3081,18 +3434,10 @@ managerPost_Request::managerPost_Request(const managerPost_Request& from)
     _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.path_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.path_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_path()) {
-    _this->_impl_.path_.Set(from._internal_path(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerPost_Request)
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.dbExport_Request)
 }
 
-inline void managerPost_Request::SharedCtor(
+inline void dbExport_Request::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -3100,20 +3445,15 @@ inline void managerPost_Request::SharedCtor(
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.name_){}
-    , decltype(_impl_.path_){}
   };
   _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.path_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.path_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-managerPost_Request::~managerPost_Request() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerPost_Request)
+dbExport_Request::~dbExport_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.dbExport_Request)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3121,36 +3461,30 @@ managerPost_Request::~managerPost_Request() {
   SharedDtor();
 }
 
-inline void managerPost_Request::SharedDtor() {
+inline void dbExport_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.name_.Destroy();
-  _impl_.path_.Destroy();
 }
 
-void managerPost_Request::SetCachedSize(int size) const {
+void dbExport_Request::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void managerPost_Request::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+void dbExport_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.dbExport_Request)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.path_.ClearNonDefaultToEmpty();
-    }
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* managerPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* dbExport_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -3163,17 +3497,7 @@ const char* managerPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerPost_Request.name"));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string path = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_path();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerPost_Request.path"));
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbExport_Request.name"));
         } else
           goto handle_unusual;
         continue;
@@ -3201,9 +3525,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* managerPost_Request::_InternalSerialize(
+uint8_t* dbExport_Request::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.dbExport_Request)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3212,96 +3536,71 @@ uint8_t* managerPost_Request::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerPost_Request.name");
+      "com.wazuh.api.engine.kvdb.dbExport_Request.name");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_name(), target);
   }
 
-  // optional string path = 2;
-  if (_internal_has_path()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerPost_Request.path");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_path(), target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerPost_Request)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.dbExport_Request)
   return target;
 }
 
-size_t managerPost_Request::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+size_t dbExport_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.dbExport_Request)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // optional string name = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    // optional string name = 1;
-    if (cached_has_bits & 0x00000001u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_name());
-    }
-
-    // optional string path = 2;
-    if (cached_has_bits & 0x00000002u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_path());
-    }
-
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerPost_Request::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData dbExport_Request::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    managerPost_Request::MergeImpl
+    dbExport_Request::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerPost_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*dbExport_Request::GetClassData() const { return &_class_data_; }
 
 
-void managerPost_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<managerPost_Request*>(&to_msg);
-  auto& from = static_cast<const managerPost_Request&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+void dbExport_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<dbExport_Request*>(&to_msg);
+  auto& from = static_cast<const dbExport_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.dbExport_Request)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_name(from._internal_name());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_path(from._internal_path());
-    }
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void managerPost_Request::CopyFrom(const managerPost_Request& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+void dbExport_Request::CopyFrom(const dbExport_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.dbExport_Request)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool managerPost_Request::IsInitialized() const {
+bool dbExport_Request::IsInitialized() const {
   return true;
 }
 
-void managerPost_Request::InternalSwap(managerPost_Request* other) {
+void dbExport_Request::InternalSwap(dbExport_Request* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -3311,13 +3610,9 @@ void managerPost_Request::InternalSwap(managerPost_Request* other) {
       &_impl_.name_, lhs_arena,
       &other->_impl_.name_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.path_, lhs_arena,
-      &other->_impl_.path_, rhs_arena
-  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata managerPost_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata dbExport_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
       file_level_metadata_kvdb_2eproto[9]);
@@ -3325,57 +3620,77 @@ void managerPost_Request::InternalSwap(managerPost_Request* other) {
 
 // ===================================================================
 
-class managerDelete_Request::_Internal {
+class dbExport_Response::_Internal {
  public:
-  using HasBits = decltype(std::declval<managerDelete_Request>()._impl_._has_bits_);
-  static void set_has_name(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<dbExport_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_content(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
-managerDelete_Request::managerDelete_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+dbExport_Response::dbExport_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.dbExport_Response)
 }
-managerDelete_Request::managerDelete_Request(const managerDelete_Request& from)
+dbExport_Response::dbExport_Response(const dbExport_Response& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  managerDelete_Request* const _this = this; (void)_this;
+  dbExport_Response* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.name_){}};
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.status_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.name_.InitDefault();
+  _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
+    _impl_.error_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_name()) {
-    _this->_impl_.name_.Set(from._internal_name(), 
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_content()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.dbExport_Response)
 }
 
-inline void managerDelete_Request::SharedCtor(
+inline void dbExport_Response::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.name_){}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.status_){0}
   };
-  _impl_.name_.InitDefault();
+  _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-managerDelete_Request::~managerDelete_Request() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerDelete_Request)
+dbExport_Response::~dbExport_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.dbExport_Response)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3383,43 +3698,69 @@ managerDelete_Request::~managerDelete_Request() {
   SharedDtor();
 }
 
-inline void managerDelete_Request::SharedDtor() {
+inline void dbExport_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.name_.Destroy();
+  _impl_.error_.Destroy();
+  _impl_.content_.Destroy();
 }
 
-void managerDelete_Request::SetCachedSize(int size) const {
+void dbExport_Response::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void managerDelete_Request::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+void dbExport_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.dbExport_Response)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.name_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.content_.ClearNonDefaultToEmpty();
+    }
   }
+  _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* managerDelete_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* dbExport_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional string name = 1;
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_name();
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDelete_Request.name"));
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbExport_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string content = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.dbExport_Response.content"));
         } else
           goto handle_unusual;
         continue;
@@ -3447,94 +3788,140 @@ failure:
 #undef CHK_
 }
 
-uint8_t* managerDelete_Request::_InternalSerialize(
+uint8_t* dbExport_Response::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.dbExport_Response)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // optional string name = 1;
-  if (_internal_has_name()) {
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerDelete_Request.name");
+      "com.wazuh.api.engine.kvdb.dbExport_Response.error");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_name(), target);
+        2, this->_internal_error(), target);
+  }
+
+  // optional string content = 3;
+  if (_internal_has_content()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.dbExport_Response.content");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_content(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.dbExport_Response)
   return target;
 }
 
-size_t managerDelete_Request::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+size_t dbExport_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.dbExport_Response)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional string name = 1;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional string content = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_content());
+    }
+
+  }
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerDelete_Request::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData dbExport_Response::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    managerDelete_Request::MergeImpl
+    dbExport_Response::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerDelete_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*dbExport_Response::GetClassData() const { return &_class_data_; }
 
 
-void managerDelete_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<managerDelete_Request*>(&to_msg);
-  auto& from = static_cast<const managerDelete_Request&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+void dbExport_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<dbExport_Response*>(&to_msg);
+  auto& from = static_cast<const dbExport_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.dbExport_Response)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_name()) {
-    _this->_internal_set_name(from._internal_name());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_content(from._internal_content());
+    }
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void managerDelete_Request::CopyFrom(const managerDelete_Request& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+void dbExport_Response::CopyFrom(const dbExport_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.dbExport_Response)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool managerDelete_Request::IsInitialized() const {
+bool dbExport_Response::IsInitialized() const {
   return true;
 }
 
-void managerDelete_Request::InternalSwap(managerDelete_Request* other) {
+void dbExport_Response::InternalSwap(dbExport_Response* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.name_, lhs_arena,
-      &other->_impl_.name_, rhs_arena
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
   );
+  swap(_impl_.status_, other->_impl_.status_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata managerDelete_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata dbExport_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
       file_level_metadata_kvdb_2eproto[10]);
@@ -3542,70 +3929,60 @@ void managerDelete_Request::InternalSwap(managerDelete_Request* other) {
 
 // ===================================================================
 
-class managerDump_Request::_Internal {
+class managerGet_Request::_Internal {
  public:
-  using HasBits = decltype(std::declval<managerDump_Request>()._impl_._has_bits_);
-  static void set_has_name(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<managerGet_Request>()._impl_._has_bits_);
+  static void set_has_filter_by_name(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static void set_has_records(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
 };
 
-managerDump_Request::managerDump_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+managerGet_Request::managerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerDump_Request)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerGet_Request)
 }
-managerDump_Request::managerDump_Request(const managerDump_Request& from)
+managerGet_Request::managerGet_Request(const managerGet_Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  managerDump_Request* const _this = this; (void)_this;
+  managerGet_Request* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.name_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.records_){}};
+    , decltype(_impl_.filter_by_name_){}
+    , decltype(_impl_.must_be_loaded_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.name_.InitDefault();
+  _impl_.filter_by_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
+    _impl_.filter_by_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_name()) {
-    _this->_impl_.name_.Set(from._internal_name(), 
+  if (from._internal_has_filter_by_name()) {
+    _this->_impl_.filter_by_name_.Set(from._internal_filter_by_name(), 
       _this->GetArenaForAllocation());
   }
-  ::memcpy(&_impl_.page_, &from._impl_.page_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.records_) -
-    reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDump_Request)
+  _this->_impl_.must_be_loaded_ = from._impl_.must_be_loaded_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerGet_Request)
 }
 
-inline void managerDump_Request::SharedCtor(
+inline void managerGet_Request::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.name_){}
-    , decltype(_impl_.page_){0u}
-    , decltype(_impl_.records_){0u}
+    , decltype(_impl_.filter_by_name_){}
+    , decltype(_impl_.must_be_loaded_){false}
   };
-  _impl_.name_.InitDefault();
+  _impl_.filter_by_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.name_.Set("", GetArenaForAllocation());
+    _impl_.filter_by_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-managerDump_Request::~managerDump_Request() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerDump_Request)
+managerGet_Request::~managerGet_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerGet_Request)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3613,66 +3990,1479 @@ managerDump_Request::~managerDump_Request() {
   SharedDtor();
 }
 
-inline void managerDump_Request::SharedDtor() {
+inline void managerGet_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.name_.Destroy();
+  _impl_.filter_by_name_.Destroy();
 }
 
-void managerDump_Request::SetCachedSize(int size) const {
+void managerGet_Request::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void managerDump_Request::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+void managerGet_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerGet_Request)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    _impl_.name_.ClearNonDefaultToEmpty();
-  }
-  if (cached_has_bits & 0x00000006u) {
-    ::memset(&_impl_.page_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&_impl_.records_) -
-        reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
+    _impl_.filter_by_name_.ClearNonDefaultToEmpty();
   }
+  _impl_.must_be_loaded_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* managerDump_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* managerGet_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional string name = 1;
+      // bool must_be_loaded = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.must_be_loaded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Request.name"));
         } else
           goto handle_unusual;
         continue;
-      // optional uint32 page = 2;
+      // optional string filter_by_name = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_filter_by_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerGet_Request.filter_by_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* managerGet_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool must_be_loaded = 1;
+  if (this->_internal_must_be_loaded() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_must_be_loaded(), target);
+  }
+
+  // optional string filter_by_name = 16;
+  if (_internal_has_filter_by_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_filter_by_name().data(), static_cast<int>(this->_internal_filter_by_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerGet_Request.filter_by_name");
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_filter_by_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerGet_Request)
+  return target;
+}
+
+size_t managerGet_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string filter_by_name = 16;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_filter_by_name());
+  }
+
+  // bool must_be_loaded = 1;
+  if (this->_internal_must_be_loaded() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    managerGet_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerGet_Request::GetClassData() const { return &_class_data_; }
+
+
+void managerGet_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerGet_Request*>(&to_msg);
+  auto& from = static_cast<const managerGet_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_filter_by_name()) {
+    _this->_internal_set_filter_by_name(from._internal_filter_by_name());
+  }
+  if (from._internal_must_be_loaded() != 0) {
+    _this->_internal_set_must_be_loaded(from._internal_must_be_loaded());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void managerGet_Request::CopyFrom(const managerGet_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerGet_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool managerGet_Request::IsInitialized() const {
+  return true;
+}
+
+void managerGet_Request::InternalSwap(managerGet_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.filter_by_name_, lhs_arena,
+      &other->_impl_.filter_by_name_, rhs_arena
+  );
+  swap(_impl_.must_be_loaded_, other->_impl_.must_be_loaded_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[11]);
+}
+
+// ===================================================================
+
+class managerGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+managerGet_Response::managerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerGet_Response)
+}
+managerGet_Response::managerGet_Response(const managerGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  managerGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dbs_){from._impl_.dbs_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerGet_Response)
+}
+
+inline void managerGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.dbs_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+managerGet_Response::~managerGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void managerGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dbs_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void managerGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void managerGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dbs_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* managerGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string dbs = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_dbs();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerGet_Response.dbs"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* managerGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // repeated string dbs = 3;
+  for (int i = 0, n = this->_internal_dbs_size(); i < n; i++) {
+    const auto& s = this->_internal_dbs(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerGet_Response.dbs");
+    target = stream->WriteString(3, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerGet_Response)
+  return target;
+}
+
+size_t managerGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string dbs = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.dbs_.size());
+  for (int i = 0, n = _impl_.dbs_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.dbs_.Get(i));
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    managerGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void managerGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerGet_Response*>(&to_msg);
+  auto& from = static_cast<const managerGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dbs_.MergeFrom(from._impl_.dbs_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void managerGet_Response::CopyFrom(const managerGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool managerGet_Response::IsInitialized() const {
+  return true;
+}
+
+void managerGet_Response::InternalSwap(managerGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.dbs_.InternalSwap(&other->_impl_.dbs_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerGet_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[12]);
+}
+
+// ===================================================================
+
+class managerPost_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerPost_Request>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_path(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+managerPost_Request::managerPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerPost_Request)
+}
+managerPost_Request::managerPost_Request(const managerPost_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  managerPost_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.path_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_path()) {
+    _this->_impl_.path_.Set(from._internal_path(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerPost_Request)
+}
+
+inline void managerPost_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.path_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.path_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.path_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+managerPost_Request::~managerPost_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerPost_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void managerPost_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.path_.Destroy();
+}
+
+void managerPost_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void managerPost_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.path_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* managerPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerPost_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string path = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_path();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerPost_Request.path"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* managerPost_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  if (_internal_has_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerPost_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional string path = 2;
+  if (_internal_has_path()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_path().data(), static_cast<int>(this->_internal_path().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerPost_Request.path");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_path(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerPost_Request)
+  return target;
+}
+
+size_t managerPost_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string path = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_path());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerPost_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    managerPost_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerPost_Request::GetClassData() const { return &_class_data_; }
+
+
+void managerPost_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerPost_Request*>(&to_msg);
+  auto& from = static_cast<const managerPost_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_path(from._internal_path());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void managerPost_Request::CopyFrom(const managerPost_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerPost_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool managerPost_Request::IsInitialized() const {
+  return true;
+}
+
+void managerPost_Request::InternalSwap(managerPost_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.path_, lhs_arena,
+      &other->_impl_.path_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerPost_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[13]);
+}
+
+// ===================================================================
+
+class managerDelete_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerDelete_Request>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+managerDelete_Request::managerDelete_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerDelete_Request)
+}
+managerDelete_Request::managerDelete_Request(const managerDelete_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  managerDelete_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDelete_Request)
+}
+
+inline void managerDelete_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+managerDelete_Request::~managerDelete_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void managerDelete_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void managerDelete_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void managerDelete_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* managerDelete_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDelete_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* managerDelete_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  if (_internal_has_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDelete_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  return target;
+}
+
+size_t managerDelete_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerDelete_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    managerDelete_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerDelete_Request::GetClassData() const { return &_class_data_; }
+
+
+void managerDelete_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerDelete_Request*>(&to_msg);
+  auto& from = static_cast<const managerDelete_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_name()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void managerDelete_Request::CopyFrom(const managerDelete_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool managerDelete_Request::IsInitialized() const {
+  return true;
+}
+
+void managerDelete_Request::InternalSwap(managerDelete_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerDelete_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[14]);
+}
+
+// ===================================================================
+
+class managerDump_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerDump_Request>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_page(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_records(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+managerDump_Request::managerDump_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerDump_Request)
+}
+managerDump_Request::managerDump_Request(const managerDump_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  managerDump_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.records_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_cursor()) {
+    _this->_impl_.cursor_.Set(from._internal_cursor(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.page_, &from._impl_.page_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.records_) -
+    reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDump_Request)
+}
+
+inline void managerDump_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.cursor_){}
+    , decltype(_impl_.page_){0u}
+    , decltype(_impl_.records_){0u}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cursor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+managerDump_Request::~managerDump_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerDump_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void managerDump_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.cursor_.Destroy();
+}
+
+void managerDump_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void managerDump_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.cursor_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.page_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.records_) -
+        reinterpret_cast<char*>(&_impl_.page_)) + sizeof(_impl_.records_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* managerDump_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 page = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_page(&has_bits);
+          _impl_.page_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 records = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_records(&has_bits);
+          _impl_.records_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string cursor = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_cursor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Request.cursor"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* managerDump_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  if (_internal_has_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // optional uint32 page = 2;
+  if (_internal_has_page()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_page(), target);
+  }
+
+  // optional uint32 records = 3;
+  if (_internal_has_records()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_records(), target);
+  }
+
+  // optional string cursor = 4;
+  if (_internal_has_cursor()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cursor().data(), static_cast<int>(this->_internal_cursor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Request.cursor");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_cursor(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerDump_Request)
+  return target;
+}
+
+size_t managerDump_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string name = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name());
+    }
+
+    // optional string cursor = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_cursor());
+    }
+
+    // optional uint32 page = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
+    }
+
+    // optional uint32 records = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_records());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerDump_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    managerDump_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerDump_Request::GetClassData() const { return &_class_data_; }
+
+
+void managerDump_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerDump_Request*>(&to_msg);
+  auto& from = static_cast<const managerDump_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_cursor(from._internal_cursor());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.page_ = from._impl_.page_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.records_ = from._impl_.records_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void managerDump_Request::CopyFrom(const managerDump_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool managerDump_Request::IsInitialized() const {
+  return true;
+}
+
+void managerDump_Request::InternalSwap(managerDump_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cursor_, lhs_arena,
+      &other->_impl_.cursor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(managerDump_Request, _impl_.records_)
+      + sizeof(managerDump_Request::_impl_.records_)
+      - PROTOBUF_FIELD_OFFSET(managerDump_Request, _impl_.page_)>(
+          reinterpret_cast<char*>(&_impl_.page_),
+          reinterpret_cast<char*>(&other->_impl_.page_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerDump_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[15]);
+}
+
+// ===================================================================
+
+class managerDump_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerDump_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_next(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+managerDump_Response::managerDump_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerDump_Response)
+}
+managerDump_Response::managerDump_Response(const managerDump_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  managerDump_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.next_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.next_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_next()) {
+    _this->_impl_.next_.Set(from._internal_next(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDump_Response)
+}
+
+inline void managerDump_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.entries_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.next_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.next_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.next_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+managerDump_Response::~managerDump_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerDump_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void managerDump_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+  _impl_.next_.Destroy();
+}
+
+void managerDump_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void managerDump_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerDump_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.next_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* managerDump_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _Internal::set_has_page(&has_bits);
-          _impl_.page_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Response.error"));
         } else
           goto handle_unusual;
         continue;
-      // optional uint32 records = 3;
+      // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _Internal::set_has_records(&has_bits);
-          _impl_.records_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string next = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_next();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Response.next"));
         } else
           goto handle_unusual;
         continue;
@@ -3700,163 +5490,245 @@ failure:
 #undef CHK_
 }
 
-uint8_t* managerDump_Request::_InternalSerialize(
+uint8_t* managerDump_Response::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerDump_Response)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // optional string name = 1;
-  if (_internal_has_name()) {
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerDump_Request.name");
+      "com.wazuh.api.engine.kvdb.managerDump_Response.error");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_name(), target);
+        2, this->_internal_error(), target);
   }
 
-  // optional uint32 page = 2;
-  if (_internal_has_page()) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_page(), target);
+  // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // optional uint32 records = 3;
-  if (_internal_has_records()) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_records(), target);
+  // optional string next = 4;
+  if (_internal_has_next()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_next().data(), static_cast<int>(this->_internal_next().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.kvdb.managerDump_Response.next");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_next(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerDump_Request)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerDump_Response)
   return target;
 }
 
-size_t managerDump_Request::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+size_t managerDump_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerDump_Response)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
-    // optional string name = 1;
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_name());
+          this->_internal_error());
     }
 
-    // optional uint32 page = 2;
+    // optional string next = 4;
     if (cached_has_bits & 0x00000002u) {
-      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_page());
-    }
-
-    // optional uint32 records = 3;
-    if (cached_has_bits & 0x00000004u) {
-      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_records());
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_next());
     }
 
   }
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerDump_Request::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerDump_Response::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    managerDump_Request::MergeImpl
+    managerDump_Response::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerDump_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerDump_Response::GetClassData() const { return &_class_data_; }
 
 
-void managerDump_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<managerDump_Request*>(&to_msg);
-  auto& from = static_cast<const managerDump_Request&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+void managerDump_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerDump_Response*>(&to_msg);
+  auto& from = static_cast<const managerDump_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerDump_Response)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_name(from._internal_name());
+      _this->_internal_set_error(from._internal_error());
     }
     if (cached_has_bits & 0x00000002u) {
-      _this->_impl_.page_ = from._impl_.page_;
+      _this->_internal_set_next(from._internal_next());
     }
-    if (cached_has_bits & 0x00000004u) {
-      _this->_impl_.records_ = from._impl_.records_;
-    }
-    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void managerDump_Request::CopyFrom(const managerDump_Request& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerDump_Request)
+void managerDump_Response::CopyFrom(const managerDump_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerDump_Response)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool managerDump_Request::IsInitialized() const {
+bool managerDump_Response::IsInitialized() const {
   return true;
 }
 
-void managerDump_Request::InternalSwap(managerDump_Request* other) {
+void managerDump_Response::InternalSwap(managerDump_Response* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.name_, lhs_arena,
-      &other->_impl_.name_, rhs_arena
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(managerDump_Request, _impl_.records_)
-      + sizeof(managerDump_Request::_impl_.records_)
-      - PROTOBUF_FIELD_OFFSET(managerDump_Request, _impl_.page_)>(
-          reinterpret_cast<char*>(&_impl_.page_),
-          reinterpret_cast<char*>(&other->_impl_.page_));
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.next_, lhs_arena,
+      &other->_impl_.next_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata managerDump_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata managerDump_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
-      file_level_metadata_kvdb_2eproto[11]);
+      file_level_metadata_kvdb_2eproto[16]);
 }
 
 // ===================================================================
 
-class managerDump_Response::_Internal {
+class managerStats_Request::_Internal {
  public:
-  using HasBits = decltype(std::declval<managerDump_Response>()._impl_._has_bits_);
+};
+
+managerStats_Request::managerStats_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerStats_Request)
+}
+managerStats_Request::managerStats_Request(const managerStats_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  managerStats_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerStats_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerStats_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerStats_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata managerStats_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
+      file_level_metadata_kvdb_2eproto[17]);
+}
+
+// ===================================================================
+
+class managerStats_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<managerStats_Response>()._impl_._has_bits_);
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_block_cache_usage(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_block_cache_capacity(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_block_cache_hit(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_block_cache_miss(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_block_cache_hit_ratio(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
 };
 
-managerDump_Response::managerDump_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+managerStats_Response::managerStats_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerDump_Response)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.kvdb.managerStats_Response)
 }
-managerDump_Response::managerDump_Response(const managerDump_Response& from)
+managerStats_Response::managerStats_Response(const managerStats_Response& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  managerDump_Response* const _this = this; (void)_this;
+  managerStats_Response* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.entries_){from._impl_.entries_}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.block_cache_usage_){}
+    , decltype(_impl_.block_cache_capacity_){}
+    , decltype(_impl_.block_cache_hit_){}
+    , decltype(_impl_.block_cache_miss_){}
+    , decltype(_impl_.block_cache_hit_ratio_){}
     , decltype(_impl_.status_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -3868,19 +5740,25 @@ managerDump_Response::managerDump_Response(const managerDump_Response& from)
     _this->_impl_.error_.Set(from._internal_error(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.status_ = from._impl_.status_;
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerDump_Response)
+  ::memcpy(&_impl_.block_cache_usage_, &from._impl_.block_cache_usage_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.block_cache_usage_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.kvdb.managerStats_Response)
 }
 
-inline void managerDump_Response::SharedCtor(
+inline void managerStats_Response::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.entries_){arena}
     , decltype(_impl_.error_){}
+    , decltype(_impl_.block_cache_usage_){uint64_t{0u}}
+    , decltype(_impl_.block_cache_capacity_){uint64_t{0u}}
+    , decltype(_impl_.block_cache_hit_){uint64_t{0u}}
+    , decltype(_impl_.block_cache_miss_){uint64_t{0u}}
+    , decltype(_impl_.block_cache_hit_ratio_){0}
     , decltype(_impl_.status_){0}
   };
   _impl_.error_.InitDefault();
@@ -3889,8 +5767,8 @@ inline void managerDump_Response::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-managerDump_Response::~managerDump_Response() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerDump_Response)
+managerStats_Response::~managerStats_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.kvdb.managerStats_Response)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3898,33 +5776,36 @@ managerDump_Response::~managerDump_Response() {
   SharedDtor();
 }
 
-inline void managerDump_Response::SharedDtor() {
+inline void managerStats_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.entries_.~RepeatedPtrField();
   _impl_.error_.Destroy();
 }
 
-void managerDump_Response::SetCachedSize(int size) const {
+void managerStats_Response::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void managerDump_Response::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerDump_Response)
+void managerStats_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.kvdb.managerStats_Response)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.entries_.Clear();
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     _impl_.error_.ClearNonDefaultToEmpty();
   }
+  if (cached_has_bits & 0x0000003eu) {
+    ::memset(&_impl_.block_cache_usage_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.block_cache_hit_ratio_) -
+        reinterpret_cast<char*>(&_impl_.block_cache_usage_)) + sizeof(_impl_.block_cache_hit_ratio_));
+  }
   _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* managerDump_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* managerStats_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -3946,20 +5827,52 @@ const char* managerDump_Response::_InternalParse(const char* ptr, ::_pbi::ParseC
           auto str = _internal_mutable_error();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerDump_Response.error"));
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.kvdb.managerStats_Response.error"));
         } else
           goto handle_unusual;
         continue;
-      // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
+      // optional uint64 block_cache_usage = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_block_cache_usage(&has_bits);
+          _impl_.block_cache_usage_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 block_cache_capacity = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_block_cache_capacity(&has_bits);
+          _impl_.block_cache_capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 block_cache_hit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_block_cache_hit(&has_bits);
+          _impl_.block_cache_hit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 block_cache_miss = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_block_cache_miss(&has_bits);
+          _impl_.block_cache_miss_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double block_cache_hit_ratio = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_block_cache_hit_ratio(&has_bits);
+          _impl_.block_cache_hit_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
@@ -3987,9 +5900,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* managerDump_Response::_InternalSerialize(
+uint8_t* managerStats_Response::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerDump_Response)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.kvdb.managerStats_Response)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4005,50 +5918,92 @@ uint8_t* managerDump_Response::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.kvdb.managerDump_Response.error");
+      "com.wazuh.api.engine.kvdb.managerStats_Response.error");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_error(), target);
   }
 
-  // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
-    const auto& repfield = this->_internal_entries(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // optional uint64 block_cache_usage = 3;
+  if (_internal_has_block_cache_usage()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_block_cache_usage(), target);
+  }
+
+  // optional uint64 block_cache_capacity = 4;
+  if (_internal_has_block_cache_capacity()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_block_cache_capacity(), target);
+  }
+
+  // optional uint64 block_cache_hit = 5;
+  if (_internal_has_block_cache_hit()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_block_cache_hit(), target);
+  }
+
+  // optional uint64 block_cache_miss = 6;
+  if (_internal_has_block_cache_miss()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_block_cache_miss(), target);
+  }
+
+  // optional double block_cache_hit_ratio = 7;
+  if (_internal_has_block_cache_hit_ratio()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_block_cache_hit_ratio(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerDump_Response)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.kvdb.managerStats_Response)
   return target;
 }
 
-size_t managerDump_Response::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerDump_Response)
+size_t managerStats_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.kvdb.managerStats_Response)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
-  total_size += 1UL * this->_internal_entries_size();
-  for (const auto& msg : this->_impl_.entries_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // optional string error = 2;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error());
-  }
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional uint64 block_cache_usage = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_cache_usage());
+    }
+
+    // optional uint64 block_cache_capacity = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_cache_capacity());
+    }
+
+    // optional uint64 block_cache_hit = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_cache_hit());
+    }
+
+    // optional uint64 block_cache_miss = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_cache_miss());
+    }
+
+    // optional double block_cache_hit_ratio = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
 
+  }
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   if (this->_internal_status() != 0) {
     total_size += 1 +
@@ -4058,24 +6013,42 @@ size_t managerDump_Response::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerDump_Response::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData managerStats_Response::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    managerDump_Response::MergeImpl
+    managerStats_Response::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerDump_Response::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*managerStats_Response::GetClassData() const { return &_class_data_; }
 
 
-void managerDump_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<managerDump_Response*>(&to_msg);
-  auto& from = static_cast<const managerDump_Response&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerDump_Response)
+void managerStats_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<managerStats_Response*>(&to_msg);
+  auto& from = static_cast<const managerStats_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.kvdb.managerStats_Response)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
-  if (from._internal_has_error()) {
-    _this->_internal_set_error(from._internal_error());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.block_cache_usage_ = from._impl_.block_cache_usage_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.block_cache_capacity_ = from._impl_.block_cache_capacity_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.block_cache_hit_ = from._impl_.block_cache_hit_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.block_cache_miss_ = from._impl_.block_cache_miss_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.block_cache_hit_ratio_ = from._impl_.block_cache_hit_ratio_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
@@ -4083,35 +6056,39 @@ void managerDump_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void managerDump_Response::CopyFrom(const managerDump_Response& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerDump_Response)
+void managerStats_Response::CopyFrom(const managerStats_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.kvdb.managerStats_Response)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool managerDump_Response::IsInitialized() const {
+bool managerStats_Response::IsInitialized() const {
   return true;
 }
 
-void managerDump_Response::InternalSwap(managerDump_Response* other) {
+void managerStats_Response::InternalSwap(managerStats_Response* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.error_, lhs_arena,
       &other->_impl_.error_, rhs_arena
   );
-  swap(_impl_.status_, other->_impl_.status_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(managerStats_Response, _impl_.status_)
+      + sizeof(managerStats_Response::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(managerStats_Response, _impl_.block_cache_usage_)>(
+          reinterpret_cast<char*>(&_impl_.block_cache_usage_),
+          reinterpret_cast<char*>(&other->_impl_.block_cache_usage_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata managerDump_Response::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata managerStats_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_kvdb_2eproto_getter, &descriptor_table_kvdb_2eproto_once,
-      file_level_metadata_kvdb_2eproto[12]);
+      file_level_metadata_kvdb_2eproto[18]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -4149,6 +6126,22 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::dbPut_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::dbPut_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::dbPut_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::dbImport_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::dbImport_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::dbImport_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::dbImport_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::dbImport_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::dbImport_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::dbExport_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::dbExport_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::dbExport_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::dbExport_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::dbExport_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::dbExport_Response >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerGet_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerGet_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerGet_Request >(arena);
@@ -4173,6 +6166,14 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerDump_Respon
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerDump_Response >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerDump_Response >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerStats_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerStats_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerStats_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::kvdb::managerStats_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::kvdb::managerStats_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::kvdb::managerStats_Response >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
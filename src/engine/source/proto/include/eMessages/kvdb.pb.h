@@ -23,6 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -57,12 +58,24 @@ extern EntryDefaultTypeInternal _Entry_default_instance_;
 class dbDelete_Request;
 struct dbDelete_RequestDefaultTypeInternal;
 extern dbDelete_RequestDefaultTypeInternal _dbDelete_Request_default_instance_;
+class dbExport_Request;
+struct dbExport_RequestDefaultTypeInternal;
+extern dbExport_RequestDefaultTypeInternal _dbExport_Request_default_instance_;
+class dbExport_Response;
+struct dbExport_ResponseDefaultTypeInternal;
+extern dbExport_ResponseDefaultTypeInternal _dbExport_Response_default_instance_;
 class dbGet_Request;
 struct dbGet_RequestDefaultTypeInternal;
 extern dbGet_RequestDefaultTypeInternal _dbGet_Request_default_instance_;
 class dbGet_Response;
 struct dbGet_ResponseDefaultTypeInternal;
 extern dbGet_ResponseDefaultTypeInternal _dbGet_Response_default_instance_;
+class dbImport_Request;
+struct dbImport_RequestDefaultTypeInternal;
+extern dbImport_RequestDefaultTypeInternal _dbImport_Request_default_instance_;
+class dbImport_Response;
+struct dbImport_ResponseDefaultTypeInternal;
+extern dbImport_ResponseDefaultTypeInternal _dbImport_Response_default_instance_;
 class dbPut_Request;
 struct dbPut_RequestDefaultTypeInternal;
 extern dbPut_RequestDefaultTypeInternal _dbPut_Request_default_instance_;
@@ -90,6 +103,12 @@ extern managerGet_ResponseDefaultTypeInternal _managerGet_Response_default_insta
 class managerPost_Request;
 struct managerPost_RequestDefaultTypeInternal;
 extern managerPost_RequestDefaultTypeInternal _managerPost_Request_default_instance_;
+class managerStats_Request;
+struct managerStats_RequestDefaultTypeInternal;
+extern managerStats_RequestDefaultTypeInternal _managerStats_Request_default_instance_;
+class managerStats_Response;
+struct managerStats_ResponseDefaultTypeInternal;
+extern managerStats_ResponseDefaultTypeInternal _managerStats_Response_default_instance_;
 }  // namespace kvdb
 }  // namespace engine
 }  // namespace api
@@ -98,8 +117,12 @@ extern managerPost_RequestDefaultTypeInternal _managerPost_Request_default_insta
 PROTOBUF_NAMESPACE_OPEN
 template<> ::com::wazuh::api::engine::kvdb::Entry* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::Entry>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::dbDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbDelete_Request>(Arena*);
+template<> ::com::wazuh::api::engine::kvdb::dbExport_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbExport_Request>(Arena*);
+template<> ::com::wazuh::api::engine::kvdb::dbExport_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbExport_Response>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::dbGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::dbGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::kvdb::dbImport_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbImport_Request>(Arena*);
+template<> ::com::wazuh::api::engine::kvdb::dbImport_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbImport_Response>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::dbPut_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbPut_Request>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::dbSearch_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbSearch_Request>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::dbSearch_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::dbSearch_Response>(Arena*);
@@ -109,6 +132,8 @@ template<> ::com::wazuh::api::engine::kvdb::managerDump_Response* Arena::CreateM
 template<> ::com::wazuh::api::engine::kvdb::managerGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::managerGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::managerGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::managerGet_Response>(Arena*);
 template<> ::com::wazuh::api::engine::kvdb::managerPost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::managerPost_Request>(Arena*);
+template<> ::com::wazuh::api::engine::kvdb::managerStats_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::managerStats_Request>(Arena*);
+template<> ::com::wazuh::api::engine::kvdb::managerStats_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::kvdb::managerStats_Response>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace com {
 namespace wazuh {
@@ -786,6 +811,7 @@ class dbSearch_Request final :
   enum : int {
     kNameFieldNumber = 1,
     kPrefixFieldNumber = 2,
+    kCursorFieldNumber = 5,
     kPageFieldNumber = 3,
     kRecordsFieldNumber = 4,
   };
@@ -825,6 +851,24 @@ class dbSearch_Request final :
   std::string* _internal_mutable_prefix();
   public:
 
+  // optional string cursor = 5;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
   // optional uint32 page = 3;
   bool has_page() const;
   private:
@@ -863,6 +907,7 @@ class dbSearch_Request final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
     uint32_t page_;
     uint32_t records_;
   };
@@ -994,6 +1039,7 @@ class dbSearch_Response final :
   enum : int {
     kEntriesFieldNumber = 3,
     kErrorFieldNumber = 2,
+    kNextFieldNumber = 4,
     kStatusFieldNumber = 1,
   };
   // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
@@ -1032,6 +1078,24 @@ class dbSearch_Response final :
   std::string* _internal_mutable_error();
   public:
 
+  // optional string next = 4;
+  bool has_next() const;
+  private:
+  bool _internal_has_next() const;
+  public:
+  void clear_next();
+  const std::string& next() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next();
+  PROTOBUF_NODISCARD std::string* release_next();
+  void set_allocated_next(std::string* next);
+  private:
+  const std::string& _internal_next() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next(const std::string& value);
+  std::string* _internal_mutable_next();
+  public:
+
   // .com.wazuh.api.engine.ReturnStatus status = 1;
   void clear_status();
   ::com::wazuh::api::engine::ReturnStatus status() const;
@@ -1053,6 +1117,7 @@ class dbSearch_Response final :
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry > entries_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_;
     int status_;
   };
   union { Impl_ _impl_; };
@@ -1416,24 +1481,24 @@ class dbPut_Request final :
 };
 // -------------------------------------------------------------------
 
-class managerGet_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerGet_Request) */ {
+class dbImport_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.dbImport_Request) */ {
  public:
-  inline managerGet_Request() : managerGet_Request(nullptr) {}
-  ~managerGet_Request() override;
-  explicit PROTOBUF_CONSTEXPR managerGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline dbImport_Request() : dbImport_Request(nullptr) {}
+  ~dbImport_Request() override;
+  explicit PROTOBUF_CONSTEXPR dbImport_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  managerGet_Request(const managerGet_Request& from);
-  managerGet_Request(managerGet_Request&& from) noexcept
-    : managerGet_Request() {
+  dbImport_Request(const dbImport_Request& from);
+  dbImport_Request(dbImport_Request&& from) noexcept
+    : dbImport_Request() {
     *this = ::std::move(from);
   }
 
-  inline managerGet_Request& operator=(const managerGet_Request& from) {
+  inline dbImport_Request& operator=(const dbImport_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline managerGet_Request& operator=(managerGet_Request&& from) noexcept {
+  inline dbImport_Request& operator=(dbImport_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1456,20 +1521,20 @@ class managerGet_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const managerGet_Request& default_instance() {
+  static const dbImport_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const managerGet_Request* internal_default_instance() {
-    return reinterpret_cast<const managerGet_Request*>(
-               &_managerGet_Request_default_instance_);
+  static inline const dbImport_Request* internal_default_instance() {
+    return reinterpret_cast<const dbImport_Request*>(
+               &_dbImport_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     7;
 
-  friend void swap(managerGet_Request& a, managerGet_Request& b) {
+  friend void swap(dbImport_Request& a, dbImport_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(managerGet_Request* other) {
+  inline void Swap(dbImport_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1482,7 +1547,7 @@ class managerGet_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(managerGet_Request* other) {
+  void UnsafeArenaSwap(dbImport_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1490,14 +1555,14 @@ class managerGet_Request final :
 
   // implements Message ----------------------------------------------
 
-  managerGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<managerGet_Request>(arena);
+  dbImport_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<dbImport_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const managerGet_Request& from);
+  void CopyFrom(const dbImport_Request& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const managerGet_Request& from) {
-    managerGet_Request::MergeImpl(*this, from);
+  void MergeFrom( const dbImport_Request& from) {
+    dbImport_Request::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1515,15 +1580,15 @@ class managerGet_Request final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(managerGet_Request* other);
+  void InternalSwap(dbImport_Request* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.kvdb.managerGet_Request";
+    return "com.wazuh.api.engine.kvdb.dbImport_Request";
   }
   protected:
-  explicit managerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit dbImport_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1537,37 +1602,46 @@ class managerGet_Request final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kFilterByNameFieldNumber = 16,
-    kMustBeLoadedFieldNumber = 1,
+    kNameFieldNumber = 1,
+    kContentFieldNumber = 2,
   };
-  // optional string filter_by_name = 16;
-  bool has_filter_by_name() const;
+  // optional string name = 1;
+  bool has_name() const;
   private:
-  bool _internal_has_filter_by_name() const;
+  bool _internal_has_name() const;
   public:
-  void clear_filter_by_name();
-  const std::string& filter_by_name() const;
+  void clear_name();
+  const std::string& name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_filter_by_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_filter_by_name();
-  PROTOBUF_NODISCARD std::string* release_filter_by_name();
-  void set_allocated_filter_by_name(std::string* filter_by_name);
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
   private:
-  const std::string& _internal_filter_by_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filter_by_name(const std::string& value);
-  std::string* _internal_mutable_filter_by_name();
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
   public:
 
-  // bool must_be_loaded = 1;
-  void clear_must_be_loaded();
-  bool must_be_loaded() const;
-  void set_must_be_loaded(bool value);
+  // optional string content = 2;
+  bool has_content() const;
   private:
-  bool _internal_must_be_loaded() const;
-  void _internal_set_must_be_loaded(bool value);
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerGet_Request)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.dbImport_Request)
  private:
   class _Internal;
 
@@ -1577,32 +1651,32 @@ class managerGet_Request final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_by_name_;
-    bool must_be_loaded_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class managerGet_Response final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerGet_Response) */ {
+class dbImport_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.dbImport_Response) */ {
  public:
-  inline managerGet_Response() : managerGet_Response(nullptr) {}
-  ~managerGet_Response() override;
-  explicit PROTOBUF_CONSTEXPR managerGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline dbImport_Response() : dbImport_Response(nullptr) {}
+  ~dbImport_Response() override;
+  explicit PROTOBUF_CONSTEXPR dbImport_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  managerGet_Response(const managerGet_Response& from);
-  managerGet_Response(managerGet_Response&& from) noexcept
-    : managerGet_Response() {
+  dbImport_Response(const dbImport_Response& from);
+  dbImport_Response(dbImport_Response&& from) noexcept
+    : dbImport_Response() {
     *this = ::std::move(from);
   }
 
-  inline managerGet_Response& operator=(const managerGet_Response& from) {
+  inline dbImport_Response& operator=(const dbImport_Response& from) {
     CopyFrom(from);
     return *this;
   }
-  inline managerGet_Response& operator=(managerGet_Response&& from) noexcept {
+  inline dbImport_Response& operator=(dbImport_Response&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1625,20 +1699,20 @@ class managerGet_Response final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const managerGet_Response& default_instance() {
+  static const dbImport_Response& default_instance() {
     return *internal_default_instance();
   }
-  static inline const managerGet_Response* internal_default_instance() {
-    return reinterpret_cast<const managerGet_Response*>(
-               &_managerGet_Response_default_instance_);
+  static inline const dbImport_Response* internal_default_instance() {
+    return reinterpret_cast<const dbImport_Response*>(
+               &_dbImport_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(managerGet_Response& a, managerGet_Response& b) {
+  friend void swap(dbImport_Response& a, dbImport_Response& b) {
     a.Swap(&b);
   }
-  inline void Swap(managerGet_Response* other) {
+  inline void Swap(dbImport_Response* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1651,7 +1725,7 @@ class managerGet_Response final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(managerGet_Response* other) {
+  void UnsafeArenaSwap(dbImport_Response* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1659,14 +1733,14 @@ class managerGet_Response final :
 
   // implements Message ----------------------------------------------
 
-  managerGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<managerGet_Response>(arena);
+  dbImport_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<dbImport_Response>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const managerGet_Response& from);
+  void CopyFrom(const dbImport_Response& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const managerGet_Response& from) {
-    managerGet_Response::MergeImpl(*this, from);
+  void MergeFrom( const dbImport_Response& from) {
+    dbImport_Response::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1684,15 +1758,15 @@ class managerGet_Response final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(managerGet_Response* other);
+  void InternalSwap(dbImport_Response* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.kvdb.managerGet_Response";
+    return "com.wazuh.api.engine.kvdb.dbImport_Response";
   }
   protected:
-  explicit managerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit dbImport_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1706,34 +1780,10 @@ class managerGet_Response final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDbsFieldNumber = 3,
     kErrorFieldNumber = 2,
     kStatusFieldNumber = 1,
+    kImportedFieldNumber = 3,
   };
-  // repeated string dbs = 3;
-  int dbs_size() const;
-  private:
-  int _internal_dbs_size() const;
-  public:
-  void clear_dbs();
-  const std::string& dbs(int index) const;
-  std::string* mutable_dbs(int index);
-  void set_dbs(int index, const std::string& value);
-  void set_dbs(int index, std::string&& value);
-  void set_dbs(int index, const char* value);
-  void set_dbs(int index, const char* value, size_t size);
-  std::string* add_dbs();
-  void add_dbs(const std::string& value);
-  void add_dbs(std::string&& value);
-  void add_dbs(const char* value);
-  void add_dbs(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& dbs() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_dbs();
-  private:
-  const std::string& _internal_dbs(int index) const;
-  std::string* _internal_add_dbs();
-  public:
-
   // optional string error = 2;
   bool has_error() const;
   private:
@@ -1761,7 +1811,20 @@ class managerGet_Response final :
   void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerGet_Response)
+  // optional uint32 imported = 3;
+  bool has_imported() const;
+  private:
+  bool _internal_has_imported() const;
+  public:
+  void clear_imported();
+  uint32_t imported() const;
+  void set_imported(uint32_t value);
+  private:
+  uint32_t _internal_imported() const;
+  void _internal_set_imported(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.dbImport_Response)
  private:
   class _Internal;
 
@@ -1771,33 +1834,33 @@ class managerGet_Response final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> dbs_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
     int status_;
+    uint32_t imported_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class managerPost_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerPost_Request) */ {
+class dbExport_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.dbExport_Request) */ {
  public:
-  inline managerPost_Request() : managerPost_Request(nullptr) {}
-  ~managerPost_Request() override;
-  explicit PROTOBUF_CONSTEXPR managerPost_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline dbExport_Request() : dbExport_Request(nullptr) {}
+  ~dbExport_Request() override;
+  explicit PROTOBUF_CONSTEXPR dbExport_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  managerPost_Request(const managerPost_Request& from);
-  managerPost_Request(managerPost_Request&& from) noexcept
-    : managerPost_Request() {
+  dbExport_Request(const dbExport_Request& from);
+  dbExport_Request(dbExport_Request&& from) noexcept
+    : dbExport_Request() {
     *this = ::std::move(from);
   }
 
-  inline managerPost_Request& operator=(const managerPost_Request& from) {
+  inline dbExport_Request& operator=(const dbExport_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline managerPost_Request& operator=(managerPost_Request&& from) noexcept {
+  inline dbExport_Request& operator=(dbExport_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1820,20 +1883,20 @@ class managerPost_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const managerPost_Request& default_instance() {
+  static const dbExport_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const managerPost_Request* internal_default_instance() {
-    return reinterpret_cast<const managerPost_Request*>(
-               &_managerPost_Request_default_instance_);
+  static inline const dbExport_Request* internal_default_instance() {
+    return reinterpret_cast<const dbExport_Request*>(
+               &_dbExport_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     9;
 
-  friend void swap(managerPost_Request& a, managerPost_Request& b) {
+  friend void swap(dbExport_Request& a, dbExport_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(managerPost_Request* other) {
+  inline void Swap(dbExport_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1846,7 +1909,7 @@ class managerPost_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(managerPost_Request* other) {
+  void UnsafeArenaSwap(dbExport_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1854,14 +1917,14 @@ class managerPost_Request final :
 
   // implements Message ----------------------------------------------
 
-  managerPost_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<managerPost_Request>(arena);
+  dbExport_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<dbExport_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const managerPost_Request& from);
+  void CopyFrom(const dbExport_Request& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const managerPost_Request& from) {
-    managerPost_Request::MergeImpl(*this, from);
+  void MergeFrom( const dbExport_Request& from) {
+    dbExport_Request::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1879,15 +1942,15 @@ class managerPost_Request final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(managerPost_Request* other);
+  void InternalSwap(dbExport_Request* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.kvdb.managerPost_Request";
+    return "com.wazuh.api.engine.kvdb.dbExport_Request";
   }
   protected:
-  explicit managerPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit dbExport_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1902,7 +1965,6 @@ class managerPost_Request final :
 
   enum : int {
     kNameFieldNumber = 1,
-    kPathFieldNumber = 2,
   };
   // optional string name = 1;
   bool has_name() const;
@@ -1922,25 +1984,7 @@ class managerPost_Request final :
   std::string* _internal_mutable_name();
   public:
 
-  // optional string path = 2;
-  bool has_path() const;
-  private:
-  bool _internal_has_path() const;
-  public:
-  void clear_path();
-  const std::string& path() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_path(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_path();
-  PROTOBUF_NODISCARD std::string* release_path();
-  void set_allocated_path(std::string* path);
-  private:
-  const std::string& _internal_path() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
-  std::string* _internal_mutable_path();
-  public:
-
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerPost_Request)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.dbExport_Request)
  private:
   class _Internal;
 
@@ -1951,31 +1995,30 @@ class managerPost_Request final :
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class managerDelete_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerDelete_Request) */ {
+class dbExport_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.dbExport_Response) */ {
  public:
-  inline managerDelete_Request() : managerDelete_Request(nullptr) {}
-  ~managerDelete_Request() override;
-  explicit PROTOBUF_CONSTEXPR managerDelete_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline dbExport_Response() : dbExport_Response(nullptr) {}
+  ~dbExport_Response() override;
+  explicit PROTOBUF_CONSTEXPR dbExport_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  managerDelete_Request(const managerDelete_Request& from);
-  managerDelete_Request(managerDelete_Request&& from) noexcept
-    : managerDelete_Request() {
+  dbExport_Response(const dbExport_Response& from);
+  dbExport_Response(dbExport_Response&& from) noexcept
+    : dbExport_Response() {
     *this = ::std::move(from);
   }
 
-  inline managerDelete_Request& operator=(const managerDelete_Request& from) {
+  inline dbExport_Response& operator=(const dbExport_Response& from) {
     CopyFrom(from);
     return *this;
   }
-  inline managerDelete_Request& operator=(managerDelete_Request&& from) noexcept {
+  inline dbExport_Response& operator=(dbExport_Response&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1998,20 +2041,20 @@ class managerDelete_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const managerDelete_Request& default_instance() {
+  static const dbExport_Response& default_instance() {
     return *internal_default_instance();
   }
-  static inline const managerDelete_Request* internal_default_instance() {
-    return reinterpret_cast<const managerDelete_Request*>(
-               &_managerDelete_Request_default_instance_);
+  static inline const dbExport_Response* internal_default_instance() {
+    return reinterpret_cast<const dbExport_Response*>(
+               &_dbExport_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(managerDelete_Request& a, managerDelete_Request& b) {
+  friend void swap(dbExport_Response& a, dbExport_Response& b) {
     a.Swap(&b);
   }
-  inline void Swap(managerDelete_Request* other) {
+  inline void Swap(dbExport_Response* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2024,7 +2067,7 @@ class managerDelete_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(managerDelete_Request* other) {
+  void UnsafeArenaSwap(dbExport_Response* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2032,14 +2075,14 @@ class managerDelete_Request final :
 
   // implements Message ----------------------------------------------
 
-  managerDelete_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<managerDelete_Request>(arena);
+  dbExport_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<dbExport_Response>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const managerDelete_Request& from);
+  void CopyFrom(const dbExport_Response& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const managerDelete_Request& from) {
-    managerDelete_Request::MergeImpl(*this, from);
+  void MergeFrom( const dbExport_Response& from) {
+    dbExport_Response::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2057,15 +2100,15 @@ class managerDelete_Request final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(managerDelete_Request* other);
+  void InternalSwap(dbExport_Response* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.kvdb.managerDelete_Request";
+    return "com.wazuh.api.engine.kvdb.dbExport_Response";
   }
   protected:
-  explicit managerDelete_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit dbExport_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2079,27 +2122,56 @@ class managerDelete_Request final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNameFieldNumber = 1,
+    kErrorFieldNumber = 2,
+    kContentFieldNumber = 3,
+    kStatusFieldNumber = 1,
   };
-  // optional string name = 1;
-  bool has_name() const;
+  // optional string error = 2;
+  bool has_error() const;
   private:
-  bool _internal_has_name() const;
+  bool _internal_has_error() const;
   public:
-  void clear_name();
-  const std::string& name() const;
+  void clear_error();
+  const std::string& error() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_name();
-  PROTOBUF_NODISCARD std::string* release_name();
-  void set_allocated_name(std::string* name);
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
   private:
-  const std::string& _internal_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
-  std::string* _internal_mutable_name();
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerDelete_Request)
+  // optional string content = 3;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.dbExport_Response)
  private:
   class _Internal;
 
@@ -2109,31 +2181,33 @@ class managerDelete_Request final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    int status_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class managerDump_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerDump_Request) */ {
+class managerGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerGet_Request) */ {
  public:
-  inline managerDump_Request() : managerDump_Request(nullptr) {}
-  ~managerDump_Request() override;
-  explicit PROTOBUF_CONSTEXPR managerDump_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline managerGet_Request() : managerGet_Request(nullptr) {}
+  ~managerGet_Request() override;
+  explicit PROTOBUF_CONSTEXPR managerGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  managerDump_Request(const managerDump_Request& from);
-  managerDump_Request(managerDump_Request&& from) noexcept
-    : managerDump_Request() {
+  managerGet_Request(const managerGet_Request& from);
+  managerGet_Request(managerGet_Request&& from) noexcept
+    : managerGet_Request() {
     *this = ::std::move(from);
   }
 
-  inline managerDump_Request& operator=(const managerDump_Request& from) {
+  inline managerGet_Request& operator=(const managerGet_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline managerDump_Request& operator=(managerDump_Request&& from) noexcept {
+  inline managerGet_Request& operator=(managerGet_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2156,20 +2230,20 @@ class managerDump_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const managerDump_Request& default_instance() {
+  static const managerGet_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const managerDump_Request* internal_default_instance() {
-    return reinterpret_cast<const managerDump_Request*>(
-               &_managerDump_Request_default_instance_);
+  static inline const managerGet_Request* internal_default_instance() {
+    return reinterpret_cast<const managerGet_Request*>(
+               &_managerGet_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(managerDump_Request& a, managerDump_Request& b) {
+  friend void swap(managerGet_Request& a, managerGet_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(managerDump_Request* other) {
+  inline void Swap(managerGet_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2182,7 +2256,7 @@ class managerDump_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(managerDump_Request* other) {
+  void UnsafeArenaSwap(managerGet_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2190,14 +2264,14 @@ class managerDump_Request final :
 
   // implements Message ----------------------------------------------
 
-  managerDump_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<managerDump_Request>(arena);
+  managerGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerGet_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const managerDump_Request& from);
+  void CopyFrom(const managerGet_Request& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const managerDump_Request& from) {
-    managerDump_Request::MergeImpl(*this, from);
+  void MergeFrom( const managerGet_Request& from) {
+    managerGet_Request::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2215,15 +2289,15 @@ class managerDump_Request final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(managerDump_Request* other);
+  void InternalSwap(managerGet_Request* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.kvdb.managerDump_Request";
+    return "com.wazuh.api.engine.kvdb.managerGet_Request";
   }
   protected:
-  explicit managerDump_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit managerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2237,55 +2311,37 @@ class managerDump_Request final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kNameFieldNumber = 1,
-    kPageFieldNumber = 2,
-    kRecordsFieldNumber = 3,
+    kFilterByNameFieldNumber = 16,
+    kMustBeLoadedFieldNumber = 1,
   };
-  // optional string name = 1;
-  bool has_name() const;
+  // optional string filter_by_name = 16;
+  bool has_filter_by_name() const;
   private:
-  bool _internal_has_name() const;
+  bool _internal_has_filter_by_name() const;
   public:
-  void clear_name();
-  const std::string& name() const;
+  void clear_filter_by_name();
+  const std::string& filter_by_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_name();
-  PROTOBUF_NODISCARD std::string* release_name();
-  void set_allocated_name(std::string* name);
-  private:
-  const std::string& _internal_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
-  std::string* _internal_mutable_name();
-  public:
-
-  // optional uint32 page = 2;
-  bool has_page() const;
-  private:
-  bool _internal_has_page() const;
-  public:
-  void clear_page();
-  uint32_t page() const;
-  void set_page(uint32_t value);
+  void set_filter_by_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_filter_by_name();
+  PROTOBUF_NODISCARD std::string* release_filter_by_name();
+  void set_allocated_filter_by_name(std::string* filter_by_name);
   private:
-  uint32_t _internal_page() const;
-  void _internal_set_page(uint32_t value);
+  const std::string& _internal_filter_by_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_filter_by_name(const std::string& value);
+  std::string* _internal_mutable_filter_by_name();
   public:
 
-  // optional uint32 records = 3;
-  bool has_records() const;
-  private:
-  bool _internal_has_records() const;
-  public:
-  void clear_records();
-  uint32_t records() const;
-  void set_records(uint32_t value);
+  // bool must_be_loaded = 1;
+  void clear_must_be_loaded();
+  bool must_be_loaded() const;
+  void set_must_be_loaded(bool value);
   private:
-  uint32_t _internal_records() const;
-  void _internal_set_records(uint32_t value);
+  bool _internal_must_be_loaded() const;
+  void _internal_set_must_be_loaded(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerDump_Request)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerGet_Request)
  private:
   class _Internal;
 
@@ -2295,33 +2351,32 @@ class managerDump_Request final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-    uint32_t page_;
-    uint32_t records_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_by_name_;
+    bool must_be_loaded_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvdb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class managerDump_Response final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerDump_Response) */ {
+class managerGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerGet_Response) */ {
  public:
-  inline managerDump_Response() : managerDump_Response(nullptr) {}
-  ~managerDump_Response() override;
-  explicit PROTOBUF_CONSTEXPR managerDump_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline managerGet_Response() : managerGet_Response(nullptr) {}
+  ~managerGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR managerGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  managerDump_Response(const managerDump_Response& from);
-  managerDump_Response(managerDump_Response&& from) noexcept
-    : managerDump_Response() {
+  managerGet_Response(const managerGet_Response& from);
+  managerGet_Response(managerGet_Response&& from) noexcept
+    : managerGet_Response() {
     *this = ::std::move(from);
   }
 
-  inline managerDump_Response& operator=(const managerDump_Response& from) {
+  inline managerGet_Response& operator=(const managerGet_Response& from) {
     CopyFrom(from);
     return *this;
   }
-  inline managerDump_Response& operator=(managerDump_Response&& from) noexcept {
+  inline managerGet_Response& operator=(managerGet_Response&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2344,20 +2399,20 @@ class managerDump_Response final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const managerDump_Response& default_instance() {
+  static const managerGet_Response& default_instance() {
     return *internal_default_instance();
   }
-  static inline const managerDump_Response* internal_default_instance() {
-    return reinterpret_cast<const managerDump_Response*>(
-               &_managerDump_Response_default_instance_);
+  static inline const managerGet_Response* internal_default_instance() {
+    return reinterpret_cast<const managerGet_Response*>(
+               &_managerGet_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(managerDump_Response& a, managerDump_Response& b) {
+  friend void swap(managerGet_Response& a, managerGet_Response& b) {
     a.Swap(&b);
   }
-  inline void Swap(managerDump_Response* other) {
+  inline void Swap(managerGet_Response* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2370,7 +2425,7 @@ class managerDump_Response final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(managerDump_Response* other) {
+  void UnsafeArenaSwap(managerGet_Response* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2378,14 +2433,14 @@ class managerDump_Response final :
 
   // implements Message ----------------------------------------------
 
-  managerDump_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<managerDump_Response>(arena);
+  managerGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerGet_Response>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const managerDump_Response& from);
+  void CopyFrom(const managerGet_Response& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const managerDump_Response& from) {
-    managerDump_Response::MergeImpl(*this, from);
+  void MergeFrom( const managerGet_Response& from) {
+    managerGet_Response::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2403,15 +2458,15 @@ class managerDump_Response final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(managerDump_Response* other);
+  void InternalSwap(managerGet_Response* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.kvdb.managerDump_Response";
+    return "com.wazuh.api.engine.kvdb.managerGet_Response";
   }
   protected:
-  explicit managerDump_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit managerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2425,27 +2480,33 @@ class managerDump_Response final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEntriesFieldNumber = 3,
+    kDbsFieldNumber = 3,
     kErrorFieldNumber = 2,
     kStatusFieldNumber = 1,
   };
-  // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
-  int entries_size() const;
+  // repeated string dbs = 3;
+  int dbs_size() const;
   private:
-  int _internal_entries_size() const;
+  int _internal_dbs_size() const;
   public:
-  void clear_entries();
-  ::com::wazuh::api::engine::kvdb::Entry* mutable_entries(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >*
-      mutable_entries();
+  void clear_dbs();
+  const std::string& dbs(int index) const;
+  std::string* mutable_dbs(int index);
+  void set_dbs(int index, const std::string& value);
+  void set_dbs(int index, std::string&& value);
+  void set_dbs(int index, const char* value);
+  void set_dbs(int index, const char* value, size_t size);
+  std::string* add_dbs();
+  void add_dbs(const std::string& value);
+  void add_dbs(std::string&& value);
+  void add_dbs(const char* value);
+  void add_dbs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& dbs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_dbs();
   private:
-  const ::com::wazuh::api::engine::kvdb::Entry& _internal_entries(int index) const;
-  ::com::wazuh::api::engine::kvdb::Entry* _internal_add_entries();
+  const std::string& _internal_dbs(int index) const;
+  std::string* _internal_add_dbs();
   public:
-  const ::com::wazuh::api::engine::kvdb::Entry& entries(int index) const;
-  ::com::wazuh::api::engine::kvdb::Entry* add_entries();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >&
-      entries() const;
 
   // optional string error = 2;
   bool has_error() const;
@@ -2474,7 +2535,7 @@ class managerDump_Response final :
   void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerDump_Response)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerGet_Response)
  private:
   class _Internal;
 
@@ -2484,224 +2545,2122 @@ class managerDump_Response final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> dbs_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
     int status_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_kvdb_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class managerPost_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerPost_Request) */ {
+ public:
+  inline managerPost_Request() : managerPost_Request(nullptr) {}
+  ~managerPost_Request() override;
+  explicit PROTOBUF_CONSTEXPR managerPost_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  managerPost_Request(const managerPost_Request& from);
+  managerPost_Request(managerPost_Request&& from) noexcept
+    : managerPost_Request() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Entry
+  inline managerPost_Request& operator=(const managerPost_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline managerPost_Request& operator=(managerPost_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// optional string key = 1;
-inline bool Entry::_internal_has_key() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool Entry::has_key() const {
-  return _internal_has_key();
-}
-inline void Entry::clear_key() {
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-inline const std::string& Entry::key() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.Entry.key)
-  return _internal_key();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_key(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.Entry.key)
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const managerPost_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const managerPost_Request* internal_default_instance() {
+    return reinterpret_cast<const managerPost_Request*>(
+               &_managerPost_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(managerPost_Request& a, managerPost_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(managerPost_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(managerPost_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  managerPost_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerPost_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const managerPost_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const managerPost_Request& from) {
+    managerPost_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(managerPost_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.kvdb.managerPost_Request";
+  }
+  protected:
+  explicit managerPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kPathFieldNumber = 2,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string path = 2;
+  bool has_path() const;
+  private:
+  bool _internal_has_path() const;
+  public:
+  void clear_path();
+  const std::string& path() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_path(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_path();
+  PROTOBUF_NODISCARD std::string* release_path();
+  void set_allocated_path(std::string* path);
+  private:
+  const std::string& _internal_path() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_path(const std::string& value);
+  std::string* _internal_mutable_path();
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerPost_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr path_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class managerDelete_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerDelete_Request) */ {
+ public:
+  inline managerDelete_Request() : managerDelete_Request(nullptr) {}
+  ~managerDelete_Request() override;
+  explicit PROTOBUF_CONSTEXPR managerDelete_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  managerDelete_Request(const managerDelete_Request& from);
+  managerDelete_Request(managerDelete_Request&& from) noexcept
+    : managerDelete_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline managerDelete_Request& operator=(const managerDelete_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline managerDelete_Request& operator=(managerDelete_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const managerDelete_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const managerDelete_Request* internal_default_instance() {
+    return reinterpret_cast<const managerDelete_Request*>(
+               &_managerDelete_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(managerDelete_Request& a, managerDelete_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(managerDelete_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(managerDelete_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  managerDelete_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerDelete_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const managerDelete_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const managerDelete_Request& from) {
+    managerDelete_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(managerDelete_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.kvdb.managerDelete_Request";
+  }
+  protected:
+  explicit managerDelete_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerDelete_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class managerDump_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerDump_Request) */ {
+ public:
+  inline managerDump_Request() : managerDump_Request(nullptr) {}
+  ~managerDump_Request() override;
+  explicit PROTOBUF_CONSTEXPR managerDump_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  managerDump_Request(const managerDump_Request& from);
+  managerDump_Request(managerDump_Request&& from) noexcept
+    : managerDump_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline managerDump_Request& operator=(const managerDump_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline managerDump_Request& operator=(managerDump_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const managerDump_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const managerDump_Request* internal_default_instance() {
+    return reinterpret_cast<const managerDump_Request*>(
+               &_managerDump_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(managerDump_Request& a, managerDump_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(managerDump_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(managerDump_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  managerDump_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerDump_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const managerDump_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const managerDump_Request& from) {
+    managerDump_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(managerDump_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.kvdb.managerDump_Request";
+  }
+  protected:
+  explicit managerDump_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCursorFieldNumber = 4,
+    kPageFieldNumber = 2,
+    kRecordsFieldNumber = 3,
+  };
+  // optional string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string cursor = 4;
+  bool has_cursor() const;
+  private:
+  bool _internal_has_cursor() const;
+  public:
+  void clear_cursor();
+  const std::string& cursor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cursor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cursor();
+  PROTOBUF_NODISCARD std::string* release_cursor();
+  void set_allocated_cursor(std::string* cursor);
+  private:
+  const std::string& _internal_cursor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cursor(const std::string& value);
+  std::string* _internal_mutable_cursor();
+  public:
+
+  // optional uint32 page = 2;
+  bool has_page() const;
+  private:
+  bool _internal_has_page() const;
+  public:
+  void clear_page();
+  uint32_t page() const;
+  void set_page(uint32_t value);
+  private:
+  uint32_t _internal_page() const;
+  void _internal_set_page(uint32_t value);
+  public:
+
+  // optional uint32 records = 3;
+  bool has_records() const;
+  private:
+  bool _internal_has_records() const;
+  public:
+  void clear_records();
+  uint32_t records() const;
+  void set_records(uint32_t value);
+  private:
+  uint32_t _internal_records() const;
+  void _internal_set_records(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerDump_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cursor_;
+    uint32_t page_;
+    uint32_t records_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class managerDump_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerDump_Response) */ {
+ public:
+  inline managerDump_Response() : managerDump_Response(nullptr) {}
+  ~managerDump_Response() override;
+  explicit PROTOBUF_CONSTEXPR managerDump_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  managerDump_Response(const managerDump_Response& from);
+  managerDump_Response(managerDump_Response&& from) noexcept
+    : managerDump_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline managerDump_Response& operator=(const managerDump_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline managerDump_Response& operator=(managerDump_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const managerDump_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const managerDump_Response* internal_default_instance() {
+    return reinterpret_cast<const managerDump_Response*>(
+               &_managerDump_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(managerDump_Response& a, managerDump_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(managerDump_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(managerDump_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  managerDump_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerDump_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const managerDump_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const managerDump_Response& from) {
+    managerDump_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(managerDump_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.kvdb.managerDump_Response";
+  }
+  protected:
+  explicit managerDump_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kNextFieldNumber = 4,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::com::wazuh::api::engine::kvdb::Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >*
+      mutable_entries();
+  private:
+  const ::com::wazuh::api::engine::kvdb::Entry& _internal_entries(int index) const;
+  ::com::wazuh::api::engine::kvdb::Entry* _internal_add_entries();
+  public:
+  const ::com::wazuh::api::engine::kvdb::Entry& entries(int index) const;
+  ::com::wazuh::api::engine::kvdb::Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >&
+      entries() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional string next = 4;
+  bool has_next() const;
+  private:
+  bool _internal_has_next() const;
+  public:
+  void clear_next();
+  const std::string& next() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_next(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_next();
+  PROTOBUF_NODISCARD std::string* release_next();
+  void set_allocated_next(std::string* next);
+  private:
+  const std::string& _internal_next() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_next(const std::string& value);
+  std::string* _internal_mutable_next();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerDump_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr next_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class managerStats_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerStats_Request) */ {
+ public:
+  inline managerStats_Request() : managerStats_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR managerStats_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  managerStats_Request(const managerStats_Request& from);
+  managerStats_Request(managerStats_Request&& from) noexcept
+    : managerStats_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline managerStats_Request& operator=(const managerStats_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline managerStats_Request& operator=(managerStats_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const managerStats_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const managerStats_Request* internal_default_instance() {
+    return reinterpret_cast<const managerStats_Request*>(
+               &_managerStats_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(managerStats_Request& a, managerStats_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(managerStats_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(managerStats_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  managerStats_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerStats_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const managerStats_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const managerStats_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.kvdb.managerStats_Request";
+  }
+  protected:
+  explicit managerStats_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerStats_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_kvdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class managerStats_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.kvdb.managerStats_Response) */ {
+ public:
+  inline managerStats_Response() : managerStats_Response(nullptr) {}
+  ~managerStats_Response() override;
+  explicit PROTOBUF_CONSTEXPR managerStats_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  managerStats_Response(const managerStats_Response& from);
+  managerStats_Response(managerStats_Response&& from) noexcept
+    : managerStats_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline managerStats_Response& operator=(const managerStats_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline managerStats_Response& operator=(managerStats_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const managerStats_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const managerStats_Response* internal_default_instance() {
+    return reinterpret_cast<const managerStats_Response*>(
+               &_managerStats_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(managerStats_Response& a, managerStats_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(managerStats_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(managerStats_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  managerStats_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<managerStats_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const managerStats_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const managerStats_Response& from) {
+    managerStats_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(managerStats_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.kvdb.managerStats_Response";
+  }
+  protected:
+  explicit managerStats_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kBlockCacheUsageFieldNumber = 3,
+    kBlockCacheCapacityFieldNumber = 4,
+    kBlockCacheHitFieldNumber = 5,
+    kBlockCacheMissFieldNumber = 6,
+    kBlockCacheHitRatioFieldNumber = 7,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional uint64 block_cache_usage = 3;
+  bool has_block_cache_usage() const;
+  private:
+  bool _internal_has_block_cache_usage() const;
+  public:
+  void clear_block_cache_usage();
+  uint64_t block_cache_usage() const;
+  void set_block_cache_usage(uint64_t value);
+  private:
+  uint64_t _internal_block_cache_usage() const;
+  void _internal_set_block_cache_usage(uint64_t value);
+  public:
+
+  // optional uint64 block_cache_capacity = 4;
+  bool has_block_cache_capacity() const;
+  private:
+  bool _internal_has_block_cache_capacity() const;
+  public:
+  void clear_block_cache_capacity();
+  uint64_t block_cache_capacity() const;
+  void set_block_cache_capacity(uint64_t value);
+  private:
+  uint64_t _internal_block_cache_capacity() const;
+  void _internal_set_block_cache_capacity(uint64_t value);
+  public:
+
+  // optional uint64 block_cache_hit = 5;
+  bool has_block_cache_hit() const;
+  private:
+  bool _internal_has_block_cache_hit() const;
+  public:
+  void clear_block_cache_hit();
+  uint64_t block_cache_hit() const;
+  void set_block_cache_hit(uint64_t value);
+  private:
+  uint64_t _internal_block_cache_hit() const;
+  void _internal_set_block_cache_hit(uint64_t value);
+  public:
+
+  // optional uint64 block_cache_miss = 6;
+  bool has_block_cache_miss() const;
+  private:
+  bool _internal_has_block_cache_miss() const;
+  public:
+  void clear_block_cache_miss();
+  uint64_t block_cache_miss() const;
+  void set_block_cache_miss(uint64_t value);
+  private:
+  uint64_t _internal_block_cache_miss() const;
+  void _internal_set_block_cache_miss(uint64_t value);
+  public:
+
+  // optional double block_cache_hit_ratio = 7;
+  bool has_block_cache_hit_ratio() const;
+  private:
+  bool _internal_has_block_cache_hit_ratio() const;
+  public:
+  void clear_block_cache_hit_ratio();
+  double block_cache_hit_ratio() const;
+  void set_block_cache_hit_ratio(double value);
+  private:
+  double _internal_block_cache_hit_ratio() const;
+  void _internal_set_block_cache_hit_ratio(double value);
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.kvdb.managerStats_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    uint64_t block_cache_usage_;
+    uint64_t block_cache_capacity_;
+    uint64_t block_cache_hit_;
+    uint64_t block_cache_miss_;
+    double block_cache_hit_ratio_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_kvdb_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Entry
+
+// optional string key = 1;
+inline bool Entry::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Entry::has_key() const {
+  return _internal_has_key();
+}
+inline void Entry::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Entry::key() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.Entry.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Entry::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.Entry.key)
+}
+inline std::string* Entry::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.Entry.key)
+  return _s;
+}
+inline const std::string& Entry::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Entry::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_key() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.Entry.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.Entry.key)
+}
+
+// optional .google.protobuf.Value value = 2;
+inline bool Entry::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline bool Entry::has_value() const {
+  return _internal_has_value();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& Entry::_internal_value() const {
+  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& Entry::value() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.Entry.value)
+  return _internal_value();
+}
+inline void Entry::unsafe_arena_set_allocated_value(
+    ::PROTOBUF_NAMESPACE_ID::Value* value) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = value;
+  if (value) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.kvdb.Entry.value)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::release_value() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.Entry.value)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
+    _impl_.value_ = p;
+  }
+  return _impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::mutable_value() {
+  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.Entry.value)
+  return _msg;
+}
+inline void Entry::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.Entry.value)
+}
+
+// -------------------------------------------------------------------
+
+// dbGet_Request
+
+// optional string name = 1;
+inline bool dbGet_Request::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool dbGet_Request::has_name() const {
+  return _internal_has_name();
+}
+inline void dbGet_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& dbGet_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+}
+inline std::string* dbGet_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+  return _s;
+}
+inline const std::string& dbGet_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void dbGet_Request::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbGet_Request::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbGet_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbGet_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+}
+
+// optional string key = 2;
+inline bool dbGet_Request::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool dbGet_Request::has_key() const {
+  return _internal_has_key();
+}
+inline void dbGet_Request::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& dbGet_Request::key() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbGet_Request::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+}
+inline std::string* dbGet_Request::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+  return _s;
+}
+inline const std::string& dbGet_Request::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void dbGet_Request::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbGet_Request::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbGet_Request::release_key() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbGet_Request::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+}
+
+// -------------------------------------------------------------------
+
+// dbGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void dbGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus dbGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus dbGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Response.status)
+  return _internal_status();
+}
+inline void dbGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void dbGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool dbGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool dbGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void dbGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& dbGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+}
+inline std::string* dbGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+  return _s;
+}
+inline const std::string& dbGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void dbGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+}
+
+// optional .google.protobuf.Value value = 3;
+inline bool dbGet_Response::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline bool dbGet_Response::has_value() const {
+  return _internal_has_value();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& dbGet_Response::_internal_value() const {
+  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& dbGet_Response::value() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+  return _internal_value();
+}
+inline void dbGet_Response::unsafe_arena_set_allocated_value(
+    ::PROTOBUF_NAMESPACE_ID::Value* value) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = value;
+  if (value) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::release_value() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
+    _impl_.value_ = p;
+  }
+  return _impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::mutable_value() {
+  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+  return _msg;
+}
+inline void dbGet_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+}
+
+// -------------------------------------------------------------------
+
+// dbSearch_Request
+
+// optional string name = 1;
+inline bool dbSearch_Request::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool dbSearch_Request::has_name() const {
+  return _internal_has_name();
+}
+inline void dbSearch_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& dbSearch_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+  return _internal_name();
 }
-inline std::string* Entry::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.Entry.key)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+}
+inline std::string* dbSearch_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+  return _s;
+}
+inline const std::string& dbSearch_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void dbSearch_Request::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbSearch_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+}
+
+// optional string prefix = 2;
+inline bool dbSearch_Request::_internal_has_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool dbSearch_Request::has_prefix() const {
+  return _internal_has_prefix();
+}
+inline void dbSearch_Request::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& dbSearch_Request::prefix() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Request::set_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+}
+inline std::string* dbSearch_Request::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+  return _s;
+}
+inline const std::string& dbSearch_Request::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void dbSearch_Request::_internal_set_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::_internal_mutable_prefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::release_prefix() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+  if (!_internal_has_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbSearch_Request::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+}
+
+// optional uint32 page = 3;
+inline bool dbSearch_Request::_internal_has_page() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool dbSearch_Request::has_page() const {
+  return _internal_has_page();
+}
+inline void dbSearch_Request::clear_page() {
+  _impl_.page_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t dbSearch_Request::_internal_page() const {
+  return _impl_.page_;
+}
+inline uint32_t dbSearch_Request::page() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.page)
+  return _internal_page();
+}
+inline void dbSearch_Request::_internal_set_page(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.page_ = value;
+}
+inline void dbSearch_Request::set_page(uint32_t value) {
+  _internal_set_page(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.page)
+}
+
+// optional uint32 records = 4;
+inline bool dbSearch_Request::_internal_has_records() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool dbSearch_Request::has_records() const {
+  return _internal_has_records();
+}
+inline void dbSearch_Request::clear_records() {
+  _impl_.records_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t dbSearch_Request::_internal_records() const {
+  return _impl_.records_;
+}
+inline uint32_t dbSearch_Request::records() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.records)
+  return _internal_records();
+}
+inline void dbSearch_Request::_internal_set_records(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.records_ = value;
+}
+inline void dbSearch_Request::set_records(uint32_t value) {
+  _internal_set_records(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.records)
+}
+
+// optional string cursor = 5;
+inline bool dbSearch_Request::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool dbSearch_Request::has_cursor() const {
+  return _internal_has_cursor();
+}
+inline void dbSearch_Request::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& dbSearch_Request::cursor() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Request::set_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+}
+inline std::string* dbSearch_Request::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+  return _s;
+}
+inline const std::string& dbSearch_Request::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void dbSearch_Request::_internal_set_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* dbSearch_Request::release_cursor() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+  if (!_internal_has_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbSearch_Request::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Request.cursor)
+}
+
+// -------------------------------------------------------------------
+
+// dbSearch_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void dbSearch_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus dbSearch_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus dbSearch_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.status)
+  return _internal_status();
+}
+inline void dbSearch_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void dbSearch_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Response.status)
+}
+
+// optional string error = 2;
+inline bool dbSearch_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool dbSearch_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void dbSearch_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& dbSearch_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+}
+inline std::string* dbSearch_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
   return _s;
 }
-inline const std::string& Entry::_internal_key() const {
-  return _impl_.key_.Get();
+inline const std::string& dbSearch_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void Entry::_internal_set_key(const std::string& value) {
+inline void dbSearch_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_key() {
+inline std::string* dbSearch_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_key() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.Entry.key)
-  if (!_internal_has_key()) {
+inline std::string* dbSearch_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.key_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Entry::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void dbSearch_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.Entry.key)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
 }
 
-// optional .google.protobuf.Value value = 2;
-inline bool Entry::_internal_has_value() const {
+// repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
+inline int dbSearch_Response::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int dbSearch_Response::entries_size() const {
+  return _internal_entries_size();
+}
+inline void dbSearch_Response::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::com::wazuh::api::engine::kvdb::Entry* dbSearch_Response::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >*
+dbSearch_Response::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
+  return &_impl_.entries_;
+}
+inline const ::com::wazuh::api::engine::kvdb::Entry& dbSearch_Response::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::com::wazuh::api::engine::kvdb::Entry& dbSearch_Response::entries(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
+  return _internal_entries(index);
+}
+inline ::com::wazuh::api::engine::kvdb::Entry* dbSearch_Response::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::com::wazuh::api::engine::kvdb::Entry* dbSearch_Response::add_entries() {
+  ::com::wazuh::api::engine::kvdb::Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >&
+dbSearch_Response::entries() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
+  return _impl_.entries_;
+}
+
+// optional string next = 4;
+inline bool dbSearch_Response::_internal_has_next() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
   return value;
 }
-inline bool Entry::has_value() const {
-  return _internal_has_value();
+inline bool dbSearch_Response::has_next() const {
+  return _internal_has_next();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& Entry::_internal_value() const {
-  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
-      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+inline void dbSearch_Response::clear_next() {
+  _impl_.next_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& Entry::value() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.Entry.value)
-  return _internal_value();
+inline const std::string& dbSearch_Response::next() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.next)
+  return _internal_next();
 }
-inline void Entry::unsafe_arena_set_allocated_value(
-    ::PROTOBUF_NAMESPACE_ID::Value* value) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
-  }
-  _impl_.value_ = value;
-  if (value) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.kvdb.Entry.value)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbSearch_Response::set_next(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.next_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Response.next)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::release_value() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline std::string* dbSearch_Response::mutable_next() {
+  std::string* _s = _internal_mutable_next();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Response.next)
+  return _s;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.Entry.value)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-  return temp;
+inline const std::string& dbSearch_Response::_internal_next() const {
+  return _impl_.next_.Get();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::_internal_mutable_value() {
+inline void dbSearch_Response::_internal_set_next(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.value_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
-    _impl_.value_ = p;
-  }
-  return _impl_.value_;
+  _impl_.next_.Set(value, GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Entry::mutable_value() {
-  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.Entry.value)
-  return _msg;
+inline std::string* dbSearch_Response::_internal_mutable_next() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.next_.Mutable(GetArenaForAllocation());
 }
-inline void Entry::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+inline std::string* dbSearch_Response::release_next() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Response.next)
+  if (!_internal_has_next()) {
+    return nullptr;
   }
-  if (value) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
-    if (message_arena != submessage_arena) {
-      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, value, submessage_arena);
-    }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.next_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_.IsDefault()) {
+    _impl_.next_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbSearch_Response::set_allocated_next(std::string* next) {
+  if (next != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.value_ = value;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.Entry.value)
+  _impl_.next_.SetAllocated(next, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_.IsDefault()) {
+    _impl_.next_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Response.next)
 }
 
 // -------------------------------------------------------------------
 
-// dbGet_Request
+// dbDelete_Request
 
 // optional string name = 1;
-inline bool dbGet_Request::_internal_has_name() const {
+inline bool dbDelete_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool dbGet_Request::has_name() const {
+inline bool dbDelete_Request::has_name() const {
   return _internal_has_name();
 }
-inline void dbGet_Request::clear_name() {
+inline void dbDelete_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& dbGet_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+inline const std::string& dbDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void dbDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
 }
-inline std::string* dbGet_Request::mutable_name() {
+inline std::string* dbDelete_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
   return _s;
 }
-inline const std::string& dbGet_Request::_internal_name() const {
+inline const std::string& dbDelete_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void dbGet_Request::_internal_set_name(const std::string& value) {
+inline void dbDelete_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbGet_Request::_internal_mutable_name() {
+inline std::string* dbDelete_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbGet_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+inline std::string* dbDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
@@ -2714,7 +4673,7 @@ inline std::string* dbGet_Request::release_name() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbGet_Request::set_allocated_name(std::string* name) {
+inline void dbDelete_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -2726,50 +4685,50 @@ inline void dbGet_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
 }
 
 // optional string key = 2;
-inline bool dbGet_Request::_internal_has_key() const {
+inline bool dbDelete_Request::_internal_has_key() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool dbGet_Request::has_key() const {
+inline bool dbDelete_Request::has_key() const {
   return _internal_has_key();
 }
-inline void dbGet_Request::clear_key() {
+inline void dbDelete_Request::clear_key() {
   _impl_.key_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& dbGet_Request::key() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+inline const std::string& dbDelete_Request::key() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbGet_Request::set_key(ArgT0&& arg0, ArgT... args) {
+void dbDelete_Request::set_key(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
  _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
 }
-inline std::string* dbGet_Request::mutable_key() {
+inline std::string* dbDelete_Request::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
   return _s;
 }
-inline const std::string& dbGet_Request::_internal_key() const {
+inline const std::string& dbDelete_Request::_internal_key() const {
   return _impl_.key_.Get();
 }
-inline void dbGet_Request::_internal_set_key(const std::string& value) {
+inline void dbDelete_Request::_internal_set_key(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
   _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbGet_Request::_internal_mutable_key() {
+inline std::string* dbDelete_Request::_internal_mutable_key() {
   _impl_._has_bits_[0] |= 0x00000002u;
   return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbGet_Request::release_key() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+inline std::string* dbDelete_Request::release_key() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
   if (!_internal_has_key()) {
     return nullptr;
   }
@@ -2782,7 +4741,7 @@ inline std::string* dbGet_Request::release_key() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbGet_Request::set_allocated_key(std::string* key) {
+inline void dbDelete_Request::set_allocated_key(std::string* key) {
   if (key != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
@@ -2794,136 +4753,120 @@ inline void dbGet_Request::set_allocated_key(std::string* key) {
     _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Request.key)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
 }
 
 // -------------------------------------------------------------------
 
-// dbGet_Response
-
-// .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void dbGet_Response::clear_status() {
-  _impl_.status_ = 0;
-}
-inline ::com::wazuh::api::engine::ReturnStatus dbGet_Response::_internal_status() const {
-  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
-}
-inline ::com::wazuh::api::engine::ReturnStatus dbGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Response.status)
-  return _internal_status();
-}
-inline void dbGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  
-  _impl_.status_ = value;
-}
-inline void dbGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Response.status)
-}
+// dbPut_Request
 
-// optional string error = 2;
-inline bool dbGet_Response::_internal_has_error() const {
+// optional string name = 1;
+inline bool dbPut_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool dbGet_Response::has_error() const {
-  return _internal_has_error();
+inline bool dbPut_Request::has_name() const {
+  return _internal_has_name();
 }
-inline void dbGet_Response::clear_error() {
-  _impl_.error_.ClearToEmpty();
+inline void dbPut_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& dbGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Response.error)
-  return _internal_error();
+inline const std::string& dbPut_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbPut_Request.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void dbPut_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbPut_Request.name)
 }
-inline std::string* dbGet_Response::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+inline std::string* dbPut_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbPut_Request.name)
   return _s;
 }
-inline const std::string& dbGet_Response::_internal_error() const {
-  return _impl_.error_.Get();
+inline const std::string& dbPut_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void dbGet_Response::_internal_set_error(const std::string& value) {
+inline void dbPut_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbGet_Response::_internal_mutable_error() {
+inline std::string* dbPut_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Response.error)
-  if (!_internal_has_error()) {
+inline std::string* dbPut_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbPut_Request.name)
+  if (!_internal_has_name()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.error_.Release();
+  auto* p = _impl_.name_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbGet_Response::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
+inline void dbPut_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbPut_Request.name)
 }
 
-// optional .google.protobuf.Value value = 3;
-inline bool dbGet_Response::_internal_has_value() const {
+// optional .com.wazuh.api.engine.kvdb.Entry entry = 2;
+inline bool dbPut_Request::_internal_has_entry() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  PROTOBUF_ASSUME(!value || _impl_.entry_ != nullptr);
   return value;
 }
-inline bool dbGet_Response::has_value() const {
-  return _internal_has_value();
+inline bool dbPut_Request::has_entry() const {
+  return _internal_has_entry();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& dbGet_Response::_internal_value() const {
-  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
-      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+inline void dbPut_Request::clear_entry() {
+  if (_impl_.entry_ != nullptr) _impl_.entry_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& dbGet_Response::value() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbGet_Response.value)
-  return _internal_value();
+inline const ::com::wazuh::api::engine::kvdb::Entry& dbPut_Request::_internal_entry() const {
+  const ::com::wazuh::api::engine::kvdb::Entry* p = _impl_.entry_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::kvdb::Entry&>(
+      ::com::wazuh::api::engine::kvdb::_Entry_default_instance_);
 }
-inline void dbGet_Response::unsafe_arena_set_allocated_value(
-    ::PROTOBUF_NAMESPACE_ID::Value* value) {
+inline const ::com::wazuh::api::engine::kvdb::Entry& dbPut_Request::entry() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
+  return _internal_entry();
+}
+inline void dbPut_Request::unsafe_arena_set_allocated_entry(
+    ::com::wazuh::api::engine::kvdb::Entry* entry) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.entry_);
   }
-  _impl_.value_ = value;
-  if (value) {
+  _impl_.entry_ = entry;
+  if (entry) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::release_value() {
+inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::release_entry() {
   _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
+  ::com::wazuh::api::engine::kvdb::Entry* temp = _impl_.entry_;
+  _impl_.entry_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -2935,92 +4878,91 @@ inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::release_value() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::unsafe_arena_release_entry() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
   _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
+  ::com::wazuh::api::engine::kvdb::Entry* temp = _impl_.entry_;
+  _impl_.entry_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::_internal_mutable_value() {
+inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::_internal_mutable_entry() {
   _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.value_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
-    _impl_.value_ = p;
+  if (_impl_.entry_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::kvdb::Entry>(GetArenaForAllocation());
+    _impl_.entry_ = p;
   }
-  return _impl_.value_;
+  return _impl_.entry_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* dbGet_Response::mutable_value() {
-  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::mutable_entry() {
+  ::com::wazuh::api::engine::kvdb::Entry* _msg = _internal_mutable_entry();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
   return _msg;
 }
-inline void dbGet_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
+inline void dbPut_Request::set_allocated_entry(::com::wazuh::api::engine::kvdb::Entry* entry) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+    delete _impl_.entry_;
   }
-  if (value) {
+  if (entry) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(entry);
     if (message_arena != submessage_arena) {
-      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, value, submessage_arena);
+      entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, entry, submessage_arena);
     }
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.value_ = value;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbGet_Response.value)
+  _impl_.entry_ = entry;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
 }
 
 // -------------------------------------------------------------------
 
-// dbSearch_Request
+// dbImport_Request
 
 // optional string name = 1;
-inline bool dbSearch_Request::_internal_has_name() const {
+inline bool dbImport_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool dbSearch_Request::has_name() const {
+inline bool dbImport_Request::has_name() const {
   return _internal_has_name();
 }
-inline void dbSearch_Request::clear_name() {
+inline void dbImport_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& dbSearch_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+inline const std::string& dbImport_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbImport_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbSearch_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void dbImport_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbImport_Request.name)
 }
-inline std::string* dbSearch_Request::mutable_name() {
+inline std::string* dbImport_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbImport_Request.name)
   return _s;
 }
-inline const std::string& dbSearch_Request::_internal_name() const {
+inline const std::string& dbImport_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void dbSearch_Request::_internal_set_name(const std::string& value) {
+inline void dbImport_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbSearch_Request::_internal_mutable_name() {
+inline std::string* dbImport_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbSearch_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+inline std::string* dbImport_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbImport_Request.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
@@ -3033,7 +4975,7 @@ inline std::string* dbSearch_Request::release_name() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbSearch_Request::set_allocated_name(std::string* name) {
+inline void dbImport_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3045,198 +4987,142 @@ inline void dbSearch_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbImport_Request.name)
 }
 
-// optional string prefix = 2;
-inline bool dbSearch_Request::_internal_has_prefix() const {
+// optional string content = 2;
+inline bool dbImport_Request::_internal_has_content() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool dbSearch_Request::has_prefix() const {
-  return _internal_has_prefix();
+inline bool dbImport_Request::has_content() const {
+  return _internal_has_content();
 }
-inline void dbSearch_Request::clear_prefix() {
-  _impl_.prefix_.ClearToEmpty();
+inline void dbImport_Request::clear_content() {
+  _impl_.content_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& dbSearch_Request::prefix() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
-  return _internal_prefix();
+inline const std::string& dbImport_Request::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbImport_Request.content)
+  return _internal_content();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbSearch_Request::set_prefix(ArgT0&& arg0, ArgT... args) {
+void dbImport_Request::set_content(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbImport_Request.content)
 }
-inline std::string* dbSearch_Request::mutable_prefix() {
-  std::string* _s = _internal_mutable_prefix();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
+inline std::string* dbImport_Request::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbImport_Request.content)
   return _s;
 }
-inline const std::string& dbSearch_Request::_internal_prefix() const {
-  return _impl_.prefix_.Get();
+inline const std::string& dbImport_Request::_internal_content() const {
+  return _impl_.content_.Get();
 }
-inline void dbSearch_Request::_internal_set_prefix(const std::string& value) {
+inline void dbImport_Request::_internal_set_content(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.prefix_.Set(value, GetArenaForAllocation());
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbSearch_Request::_internal_mutable_prefix() {
+inline std::string* dbImport_Request::_internal_mutable_content() {
   _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+  return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbSearch_Request::release_prefix() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
-  if (!_internal_has_prefix()) {
+inline std::string* dbImport_Request::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbImport_Request.content)
+  if (!_internal_has_content()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.prefix_.Release();
+  auto* p = _impl_.content_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.prefix_.IsDefault()) {
-    _impl_.prefix_.Set("", GetArenaForAllocation());
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbSearch_Request::set_allocated_prefix(std::string* prefix) {
-  if (prefix != nullptr) {
+inline void dbImport_Request::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.prefix_.IsDefault()) {
-    _impl_.prefix_.Set("", GetArenaForAllocation());
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Request.prefix)
-}
-
-// optional uint32 page = 3;
-inline bool dbSearch_Request::_internal_has_page() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline bool dbSearch_Request::has_page() const {
-  return _internal_has_page();
-}
-inline void dbSearch_Request::clear_page() {
-  _impl_.page_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline uint32_t dbSearch_Request::_internal_page() const {
-  return _impl_.page_;
-}
-inline uint32_t dbSearch_Request::page() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.page)
-  return _internal_page();
-}
-inline void dbSearch_Request::_internal_set_page(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.page_ = value;
-}
-inline void dbSearch_Request::set_page(uint32_t value) {
-  _internal_set_page(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.page)
-}
-
-// optional uint32 records = 4;
-inline bool dbSearch_Request::_internal_has_records() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
-  return value;
-}
-inline bool dbSearch_Request::has_records() const {
-  return _internal_has_records();
-}
-inline void dbSearch_Request::clear_records() {
-  _impl_.records_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000008u;
-}
-inline uint32_t dbSearch_Request::_internal_records() const {
-  return _impl_.records_;
-}
-inline uint32_t dbSearch_Request::records() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Request.records)
-  return _internal_records();
-}
-inline void dbSearch_Request::_internal_set_records(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000008u;
-  _impl_.records_ = value;
-}
-inline void dbSearch_Request::set_records(uint32_t value) {
-  _internal_set_records(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Request.records)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbImport_Request.content)
 }
 
 // -------------------------------------------------------------------
 
-// dbSearch_Response
+// dbImport_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void dbSearch_Response::clear_status() {
+inline void dbImport_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus dbSearch_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus dbImport_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus dbSearch_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus dbImport_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbImport_Response.status)
   return _internal_status();
 }
-inline void dbSearch_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void dbImport_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void dbSearch_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void dbImport_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbImport_Response.status)
 }
 
 // optional string error = 2;
-inline bool dbSearch_Response::_internal_has_error() const {
+inline bool dbImport_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool dbSearch_Response::has_error() const {
+inline bool dbImport_Response::has_error() const {
   return _internal_has_error();
 }
-inline void dbSearch_Response::clear_error() {
+inline void dbImport_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& dbSearch_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+inline const std::string& dbImport_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbImport_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbSearch_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void dbImport_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbImport_Response.error)
 }
-inline std::string* dbSearch_Response::mutable_error() {
+inline std::string* dbImport_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbImport_Response.error)
   return _s;
 }
-inline const std::string& dbSearch_Response::_internal_error() const {
+inline const std::string& dbImport_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void dbSearch_Response::_internal_set_error(const std::string& value) {
+inline void dbImport_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbSearch_Response::_internal_mutable_error() {
+inline std::string* dbImport_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbSearch_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+inline std::string* dbImport_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbImport_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -3249,7 +5135,7 @@ inline std::string* dbSearch_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbSearch_Response::set_allocated_error(std::string* error) {
+inline void dbImport_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3261,94 +5147,82 @@ inline void dbSearch_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbSearch_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbImport_Response.error)
 }
 
-// repeated .com.wazuh.api.engine.kvdb.Entry entries = 3;
-inline int dbSearch_Response::_internal_entries_size() const {
-  return _impl_.entries_.size();
-}
-inline int dbSearch_Response::entries_size() const {
-  return _internal_entries_size();
-}
-inline void dbSearch_Response::clear_entries() {
-  _impl_.entries_.Clear();
-}
-inline ::com::wazuh::api::engine::kvdb::Entry* dbSearch_Response::mutable_entries(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
-  return _impl_.entries_.Mutable(index);
+// optional uint32 imported = 3;
+inline bool dbImport_Response::_internal_has_imported() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >*
-dbSearch_Response::mutable_entries() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
-  return &_impl_.entries_;
+inline bool dbImport_Response::has_imported() const {
+  return _internal_has_imported();
 }
-inline const ::com::wazuh::api::engine::kvdb::Entry& dbSearch_Response::_internal_entries(int index) const {
-  return _impl_.entries_.Get(index);
+inline void dbImport_Response::clear_imported() {
+  _impl_.imported_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::com::wazuh::api::engine::kvdb::Entry& dbSearch_Response::entries(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
-  return _internal_entries(index);
+inline uint32_t dbImport_Response::_internal_imported() const {
+  return _impl_.imported_;
 }
-inline ::com::wazuh::api::engine::kvdb::Entry* dbSearch_Response::_internal_add_entries() {
-  return _impl_.entries_.Add();
+inline uint32_t dbImport_Response::imported() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbImport_Response.imported)
+  return _internal_imported();
 }
-inline ::com::wazuh::api::engine::kvdb::Entry* dbSearch_Response::add_entries() {
-  ::com::wazuh::api::engine::kvdb::Entry* _add = _internal_add_entries();
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
-  return _add;
+inline void dbImport_Response::_internal_set_imported(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.imported_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::kvdb::Entry >&
-dbSearch_Response::entries() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.kvdb.dbSearch_Response.entries)
-  return _impl_.entries_;
+inline void dbImport_Response::set_imported(uint32_t value) {
+  _internal_set_imported(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbImport_Response.imported)
 }
 
 // -------------------------------------------------------------------
 
-// dbDelete_Request
+// dbExport_Request
 
 // optional string name = 1;
-inline bool dbDelete_Request::_internal_has_name() const {
+inline bool dbExport_Request::_internal_has_name() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool dbDelete_Request::has_name() const {
+inline bool dbExport_Request::has_name() const {
   return _internal_has_name();
 }
-inline void dbDelete_Request::clear_name() {
+inline void dbExport_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& dbDelete_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
+inline const std::string& dbExport_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbExport_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void dbExport_Request::set_name(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbExport_Request.name)
 }
-inline std::string* dbDelete_Request::mutable_name() {
+inline std::string* dbExport_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbExport_Request.name)
   return _s;
 }
-inline const std::string& dbDelete_Request::_internal_name() const {
+inline const std::string& dbExport_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void dbDelete_Request::_internal_set_name(const std::string& value) {
+inline void dbExport_Request::_internal_set_name(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbDelete_Request::_internal_mutable_name() {
+inline std::string* dbExport_Request::_internal_mutable_name() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbDelete_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
+inline std::string* dbExport_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbExport_Request.name)
   if (!_internal_has_name()) {
     return nullptr;
   }
@@ -3361,7 +5235,7 @@ inline std::string* dbDelete_Request::release_name() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbDelete_Request::set_allocated_name(std::string* name) {
+inline void dbExport_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3373,237 +5247,167 @@ inline void dbDelete_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbDelete_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbExport_Request.name)
 }
 
-// optional string key = 2;
-inline bool dbDelete_Request::_internal_has_key() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline bool dbDelete_Request::has_key() const {
-  return _internal_has_key();
-}
-inline void dbDelete_Request::clear_key() {
-  _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
-}
-inline const std::string& dbDelete_Request::key() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
-  return _internal_key();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void dbDelete_Request::set_key(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
-}
-inline std::string* dbDelete_Request::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
-  return _s;
-}
-inline const std::string& dbDelete_Request::_internal_key() const {
-  return _impl_.key_.Get();
+// -------------------------------------------------------------------
+
+// dbExport_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void dbExport_Response::clear_status() {
+  _impl_.status_ = 0;
 }
-inline void dbDelete_Request::_internal_set_key(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.key_.Set(value, GetArenaForAllocation());
+inline ::com::wazuh::api::engine::ReturnStatus dbExport_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline std::string* dbDelete_Request::_internal_mutable_key() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+inline ::com::wazuh::api::engine::ReturnStatus dbExport_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbExport_Response.status)
+  return _internal_status();
 }
-inline std::string* dbDelete_Request::release_key() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
-  if (!_internal_has_key()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.key_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void dbExport_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
 }
-inline void dbDelete_Request::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbDelete_Request.key)
+inline void dbExport_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbExport_Response.status)
 }
 
-// -------------------------------------------------------------------
-
-// dbPut_Request
-
-// optional string name = 1;
-inline bool dbPut_Request::_internal_has_name() const {
+// optional string error = 2;
+inline bool dbExport_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool dbPut_Request::has_name() const {
-  return _internal_has_name();
+inline bool dbExport_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void dbPut_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+inline void dbExport_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& dbPut_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbPut_Request.name)
-  return _internal_name();
+inline const std::string& dbExport_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbExport_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void dbPut_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void dbExport_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbPut_Request.name)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbExport_Response.error)
 }
-inline std::string* dbPut_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbPut_Request.name)
+inline std::string* dbExport_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbExport_Response.error)
   return _s;
 }
-inline const std::string& dbPut_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline const std::string& dbExport_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void dbPut_Request::_internal_set_name(const std::string& value) {
+inline void dbExport_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.name_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* dbPut_Request::_internal_mutable_name() {
+inline std::string* dbExport_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* dbPut_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbPut_Request.name)
-  if (!_internal_has_name()) {
+inline std::string* dbExport_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbExport_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.name_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void dbPut_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void dbExport_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbPut_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbExport_Response.error)
 }
 
-// optional .com.wazuh.api.engine.kvdb.Entry entry = 2;
-inline bool dbPut_Request::_internal_has_entry() const {
+// optional string content = 3;
+inline bool dbExport_Response::_internal_has_content() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.entry_ != nullptr);
   return value;
 }
-inline bool dbPut_Request::has_entry() const {
-  return _internal_has_entry();
+inline bool dbExport_Response::has_content() const {
+  return _internal_has_content();
 }
-inline void dbPut_Request::clear_entry() {
-  if (_impl_.entry_ != nullptr) _impl_.entry_->Clear();
+inline void dbExport_Response::clear_content() {
+  _impl_.content_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::com::wazuh::api::engine::kvdb::Entry& dbPut_Request::_internal_entry() const {
-  const ::com::wazuh::api::engine::kvdb::Entry* p = _impl_.entry_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::kvdb::Entry&>(
-      ::com::wazuh::api::engine::kvdb::_Entry_default_instance_);
-}
-inline const ::com::wazuh::api::engine::kvdb::Entry& dbPut_Request::entry() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
-  return _internal_entry();
-}
-inline void dbPut_Request::unsafe_arena_set_allocated_entry(
-    ::com::wazuh::api::engine::kvdb::Entry* entry) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.entry_);
-  }
-  _impl_.entry_ = entry;
-  if (entry) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
-}
-inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::release_entry() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::kvdb::Entry* temp = _impl_.entry_;
-  _impl_.entry_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& dbExport_Response::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.dbExport_Response.content)
+  return _internal_content();
 }
-inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::unsafe_arena_release_entry() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::kvdb::Entry* temp = _impl_.entry_;
-  _impl_.entry_ = nullptr;
-  return temp;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void dbExport_Response::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.dbExport_Response.content)
 }
-inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::_internal_mutable_entry() {
+inline std::string* dbExport_Response::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbExport_Response.content)
+  return _s;
+}
+inline const std::string& dbExport_Response::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void dbExport_Response::_internal_set_content(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.entry_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::kvdb::Entry>(GetArenaForAllocation());
-    _impl_.entry_ = p;
-  }
-  return _impl_.entry_;
+  _impl_.content_.Set(value, GetArenaForAllocation());
 }
-inline ::com::wazuh::api::engine::kvdb::Entry* dbPut_Request::mutable_entry() {
-  ::com::wazuh::api::engine::kvdb::Entry* _msg = _internal_mutable_entry();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
-  return _msg;
+inline std::string* dbExport_Response::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
 }
-inline void dbPut_Request::set_allocated_entry(::com::wazuh::api::engine::kvdb::Entry* entry) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.entry_;
+inline std::string* dbExport_Response::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.dbExport_Response.content)
+  if (!_internal_has_content()) {
+    return nullptr;
   }
-  if (entry) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(entry);
-    if (message_arena != submessage_arena) {
-      entry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, entry, submessage_arena);
-    }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void dbExport_Response::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.entry_ = entry;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbPut_Request.entry)
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.dbExport_Response.content)
 }
 
 // -------------------------------------------------------------------
@@ -4151,7 +5955,7 @@ inline void managerDump_Request::set_allocated_name(std::string* name) {
 
 // optional uint32 page = 2;
 inline bool managerDump_Request::_internal_has_page() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool managerDump_Request::has_page() const {
@@ -4159,7 +5963,7 @@ inline bool managerDump_Request::has_page() const {
 }
 inline void managerDump_Request::clear_page() {
   _impl_.page_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 inline uint32_t managerDump_Request::_internal_page() const {
   return _impl_.page_;
@@ -4169,7 +5973,7 @@ inline uint32_t managerDump_Request::page() const {
   return _internal_page();
 }
 inline void managerDump_Request::_internal_set_page(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_._has_bits_[0] |= 0x00000004u;
   _impl_.page_ = value;
 }
 inline void managerDump_Request::set_page(uint32_t value) {
@@ -4179,7 +5983,7 @@ inline void managerDump_Request::set_page(uint32_t value) {
 
 // optional uint32 records = 3;
 inline bool managerDump_Request::_internal_has_records() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool managerDump_Request::has_records() const {
@@ -4187,7 +5991,7 @@ inline bool managerDump_Request::has_records() const {
 }
 inline void managerDump_Request::clear_records() {
   _impl_.records_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline uint32_t managerDump_Request::_internal_records() const {
   return _impl_.records_;
@@ -4197,7 +6001,7 @@ inline uint32_t managerDump_Request::records() const {
   return _internal_records();
 }
 inline void managerDump_Request::_internal_set_records(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_._has_bits_[0] |= 0x00000008u;
   _impl_.records_ = value;
 }
 inline void managerDump_Request::set_records(uint32_t value) {
@@ -4205,6 +6009,74 @@ inline void managerDump_Request::set_records(uint32_t value) {
   // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerDump_Request.records)
 }
 
+// optional string cursor = 4;
+inline bool managerDump_Request::_internal_has_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool managerDump_Request::has_cursor() const {
+  return _internal_has_cursor();
+}
+inline void managerDump_Request::clear_cursor() {
+  _impl_.cursor_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& managerDump_Request::cursor() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+  return _internal_cursor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void managerDump_Request::set_cursor(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.cursor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+}
+inline std::string* managerDump_Request::mutable_cursor() {
+  std::string* _s = _internal_mutable_cursor();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+  return _s;
+}
+inline const std::string& managerDump_Request::_internal_cursor() const {
+  return _impl_.cursor_.Get();
+}
+inline void managerDump_Request::_internal_set_cursor(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.cursor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* managerDump_Request::_internal_mutable_cursor() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.cursor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* managerDump_Request::release_cursor() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+  if (!_internal_has_cursor()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.cursor_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void managerDump_Request::set_allocated_cursor(std::string* cursor) {
+  if (cursor != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.cursor_.SetAllocated(cursor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cursor_.IsDefault()) {
+    _impl_.cursor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.managerDump_Request.cursor)
+}
+
 // -------------------------------------------------------------------
 
 // managerDump_Response
@@ -4337,6 +6209,310 @@ managerDump_Response::entries() const {
   return _impl_.entries_;
 }
 
+// optional string next = 4;
+inline bool managerDump_Response::_internal_has_next() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool managerDump_Response::has_next() const {
+  return _internal_has_next();
+}
+inline void managerDump_Response::clear_next() {
+  _impl_.next_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& managerDump_Response::next() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerDump_Response.next)
+  return _internal_next();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void managerDump_Response::set_next(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.next_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerDump_Response.next)
+}
+inline std::string* managerDump_Response::mutable_next() {
+  std::string* _s = _internal_mutable_next();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.managerDump_Response.next)
+  return _s;
+}
+inline const std::string& managerDump_Response::_internal_next() const {
+  return _impl_.next_.Get();
+}
+inline void managerDump_Response::_internal_set_next(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.next_.Set(value, GetArenaForAllocation());
+}
+inline std::string* managerDump_Response::_internal_mutable_next() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.next_.Mutable(GetArenaForAllocation());
+}
+inline std::string* managerDump_Response::release_next() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.managerDump_Response.next)
+  if (!_internal_has_next()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.next_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_.IsDefault()) {
+    _impl_.next_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void managerDump_Response::set_allocated_next(std::string* next) {
+  if (next != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.next_.SetAllocated(next, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.next_.IsDefault()) {
+    _impl_.next_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.managerDump_Response.next)
+}
+
+// -------------------------------------------------------------------
+
+// managerStats_Request
+
+// -------------------------------------------------------------------
+
+// managerStats_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void managerStats_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus managerStats_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus managerStats_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.status)
+  return _internal_status();
+}
+inline void managerStats_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void managerStats_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.status)
+}
+
+// optional string error = 2;
+inline bool managerStats_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool managerStats_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void managerStats_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& managerStats_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void managerStats_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.error)
+}
+inline std::string* managerStats_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.kvdb.managerStats_Response.error)
+  return _s;
+}
+inline const std::string& managerStats_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void managerStats_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* managerStats_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* managerStats_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.kvdb.managerStats_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void managerStats_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.kvdb.managerStats_Response.error)
+}
+
+// optional uint64 block_cache_usage = 3;
+inline bool managerStats_Response::_internal_has_block_cache_usage() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool managerStats_Response::has_block_cache_usage() const {
+  return _internal_has_block_cache_usage();
+}
+inline void managerStats_Response::clear_block_cache_usage() {
+  _impl_.block_cache_usage_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t managerStats_Response::_internal_block_cache_usage() const {
+  return _impl_.block_cache_usage_;
+}
+inline uint64_t managerStats_Response::block_cache_usage() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_usage)
+  return _internal_block_cache_usage();
+}
+inline void managerStats_Response::_internal_set_block_cache_usage(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.block_cache_usage_ = value;
+}
+inline void managerStats_Response::set_block_cache_usage(uint64_t value) {
+  _internal_set_block_cache_usage(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_usage)
+}
+
+// optional uint64 block_cache_capacity = 4;
+inline bool managerStats_Response::_internal_has_block_cache_capacity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool managerStats_Response::has_block_cache_capacity() const {
+  return _internal_has_block_cache_capacity();
+}
+inline void managerStats_Response::clear_block_cache_capacity() {
+  _impl_.block_cache_capacity_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t managerStats_Response::_internal_block_cache_capacity() const {
+  return _impl_.block_cache_capacity_;
+}
+inline uint64_t managerStats_Response::block_cache_capacity() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_capacity)
+  return _internal_block_cache_capacity();
+}
+inline void managerStats_Response::_internal_set_block_cache_capacity(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.block_cache_capacity_ = value;
+}
+inline void managerStats_Response::set_block_cache_capacity(uint64_t value) {
+  _internal_set_block_cache_capacity(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_capacity)
+}
+
+// optional uint64 block_cache_hit = 5;
+inline bool managerStats_Response::_internal_has_block_cache_hit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool managerStats_Response::has_block_cache_hit() const {
+  return _internal_has_block_cache_hit();
+}
+inline void managerStats_Response::clear_block_cache_hit() {
+  _impl_.block_cache_hit_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t managerStats_Response::_internal_block_cache_hit() const {
+  return _impl_.block_cache_hit_;
+}
+inline uint64_t managerStats_Response::block_cache_hit() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_hit)
+  return _internal_block_cache_hit();
+}
+inline void managerStats_Response::_internal_set_block_cache_hit(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.block_cache_hit_ = value;
+}
+inline void managerStats_Response::set_block_cache_hit(uint64_t value) {
+  _internal_set_block_cache_hit(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_hit)
+}
+
+// optional uint64 block_cache_miss = 6;
+inline bool managerStats_Response::_internal_has_block_cache_miss() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool managerStats_Response::has_block_cache_miss() const {
+  return _internal_has_block_cache_miss();
+}
+inline void managerStats_Response::clear_block_cache_miss() {
+  _impl_.block_cache_miss_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t managerStats_Response::_internal_block_cache_miss() const {
+  return _impl_.block_cache_miss_;
+}
+inline uint64_t managerStats_Response::block_cache_miss() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_miss)
+  return _internal_block_cache_miss();
+}
+inline void managerStats_Response::_internal_set_block_cache_miss(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.block_cache_miss_ = value;
+}
+inline void managerStats_Response::set_block_cache_miss(uint64_t value) {
+  _internal_set_block_cache_miss(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_miss)
+}
+
+// optional double block_cache_hit_ratio = 7;
+inline bool managerStats_Response::_internal_has_block_cache_hit_ratio() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool managerStats_Response::has_block_cache_hit_ratio() const {
+  return _internal_has_block_cache_hit_ratio();
+}
+inline void managerStats_Response::clear_block_cache_hit_ratio() {
+  _impl_.block_cache_hit_ratio_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double managerStats_Response::_internal_block_cache_hit_ratio() const {
+  return _impl_.block_cache_hit_ratio_;
+}
+inline double managerStats_Response::block_cache_hit_ratio() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_hit_ratio)
+  return _internal_block_cache_hit_ratio();
+}
+inline void managerStats_Response::_internal_set_block_cache_hit_ratio(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.block_cache_hit_ratio_ = value;
+}
+inline void managerStats_Response::set_block_cache_hit_ratio(double value) {
+  _internal_set_block_cache_hit_ratio(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.kvdb.managerStats_Response.block_cache_hit_ratio)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -4364,6 +6540,18 @@ managerDump_Response::entries() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
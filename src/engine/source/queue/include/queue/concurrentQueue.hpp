@@ -1,6 +1,7 @@
 #ifndef _QUEUE_CONCURRENTQUEUE_HPP
 #define _QUEUE_CONCURRENTQUEUE_HPP
 
+#include <atomic>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
@@ -10,6 +11,7 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
 
 #include <concurrentqueue/blockingconcurrentqueue.h>
@@ -36,17 +38,51 @@ struct has_str_method<T, std::void_t<decltype(std::declval<T>()->str())>> : std:
 
 template<typename T>
 inline constexpr bool has_str_method_v = has_str_method<T>::value;
+
+/**
+ * @brief Priority lane of an element pushed into a ConcurrentQueue.
+ *
+ * Lanes shape how overload degrades: LOW elements are only admitted while the queue is
+ * below the low-lane watermark, so a storm of sheddable traffic leaves headroom for
+ * HIGH elements up to the full capacity instead of starving them.
+ */
+enum class Priority
+{
+    HIGH, ///< Admitted up to the full queue capacity
+    LOW   ///< Admitted only below the low-lane watermark, shed first under overload
+};
 /**
  * @brief Provides a wrapper for the flooding file
  *
+ * Messages are enqueued into an internal spill queue and written to disk by a
+ * dedicated writer thread, so producers flooding the main queue never block on
+ * file I/O. Pending messages are drained before the file is closed.
+ *
  * @warning this is thread safe for the write operation
  */
 class FloodingFile
 {
 private:
+    /// Timeout for the writer thread dequeue, also bounds the flush latency
+    static constexpr int64_t SPILL_DEQUEUE_TIMEOUT_USEC = 100000;
+
     std::ofstream m_file; ///< File stream for the flooding file
     std::string m_error;  ///< Error message if the file is not good
-    std::mutex m_mutex;   ///< Mutex for the write operation
+    moodycamel::BlockingConcurrentQueue<std::string> m_spillQueue; ///< Queue of messages pending to be written
+    std::atomic_bool m_running;                                    ///< Flag to stop the writer thread
+    std::thread m_writer;                                          ///< Writer thread draining the spill queue
+
+    /**
+     * @brief Drain every message currently in the spill queue to the file.
+     */
+    void drain()
+    {
+        std::string message;
+        while (m_spillQueue.try_dequeue(message))
+        {
+            m_file << message << '\n';
+        }
+    }
 
 public:
     /**
@@ -58,11 +94,45 @@ public:
     explicit FloodingFile(const std::string& path)
         : m_file(path, std::ios::out | std::ios::app | std::ios::ate)
         , m_error {}
-        , m_mutex {}
+        , m_spillQueue {}
+        , m_running {false}
     {
         if (!m_file.good())
         {
             m_error = strerror(errno);
+            return;
+        }
+
+        m_running = true;
+        m_writer = std::thread(
+            [this]()
+            {
+                std::string message;
+                while (m_running)
+                {
+                    if (m_spillQueue.wait_dequeue_timed(message, SPILL_DEQUEUE_TIMEOUT_USEC))
+                    {
+                        m_file << message << '\n';
+                        // Drain whatever accumulated while writing, then flush once
+                        drain();
+                        m_file.flush();
+                    }
+                }
+            });
+    }
+
+    ~FloodingFile()
+    {
+        if (m_running)
+        {
+            m_running = false;
+            if (m_writer.joinable())
+            {
+                m_writer.join();
+            }
+            // Messages enqueued between the last dequeue and the stop flag
+            drain();
+            m_file.flush();
         }
     }
 
@@ -85,18 +155,36 @@ public:
     }
 
     /**
-     * @brief Writes a message to the flooding file
+     * @brief Enqueues a message to be written to the flooding file
+     *
+     * The message is persisted asynchronously by the writer thread.
      *
      * @param message (const std::string&) Message to write
      *
-     * @return true if the write operation was successful, false otherwise
+     * @return true if the message was enqueued, false if the file is not open
      */
     bool write(const std::string& message)
     {
         if (m_file.is_open())
         {
-            std::lock_guard<std::mutex> lock {m_mutex};
-            m_file << message << std::endl;
+            m_spillQueue.enqueue(message);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Enqueues a message, moving it into the spill queue
+     *
+     * @param message Message to write, left in a moved-from state
+     *
+     * @return true if the message was enqueued, false if the file is not open
+     */
+    bool write(std::string&& message)
+    {
+        if (m_file.is_open())
+        {
+            m_spillQueue.enqueue(std::move(message));
             return true;
         }
         return false;
@@ -125,6 +213,8 @@ private:
         std::shared_ptr<metrics::IMetric> m_queued;             ///< Counter for the queued events
         std::shared_ptr<metrics::IMetric> m_flooded;            ///< Counter for the flooded events
         std::shared_ptr<metrics::IMetric> m_consumed;           ///< Counter for the consumed events
+        std::shared_ptr<metrics::IMetric> m_shedLow;            ///< Counter for low priority events shed at the lane
+        std::shared_ptr<metrics::IMetric> m_replayed;           ///< Counter for events replayed from the flood file
         std::shared_ptr<metrics::IMetric> m_consumendPerSecond; ///< Counter for the used queue
     };
 
@@ -138,14 +228,150 @@ private:
 
     Metrics m_metrics; ///< Metrics for the queue
 
+public:
+    /// Classifies an element into its priority lane at push time
+    using Classifier = std::function<Priority(const T&)>;
+
+    /// Decodes a flooded line back into an element during replay
+    using ReplayParser = std::function<T(std::string&&)>;
+
+private:
+    Classifier m_classifier {};         ///< Optional lane classifier, everything is HIGH without one
+    std::atomic<std::size_t> m_lowLaneCapacity {0}; ///< Watermark above which LOW elements are not admitted
+
+    std::string m_floodPath {};         ///< Path of the flooding file, kept for replay
+    ReplayParser m_replayParser {};     ///< Decoder for flooded lines
+    double m_replayFraction {0.0};      ///< Fraction of the spare capacity replayed per tick
+    int64_t m_replayTickUsec {0};       ///< Interval between replay rounds
+    std::atomic_bool m_replayRunning {false}; ///< Flag to stop the replay thread
+    std::thread m_replayThread;         ///< Background reader reinjecting flooded events
+
+    /// The replay marker next to the flooding file persists the byte offset of the
+    /// first line not yet reinjected, so a restart never replays an event twice.
+    std::string replayMarkerPath() const { return m_floodPath + ".replay"; }
+
+    uint64_t loadReplayOffset() const
+    {
+        uint64_t offset = 0;
+        std::ifstream marker {replayMarkerPath()};
+        if (!(marker >> offset))
+        {
+            return 0;
+        }
+
+        // A truncated or recreated flood file invalidates the marker
+        std::error_code ec;
+        const auto fileSize = std::filesystem::file_size(m_floodPath, ec);
+        if (ec || offset > fileSize)
+        {
+            return 0;
+        }
+        return offset;
+    }
+
+    void storeReplayOffset(uint64_t offset) const
+    {
+        std::ofstream marker {replayMarkerPath(), std::ios::out | std::ios::trunc};
+        marker << offset;
+    }
+
+    /**
+     * @brief Reinject flooded events while the queue has spare capacity.
+     *
+     * Every tick the reader takes at most a configured fraction of the approximate
+     * free slots, so replay rides on the spare capacity and backs off by itself while
+     * live traffic fills the queue. Lines are admitted with tryPush, which cannot
+     * flood, so a replayed event can never loop back into the file. The trailing line
+     * is skipped while it has no newline yet (the writer may still be appending it),
+     * and the consumed offset is persisted after every round.
+     */
+    void replayLoop()
+    {
+        auto offset = loadReplayOffset();
+        while (m_replayRunning)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(m_replayTickUsec));
+
+            std::error_code ec;
+            const auto fileSize = std::filesystem::file_size(m_floodPath, ec);
+            if (ec || fileSize <= offset)
+            {
+                continue; // Caught up, nothing flooded since the last round
+            }
+
+            const auto budget = static_cast<std::size_t>(static_cast<double>(aproxFreeSlots()) * m_replayFraction);
+            if (budget == 0)
+            {
+                continue; // The queue is under pressure, let live traffic through
+            }
+
+            std::ifstream file {m_floodPath};
+            if (!file)
+            {
+                continue;
+            }
+            file.seekg(static_cast<std::streamoff>(offset));
+
+            std::string line;
+            std::size_t replayed = 0;
+            while (replayed < budget && m_replayRunning && std::getline(file, line))
+            {
+                if (file.eof())
+                {
+                    // Unterminated trailing line, the writer is still appending it
+                    break;
+                }
+
+                T element {};
+                try
+                {
+                    element = m_replayParser(std::move(line));
+                }
+                catch (const std::exception& e)
+                {
+                    // An undecodable line is consumed, stalling on it would wedge the replay
+                    offset = static_cast<uint64_t>(file.tellg());
+                    LOG_WARNING("Flood replay discarded an undecodable line: {}", e.what());
+                    continue;
+                }
+
+                if (!tryPush(element))
+                {
+                    break; // The queue filled up mid-round, the line stays pending
+                }
+                offset = static_cast<uint64_t>(file.tellg());
+                ++replayed;
+            }
+
+            if (replayed > 0)
+            {
+                m_metrics.m_replayed->update(static_cast<uint64_t>(replayed));
+                storeReplayOffset(offset);
+            }
+        }
+        storeReplayOffset(offset);
+    }
+
+    /**
+     * @brief True when the lane of the given priority has no room for another element.
+     *
+     * HIGH is only bounded by the physical capacity, enforced by try_enqueue itself.
+     */
+    bool laneFull(Priority priority) const
+    {
+        return priority == Priority::LOW && m_queue.size_approx() >= m_lowLaneCapacity.load(std::memory_order_relaxed);
+    }
+
     template<typename U = T>
     std::enable_if_t<has_str_method_v<U>, void> pushWithStr(U&& element)
     {
+        const auto priority = m_classifier ? m_classifier(element) : Priority::HIGH;
+
         if (m_discard)
         {
             for (std::size_t attempts {0}; attempts < m_maxAttempts; ++attempts)
             {
-                if (m_queue.try_enqueue(std::move(element)))
+                if (!laneFull(priority) && m_queue.try_enqueue(std::move(element)))
                 {
                     m_metrics.m_queued->update(1UL);
                     m_metrics.m_used->update(1L);
@@ -154,12 +380,19 @@ private:
                 std::this_thread::sleep_for(std::chrono::microseconds(500));
             }
             m_metrics.m_flooded->update(1UL);
+            if (priority == Priority::LOW)
+            {
+                m_metrics.m_shedLow->update(1UL);
+            }
             return;
         }
 
         if (!m_floodingFile)
         {
-            while (!m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
+            // Lossless configuration: a LOW element blocks at its watermark instead of
+            // being shed, leaving the remaining capacity to HIGH traffic.
+            while (laneFull(priority)
+                   || !m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
             {
                 // Right now we process 1 event for ~0.1ms, we sleep by a factor
                 // of 5 because we are saturating the queue and we don't want to.
@@ -172,7 +405,8 @@ private:
         {
             for (std::size_t attempts {0}; attempts < m_maxAttempts; ++attempts)
             {
-                if (m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
+                if (!laneFull(priority)
+                    && m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
                 {
                     m_metrics.m_queued->update(1UL);
                     m_metrics.m_used->update(1L);
@@ -186,6 +420,10 @@ private:
             }
 
             m_metrics.m_flooded->update(1UL);
+            if (priority == Priority::LOW)
+            {
+                m_metrics.m_shedLow->update(1UL);
+            }
         }
     }
 
@@ -252,6 +490,7 @@ public:
             }
             else
             {
+                m_floodPath = pathFloodedFile;
                 LOG_INFO("The queue will be flooded in the file: {}", pathFloodedFile);
             }
         }
@@ -277,12 +516,185 @@ public:
                                                               metricModuleName + ".FloodedEvents",
                                                               "Number of flooded events from the queue",
                                                               "events");
+        m_metrics.m_shedLow = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                              metricModuleName + ".ShedLowPriorityEvents",
+                                                              "Number of low priority events shed under backpressure",
+                                                              "events");
+        m_metrics.m_replayed = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                               metricModuleName + ".ReplayedEvents",
+                                                               "Number of events reinjected from the flooding file",
+                                                               "events");
         // TODO: Add rate metric once implemented
         // m_metrics.m_metricsScopeDelta = std::move(metricsScopeDelta);
         // m_metrics.m_consumendPerSecond =
         // m_metrics.m_metricsScopeDelta->getCounterUInteger("ConsumedEventsPerSecond");
     }
 
+    ~ConcurrentQueue() override { stopFloodReplay(); }
+
+    /// Default interval between replay rounds
+    static constexpr int64_t REPLAY_TICK_USEC = 100000;
+    /// Default fraction of the spare capacity replayed per round
+    static constexpr double REPLAY_SPARE_FRACTION = 0.25;
+
+    /**
+     * @brief Start reinjecting flooded events from the flooding file in the background.
+     *
+     * Turns overflow handling into an automatic catch-up: while the queue has spare
+     * capacity, a background reader decodes flooded lines and pushes them back at a
+     * bounded fraction of the free slots per tick. The consumed byte offset is
+     * persisted next to the flood file ('<path>.replay'), so events are not replayed
+     * twice across restarts.
+     *
+     * @param parser Decoder from a flooded line to an element, must not be null.
+     * @param spareFraction Fraction of the approximate free slots replayed per tick, in (0, 1].
+     * @param tickUsec Interval between replay rounds, in microseconds.
+     * @throw std::runtime_error without a flooding file, with a null parser, an out of
+     * range fraction, or when the replay is already running.
+     */
+    void enableFloodReplay(ReplayParser parser,
+                           const double spareFraction = REPLAY_SPARE_FRACTION,
+                           const int64_t tickUsec = REPLAY_TICK_USEC)
+    {
+        if (!m_floodingFile)
+        {
+            throw std::runtime_error("Flood replay requires a flooding file");
+        }
+
+        if (!parser)
+        {
+            throw std::runtime_error("The flood replay parser cannot be null");
+        }
+
+        if (spareFraction <= 0.0 || spareFraction > 1.0)
+        {
+            throw std::runtime_error("The flood replay spare fraction must be in (0, 1]");
+        }
+
+        if (tickUsec <= 0)
+        {
+            throw std::runtime_error("The flood replay tick must be greater than 0");
+        }
+
+        if (m_replayRunning)
+        {
+            throw std::runtime_error("The flood replay is already running");
+        }
+
+        m_replayParser = std::move(parser);
+        m_replayFraction = spareFraction;
+        m_replayTickUsec = tickUsec;
+        m_replayRunning = true;
+        m_replayThread = std::thread([this]() { replayLoop(); });
+        LOG_INFO("Flood replay enabled for the file: {}", m_floodPath);
+    }
+
+    /**
+     * @brief Stop the flood replay thread, persisting the consumed offset.
+     */
+    void stopFloodReplay()
+    {
+        if (m_replayRunning)
+        {
+            m_replayRunning = false;
+            if (m_replayThread.joinable())
+            {
+                m_replayThread.join();
+            }
+        }
+    }
+
+    /**
+     * @brief Drain every queued element into the flooding file.
+     *
+     * Shutdown helper: once the consumers are stopped, the remaining backlog is
+     * moved to the flood file instead of being processed, so the process can exit
+     * within its deadline without losing events. With flood replay enabled the
+     * flushed events are reinjected automatically on the next start.
+     *
+     * @return std::size_t The number of elements flushed.
+     * @throw std::runtime_error without a flooding file.
+     */
+    std::size_t flushToFlood()
+    {
+        if constexpr (has_str_method_v<T>)
+        {
+            if (!m_floodingFile)
+            {
+                throw std::runtime_error("Flushing the queue requires a flooding file");
+            }
+
+            std::size_t flushed = 0;
+            T element {};
+            while (m_queue.try_dequeue(element))
+            {
+                if (element != nullptr)
+                {
+                    m_floodingFile->write(element->str());
+                }
+                ++flushed;
+            }
+
+            if (flushed > 0)
+            {
+                m_metrics.m_flooded->update(static_cast<uint64_t>(flushed));
+                m_metrics.m_used->update(-static_cast<int64_t>(flushed));
+            }
+            return flushed;
+        }
+        else
+        {
+            throw std::logic_error("The type T must have a ->str() method");
+        }
+    }
+
+    /**
+     * @brief Enable priority lanes, classifying every element at push time.
+     *
+     * LOW elements are only admitted while the queue holds fewer than lowLaneCapacity
+     * elements; above that watermark they are shed (discarded or flooded to file per
+     * the queue configuration, or blocked in the lossless configuration), keeping the
+     * remaining capacity for HIGH traffic.
+     *
+     * @param classifier Returns the lane of an element, must not be null.
+     * @param lowLaneCapacity Watermark for the LOW lane, in (0, capacity].
+     * @throw std::runtime_error on a null classifier or an out of range watermark.
+     */
+    void setPriorityClassifier(Classifier classifier, const std::size_t lowLaneCapacity)
+    {
+        if (!classifier)
+        {
+            throw std::runtime_error("The priority classifier cannot be null");
+        }
+
+        if (lowLaneCapacity == 0 || lowLaneCapacity > m_minCapacity)
+        {
+            throw std::runtime_error("The low lane capacity must be in (0, capacity]");
+        }
+
+        m_classifier = std::move(classifier);
+        m_lowLaneCapacity.store(lowLaneCapacity, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adjust the LOW lane watermark at runtime, without touching the classifier.
+     *
+     * Used by the overload governor to tighten the lane under sustained pressure and
+     * restore it afterwards; producers observe the new watermark on their next push.
+     *
+     * @param lowLaneCapacity Watermark for the LOW lane, in (0, capacity].
+     * @throw std::runtime_error on an out of range watermark.
+     */
+    void setLowLaneCapacity(const std::size_t lowLaneCapacity)
+    {
+        if (lowLaneCapacity == 0 || lowLaneCapacity > m_minCapacity)
+        {
+            throw std::runtime_error("The low lane capacity must be in (0, capacity]");
+        }
+
+        m_lowLaneCapacity.store(lowLaneCapacity, std::memory_order_relaxed);
+    }
+
     void push(T&& element) override
     {
         if constexpr (has_str_method_v<T>)
@@ -313,6 +725,11 @@ public:
      */
     bool tryPush(const T& element) override
     {
+        if (m_classifier && laneFull(m_classifier(element)))
+        {
+            return false;
+        }
+
         auto result = m_queue.try_enqueue(element);
         if (result)
         {
@@ -347,6 +764,28 @@ public:
         return result;
     }
 
+    /**
+     * @brief Pops up to maxElements elements from the queue in a single bulk operation.
+     *
+     * @param elements Buffer where the popped elements are appended.
+     * @param maxElements Maximum number of elements to pop.
+     * @param timeout The timeout in microseconds, applied while waiting for the first element.
+     * @return size_t The number of elements popped (0 if the timeout was reached).
+     */
+    size_t waitPopBulk(std::vector<T>& elements, size_t maxElements, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        const auto offset = elements.size();
+        elements.resize(offset + maxElements);
+        const auto popped = m_queue.wait_dequeue_bulk_timed(elements.begin() + offset, maxElements, timeout);
+        elements.resize(offset + popped);
+        if (popped > 0)
+        {
+            m_metrics.m_consumed->update(static_cast<uint64_t>(popped));
+            m_metrics.m_used->update(-static_cast<int64_t>(popped));
+        }
+        return popped;
+    }
+
     bool tryPop(T& element) override
     {
         auto result = m_queue.try_dequeue(element);
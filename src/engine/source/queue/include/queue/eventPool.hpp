@@ -0,0 +1,173 @@
+#ifndef _QUEUE_EVENTPOOL_HPP
+#define _QUEUE_EVENTPOOL_HPP
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <concurrentqueue/concurrentqueue.h>
+#include <metrics/imanager.hpp>
+
+#include <base/baseTypes.hpp>
+
+namespace base::queue
+{
+
+/**
+ * @brief Recycling pool for event documents.
+ *
+ * Steady-state ingest allocates one json document with its value arena per event and
+ * destroys it once the event has been processed, a constant churn of alloc/free pairs.
+ * The pool keeps released documents on a lock-free freelist, each with its recyclable
+ * arena, so parsing a new event reuses the slab of an acked one instead of going back
+ * to the heap. Documents are handed out as base::Event whose deleter returns them to
+ * the pool from whichever worker drops the last reference, so the return trip is as
+ * concurrent as the processing queues the events travel through.
+ *
+ * The pool must be owned by a std::shared_ptr; events outliving the pool fall back to
+ * plain deletion. Occupancy and traffic are published through the metrics manager
+ * under the given module name.
+ */
+class EventPool : public std::enable_shared_from_this<EventPool>
+{
+private:
+    struct Metrics
+    {
+        std::shared_ptr<metrics::IMetric> m_pooled;    ///< Gauge of documents held by the freelist
+        std::shared_ptr<metrics::IMetric> m_recycled;  ///< Counter of events served from the freelist
+        std::shared_ptr<metrics::IMetric> m_allocated; ///< Counter of events allocated on freelist miss
+    };
+
+    moodycamel::ConcurrentQueue<json::Json*> m_free; ///< Freelist of recycled documents
+    std::size_t m_maxPooled;                         ///< Bound on the freelist size
+    std::atomic<std::size_t> m_pooled {0};           ///< Approximate freelist occupancy
+
+    Metrics m_metrics; ///< Metrics for the pool
+
+    /**
+     * @brief Return a document to the freelist, or delete it when the pool is full.
+     */
+    void release(json::Json* doc)
+    {
+        if (m_pooled.fetch_add(1, std::memory_order_relaxed) < m_maxPooled)
+        {
+            m_free.enqueue(doc);
+            m_metrics.m_pooled->update(1L);
+        }
+        else
+        {
+            m_pooled.fetch_sub(1, std::memory_order_relaxed);
+            delete doc;
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new Event Pool object
+     *
+     * @param maxPooled Maximum number of idle documents kept for reuse; usually the
+     * event queue capacity, so a full pipeline can turn over without heap traffic.
+     * @param metricModuleName The name of the module for the metrics.
+     *
+     * @throw std::runtime_error if maxPooled is 0
+     */
+    explicit EventPool(const std::size_t maxPooled, const std::string& metricModuleName)
+        : m_maxPooled {maxPooled}
+    {
+        if (maxPooled == 0)
+        {
+            throw std::runtime_error("The maximum pool size must be greater than 0");
+        }
+
+        m_metrics.m_pooled = metrics::getManager().addMetric(metrics::MetricType::INTUPDOWNCOUNTER,
+                                                             metricModuleName + ".PooledEvents",
+                                                             "Number of recycled event documents held by the pool",
+                                                             "events");
+        m_metrics.m_recycled = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                               metricModuleName + ".RecycledEvents",
+                                                               "Number of events served from the pool",
+                                                               "events");
+        m_metrics.m_allocated = metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER,
+                                                                metricModuleName + ".AllocatedEvents",
+                                                                "Number of events allocated with the pool empty",
+                                                                "events");
+    }
+
+    EventPool(const EventPool&) = delete;
+    EventPool& operator=(const EventPool&) = delete;
+
+    ~EventPool()
+    {
+        json::Json* doc {nullptr};
+        while (m_free.try_dequeue(doc))
+        {
+            delete doc;
+        }
+    }
+
+    /**
+     * @brief Parse an event, reusing a pooled document when one is available.
+     *
+     * @param event The raw event to parse, borrowed only for the duration of the call.
+     * @return base::Event whose deleter hands the document back to the pool.
+     * @throw std::runtime_error if the event is not valid json (the document goes back
+     * to the freelist).
+     */
+    base::Event acquire(std::string_view event)
+    {
+        json::Json* doc {nullptr};
+        if (m_free.try_dequeue(doc))
+        {
+            m_pooled.fetch_sub(1, std::memory_order_relaxed);
+            m_metrics.m_pooled->update(-1L);
+            try
+            {
+                doc->reparse(event);
+            }
+            catch (...)
+            {
+                release(doc);
+                throw;
+            }
+            m_metrics.m_recycled->update(1UL);
+        }
+        else
+        {
+            doc = new json::Json {"null", std::make_shared<json::Arena>()};
+            try
+            {
+                doc->reparse(event);
+            }
+            catch (...)
+            {
+                release(doc);
+                throw;
+            }
+            m_metrics.m_allocated->update(1UL);
+        }
+
+        return base::Event {doc,
+                            [pool = weak_from_this()](json::Json* released)
+                            {
+                                if (auto self = pool.lock())
+                                {
+                                    self->release(released);
+                                }
+                                else
+                                {
+                                    delete released;
+                                }
+                            }};
+    }
+
+    /**
+     * @brief Approximate number of idle documents currently held by the pool.
+     */
+    std::size_t size() const { return m_pooled.load(std::memory_order_relaxed); }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_EVENTPOOL_HPP
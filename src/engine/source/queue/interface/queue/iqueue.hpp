@@ -1,6 +1,10 @@
 #ifndef _QUEUE_IQUEUE_HPP
 #define _QUEUE_IQUEUE_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace base::queue
 {
 
@@ -44,6 +48,19 @@ public:
      */
     virtual bool waitPop(T& element, int64_t timeout = 0) = 0;
 
+    /**
+     * @brief Wait for and pop up to maxElements elements from the queue in one call.
+     *
+     * Consumers processing batches amortize the queue synchronization cost over
+     * every element of the batch instead of paying it per event.
+     *
+     * @param elements Buffer where the popped elements are appended.
+     * @param maxElements Maximum number of elements to pop.
+     * @param timeout The maximum time to wait for the first element (in microseconds).
+     * @return The number of elements popped (0 if the timeout was reached).
+     */
+    virtual size_t waitPopBulk(std::vector<T>& elements, size_t maxElements, int64_t timeout = 0) = 0;
+
     /**
      * @brief Try to pop an element from the queue.
      *
@@ -15,6 +15,7 @@ public:
     MOCK_METHOD(void, push, (T && element), (override));
     MOCK_METHOD(bool, tryPush, (const T& element), (override));
     MOCK_METHOD(bool, waitPop, (T & element, int64_t timeout), (override));
+    MOCK_METHOD(size_t, waitPopBulk, (std::vector<T> & elements, size_t maxElements, int64_t timeout), (override));
     MOCK_METHOD(bool, tryPop, (T & element), (override));
     MOCK_METHOD(bool, empty, (), (const, override));
     MOCK_METHOD(size_t, size, (), (const, override));
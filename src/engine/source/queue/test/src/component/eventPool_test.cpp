@@ -0,0 +1,89 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <queue/eventPool.hpp>
+
+#include <base/mockSingletonManager.hpp>
+#include <metrics/noOpManager.hpp>
+
+using namespace base::queue;
+
+class EventPoolTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { logging::testInit(); }
+
+    static void SetUpTestSuite()
+    {
+        static metrics::mocks::NoOpManager mockManager;
+        SingletonLocator::registerManager<metrics::IManager, base::test::MockSingletonManager<metrics::IManager>>();
+        auto& mockStrategy = dynamic_cast<base::test::MockSingletonManager<metrics::IManager>&>(
+            SingletonLocator::manager<metrics::IManager>());
+        ON_CALL(mockStrategy, instance()).WillByDefault(testing::ReturnRef(mockManager));
+        EXPECT_CALL(mockStrategy, instance()).Times(testing::AnyNumber());
+    }
+
+    static void TearDownTestSuite() { SingletonLocator::unregisterManager<metrics::IManager>(); }
+};
+
+TEST_F(EventPoolTest, RejectsZeroCapacity)
+{
+    ASSERT_THROW(EventPool(0, "testEventPool"), std::runtime_error);
+}
+
+TEST_F(EventPoolTest, ReleasedDocumentIsReused)
+{
+    auto pool = std::make_shared<EventPool>(8, "testEventPool");
+
+    auto event = pool->acquire(R"({"a":1})");
+    ASSERT_EQ(event->getInt("/a").value_or(0), 1);
+
+    const auto* rawDoc = event.get();
+    event.reset();
+    ASSERT_EQ(pool->size(), 1);
+
+    auto recycled = pool->acquire(R"({"b":2})");
+    ASSERT_EQ(recycled.get(), rawDoc);
+    ASSERT_EQ(recycled->getInt("/b").value_or(0), 2);
+    ASSERT_FALSE(recycled->exists("/a"));
+    ASSERT_EQ(pool->size(), 0);
+}
+
+TEST_F(EventPoolTest, InvalidEventKeepsTheDocument)
+{
+    auto pool = std::make_shared<EventPool>(8, "testEventPool");
+
+    ASSERT_THROW(pool->acquire("{not json"), std::runtime_error);
+    ASSERT_EQ(pool->size(), 1);
+
+    // The kept document serves the next valid event
+    auto event = pool->acquire(R"({"ok":true})");
+    ASSERT_TRUE(event->getBool("/ok").value_or(false));
+    ASSERT_EQ(pool->size(), 0);
+}
+
+TEST_F(EventPoolTest, FreelistIsBounded)
+{
+    auto pool = std::make_shared<EventPool>(2, "testEventPool");
+
+    std::vector<base::Event> events;
+    for (auto i = 0; i < 4; ++i)
+    {
+        events.emplace_back(pool->acquire(R"({"i":0})"));
+    }
+    events.clear();
+
+    ASSERT_EQ(pool->size(), 2);
+}
+
+TEST_F(EventPoolTest, EventOutlivingThePool)
+{
+    auto pool = std::make_shared<EventPool>(8, "testEventPool");
+    auto event = pool->acquire(R"({"a":1})");
+    pool.reset();
+
+    // The deleter falls back to plain deletion once the pool is gone
+    ASSERT_EQ(event->getInt("/a").value_or(0), 1);
+    event.reset();
+}
@@ -102,20 +102,54 @@ TEST_F(ConcurrentQueueTest, CanPushAndPop)
     ASSERT_EQ(cq.size(), 0);
 }
 
-TEST_F(ConcurrentQueueTest, FloodsWhenFull)
+TEST_F(ConcurrentQueueTest, CanPopBulk)
 {
-    std::string flood_file = "floodfile.txt";
-    // 32 is the size of one block in the queue, for 1 producer and 1 consumer thread
-    // the queue has 1 block, so it will flood after 32 pushes
-    ConcurrentQueue<std::shared_ptr<Dummy>> cq(32, m_metricModuleName, flood_file, 3, 500);
-
-    for (int i = 0; i < 35; i++)
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(64, m_metricModuleName);
+    for (int i = 0; i < 10; i++)
     {
         cq.push(std::make_shared<Dummy>(i));
     }
 
-    ASSERT_FALSE(cq.empty());
-    ASSERT_EQ(cq.size(), 32);
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(cq.waitPopBulk(batch, 4), 4);
+    ASSERT_EQ(batch.size(), 4);
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_EQ(batch[i]->value, i);
+    }
+
+    // Appends to the buffer and pops at most the remaining elements
+    ASSERT_EQ(cq.waitPopBulk(batch, 64), 6);
+    ASSERT_EQ(batch.size(), 10);
+    ASSERT_TRUE(cq.empty());
+}
+
+TEST_F(ConcurrentQueueTest, PopBulkTimeout)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(2, m_metricModuleName);
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(cq.waitPopBulk(batch, 8, 0), 0);
+    ASSERT_TRUE(batch.empty());
+}
+
+TEST_F(ConcurrentQueueTest, FloodsWhenFull)
+{
+    std::string flood_file = "floodfile.txt";
+    {
+        // 32 is the size of one block in the queue, for 1 producer and 1 consumer thread
+        // the queue has 1 block, so it will flood after 32 pushes
+        ConcurrentQueue<std::shared_ptr<Dummy>> cq(32, m_metricModuleName, flood_file, 3, 500);
+
+        for (int i = 0; i < 35; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+
+        ASSERT_FALSE(cq.empty());
+        ASSERT_EQ(cq.size(), 32);
+        // Flood writes are asynchronous; destroying the queue drains the spill
+        // queue and flushes the file
+    }
 
     std::ifstream floodfile(flood_file);
     int num_flooded = 0;
@@ -130,6 +164,87 @@ TEST_F(ConcurrentQueueTest, FloodsWhenFull)
     std::filesystem::remove(flood_file);
 }
 
+TEST_F(ConcurrentQueueTest, ReplaysFloodedEvents)
+{
+    std::string flood_file = "floodreplayfile.txt";
+    std::filesystem::remove(flood_file);
+    std::filesystem::remove(flood_file + ".replay");
+    {
+        ConcurrentQueue<std::shared_ptr<Dummy>> cq(32, m_metricModuleName, flood_file, 3, 500);
+
+        // The queue holds 32 elements, the remaining 8 are flooded to the file
+        for (int i = 0; i < 40; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+
+        // Drain the queue so the replay has spare capacity to ride on
+        std::shared_ptr<Dummy> element;
+        while (cq.tryPop(element)) {}
+        ASSERT_TRUE(cq.empty());
+
+        cq.enableFloodReplay([](std::string&& line)
+                             { return std::make_shared<Dummy>(std::stoi(line.substr(line.find(':') + 1))); },
+                             1.0,
+                             1000);
+
+        // The flood writes are asynchronous and the replay runs on its own tick
+        for (int waited = 0; cq.size() < 8 && waited < 5000; waited += 10)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(cq.size(), 8);
+        cq.stopFloodReplay();
+
+        // The marker persists the consumed offset so a restart does not replay twice
+        std::ifstream marker(flood_file + ".replay");
+        uint64_t offset = 0;
+        ASSERT_TRUE(marker >> offset);
+        ASSERT_GT(offset, 0);
+    }
+    std::filesystem::remove(flood_file);
+    std::filesystem::remove(flood_file + ".replay");
+}
+
+TEST_F(ConcurrentQueueTest, FlushToFlood)
+{
+    std::string flood_file = "floodflushfile.txt";
+    std::filesystem::remove(flood_file);
+    {
+        ConcurrentQueue<std::shared_ptr<Dummy>> cq(32, m_metricModuleName, flood_file, 3, 500);
+
+        for (int i = 0; i < 10; i++)
+        {
+            cq.push(std::make_shared<Dummy>(i));
+        }
+        ASSERT_EQ(cq.size(), 10);
+
+        // The whole backlog is moved to the flood file and the queue is left empty
+        ASSERT_EQ(cq.flushToFlood(), 10);
+        ASSERT_TRUE(cq.empty());
+        ASSERT_EQ(cq.flushToFlood(), 0);
+        // Flood writes are asynchronous; destroying the queue flushes the file
+    }
+
+    std::ifstream floodfile(flood_file);
+    int num_flushed = 0;
+    std::string line;
+    while (std::getline(floodfile, line))
+    {
+        num_flushed++;
+    }
+
+    ASSERT_EQ(num_flushed, 10);
+    floodfile.close();
+    std::filesystem::remove(flood_file);
+}
+
+TEST_F(ConcurrentQueueTest, FlushToFloodRequiresFloodFile)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(2, m_metricModuleName);
+    ASSERT_THROW(cq.flushToFlood(), std::runtime_error);
+}
+
 TEST_F(ConcurrentQueueTest, Timeout)
 {
     ConcurrentQueue<std::shared_ptr<Dummy>> cq(2, m_metricModuleName);
@@ -137,3 +252,48 @@ TEST_F(ConcurrentQueueTest, Timeout)
     ASSERT_FALSE(cq.waitPop(d, 0));
     ASSERT_EQ(d->value, 0);
 }
+
+TEST_F(ConcurrentQueueTest, PriorityClassifierValidation)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(8, m_metricModuleName);
+    const auto classifier = [](const std::shared_ptr<Dummy>&)
+    {
+        return Priority::HIGH;
+    };
+
+    ASSERT_THROW(cq.setPriorityClassifier(nullptr, 4), std::runtime_error);
+    ASSERT_THROW(cq.setPriorityClassifier(classifier, 0), std::runtime_error);
+    ASSERT_THROW(cq.setPriorityClassifier(classifier, 9), std::runtime_error);
+    ASSERT_NO_THROW(cq.setPriorityClassifier(classifier, 8));
+}
+
+TEST_F(ConcurrentQueueTest, PriorityLanesShedLowFirst)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(8, m_metricModuleName);
+    // Negative values are sheddable, the rest is security-relevant
+    cq.setPriorityClassifier([](const std::shared_ptr<Dummy>& d)
+                             { return d->value < 0 ? Priority::LOW : Priority::HIGH; },
+                             4);
+
+    // The low lane only admits up to its watermark
+    for (auto i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(cq.tryPush(std::make_shared<Dummy>(-1)));
+    }
+    ASSERT_FALSE(cq.tryPush(std::make_shared<Dummy>(-1)));
+
+    // High traffic keeps the remaining capacity
+    for (auto i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(cq.tryPush(std::make_shared<Dummy>(1)));
+    }
+    ASSERT_EQ(cq.size(), 8);
+
+    // Draining below the watermark readmits low traffic
+    std::shared_ptr<Dummy> element;
+    for (auto i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(cq.tryPop(element));
+    }
+    ASSERT_TRUE(cq.tryPush(std::make_shared<Dummy>(-1)));
+}
@@ -1,9 +1,13 @@
 #ifndef _RBAC_RBAC_HPP
 #define _RBAC_RBAC_HPP
 
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <fmt/format.h>
 
@@ -35,6 +39,11 @@ private:
 
     std::weak_ptr<store::IStoreInternal> m_store;
 
+    /// Role names holding each permission, compiled from the model. The sets are shared with
+    /// the emitted AuthFns, so recompiling the model replaces them instead of mutating them.
+    std::unordered_map<Permission, std::shared_ptr<const std::unordered_set<std::string>>> m_authorized;
+    uint64_t m_modelVersion {0}; ///< Bumped on every model compilation.
+
     base::OptError loadModel()
     {
         const auto store = m_store.lock();
@@ -112,6 +121,33 @@ private:
         m_roles[defaultModel::ROLE_SYSTEM] = Role(defaultModel::ROLE_SYSTEM, permissions);
     }
 
+    /**
+     * @brief Compile the authorization table from the current roles.
+     *
+     * Must be called after every change to the model, so the permission checks stay a single
+     * hash lookup over the compiled table.
+     */
+    void compileModel()
+    {
+        std::unordered_map<Permission, std::unordered_set<std::string>> authorized;
+        for (const auto& [roleName, role] : m_roles)
+        {
+            for (const auto& permission : role.getPermissions())
+            {
+                authorized[permission].insert(roleName);
+            }
+        }
+
+        m_authorized.clear();
+        for (auto& [permission, roles] : authorized)
+        {
+            m_authorized.emplace(permission,
+                                 std::make_shared<const std::unordered_set<std::string>>(std::move(roles)));
+        }
+
+        ++m_modelVersion;
+    }
+
 public:
     RBAC(std::weak_ptr<store::IStoreInternal> store)
         : m_store(store)
@@ -128,29 +164,31 @@ public:
                 LOG_WARNING("Could not save RBAC model: {}", saveError->message);
             }
         }
+
+        compileModel();
     }
 
     AuthFn getAuthFn(Resource res, Operation op) const override
     {
-        auto permission = Permission(res, op);
+        static const auto noRoles = std::make_shared<const std::unordered_set<std::string>>();
 
-        return [permission, roles = m_roles](const std::string& roleName)
-        {
-            auto role = roles.find(roleName);
-            if (role == roles.end())
-            {
-                return false;
-            }
+        const auto it = m_authorized.find(Permission(res, op));
+        const auto authorizedRoles = (it != m_authorized.end()) ? it->second : noRoles;
 
-            if (role->second.getPermissions().find(permission) == role->second.getPermissions().end())
-            {
-                return false;
-            }
-
-            return true;
+        // The compiled set is shared, not copied, so the check is a single hash lookup
+        return [authorizedRoles](const std::string& roleName)
+        {
+            return authorizedRoles->find(roleName) != authorizedRoles->end();
         };
     }
 
+    /**
+     * @brief Get the version of the compiled model, bumped on every compilation.
+     *
+     * @return uint64_t
+     */
+    uint64_t modelVersion() const { return m_modelVersion; }
+
     void shutdown() noexcept
     {
         try
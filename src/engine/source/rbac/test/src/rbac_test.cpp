@@ -112,6 +112,24 @@ TEST_F(RBACTest, InitSaveError)
     ASSERT_NO_THROW(rbac = std::make_shared<RBAC>(mockStore));
 }
 
+TEST_F(RBACTest, CompiledAuthFn)
+{
+    EXPECT_CALL(*mockStore, readInternalDoc(testing::Eq(base::Name {detail::MODEL_NAME})))
+        .WillOnce(::testing::Return(storeReadDocResp(MODEL_JSON)));
+
+    std::shared_ptr<RBAC> rbac;
+    ASSERT_NO_THROW(rbac = std::make_shared<RBAC>(mockStore));
+    ASSERT_EQ(rbac->modelVersion(), 1);
+
+    RBAC::AuthFn authFn;
+    ASSERT_NO_THROW(authFn = rbac->getAuthFn(OK_RESOURCE, OK_OPERATION));
+
+    // The AuthFn shares the compiled permission set and stays valid on its own
+    rbac.reset();
+    EXPECT_TRUE(authFn(OK_ROLE));
+    EXPECT_FALSE(authFn(BAD_ROLE));
+}
+
 TEST_F(RBACTest, Shutdown)
 {
     EXPECT_CALL(*mockStore, readInternalDoc(testing::Eq(base::Name {detail::MODEL_NAME})))
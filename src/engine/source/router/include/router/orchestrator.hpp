@@ -1,12 +1,23 @@
 #ifndef _ROUTER_ORCHESTATOR_HPP
 #define _ROUTER_ORCHESTATOR_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
+#include <metrics/imanager.hpp>
 #include <queue/iqueue.hpp>
 #include <store/istore.hpp>
 
@@ -19,6 +30,9 @@ namespace router
 using ProdQueueType = base::queue::iQueue<base::Event>;
 using TestQueueType = base::queue::iQueue<test::QueueType>;
 
+/// Minimum depth of a sticky lane before the dispatcher considers diverting from it
+constexpr std::size_t STICKY_REBALANCE_MIN_DEPTH = 4096;
+
 // Forward declarations
 class IWorker;
 class EnvironmentBuilder;
@@ -34,12 +48,19 @@ protected:
     class EpsCounter;                         ///< PIMPL for the EPS counter
     std::shared_ptr<EpsCounter> m_epsCounter; ///< Counter to measure the events per second processed by the router
 
+    class OverloadGovernor;                       ///< PIMPL for the overload governor
+    std::shared_ptr<OverloadGovernor> m_governor; ///< Coordinates shedding and admission under overload
+
     constexpr static const char* STORE_PATH_TESTER_TABLE = "router/tester/0"; ///< Default path for the tester state
     constexpr static const char* STORE_PATH_ROUTER_TABLE = "router/router/0"; ///< Default path for the router state
     constexpr static const char* STORE_PATH_ROUTER_EPS = "router/eps/0";      ///< Default path for the EPS state
+    constexpr static const char* STORE_PATH_SNAPSHOT = "router/snapshot/0";   ///< Default path for the warm snapshot
 
     // Workers synchronization
     std::list<std::shared_ptr<IWorker>> m_workers; ///< List of workers
+    bool m_pinWorkers {false}; ///< Pin worker threads to CPU cores when starting
+    std::atomic<uint64_t> m_ingressCounter {0}; ///< Events posted, used to pick the sampled ones
+    std::atomic<uint64_t> m_latencySampleEvery {0}; ///< Stamp 1 of every N events at ingress (0 disables it)
     mutable std::shared_mutex m_syncMutex;         ///< Mutex for the Workers synchronization (1 query at a time)
 
     // Workers configuration
@@ -47,6 +68,29 @@ protected:
     std::shared_ptr<TestQueueType> m_testQueue;       ///< The test queue
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< The environment builder
 
+    // Sticky dispatch (optional): one queue per worker, events keyed by agent id
+    std::vector<std::shared_ptr<ProdQueueType>> m_workerQueues; ///< Per-worker queues, empty in shared-queue mode
+    std::atomic<uint64_t> m_unkeyedCounter {0}; ///< Round-robin fallback for events without agent id
+
+    /**
+     * @brief Contiguous slice of the per-worker queues reserved for one tenant.
+     *
+     * Tenant dispatch partitions the sticky worker queues into lanes: each named
+     * tenant owns [m_offset, m_offset + m_count) and everything else shares the
+     * remainder, so a noisy tenant cannot starve the others.
+     */
+    struct TenantLane
+    {
+        std::size_t m_offset {0}; ///< First worker queue of the lane
+        std::size_t m_count {0};  ///< Number of worker queues in the lane
+    };
+
+    // Tenant dispatch (optional): dedicated worker lanes keyed by event metadata
+    json::CompiledPath m_tenantKeyPath {}; ///< Event field holding the tenant name
+    std::map<std::string, TenantLane, std::less<>> m_tenantLanes {}; ///< Lane of each named tenant
+    TenantLane m_sharedLane {};                                      ///< Lane for events of unnamed tenants
+    bool m_tenantDispatch {false}; ///< Whether tenant lanes are configured
+
     // Configuration options
     std::weak_ptr<store::IStoreInternal> m_wStore; ///< Read and store configurations
     base::Name m_storeTesterName;                  ///< Path of internal configuration state for testers
@@ -61,6 +105,46 @@ protected:
     void dumpEps() const;                                                    ///< Dump the EPS to the store
     void loadEpsCounter(const std::weak_ptr<store::IStoreInternal>& wStore); ///< Load the EPS counter from the store
 
+    // Warm-state snapshot: one consolidated document a standby process can read to
+    // resume routing without re-deriving the state from scattered sources
+    using StateProvider = std::pair<std::string, std::function<json::Json()>>;
+    std::vector<StateProvider> m_stateProviders;     ///< External state sections added to the snapshot
+    int m_snapshotInterval {0};                      ///< Seconds between periodic snapshots, 0 disables them
+    std::thread m_snapshotThread;                    ///< Thread writing the periodic snapshots
+    std::mutex m_snapshotMutex;                      ///< Paired with m_snapshotCv to stop the thread promptly
+    std::condition_variable m_snapshotCv;            ///< Wakes the snapshot thread on stop
+    bool m_stopSnapshot {false};                     ///< Stop flag for the snapshot thread, guarded by m_snapshotMutex
+
+    /**
+     * @brief Build the warm-state snapshot document: router and tester tables, EPS
+     * settings, queue watermarks and every registered external state section.
+     */
+    json::Json buildSnapshot() const;
+
+    void dumpSnapshot() const; ///< Write the warm-state snapshot to the store
+
+    // Overload governor: one thread samples queue utilization and walks the
+    // shedding/limiting levels with hysteresis, so the reactions engage in order
+    // instead of each oscillating on its own threshold
+    std::function<void(bool)> m_shedActuator; ///< Tightens (true) or restores (false) the LOW lane watermark
+    int m_governorInterval {0};               ///< Milliseconds between governor samples, 0 disables it
+    bool m_governorEngagedEps {false};        ///< The governor, not an operator, started the EPS counter
+    std::thread m_governorThread;             ///< Thread sampling utilization and applying the levels
+    std::mutex m_governorMutex;               ///< Paired with m_governorCv to stop the thread promptly
+    std::condition_variable m_governorCv;     ///< Wakes the governor thread on stop
+    bool m_stopGovernor {false};              ///< Stop flag for the governor thread, guarded by m_governorMutex
+    std::shared_ptr<metrics::IMetric> m_shedEngagedMetric;  ///< Counter for shedding engagements
+    std::shared_ptr<metrics::IMetric> m_limitEngagedMetric; ///< Counter for admission control engagements
+
+    /**
+     * @brief Feed one utilization sample to the governor and apply the level
+     * transitions: toggle the shed actuator and engage or release the EPS counter.
+     *
+     * Only the EPS activations made by the governor itself are released on
+     * de-escalation; an operator-activated counter is left untouched.
+     */
+    void governorTick();
+
     /**
      * @brief Initialize a worker
      *
@@ -79,14 +163,16 @@ protected:
     Orchestrator() = default; ///< Default constructor for testing purposes
 
 public:
-    ~Orchestrator() = default;
+    ~Orchestrator(); ///< Stops the snapshot and governor threads if they are still running
     /**
      * @brief Configuration for the Orchestrator
      *
      */
     struct Options
     {
-        int m_numThreads; ///< Number of workers to create
+        int m_numThreads;         ///< Number of workers to create
+        bool m_pinWorkers {false}; ///< Pin each worker thread to a CPU core, round-robin over the available cores
+        int m_latencySampleEvery {0}; ///< Stamp 1 of every N events at ingress for latency histograms (0 disables it)
 
         std::weak_ptr<store::IStore> m_wStore;      ///< Store to read namespaces and configurations
         std::weak_ptr<builder::IBuilder> m_builder; ///< Builder use for creating environments
@@ -95,8 +181,62 @@ public:
         std::shared_ptr<ProdQueueType> m_prodQueue;              ///< The event queue
         std::shared_ptr<TestQueueType> m_testQueue;              ///< The test queue
 
+        /**
+         * One queue per worker enabling sticky dispatch: events are routed to a worker
+         * by hash of the agent id, so events of the same agent are processed in order.
+         * Must be empty (shared-queue mode) or have exactly numThreads queues.
+         */
+        std::vector<std::shared_ptr<ProdQueueType>> m_workerQueues {};
+
+        /**
+         * Event field (json pointer) holding the tenant name for tenant dispatch.
+         * Empty disables tenant lanes. Requires per-worker queues.
+         */
+        std::string m_tenantKeyPath {};
+
+        /**
+         * Workers dedicated to each named tenant, taken from the front of the worker
+         * set in order; the remaining workers form the shared lane and must not be
+         * empty. Tenants absent from this list share the remainder.
+         */
+        std::vector<std::pair<std::string, std::size_t>> m_tenantWorkers {};
+
         int m_testTimeout; ///< Timeout for handlers of testers
 
+        /**
+         * Seconds between periodic warm-state snapshots. 0 disables the periodic
+         * writes; a final snapshot is still written on clean shutdown.
+         */
+        int m_snapshotInterval {0};
+
+        /**
+         * Named external state sections added to the warm-state snapshot, e.g. the
+         * KVDB handler set. Each provider is called on every snapshot and its JSON
+         * is stored under /<name> of the snapshot document.
+         */
+        std::vector<std::pair<std::string, std::function<json::Json()>>> m_stateProviders {};
+
+        /**
+         * Milliseconds between overload governor samples. 0 disables the governor
+         * and overload behavior falls back to the independent reactions.
+         */
+        int m_governorInterval {0};
+
+        // Governor thresholds as queue utilization percentages. Each reaction has
+        // separate enter/exit watermarks (hysteresis) and shedding engages before
+        // limiting; the governor constructor validates the ordering.
+        int m_governorShedEnter {75};  ///< Shedding engages at this utilization
+        int m_governorShedExit {50};   ///< Shedding disengages below this utilization
+        int m_governorLimitEnter {90}; ///< EPS admission engages at this utilization
+        int m_governorLimitExit {60};  ///< EPS admission disengages below this utilization
+
+        /**
+         * Called by the governor with true to tighten the LOW priority lane of the
+         * event queues and with false to restore the configured watermark. Empty
+         * disables the shedding reaction.
+         */
+        std::function<void(bool)> m_shedActuator {};
+
         void validate() const; ///< Validate the configuration options if is invalid throw an  std::runtime_error
     };
 
@@ -151,7 +291,88 @@ public:
     /**
      * @copydoc router::IRouterAPI::postEvent
      */
-    void postEvent(base::Event&& event) override { m_eventQueue->push(std::move(event)); }
+    void postEvent(base::Event&& event) override
+    {
+        // Sampled ingress timestamp for the end-to-end latency histograms. The cost for
+        // the non-sampled events is a single relaxed increment.
+        const auto sampleEvery = m_latencySampleEvery.load(std::memory_order_relaxed);
+        if (sampleEvery != 0 && m_ingressCounter.fetch_add(1, std::memory_order_relaxed) % sampleEvery == 0)
+        {
+            event->setInt64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch())
+                                .count(),
+                            base::event::ingressTimestampPath());
+        }
+
+        if (m_workerQueues.empty())
+        {
+            m_eventQueue->push(std::move(event));
+            return;
+        }
+
+        // Tenant dispatch: events of a named tenant only ever touch its own slice of
+        // the worker queues, events of everyone else share the remainder.
+        auto lane = TenantLane {0, m_workerQueues.size()};
+        if (m_tenantDispatch)
+        {
+            lane = m_sharedLane;
+            const auto tenant = event->getStringView(m_tenantKeyPath);
+            if (tenant)
+            {
+                const auto it = m_tenantLanes.find(tenant.value());
+                if (it != m_tenantLanes.end())
+                {
+                    lane = it->second;
+                }
+            }
+        }
+
+        // Sticky dispatch: events of the same agent land on the same worker, so they
+        // are processed in order. Events without agent id are spread round-robin.
+        std::size_t target;
+        const auto agentId = event->getStringView(base::event::agentIdPath());
+        if (agentId)
+        {
+            target = lane.m_offset + std::hash<std::string_view> {}(agentId.value()) % lane.m_count;
+        }
+        else
+        {
+            target = lane.m_offset + m_unkeyedCounter.fetch_add(1, std::memory_order_relaxed) % lane.m_count;
+        }
+
+        // Relief valve for hot agents: when the target queue is deep and at least twice
+        // as deep as the shallowest one in the lane, divert there, trading per-agent
+        // order for not stalling the whole queue behind a single hot agent. The scan
+        // stays within the lane so tenants remain isolated.
+        const auto depth = m_workerQueues[target]->size();
+        if (depth > STICKY_REBALANCE_MIN_DEPTH)
+        {
+            auto shallowest = target;
+            auto minDepth = depth;
+            for (std::size_t i = lane.m_offset; i < lane.m_offset + lane.m_count; ++i)
+            {
+                const auto laneDepth = m_workerQueues[i]->size();
+                if (laneDepth < minDepth)
+                {
+                    minDepth = laneDepth;
+                    shallowest = i;
+                }
+            }
+            if (minDepth < depth / 2)
+            {
+                target = shallowest;
+            }
+        }
+
+        m_workerQueues[target]->push(std::move(event));
+    }
+
+    /**
+     * @brief Change the latency sampling stride at runtime: 1 of every N posted events
+     * is stamped at ingress. 0 disables the stamping. Applied to the next posted event,
+     * no worker restart involved.
+     */
+    void setLatencySampleEvery(uint64_t everyN) { m_latencySampleEvery.store(everyN, std::memory_order_relaxed); }
 
     /**
      * @copydoc router::IRouterAPI::changeEpsSettings
@@ -168,6 +389,21 @@ public:
      */
     base::OptError activateEpsCounter(bool activate) override;
 
+    /**
+     * @copydoc router::IRouterAPI::activateProfiler
+     */
+    base::OptError activateProfiler(const std::string& name, bool activate) override;
+
+    /**
+     * @copydoc router::IRouterAPI::getProfile
+     */
+    base::RespOrError<std::string> getProfile(const std::string& name) const override;
+
+    /**
+     * @copydoc router::IRouterAPI::getMemory
+     */
+    base::RespOrError<std::string> getMemory() const override;
+
     /**************************************************************************
      * ITesterAPI
      *************************************************************************/
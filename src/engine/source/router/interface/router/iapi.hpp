@@ -39,6 +39,15 @@ public:
 
     // Orchestrator: Activate/Deactivate EPS counter
     virtual base::OptError activateEpsCounter(bool activate) = 0;
+
+    // Orchestrator: Activate/Deactivate the execution profiler of a route
+    virtual base::OptError activateProfiler(const std::string& name, bool activate) = 0;
+
+    // Orchestrator: Get the execution cost table collected by the profiler of a route
+    virtual base::RespOrError<std::string> getProfile(const std::string& name) const = 0;
+
+    // Orchestrator: Get the approximate heap held by every route, per worker
+    virtual base::RespOrError<std::string> getMemory() const = 0;
 };
 
 class ITesterAPI
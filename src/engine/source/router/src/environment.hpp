@@ -2,6 +2,7 @@
 #define _ROUTER_ENVIRONMENT_HPP
 
 #include <memory>
+#include <vector>
 
 #include <base/expression.hpp>
 #include <bk/icontroller.hpp>
@@ -18,6 +19,7 @@ private:
     base::Expression m_filter;                     ///< Filter of the route
     std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy
     std::string m_hash;                            ///< Hash of the current policy (controller)
+    std::size_t m_buildBytes {0};                  ///< Approximate heap held by the build, bytes
 
     /**
      * @brief Stop the controller
@@ -75,6 +77,13 @@ public:
      */
     void ingest(base::Event&& event) const { m_controller->ingest(std::move(event)); }
 
+    /**
+     * @brief Ingest a bundle of events into the environment in one batch pass
+     *
+     * @param events Events to ingest, consumed by the call
+     */
+    void ingestBatch(std::vector<base::Event>& events) const { m_controller->ingestBatch(events); }
+
     /**
      * @brief Set a new filter of the environment
      *
@@ -95,11 +104,30 @@ public:
         m_controller = std::move(controller);
     }
 
+    /**
+     * @brief Set the approximate heap growth measured while building the environment
+     *
+     */
+    void buildBytes(std::size_t bytes) { m_buildBytes = bytes; }
+
+    /**
+     * @brief Approximate heap held by the environment (policy graph, helper closures
+     * and backend), as measured at build time. Zero when it was not measured.
+     *
+     */
+    std::size_t buildBytes() const { return m_buildBytes; }
+
     /**
      * @brief Get hash of the current policy (controller)
      *
      */
     const std::string& hash() const { return m_hash; }
+
+    /**
+     * @brief Get the controller of the environment
+     *
+     */
+    const std::shared_ptr<bk::IController>& controller() const { return m_controller; }
 };
 } // namespace router
 
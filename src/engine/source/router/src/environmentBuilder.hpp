@@ -5,6 +5,10 @@
 #include <unordered_set>
 #include <utility>
 
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
 
@@ -113,6 +117,13 @@ public:
     /**
      * @brief Create an environment based on a policy and a filter.
      *
+     * On glibc the heap growth of the build is recorded in the environment as its
+     * approximate footprint, and the freed build-time structures (catalog documents,
+     * parse results, intermediate graphs) are trimmed back to the OS once the
+     * environment is assembled. The measurement reads the process-wide allocator
+     * counters, so allocations of concurrent threads leak into it; builds run
+     * serially on the management thread, which keeps the delta attributable.
+     *
      * @param policyName The name of the policy.
      * @param filterName The name of the filter.
      * @return Environment The created environment.
@@ -123,12 +134,24 @@ public:
         std::shared_ptr<bk::IController> controller = nullptr;
         try
         {
+#ifdef __GLIBC__
+            const auto bytesBefore = mallinfo2().uordblks;
+#endif
             std::string hash {};
             auto trace {false};
             auto sandbox {false};
             std::tie(controller, hash) = makeController(policyName, trace, sandbox);
             auto expression = getExpression(filterName);
-            return std::make_unique<Environment>(std::move(expression), std::move(controller), std::move(hash));
+            auto environment =
+                std::make_unique<Environment>(std::move(expression), std::move(controller), std::move(hash));
+#ifdef __GLIBC__
+            const auto bytesAfter = mallinfo2().uordblks;
+            environment->buildBytes(bytesAfter > bytesBefore ? bytesAfter - bytesBefore : 0);
+            // Build-time-only allocations are already freed; hand the emptied arenas
+            // back to the OS so a deploy does not leave them pinned in RSS.
+            malloc_trim(0);
+#endif
+            return environment;
         }
         catch (const std::runtime_error& e)
         {
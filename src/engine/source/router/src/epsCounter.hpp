@@ -1,8 +1,10 @@
 #ifndef _ROUTER_EPS_COUNTER_HPP
 #define _ROUTER_EPS_COUNTER_HPP
 
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 
 namespace router
 {
@@ -16,7 +18,23 @@ constexpr auto DEFAULT_STATE = false;
  */
 class Orchestrator::EpsCounter
 {
+public:
+    static constexpr std::size_t MAX_SHARDS = 64; ///< Maximum number of per-worker shards
+
 private:
+    /// Events a shard accumulates locally before publishing to the shared counter
+    static constexpr uint FLUSH_BATCH = 64;
+
+    /**
+     * @brief Per-worker counter cell, padded to its own cache line so worker
+     * threads never contend on the same line while counting.
+     */
+    struct alignas(64) Shard
+    {
+        std::atomic_uint m_pending {0}; ///< Events counted locally, not yet published
+    };
+
+    std::array<Shard, MAX_SHARDS> m_shards; ///< Sharded per-worker counters
     std::atomic_uint m_count;     ///< Counter for the number of events
     std::atomic_bool m_canReset;  ///< Flag to ensure only one thread resets the counter
     std::atomic_uint m_limit;     ///< Limit for the number of events per interval
@@ -65,11 +83,33 @@ public:
         m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
     }
 
-    bool limitReached()
+    /**
+     * @brief Count one event on the given shard and check the EPS limit.
+     *
+     * Each worker counts on its own cache-line-padded shard and publishes to
+     * the shared counter in batches, so the shared line is touched once every
+     * FLUSH_BATCH events instead of on every event. The limit check therefore
+     * lags by at most MAX_SHARDS * FLUSH_BATCH events, which is negligible
+     * against per-interval limits.
+     *
+     * @param shardId Identifier of the calling worker (taken modulo MAX_SHARDS)
+     * @return true if the limit was reached for the current interval
+     */
+    bool limitReached(std::size_t shardId)
     {
+        auto& shard = m_shards[shardId % MAX_SHARDS];
+        auto pending = shard.m_pending.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (pending >= FLUSH_BATCH)
+        {
+            shard.m_pending.fetch_sub(pending, std::memory_order_relaxed);
+            m_count.fetch_add(pending, std::memory_order_relaxed);
+            // The batch is now in the shared counter, do not count it twice below
+            pending = 0;
+        }
+
         // Preemptively check the limit, only then check and reset the counter
-        auto current = m_count.fetch_add(1, std::memory_order_relaxed);
-        if (++current <= m_limit.load(std::memory_order_relaxed))
+        auto current = m_count.load(std::memory_order_relaxed) + pending;
+        if (current <= m_limit.load(std::memory_order_relaxed))
         {
             return false;
         }
@@ -88,6 +128,14 @@ public:
                 {
                     m_lastReset = now;
                     m_count.store(0, std::memory_order_relaxed);
+                    // Drop the unpublished residue of every shard so the new
+                    // window starts from zero; a concurrent increment may be
+                    // lost, leaving that event uncounted and the limit
+                    // marginally looser, never stricter.
+                    for (auto& s : m_shards)
+                    {
+                        s.m_pending.store(0, std::memory_order_relaxed);
+                    }
                 }
 
                 m_canReset.store(true, std::memory_order_release);
@@ -97,6 +145,11 @@ public:
         return true;
     }
 
+    /**
+     * @brief Count one event on the default shard and check the EPS limit.
+     */
+    bool limitReached() { return limitReached(0); }
+
     void stop() { active.store(false, std::memory_order_relaxed); }
 
     void start() { active.store(true, std::memory_order_relaxed); }
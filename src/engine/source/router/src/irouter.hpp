@@ -4,6 +4,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <router/types.hpp>
 
@@ -78,11 +79,58 @@ public:
      */
     virtual base::RespOrError<prod::Entry> getEntry(const std::string& name) const = 0;
 
+    /**
+     * @brief Enable or disable the execution profiler of the environment.
+     *
+     * Enabling resets previously collected samples, disabling keeps them so they can
+     * still be dumped.
+     *
+     * @param name The name of the environment.
+     * @param activate true to start collecting, false to stop.
+     * @return An optional error if the operation failed.
+     */
+    virtual base::OptError activateProfiler(const std::string& name, bool activate) = 0;
+
+    /**
+     * @brief Dump the execution cost table collected by the profiler of the environment.
+     *
+     * @param name The name of the environment.
+     * @return The per-expression cost table sorted by cumulative time, or an error.
+     */
+    virtual base::RespOrError<std::string> dumpProfile(const std::string& name) const = 0;
+
+    /**
+     * @brief Dump the approximate heap held by every route of the router table.
+     *
+     * @return A per-route byte report, one line per entry.
+     */
+    virtual base::RespOrError<std::string> dumpMemory() const = 0;
+
     /**
      * @brief Ingest an event into the router.
      * @param event The event to be ingested.
      */
     virtual void ingest(base::Event&& event) = 0;
+
+    /**
+     * @brief Ingest a bundle of events into the router.
+     *
+     * Implementations may hand whole bundles to the matched environments so the
+     * per-event dispatch cost amortizes over the bundle; the default forwards
+     * event by event.
+     *
+     * @param events The events to be ingested, consumed by the call.
+     */
+    virtual void ingestBatch(std::vector<base::Event>& events)
+    {
+        for (auto& event : events)
+        {
+            if (event != nullptr)
+            {
+                ingest(std::move(event));
+            }
+        }
+    }
 };
 
 } // namespace router
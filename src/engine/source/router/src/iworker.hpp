@@ -1,6 +1,7 @@
 #ifndef ROUTER_IWORKER_HPP
 #define ROUTER_IWORKER_HPP
 
+#include <cstddef>
 #include <memory>
 
 #include "irouter.hpp"
@@ -23,6 +24,16 @@ public:
      */
     virtual void start(const EpsLimit& epsLimit) = 0;
 
+    /**
+     * @brief Pin the worker thread to a CPU core
+     *
+     * Must be called after start(). Implementations may ignore the request on
+     * platforms without affinity support.
+     *
+     * @param coreId The zero-based CPU core to pin the worker to
+     */
+    virtual void pinToCore(std::size_t coreId) = 0;
+
     /**
      * @brief Stop the worker
      */
@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <limits>
 #include <list>
 #include <memory>
 #include <string_view>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include <base/json.hpp>
 #include <base/logging.hpp>
 
@@ -10,6 +14,7 @@
 
 #include "entryConverter.hpp"
 #include "epsCounter.hpp"
+#include "overloadGovernor.hpp"
 #include "worker.hpp"
 
 namespace router
@@ -104,6 +109,76 @@ void Orchestrator::dumpRouters() const
     saveConfig(m_wStore, m_storeRouterName, jDump);
 }
 
+json::Json Orchestrator::buildSnapshot() const
+{
+    json::Json snapshot;
+    snapshot.setObject();
+    snapshot.setInt64(
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count(),
+        "/savedAt");
+
+    // Routing tables and active environment references, as the workers run them
+    if (!m_workers.empty())
+    {
+        snapshot.set("/router", EntryConverter::toJsonArray(m_workers.front()->getRouter()->getEntries()));
+        snapshot.set("/tester", EntryConverter::toJsonArray(m_workers.front()->getTester()->getEntries()));
+    }
+
+    // EPS settings
+    if (m_epsCounter)
+    {
+        snapshot.setInt64(m_epsCounter->getEps(), "/eps/eps");
+        snapshot.setInt64(m_epsCounter->getRefreshInterval(), "/eps/refreshInterval");
+        snapshot.setBool(m_epsCounter->isActive(), "/eps/active");
+    }
+
+    // Queue watermarks, a standby sizes its backlog expectations from these
+    if (m_eventQueue)
+    {
+        snapshot.setInt64(static_cast<int64_t>(m_eventQueue->size()), "/queues/event/size");
+        snapshot.setInt64(static_cast<int64_t>(m_eventQueue->aproxFreeSlots()), "/queues/event/freeSlots");
+    }
+    if (m_testQueue)
+    {
+        snapshot.setInt64(static_cast<int64_t>(m_testQueue->size()), "/queues/test/size");
+    }
+    snapshot.setArray("/queues/workers");
+    for (const auto& queue : m_workerQueues)
+    {
+        json::Json depth;
+        depth.setInt64(static_cast<int64_t>(queue->size()));
+        snapshot.appendJson(depth, "/queues/workers");
+    }
+
+    // Overload governor level and engagement history
+    if (m_governor)
+    {
+        snapshot.setString(m_governor->levelName(), "/governor/level");
+        snapshot.setInt64(static_cast<int64_t>(m_governor->shedEngagements()), "/governor/shedEngagements");
+        snapshot.setInt64(static_cast<int64_t>(m_governor->limitEngagements()), "/governor/limitEngagements");
+    }
+
+    // External sections (KVDB handler set, ...), registered at configuration time
+    for (const auto& [name, provider] : m_stateProviders)
+    {
+        try
+        {
+            snapshot.set(std::string("/") + name, provider());
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("Router: snapshot section '{}' could not be collected: {}", name, e.what());
+        }
+    }
+
+    return snapshot;
+}
+
+void Orchestrator::dumpSnapshot() const
+{
+    saveConfig(m_wStore, STORE_PATH_SNAPSHOT, buildSnapshot());
+}
+
 void Orchestrator::dumpEps() const
 {
     json::Json jDump;
@@ -213,15 +288,89 @@ void Orchestrator::Options::validate() const
     {
         throw std::runtime_error {"Configuration error: numThreads must be between 1 and 128"};
     }
+    if (m_latencySampleEvery < 0)
+    {
+        throw std::runtime_error {"Configuration error: latencySampleEvery cannot be negative"};
+    }
     validatePointer(m_wStore, "store");
     validatePointer(m_builder, "builder");
     validatePointer(m_controllerMaker, "controllerMaker");
     validatePointer(m_prodQueue, "prodQueue");
     validatePointer(m_testQueue, "testQueue");
+    if (!m_workerQueues.empty())
+    {
+        if (m_workerQueues.size() != static_cast<std::size_t>(m_numThreads))
+        {
+            throw std::runtime_error {"Configuration error: workerQueues must be empty or match numThreads"};
+        }
+        for (const auto& queue : m_workerQueues)
+        {
+            validatePointer(queue, "workerQueues");
+        }
+    }
+    if (!m_tenantWorkers.empty() || !m_tenantKeyPath.empty())
+    {
+        if (m_tenantKeyPath.empty())
+        {
+            throw std::runtime_error {"Configuration error: tenantWorkers requires a tenantKeyPath"};
+        }
+        if (m_tenantWorkers.empty())
+        {
+            throw std::runtime_error {"Configuration error: tenantKeyPath requires tenantWorkers"};
+        }
+        if (m_workerQueues.empty())
+        {
+            throw std::runtime_error {"Configuration error: tenant dispatch requires per-worker queues"};
+        }
+        std::size_t dedicated = 0;
+        for (const auto& [tenant, count] : m_tenantWorkers)
+        {
+            if (tenant.empty())
+            {
+                throw std::runtime_error {"Configuration error: tenant name cannot be empty"};
+            }
+            if (count < 1)
+            {
+                throw std::runtime_error {
+                    fmt::format("Configuration error: tenant '{}' must have at least 1 worker", tenant)};
+            }
+            if (std::count_if(m_tenantWorkers.begin(),
+                              m_tenantWorkers.end(),
+                              [&tenant = tenant](const auto& entry) { return entry.first == tenant; })
+                > 1)
+            {
+                throw std::runtime_error {fmt::format("Configuration error: duplicate tenant '{}'", tenant)};
+            }
+            dedicated += count;
+        }
+        if (dedicated >= static_cast<std::size_t>(m_numThreads))
+        {
+            throw std::runtime_error {"Configuration error: tenant workers must leave at least 1 shared worker"};
+        }
+    }
     if (m_testTimeout < 1)
     {
         throw std::runtime_error {"Configuration error: testTimeout must be greater than 0"};
     }
+    if (m_snapshotInterval < 0)
+    {
+        throw std::runtime_error {"Configuration error: snapshotInterval cannot be negative"};
+    }
+    if (m_governorInterval < 0)
+    {
+        throw std::runtime_error {"Configuration error: governorInterval cannot be negative"};
+    }
+    for (const auto& [name, provider] : m_stateProviders)
+    {
+        if (name.empty())
+        {
+            throw std::runtime_error {"Configuration error: state provider name cannot be empty"};
+        }
+        if (!provider)
+        {
+            throw std::runtime_error {fmt::format("Configuration error: state provider '{}' cannot be empty", name)};
+        }
+    }
 }
 
 base::OptError Orchestrator::addWorker(std::shared_ptr<IWorker> worker)
@@ -263,6 +412,24 @@ Orchestrator::Orchestrator(const Options& opt)
     m_envBuilder = std::make_shared<EnvironmentBuilder>(opt.m_builder, opt.m_controllerMaker);
     m_testTimeout = opt.m_testTimeout;
     m_wStore = opt.m_wStore;
+    m_pinWorkers = opt.m_pinWorkers;
+    m_latencySampleEvery = static_cast<uint64_t>(opt.m_latencySampleEvery);
+    m_workerQueues = opt.m_workerQueues;
+
+    // Carve the tenant lanes out of the worker queues: dedicated workers are taken
+    // from the front in configuration order, the remainder is the shared lane
+    if (!opt.m_tenantWorkers.empty())
+    {
+        m_tenantKeyPath = json::CompiledPath {opt.m_tenantKeyPath};
+        std::size_t offset = 0;
+        for (const auto& [tenant, count] : opt.m_tenantWorkers)
+        {
+            m_tenantLanes.emplace(tenant, TenantLane {offset, count});
+            offset += count;
+        }
+        m_sharedLane = TenantLane {offset, m_workerQueues.size() - offset};
+        m_tenantDispatch = true;
+    }
 
     // Get the initial states from the store
     auto store = m_wStore.lock();
@@ -277,7 +444,8 @@ Orchestrator::Orchestrator(const Options& opt)
     // Create the workers
     for (std::size_t i = 0; i < opt.m_numThreads; ++i)
     {
-        auto worker = std::make_shared<Worker>(m_envBuilder, m_eventQueue, m_testQueue);
+        auto worker = std::make_shared<Worker>(
+            m_envBuilder, m_workerQueues.empty() ? m_eventQueue : m_workerQueues[i], m_testQueue);
         auto error = initWorker(worker, routerEntries, testerEntries);
         if (error)
         {
@@ -288,30 +456,256 @@ Orchestrator::Orchestrator(const Options& opt)
 
     // Initialize the EpsCounter
     loadEpsCounter(m_wStore);
+
+    m_snapshotInterval = opt.m_snapshotInterval;
+    m_stateProviders = opt.m_stateProviders;
+
+    // Overload governor: the constructor validates the threshold ordering
+    m_governorInterval = opt.m_governorInterval;
+    m_shedActuator = opt.m_shedActuator;
+    if (m_governorInterval > 0)
+    {
+        m_governor = std::make_shared<OverloadGovernor>(static_cast<uint>(opt.m_governorShedEnter),
+                                                        static_cast<uint>(opt.m_governorShedExit),
+                                                        static_cast<uint>(opt.m_governorLimitEnter),
+                                                        static_cast<uint>(opt.m_governorLimitExit));
+
+        auto counter = [](const char* name, const char* description) -> std::shared_ptr<metrics::IMetric>
+        {
+            try
+            {
+                return metrics::getManager().addMetric(metrics::MetricType::UINTCOUNTER, name, description, "1");
+            }
+            catch (const std::exception& e)
+            {
+                LOG_DEBUG("Router: Governor metric '{}' not available: {}", name, e.what());
+                return nullptr;
+            }
+        };
+        m_shedEngagedMetric = counter("router.GovernorShedEngaged", "Times the overload governor engaged shedding");
+        m_limitEngagedMetric =
+            counter("router.GovernorLimitEngaged", "Times the overload governor engaged EPS admission control");
+    }
+
+    // A previous snapshot only carries warm-state hints, the tables above are the
+    // authoritative state; log its age so failover time can be audited
+    auto snapResp = store->readInternalDoc(STORE_PATH_SNAPSHOT);
+    if (!base::isError(snapResp))
+    {
+        const auto savedAt = base::getResponse(snapResp).getInt64("/savedAt").value_or(0);
+        const auto now =
+            std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
+                .count();
+        LOG_INFO("Router: warm-state snapshot found, {} seconds old", now - savedAt);
+    }
 }
 
-void Orchestrator::start()
+Orchestrator::~Orchestrator()
 {
-    std::shared_lock lock {m_syncMutex};
-    IWorker::EpsLimit epsLimit = [epsCounter = m_epsCounter]() -> bool
     {
-        if (epsCounter->isActive())
+        std::lock_guard<std::mutex> lock {m_snapshotMutex};
+        m_stopSnapshot = true;
+    }
+    m_snapshotCv.notify_all();
+    if (m_snapshotThread.joinable())
+    {
+        m_snapshotThread.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock {m_governorMutex};
+        m_stopGovernor = true;
+    }
+    m_governorCv.notify_all();
+    if (m_governorThread.joinable())
+    {
+        m_governorThread.join();
+    }
+}
+
+void Orchestrator::governorTick()
+{
+    if (!m_governor)
+    {
+        return;
+    }
+
+    // Sticky mode drains events through the per-worker queues, shared mode through
+    // the event queue; aggregate whichever set carries the traffic
+    std::size_t used = 0;
+    std::size_t capacity = 0;
+    auto account = [&used, &capacity](const std::shared_ptr<ProdQueueType>& queue)
+    {
+        const auto size = queue->size();
+        const auto free = queue->aproxFreeSlots();
+        used += size;
+        // size is approximate and can transiently exceed the capacity, which
+        // underflows the free slots; treat that as a full queue
+        capacity += size + (free > std::numeric_limits<std::size_t>::max() / 2 ? 0 : free);
+    };
+    if (!m_workerQueues.empty())
+    {
+        for (const auto& queue : m_workerQueues)
         {
-            return epsCounter->limitReached();
+            account(queue);
         }
-        return false;
-    };
+    }
+    else if (m_eventQueue)
+    {
+        account(m_eventQueue);
+    }
+
+    const auto before = m_governor->level();
+    const auto after = m_governor->sample(used, capacity);
+    if (after == before)
+    {
+        return;
+    }
+
+    using Level = OverloadGovernor::Level;
+
+    // Shedding: engaged at every level above STEADY
+    const auto shedBefore = before != Level::STEADY;
+    const auto shedAfter = after != Level::STEADY;
+    if (shedBefore != shedAfter && m_shedActuator)
+    {
+        m_shedActuator(shedAfter);
+        if (shedAfter)
+        {
+            if (m_shedEngagedMetric)
+            {
+                m_shedEngagedMetric->update(uint64_t {1});
+            }
+            LOG_WARNING("Router: overload governor engaged shedding at {}/{} queued events", used, capacity);
+        }
+        else
+        {
+            LOG_INFO("Router: overload governor disengaged shedding at {}/{} queued events", used, capacity);
+        }
+    }
+
+    // Admission control: only release activations made by the governor itself, an
+    // operator-activated counter stays active. The transient state is never dumped
+    // to the store, so it does not survive a restart as an operator setting.
+    if (after == Level::LIMITING && m_epsCounter && !m_epsCounter->isActive())
+    {
+        m_epsCounter->start();
+        m_governorEngagedEps = true;
+        if (m_limitEngagedMetric)
+        {
+            m_limitEngagedMetric->update(uint64_t {1});
+        }
+        LOG_WARNING("Router: overload governor engaged EPS admission control ({} eps)", m_epsCounter->getEps());
+    }
+    else if (before == Level::LIMITING && m_governorEngagedEps && m_epsCounter)
+    {
+        m_epsCounter->stop();
+        m_governorEngagedEps = false;
+        LOG_INFO("Router: overload governor disengaged EPS admission control");
+    }
+}
 
+void Orchestrator::start()
+{
+    std::shared_lock lock {m_syncMutex};
+
+    // Place workers on consecutive cores so siblings of the same socket share
+    // the LLC; on NUMA hosts consecutive core ids stay within a node for the
+    // common contiguous-enumeration layouts. Each worker counts EPS on its own
+    // shard to avoid contending on a shared counter line.
+    std::size_t workerId = 0;
     for (const auto& worker : m_workers)
     {
+        IWorker::EpsLimit epsLimit = [epsCounter = m_epsCounter, workerId]() -> bool
+        {
+            if (epsCounter->isActive())
+            {
+                return epsCounter->limitReached(workerId);
+            }
+            return false;
+        };
+
         worker->start(epsLimit);
+        if (m_pinWorkers)
+        {
+            worker->pinToCore(workerId);
+        }
+        ++workerId;
+    }
+
+    // Periodic warm-state snapshots, a standby process reads the last one to
+    // resume routing without re-deriving the state
+    if (m_snapshotInterval > 0 && !m_snapshotThread.joinable())
+    {
+        m_snapshotThread = std::thread(
+            [this]()
+            {
+                std::unique_lock<std::mutex> lock {m_snapshotMutex};
+                while (!m_snapshotCv.wait_for(
+                    lock, std::chrono::seconds(m_snapshotInterval), [this]() { return m_stopSnapshot; }))
+                {
+                    std::shared_lock workersLock {m_syncMutex};
+                    dumpSnapshot();
+                }
+            });
+    }
+
+    // Overload governor: sample utilization and walk the shedding/limiting levels
+    if (m_governorInterval > 0 && !m_governorThread.joinable())
+    {
+        m_governorThread = std::thread(
+            [this]()
+            {
+                std::unique_lock<std::mutex> lock {m_governorMutex};
+                while (!m_governorCv.wait_for(
+                    lock, std::chrono::milliseconds(m_governorInterval), [this]() { return m_stopGovernor; }))
+                {
+                    governorTick();
+                }
+            });
     }
 }
 
 void Orchestrator::stop()
 {
+    // Stop the periodic snapshots first, the final one below is the clean-shutdown state
+    {
+        std::lock_guard<std::mutex> snapLock {m_snapshotMutex};
+        m_stopSnapshot = true;
+    }
+    m_snapshotCv.notify_all();
+    if (m_snapshotThread.joinable())
+    {
+        m_snapshotThread.join();
+    }
+
+    // Stop the governor and release its interventions so the configured state is
+    // restored for the next start
+    {
+        std::lock_guard<std::mutex> govLock {m_governorMutex};
+        m_stopGovernor = true;
+    }
+    m_governorCv.notify_all();
+    if (m_governorThread.joinable())
+    {
+        m_governorThread.join();
+    }
+    if (m_governor && m_governor->level() != OverloadGovernor::Level::STEADY && m_shedActuator)
+    {
+        m_shedActuator(false);
+    }
+    if (m_governorEngagedEps && m_epsCounter)
+    {
+        m_epsCounter->stop();
+        m_governorEngagedEps = false;
+    }
+
     std::shared_lock lock {m_syncMutex};
     dumpTesters(); // TODO: For save the last used time
+    if (m_snapshotInterval > 0)
+    {
+        dumpSnapshot();
+    }
     for (const auto& worker : m_workers)
     {
         worker->stop();
@@ -460,6 +854,59 @@ base::OptError Orchestrator::activateEpsCounter(bool activate)
     return std::nullopt;
 }
 
+base::OptError Orchestrator::activateProfiler(const std::string& name, bool activate)
+{
+    if (name.empty())
+    {
+        return base::Error {"Name cannot be empty"};
+    }
+
+    std::unique_lock lock {m_syncMutex};
+    return forEachWorker([&name, activate](const auto& worker)
+                         { return worker->getRouter()->activateProfiler(name, activate); });
+}
+
+base::RespOrError<std::string> Orchestrator::getProfile(const std::string& name) const
+{
+    if (name.empty())
+    {
+        return base::Error {"Name cannot be empty"};
+    }
+
+    std::shared_lock lock {m_syncMutex};
+    std::string report {};
+    std::size_t i = 0;
+    for (const auto& worker : m_workers)
+    {
+        auto resp = worker->getRouter()->dumpProfile(name);
+        if (base::isError(resp))
+        {
+            return base::getError(resp);
+        }
+        report += fmt::format("worker {}:\n{}", i++, base::getResponse(resp));
+    }
+
+    return report;
+}
+
+base::RespOrError<std::string> Orchestrator::getMemory() const
+{
+    std::shared_lock lock {m_syncMutex};
+    std::string report {};
+    std::size_t i = 0;
+    for (const auto& worker : m_workers)
+    {
+        auto resp = worker->getRouter()->dumpMemory();
+        if (base::isError(resp))
+        {
+            return base::getError(resp);
+        }
+        report += fmt::format("worker {}:\n{}", i++, base::getResponse(resp));
+    }
+
+    return report;
+}
+
 /**************************************************************************
  * ITesterAPI
  *************************************************************************/
@@ -561,11 +1008,6 @@ std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Even
                           []() -> base::RespOrError<test::Output> { return base::Error {"Test queue is full"}; });
     }
 
-    if (m_eventQueue->empty())
-    {
-        m_eventQueue->push(base::Event(nullptr));
-    }
-
     {
         std::shared_lock lock {m_syncMutex};
         m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
@@ -592,11 +1034,6 @@ base::OptError Orchestrator::ingestTest(base::Event&& event,
     {
         return base::Error {"Test queue is full"};
     }
-    if (m_eventQueue->empty())
-    {
-        m_eventQueue->push(base::Event(nullptr));
-    }
-
     {
         std::shared_lock lock {m_syncMutex};
         m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
@@ -0,0 +1,197 @@
+#ifndef _ROUTER_OVERLOAD_GOVERNOR_HPP
+#define _ROUTER_OVERLOAD_GOVERNOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace router
+{
+constexpr auto DEFAULT_SHED_ENTER_PCT = 75;
+constexpr auto DEFAULT_SHED_EXIT_PCT = 50;
+constexpr auto DEFAULT_LIMIT_ENTER_PCT = 90;
+constexpr auto DEFAULT_LIMIT_EXIT_PCT = 60;
+constexpr auto DEFAULT_GOVERNOR_HOLD = 4;
+
+/**
+ * @brief Hysteresis state machine coordinating the overload reactions of the router.
+ *
+ * Shedding (the LOW priority lane), admission control (the EPS counter) and flooding
+ * each react to pressure on their own; uncoordinated they oscillate between dropping
+ * and stalling during incident storms. The governor samples queue utilization and
+ * escalates through three levels, each reaction engaging before the next:
+ *
+ *   STEADY -> SHEDDING  the LOW lane watermark is tightened, app logs shed first
+ *   SHEDDING -> LIMITING  EPS admission control is engaged on top of the shedding
+ *
+ * A transition requires its threshold to hold for a number of consecutive samples,
+ * and the enter and exit watermarks of each level are separate, so the reactions do
+ * not flap around a single boundary. The flood file stays queue-driven as the last
+ * resort; the governor's role is to shed and admit before it is reached.
+ */
+class Orchestrator::OverloadGovernor
+{
+public:
+    enum class Level
+    {
+        STEADY,   ///< No intervention
+        SHEDDING, ///< LOW lane tightened, sheddable traffic dropped earlier
+        LIMITING  ///< EPS admission control engaged on top of the shedding
+    };
+
+    OverloadGovernor()
+        : OverloadGovernor(DEFAULT_SHED_ENTER_PCT,
+                           DEFAULT_SHED_EXIT_PCT,
+                           DEFAULT_LIMIT_ENTER_PCT,
+                           DEFAULT_LIMIT_EXIT_PCT)
+    {
+    }
+
+    /**
+     * @brief Construct a new Overload Governor object
+     *
+     * @param shedEnterPct Utilization (%) at which shedding engages
+     * @param shedExitPct Utilization (%) below which shedding disengages
+     * @param limitEnterPct Utilization (%) at which admission control engages
+     * @param limitExitPct Utilization (%) below which admission control disengages
+     * @param holdSamples Consecutive samples a threshold must hold before a transition
+     */
+    OverloadGovernor(uint shedEnterPct,
+                     uint shedExitPct,
+                     uint limitEnterPct,
+                     uint limitExitPct,
+                     uint holdSamples = DEFAULT_GOVERNOR_HOLD)
+        : m_shedEnter(shedEnterPct)
+        , m_shedExit(shedExitPct)
+        , m_limitEnter(limitEnterPct)
+        , m_limitExit(limitExitPct)
+        , m_holdSamples(holdSamples)
+    {
+        if (shedEnterPct == 0 || shedEnterPct > 100 || limitEnterPct == 0 || limitEnterPct > 100)
+        {
+            throw std::runtime_error("Governor enter thresholds must be in (0, 100]");
+        }
+        if (shedExitPct >= shedEnterPct || limitExitPct >= limitEnterPct)
+        {
+            throw std::runtime_error("Governor exit thresholds must be below their enter thresholds");
+        }
+        if (shedEnterPct > limitEnterPct || shedExitPct > limitExitPct)
+        {
+            throw std::runtime_error("Governor shedding thresholds must not exceed the limiting ones");
+        }
+        if (holdSamples < 1)
+        {
+            throw std::runtime_error("Governor hold samples must be greater than 0");
+        }
+    }
+
+    /**
+     * @brief Feed one utilization sample and return the resulting level.
+     *
+     * Levels move one step at a time: a transition happens only after the same
+     * candidate level has been indicated by holdSamples consecutive samples, so a
+     * single spike or dip never toggles a reaction.
+     *
+     * @param used Elements currently queued
+     * @param capacity Total capacity of the observed queues (0 samples are ignored)
+     */
+    Level sample(std::size_t used, std::size_t capacity)
+    {
+        if (capacity == 0)
+        {
+            return m_level;
+        }
+        const auto pct = used * 100 / capacity;
+
+        auto candidate = m_level;
+        switch (m_level)
+        {
+            case Level::STEADY:
+                if (pct >= m_shedEnter)
+                {
+                    candidate = Level::SHEDDING;
+                }
+                break;
+            case Level::SHEDDING:
+                if (pct >= m_limitEnter)
+                {
+                    candidate = Level::LIMITING;
+                }
+                else if (pct < m_shedExit)
+                {
+                    candidate = Level::STEADY;
+                }
+                break;
+            case Level::LIMITING:
+                if (pct < m_limitExit)
+                {
+                    candidate = Level::SHEDDING;
+                }
+                break;
+        }
+
+        if (candidate == m_level)
+        {
+            m_pending = m_level;
+            m_streak = 0;
+            return m_level;
+        }
+
+        if (candidate != m_pending)
+        {
+            m_pending = candidate;
+            m_streak = 0;
+        }
+
+        if (++m_streak >= m_holdSamples)
+        {
+            if (candidate == Level::SHEDDING && m_level == Level::STEADY)
+            {
+                ++m_shedEngagements;
+            }
+            else if (candidate == Level::LIMITING)
+            {
+                ++m_limitEngagements;
+            }
+            m_level = candidate;
+            m_pending = candidate;
+            m_streak = 0;
+        }
+
+        return m_level;
+    }
+
+    Level level() const { return m_level; }
+
+    /// Name of the current level, used by the warm-state snapshot
+    const char* levelName() const
+    {
+        switch (m_level)
+        {
+            case Level::SHEDDING: return "shedding";
+            case Level::LIMITING: return "limiting";
+            default: return "steady";
+        }
+    }
+
+    uint64_t shedEngagements() const { return m_shedEngagements; }
+
+    uint64_t limitEngagements() const { return m_limitEngagements; }
+
+private:
+    uint m_shedEnter;   ///< Utilization (%) at which shedding engages
+    uint m_shedExit;    ///< Utilization (%) below which shedding disengages
+    uint m_limitEnter;  ///< Utilization (%) at which admission control engages
+    uint m_limitExit;   ///< Utilization (%) below which admission control disengages
+    uint m_holdSamples; ///< Consecutive samples a threshold must hold
+
+    Level m_level {Level::STEADY};   ///< Current level
+    Level m_pending {Level::STEADY}; ///< Candidate level accumulating its streak
+    uint m_streak {0};               ///< Consecutive samples indicating the candidate
+
+    uint64_t m_shedEngagements {0};  ///< Times shedding was engaged
+    uint64_t m_limitEngagements {0}; ///< Times admission control was engaged
+};
+} // namespace router
+
+#endif // _ROUTER_OVERLOAD_GOVERNOR_HPP
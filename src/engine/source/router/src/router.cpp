@@ -2,6 +2,8 @@
 #include <functional>
 
 #include <base/logging.hpp>
+#include <base/warmup.hpp>
+#include <metrics/imanager.hpp>
 
 #include "router.hpp"
 #include <builder/ibuilder.hpp>
@@ -29,6 +31,7 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
         auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
         entry.hash(uniqueEnv->hash());
         entry.environment() = std::move(uniqueEnv);
+        warmup(entry.environment());
     }
     catch (const std::exception& e)
     {
@@ -55,6 +58,7 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
             return base::Error {"The priority of the route  is already in use"};
         }
         m_table.insert(entryPost.name(), entryPost.priority(), std::move(entry));
+        publishSnapshot();
     }
 
     return std::nullopt;
@@ -69,6 +73,7 @@ base::OptError Router::removeEntry(const std::string& name)
         return base::Error {"The route not exist"};
     }
     m_table.erase(name);
+    publishSnapshot();
     return std::nullopt;
 }
 
@@ -82,8 +87,9 @@ base::OptError Router::rebuildEntry(const std::string& name)
     auto& entry = m_table.get(name);
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
-        entry.environment() = std::move(uniqueEnv);
+        std::shared_ptr<Environment> newEnv = m_envBuilder->create(entry.policy(), entry.filter());
+        warmup(newEnv);
+        entry.environment() = std::move(newEnv);
         entry.lastUpdate(getStartTime());
         entry.hash(entry.environment()->hash());
         // Mantaing the status of the environment
@@ -92,6 +98,7 @@ base::OptError Router::rebuildEntry(const std::string& name)
     {
         return base::Error {fmt::format("Failed to reload the route: {}", e.what())};
     }
+    publishSnapshot();
 
     return std::nullopt;
 }
@@ -110,6 +117,7 @@ base::OptError Router::enableEntry(const std::string& name)
     }
     entry.status(env::State::ENABLED);
     entry.lastUpdate(getStartTime());
+    publishSnapshot();
     return {};
 }
 
@@ -140,6 +148,7 @@ base::OptError Router::changePriority(const std::string& name, size_t priority)
     }
     // Sync the priority
     m_table.get(name).priority(priority);
+    publishSnapshot();
 
     return {};
 }
@@ -166,16 +175,283 @@ base::RespOrError<prod::Entry> Router::getEntry(const std::string& name) const
     return m_table.get(name);
 }
 
-void Router::ingest(base::Event&& event)
+base::OptError Router::activateProfiler(const std::string& name, bool activate)
+{
+    std::shared_lock lock {m_mutex};
+    if (!m_table.nameExists(name))
+    {
+        return base::Error {"The route not exist"};
+    }
+
+    const auto& environment = m_table.get(name).environment();
+    if (!environment)
+    {
+        return base::Error {"The route is not built"};
+    }
+
+    const auto& profiler = environment->controller()->profiler();
+    if (activate)
+    {
+        profiler->reset();
+        profiler->enable();
+    }
+    else
+    {
+        profiler->disable();
+    }
+
+    return {};
+}
+
+base::RespOrError<std::string> Router::dumpProfile(const std::string& name) const
 {
     std::shared_lock lock {m_mutex};
+    if (!m_table.nameExists(name))
+    {
+        return base::Error {"The route not exist"};
+    }
+
+    const auto& environment = m_table.get(name).environment();
+    if (!environment)
+    {
+        return base::Error {"The route is not built"};
+    }
+
+    return environment->controller()->profiler()->report();
+}
+
+base::RespOrError<std::string> Router::dumpMemory() const
+{
+    std::shared_lock lock {m_mutex};
+
+    std::string report {fmt::format("{:<40} {:>8} {:>10} {:>14}\n", "route", "priority", "status", "bytes")};
+    std::size_t total = 0;
+    for (const auto& entry : m_table)
+    {
+        const auto bytes = entry.environment() ? entry.environment()->buildBytes() : 0;
+        total += bytes;
+        report += fmt::format("{:<40} {:>8} {:>10} {:>14}\n",
+                              entry.name(),
+                              entry.priority(),
+                              entry.status() == env::State::ENABLED ? "enabled" : "disabled",
+                              bytes);
+    }
+    report += fmt::format("{:<40} {:>8} {:>10} {:>14}\n", "total", "", "", total);
+
+    return report;
+}
+
+void Router::initMetrics()
+{
+    // Every worker shares the same histogram: the first router registers it and the
+    // rest pick it up by name.
+    try
+    {
+        m_completionLatency = metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM,
+                                                              "router.EventCompletionLatency",
+                                                              "Latency from event ingress to router completion",
+                                                              "us");
+    }
+    catch (const std::exception&)
+    {
+        try
+        {
+            m_completionLatency = metrics::getManager().getMetric("router.EventCompletionLatency");
+        }
+        catch (const std::exception& e)
+        {
+            LOG_DEBUG("Router: Completion latency metric not available: {}", e.what());
+        }
+    }
+}
 
+#ifdef ENGINE_STAGE_TIMING
+const Router::StageMetrics& Router::stageMetricsFor(const std::string& route)
+{
+    auto it = m_stageByRoute.find(route);
+    if (it != m_stageByRoute.end())
+    {
+        return it->second;
+    }
+
+    // Same registration pattern as initMetrics: the first router registers the
+    // histogram and the rest pick it up by name.
+    auto histogram = [&route](const char* stage, const char* description) -> std::shared_ptr<metrics::IMetric>
+    {
+        const auto name = fmt::format("router.stage.{}.{}", route, stage);
+        try
+        {
+            return metrics::getManager().addMetric(metrics::MetricType::UINTHISTOGRAM, name, description, "us");
+        }
+        catch (const std::exception&)
+        {
+            try
+            {
+                return metrics::getManager().getMetric(name);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_DEBUG("Router: Stage histogram '{}' not available: {}", name, e.what());
+                return nullptr;
+            }
+        }
+    };
+
+    StageMetrics stage {histogram("Queue", "Wait in the event queue of sampled events"),
+                        histogram("Route", "Route resolution of sampled events"),
+                        histogram("Process", "Pipeline run in the backend controller of sampled events"),
+                        histogram("Complete", "Ingress to completion of sampled events")};
+    return m_stageByRoute.emplace(route, std::move(stage)).first->second;
+}
+#endif
+
+void Router::publishSnapshot()
+{
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->reserve(m_table.size());
+#ifdef ENGINE_STAGE_TIMING
+    auto stageSnapshot = std::make_shared<StageSnapshot>();
+#endif
     for (const auto& entry : m_table)
     {
-        if (entry.status() == env::State::ENABLED && entry.environment()->isAccepted(event))
+        if (entry.status() == env::State::ENABLED)
         {
-            entry.environment()->ingest(std::move(event));
+            snapshot->push_back(entry.environment());
+#ifdef ENGINE_STAGE_TIMING
+            stageSnapshot->emplace(entry.environment().get(), stageMetricsFor(entry.name()));
+#endif
+        }
+    }
+    std::atomic_store(&m_snapshot, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+#ifdef ENGINE_STAGE_TIMING
+    std::atomic_store(&m_stageSnapshot, std::shared_ptr<const StageSnapshot>(std::move(stageSnapshot)));
+#endif
+}
+
+void Router::sampleForWarmup(const base::Event& event)
+{
+    if (m_ingestCounter++ % WARMUP_SAMPLE_EVERY != 0)
+    {
+        return;
+    }
+
+    auto copy = std::make_shared<json::Json>(*event);
+    std::lock_guard lock {m_warmupMutex};
+    if (m_warmupSample.size() < WARMUP_SAMPLE_SIZE)
+    {
+        m_warmupSample.emplace_back(std::move(copy));
+    }
+    else
+    {
+        m_warmupSample[m_warmupNext] = std::move(copy);
+        m_warmupNext = (m_warmupNext + 1) % WARMUP_SAMPLE_SIZE;
+    }
+}
+
+void Router::warmup(const std::shared_ptr<Environment>& environment) const
+{
+    // Replay copies so the sample stays intact for the next deploy
+    std::vector<base::Event> sample;
+    {
+        std::lock_guard lock {m_warmupMutex};
+        sample.reserve(m_warmupSample.size());
+        for (const auto& event : m_warmupSample)
+        {
+            sample.emplace_back(std::make_shared<json::Json>(*event));
+        }
+    }
+
+    if (sample.empty())
+    {
+        return;
+    }
+
+    // The guard makes output stages discard their publications
+    base::warmup::Scope guard {};
+    for (auto& event : sample)
+    {
+        try
+        {
+            if (environment->isAccepted(event))
+            {
+                environment->ingestGet(std::move(event));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            LOG_DEBUG("Router: Warm-up replay discarded an event: {}", e.what());
+        }
+    }
+}
+
+void Router::ingest(base::Event&& event)
+{
+    sampleForWarmup(event);
+
+    // Resolve the route against the last published snapshot instead of locking the
+    // table, so route management never stalls the data path.
+    const auto snapshot = std::atomic_load(&m_snapshot);
+
+    // Read the sampled ingress timestamp before the event is consumed by the
+    // environment, which erases it before indexing.
+    const auto ingressNs =
+        m_completionLatency ? event->getIntAsInt64(base::event::ingressTimestampPath()) : std::nullopt;
+
+    const auto nowNs = []()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    };
+
+#ifdef ENGINE_STAGE_TIMING
+    // Stage boundaries are only timed on the sampled events that carry the ingress
+    // stamp; the rest of the traffic pays no extra clock read.
+    const int64_t pickupNs = ingressNs ? nowNs() : 0;
+#endif
+
+    for (const auto& environment : *snapshot)
+    {
+        if (environment->isAccepted(event))
+        {
+#ifdef ENGINE_STAGE_TIMING
+            const int64_t routedNs = ingressNs ? nowNs() : 0;
+#endif
+            environment->ingest(std::move(event));
             event = nullptr;
+
+            if (ingressNs)
+            {
+                const auto completedNs = nowNs();
+                if (completedNs > ingressNs.value())
+                {
+                    m_completionLatency->update(static_cast<uint64_t>(completedNs - ingressNs.value()) / 1000);
+                }
+
+#ifdef ENGINE_STAGE_TIMING
+                const auto stageSnapshot = std::atomic_load(&m_stageSnapshot);
+                if (stageSnapshot)
+                {
+                    const auto it = stageSnapshot->find(environment.get());
+                    if (it != stageSnapshot->end())
+                    {
+                        auto record =
+                            [](const std::shared_ptr<metrics::IMetric>& metric, int64_t fromNs, int64_t toNs)
+                        {
+                            if (metric && toNs > fromNs)
+                            {
+                                metric->update(static_cast<uint64_t>(toNs - fromNs) / 1000);
+                            }
+                        };
+
+                        const auto& stage = it->second;
+                        record(stage.queue, ingressNs.value(), pickupNs);
+                        record(stage.route, pickupNs, routedNs);
+                        record(stage.process, routedNs, completedNs);
+                        record(stage.complete, ingressNs.value(), completedNs);
+                    }
+                }
+#endif
+            }
             break;
         }
     }
@@ -186,4 +462,61 @@ void Router::ingest(base::Event&& event)
     }
 }
 
+void Router::ingestBatch(std::vector<base::Event>& events)
+{
+    // One snapshot load for the whole bundle.
+    const auto snapshot = std::atomic_load(&m_snapshot);
+
+    // Buckets parallel to the snapshot, so the per-environment batch passes keep the
+    // queue order of the events they received.
+    std::vector<std::vector<base::Event>> buckets {snapshot->size()};
+
+    for (auto& event : events)
+    {
+        if (event == nullptr)
+        {
+            continue;
+        }
+
+        // Sampled events carrying the ingress stamp take the per-event path, which owns
+        // the completion latency and stage timing records.
+        if (m_completionLatency && event->exists(base::event::ingressTimestampPath()))
+        {
+            ingest(std::move(event));
+            event = nullptr;
+            continue;
+        }
+
+        sampleForWarmup(event);
+
+        bool routed = false;
+        for (std::size_t i = 0; i < snapshot->size(); ++i)
+        {
+            if ((*snapshot)[i]->isAccepted(event))
+            {
+                buckets[i].emplace_back(std::move(event));
+                event = nullptr;
+                routed = true;
+                break;
+            }
+        }
+
+        if (!routed)
+        {
+            LOG_WARNING("Event not processed: {}", event->str());
+            event = nullptr;
+        }
+    }
+
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        if (!buckets[i].empty())
+        {
+            (*snapshot)[i]->ingestBatch(buckets[i]);
+        }
+    }
+
+    events.clear();
+}
+
 } // namespace router
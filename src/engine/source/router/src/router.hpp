@@ -1,10 +1,16 @@
 #ifndef _ROUTER_ROUTER_HPP
 #define _ROUTER_ROUTER_HPP
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <builder/ibuilder.hpp>
+#include <metrics/imetric.hpp>
 
 #include "irouter.hpp"
 #include "table.hpp"
@@ -21,21 +27,98 @@ private:
     class RuntimeEntry : public prod::Entry
     {
     private:
-        std::unique_ptr<Environment> m_env; ///< The environment associated with the entry.
+        std::shared_ptr<Environment> m_env; ///< The environment associated with the entry.
 
     public:
         explicit RuntimeEntry(const prod::EntryPost& entry)
             : prod::Entry(entry) {};
 
-        const std::unique_ptr<Environment>& environment() const { return m_env; }
-        std::unique_ptr<Environment>& environment() { return m_env; }
+        const std::shared_ptr<Environment>& environment() const { return m_env; }
+        std::shared_ptr<Environment>& environment() { return m_env; }
     };
 
+    /// Environments of the enabled entries, in priority order.
+    using Snapshot = std::vector<std::shared_ptr<Environment>>;
+
     internal::Table<RuntimeEntry> m_table; ///< Internal table for managing Production Environments.
     mutable std::shared_mutex m_mutex;     ///< Mutex for the table.
 
+    /**
+     * @brief Immutable dispatch snapshot, swapped atomically after every table mutation.
+     * ingest() resolves routes against the snapshot without taking m_mutex, so a route
+     * update never blocks the data path. Environments are shared so an in-flight event
+     * keeps its environment alive while a newer snapshot replaces it.
+     */
+    std::shared_ptr<const Snapshot> m_snapshot;
+
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Environment builder for create new entries
 
+    std::shared_ptr<metrics::IMetric> m_completionLatency; ///< Ingress to completion latency of sampled events
+
+#ifdef ENGINE_STAGE_TIMING
+    /**
+     * @brief Per-route stage histograms, recorded for the sampled events carrying the
+     * ingress stamp: wait in the event queue, route resolution, pipeline run in the
+     * backend controller, and ingress to completion.
+     */
+    struct StageMetrics
+    {
+        std::shared_ptr<metrics::IMetric> queue;
+        std::shared_ptr<metrics::IMetric> route;
+        std::shared_ptr<metrics::IMetric> process;
+        std::shared_ptr<metrics::IMetric> complete;
+    };
+
+    /// Stage histograms of the published environments. Swapped together with the
+    /// dispatch snapshot, so ingest() reads them without taking m_mutex.
+    using StageSnapshot = std::unordered_map<const Environment*, StageMetrics>;
+
+    std::shared_ptr<const StageSnapshot> m_stageSnapshot;
+    std::map<std::string, StageMetrics> m_stageByRoute; ///< Registered histograms by route. Guarded by m_mutex.
+
+    /**
+     * @brief Get or register the stage histograms of a route. Must be called with
+     * m_mutex held exclusively.
+     */
+    const StageMetrics& stageMetricsFor(const std::string& route);
+#endif
+
+    /// Warm-up sample: 1 of every WARMUP_SAMPLE_EVERY ingested events is copied into a
+    /// ring of WARMUP_SAMPLE_SIZE entries and replayed through freshly built
+    /// environments before they serve traffic, so the first real events do not pay the
+    /// cache-cold cost of a policy deploy.
+    constexpr static std::size_t WARMUP_SAMPLE_SIZE = 32;
+    constexpr static std::size_t WARMUP_SAMPLE_EVERY = 256;
+
+    std::vector<base::Event> m_warmupSample; ///< Ring of copies of recent events
+    std::size_t m_warmupNext {0};            ///< Next ring slot to replace
+    std::size_t m_ingestCounter {0};         ///< Ingested events, picks the sampled ones
+    mutable std::mutex m_warmupMutex;        ///< Guards the ring (worker thread vs API thread)
+
+    /**
+     * @brief Copy the event into the warm-up ring if it falls on the sampling stride.
+     * Called from the worker thread only.
+     */
+    void sampleForWarmup(const base::Event& event);
+
+    /**
+     * @brief Replay copies of the sampled events through the environment, discarding
+     * outputs, so its caches and branch history are warm before it serves traffic.
+     */
+    void warmup(const std::shared_ptr<Environment>& environment) const;
+
+    /**
+     * @brief Register (or share) the completion latency histogram. Null when the metrics
+     * manager is not instantiated (standalone tools and tests).
+     */
+    void initMetrics();
+
+    /**
+     * @brief Rebuild the dispatch snapshot from the table and publish it atomically.
+     * Must be called with m_mutex held exclusively.
+     */
+    void publishSnapshot();
+
 public:
     /**
      * @brief Constructs a Router with the specified environment builder.
@@ -44,7 +127,11 @@ public:
     Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder)
         : m_table()
         , m_mutex()
-        , m_envBuilder(envBuilder) {};
+        , m_snapshot(std::make_shared<const Snapshot>())
+        , m_envBuilder(envBuilder)
+    {
+        initMetrics();
+    };
 
     /**
      * @brief Constructs a Router with the specified builder.
@@ -53,7 +140,11 @@ public:
     Router(const std::weak_ptr<builder::IBuilder>& builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
         : m_table()
         , m_mutex()
-        , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker)) {};
+        , m_snapshot(std::make_shared<const Snapshot>())
+        , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker))
+    {
+        initMetrics();
+    };
 
     /**
      * @copydoc IRouter::addEntry
@@ -90,10 +181,35 @@ public:
      */
     base::RespOrError<prod::Entry> getEntry(const std::string& name) const override;
 
+    /**
+     * @copydoc IRouter::activateProfiler
+     */
+    base::OptError activateProfiler(const std::string& name, bool activate) override;
+
+    /**
+     * @copydoc IRouter::dumpProfile
+     */
+    base::RespOrError<std::string> dumpProfile(const std::string& name) const override;
+
+    /**
+     * @copydoc IRouter::dumpMemory
+     */
+    base::RespOrError<std::string> dumpMemory() const override;
+
     /**
      * @copydoc IRouter::ingest
      */
     void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc IRouter::ingestBatch
+     *
+     * Events are bucketed by the first accepting environment and each bucket is handed
+     * to its environment in one batch pass, so the per-event dispatch cost of the
+     * backend amortizes over the bundle. Sampled events carrying the ingress stamp take
+     * the per-event path so the latency and stage metrics keep their meaning.
+     */
+    void ingestBatch(std::vector<base::Event>& events) override;
 };
 
 } // namespace router
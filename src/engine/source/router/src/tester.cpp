@@ -193,9 +193,9 @@ base::RespOrError<test::Output> Tester::ingestTest(base::Event&& event, const te
     auto result = std::make_shared<test::InternalOutput>();
     for (const auto& asset : opt.assets())
     {
-        bk::Subscriber subFn = [asset, result, level = opt.traceLevel()](const std::string& trace, bool success) -> void
+        bk::Subscriber subFn = [asset, result, level = opt.traceLevel()](std::string_view trace, bool success) -> void
         {
-            result->addTrace(asset, trace, success, level);
+            result->addTrace(asset, std::string {trace}, success, level);
         };
         auto err = entry.controller()->subscribe(asset, subFn);
         if (base::isError(err))
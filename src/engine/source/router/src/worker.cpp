@@ -1,5 +1,11 @@
 #include "worker.hpp"
 
+#ifdef __linux__
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <base/logging.hpp>
 
 namespace router
@@ -18,11 +24,46 @@ void Worker::start(const EpsLimit& epsLimit)
         {
             std::size_t tID = std::hash<std::thread::id> {}(std::this_thread::get_id());
             LOG_DEBUG_L(functionName.c_str(), "Router Worker {} started", tID);
+
+            std::vector<base::Event> batch;
+            batch.reserve(BULK_DEQUEUE_SIZE);
+
+            while (m_isRunning)
+            {
+                // Process production queue in bulk, amortizing the queue
+                // synchronization over every event of the batch
+                batch.clear();
+                if (!epsLimit() && m_rQueue->waitPopBulk(batch, BULK_DEQUEUE_SIZE, WAIT_DEQUEUE_TIMEOUT_USEC) > 0)
+                {
+                    // The EPS counter accounts one event per call; the batch is
+                    // already dequeued, so events past the limit are still
+                    // processed and the limit applies before the next pop.
+                    for (std::size_t i = 1; i < batch.size(); ++i)
+                    {
+                        epsLimit();
+                    }
+
+                    // The whole bundle goes down in one call so the router can hand it
+                    // to the matched environments in batch passes.
+                    m_router->ingestBatch(batch);
+                }
+            }
+            LOG_DEBUG_L(functionName.c_str(), "Router Worker {} finished", tID);
+        });
+
+    // Test sessions run on a dedicated lane: the production loop never touches the
+    // test queue, and the test thread is scheduled at idle priority so a debug
+    // session with full tracing cannot steal cycles from routing under load.
+    m_testThread = std::thread(
+        [this, functionName = logging::getLambdaName(__FUNCTION__, "testerWorkerThread")]()
+        {
+            std::size_t tID = std::hash<std::thread::id> {}(std::this_thread::get_id());
+            LOG_DEBUG_L(functionName.c_str(), "Tester Worker {} started", tID);
+
             while (m_isRunning)
             {
-                // Process test queue
                 test::QueueType testEvent {};
-                if (m_tQueue->tryPop(testEvent) && testEvent != nullptr)
+                if (m_tQueue->waitPop(testEvent, WAIT_DEQUEUE_TIMEOUT_USEC) && testEvent != nullptr)
                 {
                     auto& [event, opt, callback] = *testEvent;
                     auto output = m_tester->ingestTest(std::move(event), opt);
@@ -35,16 +76,46 @@ void Worker::start(const EpsLimit& epsLimit)
                         LOG_ERROR_L(functionName.c_str(), "Error when executing API callback: ", e.what());
                     }
                 }
-
-                // Process production queue
-                base::Event event {};
-                if (!epsLimit() && m_rQueue->waitPop(event, WAIT_DEQUEUE_TIMEOUT_USEC) && event != nullptr)
-                {
-                    m_router->ingest(std::move(event));
-                }
             }
-            LOG_DEBUG_L(functionName.c_str(), "Router Worker {} finished", tID);
+            LOG_DEBUG_L(functionName.c_str(), "Tester Worker {} finished", tID);
         });
+
+#ifdef __linux__
+    // SCHED_IDLE bounds the CPU budget of test sessions: the kernel only runs the
+    // thread when no production worker is runnable.
+    sched_param idleParam {};
+    const auto error = pthread_setschedparam(m_testThread.native_handle(), SCHED_IDLE, &idleParam);
+    if (error != 0)
+    {
+        LOG_WARNING("Tester Worker could not be set to idle scheduling: {}", strerror(error));
+    }
+#endif
+}
+
+void Worker::pinToCore(std::size_t coreId)
+{
+    if (!m_isRunning)
+    {
+        return;
+    }
+
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(coreId % std::thread::hardware_concurrency(), &cpuSet);
+
+    const auto error = pthread_setaffinity_np(m_thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+    if (error != 0)
+    {
+        LOG_WARNING("Router Worker could not be pinned to core {}: {}", coreId, strerror(error));
+    }
+    else
+    {
+        LOG_DEBUG("Router Worker pinned to core {}", coreId);
+    }
+#else
+    LOG_DEBUG("Worker core pinning is not supported on this platform");
+#endif
 }
 
 void Worker::stop()
@@ -59,5 +130,9 @@ void Worker::stop()
     {
         m_thread.join();
     }
+    if (m_testThread.joinable())
+    {
+        m_testThread.join();
+    }
 }
 }; // namespace router
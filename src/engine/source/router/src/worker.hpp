@@ -18,6 +18,7 @@ namespace router
 {
 
 constexpr auto WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000;
+constexpr std::size_t BULK_DEQUEUE_SIZE = 64; ///< Max events popped from the production queue per iteration
 
 class Worker : public IWorker
 {
@@ -26,6 +27,7 @@ private:
     std::shared_ptr<ITester> m_tester; ///< The tester instance
     std::atomic_bool m_isRunning;      ///< Flag to know if the worker is running
     std::thread m_thread;              ///< The thread for the worker
+    std::thread m_testThread;          ///< Low-priority thread serving test sessions
 
     std::shared_ptr<base::queue::iQueue<base::Event>> m_rQueue;     ///< The router queue
     std::shared_ptr<base::queue::iQueue<test::QueueType>> m_tQueue; ///< The tester queue
@@ -42,6 +44,7 @@ public:
         , m_tester(std::make_shared<Tester>(envBuilder))
         , m_isRunning(false)
         , m_thread()
+        , m_testThread()
         , m_rQueue(rQueue)
         , m_tQueue(tQueue)
     {
@@ -58,6 +61,11 @@ public:
      */
     void start(const EpsLimit& epsLimit) override;
 
+    /**
+     * @copydoc IWorker::pinToCore
+     */
+    void pinToCore(std::size_t coreId) override;
+
     /**
      * @copydoc IWorker::stop
      */
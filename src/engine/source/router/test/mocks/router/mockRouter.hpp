@@ -21,6 +21,9 @@ public:
     MOCK_METHOD(base::OptError, changeEpsSettings, (uint eps, uint refreshInterval), (override));
     MOCK_METHOD((base::RespOrError<std::tuple<uint, uint, bool>>), getEpsSettings, (), (const, override));
     MOCK_METHOD(base::OptError, activateEpsCounter, (bool activate), (override));
+    MOCK_METHOD(base::OptError, activateProfiler, (const std::string& name, bool activate), (override));
+    MOCK_METHOD(base::RespOrError<std::string>, getProfile, (const std::string& name), (const, override));
+    MOCK_METHOD(base::RespOrError<std::string>, getMemory, (), (const, override));
 };
 
 } // namespace router::mocks
@@ -6,9 +6,11 @@
 
 #include <router/orchestrator.hpp>
 
+#include "epsCounter.hpp"
 #include "mockRouter.hpp"
 #include "mockTester.hpp"
 #include "mockWorker.hpp"
+#include "overloadGovernor.hpp"
 
 using namespace router;
 
@@ -52,6 +54,25 @@ public:
         m_eventQueue = m_mockEventQueue;
     };
 
+    std::vector<std::shared_ptr<queue::mocks::MockQueue<base::Event>>> m_mockWorkerQueues;
+
+    /// Three worker queues partitioned as acme -> {0}, globex -> {1}, shared -> {2}.
+    /// Single-queue lanes make the dispatch target deterministic.
+    void setupTenantLanes()
+    {
+        for (auto i = 0; i < 3; ++i)
+        {
+            auto workerQueue = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+            m_workerQueues.emplace_back(workerQueue);
+            m_mockWorkerQueues.emplace_back(std::move(workerQueue));
+        }
+        m_tenantKeyPath = json::CompiledPath {"/tenant"};
+        m_tenantLanes.emplace("acme", TenantLane {0, 1});
+        m_tenantLanes.emplace("globex", TenantLane {1, 1});
+        m_sharedLane = TenantLane {2, 1};
+        m_tenantDispatch = true;
+    }
+
     auto forEachWorkerMock(std::function<void(std::shared_ptr<MockWorker>)> func)
     {
         for (auto& mock : m_mocks)
@@ -93,6 +114,49 @@ public:
             .WillOnce(::testing::Return(store::mocks::storeOk()));
     }
 
+    void enableSnapshots() { m_snapshotInterval = 60; }
+
+    /// Governor with the default thresholds and a hold of 1 sample, so each tick
+    /// can move one level and the expectations stay deterministic
+    void enableGovernor(std::function<void(bool)> shedActuator)
+    {
+        m_governorInterval = 250;
+        m_governor = std::make_shared<OverloadGovernor>(75, 50, 90, 60, 1);
+        m_shedActuator = std::move(shedActuator);
+        m_epsCounter = std::make_shared<EpsCounter>();
+    }
+
+    void tickGovernor() { governorTick(); }
+
+    void activateEps() { m_epsCounter->start(); }
+
+    bool epsActive() const { return m_epsCounter->isActive(); }
+
+    void expectDumpSnapshot()
+    {
+        if (m_mocks.empty() || m_mocks.front() == nullptr || m_workers.empty() || m_workers.front() == nullptr)
+        {
+            FAIL() << "No mock worker";
+        }
+
+        auto testerMock = std::make_shared<MockTester>();
+        auto itesterMock = std::static_pointer_cast<router::ITester>(testerMock);
+        auto routerMock = std::make_shared<MockRouter>();
+        auto irouterMock = std::static_pointer_cast<router::IRouter>(routerMock);
+
+        auto& firstWorkerMock = m_mocks.front();
+        EXPECT_CALL(*firstWorkerMock, getTester()).WillOnce(testing::ReturnRefOfCopy(itesterMock));
+        EXPECT_CALL(*firstWorkerMock, getRouter()).WillOnce(testing::ReturnRefOfCopy(irouterMock));
+        EXPECT_CALL(*testerMock, getEntries()).WillOnce(testing::Return(std::list<test::Entry> {}));
+        EXPECT_CALL(*routerMock, getEntries()).WillOnce(testing::Return(std::list<prod::Entry> {}));
+
+        EXPECT_CALL(*m_mockEventQueue, size()).WillOnce(testing::Return(0));
+        EXPECT_CALL(*m_mockEventQueue, aproxFreeSlots()).WillOnce(testing::Return(0));
+
+        EXPECT_CALL(*(m_mockstore), upsertInternalDoc(base::Name {STORE_PATH_SNAPSHOT}, testing::_))
+            .WillOnce(::testing::Return(store::mocks::storeOk()));
+    }
+
     void expectPostEntryAddEntryFailture()
     {
         if (m_mocks.empty() || m_mocks.front() == nullptr || m_workers.empty() || m_workers.front() == nullptr)
@@ -632,6 +696,64 @@ TEST_F(OrchestratorTest, stop)
     ASSERT_NO_THROW(m_orchestrator->stop());
 }
 
+TEST_F(OrchestratorTest, stopDumpsWarmSnapshot)
+{
+    // With snapshots enabled the clean shutdown writes the consolidated state
+    m_orchestrator->enableSnapshots();
+    m_orchestrator->expectDumpTester();
+    m_orchestrator->expectDumpSnapshot();
+    m_orchestrator->forEachWorkerMock([](auto mockWorker) { EXPECT_CALL(*mockWorker, stop()).Times(1); });
+
+    ASSERT_NO_THROW(m_orchestrator->stop());
+}
+
+TEST_F(OrchestratorTest, governorTickCoordinatesSheddingAndAdmission)
+{
+    std::vector<bool> shedCalls {};
+    m_orchestrator->enableGovernor([&shedCalls](bool engaged) { shedCalls.push_back(engaged); });
+
+    // Saturated queue: the first tick engages shedding, the second escalates to
+    // EPS admission control on top of it
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, size()).WillRepeatedly(testing::Return(95));
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, aproxFreeSlots()).WillRepeatedly(testing::Return(5));
+    m_orchestrator->tickGovernor();
+    ASSERT_EQ(shedCalls, std::vector<bool> {true});
+    EXPECT_FALSE(m_orchestrator->epsActive());
+
+    m_orchestrator->tickGovernor();
+    ASSERT_EQ(shedCalls, std::vector<bool> {true}); // Still engaged, not re-applied
+    EXPECT_TRUE(m_orchestrator->epsActive());
+
+    // Calm queue: admission is released first, then the lane is restored
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, size()).WillRepeatedly(testing::Return(10));
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, aproxFreeSlots()).WillRepeatedly(testing::Return(90));
+    m_orchestrator->tickGovernor();
+    EXPECT_FALSE(m_orchestrator->epsActive());
+    ASSERT_EQ(shedCalls, std::vector<bool> {true});
+
+    m_orchestrator->tickGovernor();
+    ASSERT_EQ(shedCalls, (std::vector<bool> {true, false}));
+}
+
+TEST_F(OrchestratorTest, governorLeavesOperatorEpsActivationAlone)
+{
+    m_orchestrator->enableGovernor([](bool) {});
+    m_orchestrator->activateEps(); // As an operator would, before the storm
+
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, size()).WillRepeatedly(testing::Return(95));
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, aproxFreeSlots()).WillRepeatedly(testing::Return(5));
+    m_orchestrator->tickGovernor();
+    m_orchestrator->tickGovernor();
+    EXPECT_TRUE(m_orchestrator->epsActive());
+
+    // De-escalation must not release an activation the governor did not make
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, size()).WillRepeatedly(testing::Return(10));
+    EXPECT_CALL(*m_orchestrator->m_mockEventQueue, aproxFreeSlots()).WillRepeatedly(testing::Return(90));
+    m_orchestrator->tickGovernor();
+    m_orchestrator->tickGovernor();
+    EXPECT_TRUE(m_orchestrator->epsActive());
+}
+
 TEST_F(OrchestratorTest, entryPostPolicyNameEmptyFailture)
 {
     EXPECT_TRUE(m_orchestrator->postTestEntry(test::EntryPost {"test", base::Name {}, 0}).has_value());
@@ -882,3 +1004,39 @@ TEST_F(OrchestratorTest, entriesGetSuccessRouter)
     m_orchestrator->expectGetEntriesSuccessRouter();
     EXPECT_FALSE(m_orchestrator->getEntries().empty());
 }
+
+/**************************************************************************
+ * TENANT DISPATCH
+ *************************************************************************/
+
+TEST_F(OrchestratorTest, tenantDispatchRoutesToDedicatedLane)
+{
+    m_orchestrator->setupTenantLanes();
+
+    for (const auto& workerQueue : m_orchestrator->m_mockWorkerQueues)
+    {
+        EXPECT_CALL(*workerQueue, size()).WillRepeatedly(testing::Return(0));
+    }
+    EXPECT_CALL(*m_orchestrator->m_mockWorkerQueues[0], push(testing::_)).Times(1);
+    EXPECT_CALL(*m_orchestrator->m_mockWorkerQueues[1], push(testing::_)).Times(1);
+    EXPECT_CALL(*m_orchestrator->m_mockWorkerQueues[2], push(testing::_)).Times(0);
+
+    m_orchestrator->postEvent(std::make_shared<json::Json>(R"({"tenant":"acme"})"));
+    m_orchestrator->postEvent(std::make_shared<json::Json>(R"({"tenant":"globex"})"));
+}
+
+TEST_F(OrchestratorTest, tenantDispatchUnknownTenantSharesRemainder)
+{
+    m_orchestrator->setupTenantLanes();
+
+    for (const auto& workerQueue : m_orchestrator->m_mockWorkerQueues)
+    {
+        EXPECT_CALL(*workerQueue, size()).WillRepeatedly(testing::Return(0));
+    }
+    EXPECT_CALL(*m_orchestrator->m_mockWorkerQueues[0], push(testing::_)).Times(0);
+    EXPECT_CALL(*m_orchestrator->m_mockWorkerQueues[1], push(testing::_)).Times(0);
+    EXPECT_CALL(*m_orchestrator->m_mockWorkerQueues[2], push(testing::_)).Times(2);
+
+    m_orchestrator->postEvent(std::make_shared<json::Json>(R"({"tenant":"unknown"})"));
+    m_orchestrator->postEvent(std::make_shared<json::Json>(R"({"message":"no tenant field"})"));
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <router/orchestrator.hpp>
+
+#include "overloadGovernor.hpp"
+
+class G : public router::Orchestrator
+{
+public:
+    using OverloadGovernor = Orchestrator::OverloadGovernor;
+};
+
+using Level = G::OverloadGovernor::Level;
+
+// Defaults: shed 75/50, limit 90/60, hold 4
+constexpr uint HOLD = router::DEFAULT_GOVERNOR_HOLD;
+
+TEST(OverloadGovernor, BuildsDefault)
+{
+    auto governor = G::OverloadGovernor();
+    EXPECT_EQ(governor.level(), Level::STEADY);
+    EXPECT_EQ(governor.shedEngagements(), 0);
+    EXPECT_EQ(governor.limitEngagements(), 0);
+    EXPECT_STREQ(governor.levelName(), "steady");
+}
+
+TEST(OverloadGovernor, BuildsError)
+{
+    // Enter thresholds out of (0, 100]
+    EXPECT_THROW(G::OverloadGovernor(0, 0, 90, 60), std::runtime_error);
+    EXPECT_THROW(G::OverloadGovernor(101, 50, 90, 60), std::runtime_error);
+    EXPECT_THROW(G::OverloadGovernor(75, 50, 101, 60), std::runtime_error);
+    // Exit not below enter
+    EXPECT_THROW(G::OverloadGovernor(75, 75, 90, 60), std::runtime_error);
+    EXPECT_THROW(G::OverloadGovernor(75, 50, 90, 90), std::runtime_error);
+    // Shedding thresholds above the limiting ones
+    EXPECT_THROW(G::OverloadGovernor(95, 50, 90, 60), std::runtime_error);
+    EXPECT_THROW(G::OverloadGovernor(75, 70, 90, 60), std::runtime_error);
+    // Hold of zero samples
+    EXPECT_THROW(G::OverloadGovernor(75, 50, 90, 60, 0), std::runtime_error);
+}
+
+TEST(OverloadGovernor, EngagesSheddingAfterHold)
+{
+    auto governor = G::OverloadGovernor();
+
+    // The threshold must hold for HOLD consecutive samples
+    for (uint i = 0; i < HOLD - 1; ++i)
+    {
+        EXPECT_EQ(governor.sample(80, 100), Level::STEADY);
+    }
+    EXPECT_EQ(governor.sample(80, 100), Level::SHEDDING);
+    EXPECT_EQ(governor.shedEngagements(), 1);
+    EXPECT_STREQ(governor.levelName(), "shedding");
+}
+
+TEST(OverloadGovernor, SpikeDoesNotEngage)
+{
+    auto governor = G::OverloadGovernor();
+
+    // A streak broken by one calm sample starts over
+    for (uint i = 0; i < HOLD - 1; ++i)
+    {
+        EXPECT_EQ(governor.sample(80, 100), Level::STEADY);
+    }
+    EXPECT_EQ(governor.sample(10, 100), Level::STEADY);
+    for (uint i = 0; i < HOLD - 1; ++i)
+    {
+        EXPECT_EQ(governor.sample(80, 100), Level::STEADY);
+    }
+    EXPECT_EQ(governor.sample(80, 100), Level::SHEDDING);
+}
+
+TEST(OverloadGovernor, HysteresisBandHoldsTheLevel)
+{
+    auto governor = G::OverloadGovernor();
+    for (uint i = 0; i < HOLD; ++i)
+    {
+        governor.sample(80, 100);
+    }
+    ASSERT_EQ(governor.level(), Level::SHEDDING);
+
+    // Between the exit (50) and enter (75) watermarks nothing moves, so a load
+    // hovering around one boundary cannot toggle the reaction
+    for (uint i = 0; i < HOLD * 4; ++i)
+    {
+        EXPECT_EQ(governor.sample(60, 100), Level::SHEDDING);
+    }
+    EXPECT_EQ(governor.shedEngagements(), 1);
+}
+
+TEST(OverloadGovernor, EscalatesToLimitingOneStepAtATime)
+{
+    auto governor = G::OverloadGovernor();
+
+    // Saturation walks STEADY -> SHEDDING -> LIMITING, one hold per step
+    for (uint i = 0; i < HOLD; ++i)
+    {
+        governor.sample(100, 100);
+    }
+    EXPECT_EQ(governor.level(), Level::SHEDDING);
+    for (uint i = 0; i < HOLD; ++i)
+    {
+        governor.sample(100, 100);
+    }
+    EXPECT_EQ(governor.level(), Level::LIMITING);
+    EXPECT_EQ(governor.shedEngagements(), 1);
+    EXPECT_EQ(governor.limitEngagements(), 1);
+    EXPECT_STREQ(governor.levelName(), "limiting");
+}
+
+TEST(OverloadGovernor, DeescalatesThroughShedding)
+{
+    auto governor = G::OverloadGovernor();
+    for (uint i = 0; i < HOLD * 2; ++i)
+    {
+        governor.sample(100, 100);
+    }
+    ASSERT_EQ(governor.level(), Level::LIMITING);
+
+    // Below the limiting exit (60) but above the shedding exit (50): admission is
+    // released while the shedding stays engaged
+    for (uint i = 0; i < HOLD; ++i)
+    {
+        governor.sample(55, 100);
+    }
+    EXPECT_EQ(governor.level(), Level::SHEDDING);
+    for (uint i = 0; i < HOLD * 4; ++i)
+    {
+        governor.sample(55, 100);
+    }
+    EXPECT_EQ(governor.level(), Level::SHEDDING);
+
+    // Calm traffic releases the shedding as well
+    for (uint i = 0; i < HOLD; ++i)
+    {
+        governor.sample(10, 100);
+    }
+    EXPECT_EQ(governor.level(), Level::STEADY);
+}
+
+TEST(OverloadGovernor, ReengagementIsCounted)
+{
+    auto governor = G::OverloadGovernor();
+    for (uint round = 0; round < 3; ++round)
+    {
+        for (uint i = 0; i < HOLD; ++i)
+        {
+            governor.sample(80, 100);
+        }
+        for (uint i = 0; i < HOLD; ++i)
+        {
+            governor.sample(10, 100);
+        }
+    }
+    EXPECT_EQ(governor.level(), Level::STEADY);
+    EXPECT_EQ(governor.shedEngagements(), 3);
+    EXPECT_EQ(governor.limitEngagements(), 0);
+}
+
+TEST(OverloadGovernor, IgnoresEmptyCapacity)
+{
+    auto governor = G::OverloadGovernor();
+    for (uint i = 0; i < HOLD * 2; ++i)
+    {
+        EXPECT_EQ(governor.sample(100, 0), Level::STEADY);
+    }
+}
+
+TEST(OverloadGovernor, OverfullQueueCountsAsSaturated)
+{
+    auto governor = G::OverloadGovernor();
+
+    // size_approx can transiently exceed the capacity
+    for (uint i = 0; i < HOLD; ++i)
+    {
+        governor.sample(120, 100);
+    }
+    EXPECT_EQ(governor.level(), Level::SHEDDING);
+}
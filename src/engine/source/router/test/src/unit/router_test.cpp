@@ -371,3 +371,57 @@ TEST_F(RouterTest, IngestSuccess)
 
     EXPECT_TRUE(ingestEvent());
 }
+
+TEST_F(RouterTest, DumpMemoryReportsRoutes)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    auto result = m_router->dumpMemory();
+    ASSERT_FALSE(base::isError(result));
+    EXPECT_NE(base::getResponse(result).find(ENVIRONMENT_NAME), std::string::npos);
+}
+
+TEST_F(RouterTest, IngestBatchDispatchesBucketInOneCall)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+    enableEntry(ENVIRONMENT_NAME);
+
+    std::size_t batchedEvents = 0;
+    EXPECT_CALL(*m_mockController, ingestBatch(testing::_))
+        .WillOnce(testing::Invoke([&batchedEvents](std::vector<base::Event>& events)
+                                  { batchedEvents = events.size(); }));
+
+    std::vector<base::Event> batch;
+    batch.emplace_back(std::make_shared<json::Json>(R"({"key": "value"})"));
+    batch.emplace_back(std::make_shared<json::Json>(R"({"key": "other"})"));
+    m_router->ingestBatch(batch);
+
+    EXPECT_EQ(batchedEvents, 2);
+    EXPECT_TRUE(batch.empty());
+}
+
+TEST_F(RouterTest, IngestDisabledEntryNotDispatched)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(0);
+
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    m_router->ingest(std::move(event));
+}
+
+TEST_F(RouterTest, IngestAfterRemoveEntryNotDispatched)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+    enableEntry(ENVIRONMENT_NAME);
+    removeEntry(ENVIRONMENT_NAME);
+
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(0);
+
+    auto event = std::make_shared<json::Json>(R"({"key": "value"})");
+    m_router->ingest(std::move(event));
+}
@@ -3,7 +3,9 @@
 
 #include <experimental/propagate_const>
 #include <map>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 
 #include <schemf/field.hpp>
 #include <schemf/ischema.hpp>
@@ -18,12 +20,47 @@ namespace schemf
 class Schema final : public IValidator
 {
 private:
+    /**
+     * @brief Compiled resolution of a field path, the flat result of walking the field graph.
+     */
+    struct Resolution
+    {
+        bool exists;  ///< Whether the path is a schema field.
+        Type type;    ///< Type of the field, meaningful only when the field exists.
+        bool isArray; ///< Whether the field is an array, meaningful only when the field exists.
+    };
+
     std::map<std::string, Field> m_fields; ///< First level fields of the schema.
     class Validator;
     std::experimental::propagate_const<std::unique_ptr<Validator>> m_validator;
 
+    mutable std::shared_mutex m_resolvedMutex;                 ///< Protects the resolution cache.
+    mutable std::unordered_map<size_t, Resolution> m_resolved; ///< Compiled resolutions by interned DotPath id.
+
     Field get(const DotPath& name) const;
 
+    /**
+     * @brief Walk the field graph checking if a field exists.
+     *
+     * @param name Dot-separated path to the field.
+     * @return Whether the field exists.
+     *
+     * @throw std::runtime_error If an intermediate field of a schema parent does not exist.
+     */
+    bool walkHasField(const DotPath& name) const;
+
+    /**
+     * @brief Resolve a field path, walking the field graph only the first time the path is seen.
+     *
+     * Resolutions are cached by interned DotPath id, so the frequent validations of the same
+     * paths during catalog reloads and tester runs become flat lookups. The cache is discarded
+     * whenever the schema is modified.
+     *
+     * @param name Dot-separated path to the field.
+     * @return Resolution Flat resolution of the path.
+     */
+    Resolution resolve(const DotPath& name) const;
+
     /**
      * @brief Convert a field JSON entry to a Schema Field object.
      *
@@ -71,12 +108,12 @@ public:
     /**
      * @copydoc ISchema::getType
      */
-    inline Type getType(const DotPath& name) const override { return get(name).type(); }
+    Type getType(const DotPath& name) const override;
 
     /**
      * @copydoc ISchema::getJsonType
      */
-    inline json::Json::Type getJsonType(const DotPath& name) const override { return typeToJType(get(name).type()); }
+    inline json::Json::Type getJsonType(const DotPath& name) const override { return typeToJType(getType(name)); }
 
     /**
      * @copydoc ISchema::hasField
@@ -86,7 +123,7 @@ public:
     /**
      * @copydoc ISchema::isArray
      */
-    inline bool isArray(const DotPath& name) const override { return get(name).isArray(); }
+    bool isArray(const DotPath& name) const override;
 
     /**
      * @brief Load a schema from a JSON object, adding each field to the schema.
@@ -1,6 +1,8 @@
 #include "schema.hpp"
 #include "validator.hpp"
 
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
 
 #include <fmt/format.h>
@@ -22,6 +24,12 @@ void Schema::addField(const DotPath& name, const Field& field)
         throw std::invalid_argument("name cannot be empty");
     }
 
+    // The cached resolutions may no longer hold once the field graph changes
+    {
+        std::unique_lock lock(m_resolvedMutex);
+        m_resolved.clear();
+    }
+
     // Add the field, iterating through the parts and adding parent fields as needed
     auto* current = &m_fields;
     decltype(current->begin()) entry;
@@ -61,6 +69,12 @@ void Schema::removeField(const DotPath& name)
         throw std::runtime_error("name cannot be empty");
     }
 
+    // The cached resolutions may no longer hold once the field graph changes
+    {
+        std::unique_lock lock(m_resolvedMutex);
+        m_resolved.clear();
+    }
+
     auto* current = &m_fields;
     decltype(current->begin()) entry;
 
@@ -134,7 +148,7 @@ Field Schema::get(const DotPath& name) const
     return *target;
 }
 
-bool Schema::hasField(const DotPath& name) const
+bool Schema::walkHasField(const DotPath& name) const
 {
     if (name.isRoot())
     {
@@ -191,6 +205,57 @@ bool Schema::hasField(const DotPath& name) const
     return true;
 }
 
+Schema::Resolution Schema::resolve(const DotPath& name) const
+{
+    {
+        std::shared_lock lock(m_resolvedMutex);
+        if (const auto it = m_resolved.find(name.id()); it != m_resolved.end())
+        {
+            return it->second;
+        }
+    }
+
+    // Walk the field graph once and compile the result into a flat entry. Paths whose walk
+    // throws are not cached, so they keep throwing the detailed error of the failing part.
+    Resolution resolution {walkHasField(name), Type::ERROR, false};
+    if (resolution.exists)
+    {
+        const auto field = get(name);
+        resolution.type = field.type();
+        resolution.isArray = field.isArray();
+    }
+
+    std::unique_lock lock(m_resolvedMutex);
+    return m_resolved.emplace(name.id(), resolution).first->second;
+}
+
+Type Schema::getType(const DotPath& name) const
+{
+    const auto resolution = resolve(name);
+    if (!resolution.exists)
+    {
+        throw std::runtime_error(fmt::format("Field '{}' does not exist", name.str()));
+    }
+
+    return resolution.type;
+}
+
+bool Schema::hasField(const DotPath& name) const
+{
+    return resolve(name).exists;
+}
+
+bool Schema::isArray(const DotPath& name) const
+{
+    const auto resolution = resolve(name);
+    if (!resolution.exists)
+    {
+        throw std::runtime_error(fmt::format("Field '{}' does not exist", name.str()));
+    }
+
+    return resolution.isArray;
+}
+
 Field Schema::entryToField(const std::string& name, const json::Json& entry) const
 {
     if (entry.type() != json::Json::Type::Object)
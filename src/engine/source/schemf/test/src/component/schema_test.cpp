@@ -168,3 +168,27 @@ TEST(SchemaTest, ArrayItem)
     ASSERT_THROW(schema.getType("a.n"), std::runtime_error);
     ASSERT_THROW(schema.getJsonType("a.n"), std::runtime_error);
 }
+
+TEST(SchemaTest, ResolutionFollowsSchemaChanges)
+{
+    Schema schema;
+    schema.addField("a.b", {Type::KEYWORD});
+
+    // Repeated queries of the same path are served from the compiled resolutions
+    ASSERT_TRUE(schema.hasField("a.b"));
+    ASSERT_TRUE(schema.hasField("a.b"));
+    ASSERT_EQ(schema.getType("a.b"), Type::KEYWORD);
+    ASSERT_FALSE(schema.isArray("a.b"));
+    ASSERT_FALSE(schema.hasField("other"));
+
+    // Modifying the schema discards the compiled resolutions
+    schema.addField("a.c", {Type::LONG, true});
+    ASSERT_TRUE(schema.hasField("a.c"));
+    ASSERT_EQ(schema.getType("a.c"), Type::LONG);
+    ASSERT_TRUE(schema.isArray("a.c"));
+
+    schema.removeField("a.b");
+    ASSERT_THROW(schema.hasField("a.b"), std::runtime_error);
+    ASSERT_THROW(schema.getType("a.b"), std::runtime_error);
+    ASSERT_THROW(schema.isArray("a.b"), std::runtime_error);
+}
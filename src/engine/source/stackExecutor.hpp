@@ -1,9 +1,13 @@
 #ifndef _CMD_DETAILS_STACK_EXECUTOR_HPP
 #define _CMD_DETAILS_STACK_EXECUTOR_HPP
 
+#include <chrono>
 #include <deque>
 #include <exception>
 #include <functional>
+#include <future>
+#include <thread>
+#include <vector>
 
 #include <base/logging.hpp>
 
@@ -13,12 +17,35 @@ namespace cmd::details
 /**
  * @brief Class to execute a stack of functions
  *
- * The functions are executed in reverse order of insertion (LIFO)
+ * The functions are grouped in stages and the stages are executed in reverse
+ * order of insertion (LIFO). Each add() opens a new stage, so by default the
+ * behavior is a plain LIFO of functions; addParallel() appends to the current
+ * top stage instead, and the functions of a stage run concurrently when the
+ * stage is executed. Stages only start once the previous (later-added) stage
+ * finished, so ordering dependencies are expressed by keeping handlers in
+ * separate stages.
  */
 class StackExecutor
 {
 private:
-    std::deque<std::function<void()>> m_stack; ///< Stack of functions
+    std::deque<std::vector<std::function<void()>>> m_stack; ///< Stack of stages, each a group of functions
+
+    /**
+     * @brief Run a single function, containing any exception it throws.
+     *
+     * @param func Function to run
+     */
+    static void run(const std::function<void()>& func)
+    {
+        try
+        {
+            func();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Engine stack executor: An error occurred while trying to execute a command: {}.", e.what());
+        }
+    }
 
 public:
     StackExecutor()
@@ -26,31 +53,103 @@ public:
     ~StackExecutor() = default;
 
     /**
-     * @brief Add a function to the stack
+     * @brief Add a function to the stack, as a new stage
      *
      * @param func Function to add
      */
-    void add(std::function<void()> func) { m_stack.push_back(func); }
+    void add(std::function<void()> func) { m_stack.push_back({std::move(func)}); }
+
+    /**
+     * @brief Add a function to the current top stage, to run concurrently with it
+     *
+     * Use it for a handler that is independent of the one added right before, so
+     * both teardowns overlap. Falls back to add() when the stack is empty.
+     *
+     * @param func Function to add
+     */
+    void addParallel(std::function<void()> func)
+    {
+        if (m_stack.empty())
+        {
+            add(std::move(func));
+            return;
+        }
+        m_stack.back().emplace_back(std::move(func));
+    }
 
     /**
      * @brief Execute the stack of functions.
      *
-     * The functions are executed in reverse order of insertion (LIFO), and the stack is
-     * cleared.
+     * The stages are executed in reverse order of insertion (LIFO), and the stack
+     * is cleared. Single-function stages run inline; the functions of a
+     * multi-function stage run on their own threads and the stage waits for all
+     * of them.
      */
     void execute()
     {
         while (!m_stack.empty())
         {
-            auto func = m_stack.back();
+            auto stage = std::move(m_stack.back());
             m_stack.pop_back();
-            try
+
+            if (stage.size() == 1)
             {
-                func();
+                run(stage.front());
+                continue;
             }
-            catch (const std::exception& e)
+
+            std::vector<std::thread> threads;
+            threads.reserve(stage.size());
+            for (auto& func : stage)
+            {
+                threads.emplace_back([func = std::move(func)]() { run(func); });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    /**
+     * @brief Execute the stack of functions under a global deadline.
+     *
+     * Same ordering as execute(), but every function runs on its own thread and
+     * the remaining time of the deadline bounds each wait. A function that does
+     * not finish in time is abandoned (its thread is detached) and logged, so a
+     * wedged handler cannot hold the shutdown hostage; later stages still run
+     * with whatever time is left.
+     *
+     * @param deadline Total time budget for the whole stack
+     */
+    void execute(std::chrono::milliseconds deadline)
+    {
+        const auto limit = std::chrono::steady_clock::now() + deadline;
+        while (!m_stack.empty())
+        {
+            auto stage = std::move(m_stack.back());
+            m_stack.pop_back();
+
+            std::vector<std::pair<std::future<void>, std::thread>> pending;
+            pending.reserve(stage.size());
+            for (auto& func : stage)
+            {
+                std::packaged_task<void()> task {[func = std::move(func)]() { run(func); }};
+                auto done = task.get_future();
+                pending.emplace_back(std::move(done), std::thread {std::move(task)});
+            }
+
+            for (auto& [done, thread] : pending)
             {
-                LOG_ERROR("Engine stack executor: An error occurred while trying to execute a command: {}.", e.what());
+                if (done.wait_until(limit) == std::future_status::ready)
+                {
+                    thread.join();
+                }
+                else
+                {
+                    LOG_ERROR("Engine stack executor: A command exceeded the shutdown deadline and was abandoned.");
+                    thread.detach();
+                }
             }
         }
     }
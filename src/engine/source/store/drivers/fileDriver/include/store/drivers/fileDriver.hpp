@@ -3,8 +3,12 @@
 
 #include <store/idriver.hpp>
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <map>
+#include <thread>
 
 /**
  * @brief File driver for the store.
@@ -26,8 +30,36 @@ class FileDriver : public IDriver
 private:
     std::filesystem::path m_path;
 
+    // Inotify watcher state, only valid while the watcher is running
+    int m_inotifyFd {-1};                          ///< Inotify instance, -1 when the watcher is stopped.
+    std::map<int, std::filesystem::path> m_wdToDir; ///< Watch descriptor to watched directory.
+    std::thread m_watcherThread;                    ///< Thread draining the inotify queue.
+    std::atomic<bool> m_stopWatcher {false};        ///< Stop flag for the watcher thread.
+    std::function<void(const base::Name&)> m_onDirty; ///< Callback invoked per dirty document name.
+
     std::filesystem::path nameToPath(const base::Name& name) const;
 
+    /**
+     * @brief Translate a path under the base path back to a store name.
+     *
+     * @param path Absolute path of the file.
+     * @return The store name, or std::nullopt if the path is not under the base path.
+     */
+    std::optional<base::Name> pathToName(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Add inotify watches for a directory and all its subdirectories.
+     *
+     * @param dir Directory to watch.
+     */
+    void addWatchRecursive(const std::filesystem::path& dir);
+
+    /**
+     * @brief Drain the inotify queue until the stop flag is set, coalescing the
+     * events of each batch into a set of dirty names before notifying.
+     */
+    void watchLoop();
+
     base::OptError removeEmptyParentDirs(const std::filesystem::path& path, const base::Name& name);
 
 public:
@@ -38,7 +70,26 @@ public:
      * @param create If true, the base path will be created if it doesn't exist.
      */
     FileDriver(const std::filesystem::path& path, bool create = false);
-    ~FileDriver() = default;
+    ~FileDriver();
+
+    /**
+     * @brief Start watching the base path with inotify.
+     *
+     * Maintains a dirty-set of the documents touched on disk outside this driver
+     * (catalog sync tooling writing the tree directly) and invokes the callback
+     * once per dirty document, so the store can invalidate exactly the touched
+     * documents instead of re-validating the whole tree.
+     *
+     * @param onDirty Invoked from the watcher thread with the real (on-disk) name
+     * of each created, modified or deleted document.
+     * @return base::OptError with the error or empty if the watcher started.
+     */
+    base::OptError startWatcher(std::function<void(const base::Name&)> onDirty);
+
+    /**
+     * @brief Stop the watcher thread and release the inotify instance. Idempotent.
+     */
+    void stopWatcher();
 
     FileDriver(const FileDriver&) = delete;
     FileDriver& operator=(const FileDriver&) = delete;
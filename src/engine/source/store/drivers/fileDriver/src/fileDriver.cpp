@@ -1,8 +1,23 @@
 #include "store/drivers/fileDriver.hpp"
 
+#include <cerrno>
+#include <cstring>
+#include <set>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
 #include <base/logging.hpp>
 #include <fmt/format.h>
 
+namespace
+{
+// Document writes, moves and removals, plus directory creation to extend the watch tree
+constexpr uint32_t WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE;
+constexpr int WATCH_POLL_TIMEOUT_MS = 250;
+} // namespace
+
 namespace store::drivers
 {
 FileDriver::FileDriver(const std::filesystem::path& path, bool create)
@@ -32,6 +47,11 @@ FileDriver::FileDriver(const std::filesystem::path& path, bool create)
     m_path = path;
 }
 
+FileDriver::~FileDriver()
+{
+    stopWatcher();
+}
+
 std::filesystem::path FileDriver::nameToPath(const base::Name& name) const
 {
     std::filesystem::path path {m_path};
@@ -43,6 +63,158 @@ std::filesystem::path FileDriver::nameToPath(const base::Name& name) const
     return path;
 }
 
+std::optional<base::Name> FileDriver::pathToName(const std::filesystem::path& path) const
+{
+    std::error_code ec;
+    const auto relative = std::filesystem::relative(path, m_path, ec);
+    if (ec || relative.empty() || *relative.begin() == "..")
+    {
+        return std::nullopt;
+    }
+
+    std::vector<std::string> parts;
+    for (const auto& part : relative)
+    {
+        parts.emplace_back(part.string());
+    }
+
+    try
+    {
+        return base::Name(parts);
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+void FileDriver::addWatchRecursive(const std::filesystem::path& dir)
+{
+    const auto wd = inotify_add_watch(m_inotifyFd, dir.c_str(), WATCH_MASK);
+    if (wd < 0)
+    {
+        LOG_WARNING("FileDriver cannot watch '{}': {} ({})", dir.string(), strerror(errno), errno);
+        return;
+    }
+    m_wdToDir[wd] = dir;
+
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec))
+    {
+        if (entry.is_directory())
+        {
+            addWatchRecursive(entry.path());
+        }
+    }
+}
+
+void FileDriver::watchLoop()
+{
+    // The buffer must fit at least one event with the maximum name length
+    alignas(inotify_event) char buffer[4096];
+
+    while (!m_stopWatcher.load(std::memory_order_relaxed))
+    {
+        pollfd pfd {m_inotifyFd, POLLIN, 0};
+        const auto ready = poll(&pfd, 1, WATCH_POLL_TIMEOUT_MS);
+        if (ready <= 0)
+        {
+            continue;
+        }
+
+        const auto len = read(m_inotifyFd, buffer, sizeof(buffer));
+        if (len <= 0)
+        {
+            continue;
+        }
+
+        // Coalesce the batch into a dirty-set, a tool touching two files
+        // produces exactly two notifications no matter how many events each
+        // write emitted.
+        std::set<base::Name> dirty;
+        for (ssize_t offset = 0; offset < len;)
+        {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            const auto it = m_wdToDir.find(event->wd);
+            if (it == m_wdToDir.end() || event->len == 0)
+            {
+                continue;
+            }
+            const auto path = it->second / event->name;
+
+            if (event->mask & IN_ISDIR)
+            {
+                // New directories must be watched too, a sync tool creating
+                // namespace/collection dirs would escape the watch otherwise
+                if (event->mask & (IN_CREATE | IN_MOVED_TO))
+                {
+                    addWatchRecursive(path);
+                }
+                continue;
+            }
+
+            const auto name = pathToName(path);
+            if (name)
+            {
+                dirty.insert(*name);
+            }
+        }
+
+        for (const auto& name : dirty)
+        {
+            m_onDirty(name);
+        }
+    }
+}
+
+base::OptError FileDriver::startWatcher(std::function<void(const base::Name&)> onDirty)
+{
+    if (m_inotifyFd >= 0)
+    {
+        return base::Error {"Watcher is already running"};
+    }
+    if (!onDirty)
+    {
+        return base::Error {"Watcher callback cannot be empty"};
+    }
+
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_inotifyFd < 0)
+    {
+        return base::Error {fmt::format("Cannot create inotify instance: {} ({})", strerror(errno), errno)};
+    }
+
+    m_onDirty = std::move(onDirty);
+    addWatchRecursive(m_path);
+
+    m_stopWatcher.store(false, std::memory_order_relaxed);
+    m_watcherThread = std::thread(&FileDriver::watchLoop, this);
+
+    LOG_DEBUG("FileDriver watching '{}' with {} directory watches.", m_path.string(), m_wdToDir.size());
+    return base::noError();
+}
+
+void FileDriver::stopWatcher()
+{
+    if (m_inotifyFd < 0)
+    {
+        return;
+    }
+
+    m_stopWatcher.store(true, std::memory_order_relaxed);
+    if (m_watcherThread.joinable())
+    {
+        m_watcherThread.join();
+    }
+
+    close(m_inotifyFd);
+    m_inotifyFd = -1;
+    m_wdToDir.clear();
+    m_onDirty = nullptr;
+}
+
 base::OptError FileDriver::createDoc(const base::Name& name, const Doc& content)
 {
     auto error = base::noError();
@@ -0,0 +1,121 @@
+#ifndef _MMAP_DRIVER_H
+#define _MMAP_DRIVER_H
+
+#include <store/idriver.hpp>
+
+#include <filesystem>
+#include <set>
+#include <string>
+
+namespace store::drivers
+{
+
+/**
+ * @brief Read-only, mmap-backed driver for the store.
+ *
+ * Shares the directory layout of FileDriver (basePath/<part>/<part>/...), but reads
+ * documents by mapping the file and advising the kernel to prefetch it sequentially,
+ * so policy build bursts stream through the page cache instead of paying a read
+ * syscall and a double copy per document.
+ *
+ * Existence and collection queries are answered from an in-memory index built once at
+ * construction: from a manifest file when present, otherwise from a single directory
+ * walk (which can be persisted as the manifest for the next startup). This replaces
+ * the per-asset stat/open storm of the filesystem driver during startup.
+ *
+ * All mutating operations fail: deployments that modify the store must use FileDriver.
+ */
+class MMapDriver : public IDriver
+{
+private:
+    std::filesystem::path m_path;
+    std::set<std::string> m_index; ///< Full names of every document, in lexicographic order.
+
+    std::filesystem::path nameToPath(const base::Name& name) const;
+
+    /**
+     * @brief Collect the documents under the base path into the index with one walk.
+     */
+    void buildIndexFromWalk();
+
+    /**
+     * @brief Load the index from the manifest file.
+     * @return base::OptError with the error or empty if no error.
+     */
+    base::OptError loadManifest();
+
+public:
+    /// Manifest file name, stored at the root of the base path.
+    constexpr static auto MANIFEST_FILE = "store.manifest.json";
+
+    /**
+     * @brief Construct a new MMap Driver object.
+     *
+     * @param path Base path for the driver, must exist.
+     * @param writeManifest If true and no manifest exists, persist the index built from
+     * the directory walk so the next startup skips the walk entirely.
+     */
+    MMapDriver(const std::filesystem::path& path, bool writeManifest = false);
+    ~MMapDriver() = default;
+
+    MMapDriver(const MMapDriver&) = delete;
+    MMapDriver& operator=(const MMapDriver&) = delete;
+
+    /**
+     * @copydoc IDriver::createDoc
+     */
+    base::OptError createDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::readDoc
+     */
+    base::RespOrError<Doc> readDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::updateDoc
+     */
+    base::OptError updateDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::upsertDoc
+     */
+    base::OptError upsertDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::deleteDoc
+     */
+    base::OptError deleteDoc(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::readCol
+     */
+    base::RespOrError<Col> readCol(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::readCol
+     */
+    base::RespOrError<Col> readRoot() const override;
+
+    /**
+     * @copydoc IDriver::deleteCol
+     */
+    base::OptError deleteCol(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::exists
+     */
+    bool exists(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsDoc
+     */
+    bool existsDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsCol
+     */
+    bool existsCol(const base::Name& name) const override;
+};
+} // namespace store::drivers
+
+#endif // _MMAP_DRIVER_H
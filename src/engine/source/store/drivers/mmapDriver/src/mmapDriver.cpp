@@ -0,0 +1,259 @@
+#include "store/drivers/mmapDriver.hpp"
+
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+#include <fmt/format.h>
+
+namespace
+{
+const auto READ_ONLY_ERROR = base::Error {"The mmap driver is read-only"};
+} // namespace
+
+namespace store::drivers
+{
+MMapDriver::MMapDriver(const std::filesystem::path& path, bool writeManifest)
+{
+    LOG_DEBUG("Engine mmap driver init with path '{}' and writeManifest '{}'.", path.string(), writeManifest);
+
+    if (!std::filesystem::exists(path))
+    {
+        throw std::runtime_error(fmt::format("Path '{}' does not exist", path.string()));
+    }
+    if (!std::filesystem::is_directory(path))
+    {
+        throw std::runtime_error(fmt::format("Path '{}' is not a directory", path.string()));
+    }
+
+    m_path = path;
+
+    if (std::filesystem::exists(m_path / MANIFEST_FILE))
+    {
+        auto error = loadManifest();
+        if (error)
+        {
+            throw std::runtime_error(error.value().message);
+        }
+    }
+    else
+    {
+        buildIndexFromWalk();
+
+        if (writeManifest)
+        {
+            json::Json manifest;
+            manifest.setArray();
+            for (const auto& name : m_index)
+            {
+                manifest.appendString(name);
+            }
+
+            std::ofstream file(m_path / MANIFEST_FILE);
+            if (!file.is_open())
+            {
+                throw std::runtime_error(
+                    fmt::format("Manifest '{}' could not be opened on writing mode", (m_path / MANIFEST_FILE).string()));
+            }
+            file << manifest.str();
+        }
+    }
+}
+
+std::filesystem::path MMapDriver::nameToPath(const base::Name& name) const
+{
+    std::filesystem::path path {m_path};
+    for (const auto& part : name.parts())
+    {
+        path /= part;
+    }
+
+    return path;
+}
+
+void MMapDriver::buildIndexFromWalk()
+{
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(m_path))
+    {
+        if (!entry.is_regular_file() || entry.path().filename() == MANIFEST_FILE)
+        {
+            continue;
+        }
+        // The relative path matches the full name because the name separator is '/'
+        m_index.emplace(entry.path().lexically_relative(m_path).string());
+    }
+}
+
+base::OptError MMapDriver::loadManifest()
+{
+    const auto path = m_path / MANIFEST_FILE;
+    auto manifest = readDoc(base::Name {MANIFEST_FILE});
+    if (base::isError(manifest))
+    {
+        return base::Error {
+            fmt::format("Manifest '{}' could not be read: {}", path.string(), base::getError(manifest).message)};
+    }
+
+    const auto names = base::getResponse<Doc>(manifest).getArray();
+    if (!names)
+    {
+        return base::Error {fmt::format("Manifest '{}' is not an array", path.string())};
+    }
+
+    for (const auto& name : names.value())
+    {
+        const auto str = name.getString();
+        if (!str)
+        {
+            return base::Error {fmt::format("Manifest '{}' contains a non-string entry", path.string())};
+        }
+        m_index.emplace(str.value());
+    }
+
+    return base::noError();
+}
+
+base::OptError MMapDriver::createDoc(const base::Name& name, const Doc& content)
+{
+    return READ_ONLY_ERROR;
+}
+
+base::RespOrError<Doc> MMapDriver::readDoc(const base::Name& name) const
+{
+    base::RespOrError<Doc> result;
+    auto path = nameToPath(name);
+
+    LOG_DEBUG("MMapDriver readDoc name: '{}'.", name.fullName());
+
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return base::Error {fmt::format("File '{}' could not be opened on reading mode", path.string())};
+    }
+
+    struct stat st = {};
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        ::close(fd);
+        return base::Error {fmt::format("File '{}' is not a regular file", path.string())};
+    }
+
+    if (st.st_size == 0)
+    {
+        ::close(fd);
+        return base::Error {fmt::format("File '{}' could not be parsed: empty file", path.string())};
+    }
+
+    const auto size = static_cast<std::size_t>(st.st_size);
+    auto* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file referenced
+    if (data == MAP_FAILED)
+    {
+        return base::Error {fmt::format("File '{}' could not be mapped", path.string())};
+    }
+
+    // Tell the kernel the parse is a single sequential pass so it prefetches ahead
+    ::madvise(data, size, MADV_SEQUENTIAL | MADV_WILLNEED);
+
+    try
+    {
+        result = Doc {std::string_view {static_cast<const char*>(data), size}};
+    }
+    catch (const std::exception& e)
+    {
+        result = base::Error {fmt::format("File '{}' could not be parsed: {}", path.string(), e.what())};
+    }
+
+    ::munmap(data, size);
+    return result;
+}
+
+base::OptError MMapDriver::updateDoc(const base::Name& name, const Doc& content)
+{
+    return READ_ONLY_ERROR;
+}
+
+base::OptError MMapDriver::upsertDoc(const base::Name& name, const Doc& content)
+{
+    return READ_ONLY_ERROR;
+}
+
+base::OptError MMapDriver::deleteDoc(const base::Name& name)
+{
+    return READ_ONLY_ERROR;
+}
+
+base::RespOrError<Col> MMapDriver::readCol(const base::Name& name) const
+{
+    LOG_DEBUG("MMapDriver readCol name: '{}'.", name.fullName());
+
+    if (!existsCol(name))
+    {
+        return base::Error {fmt::format("Collection '{}' does not exist", name.fullName())};
+    }
+
+    const auto prefix = name.fullName() + base::Name::SEPARATOR_S;
+
+    Col names;
+    std::string lastChild;
+    for (auto it = m_index.lower_bound(prefix); it != m_index.end() && it->compare(0, prefix.size(), prefix) == 0; ++it)
+    {
+        // First segment after the prefix, deduplicated (the index is sorted)
+        const auto child = it->substr(prefix.size(), it->find(base::Name::SEPARATOR_C, prefix.size()) - prefix.size());
+        if (child != lastChild)
+        {
+            names.emplace_back(base::Name(name) + child);
+            lastChild = child;
+        }
+    }
+
+    return names;
+}
+
+base::RespOrError<Col> MMapDriver::readRoot() const
+{
+    LOG_DEBUG("MMapDriver readRoot.");
+
+    Col names;
+    std::string lastChild;
+    for (const auto& entry : m_index)
+    {
+        const auto child = entry.substr(0, entry.find(base::Name::SEPARATOR_C));
+        if (child != lastChild)
+        {
+            names.emplace_back(child);
+            lastChild = child;
+        }
+    }
+
+    return names;
+}
+
+base::OptError MMapDriver::deleteCol(const base::Name& name)
+{
+    return READ_ONLY_ERROR;
+}
+
+bool MMapDriver::exists(const base::Name& name) const
+{
+    return existsDoc(name) || existsCol(name);
+}
+
+bool MMapDriver::existsDoc(const base::Name& name) const
+{
+    return m_index.find(name.fullName()) != m_index.end();
+}
+
+bool MMapDriver::existsCol(const base::Name& name) const
+{
+    const auto prefix = name.fullName() + base::Name::SEPARATOR_S;
+    const auto it = m_index.lower_bound(prefix);
+
+    return it != m_index.end() && it->compare(0, prefix.size(), prefix) == 0;
+}
+
+} // namespace store::drivers
@@ -2,8 +2,11 @@
 #define _STORE_HPP
 
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 
+#include <base/lruCache.hpp>
+
 #include <store/idriver.hpp>
 #include <store/istore.hpp>
 
@@ -12,6 +15,9 @@ namespace store
 
 class Store : public IStore
 {
+public:
+    static constexpr std::size_t DEFAULT_DOC_CACHE_CAPACITY = 128; ///< Default capacity of the decoded document cache.
+
 private:
     static base::Name sm_prefixNS; ///< Prefix for the namespaces.
 
@@ -21,6 +27,18 @@ private:
     std::unique_ptr<DBDocNames> m_cache; ///< Cache for the doc names and virtual space names.
     mutable std::shared_mutex m_mutex;   ///< sync the m_cache with the store. and protect the m_cache access.
 
+    /// Decoded documents read lazily from the driver, bounded by the LRU capacity.
+    /// Null when the cache is disabled (capacity 0).
+    mutable std::unique_ptr<LRUCache<base::Name, Doc>> m_docCache;
+    mutable std::mutex m_docCacheMutex; ///< Protects m_docCache.
+
+    /**
+     * @brief Drop a single virtual name from the decoded document cache.
+     *
+     * @param virtualName The name of the document in the virtual space.
+     */
+    void removeCachedDoc(const base::Name& virtualName);
+
     /**
      * @brief Translate a virtual name to a real name in the store driver.
      *
@@ -117,8 +135,14 @@ private:
 public:
     /**
      * @brief Construct a new Doc Namespace Manager object using the store.
+     *
+     * Only the document names are loaded eagerly; the contents are read lazily through
+     * the driver and kept in an LRU cache of decoded documents.
+     *
+     * @param driver The store driver.
+     * @param docCacheCapacity Maximum decoded documents kept resident, 0 disables the cache.
      */
-    Store(std::shared_ptr<IDriver> driver);
+    Store(std::shared_ptr<IDriver> driver, std::size_t docCacheCapacity = DEFAULT_DOC_CACHE_CAPACITY);
 
     ~Store();
 
@@ -172,6 +196,23 @@ public:
      */
     base::OptError deleteDoc(const base::Name& name) override;
 
+    /**
+     * @copydoc IStore::flushDocCache
+     */
+    void flushDocCache() override;
+
+    /**
+     * @brief Drop a single document from the decoded document cache.
+     *
+     * Takes the real (on-disk) name as reported by the driver watcher, so a sync
+     * tool touching two files invalidates exactly two cached documents instead
+     * of flushing the whole cache. Names that do not map to a virtual document
+     * (internal documents, unrelated paths) are ignored.
+     *
+     * @param realName The real name of the document in the store driver.
+     */
+    void invalidateDoc(const base::Name& realName);
+
     /**
      * @copydoc IStore::
      */
@@ -201,6 +201,15 @@ public:
      * @return base::OptError The error if the collection does not exist or cannot be deleted.
      */
     virtual base::OptError deleteCol(const base::Name& name, const NamespaceId& namespaceId) = 0;
+
+    /**
+     * @brief Drop the cache of decoded documents.
+     *
+     * Documents are decoded lazily on read and kept in a bounded cache to speed up
+     * builds. Callers invoke this once a policy build completes so steady-state memory
+     * holds only the compiled policies, not the source documents.
+     */
+    virtual void flushDocCache() = 0;
 };
 
 } // namespace store
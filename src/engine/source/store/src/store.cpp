@@ -279,10 +279,11 @@ public:
     }
 };
 
-Store::Store(std::shared_ptr<IDriver> driver)
+Store::Store(std::shared_ptr<IDriver> driver, std::size_t docCacheCapacity)
     : m_driver(std::move(driver))
     , m_cache(std::make_unique<DBDocNames>())
     , m_mutex()
+    , m_docCache(docCacheCapacity > 0 ? std::make_unique<LRUCache<base::Name, Doc>>(docCacheCapacity) : nullptr)
 {
     if (m_driver == nullptr)
     {
@@ -387,7 +388,61 @@ base::RespOrError<Doc> Store::readDoc(const base::Name& name) const
     // Transform the virtual name to the real name
     const auto rname = virtualToRealName(name, *namespaceId);
 
-    return m_driver->readDoc(rname);
+    // Serve the decoded document from the cache when possible, the driver read
+    // implies disk access and a JSON parse.
+    if (m_docCache)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        auto cached = m_docCache->getValue(name);
+        if (cached)
+        {
+            return std::move(cached).value();
+        }
+    }
+
+    auto resp = m_driver->readDoc(rname);
+    if (m_docCache && !base::isError(resp))
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->insertKey(name, base::getResponse<Doc>(resp));
+    }
+
+    return resp;
+}
+
+void Store::flushDocCache()
+{
+    if (m_docCache)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->clear();
+    }
+}
+
+void Store::removeCachedDoc(const base::Name& virtualName)
+{
+    if (m_docCache)
+    {
+        std::lock_guard<std::mutex> cacheLock(m_docCacheMutex);
+        m_docCache->removeKey(virtualName);
+    }
+}
+
+void Store::invalidateDoc(const base::Name& realName)
+{
+    if (!m_docCache)
+    {
+        return;
+    }
+
+    // Internal documents are not cached, only virtual names can be dirty
+    const auto virtualName = realToVirtualName(realName);
+    if (base::isError(virtualName))
+    {
+        return;
+    }
+
+    removeCachedDoc(base::getResponse<base::Name>(virtualName));
 }
 
 std::vector<NamespaceId> Store::listNamespaces() const
@@ -461,7 +516,12 @@ base::OptError Store::updateDoc(const base::Name& name, const Doc& content)
 
     // update the document
     auto rName = virtualToRealName(name, *namespaceId);
-    return m_driver->updateDoc(rName, content);
+    auto error = m_driver->updateDoc(rName, content);
+    if (!error)
+    {
+        removeCachedDoc(name);
+    }
+    return error;
 }
 
 base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
@@ -487,6 +547,8 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
         m_cache->add(name, namespaceId);
     }
 
+    removeCachedDoc(name);
+
     return std::nullopt;
 }
 
@@ -511,6 +573,7 @@ base::OptError Store::deleteDoc(const base::Name& name)
     }
 
     m_cache->del(name);
+    removeCachedDoc(name);
 
     return std::nullopt;
 }
@@ -531,8 +594,13 @@ base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& names
         return error;
     }
 
-    // Update the cache
+    // Update the cache, dropping each deleted document individually
+    const auto deleted = m_cache->filterByPrefix(name, namespaceId);
     m_cache->delCol(name, namespaceId);
+    for (const auto& docName : deleted)
+    {
+        removeCachedDoc(docName);
+    }
 
     return std::nullopt;
 }
@@ -113,6 +113,7 @@ public:
     MOCK_METHOD((base::OptError), upsertDoc, (const base::Name&, const NamespaceId&, const Doc&), (override));
     MOCK_METHOD((base::OptError), deleteDoc, (const base::Name&), (override));
     MOCK_METHOD((base::OptError), deleteCol, (const base::Name&, const NamespaceId&), (override));
+    MOCK_METHOD((void), flushDocCache, (), (override));
 };
 
 } // namespace store::mocks
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
 #include <store/drivers/fileDriver.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -299,3 +304,96 @@ TEST_F(FileDriverTest, Exists)
     ASSERT_FALSE(fDriver.existsDoc(TEST_NAME_COLLECTION));
     ASSERT_TRUE(fDriver.existsCol(TEST_NAME_COLLECTION));
 }
+
+/*******************************************************************************
+                        FileDriver::startWatcher
+*******************************************************************************/
+class FileDriverWatcherTest : public FileDriverTest
+{
+protected:
+    std::mutex m_dirtyMutex;
+    std::condition_variable m_dirtyCv;
+    std::vector<base::Name> m_dirty;
+
+    std::function<void(const base::Name&)> collector()
+    {
+        return [this](const base::Name& name)
+        {
+            std::lock_guard<std::mutex> lock(m_dirtyMutex);
+            m_dirty.push_back(name);
+            m_dirtyCv.notify_all();
+        };
+    }
+
+    bool waitForDirty(std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock(m_dirtyMutex);
+        return m_dirtyCv.wait_for(lock, std::chrono::seconds(5), [&]() { return m_dirty.size() >= count; });
+    }
+};
+
+TEST_F(FileDriverWatcherTest, StartStop)
+{
+    FileDriver fDriver(m_path);
+
+    ASSERT_FALSE(fDriver.startWatcher(collector()));
+    // A second start must fail, the watcher is already running
+    ASSERT_TRUE(fDriver.startWatcher(collector()));
+    // An empty callback is rejected
+    fDriver.stopWatcher();
+    ASSERT_TRUE(fDriver.startWatcher(nullptr));
+
+    // Stop is idempotent
+    fDriver.stopWatcher();
+    fDriver.stopWatcher();
+}
+
+TEST_F(FileDriverWatcherTest, TwoTouchedFilesTwoNotifications)
+{
+    auto pathA = m_path / "type" / "nameA" / "0";
+    auto pathB = m_path / "type" / "nameB" / "0";
+    std::filesystem::create_directories(pathA.parent_path());
+    std::filesystem::create_directories(pathB.parent_path());
+
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.startWatcher(collector()));
+
+    // Touch two files the way a sync tool would, outside the driver interface
+    {
+        std::ofstream fileA(pathA);
+        fileA << TEST_JSON.str();
+    }
+    {
+        std::ofstream fileB(pathB);
+        fileB << TEST_JSON.str();
+    }
+
+    ASSERT_TRUE(waitForDirty(2));
+    fDriver.stopWatcher();
+
+    std::sort(m_dirty.begin(), m_dirty.end());
+    ASSERT_EQ(m_dirty.size(), 2);
+    ASSERT_EQ(m_dirty[0], base::Name({"type", "nameA", "0"}));
+    ASSERT_EQ(m_dirty[1], base::Name({"type", "nameB", "0"}));
+}
+
+TEST_F(FileDriverWatcherTest, DeletionIsReported)
+{
+    auto path = m_path / "type" / "name" / "0";
+    std::filesystem::create_directories(path.parent_path());
+    {
+        std::ofstream file(path);
+        file << TEST_JSON.str();
+    }
+
+    FileDriver fDriver(m_path);
+    ASSERT_FALSE(fDriver.startWatcher(collector()));
+
+    std::filesystem::remove(path);
+
+    ASSERT_TRUE(waitForDirty(1));
+    fDriver.stopWatcher();
+
+    ASSERT_EQ(m_dirty.size(), 1);
+    ASSERT_EQ(m_dirty[0], base::Name({"type", "name", "0"}));
+}
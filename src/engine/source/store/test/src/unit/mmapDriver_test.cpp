@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <store/drivers/mmapDriver.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <base/logging.hpp>
+
+static const std::filesystem::path TEST_PATH = "/tmp/mmapDriver_test";
+static const base::Name TEST_NAME({"type", "name", "version"});
+static const base::Name TEST_NAME_COLLECTION(std::vector<std::string> {"type", "name"});
+
+static const json::Json TEST_JSON {R"({"key": "value"})"};
+
+using namespace store::drivers;
+
+static std::filesystem::path uniquePath()
+{
+    auto pid = getpid();
+    auto tid = std::this_thread::get_id();
+    std::stringstream ss;
+    ss << pid << "_" << tid; // Unique path per thread and process
+    return TEST_PATH / ss.str();
+}
+
+class MMapDriverTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_path;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_path = uniquePath();
+        std::filesystem::create_directories(m_path);
+        writeDoc(TEST_NAME, TEST_JSON);
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_path); }
+
+    void writeDoc(const base::Name& name, const json::Json& content)
+    {
+        std::filesystem::path path {m_path};
+        for (const auto& part : name.parts())
+        {
+            path /= part;
+        }
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path);
+        file << content.str();
+    }
+};
+
+TEST_F(MMapDriverTest, Builds)
+{
+    ASSERT_NO_THROW(MMapDriver(m_path));
+    ASSERT_THROW(MMapDriver(m_path / "missing"), std::runtime_error);
+}
+
+TEST_F(MMapDriverTest, ReadDoc)
+{
+    MMapDriver driver(m_path);
+    auto result = driver.readDoc(TEST_NAME);
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse<store::Doc>(result), TEST_JSON);
+}
+
+TEST_F(MMapDriverTest, ReadDocNotExists)
+{
+    MMapDriver driver(m_path);
+    ASSERT_TRUE(base::isError(driver.readDoc(base::Name({"type", "name", "missing"}))));
+}
+
+TEST_F(MMapDriverTest, ReadDocNotJson)
+{
+    std::ofstream file(m_path / "notJson");
+    file << "not a json";
+    file.close();
+
+    MMapDriver driver(m_path);
+    ASSERT_TRUE(base::isError(driver.readDoc(base::Name {"notJson"})));
+}
+
+TEST_F(MMapDriverTest, Exists)
+{
+    MMapDriver driver(m_path);
+    ASSERT_TRUE(driver.exists(TEST_NAME));
+    ASSERT_TRUE(driver.exists(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(driver.existsDoc(TEST_NAME));
+    ASSERT_FALSE(driver.existsDoc(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(driver.existsCol(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(driver.existsCol(TEST_NAME));
+    ASSERT_FALSE(driver.exists(base::Name {"missing"}));
+}
+
+TEST_F(MMapDriverTest, ReadCol)
+{
+    writeDoc(base::Name({"type", "name", "version2"}), TEST_JSON);
+
+    MMapDriver driver(m_path);
+    auto result = driver.readCol(TEST_NAME_COLLECTION);
+    ASSERT_FALSE(base::isError(result));
+    auto col = base::getResponse<store::Col>(result);
+    ASSERT_EQ(col.size(), 2);
+    ASSERT_EQ(col[0], base::Name({"type", "name", "version"}));
+    ASSERT_EQ(col[1], base::Name({"type", "name", "version2"}));
+
+    ASSERT_TRUE(base::isError(driver.readCol(base::Name {"missing"})));
+}
+
+TEST_F(MMapDriverTest, ReadRoot)
+{
+    writeDoc(base::Name({"type2", "other", "0"}), TEST_JSON);
+
+    MMapDriver driver(m_path);
+    auto result = driver.readRoot();
+    ASSERT_FALSE(base::isError(result));
+    auto col = base::getResponse<store::Col>(result);
+    ASSERT_EQ(col.size(), 2);
+    ASSERT_EQ(col[0], base::Name {"type"});
+    ASSERT_EQ(col[1], base::Name {"type2"});
+}
+
+TEST_F(MMapDriverTest, ReadOnly)
+{
+    MMapDriver driver(m_path);
+    ASSERT_TRUE(base::isError(driver.createDoc(base::Name {"new"}, TEST_JSON)));
+    ASSERT_TRUE(base::isError(driver.updateDoc(TEST_NAME, TEST_JSON)));
+    ASSERT_TRUE(base::isError(driver.upsertDoc(TEST_NAME, TEST_JSON)));
+    ASSERT_TRUE(base::isError(driver.deleteDoc(TEST_NAME)));
+    ASSERT_TRUE(base::isError(driver.deleteCol(TEST_NAME_COLLECTION)));
+    // The document is untouched
+    ASSERT_FALSE(base::isError(driver.readDoc(TEST_NAME)));
+}
+
+TEST_F(MMapDriverTest, WritesAndLoadsManifest)
+{
+    // First startup walks the tree and persists the manifest
+    {
+        MMapDriver driver(m_path, true);
+        ASSERT_TRUE(driver.existsDoc(TEST_NAME));
+    }
+    ASSERT_TRUE(std::filesystem::exists(m_path / MMapDriver::MANIFEST_FILE));
+
+    // Documents added after the manifest was written are not visible: the second
+    // startup trusts the manifest and skips the walk
+    writeDoc(base::Name({"type", "name", "unlisted"}), TEST_JSON);
+
+    MMapDriver driver(m_path);
+    ASSERT_TRUE(driver.existsDoc(TEST_NAME));
+    ASSERT_FALSE(driver.existsDoc(base::Name({"type", "name", "unlisted"})));
+}
+
+TEST_F(MMapDriverTest, ManifestNotListed)
+{
+    MMapDriver driver(m_path, true);
+    ASSERT_FALSE(driver.existsDoc(base::Name {MMapDriver::MANIFEST_FILE}));
+    auto result = driver.readRoot();
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(base::getResponse<store::Col>(result).size(), 1);
+}
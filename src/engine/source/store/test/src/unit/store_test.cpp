@@ -234,6 +234,90 @@ TEST_F(StoreTest, ReadDoc_ok)
     ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
 }
 
+TEST_F(StoreTest, ReadDoc_cached)
+{
+    // The second read is served from the document cache, the driver is hit once
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+
+    auto res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+
+    res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+}
+
+TEST_F(StoreTest, ReadDoc_flushDocCache)
+{
+    // After flushing the cache the document is read again through the driver
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    store->flushDocCache();
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+}
+
+TEST_F(StoreTest, ReadDoc_updateInvalidatesCache)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1B)).WillOnce(testing::Return(std::nullopt));
+
+    auto res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1B)));
+
+    res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1B);
+}
+
+TEST_F(StoreTest, ReadDoc_updateInvalidatesOnlyTouched)
+{
+    // Updating one document must not evict the other cached documents
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    EXPECT_CALL(*driver, readDoc(rDoc_1B)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1B)).WillOnce(testing::Return(std::nullopt));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1B)));
+
+    // doc_1A is read again through the driver, doc_1B is still served from cache
+    auto res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1B);
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+}
+
+TEST_F(StoreTest, ReadDoc_invalidateDocByRealName)
+{
+    // The driver watcher reports real names, only the touched document is dropped
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    EXPECT_CALL(*driver, readDoc(rDoc_1B)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1B))));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+
+    store->invalidateDoc(rDoc_1A);
+    // Names that do not map to a virtual document are ignored
+    store->invalidateDoc(base::Name("not/a/virtual/doc"));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1B)));
+}
+
 /*******************************************************************************
                         Store::readCol
 *******************************************************************************/
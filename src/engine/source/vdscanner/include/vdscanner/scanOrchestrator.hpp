@@ -13,6 +13,7 @@
 #define _SCAN_ORCHESTRATOR_HPP
 
 #include "databaseFeedManager.hpp"
+#include <functional>
 #include <memory>
 #include <nlohmann/json_fwd.hpp>
 #include <string>
@@ -22,7 +23,8 @@ namespace vdscanner
 enum class PayloadType
 {
     PackageList = 0,
-    FullScan = 1
+    FullScan = 1,
+    Delta = 2
 };
 
 /**
@@ -45,21 +47,47 @@ public:
     /**
      * @brief Process an event.
      *
-     * @param input Event to process.
+     * @param request Event to process.
+     * @param response Full scan response, a JSON array with every detection.
      */
     void processEvent(const std::string& request, std::string& response) const;
 
+    /**
+     * @brief Process an event, streaming the results as they are produced.
+     *
+     * Each frame is a self-contained JSON array with the detections of one scanned component (the
+     * OS or one package), emitted as soon as that component finishes, so the consumer can start
+     * processing immediately and the scanner never holds the whole response in memory. Frames of a
+     * parallel scan arrive in completion order.
+     *
+     * @param request Event to process.
+     * @param onResultFrame Sink invoked once per non-empty result frame.
+     */
+    void processEvent(const std::string& request, const std::function<void(std::string&&)>& onResultFrame) const;
+
 private:
     /**
      * @brief Runs orchestrator, decoding and building context.
      *
-     * @param data Data to process.
-     * @param response Raw data to process.
+     * @param type Scan payload type.
+     * @param request Data to process.
+     * @param emit Sink invoked with the detections of each scanned component.
+     */
+    void run(PayloadType type, const nlohmann::json& request, const std::function<void(nlohmann::json&&)>& emit) const;
+
+    /**
+     * @brief Invalidates the persisted scan state when the feed changes.
+     *
+     * Delta scans are only valid against the feed they were produced with: the method
+     * fingerprints the current feed and wipes the scan state database whenever the
+     * stored fingerprint differs, so the next delta request re-scans every package.
      */
-    void run(PayloadType type, const nlohmann::json& request, std::string& response) const;
+    void ensureScanStateEpoch() const;
 
     std::shared_ptr<DatabaseFeedManager> m_databaseFeedManager;
+    std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_scanStateDatabase;
     mutable std::shared_mutex m_mutex;
+    mutable std::mutex m_scanStateMutex;
 };
 } // namespace vdscanner
 #endif // _SCAN_ORCHESTRATOR_HPP
@@ -13,7 +13,9 @@
 
 #include <base/json.hpp>
 #include <base/logging.hpp>
+#include <base/lruCache.hpp>
 #include <databaseFeedManager.hpp>
+#include <memory>
 #include <string>
 
 /**
@@ -128,6 +130,94 @@ struct CveDescription final
 class DescriptionsHelper final
 {
 private:
+    /**
+     * @brief Owned copies of the serialized records backing a cached description.
+     *
+     * The records are stored verbatim so a cache hit only re-interprets the
+     * flatbuffer in place, without database reads. An empty buffer means the
+     * corresponding record could not be retrieved.
+     */
+    struct CachedDescription final
+    {
+        std::string cvssBuffer;        ///< Record the CVSS metrics were taken from.
+        std::string descriptionBuffer; ///< Record the descriptive fields were taken from.
+    };
+
+    /**
+     * @brief Per-thread cache of resolved descriptions.
+     *
+     * Alert bursts repeat the same hot CVEs and each lookup costs up to three
+     * database reads; the cache is thread-local so the parallel scan workers hit it
+     * without locking.
+     */
+    static LRUCache<std::string, std::shared_ptr<const CachedDescription>>& descriptionCache()
+    {
+        thread_local LRUCache<std::string, std::shared_ptr<const CachedDescription>> cache {512};
+        return cache;
+    }
+
+    /**
+     * @brief Interprets an owned record copy, or nothing when the record is absent.
+     */
+    static const NSVulnerabilityScanner::VulnerabilityDescription* interpretBuffer(const std::string& buffer)
+    {
+        return buffer.empty() ? nullptr
+                              : NSVulnerabilityScanner::GetVulnerabilityDescription(
+                                    reinterpret_cast<const uint8_t*>(buffer.data()));
+    }
+
+    /**
+     * @brief Builds a CveDescription from the resolved CVSS and description records.
+     *
+     * @param cvssRecord Record to take the CVSS metrics from, may be null.
+     * @param descriptionRecord Record to take the descriptive fields from, may be null.
+     * @return CveDescription with views into the given records.
+     */
+    static CveDescription buildDescription(const NSVulnerabilityScanner::VulnerabilityDescription* cvssRecord,
+                                           const NSVulnerabilityScanner::VulnerabilityDescription* descriptionRecord)
+    {
+        // Assign a value to the target variable if the value is not empty
+        const auto assignValue = [](std::string_view& target, const flatbuffers::string_view& value)
+        {
+            if (!value.empty())
+            {
+                target = value;
+            }
+        };
+
+        // Creating struct with default values.
+        CveDescription cveDescription {};
+
+        if (cvssRecord)
+        {
+            assignValue(cveDescription.accessComplexity, cvssRecord->accessComplexity()->string_view());
+            assignValue(cveDescription.attackVector, cvssRecord->attackVector()->string_view());
+            assignValue(cveDescription.authentication, cvssRecord->authentication()->string_view());
+            assignValue(cveDescription.availabilityImpact, cvssRecord->availabilityImpact()->string_view());
+            assignValue(cveDescription.classification, cvssRecord->classification()->string_view());
+            assignValue(cveDescription.confidentialityImpact, cvssRecord->confidentialityImpact()->string_view());
+            assignValue(cveDescription.integrityImpact, cvssRecord->integrityImpact()->string_view());
+            assignValue(cveDescription.privilegesRequired, cvssRecord->privilegesRequired()->string_view());
+            assignValue(cveDescription.scope, cvssRecord->scope()->string_view());
+            assignValue(cveDescription.scoreVersion, cvssRecord->scoreVersion()->string_view());
+            assignValue(cveDescription.severity, cvssRecord->severity()->string_view());
+            assignValue(cveDescription.userInteraction, cvssRecord->userInteraction()->string_view());
+            cveDescription.scoreBase = cvssRecord->scoreBase();
+        }
+
+        if (descriptionRecord)
+        {
+            assignValue(cveDescription.assignerShortName, descriptionRecord->assignerShortName()->string_view());
+            assignValue(cveDescription.cweId, descriptionRecord->cweId()->string_view());
+            assignValue(cveDescription.datePublished, descriptionRecord->datePublished()->string_view());
+            assignValue(cveDescription.dateUpdated, descriptionRecord->dateUpdated()->string_view());
+            assignValue(cveDescription.description, descriptionRecord->description()->string_view());
+            assignValue(cveDescription.reference, descriptionRecord->reference()->string_view());
+        }
+
+        return cveDescription;
+    }
+
     template<typename TDatabaseFeedManager = DatabaseFeedManager>
     static std::pair<const std::string, const std::string>
     cvssAndDescriptionSources(const std::pair<std::string, std::string>& sources,
@@ -176,6 +266,16 @@ public:
                                          std::shared_ptr<TDatabaseFeedManager>& databaseFeedManager,
                                          const std::function<void(const CveDescription&)>& callback)
     {
+        const auto cacheKey = cve + "_" + sources.first + "_" + sources.second;
+        if (const auto cached = descriptionCache().getValue(cacheKey); cached)
+        {
+            // The shared_ptr keeps the owned records alive for the callback even if
+            // the entry is evicted meanwhile.
+            callback(buildDescription(interpretBuffer((*cached)->cvssBuffer),
+                                      interpretBuffer((*cached)->descriptionBuffer)));
+            return;
+        }
+
         FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription> descriptionData;
         FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription> cvssData;
 
@@ -263,48 +363,36 @@ public:
             }
         }
 
-        // Assign a value to the target variable if the value is not empty
-        const auto assignValue = [](std::string_view& target, const flatbuffers::string_view& value)
+        // Store the resolved records for subsequent alerts on the same CVE. Entries
+        // are only cached when the records are backed by their serialized slices, so
+        // a record handed over without its buffer cannot poison the cache.
+        const auto sliceBacked = [](const auto& record) { return record.data == nullptr || record.slice.size() != 0; };
+        if (sliceBacked(descriptionData) && (cvssData.data == descriptionData.data || sliceBacked(cvssData)))
         {
-            if (!value.empty())
+            auto cached = std::make_shared<CachedDescription>();
+            if (descriptionData.data)
             {
-                target = value;
+                cached->descriptionBuffer.assign(descriptionData.slice.data(), descriptionData.slice.size());
             }
-        };
-
-        // Creating struct with default values.
-        CveDescription cveDescription {};
-
-        if (cvssData.data)
-        {
-            assignValue(cveDescription.accessComplexity, cvssData.data->accessComplexity()->string_view());
-            assignValue(cveDescription.attackVector, cvssData.data->attackVector()->string_view());
-            assignValue(cveDescription.authentication, cvssData.data->authentication()->string_view());
-            assignValue(cveDescription.availabilityImpact, cvssData.data->availabilityImpact()->string_view());
-            assignValue(cveDescription.classification, cvssData.data->classification()->string_view());
-            assignValue(cveDescription.confidentialityImpact, cvssData.data->confidentialityImpact()->string_view());
-            assignValue(cveDescription.integrityImpact, cvssData.data->integrityImpact()->string_view());
-            assignValue(cveDescription.privilegesRequired, cvssData.data->privilegesRequired()->string_view());
-            assignValue(cveDescription.scope, cvssData.data->scope()->string_view());
-            assignValue(cveDescription.scoreVersion, cvssData.data->scoreVersion()->string_view());
-            assignValue(cveDescription.severity, cvssData.data->severity()->string_view());
-            assignValue(cveDescription.userInteraction, cvssData.data->userInteraction()->string_view());
-            cveDescription.scoreBase = cvssData.data->scoreBase();
-        }
-
-        if (descriptionData.data)
-        {
-            assignValue(cveDescription.assignerShortName, descriptionData.data->assignerShortName()->string_view());
-            assignValue(cveDescription.cweId, descriptionData.data->cweId()->string_view());
-            assignValue(cveDescription.datePublished, descriptionData.data->datePublished()->string_view());
-            assignValue(cveDescription.dateUpdated, descriptionData.data->dateUpdated()->string_view());
-            assignValue(cveDescription.description, descriptionData.data->description()->string_view());
-            assignValue(cveDescription.reference, descriptionData.data->reference()->string_view());
+            if (cvssData.data)
+            {
+                cached->cvssBuffer = cvssData.data == descriptionData.data
+                                         ? cached->descriptionBuffer
+                                         : std::string(cvssData.slice.data(), cvssData.slice.size());
+            }
+            descriptionCache().insertKey(cacheKey, std::move(cached));
         }
 
         // Call the callback function with the CveDescription object
-        callback(cveDescription);
+        callback(buildDescription(cvssData.data, descriptionData.data));
     }
+
+    /**
+     * @brief Clears the calling thread's description cache.
+     *
+     * @note Intended for tests and for invalidation after a feed replacement.
+     */
+    static void clearCache() { descriptionCache().clear(); }
 };
 
 #endif // _DESCRIPTIONS_HELPER_HPP
@@ -17,6 +17,8 @@
 #include "scanContext.hpp"
 #include "scannerHelper.hpp"
 #include "versionMatcher/versionMatcher.hpp"
+#include <algorithm>
+#include <string_view>
 
 auto constexpr OS_SCANNER_CNA {"nvd"};
 
@@ -54,8 +56,6 @@ public:
     // LCOV_EXCL_START
     std::shared_ptr<ScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        const auto hotfixes = data->hotfixes();
-
         const auto osCPE = ScannerHelper::parseCPE(data->osCPEName(m_databaseFeedManager->cpeMappings()).data());
 
         auto vulnerabilityScan = [&, functionName = logging::getLambdaName(__FUNCTION__, "vulnerabilityScan")](
@@ -66,9 +66,12 @@ public:
             try
             {
                 VersionObjectType objectType = VersionObjectType::DPKG;
+                // The installed OS version takes part in every comparison below, so it is
+                // parsed once up front and only the candidate constraints hit the parser cache.
+                const std::string osVersion {data->osVersion()};
+                const auto osVersionObject = VersionMatcher::parse(osVersion, objectType);
                 for (const auto& version : *callbackData.versions())
                 {
-                    const std::string osVersion {data->osVersion()};
                     std::string versionString {version->version() ? version->version()->str() : ""};
                     std::string versionStringLessThan {version->lessThan() ? version->lessThan()->str() : ""};
                     std::string versionStringLessThanOrEqual {
@@ -88,7 +91,7 @@ public:
                     // No version range specified, check if the installed version is equal to the required version.
                     if (versionStringLessThan.empty() && versionStringLessThanOrEqual.empty())
                     {
-                        if (VersionMatcher::compare(osVersion, versionString, objectType)
+                        if (VersionMatcher::compare(osVersionObject, versionString, objectType)
                             == VersionComparisonResult::A_EQUAL_B)
                         {
                             // Version match found, the package status is defined by the vulnerability status.
@@ -125,7 +128,7 @@ public:
                         }
                         else
                         {
-                            const auto matchResult = VersionMatcher::compare(osVersion, versionString, objectType);
+                            const auto matchResult = VersionMatcher::compare(osVersionObject, versionString, objectType);
                             lowerBoundMatch = matchResult == VersionComparisonResult::A_GREATER_THAN_B
                                               || matchResult == VersionComparisonResult::A_EQUAL_B;
                         }
@@ -137,13 +140,13 @@ public:
                             if (!versionStringLessThan.empty() && versionStringLessThan.compare("*") != 0)
                             {
                                 const auto matchResult =
-                                    VersionMatcher::compare(osVersion, versionStringLessThan, objectType);
+                                    VersionMatcher::compare(osVersionObject, versionStringLessThan, objectType);
                                 upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B;
                             }
                             else if (!versionStringLessThanOrEqual.empty())
                             {
                                 const auto matchResult =
-                                    VersionMatcher::compare(osVersion, versionStringLessThanOrEqual, objectType);
+                                    VersionMatcher::compare(osVersionObject, versionStringLessThanOrEqual, objectType);
                                 upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B
                                                   || matchResult == VersionComparisonResult::A_EQUAL_B;
                             }
@@ -283,16 +286,14 @@ public:
                                 continue;
                             }
 
+                            const auto& sortedHotfixes = data->sortedHotfixes();
                             for (const auto& remediation : *(remediations.data->updates()))
                             {
-                                // Delete element if the update is already installed
-                                if (std::find_if(hotfixes.begin(),
-                                                 hotfixes.end(),
-                                                 [&](const auto& element) {
-                                                     return element.template get_ref<const std::string&>()
-                                                            == remediation->str();
-                                                 })
-                                    != hotfixes.end())
+                                // Delete element if the update is already installed. The hotfixes
+                                // are a sorted run, so each probe is a binary search.
+                                if (std::binary_search(sortedHotfixes.begin(),
+                                                       sortedHotfixes.end(),
+                                                       std::string_view {remediation->c_str(), remediation->size()}))
                                 {
                                     LOG_DEBUG("Remediation for OS '{}' on Agent '{}' has been found. CVE: '{}', "
                                               "Remediation: '{}'.",
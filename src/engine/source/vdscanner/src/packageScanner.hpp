@@ -19,7 +19,10 @@
 #include "scanContext.hpp"
 #include "scannerHelper.hpp"
 #include "versionMatcher/versionMatcher.hpp"
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <string_view>
 #include <variant>
 
 auto constexpr L1_CACHE_SIZE {2048};
@@ -56,6 +59,13 @@ private:
 
     std::shared_ptr<TDatabaseFeedManager> m_databaseFeedManager;
 
+    /**
+     * @brief Serializes the detection writes on the shared scan context. The feed manager may
+     * evaluate the candidates of a package concurrently, and only the few confirmed matches reach
+     * these maps, so the lock is rarely contended.
+     */
+    std::mutex m_detectionsMutex;
+
     /**
      * @brief Scans package translation for vulnerabilities.
      *
@@ -327,9 +337,13 @@ private:
             objectType = it->second;
         }
 
+        // The installed version takes part in every comparison below, so it is parsed
+        // once up front and only the candidate constraints go through the parser cache.
+        const std::string packageVersion {package.version};
+        const auto packageVersionObject = VersionMatcher::parse(packageVersion, objectType);
+
         for (const auto& version : *callbackData.versions())
         {
-            const std::string packageVersion {package.version};
             std::string versionString {version->version() ? version->version()->str() : ""};
             std::string versionStringLessThan {version->lessThan() ? version->lessThan()->str() : ""};
             std::string versionStringLessThanOrEqual {version->lessThanOrEqual() ? version->lessThanOrEqual()->str()
@@ -348,7 +362,7 @@ private:
             // No version range specified, check if the installed version is equal to the required version.
             if (versionStringLessThan.empty() && versionStringLessThanOrEqual.empty())
             {
-                if (VersionMatcher::compare(packageVersion, versionString, objectType)
+                if (VersionMatcher::compare(packageVersionObject, versionString, objectType)
                     == VersionComparisonResult::A_EQUAL_B)
                 {
                     // Version match found, the package status is defined by the vulnerability status.
@@ -364,6 +378,7 @@ private:
                                   contextData->agentId(),
                                   contextData->agentVersion());
 
+                        std::lock_guard<std::mutex> lock(m_detectionsMutex);
                         contextData->m_elements[callbackData.cveId()->str()] = nlohmann::json::object();
                         contextData->m_matchConditions[callbackData.cveId()->str()] = {std::move(versionString),
                                                                                        MatchRuleCondition::Equal};
@@ -385,7 +400,7 @@ private:
                 }
                 else
                 {
-                    const auto matchResult = VersionMatcher::compare(packageVersion, versionString, objectType);
+                    const auto matchResult = VersionMatcher::compare(packageVersionObject, versionString, objectType);
                     lowerBoundMatch = matchResult == VersionComparisonResult::A_GREATER_THAN_B
                                       || matchResult == VersionComparisonResult::A_EQUAL_B;
                 }
@@ -397,13 +412,13 @@ private:
                     if (!versionStringLessThan.empty() && versionStringLessThan.compare("*") != 0)
                     {
                         const auto matchResult =
-                            VersionMatcher::compare(packageVersion, versionStringLessThan, objectType);
+                            VersionMatcher::compare(packageVersionObject, versionStringLessThan, objectType);
                         upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B;
                     }
                     else if (!versionStringLessThanOrEqual.empty())
                     {
                         const auto matchResult =
-                            VersionMatcher::compare(packageVersion, versionStringLessThanOrEqual, objectType);
+                            VersionMatcher::compare(packageVersionObject, versionStringLessThanOrEqual, objectType);
                         upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B
                                           || matchResult == VersionComparisonResult::A_EQUAL_B;
                     }
@@ -429,6 +444,7 @@ private:
                                       contextData->agentId(),
                                       contextData->agentVersion());
 
+                            std::lock_guard<std::mutex> lock(m_detectionsMutex);
                             contextData->m_elements[callbackData.cveId()->str()] = nlohmann::json::object();
 
                             if (!versionStringLessThanOrEqual.empty())
@@ -474,6 +490,7 @@ private:
                       contextData->agentId(),
                       contextData->agentVersion());
 
+            std::lock_guard<std::mutex> lock(m_detectionsMutex);
             contextData->m_elements[callbackData.cveId()->str()] = nlohmann::json::object();
             contextData->m_matchConditions[callbackData.cveId()->str()] = {"", MatchRuleCondition::DefaultStatus};
             return true;
@@ -502,7 +519,7 @@ private:
         }
 
         // Check that the agent has remediation data.
-        auto agentRemediations = contextData->hotfixes();
+        const auto& agentRemediations = contextData->sortedHotfixes();
         if (agentRemediations.empty())
         {
             LOG_DEBUG("No remediations for agent '{}' have been found.", contextData->agentId());
@@ -511,21 +528,21 @@ private:
 
         for (const auto& remediation : *(remediations.data->updates()))
         {
-            // Check if the remediation is installed on the agent.
-            for (const auto& hotfix : agentRemediations)
+            // Check if the remediation is installed on the agent: the hotfixes are a sorted run, so
+            // each probe is a binary search instead of a walk of the whole list.
+            const std::string_view remediationView {remediation->c_str(), remediation->size()};
+            if (std::binary_search(agentRemediations.begin(), agentRemediations.end(), remediationView))
             {
-                if (hotfix.template get_ref<const std::string&>().compare(remediation->str()) == 0)
-                {
-                    LOG_DEBUG("Remediation '{}' for package '{}' on agent '{}' that solves CVE '{}' has been found.",
-                              remediation->str(),
-                              package.name,
-                              contextData->agentId(),
-                              callbackData.cveId()->str());
+                LOG_DEBUG("Remediation '{}' for package '{}' on agent '{}' that solves CVE '{}' has been found.",
+                          remediation->str(),
+                          package.name,
+                          contextData->agentId(),
+                          callbackData.cveId()->str());
 
-                    contextData->m_elements.erase(callbackData.cveId()->str());
-                    contextData->m_matchConditions.erase(callbackData.cveId()->str());
-                    return true;
-                }
+                std::lock_guard<std::mutex> lock(m_detectionsMutex);
+                contextData->m_elements.erase(callbackData.cveId()->str());
+                contextData->m_matchConditions.erase(callbackData.cveId()->str());
+                return true;
             }
         }
 
@@ -13,8 +13,13 @@
 #define _SCAN_CONTEXT_HPP
 
 #include "base/utils/stringUtils.hpp"
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
+#include <vector>
 
 auto constexpr DEFAULT_CNA {"nvd"};
 
@@ -84,12 +89,46 @@ public:
                          const nlohmann::json& hotfixes,
                          nlohmann::json& response)
         : m_type {type}
-        , packageData {package}
-        , agentData {agent}
-        , osData {os}
-        , hotfixesData {hotfixes}
-        , responseData {response}
+        , packageData {&package}
+        , agentData {&agent}
+        , osData {&os}
+        , hotfixesData {&hotfixes}
+        , responseData {&response}
     {
+        rebuildHotfixIndex();
+    }
+
+    /**
+     * @brief Rebind the context to a new scan, keeping allocated capacity.
+     *
+     * The per-scan containers are cleared (their buckets survive), so a pooled
+     * context reused across packages skips the allocations a fresh one pays.
+     *
+     * @param type Scanner type.
+     * @param agent Agent data.
+     * @param os OS data.
+     * @param package Package data.
+     * @param hotfixes Hotfixes data.
+     * @param response Response output array.
+     */
+    void reset(const ScannerType type,
+               const nlohmann::json& agent,
+               const nlohmann::json& os,
+               const nlohmann::json& package,
+               const nlohmann::json& hotfixes,
+               nlohmann::json& response)
+    {
+        m_type = type;
+        packageData = &package;
+        agentData = &agent;
+        osData = &os;
+        hotfixesData = &hotfixes;
+        responseData = &response;
+        m_elements.clear();
+        m_matchConditions.clear();
+        m_vulnerabilitySource = std::make_pair(DEFAULT_CNA, DEFAULT_CNA);
+        m_osCPE.clear();
+        rebuildHotfixIndex();
     }
 
     // LCOV_EXCL_START
@@ -106,8 +145,8 @@ public:
      */
     std::string_view packageName() const
     {
-        return packageData.contains("/name"_json_pointer)
-                   ? packageData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/name"_json_pointer)
+                   ? packageData->at("/name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -117,8 +156,8 @@ public:
      */
     std::string_view packageVersion() const
     {
-        return packageData.contains("/version"_json_pointer)
-                   ? packageData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/version"_json_pointer)
+                   ? packageData->at("/version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -128,8 +167,8 @@ public:
      */
     std::string_view packageVendor() const
     {
-        return packageData.contains("/vendor"_json_pointer)
-                   ? packageData.at("/vendor"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/vendor"_json_pointer)
+                   ? packageData->at("/vendor"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -139,8 +178,8 @@ public:
      */
     std::string_view packageInstallTime() const
     {
-        return packageData.contains("/install_time"_json_pointer)
-                   ? packageData.at("/install_time"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/install_time"_json_pointer)
+                   ? packageData->at("/install_time"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -150,8 +189,8 @@ public:
      */
     std::string_view packageLocation() const
     {
-        return packageData.contains("/location"_json_pointer)
-                   ? packageData.at("/location"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/location"_json_pointer)
+                   ? packageData->at("/location"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -161,8 +200,8 @@ public:
      */
     std::string_view packageArchitecture() const
     {
-        return packageData.contains("/architecture"_json_pointer)
-                   ? packageData.at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/architecture"_json_pointer)
+                   ? packageData->at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -172,8 +211,8 @@ public:
      */
     std::string_view packageGroups() const
     {
-        return packageData.contains("/groups"_json_pointer)
-                   ? packageData.at("/groups"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/groups"_json_pointer)
+                   ? packageData->at("/groups"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -183,8 +222,8 @@ public:
      */
     std::string_view packageDescription() const
     {
-        return packageData.contains("/description"_json_pointer)
-                   ? packageData.at("/description"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/description"_json_pointer)
+                   ? packageData->at("/description"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -194,7 +233,7 @@ public:
      */
     uint64_t packageSize() const
     {
-        return packageData.contains("/size"_json_pointer) ? packageData.at("/size"_json_pointer).get<uint64_t>() : 0;
+        return packageData->contains("/size"_json_pointer) ? packageData->at("/size"_json_pointer).get<uint64_t>() : 0;
     }
 
     /**
@@ -203,8 +242,8 @@ public:
      */
     std::string_view packagePriority() const
     {
-        return packageData.contains("/priority"_json_pointer)
-                   ? packageData.at("/priority"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/priority"_json_pointer)
+                   ? packageData->at("/priority"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -214,8 +253,8 @@ public:
      */
     std::string_view packageMultiarch() const
     {
-        return packageData.contains("/multiarch"_json_pointer)
-                   ? packageData.at("/multiarch"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/multiarch"_json_pointer)
+                   ? packageData->at("/multiarch"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -225,8 +264,8 @@ public:
      */
     std::string_view packageSource() const
     {
-        return packageData.contains("/source"_json_pointer)
-                   ? packageData.at("/source"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/source"_json_pointer)
+                   ? packageData->at("/source"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -236,8 +275,8 @@ public:
      */
     std::string_view packageFormat() const
     {
-        return packageData.contains("/format"_json_pointer)
-                   ? packageData.at("/format"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/format"_json_pointer)
+                   ? packageData->at("/format"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -247,8 +286,8 @@ public:
      */
     std::string_view packageItemId() const
     {
-        return packageData.contains("/item_id"_json_pointer)
-                   ? packageData.at("/item_id"_json_pointer).get_ref<const std::string&>().c_str()
+        return packageData->contains("/item_id"_json_pointer)
+                   ? packageData->at("/item_id"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -258,8 +297,8 @@ public:
      */
     std::string_view agentId() const
     {
-        return agentData.contains("/id"_json_pointer)
-                   ? agentData.at("/id"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/id"_json_pointer)
+                   ? agentData->at("/id"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -270,8 +309,8 @@ public:
      */
     std::string_view agentIp() const
     {
-        return agentData.contains("/ip"_json_pointer)
-                   ? agentData.at("/ip"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/ip"_json_pointer)
+                   ? agentData->at("/ip"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -282,8 +321,8 @@ public:
      */
     std::string_view agentName() const
     {
-        return agentData.contains("/name"_json_pointer)
-                   ? agentData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/name"_json_pointer)
+                   ? agentData->at("/name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -294,8 +333,8 @@ public:
      */
     std::string_view agentVersion() const
     {
-        return agentData.contains("/version"_json_pointer)
-                   ? agentData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
+        return agentData->contains("/version"_json_pointer)
+                   ? agentData->at("/version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -305,8 +344,8 @@ public:
      */
     std::string_view osHostName() const
     {
-        return osData.contains("/hostname"_json_pointer)
-                   ? osData.at("/hostname"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/hostname"_json_pointer)
+                   ? osData->at("/hostname"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -316,8 +355,8 @@ public:
      */
     std::string_view osArchitecture() const
     {
-        return osData.contains("/architecture"_json_pointer)
-                   ? osData.at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/architecture"_json_pointer)
+                   ? osData->at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -327,8 +366,8 @@ public:
      */
     std::string_view osName() const
     {
-        return osData.contains("/name"_json_pointer)
-                   ? osData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/name"_json_pointer)
+                   ? osData->at("/name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -338,8 +377,8 @@ public:
      */
     std::string_view osVersion() const
     {
-        return osData.contains("/version"_json_pointer)
-                   ? osData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/version"_json_pointer)
+                   ? osData->at("/version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -349,8 +388,8 @@ public:
      */
     std::string_view osCodeName() const
     {
-        return osData.contains("/codename"_json_pointer)
-                   ? osData.at("/codename"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/codename"_json_pointer)
+                   ? osData->at("/codename"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -360,8 +399,8 @@ public:
      */
     std::string_view osMajorVersion() const
     {
-        return osData.contains("/major_version"_json_pointer)
-                   ? osData.at("/major_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/major_version"_json_pointer)
+                   ? osData->at("/major_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -371,8 +410,8 @@ public:
      */
     std::string_view osMinorVersion() const
     {
-        return osData.contains("/minor_version"_json_pointer)
-                   ? osData.at("/minor_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/minor_version"_json_pointer)
+                   ? osData->at("/minor_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -382,8 +421,8 @@ public:
      */
     std::string_view osPatch() const
     {
-        return osData.contains("/patch"_json_pointer)
-                   ? osData.at("/patch"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/patch"_json_pointer)
+                   ? osData->at("/patch"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -393,8 +432,8 @@ public:
      */
     std::string_view osBuild() const
     {
-        return osData.contains("/build"_json_pointer)
-                   ? osData.at("/build"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/build"_json_pointer)
+                   ? osData->at("/build"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -404,8 +443,8 @@ public:
      */
     std::string_view osPlatform() const
     {
-        return osData.contains("/platform"_json_pointer)
-                   ? osData.at("/platform"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/platform"_json_pointer)
+                   ? osData->at("/platform"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -415,8 +454,8 @@ public:
      */
     std::string_view osKernelSysName() const
     {
-        return osData.contains("/kernel_name"_json_pointer)
-                   ? osData.at("/kernel_name"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/kernel_name"_json_pointer)
+                   ? osData->at("/kernel_name"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -426,8 +465,8 @@ public:
      */
     std::string_view osKernelRelease() const
     {
-        return osData.contains("/kernel_release"_json_pointer)
-                   ? osData.at("/kernel_release"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/kernel_release"_json_pointer)
+                   ? osData->at("/kernel_release"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -437,8 +476,8 @@ public:
      */
     std::string_view osKernelVersion() const
     {
-        return osData.contains("/kernel_version"_json_pointer)
-                   ? osData.at("/kernel_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/kernel_version"_json_pointer)
+                   ? osData->at("/kernel_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -448,8 +487,8 @@ public:
      */
     std::string_view osRelease() const
     {
-        return osData.contains("/release"_json_pointer)
-                   ? osData.at("/release"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/release"_json_pointer)
+                   ? osData->at("/release"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -459,8 +498,8 @@ public:
      */
     std::string_view osDisplayVersion() const
     {
-        return osData.contains("/display_version"_json_pointer)
-                   ? osData.at("/display_version"_json_pointer).get_ref<const std::string&>().c_str()
+        return osData->contains("/display_version"_json_pointer)
+                   ? osData->at("/display_version"_json_pointer).get_ref<const std::string&>().c_str()
                    : "";
     }
 
@@ -518,7 +557,18 @@ public:
      *
      * @return std::string_view hotfix identifier.
      */
-    const nlohmann::json& hotfixes() const { return hotfixesData; }
+    const nlohmann::json& hotfixes() const { return *hotfixesData; }
+
+    /**
+     * @brief Agent hotfixes as a sorted run, built once when the context is bound.
+     *
+     * Remediation checks probe this list once per CVE remediation, so the lookup is a binary search
+     * instead of a linear walk of the hotfix array. The views point into the bound hotfixes JSON
+     * and stay valid for the lifetime of the scan.
+     *
+     * @return Sorted agent hotfix identifiers.
+     */
+    const std::vector<std::string_view>& sortedHotfixes() const { return m_sortedHotfixes; }
 
     /**
      * @brief Elements to process.
@@ -546,16 +596,116 @@ public:
      * @brief Move response data.
      * @param data Data to append.
      */
-    void moveResponseData(nlohmann::json& data) { responseData.push_back(std::move(data)); }
+    void moveResponseData(nlohmann::json& data) { responseData->push_back(std::move(data)); }
 
 private:
-    const ScannerType m_type;
-    const nlohmann::json& packageData;
-    const nlohmann::json& agentData;
-    const nlohmann::json& osData;
-    const nlohmann::json& hotfixesData;
-    nlohmann::json& responseData;
+    /**
+     * @brief Rebuild the sorted hotfix run over the bound hotfixes JSON.
+     *
+     */
+    void rebuildHotfixIndex()
+    {
+        m_sortedHotfixes.clear();
+        if (hotfixesData->is_array())
+        {
+            m_sortedHotfixes.reserve(hotfixesData->size());
+            for (const auto& hotfix : *hotfixesData)
+            {
+                if (hotfix.is_string())
+                {
+                    m_sortedHotfixes.emplace_back(hotfix.get_ref<const std::string&>());
+                }
+            }
+            std::sort(m_sortedHotfixes.begin(), m_sortedHotfixes.end());
+        }
+    }
+
+    ScannerType m_type;
+    const nlohmann::json* packageData;
+    const nlohmann::json* agentData;
+    const nlohmann::json* osData;
+    const nlohmann::json* hotfixesData;
+    nlohmann::json* responseData;
     std::string m_osCPE;
+    std::vector<std::string_view> m_sortedHotfixes;
+};
+
+/**
+ * @brief Pool of reusable ScanContext objects.
+ *
+ * Fleet-wide rescans build one context per package; pooling them turns the
+ * per-scan shared_ptr/object allocation and the hash-map bucket allocations into
+ * a rebind of the handful of hot fields (scanner type and data pointers), while
+ * the cold JSON views stay where they always were: in the request, accessed on
+ * first use. Released contexts return to the pool automatically; the pool must
+ * outlive every context it hands out.
+ */
+class ScanContextPool final
+{
+public:
+    ScanContextPool() = default;
+    ~ScanContextPool() = default;
+    ScanContextPool(const ScanContextPool&) = delete;
+    ScanContextPool& operator=(const ScanContextPool&) = delete;
+
+    /**
+     * @brief Acquire a context bound to the given scan data.
+     *
+     * @param type Scanner type.
+     * @param agent Agent data.
+     * @param os OS data.
+     * @param package Package data.
+     * @param hotfixes Hotfixes data.
+     * @param response Response output array.
+     * @return std::shared_ptr<ScanContext> Context returning to the pool on release.
+     */
+    std::shared_ptr<ScanContext> acquire(const ScannerType type,
+                                         const nlohmann::json& agent,
+                                         const nlohmann::json& os,
+                                         const nlohmann::json& package,
+                                         const nlohmann::json& hotfixes,
+                                         nlohmann::json& response)
+    {
+        std::unique_ptr<ScanContext> context;
+
+        {
+            std::lock_guard lock(m_mutex);
+            if (!m_free.empty())
+            {
+                context = std::move(m_free.back());
+                m_free.pop_back();
+            }
+        }
+
+        if (context)
+        {
+            context->reset(type, agent, os, package, hotfixes, response);
+        }
+        else
+        {
+            context = std::make_unique<ScanContext>(type, agent, os, package, hotfixes, response);
+        }
+
+        return {context.release(),
+                [this](ScanContext* released)
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_free.emplace_back(released);
+                }};
+    }
+
+    /**
+     * @brief Contexts currently parked in the pool.
+     */
+    size_t size() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_free.size();
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ScanContext>> m_free;
 };
 
 #endif // _SCAN_CONTEXT_HPP
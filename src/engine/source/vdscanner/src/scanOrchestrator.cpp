@@ -3,68 +3,248 @@
 #include "factoryOrchestrator.hpp"
 #include "scanContext.hpp"
 
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 using namespace vdscanner;
 
 static const std::map<std::string, PayloadType, std::less<>> SCAN_TYPE {{"packagelist", PayloadType::PackageList},
-                                                                        {"fullscan", PayloadType::FullScan}};
+                                                                        {"fullscan", PayloadType::FullScan},
+                                                                        {"deltascan", PayloadType::Delta}};
+
+// Package count under which the sequential path is cheaper than spawning workers.
+constexpr std::size_t PARALLEL_SCAN_MIN_PACKAGES {64};
+
+const std::filesystem::path SCAN_STATE_DB_PATH {"/var/lib/wazuh-server/vd/scan_state"}; //< Persisted delta scan state.
+constexpr auto SCAN_STATE_COLUMN {"scan_state"}; //< Column with per-host package scan results.
+constexpr auto FEED_EPOCH_KEY {"FEED-EPOCH"};    //< Key with the feed fingerprint the state was built against.
 
 ScanOrchestrator::ScanOrchestrator()
 {
     // Database feed manager initialization.
     m_databaseFeedManager = std::make_shared<DatabaseFeedManager>(m_mutex);
 
+    // Scan state database initialization. The state is a cache, so a corrupted
+    // database is discarded and rebuilt instead of aborting the module.
+    try
+    {
+        m_scanStateDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(SCAN_STATE_DB_PATH, false);
+    }
+    catch (const std::exception& ex)
+    {
+        LOG_WARNING("Error opening the scan state database: {}, recreating it.", ex.what());
+        std::filesystem::remove_all(SCAN_STATE_DB_PATH);
+        m_scanStateDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(SCAN_STATE_DB_PATH, false);
+    }
+
     LOG_DEBUG("Vulnerability scanner module started");
 }
 
+void ScanOrchestrator::ensureScanStateEpoch() const
+{
+    // Fingerprint the feed through its global maps: any feed update rewrites them,
+    // and a feed change invalidates every cached package result.
+    const auto feedEpoch = std::to_string(
+        std::hash<std::string> {}(m_databaseFeedManager->cnaMappings().dump() + m_databaseFeedManager->vendorsMap().dump()));
+
+    std::string storedEpoch;
+    if (!m_scanStateDatabase->get(FEED_EPOCH_KEY, storedEpoch) || storedEpoch != feedEpoch)
+    {
+        LOG_DEBUG("Feed fingerprint changed, discarding the persisted scan state.");
+        m_scanStateDatabase->deleteAll();
+        m_scanStateDatabase->put(FEED_EPOCH_KEY, feedEpoch);
+    }
+
+    if (!m_scanStateDatabase->columnExists(SCAN_STATE_COLUMN))
+    {
+        m_scanStateDatabase->createColumn(SCAN_STATE_COLUMN);
+    }
+}
+
 void ScanOrchestrator::processEvent(const std::string& request, std::string& response) const
 {
     const auto& requestDeserialized = nlohmann::json::parse(request);
     const auto& scanType = requestDeserialized.at("type").get_ref<const std::string&>();
-    run(SCAN_TYPE.at(scanType), requestDeserialized, response);
+
+    // Buffered mode: merge every frame into one flat array of detections.
+    nlohmann::json responseJson = nlohmann::json::array();
+    run(SCAN_TYPE.at(scanType),
+        requestDeserialized,
+        [&responseJson](nlohmann::json&& frame)
+        {
+            for (auto& element : frame)
+            {
+                responseJson.push_back(std::move(element));
+            }
+        });
+    response = responseJson.dump();
 
     LOG_DEBUG("Event type: {} processed", scanType);
 }
 
-void ScanOrchestrator::run(const PayloadType type, const nlohmann::json& request, std::string& response) const
+void ScanOrchestrator::processEvent(const std::string& request,
+                                    const std::function<void(std::string&&)>& onResultFrame) const
+{
+    const auto& requestDeserialized = nlohmann::json::parse(request);
+    const auto& scanType = requestDeserialized.at("type").get_ref<const std::string&>();
+
+    // Streaming mode: serialize and hand off each frame as soon as its component is scanned.
+    run(SCAN_TYPE.at(scanType),
+        requestDeserialized,
+        [&onResultFrame](nlohmann::json&& frame) { onResultFrame(frame.dump()); });
+
+    LOG_DEBUG("Event type: {} processed", scanType);
+}
+
+void ScanOrchestrator::run(const PayloadType type,
+                           const nlohmann::json& request,
+                           const std::function<void(nlohmann::json&&)>& emit) const
 {
     auto static osScan = FactoryOrchestrator::create(ScannerType::Os, m_databaseFeedManager);
     auto static packageScan = FactoryOrchestrator::create(ScannerType::Package, m_databaseFeedManager);
+    // Contexts are pooled: each scan rebinds a recycled context instead of
+    // allocating a fresh one (and its hash-map buckets) per package.
+    static ScanContextPool contextPool;
+
+    if (type != PayloadType::FullScan && type != PayloadType::PackageList && type != PayloadType::Delta)
+    {
+        throw std::invalid_argument("Invalid scan type");
+    }
 
     // This locks the mutex to avoid scanning during the feed update processing.
     std::shared_lock lock(m_mutex);
-    nlohmann::json responseJson;
+
+    // Hand a frame to the sink, skipping components without detections.
+    const auto emitFrame = [&emit](nlohmann::json&& frame)
+    {
+        if (!frame.empty())
+        {
+            emit(std::move(frame));
+        }
+    };
 
     if (type == PayloadType::FullScan)
     {
-        osScan->handleRequest(std::make_shared<ScanContext>(
-            ScannerType::Os, request.at("agent"), request.at("os"), nullptr, request.at("hotfixes"), responseJson));
+        nlohmann::json osResponse = nlohmann::json::array();
+        osScan->handleRequest(contextPool.acquire(
+            ScannerType::Os, request.at("agent"), request.at("os"), nullptr, request.at("hotfixes"), osResponse));
+        emitFrame(std::move(osResponse));
+    }
+
+    const auto& packages = request.at("packages");
 
-        for (const auto& package : request.at("packages"))
+    if (type == PayloadType::Delta)
+    {
+        // Delta scans carry only the packages that changed on the host, so they run
+        // sequentially and reuse persisted per-package results when available. The
+        // state database is serialized: delta requests are small by construction.
+        std::lock_guard stateLock(m_scanStateMutex);
+        ensureScanStateEpoch();
+
+        const auto& agentId = request.at("agent").at("id").get_ref<const std::string&>();
+        for (const auto& package : packages)
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            // nlohmann dumps with sorted keys, so the hash changes with any field.
+            const auto stateKey = agentId + "_" + std::to_string(std::hash<std::string> {}(package.dump()));
+
+            std::string cachedResult;
+            if (m_scanStateDatabase->get(stateKey, cachedResult, SCAN_STATE_COLUMN))
+            {
+                emitFrame(nlohmann::json::parse(cachedResult));
+                continue;
+            }
+
+            nlohmann::json packageResponse = nlohmann::json::array();
+            packageScan->handleRequest(contextPool.acquire(ScannerType::Package,
+                                                           request.at("agent"),
+                                                           request.at("os"),
+                                                           package,
+                                                           request.at("hotfixes"),
+                                                           packageResponse));
+            m_scanStateDatabase->put(stateKey, packageResponse.dump(), SCAN_STATE_COLUMN);
+
+            emitFrame(std::move(packageResponse));
         }
+
+        return;
     }
-    else if (type == PayloadType::PackageList)
+
+    const auto workerCount =
+        std::min<std::size_t>(std::max<std::size_t>(std::thread::hardware_concurrency(), 1),
+                              packages.size() / PARALLEL_SCAN_MIN_PACKAGES + 1);
+
+    if (workerCount <= 1)
     {
-        for (const auto& package : request.at("packages"))
+        for (const auto& package : packages)
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            nlohmann::json packageResponse = nlohmann::json::array();
+            packageScan->handleRequest(contextPool.acquire(ScannerType::Package,
+                                                           request.at("agent"),
+                                                           request.at("os"),
+                                                           package,
+                                                           request.at("hotfixes"),
+                                                           packageResponse));
+            emitFrame(std::move(packageResponse));
         }
     }
     else
     {
-        throw std::invalid_argument("Invalid scan type");
-    }
+        // Shard the package list across a worker pool. Each worker runs its own scanner
+        // chain over the shared feed database and hands each package's detections to the
+        // sink as soon as they are ready, so a streaming consumer starts processing while
+        // the scan is still running and no worker accumulates more than one package.
+        std::mutex emitMutex;
+        std::vector<std::exception_ptr> workerErrors(workerCount);
+        std::vector<std::thread> workers;
+        workers.reserve(workerCount);
 
-    response = responseJson.dump();
+        for (std::size_t w = 0; w < workerCount; ++w)
+        {
+            workers.emplace_back(
+                [&, w]()
+                {
+                    try
+                    {
+                        auto workerScan = FactoryOrchestrator::create(ScannerType::Package, m_databaseFeedManager);
+                        for (std::size_t i = w; i < packages.size(); i += workerCount)
+                        {
+                            nlohmann::json packageResponse = nlohmann::json::array();
+                            workerScan->handleRequest(contextPool.acquire(ScannerType::Package,
+                                                                          request.at("agent"),
+                                                                          request.at("os"),
+                                                                          packages.at(i),
+                                                                          request.at("hotfixes"),
+                                                                          packageResponse));
+
+                            if (!packageResponse.empty())
+                            {
+                                std::lock_guard<std::mutex> emitLock(emitMutex);
+                                emit(std::move(packageResponse));
+                            }
+                        }
+                    }
+                    catch (...)
+                    {
+                        workerErrors.at(w) = std::current_exception();
+                    }
+                });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (const auto& error : workerErrors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
 }
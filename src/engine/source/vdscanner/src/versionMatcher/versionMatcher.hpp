@@ -19,6 +19,7 @@
 #include "versionObjectPEP440.hpp"
 #include "versionObjectRpm.hpp"
 #include "versionObjectSemVer.hpp"
+#include <base/lruCache.hpp>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -242,7 +243,64 @@ private:
         }
     }
 
+    /**
+     * @brief Creates a version object, interning the parse result.
+     *
+     * Constraint strings repeat heavily across the CVE candidates of a feed and the
+     * installed version repeats across every comparison of a package, so the parse runs
+     * once per distinct (version, type) pair and later lookups are hash hits. Failed
+     * parses are interned too (as nullptr) so unparseable strings are not re-tried.
+     * The cache is per thread, so parallel scans hit it without locking.
+     *
+     * @param version string version item to create object from
+     * @param type Version object or matcher strategy.
+     * @return std::shared_ptr<IVersionObject>
+     */
+    static std::shared_ptr<IVersionObject>
+    createVersionObjectCached(const std::string& version,
+                              const std::variant<VersionObjectType, VersionMatcherStrategy>& type)
+    {
+        constexpr size_t PARSED_VERSION_CACHE_CAPACITY {16384};
+        thread_local LRUCache<std::string, std::shared_ptr<IVersionObject>> parsedCache {
+            PARSED_VERSION_CACHE_CAPACITY};
+
+        std::string cacheKey;
+        cacheKey.reserve(version.size() + 4);
+        cacheKey += std::holds_alternative<VersionObjectType>(type)
+                        ? 'T' + std::to_string(static_cast<int>(std::get<VersionObjectType>(type)))
+                        : 'S' + std::to_string(static_cast<int>(std::get<VersionMatcherStrategy>(type)));
+        cacheKey += '_';
+        cacheKey += version;
+
+        if (const auto cached = parsedCache.getValue(cacheKey); cached.has_value())
+        {
+            return cached.value();
+        }
+
+        auto object = createVersionObject(version, type);
+        parsedCache.insertKey(cacheKey, object);
+        return object;
+    }
+
 public:
+    /**
+     * @brief Parses a version string into a reusable version object.
+     *
+     * Parse once and hand the result to the pre-parsed compare() overload when the
+     * same version takes part in many comparisons, such as the installed version of a
+     * package checked against every CVE candidate.
+     *
+     * @param version string version item to parse.
+     * @param type Version object or matcher strategy.
+     * @return std::shared_ptr<IVersionObject> Parsed version, nullptr if unparseable.
+     */
+    static std::shared_ptr<IVersionObject>
+    parse(const std::string& version,
+          std::variant<VersionObjectType, VersionMatcherStrategy> type = VersionMatcherStrategy::Unspecified)
+    {
+        return createVersionObjectCached(version, type);
+    }
+
     /**
      * @brief Compares 2 version strings.
      *
@@ -256,8 +314,8 @@ public:
             const std::string& versionB,
             std::variant<VersionObjectType, VersionMatcherStrategy> type = VersionMatcherStrategy::Unspecified)
     {
-        auto pVersionObjectA = createVersionObject(versionA, type);
-        auto pVersionObjectB = createVersionObject(versionB, type);
+        auto pVersionObjectA = createVersionObjectCached(versionA, type);
+        auto pVersionObjectB = createVersionObjectCached(versionB, type);
 
         if (pVersionObjectA && pVersionObjectB && pVersionObjectA->getType() == pVersionObjectB->getType())
         {
@@ -279,6 +337,44 @@ public:
         throw std::invalid_argument("Unable to compare versions (" + versionA + " vs " + versionB + ").");
     }
 
+    /**
+     * @brief Compares a pre-parsed version against a version string.
+     *
+     * The hot loop variant of compare(): the left-hand side is parsed once with parse()
+     * and only the right-hand side goes through the (cached) parser.
+     *
+     * @param pVersionObjectA pre-parsed version item A to compare
+     * @param versionB string version item B to compare
+     * @param type Version object or matcher strategy used to parse B.
+     * @return VersionComparisonResult result of the comparison.
+     */
+    static VersionComparisonResult
+    compare(const std::shared_ptr<IVersionObject>& pVersionObjectA,
+            const std::string& versionB,
+            std::variant<VersionObjectType, VersionMatcherStrategy> type = VersionMatcherStrategy::Unspecified)
+    {
+        auto pVersionObjectB = createVersionObjectCached(versionB, type);
+
+        if (pVersionObjectA && pVersionObjectB && pVersionObjectA->getType() == pVersionObjectB->getType())
+        {
+
+            if (*pVersionObjectA == *pVersionObjectB)
+            {
+                return VersionComparisonResult::A_EQUAL_B;
+            }
+            else if (*pVersionObjectA < *pVersionObjectB)
+            {
+                return VersionComparisonResult::A_LESS_THAN_B;
+            }
+            else
+            {
+                return VersionComparisonResult::A_GREATER_THAN_B;
+            }
+        }
+
+        throw std::invalid_argument("Unable to compare versions (pre-parsed vs " + versionB + ").");
+    }
+
     /**
      * @brief Checks whether a version string matches the given version type.
      *
@@ -291,7 +387,7 @@ public:
      */
     static bool match(const std::string& version, std::variant<VersionObjectType, VersionMatcherStrategy> type)
     {
-        return (nullptr != createVersionObject(version, type));
+        return (nullptr != createVersionObjectCached(version, type));
     }
 };
 
@@ -370,3 +370,64 @@ TEST_F(ScanContextTest, HotfixesTest)
     nlohmann::json actual = scanContext->hotfixes();
     EXPECT_EQ(expected, actual);
 }
+
+// Test case for reset: the context rebinds to new data and drops per-scan state.
+TEST_F(ScanContextTest, ResetRebindsContext)
+{
+    scanContext->m_elements.emplace("CVE-2023-0001", nlohmann::json::object());
+    scanContext->m_matchConditions.emplace("CVE-2023-0001", MatchCondition {"1.0.0", MatchRuleCondition::Equal});
+
+    auto newPackage = R"({"name": "other-package", "version": "2.0.0"})"_json;
+    nlohmann::json newResponse;
+
+    scanContext->reset(ScannerType::Package, agentData, osData, newPackage, hotfixesData, newResponse);
+
+    EXPECT_EQ(ScannerType::Package, scanContext->scannerType());
+    EXPECT_EQ("other-package", scanContext->packageName());
+    EXPECT_EQ("2.0.0", scanContext->packageVersion());
+    EXPECT_TRUE(scanContext->m_elements.empty());
+    EXPECT_TRUE(scanContext->m_matchConditions.empty());
+
+    nlohmann::json element = R"({"cve": "CVE-2023-0002"})"_json;
+    scanContext->moveResponseData(element);
+    EXPECT_EQ(1, newResponse.size());
+    EXPECT_EQ(0, responseData.size());
+}
+
+// Test case for the sorted hotfix run: built on bind, rebuilt on reset.
+TEST_F(ScanContextTest, SortedHotfixesFollowBoundData)
+{
+    // The fixture's hotfixes payload is an object, so the sorted run is empty.
+    EXPECT_TRUE(scanContext->sortedHotfixes().empty());
+
+    auto hotfixArray = R"(["KB5021237", "KB5021234", "KB5021235"])"_json;
+    nlohmann::json newResponse;
+    scanContext->reset(ScannerType::Package, agentData, osData, packageData, hotfixArray, newResponse);
+
+    const auto& sorted = scanContext->sortedHotfixes();
+    ASSERT_EQ(3, sorted.size());
+    EXPECT_EQ("KB5021234", sorted.at(0));
+    EXPECT_EQ("KB5021235", sorted.at(1));
+    EXPECT_EQ("KB5021237", sorted.at(2));
+}
+
+// Test case for the context pool: released contexts are recycled.
+TEST_F(ScanContextTest, ContextPoolRecyclesContexts)
+{
+    ScanContextPool pool;
+    EXPECT_EQ(0, pool.size());
+
+    ScanContext* first {nullptr};
+    {
+        auto context = pool.acquire(ScannerType::Package, agentData, osData, packageData, hotfixesData, responseData);
+        first = context.get();
+        EXPECT_EQ("test-package", context->packageName());
+    }
+    EXPECT_EQ(1, pool.size());
+
+    auto newPackage = R"({"name": "recycled-package"})"_json;
+    auto context = pool.acquire(ScannerType::Package, agentData, osData, newPackage, hotfixesData, responseData);
+    EXPECT_EQ(first, context.get());
+    EXPECT_EQ("recycled-package", context->packageName());
+    EXPECT_EQ(0, pool.size());
+}
@@ -21,6 +21,9 @@ public:
     /**
      * @brief Load a YAML file and return a RapidJSON document.
      *
+     * The document is built in a single pass from the parser event stream,
+     * without materializing the intermediate YAML node tree.
+     *
      * @param filepath Filepath of the YAML file.
      *
      * @return rapidjson::Document RapidJSON document loaded from the YAML file.
@@ -30,6 +33,9 @@ public:
     /**
      * @brief Load a YAML string and return a RapidJSON document.
      *
+     * The document is built in a single pass from the parser event stream,
+     * without materializing the intermediate YAML node tree.
+     *
      * @param yamlStr YAML string.
      *
      * @return rapidjson::Document RapidJSON document loaded from the YAML string.
@@ -1,23 +1,212 @@
 #include <yml/yml.hpp>
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <yaml-cpp/eventhandler.h>
+
 namespace yml
 {
 
-rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+namespace
+{
+
+/**
+ * @brief Builds a rapidjson document straight from the yaml-cpp event stream.
+ *
+ * Single pass: scalars, sequences and maps are written into the target document
+ * as the parser emits them, so loading skips the intermediate YAML::Node tree
+ * (and its per-node allocations) that Converter::yamlToJson walks recursively.
+ * Anchored values are kept aside and deep-copied on each alias, matching the
+ * expansion the node tree produced.
+ */
+class JsonEventBuilder final : public YAML::EventHandler
+{
+private:
+    // Open container plus, for maps, the key waiting for its value.
+    struct Frame
+    {
+        rapidjson::Value container;
+        rapidjson::Value key;
+        bool hasKey {false};
+        YAML::anchor_t anchor {YAML::NullAnchor};
+    };
+
+    rapidjson::Document& m_doc;
+    std::vector<Frame> m_stack;
+    std::unordered_map<YAML::anchor_t, rapidjson::Value> m_anchors;
+
+    bool expectingKey() const { return !m_stack.empty() && m_stack.back().container.IsObject() && !m_stack.back().hasKey; }
+
+    void pushFrame(rapidjson::Type type, YAML::anchor_t anchor)
+    {
+        if (expectingKey())
+        {
+            throw std::runtime_error("Complex mapping keys are not supported");
+        }
+
+        auto& frame = m_stack.emplace_back();
+        frame.container = rapidjson::Value(type);
+        frame.anchor = anchor;
+    }
+
+    void popFrame()
+    {
+        auto frame = std::move(m_stack.back());
+        m_stack.pop_back();
+        addValue(std::move(frame.container), frame.anchor);
+    }
+
+    void addValue(rapidjson::Value&& value, YAML::anchor_t anchor)
+    {
+        if (YAML::NullAnchor != anchor)
+        {
+            rapidjson::Value copy;
+            copy.CopyFrom(value, m_doc.GetAllocator());
+            m_anchors[anchor] = std::move(copy);
+        }
+
+        if (m_stack.empty())
+        {
+            static_cast<rapidjson::Value&>(m_doc).Swap(value);
+            return;
+        }
+
+        auto& top = m_stack.back();
+        if (top.container.IsObject())
+        {
+            top.container.AddMember(std::move(top.key), std::move(value), m_doc.GetAllocator());
+            top.hasKey = false;
+        }
+        else
+        {
+            top.container.PushBack(std::move(value), m_doc.GetAllocator());
+        }
+    }
+
+public:
+    explicit JsonEventBuilder(rapidjson::Document& doc)
+        : m_doc(doc)
+    {
+    }
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark&, YAML::anchor_t anchor) override
+    {
+        if (expectingKey())
+        {
+            m_stack.back().key = rapidjson::Value("null", m_doc.GetAllocator());
+            m_stack.back().hasKey = true;
+            return;
+        }
+
+        addValue(rapidjson::Value(), anchor);
+    }
+
+    void OnAlias(const YAML::Mark&, YAML::anchor_t anchor) override
+    {
+        const auto it = m_anchors.find(anchor);
+        if (it == m_anchors.end())
+        {
+            throw std::runtime_error("Alias to an undefined anchor");
+        }
+
+        rapidjson::Value value;
+        value.CopyFrom(it->second, m_doc.GetAllocator());
+
+        if (expectingKey())
+        {
+            if (!value.IsString())
+            {
+                throw std::runtime_error("Complex mapping keys are not supported");
+            }
+            m_stack.back().key = std::move(value);
+            m_stack.back().hasKey = true;
+            return;
+        }
+
+        addValue(std::move(value), YAML::NullAnchor);
+    }
+
+    void OnScalar(const YAML::Mark&, const std::string& tag, YAML::anchor_t anchor, const std::string& value) override
+    {
+        if (expectingKey())
+        {
+            // Keys keep their literal text, as Node::as<std::string>() did.
+            m_stack.back().key = rapidjson::Value(value.c_str(), value.size(), m_doc.GetAllocator());
+            m_stack.back().hasKey = true;
+            if (YAML::NullAnchor != anchor)
+            {
+                m_anchors[anchor] = rapidjson::Value(value.c_str(), value.size(), m_doc.GetAllocator());
+            }
+            return;
+        }
+
+        if (QUOTED_TAG == tag)
+        {
+            addValue(rapidjson::Value(value.c_str(), value.size(), m_doc.GetAllocator()), anchor);
+            return;
+        }
+
+        // Plain scalars go through the same type probing as the node tree did.
+        const YAML::Node node(value);
+        addValue(Converter::parseScalar(node, m_doc.GetAllocator()), anchor);
+    }
+
+    void OnSequenceStart(const YAML::Mark&, const std::string&, YAML::anchor_t anchor, YAML::EmitterStyle::value) override
+    {
+        pushFrame(rapidjson::kArrayType, anchor);
+    }
+
+    void OnSequenceEnd() override { popFrame(); }
+
+    void OnMapStart(const YAML::Mark&, const std::string&, YAML::anchor_t anchor, YAML::EmitterStyle::value) override
+    {
+        pushFrame(rapidjson::kObjectType, anchor);
+    }
+
+    void OnMapEnd() override { popFrame(); }
+};
+
+/**
+ * @brief Load the first YAML document of a stream into a rapidjson document.
+ *
+ * @param input Input stream with the YAML content.
+ * @return rapidjson::Document Converted document; null for an empty stream,
+ * as YAML::Load yielded.
+ */
+rapidjson::Document buildFromStream(std::istream& input)
 {
-    YAML::Node root = YAML::LoadFile(filepath);
     rapidjson::Document doc;
+    doc.SetNull();
 
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
+    YAML::Parser parser(input);
+    JsonEventBuilder builder(doc);
+    parser.HandleNextDocument(builder);
 
     return doc;
 }
 
+} // namespace
+
+rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+{
+    std::ifstream file(filepath);
+    if (!file)
+    {
+        throw YAML::BadFile(filepath);
+    }
+
+    return buildFromStream(file);
+}
+
 rapidjson::Value Converter::parseScalar(const YAML::Node& node, rapidjson::Document::AllocatorType& allocator)
 {
     rapidjson::Value v;
@@ -82,13 +271,8 @@ YAML::Node Converter::parseScalar(const rapidjson::Value& node)
 
 rapidjson::Document Converter::loadYMLfromString(const std::string& yamlStr)
 {
-    YAML::Node root = YAML::Load(yamlStr);
-    rapidjson::Document doc;
-
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
-
-    return doc;
+    std::istringstream input(yamlStr);
+    return buildFromStream(input);
 }
 
 YAML::Node Converter::jsonToYaml(const rapidjson::Value& value)
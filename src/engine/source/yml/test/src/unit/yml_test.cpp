@@ -191,6 +191,44 @@ TEST_F(YmlTest, LoadYMLfromStringTest)
     EXPECT_TRUE(expected == result);
 }
 
+TEST_F(YmlTest, LoadYMLfromStringAnchorsAndAliasesTest)
+{
+    std::string yamlStr = R"(
+        defaults: &defaults
+            enabled: true
+            retries: 3
+        first:
+            <<: *defaults
+        second: *defaults
+        quoted: "30"
+        plain: 30
+    )";
+
+    auto resultValue = yml::Converter::loadYMLfromString(yamlStr);
+    rapidjson::Document resultValueDocument;
+    resultValueDocument.CopyFrom(resultValue, resultValueDocument.GetAllocator());
+    auto result = json::Json {std::move(resultValueDocument)};
+
+    const char* expectedJsonStr = R"(
+        {
+            "defaults": {"enabled": true, "retries": 3},
+            "first": {"<<": {"enabled": true, "retries": 3}},
+            "second": {"enabled": true, "retries": 3},
+            "quoted": "30",
+            "plain": 30
+        }
+    )";
+
+    auto expected = json::Json {expectedJsonStr};
+    EXPECT_TRUE(expected == result);
+}
+
+TEST_F(YmlTest, LoadYMLfromStringEmptyTest)
+{
+    auto resultValue = yml::Converter::loadYMLfromString("");
+    EXPECT_TRUE(resultValue.IsNull());
+}
+
 TEST_F(YmlTest, LoadYMLfromFileTest)
 {
     auto resultValue = yml::Converter::loadYMLfromFile(TEST_FILE);
@@ -3,7 +3,7 @@ from google.protobuf.internal import containers as _containers
 from google.protobuf.internal import enum_type_wrapper as _enum_type_wrapper
 from google.protobuf import descriptor as _descriptor
 from google.protobuf import message as _message
-from typing import ClassVar as _ClassVar, Iterable as _Iterable, Optional as _Optional, Union as _Union
+from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Mapping, Optional as _Optional, Union as _Union
 
 DESCRIPTOR: _descriptor.FileDescriptor
 UNKNOWN: ResourceType
@@ -60,6 +60,32 @@ class ResourceGet_Response(_message.Message):
     status: _engine_pb2.ReturnStatus
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., content: _Optional[str] = ...) -> None: ...
 
+class ResourceList_Request(_message.Message):
+    __slots__ = ["filter", "namespaceid", "page", "size", "type"]
+    FILTER_FIELD_NUMBER: _ClassVar[int]
+    NAMESPACEID_FIELD_NUMBER: _ClassVar[int]
+    PAGE_FIELD_NUMBER: _ClassVar[int]
+    SIZE_FIELD_NUMBER: _ClassVar[int]
+    TYPE_FIELD_NUMBER: _ClassVar[int]
+    filter: str
+    namespaceid: str
+    page: int
+    size: int
+    type: ResourceType
+    def __init__(self, namespaceid: _Optional[str] = ..., type: _Optional[_Union[ResourceType, str]] = ..., filter: _Optional[str] = ..., page: _Optional[int] = ..., size: _Optional[int] = ...) -> None: ...
+
+class ResourceList_Response(_message.Message):
+    __slots__ = ["error", "items", "status", "total"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    ITEMS_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    TOTAL_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    items: _containers.RepeatedCompositeFieldContainer[ResourceSummary]
+    status: _engine_pb2.ReturnStatus
+    total: int
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., items: _Optional[_Iterable[_Union[ResourceSummary, _Mapping]]] = ..., total: _Optional[int] = ...) -> None: ...
+
 class ResourcePost_Request(_message.Message):
     __slots__ = ["content", "format", "namespaceid", "type"]
     CONTENT_FIELD_NUMBER: _ClassVar[int]
@@ -84,6 +110,16 @@ class ResourcePut_Request(_message.Message):
     namespaceid: str
     def __init__(self, name: _Optional[str] = ..., format: _Optional[_Union[ResourceFormat, str]] = ..., content: _Optional[str] = ..., namespaceid: _Optional[str] = ...) -> None: ...
 
+class ResourceSummary(_message.Message):
+    __slots__ = ["name", "title", "type"]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    TITLE_FIELD_NUMBER: _ClassVar[int]
+    TYPE_FIELD_NUMBER: _ClassVar[int]
+    name: str
+    title: str
+    type: ResourceType
+    def __init__(self, name: _Optional[str] = ..., type: _Optional[_Union[ResourceType, str]] = ..., title: _Optional[str] = ...) -> None: ...
+
 class ResourceValidate_Request(_message.Message):
     __slots__ = ["content", "format", "name", "namespaceid"]
     CONTENT_FIELD_NUMBER: _ClassVar[int]
@@ -11,11 +11,11 @@ from google.protobuf import symbol_database as _symbol_database
 _sym_db = _symbol_database.Default()
 
 
-import api_communication.proto.engine_pb2 as _engine_pb2
+import api_communication.proto.engine_pb2 as engine__pb2
 from google.protobuf import struct_pb2 as google_dot_protobuf_dot_struct__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\nkvdb.proto\x12\x19\x63om.wazuh.api.engine.kvdb\x1a\x0c\x65ngine.proto\x1a\x1cgoogle/protobuf/struct.proto\"W\n\x05\x45ntry\x12\x10\n\x03key\x18\x01 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x02 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x06\n\x04_keyB\x08\n\x06_value\"E\n\rdbGet_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x03key\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x06\n\x04_key\"\x98\x01\n\x0e\x64\x62Get_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"\x8c\x01\n\x10\x64\x62Search_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x13\n\x06prefix\x18\x02 \x01(\tH\x01\x88\x01\x01\x12\x11\n\x04page\x18\x03 \x01(\rH\x02\x88\x01\x01\x12\x14\n\x07records\x18\x04 \x01(\rH\x03\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_prefixB\x07\n\x05_pageB\n\n\x08_records\"\x98\x01\n\x11\x64\x62Search_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x07\x65ntries\x18\x03 \x03(\x0b\x32 .com.wazuh.api.engine.kvdb.EntryB\x08\n\x06_error\"H\n\x10\x64\x62\x44\x65lete_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x03key\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x06\n\x04_key\"k\n\rdbPut_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x34\n\x05\x65ntry\x18\x02 \x01(\x0b\x32 .com.wazuh.api.engine.kvdb.EntryH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x08\n\x06_entry\"\\\n\x12managerGet_Request\x12\x16\n\x0emust_be_loaded\x18\x01 \x01(\x08\x12\x1b\n\x0e\x66ilter_by_name\x18\x10 \x01(\tH\x00\x88\x01\x01\x42\x11\n\x0f_filter_by_name\"t\n\x13managerGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x64\x62s\x18\x03 \x03(\tB\x08\n\x06_error\"M\n\x13managerPost_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x11\n\x04path\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x07\n\x05_path\"3\n\x15managerDelete_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x42\x07\n\x05_name\"o\n\x13managerDump_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x11\n\x04page\x18\x02 \x01(\rH\x01\x88\x01\x01\x12\x14\n\x07records\x18\x03 \x01(\rH\x02\x88\x01\x01\x42\x07\n\x05_nameB\x07\n\x05_pageB\n\n\x08_records\"\x9b\x01\n\x14managerDump_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x07\x65ntries\x18\x03 \x03(\x0b\x32 .com.wazuh.api.engine.kvdb.EntryB\x08\n\x06_errorb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\nkvdb.proto\x12\x19\x63om.wazuh.api.engine.kvdb\x1a\x0c\x65ngine.proto\x1a\x1cgoogle/protobuf/struct.proto\"W\n\x05\x45ntry\x12\x10\n\x03key\x18\x01 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x02 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x06\n\x04_keyB\x08\n\x06_value\"E\n\rdbGet_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x03key\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x06\n\x04_key\"\x98\x01\n\x0e\x64\x62Get_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"\xac\x01\n\x10\x64\x62Search_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x13\n\x06prefix\x18\x02 \x01(\tH\x01\x88\x01\x01\x12\x11\n\x04page\x18\x03 \x01(\rH\x02\x88\x01\x01\x12\x14\n\x07records\x18\x04 \x01(\rH\x03\x88\x01\x01\x12\x13\n\x06\x63ursor\x18\x05 \x01(\tH\x04\x88\x01\x01\x42\x07\n\x05_nameB\t\n\x07_prefixB\x07\n\x05_pageB\n\n\x08_recordsB\t\n\x07_cursor\"\xb4\x01\n\x11\x64\x62Search_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x07\x65ntries\x18\x03 \x03(\x0b\x32 .com.wazuh.api.engine.kvdb.Entry\x12\x11\n\x04next\x18\x04 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x07\n\x05_next\"H\n\x10\x64\x62\x44\x65lete_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x03key\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x06\n\x04_key\"k\n\rdbPut_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x34\n\x05\x65ntry\x18\x02 \x01(\x0b\x32 .com.wazuh.api.engine.kvdb.EntryH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x08\n\x06_entry\"P\n\x10\x64\x62Import_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\n\n\x08_content\"\x89\x01\n\x11\x64\x62Import_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x15\n\x08imported\x18\x03 \x01(\rH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x0b\n\t_imported\".\n\x10\x64\x62\x45xport_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x42\x07\n\x05_name\"\x87\x01\n\x11\x64\x62\x45xport_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\n\n\x08_content\"\\\n\x12managerGet_Request\x12\x16\n\x0emust_be_loaded\x18\x01 \x01(\x08\x12\x1b\n\x0e\x66ilter_by_name\x18\x10 \x01(\tH\x00\x88\x01\x01\x42\x11\n\x0f_filter_by_name\"t\n\x13managerGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x64\x62s\x18\x03 \x03(\tB\x08\n\x06_error\"M\n\x13managerPost_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x11\n\x04path\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x07\n\x05_nameB\x07\n\x05_path\"3\n\x15managerDelete_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x42\x07\n\x05_name\"\x8f\x01\n\x13managerDump_Request\x12\x11\n\x04name\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x11\n\x04page\x18\x02 \x01(\rH\x01\x88\x01\x01\x12\x14\n\x07records\x18\x03 \x01(\rH\x02\x88\x01\x01\x12\x13\n\x06\x63ursor\x18\x04 \x01(\tH\x03\x88\x01\x01\x42\x07\n\x05_nameB\x07\n\x05_pageB\n\n\x08_recordsB\t\n\x07_cursor\"\xb7\x01\n\x14managerDump_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x07\x65ntries\x18\x03 \x03(\x0b\x32 .com.wazuh.api.engine.kvdb.Entry\x12\x11\n\x04next\x18\x04 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x07\n\x05_next\"\x16\n\x14managerStats_Request\"\xff\x02\n\x15managerStats_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x1e\n\x11\x62lock_cache_usage\x18\x03 \x01(\x04H\x01\x88\x01\x01\x12!\n\x14\x62lock_cache_capacity\x18\x04 \x01(\x04H\x02\x88\x01\x01\x12\x1c\n\x0f\x62lock_cache_hit\x18\x05 \x01(\x04H\x03\x88\x01\x01\x12\x1d\n\x10\x62lock_cache_miss\x18\x06 \x01(\x04H\x04\x88\x01\x01\x12\"\n\x15\x62lock_cache_hit_ratio\x18\x07 \x01(\x01H\x05\x88\x01\x01\x42\x08\n\x06_errorB\x14\n\x12_block_cache_usageB\x17\n\x15_block_cache_capacityB\x12\n\x10_block_cache_hitB\x13\n\x11_block_cache_missB\x18\n\x16_block_cache_hit_ratiob\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'kvdb_pb2', globals())
@@ -29,23 +29,35 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _DBGET_RESPONSE._serialized_start=246
   _DBGET_RESPONSE._serialized_end=398
   _DBSEARCH_REQUEST._serialized_start=401
-  _DBSEARCH_REQUEST._serialized_end=541
-  _DBSEARCH_RESPONSE._serialized_start=544
-  _DBSEARCH_RESPONSE._serialized_end=696
-  _DBDELETE_REQUEST._serialized_start=698
-  _DBDELETE_REQUEST._serialized_end=770
-  _DBPUT_REQUEST._serialized_start=772
-  _DBPUT_REQUEST._serialized_end=879
-  _MANAGERGET_REQUEST._serialized_start=881
-  _MANAGERGET_REQUEST._serialized_end=973
-  _MANAGERGET_RESPONSE._serialized_start=975
-  _MANAGERGET_RESPONSE._serialized_end=1091
-  _MANAGERPOST_REQUEST._serialized_start=1093
-  _MANAGERPOST_REQUEST._serialized_end=1170
-  _MANAGERDELETE_REQUEST._serialized_start=1172
-  _MANAGERDELETE_REQUEST._serialized_end=1223
-  _MANAGERDUMP_REQUEST._serialized_start=1225
-  _MANAGERDUMP_REQUEST._serialized_end=1336
-  _MANAGERDUMP_RESPONSE._serialized_start=1339
-  _MANAGERDUMP_RESPONSE._serialized_end=1494
+  _DBSEARCH_REQUEST._serialized_end=573
+  _DBSEARCH_RESPONSE._serialized_start=576
+  _DBSEARCH_RESPONSE._serialized_end=756
+  _DBDELETE_REQUEST._serialized_start=758
+  _DBDELETE_REQUEST._serialized_end=830
+  _DBPUT_REQUEST._serialized_start=832
+  _DBPUT_REQUEST._serialized_end=939
+  _DBIMPORT_REQUEST._serialized_start=941
+  _DBIMPORT_REQUEST._serialized_end=1021
+  _DBIMPORT_RESPONSE._serialized_start=1024
+  _DBIMPORT_RESPONSE._serialized_end=1161
+  _DBEXPORT_REQUEST._serialized_start=1163
+  _DBEXPORT_REQUEST._serialized_end=1209
+  _DBEXPORT_RESPONSE._serialized_start=1212
+  _DBEXPORT_RESPONSE._serialized_end=1347
+  _MANAGERGET_REQUEST._serialized_start=1349
+  _MANAGERGET_REQUEST._serialized_end=1441
+  _MANAGERGET_RESPONSE._serialized_start=1443
+  _MANAGERGET_RESPONSE._serialized_end=1559
+  _MANAGERPOST_REQUEST._serialized_start=1561
+  _MANAGERPOST_REQUEST._serialized_end=1638
+  _MANAGERDELETE_REQUEST._serialized_start=1640
+  _MANAGERDELETE_REQUEST._serialized_end=1691
+  _MANAGERDUMP_REQUEST._serialized_start=1694
+  _MANAGERDUMP_REQUEST._serialized_end=1837
+  _MANAGERDUMP_RESPONSE._serialized_start=1840
+  _MANAGERDUMP_RESPONSE._serialized_end=2023
+  _MANAGERSTATS_REQUEST._serialized_start=2025
+  _MANAGERSTATS_REQUEST._serialized_end=2047
+  _MANAGERSTATS_RESPONSE._serialized_start=2050
+  _MANAGERSTATS_RESPONSE._serialized_end=2433
 # @@protoc_insertion_point(module_scope)
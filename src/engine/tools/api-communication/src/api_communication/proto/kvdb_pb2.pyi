@@ -23,6 +23,22 @@ class dbDelete_Request(_message.Message):
     name: str
     def __init__(self, name: _Optional[str] = ..., key: _Optional[str] = ...) -> None: ...
 
+class dbExport_Request(_message.Message):
+    __slots__ = ["name"]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    name: str
+    def __init__(self, name: _Optional[str] = ...) -> None: ...
+
+class dbExport_Response(_message.Message):
+    __slots__ = ["content", "error", "status"]
+    CONTENT_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    content: str
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., content: _Optional[str] = ...) -> None: ...
+
 class dbGet_Request(_message.Message):
     __slots__ = ["key", "name"]
     KEY_FIELD_NUMBER: _ClassVar[int]
@@ -41,6 +57,24 @@ class dbGet_Response(_message.Message):
     value: _struct_pb2.Value
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., value: _Optional[_Union[_struct_pb2.Value, _Mapping]] = ...) -> None: ...
 
+class dbImport_Request(_message.Message):
+    __slots__ = ["content", "name"]
+    CONTENT_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    content: str
+    name: str
+    def __init__(self, name: _Optional[str] = ..., content: _Optional[str] = ...) -> None: ...
+
+class dbImport_Response(_message.Message):
+    __slots__ = ["error", "imported", "status"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    IMPORTED_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    imported: int
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., imported: _Optional[int] = ...) -> None: ...
+
 class dbPut_Request(_message.Message):
     __slots__ = ["entry", "name"]
     ENTRY_FIELD_NUMBER: _ClassVar[int]
@@ -50,26 +84,30 @@ class dbPut_Request(_message.Message):
     def __init__(self, name: _Optional[str] = ..., entry: _Optional[_Union[Entry, _Mapping]] = ...) -> None: ...
 
 class dbSearch_Request(_message.Message):
-    __slots__ = ["name", "page", "prefix", "records"]
+    __slots__ = ["cursor", "name", "page", "prefix", "records"]
+    CURSOR_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     PAGE_FIELD_NUMBER: _ClassVar[int]
     PREFIX_FIELD_NUMBER: _ClassVar[int]
     RECORDS_FIELD_NUMBER: _ClassVar[int]
+    cursor: str
     name: str
     page: int
     prefix: str
     records: int
-    def __init__(self, name: _Optional[str] = ..., prefix: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., prefix: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ..., cursor: _Optional[str] = ...) -> None: ...
 
 class dbSearch_Response(_message.Message):
-    __slots__ = ["entries", "error", "status"]
+    __slots__ = ["entries", "error", "next", "status"]
     ENTRIES_FIELD_NUMBER: _ClassVar[int]
     ERROR_FIELD_NUMBER: _ClassVar[int]
+    NEXT_FIELD_NUMBER: _ClassVar[int]
     STATUS_FIELD_NUMBER: _ClassVar[int]
     entries: _containers.RepeatedCompositeFieldContainer[Entry]
     error: str
+    next: str
     status: _engine_pb2.ReturnStatus
-    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ...) -> None: ...
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ..., next: _Optional[str] = ...) -> None: ...
 
 class managerDelete_Request(_message.Message):
     __slots__ = ["name"]
@@ -78,24 +116,28 @@ class managerDelete_Request(_message.Message):
     def __init__(self, name: _Optional[str] = ...) -> None: ...
 
 class managerDump_Request(_message.Message):
-    __slots__ = ["name", "page", "records"]
+    __slots__ = ["cursor", "name", "page", "records"]
+    CURSOR_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     PAGE_FIELD_NUMBER: _ClassVar[int]
     RECORDS_FIELD_NUMBER: _ClassVar[int]
+    cursor: str
     name: str
     page: int
     records: int
-    def __init__(self, name: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ..., cursor: _Optional[str] = ...) -> None: ...
 
 class managerDump_Response(_message.Message):
-    __slots__ = ["entries", "error", "status"]
+    __slots__ = ["entries", "error", "next", "status"]
     ENTRIES_FIELD_NUMBER: _ClassVar[int]
     ERROR_FIELD_NUMBER: _ClassVar[int]
+    NEXT_FIELD_NUMBER: _ClassVar[int]
     STATUS_FIELD_NUMBER: _ClassVar[int]
     entries: _containers.RepeatedCompositeFieldContainer[Entry]
     error: str
+    next: str
     status: _engine_pb2.ReturnStatus
-    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ...) -> None: ...
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ..., next: _Optional[str] = ...) -> None: ...
 
 class managerGet_Request(_message.Message):
     __slots__ = ["filter_by_name", "must_be_loaded"]
@@ -122,3 +164,25 @@ class managerPost_Request(_message.Message):
     name: str
     path: str
     def __init__(self, name: _Optional[str] = ..., path: _Optional[str] = ...) -> None: ...
+
+class managerStats_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class managerStats_Response(_message.Message):
+    __slots__ = ["block_cache_capacity", "block_cache_hit", "block_cache_hit_ratio", "block_cache_miss", "block_cache_usage", "error", "status"]
+    BLOCK_CACHE_CAPACITY_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_CACHE_HIT_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_CACHE_HIT_RATIO_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_CACHE_MISS_FIELD_NUMBER: _ClassVar[int]
+    BLOCK_CACHE_USAGE_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    block_cache_capacity: int
+    block_cache_hit: int
+    block_cache_hit_ratio: float
+    block_cache_miss: int
+    block_cache_usage: int
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., block_cache_usage: _Optional[int] = ..., block_cache_capacity: _Optional[int] = ..., block_cache_hit: _Optional[int] = ..., block_cache_miss: _Optional[int] = ..., block_cache_hit_ratio: _Optional[float] = ...) -> None: ...
@@ -21,6 +21,7 @@
 #include <chrono>
 #include <external/nlohmann/json.hpp>
 #include <filesystem>
+#include <random>
 #include <thread>
 #include <utility>
 
@@ -95,14 +96,30 @@ public:
                 // Use while with condition variable to avoid spurious wakeups.
                 std::unique_lock<std::mutex> lock(m_mutex);
 
+                // Spread the first run over a random slice of the interval so providers started
+                // together don't all hit the backend at the same instant.
+                m_cv.wait_for(lock, randomDelay(std::chrono::milliseconds {0}, maxJitter()), [this]() {
+                    return !m_schedulerRunning || m_runRequested.load();
+                });
+
                 // Run action on start, independently of the interval time.
-                runActionScheduled();
+                if (m_schedulerRunning)
+                {
+                    m_runRequested = false;
+                    runActionScheduled();
+                }
 
                 while (m_schedulerRunning)
                 {
-                    m_cv.wait_for(lock, std::chrono::seconds(this->m_interval));
+                    // Jitter every cycle so the providers stay de-aligned over time, and wake early
+                    // when an immediate run is requested.
+                    m_cv.wait_for(lock, jitteredInterval(), [this]() {
+                        return !m_schedulerRunning || m_runRequested.load();
+                    });
+
                     if (m_schedulerRunning)
                     {
+                        m_runRequested = false;
                         runActionScheduled();
                     }
                 }
@@ -189,14 +206,74 @@ public:
     void changeSchedulerInterval(size_t interval)
     {
         m_interval = interval;
+        triggerScheduledAction();
+    }
+
+    /**
+     * @brief Requests an immediate run of the scheduled action, without waiting for the interval to
+     * elapse. Used when a publish notification makes new content available right away.
+     *
+     */
+    void triggerScheduledAction()
+    {
+        m_runRequested = true;
         m_cv.notify_one();
     }
 
 private:
+    /**
+     * @brief Percentage of the interval used as the maximum scheduling jitter.
+     *
+     */
+    static constexpr size_t SCHEDULER_JITTER_PERCENT {10};
+
+    /**
+     * @brief Maximum jitter for the current interval.
+     *
+     * @return std::chrono::milliseconds Jitter upper bound.
+     */
+    std::chrono::milliseconds maxJitter() const
+    {
+        const auto intervalMs {std::chrono::milliseconds {std::chrono::seconds {m_interval.load()}}};
+        return intervalMs * SCHEDULER_JITTER_PERCENT / 100;
+    }
+
+    /**
+     * @brief Random delay within the given bounds. Only called from the scheduler thread.
+     *
+     * @param min Lower bound.
+     * @param max Upper bound.
+     * @return std::chrono::milliseconds Delay between min and max, both inclusive.
+     */
+    std::chrono::milliseconds randomDelay(const std::chrono::milliseconds min, const std::chrono::milliseconds max)
+    {
+        if (max <= min)
+        {
+            return min;
+        }
+
+        std::uniform_int_distribution<std::chrono::milliseconds::rep> delay {min.count(), max.count()};
+        return std::chrono::milliseconds {delay(m_randomEngine)};
+    }
+
+    /**
+     * @brief Interval with a random jitter applied, so the fleet's providers drift apart instead of
+     * firing in lockstep every cycle.
+     *
+     * @return std::chrono::milliseconds Interval to wait until the next scheduled run.
+     */
+    std::chrono::milliseconds jitteredInterval()
+    {
+        const auto intervalMs {std::chrono::milliseconds {std::chrono::seconds {m_interval.load()}}};
+        const auto jitter {maxJitter()};
+        return intervalMs - jitter + randomDelay(std::chrono::milliseconds {0}, jitter * 2);
+    }
     std::shared_ptr<IRouterProvider> m_channel;
     std::thread m_schedulerThread;
     std::atomic<bool> m_schedulerRunning = false;
     std::atomic<bool> m_actionInProgress;
+    std::atomic<bool> m_runRequested = false;
+    std::mt19937 m_randomEngine {std::random_device {}()};
     std::atomic<size_t> m_interval;
     std::mutex m_mutex;
     std::condition_variable m_cv;
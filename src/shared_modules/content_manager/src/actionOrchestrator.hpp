@@ -149,8 +149,9 @@ public:
      */
     void run(const UpdateData& updateData) const
     {
-        // Create a updater context
-        auto spUpdaterContext {std::make_shared<UpdaterContext>()};
+        // Take a recycled updater context: move-based hand-off between the chain stages keeps it
+        // alive until the last stage releases it back to the pool with its buffers intact.
+        auto spUpdaterContext {m_spContextPool->acquire()};
         spUpdaterContext->spUpdaterBaseContext = m_spBaseContext;
 
         try
@@ -188,6 +189,11 @@ private:
      */
     std::shared_ptr<UpdaterBaseContext> m_spBaseContext;
 
+    /**
+     * @brief Pool of reusable updater contexts, one taken per run.
+     */
+    std::shared_ptr<UpdaterContextPool> m_spContextPool {std::make_shared<UpdaterContextPool>()};
+
     /**
      * @brief Clean ContentUpdater persistent data. Useful for cleaning the context when an exception is thrown.
      *
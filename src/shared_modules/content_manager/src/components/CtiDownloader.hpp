@@ -26,6 +26,7 @@
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <utility>
 
 static const unsigned int TOO_MANY_REQUESTS_DEFAULT_RETRY_TIME {90};
@@ -185,11 +186,13 @@ protected:
      * @param onSuccess Callback on success download.
      * @param queryParameters Parameters to the GET query.
      * @param outputFilepath File where to store the downloaded content.
+     * @param headers Headers for the GET query.
      */
     void performQueryWithRetry(const std::string& URL,
                                const std::function<void(const std::string&)>& onSuccess,
                                const std::string& queryParameters = "",
-                               const std::string& outputFilepath = "") const
+                               const std::string& outputFilepath = "",
+                               const std::unordered_set<std::string>& headers = DEFAULT_HEADERS) const
     {
         // On download error routine.
         const auto onError {
@@ -222,7 +225,7 @@ protected:
                                  onSuccess,
                                  onError,
                                  outputFilepath,
-                                 DEFAULT_HEADERS,
+                                 headers,
                                  {},
                                  m_spUpdaterContext->spUpdaterBaseContext->httpUserAgent);
                 return;
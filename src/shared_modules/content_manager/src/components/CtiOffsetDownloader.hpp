@@ -15,10 +15,12 @@
 #include "../sharedDefs.hpp"
 #include "CtiDownloader.hpp"
 #include "IURLRequest.hpp"
+#include "componentsHelper.hpp"
 #include "updaterContext.hpp"
 #include <algorithm>
 #include <sstream>
 #include <string>
+#include <vector>
 
 /**
  * @class CtiOffsetDownloader
@@ -59,35 +61,52 @@ private:
         }
         const auto& consumerLastOffset {ctiParameters.lastOffset.value()};
 
-        // Iterate until the current offset is equal to the consumer offset.
-        auto pathsArray = nlohmann::json::array();
-        while (context.currentOffset < consumerLastOffset)
+        // Split the pending range into pages, each one an independent ranged query.
+        std::vector<OffsetPage> pages;
+        for (auto fromOffset {context.currentOffset}; fromOffset < consumerLastOffset;)
         {
-            if (stopCondition->check())
-            {
-                logWarn(WM_CONTENTUPDATER, "The offsets download has been interrupted.");
-                return;
-            }
-
             // Amount of offsets to download on each query.
             constexpr auto OFFSETS_DELTA {1000};
 
             // Calculate the offset to download
-            const auto toOffset {std::min(consumerLastOffset, context.currentOffset + OFFSETS_DELTA)};
+            const auto toOffset {std::min(consumerLastOffset, fromOffset + OFFSETS_DELTA)};
 
             // full path where the content will be saved.
             std::ostringstream filePathStream;
             filePathStream << m_outputFolder << "/" << toOffset << "-" << m_fileName;
-            const std::string fullFilePath = filePathStream.str();
 
-            // Download the content.
-            downloadContent(toOffset, fullFilePath, context);
+            pages.push_back({fromOffset, toOffset, filePathStream.str()});
+            fromOffset = toOffset;
+        }
+
+        // Download the pages in fixed-size windows of concurrent requests. Pages within a window are
+        // independent, so they run in parallel; the window boundary is where order is restored: the
+        // current offset and the paths handed to the next stage only advance once every page of the
+        // window is on disk, so an interruption or failure never leaves a gap behind the committed
+        // offset.
+        auto pathsArray = nlohmann::json::array();
+        for (size_t windowStart {0}; windowStart < pages.size(); windowStart += MAX_PARALLEL_PAGES)
+        {
+            if (stopCondition->check())
+            {
+                logWarn(WM_CONTENTUPDATER, "The offsets download has been interrupted.");
+                return;
+            }
 
-            // Update the current offset.
-            context.currentOffset = toOffset;
+            const auto windowSize {std::min(MAX_PARALLEL_PAGES, pages.size() - windowStart)};
+            Components::forEachParallel(windowSize,
+                                        [this, &pages, windowStart](const size_t index)
+                                        {
+                                            const auto& page {pages.at(windowStart + index)};
+                                            downloadContent(page.fromOffset, page.toOffset, page.filePath);
+                                        });
 
-            // Save the path of the downloaded content in a temporary variable.
-            pathsArray.push_back(fullFilePath);
+            // Window completed: commit its pages in offset order.
+            for (size_t index {windowStart}; index < windowStart + windowSize; ++index)
+            {
+                pathsArray.push_back(pages.at(index).filePath);
+            }
+            context.currentOffset = pages.at(windowStart + windowSize - 1).toOffset;
         }
 
         // Commit changes.
@@ -115,17 +134,29 @@ private:
         m_fileName = context.spUpdaterBaseContext->configData.at("contentFileName").get<std::string>();
     }
 
+    /**
+     * @brief Page of offsets to download, mapped to the file where it will be stored.
+     *
+     */
+    struct OffsetPage
+    {
+        int fromOffset;       ///< Start offset of the page.
+        int toOffset;         ///< End offset of the page.
+        std::string filePath; ///< Full path where the page content will be saved.
+    };
+
     /**
      * @brief Download the content from the API.
      *
+     * @param fromOffset start offset to download.
      * @param toOffset end offset to download.
      * @param fullFilePath full path where the content will be saved.
      */
-    void downloadContent(int toOffset, const std::string& fullFilePath, const UpdaterContext& context) const
+    void downloadContent(int fromOffset, int toOffset, const std::string& fullFilePath) const
     {
         // Define the parameters for the request.
         const auto queryParameters =
-            "/changes?from_offset=" + std::to_string(context.currentOffset) + "&to_offset=" + std::to_string(toOffset);
+            "/changes?from_offset=" + std::to_string(fromOffset) + "&to_offset=" + std::to_string(toOffset);
 
         // Empty on download success routine.
         const auto onSuccess {[]([[maybe_unused]] const std::string& data) {
@@ -137,6 +168,12 @@ private:
         performQueryWithRetry(m_url, onSuccess, queryParameters, fullFilePath);
     }
 
+    /**
+     * @brief Amount of page downloads in flight at once. Bounds the concurrent load put on the CTI
+     * API while still overlapping the request round-trips during large catch-ups.
+     */
+    static constexpr size_t MAX_PARALLEL_PAGES {8};
+
     std::string m_url {};          ///< URL of the API to connect to.
     std::string m_outputFolder {}; ///< output folder where the file will be saved
     std::string m_fileName {};     ///< name of the file where the content will be saved
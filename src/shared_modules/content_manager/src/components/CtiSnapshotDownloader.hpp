@@ -17,7 +17,9 @@
 #include "IURLRequest.hpp"
 #include "updaterContext.hpp"
 #include <filesystem>
+#include <fstream>
 #include <string>
+#include <system_error>
 
 /**
  * @class CtiSnapshotDownloader
@@ -51,17 +53,84 @@ private:
         // Set output path. The snapshot is always compressed, so the output folder is the downloads folder.
         const auto outputFilepath {context.spUpdaterBaseContext->downloadsFolder / lastSnapshotURL.filename()};
 
-        // On success routine. Append output file path to the to-publish paths.
-        const auto onSuccess {[&context, outputFilepath]([[maybe_unused]] const std::string& data)
-                              {
-                                  context.data.at("paths").push_back(outputFilepath);
-                                  context.data.at("offset") = context.currentOffset;
-                              }};
+        // The snapshot is downloaded into a partial file and renamed once complete, so an interrupted
+        // multi-GB transfer can be resumed on the next attempt instead of restarted. The partial file name
+        // derives from the snapshot URL, so a new snapshot version never resumes an old partial file.
+        const std::filesystem::path partFilepath {outputFilepath.string() + ".part"};
+
+        // Finalization routine. Publish the complete file and append its path to the to-publish paths.
+        const auto finalizeDownload {[&context, outputFilepath, partFilepath]()
+                                     {
+                                         std::filesystem::rename(partFilepath, outputFilepath);
+                                         context.data.at("paths").push_back(outputFilepath);
+                                         context.data.at("offset") = context.currentOffset;
+                                     }};
+
+        std::error_code ec;
+        const auto partSize {std::filesystem::is_regular_file(partFilepath, ec)
+                                 ? std::filesystem::file_size(partFilepath, ec)
+                                 : 0};
+
+        if (partSize > 0)
+        {
+            try
+            {
+                resumeDownload(lastSnapshotURL, partFilepath, partSize, finalizeDownload);
+                return;
+            }
+            catch (const std::exception& e)
+            {
+                // The server can't satisfy the range (e.g. the partial file is stale): restart from scratch.
+                logWarn(WM_CONTENTUPDATER, "Couldn't resume snapshot download, restarting it: %s.", e.what());
+                std::filesystem::remove(partFilepath, ec);
+            }
+        }
 
         logDebug2(WM_CONTENTUPDATER, "Downloading snapshot from '%s'", lastSnapshotURL.string().c_str());
 
         // Download the content.
-        performQueryWithRetry(lastSnapshotURL, onSuccess, "", outputFilepath);
+        performQueryWithRetry(
+            lastSnapshotURL, [&finalizeDownload](const std::string&) { finalizeDownload(); }, "", partFilepath);
+    }
+
+    /**
+     * @brief Download the missing tail of a partially downloaded snapshot with a ranged request.
+     *
+     * @param snapshotURL Snapshot URL.
+     * @param partFilepath Partial file from a previous interrupted download.
+     * @param partSize Size of the partial file, in bytes.
+     * @param finalizeDownload Routine that publishes the completed file.
+     */
+    void resumeDownload(const std::filesystem::path& snapshotURL,
+                        const std::filesystem::path& partFilepath,
+                        const uintmax_t partSize,
+                        const std::function<void()>& finalizeDownload)
+    {
+        const std::filesystem::path resumeFilepath {partFilepath.string() + ".resume"};
+
+        logDebug2(WM_CONTENTUPDATER,
+                  "Resuming snapshot download from '%s' at byte %llu",
+                  snapshotURL.string().c_str(),
+                  static_cast<unsigned long long>(partSize));
+
+        auto headers {DEFAULT_HEADERS};
+        headers.insert("Range: bytes=" + std::to_string(partSize) + "-");
+
+        // On success routine. Append the downloaded tail to the partial file and publish it.
+        const auto onSuccess {[&partFilepath, &resumeFilepath, &finalizeDownload](const std::string&)
+                              {
+                                  {
+                                      std::ofstream partFile {partFilepath, std::ios::binary | std::ios::app};
+                                      std::ifstream resumeFile {resumeFilepath, std::ios::binary};
+                                      partFile << resumeFile.rdbuf();
+                                  }
+
+                                  std::error_code ec;
+                                  std::filesystem::remove(resumeFilepath, ec);
+                                  finalizeDownload();
+                              }};
+
+        performQueryWithRetry(snapshotURL, onSuccess, "", resumeFilepath, headers);
     }
 
 public:
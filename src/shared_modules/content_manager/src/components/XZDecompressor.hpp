@@ -19,11 +19,14 @@
 #include "utils/chainOfResponsability.hpp"
 #include "utils/stringHelper.h"
 #include "utils/xzHelper.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 /**
  * @class XZDecompressor
@@ -41,11 +44,13 @@ private:
      */
     void decompress(UpdaterContext& context) const
     {
-        for (auto& path : context.data.at("paths"))
+        auto& paths {context.data.at("paths")};
+        std::vector<std::string> outputPaths(paths.size());
+
+        // Resolve the output path of each input file.
+        for (size_t index {0}; index < paths.size(); ++index)
         {
-            // Copy input path.
-            std::filesystem::path inputPath {path};
-            auto outputPath {path.get<std::string>()};
+            auto outputPath {paths.at(index).get<std::string>()};
 
             // Replace downloads folder for contents folder.
             // For example, for an output folder equal to '/tmp/output' and a path equal to
@@ -55,16 +60,31 @@ private:
                 outputPath, (outputFolder / DOWNLOAD_FOLDER).string(), (outputFolder / CONTENTS_FOLDER).string());
 
             // Remove .xz extension.
-            outputPath = Utils::rightTrim(outputPath, inputPath.extension());
+            outputPaths.at(index) = Utils::rightTrim(outputPath, std::filesystem::path(outputPath).extension());
+        }
 
-            // Decompress.
-            logDebug2(
-                WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
-            Utils::XzHelper(inputPath, outputPath).decompress();
+        // For a single file (e.g. a snapshot), all the available threads go to liblzma so multi-block
+        // content is decoded in parallel. For several files (e.g. offset chunks), the parallelism goes
+        // across files instead, with a single decoder thread each, to avoid oversubscription.
+        constexpr uint32_t ALL_AVAILABLE_THREADS {0};
+        constexpr uint32_t SINGLE_THREAD {1};
+        const auto decoderThreads {paths.size() > 1 ? SINGLE_THREAD : ALL_AVAILABLE_THREADS};
 
-            // Decompression finished: Update context path.
-            path = std::move(outputPath);
-        }
+        // Each task updates its own path entry on success, so a failure leaves the remaining input
+        // paths untouched.
+        Components::forEachParallel(paths.size(),
+                                    [&paths, &outputPaths, decoderThreads](const size_t index)
+                                    {
+                                        const std::filesystem::path inputPath {paths.at(index)};
+                                        logDebug2(WM_CONTENTUPDATER,
+                                                  "Decompressing '%s' into '%s'",
+                                                  inputPath.string().c_str(),
+                                                  outputPaths.at(index).c_str());
+                                        Utils::XzHelper(inputPath, outputPaths.at(index), decoderThreads).decompress();
+
+                                        // Decompression finished: Update context path.
+                                        paths.at(index) = std::move(outputPaths.at(index));
+                                    });
     }
 
 public:
@@ -14,9 +14,15 @@
 
 #include "json.hpp"
 #include "updaterContext.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
 #include <map>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace Components
 {
@@ -62,6 +68,67 @@ namespace Components
 
         context.data.at("stageStatus").push_back(statusObject);
     }
+
+    /**
+     * @brief Runs a set of independent tasks in parallel, bounded by the hardware concurrency.
+     *
+     * Used by the stages that process every context path with per-file independent work, so the stage
+     * wall time approaches the slowest file instead of the sum of all files. Blocks until every task
+     * finishes; if any task throws, the first exception is rethrown after all tasks have completed.
+     *
+     * @param taskCount Number of tasks to run. The task callable receives the indexes [0, taskCount).
+     * @param task Task to run for each index. Must not touch data owned by another index.
+     */
+    static void forEachParallel(const size_t taskCount, const std::function<void(size_t)>& task)
+    {
+        const auto workerCount {std::min<size_t>(taskCount, std::max(std::thread::hardware_concurrency(), 1U))};
+
+        if (workerCount <= 1)
+        {
+            for (size_t index {0}; index < taskCount; ++index)
+            {
+                task(index);
+            }
+            return;
+        }
+
+        // Each worker takes the indexes congruent to its id, so at most workerCount threads run at once.
+        std::vector<std::future<void>> futures;
+        futures.reserve(workerCount);
+        for (size_t workerId {0}; workerId < workerCount; ++workerId)
+        {
+            futures.push_back(std::async(std::launch::async,
+                                         [workerId, workerCount, taskCount, &task]()
+                                         {
+                                             for (size_t index {workerId}; index < taskCount; index += workerCount)
+                                             {
+                                                 task(index);
+                                             }
+                                         }));
+        }
+
+        // Wait for every task before rethrowing so that no worker outlives this call.
+        std::exception_ptr firstError;
+        for (auto& future : futures)
+        {
+            try
+            {
+                future.get();
+            }
+            catch (...)
+            {
+                if (!firstError)
+                {
+                    firstError = std::current_exception();
+                }
+            }
+        }
+
+        if (firstError)
+        {
+            std::rethrow_exception(firstError);
+        }
+    }
 } // namespace Components
 
 #endif // _COMPONENTS_HELPER_HPP
@@ -19,10 +19,12 @@
 #include "utils/chainOfResponsability.hpp"
 #include "utils/stringHelper.h"
 #include "utils/zlibHelper.hpp"
+#include <cstddef>
 #include <filesystem>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 /**
  * @class GzipDecompressor
@@ -40,11 +42,13 @@ private:
      */
     void decompress(UpdaterContext& context) const
     {
-        for (auto& path : context.data.at("paths"))
+        auto& paths {context.data.at("paths")};
+        std::vector<std::string> outputPaths(paths.size());
+
+        // Resolve the output path of each input file.
+        for (size_t index {0}; index < paths.size(); ++index)
         {
-            // Copy input path.
-            std::filesystem::path inputPath {path};
-            auto outputPath {path.get<std::string>()};
+            auto outputPath {paths.at(index).get<std::string>()};
 
             // Replace downloads folder for contents folder.
             // For example, for an output folder equal to '/tmp/output' and a path equal to
@@ -54,16 +58,26 @@ private:
                 outputPath, (outputFolder / DOWNLOAD_FOLDER).string(), (outputFolder / CONTENTS_FOLDER).string());
 
             // Remove .gz extension.
-            outputPath = Utils::rightTrim(outputPath, inputPath.extension());
+            outputPaths.at(index) = Utils::rightTrim(outputPath, std::filesystem::path(outputPath).extension());
+        }
 
-            // Decompress.
-            logDebug2(
-                WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
-            Utils::ZlibHelper::gzipDecompress(inputPath, outputPath);
+        // Decompress the files in parallel: each file is independent from the rest. Each task updates
+        // its own path entry on success, so a failure leaves the remaining input paths untouched.
+        // The streaming variant reuses one inflate context per worker thread and moves data in
+        // fixed-size chunks, keeping memory flat on large feeds.
+        Components::forEachParallel(paths.size(),
+                                    [&paths, &outputPaths](const size_t index)
+                                    {
+                                        const std::filesystem::path inputPath {paths.at(index)};
+                                        logDebug2(WM_CONTENTUPDATER,
+                                                  "Decompressing '%s' into '%s'",
+                                                  inputPath.string().c_str(),
+                                                  outputPaths.at(index).c_str());
+                                        Utils::ZlibHelper::gzipStreamDecompress(inputPath, outputPaths.at(index));
 
-            // Decompression finished: Update context path.
-            path = std::move(outputPath);
-        }
+                                        // Decompression finished: Update context path.
+                                        paths.at(index) = std::move(outputPaths.at(index));
+                                    });
     }
 
 public:
@@ -16,6 +16,7 @@
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
 #include <memory>
+#include <vector>
 
 /**
  * @class PubSubPublisher
@@ -26,22 +27,30 @@
 class PubSubPublisher final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    /**
+     * @brief Serialization buffer reused across publications, so periodic updates don't re-grow a
+     * payload buffer on every cycle. The heavy content itself is never inlined here: the published
+     * document carries the paths of the snapshot files, which same-host subscribers read directly.
+     */
+    std::vector<char> m_payloadBuffer {};
+
     /**
      * @brief Publish the content.
      *
      * @param context updater context.
      */
-    void publish(const UpdaterContext& context) const
+    void publish(const UpdaterContext& context)
     {
         // If there is data to publish, send it
         if (context.data.contains("paths") && !context.data.at("paths").empty())
         {
-            // serialize the JSON object
+            // serialize the JSON object into the reusable payload buffer
             const auto stringifyJson = context.data.dump();
 
             logDebug2(WM_CONTENTUPDATER, "Data to be published: '%s'", stringifyJson.c_str());
 
-            context.spUpdaterBaseContext->spChannel->send({stringifyJson.begin(), stringifyJson.end()});
+            m_payloadBuffer.assign(stringifyJson.begin(), stringifyJson.end());
+            context.spUpdaterBaseContext->spChannel->send(m_payloadBuffer);
             logDebug2(WM_CONTENTUPDATER, "Data published");
             return;
         }
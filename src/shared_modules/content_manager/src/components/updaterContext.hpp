@@ -19,8 +19,10 @@
 #include <external/nlohmann/json.hpp>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 constexpr auto DOWNLOAD_FOLDER = "downloads";
 constexpr auto CONTENTS_FOLDER = "contents";
@@ -142,6 +144,109 @@ struct UpdaterContext
      *
      */
     int currentOffset {0};
+
+    /**
+     * @brief Restore the context to its initial state, keeping allocated buffers.
+     *
+     * The 'paths' and 'stageStatus' arrays are cleared in place so their storage is reused by the
+     * next run instead of being re-grown from scratch; any extra keys a previous run added on top of
+     * the base skeleton are dropped.
+     *
+     */
+    void reset()
+    {
+        if (data.is_object() && data.contains("type") && data.contains("offset") && data.contains("paths") &&
+            data.contains("stageStatus"))
+        {
+            data.at("type") = "raw";
+            data.at("offset") = 0;
+            data.at("paths").clear();
+            data.at("stageStatus").clear();
+
+            for (auto it {data.begin()}; it != data.end();)
+            {
+                if ("type" != it.key() && "offset" != it.key() && "paths" != it.key() && "stageStatus" != it.key())
+                {
+                    it = data.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        else
+        {
+            // A previous run replaced the whole document: fall back to a fresh skeleton.
+            data = R"({ "type": "raw", "offset": 0, "paths": [], "stageStatus": [] })"_json;
+        }
+
+        currentOffset = 0;
+    }
+};
+
+/**
+ * @brief Pool of reusable UpdaterContext objects.
+ *
+ * Periodic updates create a context per cycle and let it re-grow its buffers every time; the pool
+ * recycles released contexts instead, so a run starts from the capacity the previous one already
+ * paid for. Released contexts return to the pool automatically, already reset. The pool must
+ * outlive every context it hands out.
+ *
+ */
+class UpdaterContextPool final
+{
+public:
+    /**
+     * @brief Get a context from the pool, or a new one if the pool is empty.
+     *
+     * @return std::shared_ptr<UpdaterContext> Reset context that returns to the pool when released.
+     */
+    std::shared_ptr<UpdaterContext> acquire()
+    {
+        std::unique_ptr<UpdaterContext> context;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_free.empty())
+            {
+                context = std::move(m_free.back());
+                m_free.pop_back();
+            }
+        }
+
+        if (!context)
+        {
+            context = std::make_unique<UpdaterContext>();
+        }
+
+        return std::shared_ptr<UpdaterContext>(context.release(),
+                                               [this](UpdaterContext* releasedContext)
+                                               {
+                                                   // Drop the base context reference and park the
+                                                   // object, ready for the next acquire.
+                                                   releasedContext->spUpdaterBaseContext.reset();
+                                                   releasedContext->reset();
+
+                                                   std::lock_guard<std::mutex> lock(m_mutex);
+                                                   m_free.emplace_back(releasedContext);
+                                               });
+    }
+
+    /**
+     * @brief Amount of contexts currently parked in the pool.
+     *
+     * @return size_t Pool size.
+     */
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_free.size();
+    }
+
+private:
+    mutable std::mutex m_mutex;                         ///< Mutex protecting the free list.
+    std::vector<std::unique_ptr<UpdaterContext>> m_free; ///< Contexts ready to be reused.
 };
 
 #endif // _UPDATER_CONTEXT_HPP
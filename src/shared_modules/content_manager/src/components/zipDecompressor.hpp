@@ -18,6 +18,7 @@
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
 #include "utils/zlibHelper.hpp"
+#include <cstddef>
 #include <filesystem>
 #include <iterator>
 #include <memory>
@@ -42,23 +43,31 @@ private:
     void decompress(UpdaterContext& context) const
     {
         const auto& outputFolder {context.spUpdaterBaseContext->outputFolder / CONTENTS_FOLDER};
-        std::vector<std::string> newPaths;
+        const auto& paths {context.data.at("paths")};
+        std::vector<std::vector<std::string>> decompressedFilesPerZip(paths.size());
 
-        for (const auto& path : context.data.at("paths"))
-        {
-            logDebug2(WM_CONTENTUPDATER,
-                      "Decompressing '%s' into '%s'",
-                      path.get_ref<const std::string&>().c_str(),
-                      outputFolder.string().c_str());
+        // Decompress the ZIP files in parallel: each file is independent from the rest. Each task
+        // stores its outputs on its own slot so the final paths keep the input order.
+        Components::forEachParallel(
+            paths.size(),
+            [&paths, &outputFolder, &decompressedFilesPerZip](const size_t index)
+            {
+                logDebug2(WM_CONTENTUPDATER,
+                          "Decompressing '%s' into '%s'",
+                          paths.at(index).get_ref<const std::string&>().c_str(),
+                          outputFolder.string().c_str());
 
-            // Decompress and move paths.
-            auto decompressedFiles {Utils::ZlibHelper::zipDecompress(path, outputFolder)};
+                decompressedFilesPerZip.at(index) = Utils::ZlibHelper::zipDecompress(paths.at(index), outputFolder);
+            });
+
+        // Decompression finished: Update paths.
+        std::vector<std::string> newPaths;
+        for (auto& decompressedFiles : decompressedFilesPerZip)
+        {
             newPaths.insert(newPaths.end(),
                             std::make_move_iterator(decompressedFiles.begin()),
                             std::make_move_iterator(decompressedFiles.end()));
         }
-
-        // Decompression finished: Update paths.
         context.data["paths"] = std::move(newPaths);
     }
 
@@ -80,3 +80,16 @@ void ContentModuleFacade::changeSchedulerInterval(const std::string& name, const
         logError(WM_CONTENTUPDATER, "Couldn't change scheduled interval: %s.", e.what());
     }
 }
+
+void ContentModuleFacade::triggerScheduling(const std::string& name)
+{
+    std::shared_lock<std::shared_mutex> lock {m_mutex};
+    try
+    {
+        m_providers.at(name)->triggerScheduledAction();
+    }
+    catch (const std::exception& e)
+    {
+        logError(WM_CONTENTUPDATER, "Couldn't trigger scheduled action: %s.", e.what());
+    }
+}
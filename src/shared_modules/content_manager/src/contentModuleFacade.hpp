@@ -77,6 +77,14 @@ public:
      * @param interval New scheduler interval.
      */
     void changeSchedulerInterval(const std::string& name, size_t interval);
+
+    /**
+     * @brief Triggers an immediate run of a provider's scheduled action, used on publish
+     * notifications so consumers don't wait out the polling interval.
+     *
+     * @param name Provider name.
+     */
+    void triggerScheduling(const std::string& name);
 };
 
 #endif //_CONTENT_MODULE_IMPLEMENTATION_HPP
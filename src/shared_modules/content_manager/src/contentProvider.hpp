@@ -79,6 +79,15 @@ public:
     {
         m_action->changeSchedulerInterval(interval);
     }
+
+    /**
+     * @brief Triggers an immediate run of the scheduled action.
+     *
+     */
+    void triggerScheduledAction()
+    {
+        m_action->triggerScheduledAction();
+    }
 };
 
 #endif //_CONTENT_PROVIDER_HPP
@@ -17,6 +17,58 @@
 #include <filesystem>
 #include <utility>
 
+/**
+ * @brief Run a content update, coalescing identical concurrent requests.
+ *
+ * The first caller for a key becomes the runner and executes the update; callers
+ * arriving with the same key while it runs wait on the runner's future and share
+ * its outcome (success or exception), so one multi-minute update serves every
+ * consumer that asked for it. Different keys run concurrently on the server's
+ * worker pool.
+ */
+void OnDemandManager::runCoalesced(const std::string& key, const std::function<void()>& runUpdate)
+{
+    std::shared_future<void> future;
+    std::promise<void> promise;
+    auto runner {false};
+
+    {
+        std::lock_guard<std::mutex> lock {m_inFlightMutex};
+
+        if (const auto it {m_inFlight.find(key)}; it != m_inFlight.end())
+        {
+            future = it->second;
+        }
+        else
+        {
+            future = promise.get_future().share();
+            m_inFlight.emplace(key, future);
+            runner = true;
+        }
+    }
+
+    if (runner)
+    {
+        try
+        {
+            runUpdate();
+            promise.set_value();
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock {m_inFlightMutex};
+            m_inFlight.erase(key);
+        }
+    }
+
+    // Fan the runner's outcome out to every coalesced request.
+    future.get();
+}
+
 /**
  * @brief Start the server
  */
@@ -48,10 +100,16 @@ void OnDemandManager::startServer()
                                                                  "offset=-1 (Do not replace current offset)");
                                  }
 
-                                 const auto& it {m_endpoints.find(req.matches[1].str())};
+                                 const auto topic {req.matches[1].str()};
+                                 const auto& it {m_endpoints.find(topic)};
                                  if (it != m_endpoints.end())
                                  {
-                                     it->second(ActionOrchestrator::UpdateData::createContentUpdateData(offset));
+                                     const auto& update {it->second};
+                                     runCoalesced(topic + "#" + std::to_string(offset),
+                                                  [&update, offset]() {
+                                                      update(ActionOrchestrator::UpdateData::createContentUpdateData(
+                                                          offset));
+                                                  });
                                      res.status = 200;
                                  }
                                  else
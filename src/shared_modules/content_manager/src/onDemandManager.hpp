@@ -12,17 +12,23 @@
 #ifndef _ONDEMAND_MANAGER_HPP
 #define _ONDEMAND_MANAGER_HPP
 
-// Define the number of threads in the thread pool for httplib.
+// Define the number of threads in the thread pool for httplib. Content updates
+// run inline in the handler and can take minutes, so keep enough workers for
+// other topics and for the offset/hash endpoints to be served meanwhile.
 #ifndef CPPHTTPLIB_THREAD_POOL_COUNT
-#define CPPHTTPLIB_THREAD_POOL_COUNT 2
+#define CPPHTTPLIB_THREAD_POOL_COUNT 8
 #endif
 
 #include "actionOrchestrator.hpp"
 #include "singleton.hpp"
 #include <external/cpp-httplib/httplib.h>
 #include <functional>
+#include <future>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
+#include <unordered_map>
 
 /**
  * @brief OnDemandManager class.
@@ -36,6 +42,18 @@ private:
     std::shared_mutex m_mutex {};
     std::thread m_serverThread {};
     std::atomic<bool> m_runningTrigger {true};
+
+    /**
+     * @brief Content updates in flight, keyed by topic and offset.
+     *
+     * The first request for a key runs the update; identical requests arriving
+     * while it runs wait on the same future and share its outcome instead of
+     * queueing a redundant multi-minute run.
+     */
+    std::unordered_map<std::string, std::shared_future<void>> m_inFlight {};
+    std::mutex m_inFlightMutex {};
+
+    void runCoalesced(const std::string& key, const std::function<void()>& runUpdate);
     void startServer();
     void stopServer();
 
@@ -15,6 +15,8 @@
 #include "updaterContext.hpp"
 #include "gtest/gtest.h"
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
 
 const auto OK_STATUS = R"([{"stage":"CtiSnapshotDownloader","status":"ok"}])"_json;
@@ -177,3 +179,44 @@ TEST_F(CtiSnapshotDownloaderTest, MissingLastSnapshotOffsetMetadata)
     expectedData["offset"] = 0;
     EXPECT_EQ(m_spUpdaterContext->data, expectedData);
 }
+
+/**
+ * @brief Tests that a partial file from an interrupted download is resumed instead of re-downloaded.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotResumePartialDownload)
+{
+    // Snapshot content served by the fake server.
+    const std::string snapshotContent {R"({"data":"content"})"};
+
+    // Simulate an interrupted download: create a partial file with the first bytes of the snapshot.
+    const auto expectedContentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / SNAPSHOT_FILE_NAME};
+    const auto partPath {expectedContentPath.string() + ".part"};
+    constexpr auto PARTIAL_BYTES {5};
+    {
+        std::ofstream partFile {partPath, std::ios::binary};
+        partFile << snapshotContent.substr(0, PARTIAL_BYTES);
+    }
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    // Set expected data.
+    constexpr auto EXPECTED_CURRENT_OFFSET {3};
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(expectedContentPath);
+    expectedData["stageStatus"] = OK_STATUS;
+    expectedData["type"] = CONTENT_TYPE;
+    expectedData["offset"] = EXPECTED_CURRENT_OFFSET;
+
+    EXPECT_EQ(m_spUpdaterContext->currentOffset, EXPECTED_CURRENT_OFFSET);
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+
+    // The completed file must hold the whole snapshot and the partial files must be gone.
+    std::ifstream downloadedFile {expectedContentPath, std::ios::binary};
+    const std::string downloadedContent {(std::istreambuf_iterator<char>(downloadedFile)),
+                                         std::istreambuf_iterator<char>()};
+    EXPECT_EQ(downloadedContent, snapshotContent);
+    EXPECT_FALSE(std::filesystem::exists(partPath));
+    EXPECT_FALSE(std::filesystem::exists(partPath + ".resume"));
+}
@@ -17,7 +17,14 @@
 #include "customDeleter.hpp"
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
 #include <vector>
 
 template<typename F, typename G, F func1, G func2>
@@ -76,6 +83,56 @@ namespace Utils
             }
         }
 
+        struct FileEntry
+        {
+            std::filesystem::path path;
+            std::vector<char> data;
+        };
+
+        static std::vector<char> readEntryData(struct archive* archiveRead, const std::atomic<bool>& forceStop)
+        {
+            const void* buff {};
+            size_t size {};
+            int64_t offset {};
+            std::vector<char> data;
+
+            while (!forceStop.load())
+            {
+                auto retVal = archive_read_data_block(archiveRead, &buff, &size, &offset);
+                if (retVal == ARCHIVE_EOF)
+                {
+                    break;
+                }
+
+                if (retVal != ARCHIVE_OK)
+                {
+                    const std::string errMsg = archive_error_string(archiveRead) ? archive_error_string(archiveRead) : "Unknown error";
+                    throw std::runtime_error("Error reading file during data copy. Error: " + errMsg);
+                }
+
+                if (data.size() < static_cast<size_t>(offset) + size)
+                {
+                    data.resize(static_cast<size_t>(offset) + size);
+                }
+
+                std::memcpy(data.data() + offset, buff, size);
+            }
+
+            return data;
+        }
+
+        static bool matchesExtractOnly(const std::filesystem::path& outputDirPath,
+                                       const std::vector<std::string>& extractOnly)
+        {
+            return extractOnly.empty() || std::find_if(extractOnly.cbegin(),
+                                                       extractOnly.cend(),
+                                                       [&outputDirPath](const std::string& path)
+                                                       {
+                                                           size_t pos = outputDirPath.string().find(path);
+                                                           return pos != std::string::npos;
+                                                       }) != extractOnly.cend();
+        }
+
     public:
         ArchiveHelper(const ArchiveHelper&) = delete;
         ArchiveHelper& operator=(const ArchiveHelper&) = delete;
@@ -168,6 +225,270 @@ namespace Utils
                 }
             }
         }
+
+        /**
+         * @brief Uncompress TAR file with one reader and several writer threads.
+         *
+         * The archive is read sequentially (libarchive imposes it), but file payloads
+         * are handed to a writer pool so disk writes overlap the read/decode of the
+         * next entries. Directories are created by the reader in archive order, before
+         * any file below them is queued, so writers never race a missing parent.
+         *
+         * @param filename Compressed (.tar) file name.
+         * @param forceStop Flag to interrupt the extraction, removing extracted content.
+         * @param outputDir Destination path.
+         * @param extractOnly Compressed element to extract.
+         * @param writerThreads Number of writer threads.
+         */
+        static void decompressParallel(const std::string& filename,
+                                       const std::atomic<bool>& forceStop = false,
+                                       const std::string& outputDir = "",
+                                       const std::vector<std::string>& extractOnly = {},
+                                       const unsigned int writerThreads = std::thread::hardware_concurrency())
+        {
+            struct archive_entry* entry;
+            ArchiveReadPtr archiveRead(archive_read_new());
+
+            archive_read_support_format_tar(archiveRead.get());
+
+            auto retVal = archive_read_open_filename(archiveRead.get(), filename.c_str(), 0);
+
+            if (retVal == ARCHIVE_EOF)
+            {
+                return;
+            }
+
+            if (retVal != ARCHIVE_OK)
+            {
+                const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+            }
+
+            constexpr auto MAX_PENDING_ENTRIES {64u};
+            const auto threads {writerThreads ? writerThreads : 1u};
+
+            std::queue<FileEntry> pending;
+            std::mutex mutex;
+            std::condition_variable notEmpty;
+            std::condition_variable notFull;
+            bool readerDone {false};
+            std::exception_ptr error;
+            std::vector<std::string> content {};
+
+            std::vector<std::thread> writers;
+            writers.reserve(threads);
+
+            for (unsigned int i = 0; i < threads; ++i)
+            {
+                writers.emplace_back(
+                    [&]()
+                    {
+                        while (true)
+                        {
+                            FileEntry item;
+                            {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                notEmpty.wait(lock,
+                                              [&]()
+                                              {
+                                                  return !pending.empty() || readerDone;
+                                              });
+
+                                if (pending.empty())
+                                {
+                                    return;
+                                }
+
+                                item = std::move(pending.front());
+                                pending.pop();
+                                notFull.notify_one();
+
+                                if (error)
+                                {
+                                    // Keep draining so the reader never blocks on a full queue
+                                    continue;
+                                }
+                            }
+
+                            try
+                            {
+                                std::ofstream output(item.path, std::ios::binary | std::ios::trunc);
+
+                                if (!output.good())
+                                {
+                                    throw std::runtime_error("Error opening '" + item.path.string() + "' for writing");
+                                }
+
+                                output.write(item.data.data(), item.data.size());
+                            }
+                            catch (...)
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+
+                                if (!error)
+                                {
+                                    error = std::current_exception();
+                                }
+                            }
+                        }
+                    });
+            }
+
+            try
+            {
+                while (!forceStop.load())
+                {
+                    retVal = archive_read_next_header(archiveRead.get(), &entry);
+                    if (retVal == ARCHIVE_EOF)
+                    {
+                        break;
+                    }
+
+                    if (retVal != ARCHIVE_OK)
+                    {
+                        const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                        throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
+                    }
+
+                    std::filesystem::path outputDirPath(std::filesystem::current_path() / outputDir /
+                                                        archive_entry_pathname(entry));
+
+                    if (matchesExtractOnly(outputDirPath, extractOnly))
+                    {
+                        content.emplace_back(outputDirPath);
+
+                        if (AE_IFDIR == archive_entry_filetype(entry))
+                        {
+                            std::filesystem::create_directories(outputDirPath);
+                            archive_read_data_skip(archiveRead.get());
+                        }
+                        else
+                        {
+                            // Defensive: archives may carry files whose directory has no entry
+                            std::filesystem::create_directories(outputDirPath.parent_path());
+
+                            FileEntry item {std::move(outputDirPath), readEntryData(archiveRead.get(), forceStop)};
+
+                            std::unique_lock<std::mutex> lock(mutex);
+                            notFull.wait(lock,
+                                         [&]()
+                                         {
+                                             return pending.size() < MAX_PENDING_ENTRIES || error;
+                                         });
+
+                            if (error)
+                            {
+                                break;
+                            }
+
+                            pending.push(std::move(item));
+                            notEmpty.notify_one();
+                        }
+                    }
+                    else
+                    {
+                        archive_read_data_skip(archiveRead.get());
+                    }
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                readerDone = true;
+            }
+            notEmpty.notify_all();
+
+            for (auto& writer : writers)
+            {
+                writer.join();
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+
+            if (forceStop.load())
+            {
+                for (const auto& item : content)
+                {
+                    std::filesystem::remove_all(item);
+                }
+            }
+        }
+
+        /**
+         * @brief Uncompress TAR file straight into a key-value sink, skipping the
+         * intermediate on-disk tree.
+         *
+         * Meant for content that is immediately re-ingested, e.g. into RocksDB: pass a
+         * sink calling RocksDBWrapper::put(path, rocksdb::Slice(data.data(), data.size())).
+         * Keys are the entry pathnames inside the archive; directory entries carry no
+         * data and are skipped.
+         *
+         * @param filename Compressed (.tar) file name.
+         * @param sink Callback receiving each regular file's pathname and content.
+         * @param forceStop Flag to interrupt the extraction.
+         * @param extractOnly Compressed element to extract.
+         */
+        static void decompressToSink(const std::string& filename,
+                                     const std::function<void(const std::string&, const std::vector<char>&)>& sink,
+                                     const std::atomic<bool>& forceStop = false,
+                                     const std::vector<std::string>& extractOnly = {})
+        {
+            struct archive_entry* entry;
+            ArchiveReadPtr archiveRead(archive_read_new());
+
+            archive_read_support_format_tar(archiveRead.get());
+
+            auto retVal = archive_read_open_filename(archiveRead.get(), filename.c_str(), 0);
+
+            if (retVal == ARCHIVE_EOF)
+            {
+                return;
+            }
+
+            if (retVal != ARCHIVE_OK)
+            {
+                const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                throw std::runtime_error("Error opening file during decompression. Error: " + errMsg);
+            }
+
+            while (!forceStop.load())
+            {
+                retVal = archive_read_next_header(archiveRead.get(), &entry);
+                if (retVal == ARCHIVE_EOF)
+                {
+                    return;
+                }
+
+                if (retVal != ARCHIVE_OK)
+                {
+                    const std::string errMsg = archive_error_string(archiveRead.get()) ? archive_error_string(archiveRead.get()) : "Unknown error";
+                    throw std::runtime_error("Error reading next header during decompression. Error: " + errMsg);
+                }
+
+                const std::string pathname {archive_entry_pathname(entry)};
+
+                if (AE_IFREG == archive_entry_filetype(entry) && matchesExtractOnly(pathname, extractOnly))
+                {
+                    sink(pathname, readEntryData(archiveRead.get(), forceStop));
+                }
+                else
+                {
+                    archive_read_data_skip(archiveRead.get());
+                }
+            }
+        }
     };
 } // namespace Utils
 
@@ -38,6 +38,46 @@ static void popBenchmark(benchmark::State& state)
 
 BENCHMARK(popBenchmark);
 
+static void pushAtDepthBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBQueue<std::string> queue(TEST_DB);
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        queue.push("test");
+    }
+
+    for (auto _ : state)
+    {
+        queue.push("test");
+    }
+}
+
+BENCHMARK(pushAtDepthBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void popAtDepthBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBQueue<std::string> queue(TEST_DB);
+    for (int64_t i = 0; i < state.range(0); i++)
+    {
+        queue.push("test");
+    }
+
+    // Push back after each pop so the queue stays at the requested depth
+    for (auto _ : state)
+    {
+        queue.pop();
+        queue.push("test");
+    }
+}
+
+BENCHMARK(popAtDepthBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
+
 static void frontBenchmark(benchmark::State& state)
 {
     std::error_code ec;
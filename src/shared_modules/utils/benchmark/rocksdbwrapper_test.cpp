@@ -0,0 +1,162 @@
+#include "rocksDBWrapper.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+constexpr auto WRAPPER_TEST_DB = "wrapper_test.db";
+constexpr auto TEST_COLUMN = "bench_column";
+constexpr auto VALUE_64B = "0123456789012345678901234567890123456789012345678901234567890123";
+constexpr auto SEEK_BUCKETS = 16;
+
+static std::string paddedKey(const int64_t index)
+{
+    auto key = std::to_string(index);
+    return std::string(10 - key.size(), '0') + key;
+}
+
+// Keys are spread over SEEK_BUCKETS prefixes so the seek benchmarks scan a bounded range.
+static std::string bucketKey(const int64_t index)
+{
+    return "bucket_" + std::to_string(index % SEEK_BUCKETS) + "_" + paddedKey(index);
+}
+
+static std::unique_ptr<Utils::RocksDBWrapper> freshDatabase()
+{
+    std::error_code ec;
+    std::filesystem::remove_all(WRAPPER_TEST_DB, ec);
+    return std::make_unique<Utils::RocksDBWrapper>(WRAPPER_TEST_DB);
+}
+
+// Prepopulated database of state.range(0) 64-byte values, in the default column
+// or in TEST_COLUMN.
+static std::unique_ptr<Utils::RocksDBWrapper> populatedDatabase(const int64_t entries, const bool useColumn)
+{
+    auto db = freshDatabase();
+    if (useColumn)
+    {
+        db->createColumn(TEST_COLUMN);
+    }
+
+    for (int64_t i = 0; i < entries; ++i)
+    {
+        if (useColumn)
+        {
+            db->put(bucketKey(i), VALUE_64B, TEST_COLUMN);
+        }
+        else
+        {
+            db->put(bucketKey(i), VALUE_64B);
+        }
+    }
+    return db;
+}
+
+static void putBenchmark(benchmark::State& state)
+{
+    auto db = freshDatabase();
+
+    int64_t next = 0;
+    for (auto _ : state)
+    {
+        db->put(paddedKey(next++), VALUE_64B);
+    }
+}
+
+BENCHMARK(putBenchmark);
+
+static void getHitBenchmark(benchmark::State& state)
+{
+    const auto entries = state.range(0);
+    auto db = populatedDatabase(entries, false);
+
+    int64_t next = 0;
+    for (auto _ : state)
+    {
+        rocksdb::PinnableSlice value;
+        db->get(bucketKey(next), value);
+        benchmark::DoNotOptimize(value);
+        next = (next + 1) % entries;
+    }
+}
+
+BENCHMARK(getHitBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void getMissBenchmark(benchmark::State& state)
+{
+    const auto entries = state.range(0);
+    auto db = populatedDatabase(entries, false);
+
+    int64_t next = 0;
+    for (auto _ : state)
+    {
+        rocksdb::PinnableSlice value;
+        // Keys outside the populated range, the bloom filter should reject them
+        db->get("miss_" + paddedKey(next++), value);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(getMissBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void seekScanBenchmark(benchmark::State& state)
+{
+    const auto entries = state.range(0);
+    auto db = populatedDatabase(entries, false);
+
+    int64_t bucket = 0;
+    for (auto _ : state)
+    {
+        // One iteration scans one prefix bucket, entries/SEEK_BUCKETS keys
+        int64_t scanned = 0;
+        for (const auto& [key, value] : db->seek("bucket_" + std::to_string(bucket) + "_"))
+        {
+            benchmark::DoNotOptimize(value);
+            ++scanned;
+        }
+        benchmark::DoNotOptimize(scanned);
+        bucket = (bucket + 1) % SEEK_BUCKETS;
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) / SEEK_BUCKETS));
+}
+
+BENCHMARK(seekScanBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void columnFamilyIterationBenchmark(benchmark::State& state)
+{
+    const auto entries = state.range(0);
+    auto db = populatedDatabase(entries, true);
+
+    for (auto _ : state)
+    {
+        // Full scan of the named column family, as the feed updaters do
+        int64_t scanned = 0;
+        for (const auto& [key, value] : db->seek("bucket_", TEST_COLUMN))
+        {
+            benchmark::DoNotOptimize(value);
+            ++scanned;
+        }
+        benchmark::DoNotOptimize(scanned);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(columnFamilyIterationBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
+
+static void columnFamilyGetBenchmark(benchmark::State& state)
+{
+    const auto entries = state.range(0);
+    auto db = populatedDatabase(entries, true);
+
+    int64_t next = 0;
+    for (auto _ : state)
+    {
+        rocksdb::PinnableSlice value;
+        db->get(bucketKey(next), value, TEST_COLUMN);
+        benchmark::DoNotOptimize(value);
+        next = (next + 1) % entries;
+    }
+}
+
+BENCHMARK(columnFamilyGetBenchmark)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -11,10 +11,14 @@
 #ifndef _EPOLL_WRAPPER_HPP
 #define _EPOLL_WRAPPER_HPP
 
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
 #include <stdexcept>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <tuple>
 #include <unistd.h>
 
 class EpollWrapper final
@@ -91,6 +95,89 @@ public:
             std::cerr << "Error removing FD from interface." << std::endl;
         }
     }
+
+    // Create an eventfd wakeup channel registered edge-triggered on this epoll instance.
+    // A single descriptor replaces a pipe pair, and the kernel coalesces pending
+    // notifications into one event. Returns the channel descriptor.
+    int addWakeupChannel() const
+    {
+        const auto fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fd == -1)
+        {
+            throw std::runtime_error("Error creating eventfd wakeup channel");
+        }
+
+        addDescriptor(fd, EPOLLIN | EPOLLET);
+        return fd;
+    }
+
+    // Wake up the epoll loop through a wakeup channel.
+    void notifyWakeup(const int fd) const
+    {
+        const uint64_t one {1};
+        std::ignore = ::write(fd, &one, sizeof(one));
+    }
+
+    // Consume every pending notification from a wakeup channel.
+    void drainWakeup(const int fd) const
+    {
+        uint64_t counter {0};
+        std::ignore = ::read(fd, &counter, sizeof(counter));
+    }
+
+    // Unregister a wakeup channel and close its descriptor.
+    void removeWakeupChannel(const int fd) const
+    {
+        deleteDescriptor(fd);
+        ::close(fd);
+    }
+
+    // Create a periodic timerfd registered edge-triggered on this epoll instance, so
+    // timing logic is handled by the same wait loop as the sockets. Returns the timer
+    // descriptor.
+    int addTimer(const uint32_t intervalMs) const
+    {
+        if (intervalMs == 0)
+        {
+            // A zero interval would disarm the timer instead of arming it.
+            throw std::runtime_error("Error arming timerfd, the interval cannot be zero");
+        }
+
+        const auto fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (fd == -1)
+        {
+            throw std::runtime_error("Error creating timerfd");
+        }
+
+        itimerspec spec {};
+        spec.it_interval.tv_sec = intervalMs / 1000;
+        spec.it_interval.tv_nsec = static_cast<long>(intervalMs % 1000) * 1000000L;
+        spec.it_value = spec.it_interval;
+
+        if (::timerfd_settime(fd, 0, &spec, nullptr) == -1)
+        {
+            ::close(fd);
+            throw std::runtime_error("Error arming timerfd");
+        }
+
+        addDescriptor(fd, EPOLLIN | EPOLLET);
+        return fd;
+    }
+
+    // Consume a timer event, returning the number of expirations since the last read.
+    uint64_t drainTimer(const int fd) const
+    {
+        uint64_t expirations {0};
+        std::ignore = ::read(fd, &expirations, sizeof(expirations));
+        return expirations;
+    }
+
+    // Unregister a timer and close its descriptor.
+    void removeTimer(const int fd) const
+    {
+        deleteDescriptor(fd);
+        ::close(fd);
+    }
 };
 
 #endif // _EPOLL_WRAPPER_HPP
@@ -34,12 +34,15 @@ namespace Utils
     {
         public:
             HashData(const HashType hashType = HashType::Sha1)
-                : m_spCtx{createContext()}
+                : m_spCtx{acquireContext()}
             {
                 initializeContext(hashType, m_spCtx);
             }
             // LCOV_EXCL_START
-            ~HashData() = default;
+            ~HashData()
+            {
+                releaseContext(std::move(m_spCtx));
+            }
             // LCOV_EXCL_STOP
             void update(const void* data, const size_t size)
             {
@@ -89,6 +92,47 @@ namespace Utils
                 }
             };
 
+            using ContextPtr = std::unique_ptr<EVP_MD_CTX, EvpContextDeleter>;
+
+            // Per-thread cache of digest contexts. Creating an EVP_MD_CTX allocates on
+            // every call, which dominates when hashing many small buffers; reinitializing
+            // a pooled context is nearly free. The digest computation itself already uses
+            // the hardware path (SHA-NI/NEON) selected by OpenSSL at runtime.
+            static constexpr size_t CONTEXT_POOL_MAX_SIZE {4};
+
+            static std::vector<ContextPtr>& contextPool()
+            {
+                thread_local std::vector<ContextPtr> pool;
+                return pool;
+            }
+
+            static ContextPtr acquireContext()
+            {
+                auto& pool { contextPool() };
+
+                if (!pool.empty())
+                {
+                    auto ctx { std::move(pool.back()) };
+                    pool.pop_back();
+                    return ctx;
+                }
+
+                return ContextPtr{ createContext() };
+            }
+
+            static void releaseContext(ContextPtr&& spCtx)
+            {
+                if (spCtx)
+                {
+                    auto& pool { contextPool() };
+
+                    if (pool.size() < CONTEXT_POOL_MAX_SIZE)
+                    {
+                        pool.push_back(std::move(spCtx));
+                    }
+                }
+            }
+
             static EVP_MD_CTX* createContext()
             {
                 auto ctx{ EVP_MD_CTX_create() };
@@ -105,7 +149,7 @@ namespace Utils
                 // LCOV_EXCL_STOP
                 return ctx;
             }
-            static void initializeContext(const HashType hashType, std::unique_ptr<EVP_MD_CTX, EvpContextDeleter>& spCtx)
+            static void initializeContext(const HashType hashType, ContextPtr& spCtx)
             {
                 auto ret{0};
 
@@ -128,7 +172,7 @@ namespace Utils
                     };
                 }
             }
-            std::unique_ptr<EVP_MD_CTX, EvpContextDeleter> m_spCtx;
+            ContextPtr m_spCtx;
     };
 
     /**
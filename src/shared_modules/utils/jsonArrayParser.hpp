@@ -13,10 +13,15 @@
 #define _JSON_ARRAY_PARSER_HPP
 
 #include "json.hpp"
+#include <cctype>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace JsonArray
 {
@@ -420,6 +425,404 @@ namespace JsonArray
         size_t m_itemId {0};
     };
 
+    /**
+     * @brief Splits the raw text of a JSON document at the element boundaries of the target array.
+     *
+     * @details Walks the byte stream tracking strings, escapes and container depth, comparing object keys
+     * against the pointer tokens to locate the target array. Each element of the array is handed to a
+     * callback as raw text, so the expensive DOM construction can happen elsewhere (e.g. on worker
+     * threads). Everything outside the array items is accumulated as the document body.
+     * Since the path is resolved through object keys, pointers that traverse arrays (index tokens) are not
+     * supported: the target array will not be found.
+     */
+    class RawJsonArrayScanner final
+    {
+    public:
+        /**
+         * @brief Construct a new Raw Json Array Scanner object
+         *
+         * @param targetArrayPointer JSON Pointer to the target array. Must traverse object keys only.
+         * @param elementCallback Callback invoked with the raw text of every element of the target array. If
+         * the callback returns false the scan stops.
+         */
+        RawJsonArrayScanner(const nlohmann::json::json_pointer& targetArrayPointer,
+                            std::function<bool(std::string&&)> elementCallback)
+            : m_elementCallback(std::move(elementCallback))
+        {
+            // Split the pointer into unescaped reference tokens.
+            const auto pointerStr {targetArrayPointer.to_string()};
+            size_t pos {1};
+            while (pos <= pointerStr.size())
+            {
+                const auto separator {pointerStr.find('/', pos)};
+                auto token {pointerStr.substr(pos, separator == std::string::npos ? std::string::npos
+                                                                                  : separator - pos)};
+                unescapePointerToken(token);
+                m_pointerTokens.push_back(std::move(token));
+
+                if (separator == std::string::npos)
+                {
+                    break;
+                }
+                pos = separator + 1;
+            }
+        }
+
+        /**
+         * @brief Scans the input stream, invoking the element callback for each element of the target array.
+         *
+         * @param stream Input stream with the JSON document.
+         * @return std::string The document body: the original JSON with the target array items removed.
+         * Empty if the element callback stopped the scan.
+         */
+        std::string scan(std::istream& stream)
+        {
+            constexpr size_t READ_BUFFER_SIZE {1 << 20};
+            std::vector<char> buffer(READ_BUFFER_SIZE);
+
+            while (stream)
+            {
+                stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                const auto bytesRead {static_cast<size_t>(stream.gcount())};
+
+                for (size_t i = 0; i < bytesRead; ++i)
+                {
+                    if (!processChar(buffer[i]))
+                    {
+                        // The element callback stopped the scan.
+                        return {};
+                    }
+                }
+            }
+
+            if (!m_targetFound)
+            {
+                throw std::runtime_error {"The target array does not exist."};
+            }
+
+            return std::move(m_body);
+        }
+
+    private:
+        /**
+         * @brief Unescape a JSON Pointer reference token in place (~1 -> '/', ~0 -> '~').
+         *
+         * @param token Reference token.
+         */
+        static void unescapePointerToken(std::string& token)
+        {
+            for (size_t pos {0}; (pos = token.find('~', pos)) != std::string::npos && pos + 1 < token.size();
+                 ++pos)
+            {
+                if (token[pos + 1] == '1')
+                {
+                    token.replace(pos, 2, "/");
+                }
+                else if (token[pos + 1] == '0')
+                {
+                    token.replace(pos, 2, "~");
+                }
+            }
+        }
+
+        /**
+         * @brief Process one character of the document.
+         *
+         * @param c Input character.
+         * @return false if the element callback stopped the scan.
+         */
+        bool processChar(const char c)
+        {
+            if (m_inTarget)
+            {
+                return processTargetChar(c);
+            }
+
+            m_body += c;
+
+            if (m_inString)
+            {
+                if (m_escaped)
+                {
+                    m_escaped = false;
+
+                    if (m_capturingKey)
+                    {
+                        m_keyBuffer += c;
+                    }
+                }
+                else if (c == '\\')
+                {
+                    m_escaped = true;
+
+                    if (m_capturingKey)
+                    {
+                        m_keyBuffer += c;
+                    }
+                }
+                else if (c == '"')
+                {
+                    m_inString = false;
+
+                    if (m_capturingKey)
+                    {
+                        m_capturingKey = false;
+                        // Does the completed key extend the matched path?
+                        m_awaitingMatchedValue = (m_keyBuffer == m_pointerTokens[m_matchedDepth]);
+                    }
+                }
+                else if (m_capturingKey)
+                {
+                    m_keyBuffer += c;
+                }
+
+                return true;
+            }
+
+            switch (c)
+            {
+                case '"':
+                    m_inString = true;
+
+                    if (m_expectKey)
+                    {
+                        // Only capture keys that could extend the currently matched path.
+                        m_capturingKey = (m_matchedDepth < m_pointerTokens.size()) &&
+                                         (m_containerStack.size() == m_matchedDepth + 1);
+                        m_keyBuffer.clear();
+                        m_expectKey = false;
+                    }
+                    else
+                    {
+                        // A string value: cannot be the target array.
+                        m_awaitingMatchedValue = false;
+                    }
+                    break;
+
+                case '{':
+                    if (m_awaitingMatchedValue)
+                    {
+                        // The matched key's value is an object: descend one path level.
+                        m_awaitingMatchedValue = false;
+                        ++m_matchedDepth;
+                    }
+                    m_containerStack.push_back('{');
+                    m_expectKey = true;
+                    break;
+
+                case '[':
+                    if ((m_awaitingMatchedValue && m_matchedDepth + 1 == m_pointerTokens.size()) ||
+                        (m_pointerTokens.empty() && m_containerStack.empty()))
+                    {
+                        // This is the start of the target array.
+                        m_awaitingMatchedValue = false;
+                        m_inTarget = true;
+                        m_targetFound = true;
+                        m_elementDepth = 0;
+                        m_elementActive = false;
+                        m_element.clear();
+                    }
+                    else
+                    {
+                        m_awaitingMatchedValue = false;
+                        m_containerStack.push_back('[');
+                    }
+                    break;
+
+                case '}':
+                case ']':
+                    if (!m_containerStack.empty())
+                    {
+                        m_containerStack.pop_back();
+                    }
+
+                    // Leaving a matched object level unwinds the path match.
+                    if (m_containerStack.size() < m_matchedDepth)
+                    {
+                        m_matchedDepth = m_containerStack.size();
+                    }
+                    break;
+
+                case ',':
+                    if (!m_containerStack.empty() && m_containerStack.back() == '{')
+                    {
+                        m_expectKey = true;
+                    }
+                    break;
+
+                case ':':
+                    break;
+
+                default:
+                    if (!std::isspace(static_cast<unsigned char>(c)))
+                    {
+                        // A literal or number value: cannot be the target array.
+                        m_awaitingMatchedValue = false;
+                    }
+                    break;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Process one character inside the target array.
+         *
+         * @param c Input character.
+         * @return false if the element callback stopped the scan.
+         */
+        bool processTargetChar(const char c)
+        {
+            if (m_inString)
+            {
+                m_element += c;
+
+                if (m_escaped)
+                {
+                    m_escaped = false;
+                }
+                else if (c == '\\')
+                {
+                    m_escaped = true;
+                }
+                else if (c == '"')
+                {
+                    m_inString = false;
+                }
+
+                return true;
+            }
+
+            switch (c)
+            {
+                case '"':
+                    m_inString = true;
+                    m_elementActive = true;
+                    m_element += c;
+                    break;
+
+                case '{':
+                case '[':
+                    ++m_elementDepth;
+                    m_elementActive = true;
+                    m_element += c;
+                    break;
+
+                case '}':
+                    --m_elementDepth;
+                    m_element += c;
+                    break;
+
+                case ']':
+                    if (m_elementDepth == 0)
+                    {
+                        // End of the target array: emit the last element, if any.
+                        if (m_elementActive && !emitElement())
+                        {
+                            return false;
+                        }
+
+                        m_inTarget = false;
+                        // The body keeps the target array, emptied.
+                        m_body += ']';
+                        return true;
+                    }
+
+                    --m_elementDepth;
+                    m_element += c;
+                    break;
+
+                case ',':
+                    if (m_elementDepth == 0)
+                    {
+                        if (!emitElement())
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        m_element += c;
+                    }
+                    break;
+
+                default:
+                    if (m_elementDepth == 0 && !m_elementActive && std::isspace(static_cast<unsigned char>(c)))
+                    {
+                        // Whitespace between elements.
+                        break;
+                    }
+
+                    m_elementActive = true;
+                    m_element += c;
+                    break;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Hand the completed element to the callback.
+         *
+         * @return false if the callback stopped the scan.
+         */
+        bool emitElement()
+        {
+            m_elementActive = false;
+            auto element {std::move(m_element)};
+            m_element = {};
+            return m_elementCallback(std::move(element));
+        }
+
+        /// Callback for the raw text of each element of the target array
+        std::function<bool(std::string&&)> m_elementCallback;
+
+        /// Unescaped reference tokens of the target array pointer
+        std::vector<std::string> m_pointerTokens {};
+
+        /// Document body: the original JSON with the target array items removed
+        std::string m_body {};
+
+        /// Stack with the currently open containers ('{' or '[')
+        std::vector<char> m_containerStack {};
+
+        /// Buffer with the object key being captured
+        std::string m_keyBuffer {};
+
+        /// Raw text of the target array element being captured
+        std::string m_element {};
+
+        /// Number of pointer tokens matched by the current nesting
+        size_t m_matchedDepth {0};
+
+        /// Container depth inside the current target array element
+        size_t m_elementDepth {0};
+
+        /// Whether the scanner is inside a string
+        bool m_inString {false};
+
+        /// Whether the previous character was an escape backslash
+        bool m_escaped {false};
+
+        /// Whether the next string is an object key
+        bool m_expectKey {false};
+
+        /// Whether the current string is a key candidate being captured
+        bool m_capturingKey {false};
+
+        /// Whether the next value belongs to a fully matched key path
+        bool m_awaitingMatchedValue {false};
+
+        /// Whether the scanner is inside the target array
+        bool m_inTarget {false};
+
+        /// Whether the target array was found
+        bool m_targetFound {false};
+
+        /// Whether an element is being captured
+        bool m_elementActive {false};
+    };
+
     /**
      * @brief Parses a JSON file and invokes a callback for each item of the target array.
      *
@@ -451,5 +854,129 @@ namespace JsonArray
         nlohmann::json::sax_parse(file, &arrayParser);
     }
 
+    /**
+     * @brief Parses a JSON file invoking a callback for each item of the target array, building the items on
+     * worker threads.
+     *
+     * @details The input is split at the element boundaries of the target array by a raw scanner, and the
+     * elements are parsed in batches on worker threads while the scanner keeps reading. Batches are delivered
+     * in order, so the callbacks observe the same items, ids and ordering as JsonArray::parse(). Use this
+     * variant for large arrays whose parse time is dominated by DOM construction (e.g. CTI snapshots).
+     *
+     * @param filepath Path to the JSON file.
+     * @param processItemCallback Callback invoked for every item found on the target array. If the callback
+     * returns false the parsing stops.
+     * @param arrayPointer JSON Pointer to the target array. Must traverse object keys only: pointers with
+     * array index tokens are not supported by the raw scanner.
+     * @param processBodyCallback Callback invoked at the end of the parsing with the body of the JSON object.
+     * The body of the JSON object is the original JSON with the array items removed. If the
+     * \p processItemCallback stops the parsing, the \p processBodyCallback will not be called.
+     * @param workerCount Number of worker threads. 0 uses all the available threads.
+     */
+    static void parseParallel(
+        const std::filesystem::path& filepath,
+        std::function<bool(nlohmann::json&&, const size_t)> processItemCallback,
+        const nlohmann::json::json_pointer& arrayPointer = nlohmann::json::json_pointer(),
+        std::function<void(nlohmann::json&&)> processBodyCallback = [](nlohmann::json&&) {},
+        size_t workerCount = 0)
+    {
+        constexpr size_t BATCH_SIZE {256};
+
+        if (workerCount == 0)
+        {
+            workerCount = std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() : 1;
+        }
+
+        // Open the input file
+        std::ifstream file(filepath);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open input file: " + filepath.string());
+        }
+
+        std::deque<std::future<std::vector<nlohmann::json>>> pendingBatches;
+        std::vector<std::string> batch;
+        batch.reserve(BATCH_SIZE);
+        size_t itemId {0};
+        bool continueParsing {true};
+
+        // Deliver a parsed batch to the item callback, in order.
+        const auto deliverBatch = [&](std::vector<nlohmann::json>&& items)
+        {
+            for (auto& item : items)
+            {
+                if (!continueParsing)
+                {
+                    break;
+                }
+                continueParsing = processItemCallback(std::move(item), ++itemId);
+            }
+        };
+
+        // Hand the current batch of raw elements to a worker thread.
+        const auto dispatchBatch = [&]()
+        {
+            if (batch.empty())
+            {
+                return;
+            }
+
+            pendingBatches.push_back(std::async(std::launch::async,
+                                                [rawItems = std::move(batch)]() mutable
+                                                {
+                                                    std::vector<nlohmann::json> items;
+                                                    items.reserve(rawItems.size());
+
+                                                    for (auto& rawItem : rawItems)
+                                                    {
+                                                        items.push_back(nlohmann::json::parse(rawItem));
+                                                    }
+
+                                                    return items;
+                                                }));
+            batch = {};
+            batch.reserve(BATCH_SIZE);
+        };
+
+        RawJsonArrayScanner scanner(arrayPointer,
+                                    [&](std::string&& element)
+                                    {
+                                        batch.push_back(std::move(element));
+
+                                        if (batch.size() >= BATCH_SIZE)
+                                        {
+                                            dispatchBatch();
+
+                                            // Bound the in-flight work: once enough batches are queued,
+                                            // deliver the oldest one before reading more input.
+                                            if (pendingBatches.size() >= workerCount)
+                                            {
+                                                auto items {pendingBatches.front().get()};
+                                                pendingBatches.pop_front();
+                                                deliverBatch(std::move(items));
+                                            }
+                                        }
+
+                                        return continueParsing;
+                                    });
+
+        auto body {scanner.scan(file)};
+
+        // Flush the last partial batch and drain the in-flight ones. Draining also propagates any parse
+        // error raised on a worker thread.
+        dispatchBatch();
+        while (!pendingBatches.empty())
+        {
+            auto items {pendingBatches.front().get()};
+            pendingBatches.pop_front();
+            deliverBatch(std::move(items));
+        }
+
+        if (continueParsing)
+        {
+            processBodyCallback(nlohmann::json::parse(body));
+        }
+    }
+
 } // namespace JsonArray
 #endif // _JSON_ARRAY_PARSER_HPP
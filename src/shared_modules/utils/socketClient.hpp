@@ -41,7 +41,7 @@ private:
     std::atomic<bool> m_shouldStop;
     std::condition_variable_any m_cv;
     std::mutex m_mutex;
-    int m_stopFD[2] = {-1, -1};
+    int m_wakeupFD {-1};
     std::shared_mutex m_socketMutex;
 
     void sendPendingMessages()
@@ -65,34 +65,21 @@ public:
         , m_socket {std::make_shared<TSocket>()}
         , m_shouldStop {false}
     {
-        int result = ::pipe(m_stopFD);
-        if (result == -1)
-        {
-            throw std::runtime_error("Failed to create stop pipe");
-        }
-
-        if (::fcntl(m_stopFD[0], F_SETFL, O_NONBLOCK) == -1)
-        {
-            throw std::runtime_error("Failed to set stop pipe to non-blocking");
-        }
-
-        // Add pipe to stop epoll
-        m_epoll->addDescriptor(m_stopFD[0], EPOLLIN | EPOLLET);
+        // Eventfd wakeup channel to stop the epoll loop
+        m_wakeupFD = m_epoll->addWakeupChannel();
     }
 
     ~SocketClient()
     {
         stop();
-        ::close(m_stopFD[0]);
-        ::close(m_stopFD[1]);
+        m_epoll->removeWakeupChannel(m_wakeupFD);
     }
 
     void stop()
     {
         m_shouldStop = true;
 
-        char dummy = 'x';
-        std::ignore = ::write(m_stopFD[1], &dummy, sizeof(dummy));
+        m_epoll->notifyWakeup(m_wakeupFD);
 
         m_cv.notify_all();
         if (m_mainLoopThread.joinable())
@@ -109,6 +96,7 @@ public:
     void connect(
         const std::function<void(const char*, uint32_t, const char*, uint32_t)>& onRead,
         const std::function<void()>& onConnect = []() {},
+        const std::function<void()>& onDisconnect = []() {},
         int type = (SOCK_STREAM | SOCK_NONBLOCK))
     {
         // If the thread is already running, then return, this case happens when the client is restarted/reconnected.
@@ -117,7 +105,7 @@ public:
             return;
         }
         m_mainLoopThread = std::thread(
-            [&, type, onRead, onConnect]()
+            [&, type, onRead, onConnect, onDisconnect]()
             {
                 handleConnect(type);
                 auto afterConnect = true;
@@ -133,11 +121,10 @@ public:
                         {
                             auto eventFD {events.at(i).data.fd};
                             // If the event is on the server socket, then it's a new connection
-                            if (eventFD == m_stopFD[0])
+                            if (eventFD == m_wakeupFD)
                             {
-                                // Drain the byte from the stop_fd and break out of the loop
-                                char dummy;
-                                std::ignore = ::read(m_stopFD[0], &dummy, sizeof(dummy));
+                                // Consume the notification and break out of the loop
+                                m_epoll->drainWakeup(m_wakeupFD);
                                 break;
                             }
                             else
@@ -147,6 +134,7 @@ public:
                                 {
                                     if (event & EPOLLERR || event & EPOLLHUP)
                                     {
+                                        onDisconnect();
                                         handleConnect(type);
                                         afterConnect = true;
                                     }
@@ -193,24 +181,32 @@ public:
     {
         // Build the address.
         auto unixAddress {UnixAddress::builder().address(m_socketPath).build()};
-        constexpr auto MAX_DELAY = 30;
-        auto delay = 1;
+        constexpr auto MAX_DELAY_MS = 30000;
+        auto delay = 100;
 
-        std::unique_lock<std::shared_mutex> lock(m_socketMutex);
-        do
+        while (!m_shouldStop)
         {
             try
             {
+                // The socket lock is only held for the connect attempt itself, so senders
+                // keep queueing messages instead of stalling during the backoff.
+                std::lock_guard<std::shared_mutex> lock(m_socketMutex);
                 m_socket->connect(unixAddress.data(), type);
                 m_epoll->addDescriptor(m_socket->fileDescriptor(), EPOLLIN | EPOLLOUT);
-                break;
+                return;
             }
             catch (const std::exception& e)
             {
                 // Failure to connect to socket
-                delay = std::min(delay * 2, MAX_DELAY);
             }
-        } while (!m_cv.wait_for(lock, std::chrono::seconds(delay), [&]() { return m_shouldStop.load(); }));
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_cv.wait_for(lock, std::chrono::milliseconds(delay), [&]() { return m_shouldStop.load(); }))
+            {
+                return;
+            }
+            delay = std::min(delay * 2, MAX_DELAY_MS);
+        }
     }
 
     void send(const char* dataBody, size_t sizeBody, const char* dataHeader = nullptr, size_t sizeHeader = 0)
@@ -222,8 +218,19 @@ public:
         }
         catch (const std::exception& e)
         {
-            // Error sending message
-            m_epoll->modifyDescriptor(m_socket->fileDescriptor(), EPOLLIN | EPOLLOUT);
+            // Error sending message, the packet stays queued. While disconnected there is no
+            // descriptor to re-arm, the queue is flushed on the EPOLLOUT after the reconnect.
+            if (m_socket->fileDescriptor() != INVALID_SOCKET)
+            {
+                try
+                {
+                    m_epoll->modifyDescriptor(m_socket->fileDescriptor(), EPOLLIN | EPOLLOUT);
+                }
+                catch (const std::exception& ex)
+                {
+                    // The descriptor is being replaced by a reconnection in progress.
+                }
+            }
         }
     }
 };
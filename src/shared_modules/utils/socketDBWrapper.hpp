@@ -12,11 +12,14 @@
 #ifndef _SOCKET_DB_WRAPPER_HPP
 #define _SOCKET_DB_WRAPPER_HPP
 
+#include "cacheLRU.hpp"
 #include "json.hpp"
 #include "singleton.hpp"
 #include "socketClient.hpp"
 #include "socketDBWrapperException.hpp"
-#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -44,16 +47,123 @@ enum class DbQueryStatus : uint8_t
 class SocketDBWrapper final : public Singleton<SocketDBWrapper>
 {
 private:
+    /**
+     * @brief One in-flight query. wazuh-db answers in request order, so no
+     * correlation id travels on the wire: the front of the pending queue owns the
+     * next response, 'due' packets accumulate into it and the final packet
+     * resolves its future.
+     */
+    struct PendingQuery
+    {
+        std::promise<nlohmann::json> promise;
+        nlohmann::json partial;
+        DbQueryStatus status {DbQueryStatus::UNKNOWN};
+        std::string exceptionStr;
+    };
+
+    static auto constexpr CACHE_CAPACITY {512};
+
     std::unique_ptr<SocketClient<Socket<OSPrimitives, SizeHeaderProtocol>, EpollWrapper>> m_dbSocket;
-    nlohmann::json m_response;
-    nlohmann::json m_responsePartial;
-    std::string m_exceptionStr;
-    DbQueryStatus m_queryStatus {DbQueryStatus::UNKNOWN};
-    std::mutex m_mutexMessage;
-    std::mutex m_mutexResponse;
-    std::condition_variable m_conditionVariable;
+    std::mutex m_mutexQueue; ///< Guards the pending queue; held across send so queue order matches wire order
+    std::deque<std::shared_ptr<PendingQuery>> m_pendingQueries;
     bool m_teardown {false};
-    bool m_dataReady {false};
+
+    std::mutex m_mutexCache;
+    LRUCache<std::string, nlohmann::json> m_cache {CACHE_CAPACITY};
+
+    void resolve(const std::shared_ptr<PendingQuery>& pending, const std::string& responsePacket)
+    {
+        nlohmann::json response;
+
+        if (responsePacket.empty())
+        {
+            pending->status = DbQueryStatus::EMPTY_RESPONSE;
+            pending->exceptionStr = "Empty DB response";
+        }
+        else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_ERROR) - 1, DB_WRAPPER_ERROR))
+        {
+            pending->status = DbQueryStatus::QUERY_ERROR;
+            pending->exceptionStr = "DB query error: " + responsePacket.substr(sizeof(DB_WRAPPER_ERROR));
+        }
+        else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_IGNORE) - 1, DB_WRAPPER_IGNORE))
+        {
+            pending->status = DbQueryStatus::QUERY_IGNORE;
+            pending->exceptionStr = "DB query ignored: " + responsePacket.substr(sizeof(DB_WRAPPER_IGNORE));
+        }
+        else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_UNKNOWN) - 1, DB_WRAPPER_UNKNOWN))
+        {
+            pending->status = DbQueryStatus::QUERY_UNKNOWN;
+            pending->exceptionStr = "DB query unknown response: " + responsePacket.substr(sizeof(DB_WRAPPER_UNKNOWN));
+        }
+        else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_OK) - 1, DB_WRAPPER_OK))
+        {
+            if (!pending->partial.empty())
+            {
+                response = pending->partial;
+            }
+            else
+            {
+                try
+                {
+                    nlohmann::json responseParsed =
+                        nlohmann::json::parse(responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1));
+                    if (responseParsed.type() == nlohmann::json::value_t::array)
+                    {
+                        response = std::move(responseParsed);
+                    }
+                    else
+                    {
+                        if (responseParsed.contains("status") && responseParsed.at("status") == "NOT_SYNCED")
+                        {
+                            pending->status = DbQueryStatus::QUERY_NOT_SYNCED;
+                            pending->exceptionStr = "DB query not synced";
+                        }
+                        else
+                        {
+                            response.push_back(responseParsed);
+                        }
+                    }
+                }
+                catch (const nlohmann::detail::exception& ex)
+                {
+                    pending->status = DbQueryStatus::JSON_PARSING;
+                    pending->exceptionStr =
+                        "Error parsing JSON response: " + responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1) +
+                        ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
+                }
+            }
+        }
+        else
+        {
+            pending->status = DbQueryStatus::INVALID_RESPONSE;
+            pending->exceptionStr = "DB query invalid response: " + responsePacket;
+        }
+
+        if (!pending->exceptionStr.empty())
+        {
+            switch (pending->status)
+            {
+                case DbQueryStatus::QUERY_NOT_SYNCED:
+                    pending->promise.set_exception(
+                        std::make_exception_ptr(SocketDbWrapperException(pending->exceptionStr)));
+                    break;
+                case DbQueryStatus::EMPTY_RESPONSE:
+                case DbQueryStatus::UNKNOWN:
+                case DbQueryStatus::QUERY_ERROR:
+                case DbQueryStatus::QUERY_UNKNOWN:
+                case DbQueryStatus::QUERY_IGNORE:
+                case DbQueryStatus::JSON_PARSING:
+                case DbQueryStatus::INVALID_RESPONSE:
+                default:
+                    pending->promise.set_exception(std::make_exception_ptr(std::runtime_error(pending->exceptionStr)));
+                    break;
+            }
+        }
+        else
+        {
+            pending->promise.set_value(std::move(response));
+        }
+    }
 
 public:
     void init(const std::string& socketPath = WDB_SOCKET)
@@ -63,140 +173,125 @@ public:
         m_dbSocket->connect(
             [&](const char* body, uint32_t bodySize, const char*, uint32_t)
             {
-                std::scoped_lock lock {m_mutexResponse};
                 std::string responsePacket(body, bodySize);
+                std::shared_ptr<PendingQuery> pending;
 
-                if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_DUE) - 1, DB_WRAPPER_DUE))
                 {
-                    try
-                    {
-                        m_responsePartial.push_back(nlohmann::json::parse(responsePacket.substr(4)));
-                    }
-                    catch (const nlohmann::detail::exception& ex)
-                    {
-                        m_queryStatus = DbQueryStatus::JSON_PARSING;
-                        m_exceptionStr = "Error parsing JSON response: " + responsePacket.substr(4) +
-                                         ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
-                    }
-                }
-                else
-                {
-                    if (responsePacket.empty())
-                    {
-                        m_queryStatus = DbQueryStatus::EMPTY_RESPONSE;
-                        m_exceptionStr = "Empty DB response";
-                    }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_ERROR) - 1, DB_WRAPPER_ERROR))
-                    {
-                        m_queryStatus = DbQueryStatus::QUERY_ERROR;
-                        m_exceptionStr = "DB query error: " + responsePacket.substr(sizeof(DB_WRAPPER_ERROR));
-                    }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_IGNORE) - 1, DB_WRAPPER_IGNORE))
-                    {
-                        m_queryStatus = DbQueryStatus::QUERY_IGNORE;
-                        m_exceptionStr = "DB query ignored: " + responsePacket.substr(sizeof(DB_WRAPPER_IGNORE));
-                    }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_UNKNOWN) - 1, DB_WRAPPER_UNKNOWN))
+                    std::scoped_lock lock {m_mutexQueue};
+
+                    if (m_pendingQueries.empty())
                     {
-                        m_queryStatus = DbQueryStatus::QUERY_UNKNOWN;
-                        m_exceptionStr =
-                            "DB query unknown response: " + responsePacket.substr(sizeof(DB_WRAPPER_UNKNOWN));
+                        // Response without a pending query (e.g. after teardown)
+                        return;
                     }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_OK) - 1, DB_WRAPPER_OK))
+
+                    pending = m_pendingQueries.front();
+
+                    if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_DUE) - 1, DB_WRAPPER_DUE))
                     {
-                        if (!m_responsePartial.empty())
+                        // Partial packet: accumulate into the front query, more follow
+                        try
                         {
-                            m_response = m_responsePartial;
+                            pending->partial.push_back(nlohmann::json::parse(responsePacket.substr(4)));
                         }
-                        else
+                        catch (const nlohmann::detail::exception& ex)
                         {
-                            try
-                            {
-                                nlohmann::json responseParsed =
-                                    nlohmann::json::parse(responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1));
-                                if (responseParsed.type() == nlohmann::json::value_t::array)
-                                {
-                                    m_response = std::move(responseParsed);
-                                }
-                                else
-                                {
-                                    if (responseParsed.contains("status") &&
-                                        responseParsed.at("status") == "NOT_SYNCED")
-                                    {
-                                        m_queryStatus = DbQueryStatus::QUERY_NOT_SYNCED;
-                                        m_exceptionStr = "DB query not synced";
-                                    }
-                                    else
-                                    {
-                                        m_response.push_back(responseParsed);
-                                    }
-                                }
-                            }
-                            catch (const nlohmann::detail::exception& ex)
-                            {
-                                m_queryStatus = DbQueryStatus::JSON_PARSING;
-                                m_exceptionStr =
-                                    "Error parsing JSON response: " + responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1) +
-                                    ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
-                            }
+                            pending->status = DbQueryStatus::JSON_PARSING;
+                            pending->exceptionStr = "Error parsing JSON response: " + responsePacket.substr(4) +
+                                                    ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
                         }
+                        return;
                     }
-                    else
-                    {
-                        m_queryStatus = DbQueryStatus::INVALID_RESPONSE;
-                        m_exceptionStr = "DB query invalid response: " + responsePacket;
-                    }
-                    m_dataReady = true;
-                    m_conditionVariable.notify_one();
+
+                    m_pendingQueries.pop_front();
                 }
+
+                // Resolve outside the lock so slow waiters never stall the socket thread
+                resolve(pending, responsePacket);
             });
     }
 
-    void query(const std::string& query, nlohmann::json& response)
+    /**
+     * @brief Send a query without waiting for its response.
+     *
+     * Multiple queries can be outstanding at once; wazuh-db answers in order, so
+     * responses are matched to queries by the pending queue. The returned future
+     * yields the response, or throws the same exceptions query() would.
+     */
+    std::future<nlohmann::json> queryAsync(const std::string& query)
     {
-        // Acquire lock to avoid multiple threads sending queries at the same time
-        std::scoped_lock lockMessage {m_mutexMessage};
+        std::scoped_lock lock {m_mutexQueue};
+
+        auto pending {std::make_shared<PendingQuery>()};
+        auto future {pending->promise.get_future()};
 
         if (m_teardown)
         {
-            return;
+            // Preserve the blocking-path behavior on teardown: an empty response
+            pending->promise.set_value({});
+            return future;
         }
 
-        // Acquire lock before clearing the response
-        std::unique_lock lockResponse {m_mutexResponse};
-
-        m_dataReady = false;
-        m_response.clear();
-        m_responsePartial.clear();
-        // coverity[missing_lock]
-        m_exceptionStr.clear();
-
         if (!m_dbSocket)
         {
             throw std::runtime_error("Socket DB Wrapper not initialized");
         }
 
-        m_dbSocket->send(query.c_str(), query.size());
-        m_conditionVariable.wait(lockResponse, [this] { return m_dataReady || m_teardown; });
+        m_pendingQueries.push_back(pending);
+
+        try
+        {
+            m_dbSocket->send(query.c_str(), query.size());
+        }
+        catch (...)
+        {
+            m_pendingQueries.pop_back();
+            throw;
+        }
+
+        return future;
+    }
+
+    void query(const std::string& query, nlohmann::json& response)
+    {
+        response = queryAsync(query).get();
+    }
 
-        if (!m_exceptionStr.empty())
+    /**
+     * @brief Same as query(), memoizing successful responses keyed by query text.
+     *
+     * Meant for metadata queries repeated within a scan batch (e.g. the same agent
+     * looked up once per vulnerability): the first call hits wazuh-db, the rest are
+     * served locally. The cache holds the CACHE_CAPACITY most recent entries and is
+     * never invalidated by wazuh-db writes, so callers must clearCache() at batch
+     * boundaries, or whenever staleness matters.
+     */
+    void queryCached(const std::string& query, nlohmann::json& response)
+    {
         {
-            // coverity[missing_lock]
-            switch (m_queryStatus)
+            std::scoped_lock lock {m_mutexCache};
+            const auto cached {m_cache.getValue(query)};
+
+            if (cached.has_value())
             {
-                case DbQueryStatus::QUERY_NOT_SYNCED: throw SocketDbWrapperException(m_exceptionStr); break;
-                case DbQueryStatus::EMPTY_RESPONSE:
-                case DbQueryStatus::UNKNOWN:
-                case DbQueryStatus::QUERY_ERROR:
-                case DbQueryStatus::QUERY_UNKNOWN:
-                case DbQueryStatus::QUERY_IGNORE:
-                case DbQueryStatus::JSON_PARSING:
-                case DbQueryStatus::INVALID_RESPONSE:
-                default: throw std::runtime_error(m_exceptionStr); break;
+                response = cached.value();
+                return;
             }
         }
 
-        response = m_response;
+        this->query(query, response);
+
+        std::scoped_lock lock {m_mutexCache};
+        m_cache.insertKey(query, response);
+    }
+
+    /**
+     * @brief Drop every memoized response, e.g. when a scan batch finishes.
+     */
+    void clearCache()
+    {
+        std::scoped_lock lock {m_mutexCache};
+        m_cache.clear();
     }
 
     /**
@@ -205,8 +300,19 @@ public:
      */
     void teardown()
     {
-        m_teardown = true;
-        m_conditionVariable.notify_all();
+        {
+            std::scoped_lock lock {m_mutexQueue};
+            m_teardown = true;
+
+            // Wake every waiter with the empty response the blocking path returned
+            // on teardown before pipelining.
+            for (const auto& pending : m_pendingQueries)
+            {
+                pending->promise.set_value({});
+            }
+            m_pendingQueries.clear();
+        }
+
         m_dbSocket->stop();
     }
 };
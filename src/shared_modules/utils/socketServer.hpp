@@ -33,7 +33,7 @@ class SocketServer final
 private:
     const std::string m_socketPath;
     std::atomic<bool> m_shouldStop;
-    int m_stopFD[2] = {-1, -1};
+    int m_wakeupFD {-1};
     std::unique_ptr<TEpoll> m_epoll;
     std::unique_ptr<TSocket> m_listenSocket;
     std::unordered_map<int, std::shared_ptr<TSocket>> m_clients {};
@@ -63,7 +63,7 @@ private:
         try
         {
             client->sendUnsentMessages();
-            m_epoll->modifyDescriptor(client->fileDescriptor(), EPOLLIN);
+            m_epoll->modifyDescriptor(client->fileDescriptor(), EPOLLIN | EPOLLET);
         }
         catch (const std::exception& e)
         {
@@ -79,26 +79,14 @@ public:
         , m_listenSocket {std::make_unique<TSocket>()}
         , m_clients {}
     {
-        int result = pipe(m_stopFD);
-        if (result == -1)
-        {
-            throw std::runtime_error("Failed to create stop pipe");
-        }
-
-        if (::fcntl(m_stopFD[0], F_SETFL, O_NONBLOCK) == -1)
-        {
-            throw std::runtime_error("Failed to set stop pipe to non-blocking");
-        }
-
-        // Add pipe to stop epoll
-        m_epoll->addDescriptor(m_stopFD[0], EPOLLIN | EPOLLET);
+        // Eventfd wakeup channel to stop the epoll loop
+        m_wakeupFD = m_epoll->addWakeupChannel();
     }
 
     ~SocketServer()
     {
         stop();
-        ::close(m_stopFD[0]);
-        ::close(m_stopFD[1]);
+        m_epoll->removeWakeupChannel(m_wakeupFD);
 
         std::filesystem::remove_all(m_socketPath);
     }
@@ -107,8 +95,7 @@ public:
     {
         m_shouldStop = true;
 
-        char dummy = 'x';
-        std::ignore = ::write(m_stopFD[1], &dummy, sizeof(dummy));
+        m_epoll->notifyWakeup(m_wakeupFD);
 
         if (m_listenThread.joinable())
         {
@@ -131,8 +118,8 @@ public:
         // Instance server socket
         m_listenSocket->listen(unixAddressBuilder.address(m_socketPath).data());
 
-        // Add server socket to epoll
-        m_epoll->addDescriptor(m_listenSocket->fileDescriptor(), EPOLLIN);
+        // Add server socket to epoll, edge-triggered so a connection burst is one event
+        m_epoll->addDescriptor(m_listenSocket->fileDescriptor(), EPOLLIN | EPOLLET);
 
         m_listenThread = std::thread(
             [&, onRead]()
@@ -150,22 +137,31 @@ public:
                         // If the event is on the server socket, then it's a new connection
                         if (eventFD == m_listenSocket->fileDescriptor())
                         {
-                            try
-                            {
-                                const auto clientFD = m_listenSocket->accept();
-                                addClient(clientFD, std::make_shared<TSocket>(clientFD));
-                                m_epoll->addDescriptor(clientFD, EPOLLIN);
-                            }
-                            catch (const std::exception& e)
+                            // Accept every queued connection before waiting again, the
+                            // edge-triggered listen socket reports a burst as a single event.
+                            while (true)
                             {
-                                std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
+                                try
+                                {
+                                    const auto clientFD = m_listenSocket->accept();
+                                    addClient(clientFD, std::make_shared<TSocket>(clientFD));
+                                    m_epoll->addDescriptor(clientFD, EPOLLIN | EPOLLET);
+                                }
+                                catch (const std::exception& e)
+                                {
+                                    if (errno != EAGAIN && errno != EWOULDBLOCK)
+                                    {
+                                        std::cerr << "Failed to initialize client socket: " << e.what()
+                                                  << std::endl;
+                                    }
+                                    break;
+                                }
                             }
                         }
-                        else if (eventFD == m_stopFD[0])
+                        else if (eventFD == m_wakeupFD)
                         {
-                            // Drain the byte from the stop_fd and break out of the loop
-                            char dummy;
-                            std::ignore = ::read(m_stopFD[0], &dummy, sizeof(dummy));
+                            // Consume the notification and break out of the loop
+                            m_epoll->drainWakeup(m_wakeupFD);
                             break;
                         }
                         else
@@ -197,13 +193,11 @@ public:
                         }
                     }
 
-                    // If we ran out of room in our events vector, double its size
-                    if (numFDsReady == static_cast<int>(events.size()))
+                    // If the batch came back full, double the vector so the next wait can
+                    // return more events per syscall, up to the configured limit.
+                    if (numFDsReady == static_cast<int>(events.size()) && events.size() < EVENTS_LIMIT)
                     {
-                        if (numFDsReady >= EVENTS_LIMIT)
-                        {
-                            events.resize(events.size() * 2);
-                        }
+                        events.resize(events.size() * 2);
                     }
                 }
             });
@@ -218,7 +212,7 @@ public:
         }
         catch (const std::exception& e)
         {
-            m_epoll->modifyDescriptor(fd, EPOLLIN | EPOLLOUT);
+            m_epoll->modifyDescriptor(fd, EPOLLIN | EPOLLOUT | EPOLLET);
         }
     }
 };
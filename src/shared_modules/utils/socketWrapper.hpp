@@ -15,16 +15,18 @@
 #include "osPrimitives.hpp"
 #include "packet.hpp"
 #include <arpa/inet.h>
+#include <array>
 #include <chrono>
 #include <cstring>
+#include <deque>
 #include <filesystem>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <thread>
 #include <unistd.h>
 
@@ -36,6 +38,12 @@ constexpr auto PACKET_FIELD_SIZE {sizeof(PacketFieldType)};
 constexpr auto HEADER_FIELD_SIZE {sizeof(HeaderFieldType)};
 constexpr auto BUFFER_MAX_SIZE {8192 * 8};
 
+// Upper bound, in bytes, for the outgoing queue of unsent packets.
+constexpr auto UNSENT_QUEUE_MAX_BYTES {64 * 1024 * 1024};
+
+// Maximum number of queued packets gathered into a single vectored send.
+constexpr auto SEND_BATCH_IOVECS {16};
+
 enum class SocketType
 {
     UNIX,
@@ -178,6 +186,17 @@ public:
         return *reinterpret_cast<const uint32_t*>(buffer.data());
     }
 
+    /**
+     * @brief Get the size of the header from a framed packet body.
+     *
+     * @param body Pointer to the packet body (the bytes after the packet size field).
+     * @return auto Header size.
+     */
+    auto static getHeaderSize(const char* body)
+    {
+        return *reinterpret_cast<const uint32_t*>(body);
+    }
+
     /**
      * @brief Get the data offset according to this protocol.
      *
@@ -260,6 +279,17 @@ public:
         return 0;
     }
 
+    /**
+     * @brief Get the size of the header from a framed packet body.
+     *
+     * @param body Pointer to the packet body (the bytes after the packet size field).
+     * @return auto Header size.
+     */
+    auto static getHeaderSize(const char* body)
+    {
+        return 0;
+    }
+
     /**
      * @brief Get the data offset according to this protocol.
      *
@@ -336,6 +366,17 @@ public:
         return 0;
     }
 
+    /**
+     * @brief Get the size of the header from a framed packet body.
+     *
+     * @param body Pointer to the packet body (the bytes after the packet size field).
+     * @return auto Header size.
+     */
+    auto static getHeaderSize(const char* body)
+    {
+        return 0;
+    }
+
     /**
      * @brief Get the data offset according to this protocol.
      *
@@ -380,22 +421,98 @@ class Socket final : public T
 {
 private:
     int m_sock;
-    SocketStatus m_status;
-    uint32_t m_readPosition;
-    uint32_t m_readSize;
-    uint32_t m_totalReadSize;
+    uint32_t m_bufferedSize;
     std::vector<char> m_recvDataBuffer {};
     std::vector<char> m_sendDataBuffer {};
-    std::queue<Packet> m_unsentPacketList {};
+    std::deque<Packet> m_unsentPacketList {};
+    size_t m_unsentBytes {0};
     std::mutex m_mutex;
 
+    /**
+     * @brief Queues a packet for a later flush, enforcing the outgoing queue bound.
+     *
+     * @note Must be called with the socket mutex held.
+     *
+     * @param data Packet bytes to queue.
+     * @param size Packet size.
+     */
+    void enqueueBounded(char* data, uint32_t size)
+    {
+        if (m_unsentBytes + size > UNSENT_QUEUE_MAX_BYTES)
+        {
+            throw std::runtime_error {"Outgoing queue is full, message dropped"};
+        }
+        m_unsentPacketList.emplace_back(data, size);
+        m_unsentBytes += size;
+    }
+
+    /**
+     * @brief Dispatches every complete packet framed in the receive buffer.
+     *
+     * Packets are parsed and delivered in place, directly from the reusable buffer;
+     * the leftover partial packet, if any, is compacted to the buffer front so the
+     * next recv appends to it. The buffer grows when an announced packet cannot fit
+     * and shrinks back once an oversized packet has been consumed.
+     *
+     * @param callback Callback to invoke per complete packet.
+     */
+    void dispatchBufferedPackets(const std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>& callback)
+    {
+        uint32_t parsed {0};
+
+        while (m_bufferedSize - parsed >= PACKET_FIELD_SIZE)
+        {
+            PacketFieldType packetSize;
+            std::memcpy(&packetSize, m_recvDataBuffer.data() + parsed, PACKET_FIELD_SIZE);
+
+            if (m_bufferedSize - parsed - PACKET_FIELD_SIZE < packetSize)
+            {
+                // Incomplete packet, wait for more data.
+                break;
+            }
+
+            const char* body = m_recvDataBuffer.data() + parsed + PACKET_FIELD_SIZE;
+            const auto headerDataSize = TCommunicationProtocol::getHeaderSize(body);
+            const auto dataOffset = TCommunicationProtocol::getDataOffset(headerDataSize);
+            const auto headerOffset = TCommunicationProtocol::getHeaderOffset();
+
+            callback(m_sock, body + dataOffset, packetSize - dataOffset, body + headerOffset, headerDataSize);
+
+            parsed += PACKET_FIELD_SIZE + packetSize;
+        }
+
+        if (parsed > 0)
+        {
+            // Compact the leftover partial packet to the buffer front.
+            if (parsed != m_bufferedSize)
+            {
+                std::memmove(m_recvDataBuffer.data(), m_recvDataBuffer.data() + parsed, m_bufferedSize - parsed);
+            }
+            m_bufferedSize -= parsed;
+        }
+
+        if (m_bufferedSize >= PACKET_FIELD_SIZE)
+        {
+            // Make room for a pending packet larger than the current buffer.
+            PacketFieldType packetSize;
+            std::memcpy(&packetSize, m_recvDataBuffer.data(), PACKET_FIELD_SIZE);
+
+            if (PACKET_FIELD_SIZE + static_cast<size_t>(packetSize) > m_recvDataBuffer.size())
+            {
+                m_recvDataBuffer.resize(PACKET_FIELD_SIZE + packetSize + 1);
+            }
+        }
+        else if (m_bufferedSize == 0 && m_recvDataBuffer.size() > BUFFER_MAX_SIZE)
+        {
+            // Shrink back after an oversized packet has been consumed.
+            m_recvDataBuffer.resize(BUFFER_MAX_SIZE);
+        }
+    }
+
 public:
     explicit Socket(const int sock = INVALID_SOCKET)
         : m_sock {sock}
-        , m_status {SocketStatus::HEADER}
-        , m_readPosition {0}
-        , m_readSize {PACKET_FIELD_SIZE}
-        , m_totalReadSize {0}
+        , m_bufferedSize {0}
         , m_recvDataBuffer {}
         , m_sendDataBuffer {}
         , m_unsentPacketList {}
@@ -470,121 +587,52 @@ public:
 
     void read(const std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>& callback)
     {
-        uint32_t* uip;
-        ssize_t ret;
-        bool dataToRead = true;
+        if (m_sock == INVALID_SOCKET)
+        {
+            throw std::runtime_error {"Invalid socket"};
+        }
 
-        if (m_sock != INVALID_SOCKET)
+        // Drain the socket into the reusable buffer with bulk reads, then frame and
+        // dispatch every complete packet in place. Compared to the previous
+        // header-then-body loop, this batches multiple packets per recv and removes
+        // the two-syscall floor per message.
+        bool dataToRead = true;
+        while (dataToRead)
         {
-            while (dataToRead)
+            // Grow the buffer when it is full so the next recv can make progress.
+            if (m_bufferedSize == m_recvDataBuffer.size())
             {
-                // First read the header.
-                if (SocketStatus::HEADER == m_status)
-                {
-                    ret = T::recv(m_sock, (char*)(m_recvDataBuffer.data() + m_readPosition), m_readSize, 0);
+                m_recvDataBuffer.resize(m_recvDataBuffer.size() * 2);
+            }
 
-                    if (ret == SOCKET_ERROR)
-                    {
-                        if (errno == EAGAIN || errno == EWOULDBLOCK)
-                        {
-                            // No more data to read.
-                            dataToRead = false;
-                        }
-                        else
-                        {
-                            // Error reading from socket.
-                            throw std::runtime_error {"Error reading from socket."};
-                        }
-                    }
-                    else if (ret == 0)
-                    {
-                        // Remote shutdown / disconnect.
-                        throw std::runtime_error {"Remote shutdown / disconnect."};
-                    }
-                    else
-                    {
-                        // Check if we have read the entire header.
-                        if (ret != m_readSize)
-                        {
-                            // In this case we need to read more data, when the next read is called.
-                            m_readPosition += ret;
-                            m_readSize -= ret;
-                        }
-                        else
-                        {
-                            uip = (uint32_t*)m_recvDataBuffer.data();
-                            m_totalReadSize = *uip;
-
-                            if (m_totalReadSize > BUFFER_MAX_SIZE)
-                            {
-                                m_recvDataBuffer.resize(m_totalReadSize + 1);
-                            }
-
-                            // We have read the entire header, now we need to read the body.
-                            m_readPosition = 0;
-                            m_readSize = m_totalReadSize;
-                            m_status = SocketStatus::BODY;
-                        }
-                    }
-                }
+            const auto ret = T::recv(m_sock,
+                                     (char*)(m_recvDataBuffer.data() + m_bufferedSize),
+                                     m_recvDataBuffer.size() - m_bufferedSize,
+                                     0);
 
-                if (SocketStatus::BODY == m_status)
+            if (ret == SOCKET_ERROR)
+            {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
                 {
-                    ret = T::recv(m_sock, (char*)(m_recvDataBuffer.data() + m_readPosition), m_readSize, 0);
-
-                    if (ret == SOCKET_ERROR)
-                    {
-                        if (errno == EAGAIN || errno == EWOULDBLOCK)
-                        {
-                            // No more data to read.
-                            dataToRead = false;
-                        }
-                        else
-                        {
-                            // Error reading from socket.
-                            throw std::runtime_error {"Error reading from socket."};
-                        }
-                    }
-                    else if (ret == 0)
-                    {
-                        // Remote shutdown / disconnect.
-                        throw std::runtime_error {"Remote shutdown / disconnect."};
-                    }
-                    else
-                    {
-                        if (m_readSize != ret)
-                        {
-                            m_readSize -= ret;
-                            m_readPosition += ret;
-                        }
-                        else
-                        {
-                            m_readPosition = 0;
-                            m_readSize = PACKET_FIELD_SIZE;
-                            m_status = SocketStatus::HEADER;
-
-                            auto headerDataSize = TCommunicationProtocol::getHeaderSize(m_recvDataBuffer);
-                            auto dataOffset = TCommunicationProtocol::getDataOffset(headerDataSize);
-                            auto headerOffset = TCommunicationProtocol::getHeaderOffset();
-
-                            callback(m_sock,
-                                     m_recvDataBuffer.data() + dataOffset,
-                                     m_totalReadSize - dataOffset,
-                                     m_recvDataBuffer.data() + headerOffset,
-                                     headerDataSize);
-
-                            if (m_totalReadSize > BUFFER_MAX_SIZE)
-                            {
-                                m_recvDataBuffer.resize(BUFFER_MAX_SIZE);
-                            }
-                        }
-                    }
+                    // No more data to read.
+                    dataToRead = false;
+                }
+                else
+                {
+                    // Error reading from socket.
+                    throw std::runtime_error {"Error reading from socket."};
                 }
             }
-        }
-        else
-        {
-            throw std::runtime_error {"Invalid socket"};
+            else if (ret == 0)
+            {
+                // Remote shutdown / disconnect.
+                throw std::runtime_error {"Remote shutdown / disconnect."};
+            }
+            else
+            {
+                m_bufferedSize += ret;
+                dispatchBufferedPackets(callback);
+            }
         }
     }
 
@@ -632,8 +680,26 @@ public:
         std::lock_guard<std::mutex> lock {m_mutex};
         while (!m_unsentPacketList.empty())
         {
-            auto& packet = m_unsentPacketList.front();
-            auto ret = T::send(m_sock, packet.data.get() + packet.offset, packet.size - packet.offset, MSG_NOSIGNAL);
+            // Gather a batch of queued packets into a single vectored send, so draining
+            // the queue costs one syscall per batch instead of one per message.
+            std::array<iovec, SEND_BATCH_IOVECS> iov {};
+            size_t iovCount {0};
+            for (const auto& packet : m_unsentPacketList)
+            {
+                if (iovCount == iov.size())
+                {
+                    break;
+                }
+                iov[iovCount].iov_base = packet.data.get() + packet.offset;
+                iov[iovCount].iov_len = packet.size - packet.offset;
+                ++iovCount;
+            }
+
+            msghdr msg {};
+            msg.msg_iov = iov.data();
+            msg.msg_iovlen = iovCount;
+
+            const auto ret = T::sendmsg(m_sock, &msg, MSG_NOSIGNAL);
             if (ret <= 0)
             {
                 if (errno == EAGAIN || errno == EWOULDBLOCK)
@@ -647,15 +713,23 @@ public:
             }
             else
             {
-                if (ret != packet.size)
-                {
-                    // In this case we need to send the rest of the data, when the next send is called.
-                    packet.offset += ret;
-                }
-                else
+                // Retire fully sent packets and keep the offset of a partially sent one.
+                auto remaining = static_cast<size_t>(ret);
+                while (remaining > 0)
                 {
-                    // We have sent the entire packet, remove it from the queue.
-                    m_unsentPacketList.pop();
+                    auto& packet = m_unsentPacketList.front();
+                    const auto pending = static_cast<size_t>(packet.size - packet.offset);
+                    if (remaining >= pending)
+                    {
+                        remaining -= pending;
+                        m_unsentBytes -= packet.size;
+                        m_unsentPacketList.pop_front();
+                    }
+                    else
+                    {
+                        packet.offset += remaining;
+                        remaining = 0;
+                    }
                 }
             }
         }
@@ -669,10 +743,10 @@ public:
 
         TCommunicationProtocol::buildBuffer(m_sendDataBuffer, bufferSize, dataBody, sizeBody, dataHeader, sizeHeader);
 
-        // If there is data in the unsent queue, add it to the queue.
+        // If there is data in the unsent queue, add it to the queue to preserve ordering.
         if (!m_unsentPacketList.empty())
         {
-            m_unsentPacketList.emplace(m_sendDataBuffer.data(), bufferSize);
+            enqueueBounded(m_sendDataBuffer.data(), bufferSize);
         }
         else
         {
@@ -684,7 +758,18 @@ public:
 
                 if (ret <= 0)
                 {
-                    m_unsentPacketList.emplace(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
+                    if (amountSent == 0)
+                    {
+                        enqueueBounded(m_sendDataBuffer.data(), bufferSize);
+                    }
+                    else
+                    {
+                        // The remainder of a partially sent packet is queued regardless of the
+                        // bound, dropping it would corrupt the stream framing.
+                        m_unsentPacketList.emplace_back(m_sendDataBuffer.data() + amountSent,
+                                                        bufferSize - amountSent);
+                        m_unsentBytes += bufferSize - amountSent;
+                    }
                     throw std::runtime_error {"Error sending data to socket: " + std::string(std::strerror(errno))};
                 }
                 else
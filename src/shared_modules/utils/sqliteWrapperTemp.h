@@ -16,6 +16,7 @@
 #include <string>
 #include <memory>
 #include "makeUnique.h"
+#include "cacheLRU.hpp"
 #include "customDeleter.hpp"
 #include <iostream>
 #include <chrono>
@@ -262,6 +263,15 @@ namespace SQLite
                 }
 
 #endif
+
+                // WAL keeps readers unblocked while inventory sync writes, and turns
+                // the fsync per transaction into one per checkpoint. Meaningless for
+                // in-memory databases, which have no journal.
+                if (path.compare(DB_MEMORY) != 0)
+                {
+                    execute("PRAGMA journal_mode = WAL;");
+                    execute("PRAGMA synchronous = NORMAL;");
+                }
             }
 
             void close()
@@ -519,6 +529,61 @@ namespace SQLite
             const int m_bindParametersCount;
             int m_bindParametersIndex;
     };
+
+    /**
+     * @brief Keeps prepared statements alive keyed by their SQL text, so paths that
+     * run thousands of near-identical statements pay sqlite3_prepare once per query
+     * text instead of once per execution.
+     *
+     * When the cache is full the least recently used statement is evicted and
+     * finalized once its last holder releases it. Cached statements are reset and
+     * ready to bind when returned.
+     */
+    class StatementCache
+    {
+        public:
+            static constexpr size_t DEFAULT_CAPACITY {64};
+
+            explicit StatementCache(std::shared_ptr<IConnection> connection,
+                                    const size_t capacity = DEFAULT_CAPACITY)
+                : m_connection{ std::move(connection) }
+                , m_cache{ capacity }
+            {}
+
+            std::shared_ptr<IStatement> get(const std::string& query)
+            {
+                const auto cached { m_cache.getValue(query) };
+
+                if (cached.has_value())
+                {
+                    (*cached)->reset();
+                    return *cached;
+                }
+
+                auto stmt { std::make_shared<Statement>(m_connection, query) };
+                m_cache.insertKey(query, stmt);
+                return stmt;
+            }
+
+        private:
+            std::shared_ptr<IConnection> m_connection;
+            LRUCache<std::string, std::shared_ptr<IStatement>> m_cache;
+    };
+
+    /**
+     * @brief Runs a batch of operations inside a single transaction: one journal
+     * write for the whole batch instead of one implicit transaction per statement.
+     *
+     * Commits when the callable returns; if it throws, the transaction rolls back
+     * and the exception propagates.
+     */
+    template<typename Callable>
+    static void batchTransaction(std::shared_ptr<IConnection> connection, Callable&& callable)
+    {
+        Transaction transaction { connection };
+        callable();
+        transaction.commit();
+    }
 }
 
 #endif // _SQLITE_WRAPPER_TEMP_H
@@ -13,6 +13,8 @@
 #include "archiveHelper.hpp"
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <vector>
 
 const auto BASE_PATH {std::filesystem::current_path() / "input_files/archiveHelper/"};
 const auto OUTPUT_DIR_PATH {std::filesystem::current_path() / "output_dir"};
@@ -249,3 +251,103 @@ TEST(ArchiveHelperTest, SuccessfulDecompressionExtractOnly)
     EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
     EXPECT_TRUE(std::filesystem::remove_all(OUTPUT_DIR_PATH));
 }
+
+TEST(ArchiveHelperTest, ParallelDecompressionDirectory)
+{
+    const bool stop = false;
+    Utils::ArchiveHelper::decompressParallel(COMPRESSED_DIR_PATH, stop);
+
+    std::ifstream inputFile(DECOMPRESSED_DIR_FILE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string decompressedFile1;
+    getline(inputFile, decompressedFile1);
+    inputFile.close();
+    ASSERT_FALSE(inputFile.is_open());
+
+    inputFile.open(DECOMPRESSED_DIR_FILE2_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string decompressedFile2;
+    getline(inputFile, decompressedFile2);
+    inputFile.close();
+    ASSERT_FALSE(inputFile.is_open());
+
+    inputFile.open(BASE_EXAMPLE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string originalFile1;
+    getline(inputFile, originalFile1);
+    inputFile.close();
+    ASSERT_FALSE(inputFile.is_open());
+
+    inputFile.open(BASE_EXAMPLE2_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string originalFile2;
+    getline(inputFile, originalFile2);
+    inputFile.close();
+    ASSERT_FALSE(inputFile.is_open());
+
+    EXPECT_STREQ(decompressedFile1.c_str(), originalFile1.c_str());
+    EXPECT_STREQ(decompressedFile2.c_str(), originalFile2.c_str());
+    EXPECT_TRUE(std::filesystem::remove_all(DECOMPRESSED_DIR_PATH));
+}
+
+TEST(ArchiveHelperTest, ParallelDecompressionInvalidInputPath)
+{
+    try
+    {
+        Utils::ArchiveHelper::decompressParallel("./nonexistent_file");
+        FAIL() << "Expected std::runtime_error";
+    }
+    catch (const std::runtime_error& e)
+    {
+        EXPECT_STREQ("Error opening file during decompression. Error: Failed to open './nonexistent_file'", e.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Expected std::runtime_error";
+    }
+}
+
+TEST(ArchiveHelperTest, DecompressToSink)
+{
+    std::map<std::string, std::string> extracted;
+    const bool stop = false;
+    Utils::ArchiveHelper::decompressToSink(COMPRESSED_DIR_PATH,
+                                           [&extracted](const std::string& path, const std::vector<char>& data)
+                                           {
+                                               extracted[path] = std::string(data.begin(), data.end());
+                                           },
+                                           stop);
+
+    ASSERT_EQ(2ul, extracted.size());
+
+    std::ifstream inputFile(BASE_EXAMPLE1_PATH);
+    ASSERT_TRUE(inputFile.is_open());
+    std::string originalFile1;
+    getline(inputFile, originalFile1);
+    inputFile.close();
+
+    const auto it {extracted.find("content_dir/content_example1.json")};
+    ASSERT_NE(extracted.end(), it);
+    EXPECT_EQ(0ul, it->second.find(originalFile1));
+
+    // Nothing was written to disk
+    EXPECT_FALSE(std::filesystem::exists(DECOMPRESSED_DIR_PATH));
+}
+
+TEST(ArchiveHelperTest, DecompressToSinkExtractOnly)
+{
+    std::vector<std::string> extractOnly;
+    extractOnly.emplace_back("content_dir/content_example1.json");
+    std::map<std::string, std::string> extracted;
+    const bool stop = false;
+    Utils::ArchiveHelper::decompressToSink(COMPRESSED_DIR_PATH,
+                                           [&extracted](const std::string& path, const std::vector<char>& data)
+                                           {
+                                               extracted[path] = std::string(data.begin(), data.end());
+                                           },
+                                           stop,
+                                           extractOnly);
+
+    ASSERT_EQ(1ul, extracted.size());
+    EXPECT_NE(extracted.end(), extracted.find("content_dir/content_example1.json"));
+}
@@ -0,0 +1,63 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 26, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "epollWrapper_test.hpp"
+#include "../epollWrapper.hpp"
+#include <vector>
+
+TEST_F(EpollWrapperTest, WakeupChannelCoalescesNotifications)
+{
+    EpollWrapper epoll;
+    const auto wakeupFD = epoll.addWakeupChannel();
+
+    // Several notifications before the wait collapse into a single event
+    epoll.notifyWakeup(wakeupFD);
+    epoll.notifyWakeup(wakeupFD);
+    epoll.notifyWakeup(wakeupFD);
+
+    std::vector<struct epoll_event> events(8);
+    const auto numFDsReady = epoll.wait(events.data(), events.size(), 1000);
+    ASSERT_EQ(numFDsReady, 1);
+    EXPECT_EQ(events.at(0).data.fd, wakeupFD);
+
+    epoll.drainWakeup(wakeupFD);
+
+    // Once drained, the edge-triggered channel is silent until the next notification
+    EXPECT_EQ(epoll.wait(events.data(), events.size(), 0), 0);
+
+    epoll.removeWakeupChannel(wakeupFD);
+}
+
+TEST_F(EpollWrapperTest, TimerFiresPeriodically)
+{
+    EpollWrapper epoll;
+    const auto timerFD = epoll.addTimer(10);
+
+    std::vector<struct epoll_event> events(8);
+    const auto numFDsReady = epoll.wait(events.data(), events.size(), 1000);
+    ASSERT_EQ(numFDsReady, 1);
+    EXPECT_EQ(events.at(0).data.fd, timerFD);
+    EXPECT_GE(epoll.drainTimer(timerFD), 1u);
+
+    // A periodic timer keeps firing after being drained
+    EXPECT_EQ(epoll.wait(events.data(), events.size(), 1000), 1);
+    EXPECT_GE(epoll.drainTimer(timerFD), 1u);
+
+    epoll.removeTimer(timerFD);
+}
+
+TEST_F(EpollWrapperTest, InvalidTimerInterval)
+{
+    EpollWrapper epoll;
+
+    // A zero interval disarms a timerfd, the wrapper rejects it instead
+    EXPECT_THROW(epoll.addTimer(0), std::runtime_error);
+}
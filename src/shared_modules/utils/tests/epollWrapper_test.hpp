@@ -0,0 +1,26 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 26, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _EPOLL_WRAPPER_TEST_HPP
+#define _EPOLL_WRAPPER_TEST_HPP
+
+#include "gtest/gtest.h"
+
+class EpollWrapperTest : public ::testing::Test
+{
+protected:
+    EpollWrapperTest() = default;
+    virtual ~EpollWrapperTest() = default;
+
+    void SetUp() override {};
+    void TearDown() override {};
+};
+#endif // _EPOLL_WRAPPER_TEST_HPP
@@ -90,6 +90,23 @@ TEST_F(HashHelperTest, HashHelperHashIterativeSha256)
     EXPECT_TRUE(!memcmp(expected, result.data(), result.size()));
 }
 
+TEST_F(HashHelperTest, HashHelperReusedContexts)
+{
+    const unsigned char expected[] {0x2d, 0x53, 0x3b, 0x9d, 0x9f, 0x0f, 0x06, 0xef, 0x4e, 0x3c, 0x23, 0xfd, 0x49, 0x6c, 0xfe, 0xb2, 0x78, 0x0e, 0xda, 0x7f};
+    const std::string data{"HASH"};
+
+    // Consecutive instances on the same thread reuse pooled contexts, which must be
+    // reinitialized transparently.
+    for (auto i = 0; i < 3; ++i)
+    {
+        HashData hash;
+        hash.update(data.c_str(), data.size());
+        const auto result{ hash.hash() };
+        EXPECT_EQ(sizeof(expected), result.size());
+        EXPECT_TRUE(!memcmp(expected, result.data(), result.size()));
+    }
+}
+
 /**
  * @brief Test the hashing of a file.
  *
@@ -687,3 +687,166 @@ TEST_F(JsonArrayParserTest, InexistentFile)
     // Start the parse and expect an exception
     ASSERT_THROW(JsonArray::parse(testFilepath, callback, testArrayPointer), std::runtime_error);
 }
+
+/**
+ * @brief Parallel parse of a nested array delivers the same items, ids and body as the sequential parse.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseNestedArrayWithBody)
+{
+    // Setup the input data
+    const auto testData {R"(
+    {
+        "name": "test file",
+        "nested": {"cves_array":
+            [
+                {"cve":"CVE-2005-AAAA", "refs": ["a", "b"]},
+                {"cve":"CVE-2008-AAAA", "score": 5.5},
+                "plain value",
+                42
+            ]
+        }
+    }
+    )"};
+    const auto testArrayPointer {"/nested/cves_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseNestedArrayWithBody.json"};
+    createTestFile(testData, testFilepath);
+
+    // Set the expected items
+    std::queue<nlohmann::json> expectedItems;
+    expectedItems.push(R"({"cve":"CVE-2005-AAAA", "refs": ["a", "b"]})"_json);
+    expectedItems.push(R"({"cve":"CVE-2008-AAAA", "score": 5.5})"_json);
+    expectedItems.push(R"("plain value")"_json);
+    expectedItems.push(R"(42)"_json);
+
+    // Set the expected body: the original JSON with the array items removed
+    const auto expectedBody {R"({"name": "test file", "nested": {"cves_array": []}})"_json};
+
+    size_t currentId {1};
+    auto itemCallback = [&](nlohmann::json&& item, const size_t itemId)
+    {
+        EXPECT_EQ(expectedItems.front(), item);
+        EXPECT_EQ(itemId, currentId);
+        ++currentId;
+        expectedItems.pop();
+        return true;
+    };
+
+    auto bodyCallbackCount {0};
+    auto bodyCallback = [&](nlohmann::json&& body)
+    {
+        EXPECT_EQ(expectedBody, body);
+        ++bodyCallbackCount;
+    };
+
+    // Parse the JSON array
+    ASSERT_NO_THROW(JsonArray::parseParallel(testFilepath, itemCallback, testArrayPointer, bodyCallback));
+
+    // At the end of the processing the expected queue must be empty and the body delivered once
+    EXPECT_TRUE(expectedItems.empty());
+    EXPECT_EQ(bodyCallbackCount, 1);
+}
+
+/**
+ * @brief Parallel parse of a top level array with more items than a dispatch batch keeps the ordering.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseTopLevelArrayOrdering)
+{
+    // Setup the input data: enough items to span several worker batches
+    constexpr size_t ITEM_COUNT {1000};
+    std::string testData {"["};
+    for (size_t i = 0; i < ITEM_COUNT; ++i)
+    {
+        if (i > 0)
+        {
+            testData += ',';
+        }
+        testData += R"({"id":)" + std::to_string(i) + "}";
+    }
+    testData += "]";
+
+    const auto testFilepath {m_testFolder / "ParallelParseTopLevelArrayOrdering.json"};
+    createTestFile(testData, testFilepath);
+
+    size_t currentId {1};
+    auto itemCallback = [&](nlohmann::json&& item, const size_t itemId)
+    {
+        // Items must arrive in document order with sequential ids
+        EXPECT_EQ(itemId, currentId);
+        EXPECT_EQ(item.at("id").get<size_t>(), currentId - 1);
+        ++currentId;
+        return true;
+    };
+
+    // Parse the JSON array
+    ASSERT_NO_THROW(JsonArray::parseParallel(testFilepath, itemCallback));
+
+    // All the items must have been delivered
+    EXPECT_EQ(currentId, ITEM_COUNT + 1);
+}
+
+/**
+ * @brief Parallel parse stops when the item callback returns false. The body callback must not be called.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseStopParsing)
+{
+    // Setup the input data
+    const auto testData {R"(
+    {"test_array":
+            ["1","2","3","4"]
+    }
+    )"};
+    const auto testArrayPointer {"/test_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseStopParsing.json"};
+    createTestFile(testData, testFilepath);
+
+    auto itemCallbackCounter {0};
+    auto itemCallback = [&](nlohmann::json&& /*item*/, const size_t itemId)
+    {
+        ++itemCallbackCounter;
+
+        // Stop the parsing after the second item
+        return itemId < 2;
+    };
+
+    auto bodyCallback = [](nlohmann::json&& /*body*/)
+    {
+        // Execution should never reach here
+        EXPECT_TRUE(false) << "The body callback should not have been called.";
+    };
+
+    // Parse the JSON array
+    ASSERT_NO_THROW(JsonArray::parseParallel(testFilepath, itemCallback, testArrayPointer, bodyCallback));
+
+    // The callback must have been called two times because the parsing was stopped after the second item
+    EXPECT_EQ(itemCallbackCounter, 2);
+}
+
+/**
+ * @brief Parallel parse with a non existing target array. Expect exception.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseArrayIsNotFound)
+{
+    // Setup the input data
+    const auto testData {R"(
+    {"test_array":
+            []
+    }
+    )"};
+    const auto testArrayPointer {"/wrong_array"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseArrayIsNotFound.json"};
+    createTestFile(testData, testFilepath);
+
+    auto callback = [](nlohmann::json&& /*item*/, const size_t /*itemId*/)
+    {
+        // Execution should never reach here
+        EXPECT_TRUE(false) << "The callback should not have been called.";
+        return true;
+    };
+
+    // Parse the JSON array and expect an exception
+    ASSERT_THROW(JsonArray::parseParallel(testFilepath, callback, testArrayPointer), std::runtime_error);
+}
@@ -166,3 +166,36 @@ TEST_F(MsgDispatcherTest, MsgDispatcherRemoveCallback)
     dispatcher.removeCallback(key1);
     dispatcher.dispatch(input1);
 }
+
+using StealingTestMsgDispatcher = MsgDispatcher<Key, Value, RawValue, DecoderWrapper, StealingAsyncDispatcher>;
+
+TEST_F(MsgDispatcherTest, MsgDispatcherWithWorkStealingPool)
+{
+    const Key key1{100};
+    const Key key2{200};
+    const auto input1 {RawValue{reinterpret_cast<void*>(0x65654), 5000}};
+    const auto input2 {RawValue{reinterpret_cast<void*>(0x65244), 4000}};
+
+    const auto decoded1 {DecodedValue(key1, "value 0")};
+    const auto decoded2 {DecodedValue(key2, "value 1")};
+    StealingTestMsgDispatcher dispatcher;
+    EXPECT_CALL(dispatcher, decode(input1)).WillOnce(Return(decoded1));
+    EXPECT_CALL(dispatcher, decode(input2)).WillOnce(Return(decoded2));
+
+    EXPECT_CALL(dispatcher, callback(decoded1.second)).Times(1);
+    EXPECT_CALL(dispatcher, callback(decoded2.second)).Times(1);
+    EXPECT_NO_THROW(dispatcher.addCallback(key1, [&dispatcher](const Value & value)
+    {
+        dispatcher.callback(value);
+    }));
+    EXPECT_NO_THROW(dispatcher.addCallback(key2, [&dispatcher](const Value & value)
+    {
+        dispatcher.callback(value);
+    }));
+
+    dispatcher.push(input1);
+    dispatcher.push(input2);
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(dispatcher.numberOfThreads(), dispatcher.queueStats().size());
+}
@@ -394,6 +394,57 @@ TYPED_TEST_P(SocketTest, SingleDelayedClientWithReconnectionServerReset)
     EXPECT_EQ(counter, MESSAGE_QUANTITY);
 }
 
+TYPED_TEST_P(SocketTest, ConnectionStateCallbacks)
+{
+    std::string socketPath {"/tmp/echo_sock"};
+
+    auto server = std::make_unique<SocketServer<Socket<OSPrimitives, TypeParam>, EpollWrapper>>(socketPath);
+    server->listen(
+        [](const int fd, const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+        {
+            std::ignore = fd;
+            std::ignore = dataHeader;
+            std::ignore = sizeHeader;
+            std::ignore = size;
+            std::ignore = data;
+        });
+
+    std::promise<void> connected;
+    std::promise<void> disconnected;
+    std::atomic<bool> connectedOnce {false};
+    std::atomic<bool> disconnectedOnce {false};
+
+    SocketClient<Socket<OSPrimitives, TypeParam>, EpollWrapper> client {socketPath};
+    client.connect(
+        [](const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+        {
+            std::ignore = dataHeader;
+            std::ignore = sizeHeader;
+            std::ignore = size;
+            std::ignore = data;
+        },
+        [&]()
+        {
+            if (!connectedOnce.exchange(true))
+            {
+                connected.set_value();
+            }
+        },
+        [&]()
+        {
+            if (!disconnectedOnce.exchange(true))
+            {
+                disconnected.set_value();
+            }
+        });
+
+    EXPECT_EQ(connected.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+
+    server.reset();
+
+    EXPECT_EQ(disconnected.get_future().wait_for(std::chrono::seconds(10)), std::future_status::ready);
+}
+
 // All tests must be registered
 
 REGISTER_TYPED_TEST_SUITE_P(SocketTest,
@@ -402,7 +453,8 @@ REGISTER_TYPED_TEST_SUITE_P(SocketTest,
                             MultipleClients,
                             SingleDelayedClientWithReconnectionSendMessageOffline,
                             SingleDelayedClientWithReconnectionOnline,
-                            SingleDelayedClientWithReconnectionServerReset);
+                            SingleDelayedClientWithReconnectionServerReset,
+                            ConnectionStateCallbacks);
 
 // Configuring typed-tests
 using ProtocolTypes = ::testing::Types<AppendHeaderProtocol, SizeHeaderProtocol>;
@@ -65,6 +65,79 @@ TEST_F(StringUtilsTest, SplitIndexRuntimeError)
     EXPECT_THROW(Utils::splitIndex("hello.world", '.', 2), std::runtime_error);
 }
 
+TEST_F(StringUtilsTest, SplitViewEmptyString)
+{
+    const auto splitTextVector {Utils::splitView("", '.')};
+    EXPECT_EQ(0ull, splitTextVector.size());
+}
+
+TEST_F(StringUtilsTest, SplitViewDelimiterNoCoincidence)
+{
+    const auto splitTextVector {Utils::splitView("hello_world", '.')};
+    EXPECT_EQ(1ull, splitTextVector.size());
+    EXPECT_EQ(splitTextVector[0], "hello_world");
+}
+
+TEST_F(StringUtilsTest, SplitViewDelimiterCoincidence)
+{
+    const auto splitTextVector {Utils::splitView("hello.world", '.')};
+    EXPECT_EQ(2ull, splitTextVector.size());
+    EXPECT_EQ(splitTextVector[0], "hello");
+    EXPECT_EQ(splitTextVector[1], "world");
+}
+
+TEST_F(StringUtilsTest, SplitViewKeepsEmptyMiddleTokens)
+{
+    const auto splitTextVector {Utils::splitView("a..b", '.')};
+    EXPECT_EQ(3ull, splitTextVector.size());
+    EXPECT_EQ(splitTextVector[0], "a");
+    EXPECT_EQ(splitTextVector[1], "");
+    EXPECT_EQ(splitTextVector[2], "b");
+}
+
+TEST_F(StringUtilsTest, SplitViewDropsTrailingEmptyToken)
+{
+    // Same semantics as split(): "a." yields one token, "." yields one empty token
+    const auto trailing {Utils::splitView("a.", '.')};
+    EXPECT_EQ(1ull, trailing.size());
+    EXPECT_EQ(trailing[0], "a");
+
+    const auto onlyDelimiter {Utils::splitView(".", '.')};
+    EXPECT_EQ(1ull, onlyDelimiter.size());
+    EXPECT_EQ(onlyDelimiter[0], "");
+}
+
+TEST_F(StringUtilsTest, SplitViewMatchesSplit)
+{
+    const std::string input {"1:2::3:longer_token_here:4:"};
+    const auto tokens {Utils::split(input, ':')};
+    const auto views {Utils::splitView(input, ':')};
+
+    ASSERT_EQ(tokens.size(), views.size());
+
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        EXPECT_EQ(tokens[i], views[i]);
+    }
+}
+
+TEST_F(StringUtilsTest, SplitViewBorrowsInput)
+{
+    const std::string input {"hello.world"};
+    const auto splitTextVector {Utils::splitView(input, '.')};
+    ASSERT_EQ(2ull, splitTextVector.size());
+    EXPECT_EQ(static_cast<const void*>(splitTextVector[0].data()), static_cast<const void*>(input.data()));
+}
+
+TEST_F(StringUtilsTest, TrimView)
+{
+    EXPECT_EQ(Utils::trimView("  hello  "), "hello");
+    EXPECT_EQ(Utils::trimView("hello"), "hello");
+    EXPECT_EQ(Utils::trimView("   "), "");
+    EXPECT_EQ(Utils::trimView(""), "");
+    EXPECT_EQ(Utils::trimView(" \"value\"\t", " \"\t"), "value");
+}
+
 TEST_F(StringUtilsTest, AsciiToHexString)
 {
     const std::vector<unsigned char> data {0x2d, 0x53, 0x3b, 0x9d, 0x9f, 0x0f, 0x06, 0xef, 0x4e, 0x3c,
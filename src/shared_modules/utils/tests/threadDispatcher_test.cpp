@@ -121,3 +121,137 @@ TEST_F(ThreadDispatcherTest, AsyncDispatcherQueue)
     dispatcher.rundown();
 }
 
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherPushAndRundown)
+{
+    FunctorWrapper functor;
+    StealingAsyncDispatcher<int, std::reference_wrapper<FunctorWrapper>> dispatcher
+    {
+        std::ref(functor)
+    };
+    EXPECT_EQ(std::thread::hardware_concurrency(), dispatcher.numberOfThreads());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_CALL(functor, Operator(i));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(0ul, dispatcher.size());
+}
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherCancel)
+{
+    FunctorWrapper functor;
+    StealingAsyncDispatcher<int, std::reference_wrapper<FunctorWrapper>> dispatcher
+    {
+        std::ref(functor)
+    };
+    dispatcher.cancel();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_CALL(functor, Operator(i)).Times(0);
+        dispatcher.push(i);
+    }
+
+    EXPECT_TRUE(dispatcher.cancelled());
+    dispatcher.rundown();
+    EXPECT_EQ(0ul, dispatcher.size());
+}
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherStealsFromBusyThread)
+{
+    constexpr auto NUMBER_OF_THREADS { 2u };
+    constexpr auto NUMBER_OF_ITEMS { 50 };
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::atomic<bool> blockerHeld { true };
+    std::atomic<int> processed { 0 };
+
+    StealingAsyncDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [&](const int value)
+        {
+            if (-1 == value)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&blockerHeld]()
+                {
+                    return !blockerHeld.load();
+                });
+            }
+            else
+            {
+                ++processed;
+            }
+        }
+        , NUMBER_OF_THREADS
+    };
+
+    // Saturate one thread with a blocking item; every other item must still be
+    // processed by the remaining thread stealing from the busy one's queue.
+    dispatcher.push(-1);
+
+    for (int i = 0; i < NUMBER_OF_ITEMS; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    const auto deadline { std::chrono::steady_clock::now() + std::chrono::seconds(10) };
+
+    while (processed != NUMBER_OF_ITEMS && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    EXPECT_EQ(NUMBER_OF_ITEMS, processed);
+
+    blockerHeld = false;
+    condition.notify_all();
+    dispatcher.rundown();
+
+    uint64_t stolen { 0 };
+
+    for (const auto& stats : dispatcher.queueStats())
+    {
+        stolen += stats.stolen;
+    }
+
+    EXPECT_GT(stolen, 0ul);
+}
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherQueueStats)
+{
+    constexpr auto NUMBER_OF_THREADS { 1u };
+    constexpr auto NUMBER_OF_ITEMS { 10u };
+    StealingAsyncDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [](int)
+        {
+        }
+        , NUMBER_OF_THREADS
+    };
+
+    for (unsigned int i = 0; i < NUMBER_OF_ITEMS; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    dispatcher.rundown();
+
+    const auto stats { dispatcher.queueStats() };
+    ASSERT_EQ(NUMBER_OF_THREADS, stats.size());
+    EXPECT_EQ(0ul, stats[0].depth);
+    EXPECT_EQ(NUMBER_OF_ITEMS, stats[0].pushed);
+    // The rundown sentinel is popped too, hence >=.
+    EXPECT_GE(stats[0].popped, NUMBER_OF_ITEMS);
+    EXPECT_EQ(0ul, stats[0].stolen);
+    EXPECT_GE(stats[0].maxDepth, 1ul);
+}
@@ -160,3 +160,72 @@ TEST_F(WazuhDBQueryBuilderTest, AgentGetPackagesCommand)
     std::string message = WazuhDBQueryBuilder::builder().agentGetPackagesCommand("1").build();
     EXPECT_EQ(message, "agent 1 package get ");
 }
+
+TEST_F(WazuhDBQueryBuilderTest, InListTest)
+{
+    std::string message = WazuhDBQueryBuilder::builder()
+                              .global()
+                              .selectAll()
+                              .fromTable("agent")
+                              .whereColumn("id")
+                              .inList({"1", "2", "3"})
+                              .build();
+    EXPECT_EQ(message, "global sql SELECT * FROM agent WHERE id IN ('1','2','3') ");
+}
+
+TEST_F(WazuhDBQueryBuilderTest, InListSingleValue)
+{
+    std::string message =
+        WazuhDBQueryBuilder::builder().global().selectAll().fromTable("agent").whereColumn("id").inList({"1"}).build();
+    EXPECT_EQ(message, "global sql SELECT * FROM agent WHERE id IN ('1') ");
+}
+
+TEST_F(WazuhDBQueryBuilderTest, InListEmptyThrows)
+{
+    EXPECT_THROW(WazuhDBQueryBuilder::builder().global().selectAll().fromTable("agent").whereColumn("id").inList({}),
+                 std::runtime_error);
+}
+
+TEST_F(WazuhDBQueryBuilderTest, InListInvalidValueThrows)
+{
+    EXPECT_THROW(
+        WazuhDBQueryBuilder::builder().global().selectAll().fromTable("agent").whereColumn("id").inList({"1'; DROP"}),
+        std::runtime_error);
+}
+
+TEST_F(WazuhDBQueryBuilderTest, ChunkTest)
+{
+    const std::vector<std::string> values {"1", "2", "3", "4", "5"};
+    const auto chunks {WazuhDBQueryBuilder::chunk(values, 2)};
+
+    ASSERT_EQ(chunks.size(), 3ull);
+    EXPECT_EQ(chunks[0], (std::vector<std::string> {"1", "2"}));
+    EXPECT_EQ(chunks[1], (std::vector<std::string> {"3", "4"}));
+    EXPECT_EQ(chunks[2], (std::vector<std::string> {"5"}));
+}
+
+TEST_F(WazuhDBQueryBuilderTest, ChunkEmptyTest)
+{
+    EXPECT_TRUE(WazuhDBQueryBuilder::chunk({}).empty());
+}
+
+TEST_F(WazuhDBQueryBuilderTest, ChunkInvalidSizeThrows)
+{
+    EXPECT_THROW(WazuhDBQueryBuilder::chunk({"1"}, 0), std::runtime_error);
+}
+
+TEST_F(WazuhDBQueryBuilderTest, DemuxTest)
+{
+    const std::vector<std::pair<std::string, std::string>> rows {
+        {"1", "bash"}, {"2", "vim"}, {"1", "curl"}, {"3", "git"}};
+
+    const auto grouped {
+        WazuhDBQueryBuilder::demux(rows, [](const std::pair<std::string, std::string>& row) { return row.first; })};
+
+    ASSERT_EQ(grouped.size(), 3ull);
+    EXPECT_EQ(grouped.at("1").size(), 2ull);
+    EXPECT_EQ(grouped.at("2").size(), 1ull);
+    EXPECT_EQ(grouped.at("3").size(), 1ull);
+    EXPECT_EQ(grouped.at("1")[0].second, "bash");
+    EXPECT_EQ(grouped.at("1")[1].second, "curl");
+}
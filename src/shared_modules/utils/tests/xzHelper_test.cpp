@@ -155,6 +155,46 @@ TEST_F(XzHelperTest, DecompressFileOutputToFileMultiThread)
     EXPECT_EQ(hashFile(DECOMPRESSED_OUTPUT_FILE), hashFile(UNCOMPRESSED_REFERENCE_FILE));
 }
 
+/**
+ * @brief Test correct decompression of a sample file as input, streaming the output to a callback. Single-thread.
+ *
+ */
+TEST_F(XzHelperTest, DecompressFileOutputToCallbackSingleThread)
+{
+    // Setup: accumulate the streamed chunks to verify the whole output
+    std::vector<uint8_t> decompressedData;
+    Utils::XzHelper xz(COMPRESSED_INPUT_FILE_ST,
+                       [&decompressedData](const uint8_t* data, size_t dataLen)
+                       { decompressedData.insert(decompressedData.end(), data, data + dataLen); });
+
+    // Decompress
+    ASSERT_NO_THROW(xz.decompress());
+
+    // Check that the streamed data equals the data of the uncompressed reference file
+    EXPECT_EQ(decompressedData, loadFile(UNCOMPRESSED_REFERENCE_FILE));
+}
+
+/**
+ * @brief Test correct decompression of a sample file as input, streaming the output to a callback. Multi-thread.
+ *
+ */
+TEST_F(XzHelperTest, DecompressFileOutputToCallbackMultiThread)
+{
+    // Setup: accumulate the streamed chunks to verify the whole output
+    std::vector<uint8_t> decompressedData;
+    Utils::XzHelper xz(
+        COMPRESSED_INPUT_FILE_MT,
+        [&decompressedData](const uint8_t* data, size_t dataLen)
+        { decompressedData.insert(decompressedData.end(), data, data + dataLen); },
+        MAX_THREAD_COUNT);
+
+    // Decompress
+    ASSERT_NO_THROW(xz.decompress());
+
+    // Check that the streamed data equals the data of the uncompressed reference file
+    EXPECT_EQ(decompressedData, loadFile(UNCOMPRESSED_REFERENCE_FILE));
+}
+
 /**
  * @brief Test that trying to decompress a non existing file throws exception.
  *
@@ -125,6 +125,77 @@ TEST_F(ZlibHelperTest, GzDecompressFileWithoutGzExtension)
     EXPECT_THROW(Utils::ZlibHelper::gzipDecompress(RAW_FILE, JSON_FILE), std::runtime_error);
 }
 
+/**
+ * @brief Tests the streaming GZ decompression when the input file is empty or it doesn't exist.
+ *
+ */
+TEST_F(ZlibHelperTest, GzStreamInvalidInputFile)
+{
+    EXPECT_THROW(Utils::ZlibHelper::gzipStreamDecompress("", JSON_FILE), std::runtime_error);
+    EXPECT_THROW(Utils::ZlibHelper::gzipStreamDecompress("inexistant.xml.gz", JSON_FILE), std::runtime_error);
+}
+
+/**
+ * @brief Tests the streaming GZ decompression when the output file is empty or the path doesn't exist.
+ *
+ */
+TEST_F(ZlibHelperTest, GzStreamInvalidOutputFile)
+{
+    EXPECT_THROW(Utils::ZlibHelper::gzipStreamDecompress(GZ_FILE, ""), std::runtime_error);
+    EXPECT_THROW(Utils::ZlibHelper::gzipStreamDecompress(GZ_FILE, "inexistant/sample.json"), std::runtime_error);
+}
+
+/**
+ * @brief Tests the correct streaming GZ decompression of a file.
+ *
+ */
+TEST_F(ZlibHelperTest, GzStreamDecompressFile)
+{
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipStreamDecompress(GZ_FILE, JSON_FILE));
+
+    // Check the expected hash.
+    EXPECT_EQ(SHA1_EXPECTED, getFileHash(JSON_FILE));
+}
+
+/**
+ * @brief Tests the streaming GZ decompression of a file whose format is not '.gz'.
+ *
+ */
+TEST_F(ZlibHelperTest, GzStreamDecompressFileWithoutGzExtension)
+{
+    EXPECT_THROW(Utils::ZlibHelper::gzipStreamDecompress(RAW_FILE, JSON_FILE), std::runtime_error);
+}
+
+/**
+ * @brief Tests that one thread's inflate context is reusable across consecutive files.
+ *
+ */
+TEST_F(ZlibHelperTest, GzStreamDecompressReusesContext)
+{
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipStreamDecompress(GZ_FILE, JSON_FILE));
+    EXPECT_EQ(SHA1_EXPECTED, getFileHash(JSON_FILE));
+
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipStreamDecompress(GZ_FILE, JSON_FILE));
+    EXPECT_EQ(SHA1_EXPECTED, getFileHash(JSON_FILE));
+}
+
+/**
+ * @brief Tests the chunked inflate of a truncated GZ stream.
+ *
+ */
+TEST_F(ZlibHelperTest, GzStreamDecompressTruncatedFile)
+{
+    // Copy all but the last bytes of the valid .gz file.
+    const auto truncatedPath {OUTPUT_DIR / "truncated.json.gz"};
+    std::ifstream input {GZ_FILE, std::ios::binary};
+    std::string content {std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+    std::ofstream output {truncatedPath, std::ios::binary};
+    output.write(content.data(), content.size() / 2);
+    output.close();
+
+    EXPECT_THROW(Utils::ZlibHelper::gzipStreamDecompress(truncatedPath, JSON_FILE), std::runtime_error);
+}
+
 /**
  * @brief Tests the ZIP decompression when the input file is empty or it doesn't exist.
  *
@@ -14,9 +14,12 @@
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <future>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include "threadSafeQueue.h"
 #include "promiseFactory.h"
 #include "commonDefs.h"
@@ -180,6 +183,272 @@ namespace Utils
             const size_t m_maxQueueSize;
     };
 
+    /**
+     * @brief Per-queue counters of a StealingAsyncDispatcher, snapshotted by queueStats().
+     */
+    struct DispatcherQueueStats
+    {
+        size_t depth;       ///< Items currently queued.
+        size_t maxDepth;    ///< Highest depth observed since construction.
+        uint64_t pushed;    ///< Items routed to this queue.
+        uint64_t popped;    ///< Items consumed from this queue (by any thread).
+        uint64_t stolen;    ///< Subset of popped taken by a thread other than the owner.
+        uint64_t waitedNs;  ///< Accumulated time the popped items spent queued.
+    };
+
+    /**
+     * @brief AsyncDispatcher variant with one queue per thread and work stealing.
+     * @details push() distributes round robin across per-thread queues, so threads
+     * don't contend on a single lock; a thread that drains its own queue pulls from
+     * the backlog of busy siblings instead of going idle. Drop-in for AsyncDispatcher
+     * through the ThreadDispatcher template parameter of MsgDispatcher and
+     * FilterMsgDispatcher.
+     *
+     * @tparam Type Messages types.
+     * @tparam Functor Entity that processes the messages.
+     */
+    template
+    <
+        typename Type,
+        typename Functor
+        >
+    class StealingAsyncDispatcher
+    {
+        public:
+            StealingAsyncDispatcher(Functor functor, const unsigned int numberOfThreads = std::thread::hardware_concurrency(), const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+                : m_functor{ functor }
+                , m_running{ true }
+                , m_numberOfThreads{ numberOfThreads ? numberOfThreads : 1 }
+                , m_maxQueueSize { maxQueueSize }
+                , m_pushIndex{ 0 }
+            {
+                m_shards.reserve(m_numberOfThreads);
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    m_shards.push_back(std::make_unique<Shard>());
+                }
+
+                m_threads.reserve(m_numberOfThreads);
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    m_threads.push_back(std::thread{ &StealingAsyncDispatcher<Type, Functor>::dispatch, this, i });
+                }
+            }
+            StealingAsyncDispatcher& operator=(const StealingAsyncDispatcher&) = delete;
+            StealingAsyncDispatcher(StealingAsyncDispatcher& other) = delete;
+            ~StealingAsyncDispatcher()
+            {
+                cancel();
+            }
+
+            void push(const Type& value)
+            {
+                if (m_running)
+                {
+                    if (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || size() < m_maxQueueSize)
+                    {
+                        auto& shard { *m_shards[m_pushIndex++ % m_numberOfThreads] };
+                        ++shard.pushed;
+                        shard.queue.push
+                        (
+                            WorkItem
+                        {
+                            std::chrono::steady_clock::now(),
+                            [value, this]()
+                            {
+                                this->m_functor(value);
+                            }
+                        }
+                        );
+                        const auto depth { shard.queue.size() };
+                        auto maxDepth { shard.maxDepth.load() };
+
+                        while (depth > maxDepth && !shard.maxDepth.compare_exchange_weak(maxDepth, depth))
+                        {
+                        }
+                    }
+                }
+            }
+
+            void rundown()
+            {
+                if (m_running)
+                {
+                    std::vector<std::shared_ptr<IWait>> promises;
+                    promises.reserve(m_numberOfThreads);
+
+                    for (const auto& shard : m_shards)
+                    {
+                        auto promise { PromiseFactory<PROMISE_TYPE>::getPromiseObject() };
+                        shard->queue.push
+                        (
+                            WorkItem
+                        {
+                            std::chrono::steady_clock::now(),
+                            [promise]()
+                            {
+                                promise->set_value();
+                            }
+                        }
+                        );
+                        promises.push_back(std::move(promise));
+                    }
+
+                    for (const auto& promise : promises)
+                    {
+                        promise->wait();
+                    }
+
+                    cancel();
+                }
+            }
+            void cancel()
+            {
+                m_running = false;
+
+                for (const auto& shard : m_shards)
+                {
+                    shard->queue.cancel();
+                }
+
+                joinThreads();
+            }
+
+            bool cancelled() const
+            {
+                return !m_running;
+            }
+            unsigned int numberOfThreads() const
+            {
+                return m_numberOfThreads;
+            }
+            size_t size() const
+            {
+                size_t ret{ 0 };
+
+                for (const auto& shard : m_shards)
+                {
+                    ret += shard->queue.size();
+                }
+
+                return ret;
+            }
+
+            std::vector<DispatcherQueueStats> queueStats() const
+            {
+                std::vector<DispatcherQueueStats> ret;
+                ret.reserve(m_numberOfThreads);
+
+                for (const auto& shard : m_shards)
+                {
+                    ret.push_back
+                    (
+                        DispatcherQueueStats
+                    {
+                        shard->queue.size(),
+                        shard->maxDepth.load(),
+                        shard->pushed.load(),
+                        shard->popped.load(),
+                        shard->stolen.load(),
+                        shard->waitedNs.load()
+                    }
+                    );
+                }
+
+                return ret;
+            }
+
+        private:
+            struct WorkItem
+            {
+                std::chrono::steady_clock::time_point enqueued;
+                std::function<void()> task;
+            };
+            struct Shard
+            {
+                SafeQueue<WorkItem> queue;
+                std::atomic<size_t> maxDepth{ 0 };
+                std::atomic<uint64_t> pushed{ 0 };
+                std::atomic<uint64_t> popped{ 0 };
+                std::atomic<uint64_t> stolen{ 0 };
+                std::atomic<uint64_t> waitedNs{ 0 };
+            };
+
+            void account(Shard& shard, const WorkItem& item)
+            {
+                ++shard.popped;
+                shard.waitedNs += std::chrono::duration_cast<std::chrono::nanoseconds>
+                                  (std::chrono::steady_clock::now() - item.enqueued).count();
+            }
+            bool steal(const unsigned int index, WorkItem& item)
+            {
+                for (unsigned int offset = 1; offset < m_numberOfThreads; ++offset)
+                {
+                    auto& victim { *m_shards[(index + offset) % m_numberOfThreads] };
+
+                    if (victim.queue.pop(item, false))
+                    {
+                        ++victim.stolen;
+                        account(victim, item);
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+            void dispatch(const unsigned int index)
+            {
+                try
+                {
+                    auto& own { *m_shards[index] };
+
+                    while (m_running)
+                    {
+                        WorkItem item;
+
+                        if (own.queue.pop(item, false))
+                        {
+                            account(own, item);
+                            item.task();
+                        }
+                        else if (steal(index, item))
+                        {
+                            item.task();
+                        }
+                        else if (own.queue.pop(item, true))
+                        {
+                            account(own, item);
+                            item.task();
+                        }
+                    }
+                }
+                catch (const std::exception& ex)
+                {
+                    std::cerr << "Dispatch handler error, " << ex.what() << std::endl;
+                }
+            }
+            void joinThreads()
+            {
+                for (auto& thread : m_threads)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+            }
+
+            Functor m_functor;
+            std::vector<std::unique_ptr<Shard>> m_shards;
+            std::vector<std::thread> m_threads;
+            std::atomic_bool m_running;
+            const unsigned int m_numberOfThreads;
+            const size_t m_maxQueueSize;
+            std::atomic<size_t> m_pushIndex;
+    };
+
     template <typename Input, typename Functor>
     class SyncDispatcher
     {
@@ -14,7 +14,9 @@
 
 #include "builder.hpp"
 #include "stringHelper.h"
+#include <map>
 #include <string>
+#include <vector>
 
 constexpr auto WAZUH_DB_ALLOWED_CHARS {"-_ "};
 
@@ -89,6 +91,39 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Multi-key match, collapsing one query per entity into one query per
+     * chunk: WHERE key IN ('a','b',...). Use chunk() to split large key sets and
+     * demux() to recover the per-entity rows from the bulk response.
+     */
+    WazuhDBQueryBuilder& inList(const std::vector<std::string>& values)
+    {
+        if (values.empty())
+        {
+            throw std::runtime_error("Invalid empty IN list");
+        }
+
+        m_query += "IN (";
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            if (!Utils::isAlphaNumericWithSpecialCharacters(values.at(i), WAZUH_DB_ALLOWED_CHARS))
+            {
+                throw std::runtime_error("Invalid value");
+            }
+
+            m_query += "'" + values.at(i) + "'";
+
+            if (i + 1 < values.size())
+            {
+                m_query += ",";
+            }
+        }
+
+        m_query += ") ";
+        return *this;
+    }
+
     WazuhDBQueryBuilder& andColumn(const std::string& column)
     {
         if (!Utils::isAlphaNumericWithSpecialCharacters(column, WAZUH_DB_ALLOWED_CHARS))
@@ -173,6 +208,58 @@ public:
     {
         return m_query;
     }
+
+    /**
+     * @brief Keys per IN clause. wazuh-db queries travel in a fixed-size socket
+     * payload, so key sets above this are split into several bulk queries.
+     */
+    static constexpr size_t MAX_IN_VALUES {500};
+
+    /**
+     * @brief Split a key set into chunks suited for inList().
+     */
+    static std::vector<std::vector<std::string>> chunk(const std::vector<std::string>& values,
+                                                       const size_t chunkSize = MAX_IN_VALUES)
+    {
+        if (0 == chunkSize)
+        {
+            throw std::runtime_error("Invalid chunk size");
+        }
+
+        std::vector<std::vector<std::string>> chunks;
+        chunks.reserve((values.size() + chunkSize - 1) / chunkSize);
+
+        for (size_t start = 0; start < values.size(); start += chunkSize)
+        {
+            const auto end {std::min(start + chunkSize, values.size())};
+            chunks.emplace_back(values.begin() + start, values.begin() + end);
+        }
+
+        return chunks;
+    }
+
+    /**
+     * @brief Group the rows of a bulk IN-clause response by the entity each row
+     * belongs to, recovering the per-entity results that one query per entity used
+     * to return.
+     *
+     * @param rows Row container supporting range-for and push_back (e.g. a
+     * nlohmann::json array).
+     * @param key Callable returning the grouping key of a row (e.g. its agent id
+     * column as string).
+     */
+    template<typename Rows, typename KeyExtractor>
+    static std::map<std::string, Rows> demux(const Rows& rows, KeyExtractor&& key)
+    {
+        std::map<std::string, Rows> grouped;
+
+        for (const auto& row : rows)
+        {
+            grouped[key(row)].push_back(row);
+        }
+
+        return grouped;
+    }
 };
 
 #endif /* _WAZUH_DB_QUERY_BUILDER_HPP */
@@ -0,0 +1,74 @@
+/*
+ * Wazuh - Shared Modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * August 26, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CALLBACK_DATA_COLLECTOR_HPP
+#define _CALLBACK_DATA_COLLECTOR_HPP
+
+#include "iDataCollector.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Xz
+{
+    /**
+     * @brief Callback invoked with each chunk of output data as it is produced.
+     *
+     */
+    using DataChunkCallback = std::function<void(const uint8_t* data, size_t dataLen)>;
+
+    /**
+     * @brief Streams the output data to a callback, chunk by chunk, without materializing the whole output
+     *
+     */
+    class CallbackDataCollector : public IDataCollector
+    {
+        static constexpr size_t DEFAULT_BUFFER_SIZE {8192}; ///< Default buffer size
+        DataChunkCallback m_callback;                       ///< Chunk consumer
+        std::vector<uint8_t> m_buffer;                      ///< Reusable chunk buffer
+
+    public:
+        /**
+         * @brief Construct a new Callback Data Collector object
+         *
+         * @param callback Consumer invoked with each output chunk
+         * @param bufferSize Buffer size to use for the receiving buffer
+         */
+        explicit CallbackDataCollector(DataChunkCallback callback, size_t bufferSize = DEFAULT_BUFFER_SIZE)
+            : m_callback(std::move(callback))
+            , m_buffer(bufferSize)
+        {
+        }
+
+        /*! @copydoc IDataCollector::begin() */
+        void begin() override {}
+
+        /*! @copydoc IDataCollector::setBuffer() */
+        void setBuffer(uint8_t** buffer, size_t& buffSize) override
+        {
+            *buffer = m_buffer.data();
+            buffSize = m_buffer.size();
+        }
+
+        /*! @copydoc IDataCollector::dataReady() */
+        void dataReady(size_t unusedBufferLen) override
+        {
+            // Calculate the amount of new data and hand it to the consumer. The buffer is
+            // reused for the next chunk, so the callback must not keep the pointer.
+            if (auto const newDataQty {m_buffer.size() - unusedBufferLen}; newDataQty > 0)
+            {
+                m_callback(m_buffer.data(), newDataQty);
+            }
+        }
+    };
+} // namespace Xz
+#endif // _CALLBACK_DATA_COLLECTOR_HPP
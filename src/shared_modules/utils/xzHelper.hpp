@@ -8,6 +8,7 @@
 #ifndef _XZ_HELPER_HPP
 #define _XZ_HELPER_HPP
 
+#include "xz/callbackDataCollector.hpp"
 #include "xz/fileDataCollector.hpp"
 #include "xz/fileDataProvider.hpp"
 #include "xz/iDataCollector.hpp"
@@ -128,6 +129,42 @@ namespace Utils
         {
         }
 
+        /**
+         * @brief Construct XZ helper with file input and streaming callback output
+         *
+         * @details The callback receives each decompressed (or compressed) chunk as it is produced, so the
+         * output can be fed directly to a downstream consumer (e.g. a JSON array parser) without materializing
+         * the whole output on disk or in memory.
+         *
+         * @param source Path to input file
+         * @param dest Callback invoked with each output chunk
+         * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         */
+        XzHelper(const std::filesystem::path& source,
+                 Xz::DataChunkCallback dest,
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+            : m_spDataProvider(std::make_unique<Xz::FileDataProvider>(source))
+            , m_spDataCollector(std::make_unique<Xz::CallbackDataCollector>(std::move(dest)))
+            , m_threadCount(threadCount)
+        {
+        }
+
+        /**
+         * @brief Construct XZ helper with vector input and streaming callback output
+         *
+         * @param source Vector with the input data
+         * @param dest Callback invoked with each output chunk
+         * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         */
+        XzHelper(const std::vector<uint8_t>& source,
+                 Xz::DataChunkCallback dest,
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+            : m_spDataProvider(std::make_unique<Xz::VectorDataProvider>(source))
+            , m_spDataCollector(std::make_unique<Xz::CallbackDataCollector>(std::move(dest)))
+            , m_threadCount(threadCount)
+        {
+        }
+
         /**
          * @brief Compress the input data
          *
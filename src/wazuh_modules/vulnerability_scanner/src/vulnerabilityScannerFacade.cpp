@@ -20,11 +20,12 @@
 #include "wdbDataException.hpp"
 #include "xzHelper.hpp"
 #include <string>
+#include <unordered_set>
 
 constexpr auto DEFAULT_QUEUE_PATH = "queue/sockets/queue";
 constexpr auto REPORTS_QUEUE_PATH = "queue/vd/reports";
 constexpr auto REPORTS_BULK_SIZE {1};
-constexpr auto EVENTS_BULK_SIZE {1};
+constexpr auto EVENTS_BULK_SIZE {32};
 constexpr auto EVENTS_QUEUE_PATH = "queue/vd/event";
 constexpr auto MICROSEC_FACTOR {1000000};
 
@@ -160,41 +161,67 @@ void VulnerabilityScannerFacade::initEventDispatcher()
                 return "unable to parse";
             };
 
-            const auto& element = dataQueue.front();
-            try
+            // Payloads already processed in this batch. Agent inventory syncs push long
+            // runs of identical events for the same agent; collapsing the duplicates
+            // here bounds the repeated decode->orchestrate work to one scan per
+            // distinct payload per batch, preserving arrival order for the rest.
+            std::unordered_set<std::string> processedPayloads;
+
+            while (!dataQueue.empty())
             {
-                if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(element.data()), element.size());
-                    VerifyMessageBufferBuffer(verifier))
+                const auto& element = dataQueue.front();
+                try
                 {
-                    scanOrchestrator->processEvent(element);
+                    if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(element.data()),
+                                                       element.size());
+                        VerifyMessageBufferBuffer(verifier))
+                    {
+                        // The key skips the buffer envelope (which carries the push
+                        // timestamp) and covers the type plus the raw payload.
+                        const auto messageBuffer = GetMessageBuffer(element.data());
+                        std::string payloadKey {std::to_string(messageBuffer->type())};
+                        payloadKey.append(messageBuffer->data()->begin(), messageBuffer->data()->end());
+
+                        if (processedPayloads.emplace(std::move(payloadKey)).second)
+                        {
+                            scanOrchestrator->processEvent(element);
+                        }
+                        else
+                        {
+                            logDebug2(WM_VULNSCAN_LOGTAG, "Coalesced duplicated event within the batch.");
+                        }
+                    }
                 }
-            }
-            catch (const WdbDataException& e)
-            {
-                logDebug2(WM_VULNSCAN_LOGTAG, "WdbDataException (Agent %s). Reason: %s", e.agentId().c_str(), e.what());
-                scanOrchestrator->pushEventToDelayedDispatcher(element, e.agentId());
-            }
-            catch (const AgentReScanListException& e)
-            {
-                logDebug2(WM_VULNSCAN_LOGTAG, "AgentReScanListException. Reason: %s", e.what());
-                for (const auto& agentData : e.agentList())
+                catch (const WdbDataException& e)
                 {
-                    scanOrchestrator->pushReScanToDelayedDispatcher(agentData.id, e.noIndex());
+                    logDebug2(
+                        WM_VULNSCAN_LOGTAG, "WdbDataException (Agent %s). Reason: %s", e.agentId().c_str(), e.what());
+                    scanOrchestrator->pushEventToDelayedDispatcher(element, e.agentId());
                 }
-            }
-            catch (const nlohmann::json::exception& e)
-            {
-                logError(WM_VULNSCAN_LOGTAG,
-                         "VulnerabilityScannerFacade::initEventDispatcher: json exception (%d) - Event message: %s",
-                         e.id,
-                         parseEventMessage(element).c_str());
-            }
-            catch (const std::exception& e)
-            {
-                logError(WM_VULNSCAN_LOGTAG,
-                         "VulnerabilityScannerFacade::initEventDispatcher: %s - Event message: %s",
-                         e.what(),
-                         parseEventMessage(element).c_str());
+                catch (const AgentReScanListException& e)
+                {
+                    logDebug2(WM_VULNSCAN_LOGTAG, "AgentReScanListException. Reason: %s", e.what());
+                    for (const auto& agentData : e.agentList())
+                    {
+                        scanOrchestrator->pushReScanToDelayedDispatcher(agentData.id, e.noIndex());
+                    }
+                }
+                catch (const nlohmann::json::exception& e)
+                {
+                    logError(WM_VULNSCAN_LOGTAG,
+                             "VulnerabilityScannerFacade::initEventDispatcher: json exception (%d) - Event message: %s",
+                             e.id,
+                             parseEventMessage(element).c_str());
+                }
+                catch (const std::exception& e)
+                {
+                    logError(WM_VULNSCAN_LOGTAG,
+                             "VulnerabilityScannerFacade::initEventDispatcher: %s - Event message: %s",
+                             e.what(),
+                             parseEventMessage(element).c_str());
+                }
+
+                dataQueue.pop();
             }
         });
 }
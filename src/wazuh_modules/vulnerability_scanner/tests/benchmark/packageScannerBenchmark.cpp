@@ -0,0 +1,331 @@
+/**
+ * Package scan benchmarks over synthetic feed fixtures.
+ *
+ * `PackageScannerFixture` drives `TPackageScanner` (and the full
+ * PackageScanner -> ResponseBuilder orchestration, as `TFactoryOrchestrator`
+ * assembles it) with a fake in-memory feed manager that serves a prebuilt
+ * flatbuffer of vulnerability candidates, so the numbers measure the matching
+ * and response-building work, not RocksDB. The host-scan benchmarks rescan
+ * synthetic hosts of 500/2000/5000 packages per iteration, which is the
+ * recurring fleet-rescan shape.
+ */
+#include "databaseFeedManager.hpp"
+#include "factoryOrchestrator.hpp"
+#include "packageScanner.hpp"
+#include "responseBuilder.hpp"
+#include "scanContext.hpp"
+#include <base/logging.hpp>
+#include <benchmark/benchmark.h>
+#include <flatbuffers/flatbuffer_builder.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+const auto AGENT_MSG =
+    R"({
+        "id": "001",
+        "ip": "192.168.33.20",
+        "name": "focal"
+    })"_json;
+
+const auto OS_MSG =
+    R"({
+        "hostname": "bench_hostname",
+        "architecture": "x86_64",
+        "name": "Ubuntu",
+        "codename": "upstream",
+        "major_version": "20",
+        "minor_version": "04",
+        "patch": "0",
+        "build": "0",
+        "platform": "ubuntu",
+        "version": "20.04",
+        "release": "5.4.0",
+        "display_version": "20.04",
+        "sysname": "Linux",
+        "kernel_version": "5.4.0",
+        "kernel_release": "5.4.0-84-generic"
+    })"_json;
+
+const auto HOTFIXES_MSG = "{}"_json;
+
+const nlohmann::json CNA_MAPPINGS = R"***(
+    {
+      "cnaMapping": {
+        "alas": "alas_$(MAJOR_VERSION)",
+        "alma": "alma_$(MAJOR_VERSION)",
+        "redhat": "redhat_$(MAJOR_VERSION)",
+        "suse": "$(PLATFORM)_$(MAJOR_VERSION)"
+      },
+      "majorVersionEquivalence": {
+        "amzn": {
+          "2018": "1"
+        }
+      },
+      "platformEquivalence": {
+        "sled": "suse_desktop",
+        "sles": "suse_server"
+      }
+    }
+    )***"_json;
+
+const nlohmann::json CPE_MAPPINGS = "{}"_json;
+
+const nlohmann::json VENDORS_MAP = R"({
+    "adp_descriptions": {
+        "nvd": {
+            "adp": "National Vulnerability Database"
+        }
+    }
+    })"_json;
+
+/**
+ * @brief Synthetic package entry, version laid out so only the candidates with
+ * an open upper bound match it.
+ */
+nlohmann::json makePackage(const size_t index)
+{
+    nlohmann::json package;
+    package["architecture"] = "amd64";
+    package["checksum"] = "1e6ce14f97f57d1bbd46ff8e5d3e133171a1bbce";
+    package["description"] = "synthetic fleet package";
+    package["format"] = "deb";
+    package["groups"] = "libs";
+    package["item_id"] = "item_" + std::to_string(index);
+    package["multiarch"] = "same";
+    package["name"] = "pkg-" + std::to_string(index);
+    package["priority"] = "optional";
+    package["scan_time"] = "2024/01/01 00:00:00";
+    package["size"] = 72;
+    package["source"] = "upstream-src";
+    package["vendor"] = "Synthetic Vendor";
+    package["version"] = std::to_string(1 + index % 9) + "." + std::to_string(index % 10) + "."
+                         + std::to_string(index % 5);
+    package["install_time"] = "1577890801";
+    return package;
+}
+
+/**
+ * @brief In-memory feed fixture, same surface as DatabaseFeedManager.
+ *
+ * Serves a flatbuffer of vulnerability candidates built once at construction:
+ * every AFFECTED_EVERY-th candidate has an open upper bound so it matches any
+ * package version, the rest never match, approximating the hit rate of a real
+ * feed where most candidates are discarded by the version comparison.
+ */
+class FakeFeedManager final
+{
+public:
+    static constexpr size_t AFFECTED_EVERY {8};
+
+    explicit FakeFeedManager(const size_t candidatesPerPackage)
+    {
+        std::vector<flatbuffers::Offset<NSVulnerabilityScanner::ScanVulnerabilityCandidate>> candidates;
+        candidates.reserve(candidatesPerPackage);
+        for (size_t i = 0; i < candidatesPerPackage; ++i)
+        {
+            const auto cveId = "CVE-2024-" + std::to_string(1000 + i);
+            const bool affected = (i % AFFECTED_EVERY) == (AFFECTED_EVERY - 1);
+
+            std::vector<flatbuffers::Offset<flatbuffers::String>> platforms {
+                m_candidatesBuilder.CreateString("upstream")};
+            std::vector<flatbuffers::Offset<NSVulnerabilityScanner::Version>> versions {
+                NSVulnerabilityScanner::CreateVersionDirect(m_candidatesBuilder,
+                                                            NSVulnerabilityScanner::Status_affected,
+                                                            "0",
+                                                            affected ? "999.999.999" : "0.0.1",
+                                                            nullptr,
+                                                            "custom")};
+            candidates.emplace_back(
+                NSVulnerabilityScanner::CreateScanVulnerabilityCandidateDirect(m_candidatesBuilder,
+                                                                               cveId.c_str(),
+                                                                               NSVulnerabilityScanner::Status_unknown,
+                                                                               &platforms,
+                                                                               &versions,
+                                                                               nullptr));
+        }
+        m_candidatesBuilder.Finish(
+            NSVulnerabilityScanner::CreateScanVulnerabilityCandidateArrayDirect(m_candidatesBuilder, &candidates));
+        m_candidatesArray =
+            NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(m_candidatesBuilder.GetBufferPointer());
+
+        m_descriptionBuilder.Finish(
+            NSVulnerabilityScanner::CreateVulnerabilityDescriptionDirect(m_descriptionBuilder,
+                                                                         "LOW",
+                                                                         "nvd",
+                                                                         "NETWORK",
+                                                                         "NONE",
+                                                                         "PARTIAL",
+                                                                         "Critical",
+                                                                         "PARTIAL",
+                                                                         "CWE-476",
+                                                                         "2024-01-01",
+                                                                         "2024-01-02",
+                                                                         "Synthetic description for benchmarks",
+                                                                         "PARTIAL",
+                                                                         "NONE",
+                                                                         "https://example.invalid/cve",
+                                                                         "UNCHANGED",
+                                                                         8.3,
+                                                                         "2",
+                                                                         "HIGH",
+                                                                         "NONE"));
+    }
+
+    void getVulnerabilitiesCandidates(
+        const std::string& cnaName,
+        const PackageData& package,
+        const std::function<bool(const std::string& cnaName,
+                                 const PackageData& package,
+                                 const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& callback)
+    {
+        for (const auto& candidate : *m_candidatesArray->candidates())
+        {
+            if (callback(cnaName, package, *candidate))
+            {
+                // If the candidate is vulnerable, we stop looking for.
+                break;
+            }
+        }
+    }
+
+    std::vector<PackageData> checkAndTranslatePackage(const PackageData& /*package*/,
+                                                      const std::string& /*osPlatform*/)
+    {
+        return {};
+    }
+
+    void fillL2CacheTranslations(const std::string_view& /*packageName*/) {}
+
+    std::vector<PackageData> getTranslationFromL2(const PackageData& /*package*/, const std::string& /*osPlatform*/)
+    {
+        return {};
+    }
+
+    void update(nlohmann::json& /*data*/) {}
+
+    std::string getCnaNameByFormat(std::string_view /*format*/) { return "cnaName"; }
+    std::string getCnaNameByContains(std::string_view /*vendor*/, std::string_view /*platform*/) { return {}; }
+    std::string getCnaNameByPrefix(std::string_view /*vendor*/, std::string_view /*platform*/) { return {}; }
+    std::string getCnaNameBySource(std::string_view /*source*/) { return {}; }
+
+    void getVulnerabilityRemediation(const std::string& /*cveId*/,
+                                     FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo>& /*dto*/)
+    {
+    }
+
+    bool getVulnerabilityDescriptiveInformation(
+        const std::string& /*cveId*/,
+        const std::string& /*subShortName*/,
+        FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer)
+    {
+        resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+            NSVulnerabilityScanner::GetVulnerabilityDescription(m_descriptionBuilder.GetBufferPointer()));
+        return true;
+    }
+
+    const nlohmann::json& cpeMappings() { return CPE_MAPPINGS; }
+    const nlohmann::json& cnaMappings() { return CNA_MAPPINGS; }
+    const nlohmann::json& vendorsMap() { return VENDORS_MAP; }
+
+private:
+    flatbuffers::FlatBufferBuilder m_candidatesBuilder;
+    flatbuffers::FlatBufferBuilder m_descriptionBuilder;
+    const NSVulnerabilityScanner::ScanVulnerabilityCandidateArray* m_candidatesArray {nullptr};
+};
+
+void initLoggingOnce()
+{
+    static const bool initialized = []()
+    {
+        logging::testInit();
+        return true;
+    }();
+    benchmark::DoNotOptimize(initialized);
+}
+
+/**
+ * @brief Version match of one package against the candidate feed. Argument:
+ * candidates per package.
+ */
+void BM_PackageScanner(benchmark::State& state)
+{
+    initLoggingOnce();
+
+    auto feedManager = std::make_shared<FakeFeedManager>(static_cast<size_t>(state.range(0)));
+    TPackageScanner<FakeFeedManager, ScanContext> packageScanner(feedManager);
+
+    const auto package = makePackage(0);
+    nlohmann::json response;
+    auto context =
+        std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, package, HOTFIXES_MSG, response);
+
+    for (auto _ : state)
+    {
+        context->reset(ScannerType::Package, AGENT_MSG, OS_MSG, package, HOTFIXES_MSG, response);
+        packageScanner.handleRequest(context);
+        benchmark::DoNotOptimize(context);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PackageScanner)->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Full rescan of a synthetic host through the PackageScanner ->
+ * ResponseBuilder orchestration, as TFactoryOrchestrator assembles it. One
+ * iteration scans every package of the host, so the iteration time is the
+ * host-rescan latency and items/s is the sustained package scan rate.
+ * Arguments: packages per host, candidates per package.
+ */
+void BM_HostScan(benchmark::State& state)
+{
+    initLoggingOnce();
+
+    const auto packagesPerHost = static_cast<size_t>(state.range(0));
+
+    auto feedManager = std::make_shared<FakeFeedManager>(static_cast<size_t>(state.range(1)));
+    auto orchestration = TFactoryOrchestrator<TPackageScanner<FakeFeedManager, ScanContext>,
+                                              TOsScanner<FakeFeedManager, ScanContext>,
+                                              TResponseBuilder<FakeFeedManager, ScanContext>,
+                                              ScanContext,
+                                              FakeFeedManager>::create(ScannerType::Package, feedManager);
+
+    std::vector<nlohmann::json> packages;
+    packages.reserve(packagesPerHost);
+    for (size_t i = 0; i < packagesPerHost; ++i)
+    {
+        packages.emplace_back(makePackage(i));
+    }
+
+    nlohmann::json response;
+    auto context = std::make_shared<ScanContext>(
+        ScannerType::Package, AGENT_MSG, OS_MSG, packages.front(), HOTFIXES_MSG, response);
+
+    for (auto _ : state)
+    {
+        response.clear();
+        for (const auto& package : packages)
+        {
+            context->reset(ScannerType::Package, AGENT_MSG, OS_MSG, package, HOTFIXES_MSG, response);
+            orchestration->handleRequest(context);
+        }
+        benchmark::DoNotOptimize(response);
+    }
+
+    state.SetItemsProcessed(state.iterations() * packagesPerHost);
+    state.counters["detections"] =
+        benchmark::Counter(static_cast<double>(response.size()), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_HostScan)
+    ->Args({500, 16})
+    ->Args({2000, 16})
+    ->Args({5000, 16})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+} // namespace
@@ -412,11 +412,209 @@ BENCHMARK_DEFINE_F(ComparisonSemVerPerformanceFixture, ComparisonSemVerPerforman
     }
 }
 
+constexpr size_t DPKG_VECTOR_SIZE {1000};
+constexpr int DPKG_PROBABILITY_EQUAL {20};
+constexpr int DPKG_PROBABILITY_EPOCH {30};
+constexpr int DPKG_PROBABILITY_REVISION {80};
+
+/**
+ * @brief ComparisonDpkgPerformanceFixture class.
+ *
+ */
+class ComparisonDpkgPerformanceFixture : public benchmark::Fixture
+{
+private:
+    /**
+     * @brief Create a random version string.
+     *
+     * @param stringOut string object output reference.
+     */
+    void createRandomVersionString(std::string& stringOut)
+    {
+        std::ostringstream oss;
+        if (((std::rand() % 100) + 1) < DPKG_PROBABILITY_EPOCH)
+        {
+            // Has epoch section
+            oss << std::dec << (std::rand() % 10) << ":";
+        }
+
+        oss << std::dec << (std::rand() % 10);
+        int versionStrDigits = (std::rand() % 3) + 1;
+        for (int currentDigit = 0; currentDigit < versionStrDigits; currentDigit++)
+        {
+            oss << "." << std::dec << (std::rand() % 100);
+        }
+
+        if (((std::rand() % 100) + 1) < DPKG_PROBABILITY_REVISION)
+        {
+            // Has debian revision section
+            oss << "-" << std::dec << (std::rand() % 10) << "ubuntu" << (std::rand() % 10);
+        }
+
+        stringOut = oss.str();
+    }
+
+public:
+    std::vector<std::string> vectorVersionA; ///< Container of version A strings.
+    std::vector<std::string> vectorVersionB; ///< Container of version B strings.
+    size_t currentIdx;                       ///< Current index of container
+
+    /**
+     * @brief Benchmark setup routine.
+     *
+     * @param state Benchmark state.
+     */
+    void SetUp(const ::benchmark::State& state) override
+    {
+        vectorVersionA.resize(DPKG_VECTOR_SIZE);
+        for (auto& item : vectorVersionA)
+        {
+            createRandomVersionString(item);
+        }
+
+        currentIdx = 0;
+        vectorVersionB.resize(DPKG_VECTOR_SIZE);
+        for (auto& item : vectorVersionB)
+        {
+            if (((std::rand() % 100) + 1) < DPKG_PROBABILITY_EQUAL)
+            {
+                item = vectorVersionA[currentIdx];
+            }
+            else
+            {
+                createRandomVersionString(item);
+            }
+            currentIdx++;
+        }
+
+        currentIdx = 0;
+    }
+
+    /**
+     * @brief Benchmark teardown routine.
+     *
+     * @param state Benchmark state.
+     */
+    void TearDown(const ::benchmark::State& state) override {}
+};
+
+BENCHMARK_DEFINE_F(ComparisonDpkgPerformanceFixture, ComparisonDpkgPerformance)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        VersionMatcher::compare(vectorVersionA[currentIdx], vectorVersionB[currentIdx], VersionObjectType::DPKG);
+        if (++currentIdx >= DPKG_VECTOR_SIZE)
+        {
+            currentIdx = 0;
+        }
+    }
+}
+
+constexpr size_t RPM_VECTOR_SIZE {1000};
+constexpr int RPM_PROBABILITY_EQUAL {20};
+constexpr int RPM_PROBABILITY_EPOCH {30};
+constexpr int RPM_PROBABILITY_RELEASE {80};
+
+/**
+ * @brief ComparisonRpmPerformanceFixture class.
+ *
+ */
+class ComparisonRpmPerformanceFixture : public benchmark::Fixture
+{
+private:
+    /**
+     * @brief Create a random version string.
+     *
+     * @param stringOut string object output reference.
+     */
+    void createRandomVersionString(std::string& stringOut)
+    {
+        std::ostringstream oss;
+        if (((std::rand() % 100) + 1) < RPM_PROBABILITY_EPOCH)
+        {
+            // Has epoch section
+            oss << std::dec << (std::rand() % 10) << ":";
+        }
+
+        oss << std::dec << (std::rand() % 10);
+        int versionStrDigits = (std::rand() % 3) + 1;
+        for (int currentDigit = 0; currentDigit < versionStrDigits; currentDigit++)
+        {
+            oss << "." << std::dec << (std::rand() % 100);
+        }
+
+        if (((std::rand() % 100) + 1) < RPM_PROBABILITY_RELEASE)
+        {
+            // Has release section
+            oss << "-" << std::dec << (std::rand() % 100) << ".el" << ((std::rand() % 5) + 5);
+        }
+
+        stringOut = oss.str();
+    }
+
+public:
+    std::vector<std::string> vectorVersionA; ///< Container of version A strings.
+    std::vector<std::string> vectorVersionB; ///< Container of version B strings.
+    size_t currentIdx;                       ///< Current index of container
+
+    /**
+     * @brief Benchmark setup routine.
+     *
+     * @param state Benchmark state.
+     */
+    void SetUp(const ::benchmark::State& state) override
+    {
+        vectorVersionA.resize(RPM_VECTOR_SIZE);
+        for (auto& item : vectorVersionA)
+        {
+            createRandomVersionString(item);
+        }
+
+        currentIdx = 0;
+        vectorVersionB.resize(RPM_VECTOR_SIZE);
+        for (auto& item : vectorVersionB)
+        {
+            if (((std::rand() % 100) + 1) < RPM_PROBABILITY_EQUAL)
+            {
+                item = vectorVersionA[currentIdx];
+            }
+            else
+            {
+                createRandomVersionString(item);
+            }
+            currentIdx++;
+        }
+
+        currentIdx = 0;
+    }
+
+    /**
+     * @brief Benchmark teardown routine.
+     *
+     * @param state Benchmark state.
+     */
+    void TearDown(const ::benchmark::State& state) override {}
+};
+
+BENCHMARK_DEFINE_F(ComparisonRpmPerformanceFixture, ComparisonRpmPerformance)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        VersionMatcher::compare(vectorVersionA[currentIdx], vectorVersionB[currentIdx], VersionObjectType::RPM);
+        if (++currentIdx >= RPM_VECTOR_SIZE)
+        {
+            currentIdx = 0;
+        }
+    }
+}
+
 BENCHMARK_REGISTER_F(ComparisonCalVerPerformanceFixture, ComparisonCalVerPerformance)->Iterations(100000)->Threads(1);
 BENCHMARK_REGISTER_F(ComparisonPEP440PerformanceFixture, ComparisonPEP440Performance)->Iterations(100000)->Threads(1);
 BENCHMARK_REGISTER_F(ComparisonMajorMinorPerformanceFixture, ComparisonMajorMinorPerformance)
     ->Iterations(100000)
     ->Threads(1);
 BENCHMARK_REGISTER_F(ComparisonSemVerPerformanceFixture, ComparisonSemVerPerformance)->Iterations(100000)->Threads(1);
+BENCHMARK_REGISTER_F(ComparisonDpkgPerformanceFixture, ComparisonDpkgPerformance)->Iterations(100000)->Threads(1);
+BENCHMARK_REGISTER_F(ComparisonRpmPerformanceFixture, ComparisonRpmPerformance)->Iterations(100000)->Threads(1);
 
 BENCHMARK_MAIN();
@@ -446,6 +446,7 @@ int main(const int argc, const char* argv[])
             tempSocketClient->connect(
                 [](const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader) {},
                 []() {},
+                []() {},
                 SOCK_DGRAM);
             tempSocketClient->send("stop", 4);
 